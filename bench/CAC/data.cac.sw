@@ -0,0 +1,6191 @@
+CAC diamond model: 4 x 4 x 2 elements of scale 4, 1 unit cells of atoms, 32 elements and 2048 atoms
+
+2080 CAC_elements
+1 atom types
+
+-5.43100000 92.32700000 xlo xhi
+-5.43100000 92.32700000 ylo yhi
+-5.43100000 54.31000000 zlo zhi
+
+Masses
+
+1 28.0855
+
+CAC_Elements
+
+1 Eight_Node 8 4 4 4
+1 1 1 -0.00833801 -0.04898308 0.03252065
+1 2 1 2.69536399 -0.01315883 2.68486613
+1 3 1 2.72210082 2.68166878 -0.03757331
+1 4 1 -0.00670637 2.72170785 2.68293436
+1 5 1 1.36307211 1.34324014 1.40355648
+1 6 1 4.03237941 1.40561400 4.06446194
+1 7 1 4.07364354 4.03806462 1.37964671
+1 8 1 1.32674714 4.05740604 4.02560212
+2 1 1 21.70795178 0.04674825 0.04787985
+2 2 1 24.46395300 -0.04965454 2.75952385
+2 3 1 24.47657670 2.74258343 -0.03211262
+2 4 1 21.68394996 2.70695325 2.75405365
+2 5 1 23.08955860 1.38140822 1.33101211
+2 6 1 25.79960976 1.37868864 4.10573339
+2 7 1 25.82796245 4.04648081 1.39506900
+2 8 1 23.05338804 4.10343992 4.07875853
+3 1 1 21.69258284 21.73286086 0.00182394
+3 2 1 24.48536625 21.67815392 2.68191383
+3 3 1 24.48782927 24.47272049 -0.03497275
+3 4 1 21.69691130 24.44341383 2.68119808
+3 5 1 23.06412607 23.03668192 1.37891773
+3 6 1 25.75510627 23.13121043 4.11530698
+3 7 1 25.82613289 25.82449059 1.34452523
+3 8 1 23.09962062 25.82337588 4.07132763
+4 1 1 -0.04384750 21.73661039 -0.01742392
+4 2 1 2.72650891 21.71608285 2.76075308
+4 3 1 2.68565946 24.46638564 0.01985619
+4 4 1 0.00565630 24.39750463 2.68199517
+4 5 1 1.40447820 23.05481425 1.32410430
+4 6 1 4.05207957 23.08546205 4.07521133
+4 7 1 4.02358318 25.74756850 1.35735665
+4 8 1 1.32623545 25.80800008 4.10309630
+5 1 1 -0.04041267 0.00051672 21.71461381
+5 2 1 2.74454533 0.04547929 24.43117182
+5 3 1 2.68982678 2.75334734 21.67672757
+5 4 1 -0.01695342 2.70497751 24.40729839
+5 5 1 1.37574349 1.35957663 23.05664406
+5 6 1 4.06457507 1.37693833 25.77974640
+5 7 1 4.03002060 4.06930030 23.05125645
+5 8 1 1.36988125 4.04343894 25.76075258
+6 1 1 21.76339611 -0.01697119 21.70323052
+6 2 1 24.44332590 0.01933820 24.45659971
+6 3 1 24.46933939 2.69149362 21.71668760
+6 4 1 21.71039603 2.71716870 24.44690463
+6 5 1 23.09467883 1.31454540 23.06887173
+6 6 1 25.81810639 1.31128273 25.82187382
+6 7 1 25.81584014 4.06342914 23.07666713
+6 8 1 23.05818407 4.09697211 25.79529054
+7 1 1 21.70051295 21.67693527 21.70850715
+7 2 1 24.48159920 21.74161449 24.45206025
+7 3 1 24.48288809 24.39256050 21.73424564
+7 4 1 21.69279508 24.42919443 24.40768354
+7 5 1 23.06666298 23.12188784 23.10428923
+7 6 1 25.83187917 23.03929837 25.77733434
+7 7 1 25.82566606 25.75129513 23.05072225
+7 8 1 23.03993568 25.82900562 25.77047461
+8 1 1 -0.00757082 21.67538561 21.68536666
+8 2 1 2.71689963 21.75313105 24.42360268
+8 3 1 2.69743485 24.39358121 21.68396160
+8 4 1 -0.03514851 24.41012578 24.44648488
+8 5 1 1.34363934 23.12952271 23.06016100
+8 6 1 4.10887795 23.04092742 25.80001047
+8 7 1 4.07819743 25.81297960 23.07276363
+8 8 1 1.36014892 25.82503125 25.76241019
+2 Eight_Node 8 4 4 4
+1 1 1 0.00316194 0.00880814 21.75216971
+1 2 1 2.68187112 -0.00854137 24.39195693
+1 3 1 2.73175560 2.75230295 21.70935276
+1 4 1 0.03162658 2.73130285 24.39120385
+1 5 1 1.35477400 1.31232390 23.06307221
+1 6 1 4.10331391 1.32029602 25.80378695
+1 7 1 4.02892188 4.03423255 23.12696643
+1 8 1 1.31739074 4.04066141 25.84125751
+2 1 1 21.70488509 -0.02835095 21.68364557
+2 2 1 24.43942604 -0.04411088 24.41150534
+2 3 1 24.41171184 2.74001461 21.69021303
+2 4 1 21.73281377 2.68966913 24.48888211
+2 5 1 23.13081382 1.40013537 23.12175835
+2 6 1 25.80261940 1.40083556 25.81123600
+2 7 1 25.76318908 4.09648486 23.11667865
+2 8 1 23.03319515 4.04274191 25.82568002
+3 1 1 21.75080498 21.73005807 21.68623100
+3 2 1 24.41602532 21.69757153 24.48755839
+3 3 1 24.41203247 24.42651221 21.74290329
+3 4 1 21.74031663 24.44571925 24.45456766
+3 5 1 23.11825063 23.12314555 23.04259469
+3 6 1 25.75026283 23.12310904 25.83827654
+3 7 1 25.78404795 25.78721971 23.10024099
+3 8 1 23.07390091 25.75835278 25.77217213
+4 1 1 -0.01962802 21.73061962 21.69112110
+4 2 1 2.73836333 21.77097890 24.42798446
+4 3 1 2.72253148 24.45312463 21.75379815
+4 4 1 0.01291134 24.44115203 24.46155024
+4 5 1 1.31012550 23.12572930 23.12161327
+4 6 1 4.09263177 23.05191191 25.80981042
+4 7 1 4.02606239 25.78701995 23.05328695
+4 8 1 1.36387376 25.77229273 25.75647808
+5 1 1 0.02938641 -0.02487284 43.45397103
+5 2 1 2.66715485 0.00634625 46.19242496
+5 3 1 2.74399927 2.69833893 43.41084040
+5 4 1 0.01094765 2.69615075 46.14208164
+5 5 1 1.32876144 1.34708218 44.82397055
+5 6 1 4.06340434 1.37239473 47.54403243
+5 7 1 4.10428440 4.08032911 44.85478168
+5 8 1 1.35795736 4.07696835 47.53708246
+6 1 1 21.77113049 0.02019470 43.48968337
+6 2 1 24.40536627 -0.00780019 46.18385138
+6 3 1 24.46277158 2.74850189 43.42463574
+6 4 1 21.70547164 2.70677230 46.15273671
+6 5 1 23.04101984 1.34672606 44.81998884
+6 6 1 25.82119703 1.33073756 47.53331776
+6 7 1 25.82236043 4.03880225 44.75718227
+6 8 1 23.04776249 4.09114303 47.56258202
+7 1 1 21.71272623 21.70519979 43.46072634
+7 2 1 24.42111874 21.67792105 46.13802836
+7 3 1 24.44955419 24.43528006 43.43268990
+7 4 1 21.71321636 24.40321189 46.19024037
+7 5 1 23.06915325 23.10074743 44.81252921
+7 6 1 25.83726117 23.11139456 47.48447889
+7 7 1 25.79239239 25.74836466 44.83125906
+7 8 1 23.05482578 25.84490884 47.49379276
+8 1 1 0.00082124 21.72315881 43.48073311
+8 2 1 2.72501717 21.76210983 46.14546401
+8 3 1 2.67524842 24.40807137 43.40262839
+8 4 1 0.02073682 24.45810595 46.18896615
+8 5 1 1.38583771 23.04426587 44.76216520
+8 6 1 4.08915794 23.03186465 47.50495612
+8 7 1 4.08201625 25.81249294 44.81730974
+8 8 1 1.40268921 25.84471220 47.50230375
+3 Eight_Node 8 4 4 4
+1 1 1 -0.01850079 21.67614240 -0.03789387
+1 2 1 2.70931743 21.73817163 2.68906805
+1 3 1 2.67544337 24.45799437 0.01722190
+1 4 1 0.00003844 24.40359504 2.68519111
+1 5 1 1.33456001 23.11702954 1.40036505
+1 6 1 4.02796621 23.12542601 4.11451869
+1 7 1 4.10253657 25.77057785 1.40444902
+1 8 1 1.38861636 25.76118704 4.02682842
+2 1 1 21.71179968 21.73195567 -0.04753484
+2 2 1 24.48496210 21.74128000 2.71716815
+2 3 1 24.43869343 24.39997489 0.02477790
+2 4 1 21.74815327 24.39174279 2.74619789
+2 5 1 23.06718280 23.12506302 1.34195674
+2 6 1 25.76843612 23.05133228 4.05640423
+2 7 1 25.75432345 25.76350015 1.35500204
+2 8 1 23.08696955 25.80300312 4.03645035
+3 1 1 21.67646093 43.41267228 0.03994763
+3 2 1 24.40313417 43.46636622 2.72104979
+3 3 1 24.44950726 46.20719037 -0.02443357
+3 4 1 21.74425489 46.16525393 2.70235385
+3 5 1 23.07185959 44.77598614 1.31783346
+3 6 1 25.83938534 44.81978198 4.04023500
+3 7 1 25.82756131 47.48972256 1.37397623
+3 8 1 23.09041453 47.55092764 4.06447543
+4 1 1 0.04552080 43.46990874 -0.00508142
+4 2 1 2.67760680 43.42381023 2.67873484
+4 3 1 2.71761625 46.19408544 0.02421790
+4 4 1 0.01370748 46.15618515 2.69334643
+4 5 1 1.38813792 44.82287119 1.37411052
+4 6 1 4.07907158 44.83481532 4.08213775
+4 7 1 4.04958364 47.50860403 1.33872386
+4 8 1 1.33691703 47.56109208 4.09440578
+5 1 1 0.01136267 21.71909057 21.72253871
+5 2 1 2.67601409 21.72145536 24.44828176
+5 3 1 2.70052698 24.44022326 21.77392905
+5 4 1 0.04129906 24.39720235 24.48410228
+5 5 1 1.38719808 23.11298002 23.11221037
+5 6 1 4.04411527 23.04495188 25.81144293
+5 7 1 4.10603785 25.75744797 23.03318814
+5 8 1 1.40244790 25.83825206 25.77339393
+6 1 1 21.75690494 21.70385841 21.75815201
+6 2 1 24.39079724 21.73483904 24.41197554
+6 3 1 24.45308625 24.39200643 21.73872258
+6 4 1 21.68397893 24.43386199 24.39649721
+6 5 1 23.07010984 23.04734918 23.06454717
+6 6 1 25.79420607 23.09766139 25.81061140
+6 7 1 25.79960378 25.83252492 23.07283187
+6 8 1 23.04616499 25.81577815 25.78296730
+7 1 1 21.76747699 43.43701890 21.67538484
+7 2 1 24.42388550 43.49396477 24.43729867
+7 3 1 24.47178509 46.15029571 21.73484166
+7 4 1 21.68159192 46.13374786 24.39990334
+7 5 1 23.07200110 44.78809328 23.08753058
+7 6 1 25.81212686 44.77974301 25.77406578
+7 7 1 25.74970835 47.48341656 23.06989472
+7 8 1 23.12167327 47.49007730 25.78803024
+8 1 1 -0.04871773 43.45687805 21.71608081
+8 2 1 2.69861993 43.43698368 24.41677290
+8 3 1 2.70630822 46.13197741 21.74525555
+8 4 1 0.04331359 46.20418048 24.42614244
+8 5 1 1.30891275 44.83264110 23.07790459
+8 6 1 4.07777428 44.82132950 25.82841044
+8 7 1 4.07504432 47.51469225 23.04489559
+8 8 1 1.31193586 47.48779097 25.76271658
+4 Eight_Node 8 4 4 4
+1 1 1 0.04408010 21.73068520 21.67674342
+1 2 1 2.69732236 21.71519836 24.47294740
+1 3 1 2.70682750 24.44418185 21.70040499
+1 4 1 -0.01768572 24.39747472 24.46779340
+1 5 1 1.35664752 23.10488935 23.08896662
+1 6 1 4.03214950 23.05863445 25.77926675
+1 7 1 4.10156536 25.78189848 23.12831392
+1 8 1 1.38741855 25.81632560 25.80040924
+2 1 1 21.74323781 21.70787230 21.68422284
+2 2 1 24.47532606 21.71995436 24.48532520
+2 3 1 24.46269785 24.44693774 21.71670765
+2 4 1 21.74261288 24.41373776 24.42481938
+2 5 1 23.06371388 23.11360609 23.12673313
+2 6 1 25.75696794 23.03420050 25.78251924
+2 7 1 25.81551246 25.79102488 23.10775520
+2 8 1 23.12856572 25.81387853 25.81385833
+3 1 1 21.68831608 43.45650386 21.73676029
+3 2 1 24.40902120 43.40058990 24.45732113
+3 3 1 24.48882681 46.17816731 21.69407763
+3 4 1 21.76104093 46.14525966 24.42363138
+3 5 1 23.11309525 44.83516185 23.12486459
+3 6 1 25.83572362 44.75598650 25.77012418
+3 7 1 25.80553594 47.49442773 23.11685804
+3 8 1 23.10538369 47.54685369 25.84164195
+4 1 1 0.02076746 43.49434230 21.72064985
+4 2 1 2.67908442 43.44966018 24.48437299
+4 3 1 2.72692238 46.14571570 21.68385088
+4 4 1 -0.03658470 46.12576136 24.46056844
+4 5 1 1.34059244 44.79921070 23.12930134
+4 6 1 4.05646307 44.82110042 25.78215572
+4 7 1 4.06181190 47.51389931 23.07620681
+4 8 1 1.31943878 47.53542759 25.80287343
+5 1 1 -0.03883533 21.77144441 43.49670061
+5 2 1 2.69299232 21.70806394 46.19156449
+5 3 1 2.71611892 24.44615559 43.47444150
+5 4 1 0.02516616 24.41603718 46.16221309
+5 5 1 1.38879522 23.12003416 44.84236168
+5 6 1 4.10321829 23.09757248 47.47386103
+5 7 1 4.05982237 25.81815627 44.78004478
+5 8 1 1.31404696 25.80664765 47.54808386
+6 1 1 21.77361412 21.74682116 43.44286986
+6 2 1 24.39270414 21.74199084 46.20274069
+6 3 1 24.44130057 24.44576605 43.40722028
+6 4 1 21.70607922 24.44870968 46.19379101
+6 5 1 23.06420555 23.11492546 44.81457000
+6 6 1 25.80274483 23.05184405 47.54076013
+6 7 1 25.76094801 25.78929476 44.84440120
+6 8 1 23.11854185 25.84170079 47.49061449
+7 1 1 21.76444847 43.44487401 43.41444486
+7 2 1 24.47913859 43.49302435 46.21082128
+7 3 1 24.42534592 46.13599155 43.49046820
+7 4 1 21.74527875 46.20604990 46.18644163
+7 5 1 23.13021341 44.82875185 44.83773839
+7 6 1 25.83953576 44.79872397 47.56323449
+7 7 1 25.78862109 47.56735082 44.80996740
+7 8 1 23.09583639 47.47222651 47.50519125
+8 1 1 -0.02250152 43.39919976 43.42930362
+8 2 1 2.69121963 43.40887713 46.13906046
+8 3 1 2.75153709 46.13505241 43.46798764
+8 4 1 0.04919046 46.11440802 46.18460864
+8 5 1 1.32119145 44.77423154 44.78654400
+8 6 1 4.11504259 44.84337497 47.48042582
+8 7 1 4.10226225 47.47970788 44.79161971
+8 8 1 1.40772974 47.55921262 47.48222458
+5 Eight_Node 8 4 4 4
+1 1 1 0.00670731 43.44005719 0.01751050
+1 2 1 2.75136635 43.45376605 2.75871328
+1 3 1 2.75513957 46.12984747 -0.04430416
+1 4 1 -0.03020135 46.16429111 2.73499742
+1 5 1 1.39318301 44.82885787 1.37318382
+1 6 1 4.08334769 44.82116049 4.06326103
+1 7 1 4.08952993 47.55487606 1.39339606
+1 8 1 1.37961054 47.53881153 4.03048384
+2 1 1 21.70679642 43.44356106 -0.01929440
+2 2 1 24.40932586 43.43546731 2.74884782
+2 3 1 24.41622142 46.20705345 -0.04936720
+2 4 1 21.71619569 46.18563008 2.74098346
+2 5 1 23.03294330 44.76726538 1.31482946
+2 6 1 25.80376561 44.76522149 4.06288727
+2 7 1 25.77547279 47.48149777 1.34521948
+2 8 1 23.07530119 47.52908660 4.05777714
+3 1 1 21.68088982 65.15489657 0.01940989
+3 2 1 24.38985775 65.17418317 2.66745228
+3 3 1 24.47592138 67.85716620 0.00336171
+3 4 1 21.68313685 67.89222993 2.74478355
+3 5 1 23.12320827 66.55872124 1.39711893
+3 6 1 25.74802805 66.56032880 4.02815114
+3 7 1 25.83430573 69.29488245 1.37951471
+3 8 1 23.09238299 69.26857219 4.03192643
+4 1 1 0.03634307 65.13074111 -0.02612592
+4 2 1 2.69250724 65.19075837 2.70485991
+4 3 1 2.70408929 67.88769852 0.02533030
+4 4 1 0.03398278 67.92201064 2.69382587
+4 5 1 1.31299103 66.48918229 1.31924526
+4 6 1 4.09781821 66.48817520 4.09889876
+4 7 1 4.02342921 69.26394049 1.33248152
+4 8 1 1.37224458 69.27127888 4.08870566
+5 1 1 -0.04260041 43.40007369 21.71226795
+5 2 1 2.75620079 43.44444833 24.41577880
+5 3 1 2.71256536 46.19554563 21.69470883
+5 4 1 -0.03765954 46.20534659 24.43190847
+5 5 1 1.35212963 44.78684113 23.05619631
+5 6 1 4.10944473 44.83599938 25.77265564
+5 7 1 4.09574779 47.56315412 23.07352362
+5 8 1 1.40584719 47.48033072 25.83102307
+6 1 1 21.75908047 43.42322515 21.70168324
+6 2 1 24.41669673 43.41165974 24.47061042
+6 3 1 24.45933766 46.19230169 21.73821127
+6 4 1 21.70014015 46.12221446 24.41534667
+6 5 1 23.11058137 44.75771408 23.08509396
+6 6 1 25.77939222 44.78460106 25.78072582
+6 7 1 25.80641357 47.48814351 23.04765472
+6 8 1 23.11670681 47.54669830 25.78322569
+7 1 1 21.69887832 65.18045615 21.76724832
+7 2 1 24.46831189 65.16630987 24.45295696
+7 3 1 24.42542463 67.90843040 21.72579147
+7 4 1 21.67671858 67.90489433 24.47665793
+7 5 1 23.08022193 66.49575446 23.06208707
+7 6 1 25.76648892 66.56374503 25.82079193
+7 7 1 25.77698500 69.22550490 23.04438167
+7 8 1 23.07577640 69.29285691 25.82294081
+8 1 1 0.04355576 65.12943879 21.76655267
+8 2 1 2.75678476 65.20308325 24.40231269
+8 3 1 2.75238564 67.93530883 21.74803411
+8 4 1 0.00145575 67.87179333 24.47734377
+8 5 1 1.36760258 66.51205276 23.03997458
+8 6 1 4.02498918 66.54995011 25.77681275
+8 7 1 4.03647112 69.22595178 23.07795540
+8 8 1 1.39245736 69.24266696 25.76012682
+6 Eight_Node 8 4 4 4
+1 1 1 0.03284751 43.46544689 21.72859754
+1 2 1 2.75533723 43.43852577 24.42821377
+1 3 1 2.67097608 46.18307547 21.73617207
+1 4 1 0.04474952 46.11428401 24.43078732
+1 5 1 1.35148897 44.79728334 23.03608193
+1 6 1 4.10471078 44.76004716 25.81126787
+1 7 1 4.05450294 47.51371261 23.11554448
+1 8 1 1.32816852 47.52240000 25.77392232
+2 1 1 21.73500888 43.45242008 21.74073452
+2 2 1 24.39904650 43.46126583 24.45571718
+2 3 1 24.39627492 46.21041961 21.75907750
+2 4 1 21.75331185 46.19214340 24.43951259
+2 5 1 23.12328478 44.77125109 23.10612185
+2 6 1 25.84491428 44.76202559 25.81212834
+2 7 1 25.84457076 47.48542759 23.08766365
+2 8 1 23.12153629 47.49762555 25.76825084
+3 1 1 21.74577271 65.20143132 21.76817128
+3 2 1 24.45475551 65.12738491 24.47161727
+3 3 1 24.41809698 67.89385175 21.74608864
+3 4 1 21.77181513 67.89263805 24.40397786
+3 5 1 23.08292366 66.53524251 23.10695955
+3 6 1 25.76635587 66.53491230 25.75221477
+3 7 1 25.84575145 69.19751222 23.08585241
+3 8 1 23.04920704 69.22272497 25.78747455
+4 1 1 -0.02469120 65.14811115 21.70486547
+4 2 1 2.71541954 65.21764451 24.41041943
+4 3 1 2.68276426 67.84178911 21.76556381
+4 4 1 0.02830529 67.92055523 24.40445557
+4 5 1 1.35189208 66.54689836 23.08488301
+4 6 1 4.09648270 66.49917144 25.83750761
+4 7 1 4.08244526 69.25643834 23.09035280
+4 8 1 1.35203892 69.19650747 25.76362315
+5 1 1 -0.00187984 43.40619091 43.45750133
+5 2 1 2.68450248 43.46646343 46.15400086
+5 3 1 2.73126029 46.13969706 43.41045857
+5 4 1 0.01643206 46.19605139 46.13459897
+5 5 1 1.31141514 44.84261214 44.83107568
+5 6 1 4.09993807 44.83481933 47.51297530
+5 7 1 4.11835505 47.55200737 44.83132557
+5 8 1 1.40181334 47.56205986 47.52775035
+6 1 1 21.67964662 43.45700017 43.44757144
+6 2 1 24.39119163 43.42942578 46.19552318
+6 3 1 24.45197945 46.20652706 43.47359086
+6 4 1 21.69257062 46.18482800 46.11819120
+6 5 1 23.11868630 44.78517744 44.85285311
+6 6 1 25.75201950 44.82999439 47.48138531
+6 7 1 25.83355597 47.55298837 44.80697627
+6 8 1 23.08806735 47.49324310 47.50769497
+7 1 1 21.68883351 65.16134975 43.41179443
+7 2 1 24.45291434 65.17129317 46.14903631
+7 3 1 24.42412573 67.93269469 43.49278207
+7 4 1 21.77192348 67.87375812 46.12170043
+7 5 1 23.04802690 66.56579298 44.79084355
+7 6 1 25.76195489 66.57531522 47.49355836
+7 7 1 25.80328244 69.23660623 44.76956142
+7 8 1 23.06897271 69.27408889 47.52555006
+8 1 1 0.03577967 65.12360520 43.40878099
+8 2 1 2.70871039 65.18621239 46.15464484
+8 3 1 2.69310077 67.91893548 43.48328273
+8 4 1 0.01492016 67.85074534 46.18759077
+8 5 1 1.36850874 66.55323138 44.82931168
+8 6 1 4.07957853 66.51819400 47.55499142
+8 7 1 4.11579847 69.29038638 44.78610222
+8 8 1 1.32889619 69.21450943 47.53933732
+7 Eight_Node 8 4 4 4
+1 1 1 0.04642911 65.14589690 -0.00507236
+1 2 1 2.72001264 65.16364773 2.72036572
+1 3 1 2.70258998 67.89617801 0.04780698
+1 4 1 0.02641425 67.93378958 2.70762176
+1 5 1 1.32269866 66.49996314 1.33089559
+1 6 1 4.10023742 66.50206341 4.07937610
+1 7 1 4.11597521 69.23737719 1.33145938
+1 8 1 1.39649688 69.29315442 4.03005662
+2 1 1 21.75626067 65.21942769 -0.02035934
+2 2 1 24.42532290 65.14118007 2.68718559
+2 3 1 24.46645130 67.88166875 -0.01907140
+2 4 1 21.71045468 67.92824050 2.76517633
+2 5 1 23.06371044 66.50647965 1.33468368
+2 6 1 25.82564946 66.57062802 4.04253163
+2 7 1 25.75772455 69.22852364 1.39077131
+2 8 1 23.11648761 69.29025844 4.06525984
+3 1 1 21.67832856 86.85058389 0.03065095
+3 2 1 24.42697723 86.86303582 2.69368242
+3 3 1 24.39950947 89.65313000 -0.00698290
+3 4 1 21.72448630 89.58149419 2.71776758
+3 5 1 23.05711916 88.29765637 1.39427237
+3 6 1 25.81910784 88.26017369 4.09630160
+3 7 1 25.75572067 90.95543102 1.39586593
+3 8 1 23.11086408 90.95081581 4.06167537
+4 1 1 -0.03606394 86.84608170 0.04500681
+4 2 1 2.68394926 86.92610430 2.68334887
+4 3 1 2.71101307 89.61592194 -0.03151414
+4 4 1 -0.02188996 89.57542502 2.66588134
+4 5 1 1.34456563 88.28768797 1.32975938
+4 6 1 4.06652683 88.24310439 4.07475097
+4 7 1 4.04467303 90.92398766 1.34077522
+4 8 1 1.40568041 90.97727287 4.06845128
+5 1 1 -0.02055561 65.19367884 21.68882112
+5 2 1 2.72686496 65.17195611 24.39635613
+5 3 1 2.71559568 67.87135544 21.67504582
+5 4 1 -0.00504614 67.85789073 24.40018895
+5 5 1 1.37640290 66.53509845 23.07083011
+5 6 1 4.09369858 66.56742332 25.78380743
+5 7 1 4.07588362 69.28435231 23.05839068
+5 8 1 1.35290577 69.24388685 25.78330155
+6 1 1 21.73004728 65.20075050 21.76117871
+6 2 1 24.43076633 65.15033440 24.46627772
+6 3 1 24.45984077 67.86491148 21.71833569
+6 4 1 21.69872029 67.88986354 24.41035865
+6 5 1 23.03883463 66.50621400 23.04045942
+6 6 1 25.77721495 66.51258357 25.77831568
+6 7 1 25.84021207 69.27163649 23.05788690
+6 8 1 23.12225202 69.24347146 25.74876220
+7 1 1 21.72093947 86.85440456 21.70147301
+7 2 1 24.48559239 86.89916641 24.48799912
+7 3 1 24.43370341 89.59483471 21.69694051
+7 4 1 21.69874711 89.63864652 24.44858557
+7 5 1 23.11784229 88.25171119 23.11878512
+7 6 1 25.83730560 88.21115563 25.81407598
+7 7 1 25.75472763 90.95456554 23.04448704
+7 8 1 23.09500858 90.93166389 25.75604197
+8 1 1 0.02359105 86.91383104 21.75859739
+8 2 1 2.75638677 86.91728766 24.47237239
+8 3 1 2.69433493 89.60726340 21.72853068
+8 4 1 -0.01022793 89.60772562 24.43766097
+8 5 1 1.35949508 88.20761253 23.04658858
+8 6 1 4.10043052 88.29028131 25.76797343
+8 7 1 4.03446893 90.94263929 23.11963233
+8 8 1 1.35207764 91.01717704 25.79689354
+8 Eight_Node 8 4 4 4
+1 1 1 -0.03839022 65.19850920 21.68597260
+1 2 1 2.73512857 65.22161849 24.46395151
+1 3 1 2.74687629 67.88005767 21.68023286
+1 4 1 -0.02742725 67.92338834 24.46838018
+1 5 1 1.36517926 66.49993519 23.07952565
+1 6 1 4.10513205 66.49065057 25.83755826
+1 7 1 4.03107777 69.26739861 23.03357467
+1 8 1 1.39324227 69.22674118 25.80239421
+2 1 1 21.67838154 65.18868762 21.77373038
+2 2 1 24.41972142 65.20580361 24.40462816
+2 3 1 24.39316532 67.90422075 21.70107836
+2 4 1 21.74548499 67.84401388 24.40283214
+2 5 1 23.06335253 66.53162780 23.05575974
+2 6 1 25.75989191 66.49091813 25.78390353
+2 7 1 25.75347464 69.24941711 23.03468429
+2 8 1 23.08377675 69.22694094 25.75120002
+3 1 1 21.67621112 86.90420458 21.74518598
+3 2 1 24.40751477 86.90310312 24.39800534
+3 3 1 24.43607513 89.64315456 21.69290773
+3 4 1 21.72047267 89.65180971 24.41629252
+3 5 1 23.11000623 88.21151977 23.05915492
+3 6 1 25.82490763 88.29052603 25.77634118
+3 7 1 25.78836515 90.95240327 23.05098418
+3 8 1 23.06471287 91.00316433 25.80466142
+4 1 1 0.03437083 86.90307161 21.74172516
+4 2 1 2.72098317 86.86722431 24.43855525
+4 3 1 2.69994475 89.58439633 21.70559499
+4 4 1 0.04197683 89.65777878 24.48629665
+4 5 1 1.36221823 88.23129740 23.06826060
+4 6 1 4.05291615 88.29996564 25.83362111
+4 7 1 4.10199162 90.97126024 23.08026593
+4 8 1 1.38132660 91.00823046 25.81891414
+5 1 1 0.04473250 65.18231004 43.48191514
+5 2 1 2.72616312 65.17695196 46.19563000
+5 3 1 2.71015677 67.92187945 43.42377053
+5 4 1 0.04749628 67.91066591 46.13302963
+5 5 1 1.37617580 66.50863475 44.76544982
+5 6 1 4.03644581 66.52309220 47.56607903
+5 7 1 4.04700227 69.24955054 44.79972262
+5 8 1 1.32479324 69.26477225 47.50166247
+6 1 1 21.67853241 65.20696120 43.47420633
+6 2 1 24.39416968 65.16723578 46.14539985
+6 3 1 24.45513091 67.86886318 43.46793424
+6 4 1 21.67857613 67.92828457 46.17818185
+6 5 1 23.07158192 66.56156784 44.82979322
+6 6 1 25.77858443 66.48873661 47.53510991
+6 7 1 25.78969874 69.28199289 44.77074703
+6 8 1 23.11483179 69.27963034 47.49175243
+7 1 1 21.69956000 86.90739974 43.42645529
+7 2 1 24.43816670 86.89926758 46.15276909
+7 3 1 24.40187440 89.58990700 43.47910905
+7 4 1 21.75392089 89.57164179 46.18282047
+7 5 1 23.11969266 88.26480990 44.85183166
+7 6 1 25.80616838 88.25058804 47.51138732
+7 7 1 25.80563056 90.98535002 44.85499544
+7 8 1 23.04670981 90.95177809 47.56062458
+8 1 1 0.01862027 86.87680301 43.45427075
+8 2 1 2.67177490 86.86102775 46.11736128
+8 3 1 2.75006764 89.57511119 43.43524594
+8 4 1 -0.01706556 89.63116293 46.12081762
+8 5 1 1.30864952 88.22094686 44.81256523
+8 6 1 4.05862623 88.21136176 47.49984873
+8 7 1 4.04973642 90.99195720 44.82709917
+8 8 1 1.30975034 91.00275761 47.48192051
+9 Eight_Node 8 4 4 4
+1 1 1 21.71397111 -0.00762640 -0.04701897
+1 2 1 24.40028528 0.02418030 2.73431535
+1 3 1 24.46838483 2.76239133 0.03884639
+1 4 1 21.70407038 2.73120229 2.73144470
+1 5 1 23.05447989 1.38372820 1.39871001
+1 6 1 25.80635750 1.38589923 4.05134577
+1 7 1 25.83170854 4.05633466 1.33815399
+1 8 1 23.08816058 4.08439666 4.06984038
+2 1 1 43.48117972 0.02545427 0.00254568
+2 2 1 46.20186103 -0.00991527 2.70443955
+2 3 1 46.21153733 2.69691865 -0.03667213
+2 4 1 43.48348455 2.73442756 2.69759672
+2 5 1 44.83646617 1.37557593 1.35300729
+2 6 1 47.52423723 1.40274339 4.07728360
+2 7 1 47.48164220 4.06717093 1.33812931
+2 8 1 44.85164247 4.06698001 4.06325524
+3 1 1 43.47455763 21.75055975 -0.04202932
+3 2 1 46.18149634 21.76738436 2.72356407
+3 3 1 46.14121279 24.48274683 -0.04352414
+3 4 1 43.44697716 24.40928518 2.72097134
+3 5 1 44.79586995 23.11987251 1.31502986
+3 6 1 47.51775100 23.06058579 4.03416144
+3 7 1 47.55571658 25.81218269 1.34292318
+3 8 1 44.80896236 25.79199515 4.02923335
+4 1 1 21.70697297 21.67738712 -0.04008382
+4 2 1 24.47443147 21.75214140 2.69514096
+4 3 1 24.39126545 24.47764493 -0.04321971
+4 4 1 21.69839779 24.47436031 2.72292111
+4 5 1 23.07562306 23.10984777 1.39956791
+4 6 1 25.80498377 23.12390742 4.03013894
+4 7 1 25.79919811 25.81589517 1.39236820
+4 8 1 23.07932680 25.81014231 4.05212894
+5 1 1 21.74698754 0.00785056 21.77299718
+5 2 1 24.44232069 -0.03074893 24.46880687
+5 3 1 24.43460185 2.67859021 21.77023362
+5 4 1 21.72352582 2.68229088 24.40964389
+5 5 1 23.05717487 1.40044454 23.11301166
+5 6 1 25.75073937 1.37781922 25.78008546
+5 7 1 25.79100643 4.09754438 23.06105060
+5 8 1 23.06095456 4.11633477 25.82605303
+6 1 1 43.48111898 0.02430657 21.76997494
+6 2 1 46.18897016 0.02458166 24.41861210
+6 3 1 46.18396754 2.75920389 21.73108338
+6 4 1 43.46980132 2.68302042 24.43602287
+6 5 1 44.80869092 1.38075157 23.08365600
+6 6 1 47.49490905 1.40633802 25.79560323
+6 7 1 47.48308363 4.10736008 23.06832468
+6 8 1 44.85085995 4.02629939 25.82343001
+7 1 1 43.46596132 21.74553436 21.67766986
+7 2 1 46.16393122 21.72442954 24.41942967
+7 3 1 46.12236256 24.45083077 21.71059757
+7 4 1 43.49654303 24.41291088 24.42857278
+7 5 1 44.82159322 23.04517614 23.04676248
+7 6 1 47.48011194 23.11653332 25.82583998
+7 7 1 47.48309838 25.77533825 23.09802959
+7 8 1 44.76154567 25.75331393 25.76613595
+8 1 1 21.75166297 21.69883499 21.74871394
+8 2 1 24.40584317 21.73741408 24.45693729
+8 3 1 24.45341808 24.40692650 21.72054778
+8 4 1 21.69926053 24.42181616 24.42271706
+8 5 1 23.12267947 23.05035835 23.07130920
+8 6 1 25.82544001 23.03970926 25.82502380
+8 7 1 25.83774628 25.80922863 23.12427203
+8 8 1 23.07723847 25.82510971 25.84686370
+10 Eight_Node 8 4 4 4
+1 1 1 21.72351489 -0.00468147 21.76926417
+1 2 1 24.45907718 0.00044257 24.42909342
+1 3 1 24.46121587 2.76273574 21.72436693
+1 4 1 21.72038906 2.71624198 24.39359398
+1 5 1 23.11413012 1.38015247 23.09449811
+1 6 1 25.81699183 1.38860743 25.79059574
+1 7 1 25.80443973 4.04732917 23.08744731
+1 8 1 23.09682026 4.07952647 25.76679763
+2 1 1 43.42582191 -0.04602835 21.71605083
+2 2 1 46.17131594 -0.01463918 24.45643169
+2 3 1 46.15190394 2.71251418 21.69417165
+2 4 1 43.45123998 2.68716762 24.41158605
+2 5 1 44.79864369 1.37144877 23.08321486
+2 6 1 47.49402884 1.36479874 25.81749960
+2 7 1 47.49251387 4.03533161 23.11852146
+2 8 1 44.78997377 4.07937519 25.79609252
+3 1 1 43.44916851 21.70542746 21.68912620
+3 2 1 46.18333627 21.74189908 24.48313281
+3 3 1 46.16326621 24.47453243 21.72431174
+3 4 1 43.49677899 24.40620041 24.41951083
+3 5 1 44.83273746 23.07394300 23.08807747
+3 6 1 47.55988771 23.05310934 25.75382053
+3 7 1 47.47299719 25.80910942 23.12630855
+3 8 1 44.77970105 25.79779082 25.79002815
+4 1 1 21.72334127 21.75632303 21.76257962
+4 2 1 24.44794294 21.72127579 24.48021942
+4 3 1 24.43385363 24.41982632 21.72182448
+4 4 1 21.74013612 24.41296181 24.46401309
+4 5 1 23.06912021 23.03775276 23.10154437
+4 6 1 25.83575335 23.12267611 25.84544423
+4 7 1 25.75201433 25.84461751 23.12181531
+4 8 1 23.12081236 25.74804293 25.81435360
+5 1 1 21.69375191 0.04009495 43.42555194
+5 2 1 24.39521353 0.00872868 46.18274510
+5 3 1 24.44281178 2.70666128 43.40480038
+5 4 1 21.74633321 2.66633032 46.17141118
+5 5 1 23.04150970 1.35329094 44.81395784
+5 6 1 25.77187562 1.38319447 47.49685557
+5 7 1 25.83385510 4.06252839 44.82444491
+5 8 1 23.07687258 4.05523557 47.48053746
+6 1 1 43.45916763 -0.04484355 43.44485310
+6 2 1 46.15412802 -0.02078529 46.13864744
+6 3 1 46.16220965 2.75361582 43.47740984
+6 4 1 43.42872059 2.72497663 46.17655512
+6 5 1 44.82797910 1.37026427 44.76206530
+6 6 1 47.48558791 1.38660889 47.49748231
+6 7 1 47.52809104 4.02857803 44.81386571
+6 8 1 44.78454253 4.02743891 47.47274391
+7 1 1 43.42186154 21.72559602 43.47322680
+7 2 1 46.11656507 21.72473575 46.14701487
+7 3 1 46.17421932 24.45965242 43.40641823
+7 4 1 43.42274310 24.47639398 46.17986938
+7 5 1 44.77243917 23.08555609 44.79211617
+7 6 1 47.48669007 23.07238213 47.52429242
+7 7 1 47.53695628 25.83555215 44.78313806
+7 8 1 44.85458176 25.78402454 47.53600641
+8 1 1 21.71353667 21.71889583 43.46671660
+8 2 1 24.46367670 21.68082873 46.11576348
+8 3 1 24.42422225 24.42124196 43.44259207
+8 4 1 21.76850636 24.41959377 46.13623019
+8 5 1 23.07485628 23.06503807 44.79692329
+8 6 1 25.79982017 23.04307263 47.54688855
+8 7 1 25.81056407 25.82260272 44.79980155
+8 8 1 23.04931227 25.82149516 47.55848724
+11 Eight_Node 8 4 4 4
+1 1 1 21.76319342 21.74621050 -0.03745267
+1 2 1 24.41880784 21.74303419 2.66951176
+1 3 1 24.41780846 24.42817842 0.02963985
+1 4 1 21.67671146 24.41688114 2.72920459
+1 5 1 23.03222147 23.06262304 1.38134576
+1 6 1 25.79375899 23.10599418 4.04779877
+1 7 1 25.81859020 25.76292925 1.37068112
+1 8 1 23.11072023 25.75350617 4.05134106
+2 1 1 43.43111013 21.76239427 -0.04310408
+2 2 1 46.15462803 21.77352699 2.67469997
+2 3 1 46.20902476 24.39679037 0.00433719
+2 4 1 43.44293120 24.45783988 2.69407169
+2 5 1 44.80291175 23.11843160 1.32401427
+2 6 1 47.56076776 23.04126881 4.04068967
+2 7 1 47.49365308 25.80105459 1.33877367
+2 8 1 44.80278286 25.75320831 4.05340355
+3 1 1 43.39850906 43.41019631 0.01583122
+3 2 1 46.16922556 43.44422113 2.66804026
+3 3 1 46.18935038 46.12330312 0.01989737
+3 4 1 43.43868376 46.20073525 2.67523927
+3 5 1 44.79088241 44.75993658 1.40148782
+3 6 1 47.53279109 44.78962244 4.03937085
+3 7 1 47.56034997 47.50679286 1.32033194
+3 8 1 44.80261864 47.50759076 4.10511301
+4 1 1 21.68003256 43.47464961 0.03888759
+4 2 1 24.39553890 43.46596394 2.73809751
+4 3 1 24.46528580 46.20032865 -0.00326822
+4 4 1 21.73869544 46.17220375 2.70962101
+4 5 1 23.04512471 44.81003034 1.36043264
+4 6 1 25.78181189 44.82868534 4.11195564
+4 7 1 25.79816001 47.50911272 1.35867782
+4 8 1 23.10550146 47.50141824 4.10576471
+5 1 1 21.74007570 21.74427299 21.73354034
+5 2 1 24.39623870 21.73867346 24.47616864
+5 3 1 24.45633713 24.47370393 21.68853980
+5 4 1 21.71948854 24.46126977 24.48418596
+5 5 1 23.04007615 23.05223212 23.05564584
+5 6 1 25.77266661 23.09654984 25.78828782
+5 7 1 25.83958524 25.81476250 23.10131140
+5 8 1 23.12237201 25.83333512 25.75007544
+6 1 1 43.44035945 21.73898704 21.74636793
+6 2 1 46.20388911 21.69447976 24.43905896
+6 3 1 46.20346445 24.40810394 21.67827624
+6 4 1 43.44043617 24.40695997 24.39288214
+6 5 1 44.79515568 23.09528442 23.09619025
+6 6 1 47.55689382 23.05991514 25.77489757
+6 7 1 47.56158405 25.75277635 23.09130598
+6 8 1 44.76940390 25.82311139 25.75889003
+7 1 1 43.48163302 43.42714173 21.76712914
+7 2 1 46.17664942 43.47502564 24.40979600
+7 3 1 46.18068237 46.17916142 21.71402349
+7 4 1 43.45348774 46.16716845 24.47366282
+7 5 1 44.85554684 44.83773122 23.08159118
+7 6 1 47.48134340 44.81897896 25.84452897
+7 7 1 47.49272972 47.48473016 23.05076215
+7 8 1 44.76469687 47.52247114 25.76739915
+8 1 1 21.76257932 43.48712132 21.76111715
+8 2 1 24.44274716 43.44284701 24.45615673
+8 3 1 24.43007139 46.16988767 21.68024350
+8 4 1 21.72893539 46.16953987 24.41121359
+8 5 1 23.04976810 44.79948588 23.12176811
+8 6 1 25.84655212 44.82664308 25.78010657
+8 7 1 25.78015457 47.56384728 23.05841769
+8 8 1 23.09154204 47.54344888 25.77542289
+12 Eight_Node 8 4 4 4
+1 1 1 21.76667144 21.69902243 21.77318959
+1 2 1 24.46009760 21.72675953 24.44722766
+1 3 1 24.47872095 24.47525291 21.67830143
+1 4 1 21.70582293 24.39040688 24.43171845
+1 5 1 23.10231248 23.07067816 23.08803519
+1 6 1 25.76359772 23.05229400 25.78044667
+1 7 1 25.77276530 25.81851842 23.10976812
+1 8 1 23.06262992 25.83101600 25.78232781
+2 1 1 43.48123339 21.74415728 21.72402932
+2 2 1 46.19035314 21.75288306 24.41154581
+2 3 1 46.20333900 24.42369556 21.68024270
+2 4 1 43.49717696 24.48871675 24.45582802
+2 5 1 44.76010558 23.03295981 23.10989298
+2 6 1 47.54038556 23.11592790 25.84321421
+2 7 1 47.53397764 25.82851644 23.06833687
+2 8 1 44.79638865 25.80893811 25.77804595
+3 1 1 43.46344905 43.48627067 21.71876421
+3 2 1 46.20250763 43.47435858 24.41558580
+3 3 1 46.12029163 46.14509863 21.73357838
+3 4 1 43.45613113 46.12971536 24.45802520
+3 5 1 44.78759835 44.79411165 23.04303163
+3 6 1 47.54224556 44.78068353 25.76753712
+3 7 1 47.56080560 47.50461323 23.11250590
+3 8 1 44.76156027 47.52165025 25.81181863
+4 1 1 21.74445040 43.44442786 21.69124340
+4 2 1 24.44385638 43.48633332 24.41895517
+4 3 1 24.43016330 46.17988591 21.70915841
+4 4 1 21.73894970 46.15524394 24.40589918
+4 5 1 23.07956073 44.76192889 23.03975148
+4 6 1 25.79026661 44.78988403 25.82751495
+4 7 1 25.75259098 47.50589750 23.09199507
+4 8 1 23.08875877 47.53324455 25.80492696
+5 1 1 21.77045237 21.69639049 43.44860694
+5 2 1 24.39703462 21.75040022 46.16834757
+5 3 1 24.48607428 24.40104358 43.45179909
+5 4 1 21.70081481 24.43149323 46.20628847
+5 5 1 23.05472860 23.04500584 44.79611766
+5 6 1 25.77436341 23.10875415 47.54254314
+5 7 1 25.77358356 25.83114645 44.77924390
+5 8 1 23.03808616 25.76429397 47.52894504
+6 1 1 43.47530452 21.74572842 43.41404848
+6 2 1 46.15277878 21.75591485 46.17690819
+6 3 1 46.19025664 24.40475242 43.47821474
+6 4 1 43.41511515 24.39256798 46.16147596
+6 5 1 44.82036690 23.09513645 44.80436235
+6 6 1 47.48948823 23.08845369 47.51864981
+6 7 1 47.47134400 25.77355246 44.79415331
+6 8 1 44.82898665 25.84456010 47.56903023
+7 1 1 43.45478998 43.43329261 43.48374800
+7 2 1 46.19348143 43.49402099 46.13901240
+7 3 1 46.21327350 46.17275161 43.46246921
+7 4 1 43.42142538 46.20573066 46.12796406
+7 5 1 44.82476496 44.84837793 44.83602235
+7 6 1 47.49258520 44.85374626 47.55537380
+7 7 1 47.57080843 47.55131561 44.85066498
+7 8 1 44.77757047 47.49248301 47.49515764
+8 1 1 21.72156008 43.41595751 43.48835507
+8 2 1 24.47287571 43.43218495 46.13912424
+8 3 1 24.40308378 46.13417520 43.42530872
+8 4 1 21.70540410 46.18386533 46.11951319
+8 5 1 23.08761045 44.83668073 44.77988049
+8 6 1 25.81048193 44.78211999 47.56071706
+8 7 1 25.79730920 47.50792625 44.84801522
+8 8 1 23.08310264 47.50955646 47.48995488
+13 Eight_Node 8 4 4 4
+1 1 1 21.68493359 43.42930059 -0.04759715
+1 2 1 24.47618137 43.48774086 2.74957562
+1 3 1 24.43772526 46.14883665 -0.02122970
+1 4 1 21.68771468 46.14228616 2.69647020
+1 5 1 23.08208360 44.77475869 1.36020201
+1 6 1 25.79704986 44.76980814 4.08108970
+1 7 1 25.83782019 47.54673506 1.36192131
+1 8 1 23.05645085 47.54288142 4.04712889
+2 1 1 43.48283039 43.42574932 -0.03062597
+2 2 1 46.19133233 43.41906710 2.69343594
+2 3 1 46.18318215 46.15181380 -0.01057762
+2 4 1 43.48950084 46.20026661 2.76469283
+2 5 1 44.81161711 44.79354639 1.36673355
+2 6 1 47.51213874 44.85234167 4.04961040
+2 7 1 47.55390353 47.54995272 1.33564683
+2 8 1 44.83376045 47.54051356 4.10294417
+3 1 1 43.44964663 65.13625892 -0.00174347
+3 2 1 46.20899535 65.21270644 2.69744200
+3 3 1 46.17836127 67.84038052 0.02204625
+3 4 1 43.45625118 67.87636567 2.69263217
+3 5 1 44.76405919 66.50362003 1.35060905
+3 6 1 47.51371411 66.49518082 4.09272904
+3 7 1 47.47226946 69.21311502 1.33615569
+3 8 1 44.77340837 69.27651532 4.11840244
+4 1 1 21.72102825 65.15551172 0.03431431
+4 2 1 24.46522869 65.18703261 2.75782661
+4 3 1 24.39689886 67.89669739 -0.02321099
+4 4 1 21.77070094 67.84397578 2.75396454
+4 5 1 23.12333934 66.48548613 1.39622788
+4 6 1 25.79783563 66.56972432 4.07007501
+4 7 1 25.84518645 69.22682250 1.32702153
+4 8 1 23.09501650 69.29279600 4.04879369
+5 1 1 21.74265823 43.42452066 21.71119656
+5 2 1 24.45093537 43.47498163 24.43901275
+5 3 1 24.48254640 46.17893039 21.67753391
+5 4 1 21.73547946 46.11700441 24.41363386
+5 5 1 23.08524227 44.79663305 23.10035179
+5 6 1 25.78803720 44.83672999 25.80255085
+5 7 1 25.80654021 47.53271197 23.08198280
+5 8 1 23.08502020 47.47186113 25.76215326
+6 1 1 43.42924182 43.42083084 21.69321320
+6 2 1 46.18273680 43.44223624 24.40565323
+6 3 1 46.17900044 46.13113771 21.70396452
+6 4 1 43.41805459 46.18128152 24.43990456
+6 5 1 44.75707853 44.82634151 23.04969066
+6 6 1 47.49738149 44.76604725 25.80686941
+6 7 1 47.52690668 47.49637608 23.13128475
+6 8 1 44.79562698 47.48459897 25.82733363
+7 1 1 43.44925174 65.16852790 21.73457418
+7 2 1 46.16086268 65.16528396 24.39387044
+7 3 1 46.19328682 67.89254411 21.74535395
+7 4 1 43.40387260 67.88477451 24.42374108
+7 5 1 44.80833943 66.54923963 23.05737796
+7 6 1 47.54471063 66.54931348 25.75436163
+7 7 1 47.55710996 69.25777728 23.05865390
+7 8 1 44.84504029 69.19966925 25.80468782
+8 1 1 21.75929735 65.19447509 21.76530869
+8 2 1 24.43806632 65.21340582 24.39412420
+8 3 1 24.47207531 67.85669517 21.73871370
+8 4 1 21.77315980 67.88737489 24.47408201
+8 5 1 23.09993389 66.56429239 23.03215093
+8 6 1 25.79589318 66.54479403 25.81977705
+8 7 1 25.84111341 69.21335851 23.08415079
+8 8 1 23.09394299 69.23515475 25.83905377
+14 Eight_Node 8 4 4 4
+1 1 1 21.72441712 43.40538411 21.73813868
+1 2 1 24.46400538 43.46791663 24.43841431
+1 3 1 24.43626309 46.19891923 21.74422635
+1 4 1 21.74450292 46.19536233 24.39983968
+1 5 1 23.10173452 44.84128453 23.10507291
+1 6 1 25.84166899 44.79528549 25.82282665
+1 7 1 25.82376135 47.54595384 23.08315766
+1 8 1 23.07994194 47.56341817 25.76915317
+2 1 1 43.42974260 43.41488596 21.75845191
+2 2 1 46.19706931 43.43367748 24.42950290
+2 3 1 46.19232657 46.17749195 21.71711206
+2 4 1 43.49310862 46.16654300 24.39889362
+2 5 1 44.79250466 44.79106864 23.04686759
+2 6 1 47.53384553 44.81104154 25.81759476
+2 7 1 47.56200412 47.49245790 23.05950184
+2 8 1 44.81955829 47.54504107 25.81621953
+3 1 1 43.40343080 65.20087250 21.69825591
+3 2 1 46.12078337 65.21877201 24.40093597
+3 3 1 46.20817996 67.85878479 21.69461814
+3 4 1 43.48939436 67.91039420 24.48534165
+3 5 1 44.75969124 66.54799183 23.07517438
+3 6 1 47.49892544 66.52243693 25.82744464
+3 7 1 47.51789535 69.28836836 23.12547691
+3 8 1 44.81624623 69.20732635 25.76043309
+4 1 1 21.72787620 65.20479370 21.77398867
+4 2 1 24.46127315 65.12209515 24.48016203
+4 3 1 24.44869296 67.85026200 21.74411743
+4 4 1 21.76781260 67.86487517 24.44689455
+4 5 1 23.09460279 66.54022815 23.06546531
+4 6 1 25.80217601 66.57186120 25.80239282
+4 7 1 25.76410421 69.25238327 23.10623763
+4 8 1 23.03949727 69.28148608 25.79480349
+5 1 1 21.69545161 43.42028332 43.40602848
+5 2 1 24.47448155 43.47992616 46.15492815
+5 3 1 24.48811921 46.13577761 43.39833215
+5 4 1 21.75697173 46.18955848 46.13167924
+5 5 1 23.06368674 44.76376478 44.81142007
+5 6 1 25.80044119 44.81896726 47.55550138
+5 7 1 25.83195854 47.50558320 44.79771195
+5 8 1 23.04697173 47.52964217 47.51002145
+6 1 1 43.46757484 43.42838693 43.43404022
+6 2 1 46.17854158 43.41301427 46.13716557
+6 3 1 46.16928329 46.17998134 43.41018301
+6 4 1 43.43904894 46.15880951 46.15409968
+6 5 1 44.76259751 44.82434721 44.82556864
+6 6 1 47.49590542 44.80935497 47.55401621
+6 7 1 47.54538953 47.47221076 44.78754003
+6 8 1 44.77790265 47.55812062 47.54115873
+7 1 1 43.47298160 65.12333056 43.47251995
+7 2 1 46.12768251 65.14043957 46.15992758
+7 3 1 46.17428199 67.86290515 43.48420321
+7 4 1 43.47104076 67.93406339 46.12792266
+7 5 1 44.80286975 66.51642049 44.79539827
+7 6 1 47.48123757 66.57021055 47.48370630
+7 7 1 47.47640772 69.19695740 44.83489280
+7 8 1 44.84266738 69.22759315 47.49028934
+8 1 1 21.70203815 65.16515240 43.45934705
+8 2 1 24.41610715 65.19601828 46.18700078
+8 3 1 24.48241051 67.93144007 43.47250299
+8 4 1 21.76813794 67.91546727 46.15217498
+8 5 1 23.03420085 66.50131862 44.85023785
+8 6 1 25.81338485 66.56155707 47.47694564
+8 7 1 25.82583204 69.22327781 44.78524011
+8 8 1 23.07537027 69.27862291 47.54207361
+15 Eight_Node 8 4 4 4
+1 1 1 21.77282451 65.12259527 -0.00631881
+1 2 1 24.45138085 65.16678292 2.70442590
+1 3 1 24.47925724 67.88839552 -0.03478437
+1 4 1 21.71277166 67.87716010 2.69407920
+1 5 1 23.04172677 66.56349514 1.37764347
+1 6 1 25.84451732 66.54869117 4.07312610
+1 7 1 25.83936398 69.25668986 1.39628200
+1 8 1 23.12060101 69.24367376 4.04445224
+2 1 1 43.43241185 65.21029223 -0.00818468
+2 2 1 46.15294415 65.14410789 2.74264598
+2 3 1 46.11366297 67.92420776 -0.03385588
+2 4 1 43.41938933 67.86504047 2.70817409
+2 5 1 44.81398191 66.55468008 1.35595145
+2 6 1 47.53871192 66.48373752 4.08483386
+2 7 1 47.52966322 69.20273334 1.40463341
+2 8 1 44.81549368 69.24327277 4.04422801
+3 1 1 43.45001989 86.93092057 0.01970039
+3 2 1 46.12211999 86.87738179 2.75758494
+3 3 1 46.12428926 89.62422341 0.03684568
+3 4 1 43.46615128 89.62487558 2.66927235
+3 5 1 44.78417531 88.22746186 1.33375171
+3 6 1 47.53751287 88.23594449 4.02494455
+3 7 1 47.47652328 90.96045538 1.35091951
+3 8 1 44.81144683 90.95084150 4.10326532
+4 1 1 21.76695007 86.93578234 0.04413081
+4 2 1 24.42727773 86.89077874 2.75302502
+4 3 1 24.40627599 89.65140758 0.03160374
+4 4 1 21.70470244 89.56181792 2.71836792
+4 5 1 23.05141621 88.22249116 1.34607943
+4 6 1 25.78786934 88.27819344 4.09282006
+4 7 1 25.82773659 90.99705006 1.34778019
+4 8 1 23.06665292 90.95727748 4.07567984
+5 1 1 21.72229348 65.17883676 21.76562838
+5 2 1 24.42525760 65.17811172 24.40864653
+5 3 1 24.44647570 67.89571115 21.74160749
+5 4 1 21.71902595 67.85127073 24.42457489
+5 5 1 23.05924551 66.49847569 23.12431810
+5 6 1 25.81747498 66.57393155 25.84153160
+5 7 1 25.77450952 69.22561771 23.08135688
+5 8 1 23.07249104 69.23720647 25.75567485
+6 1 1 43.49035163 65.20796072 21.73231708
+6 2 1 46.15135566 65.18172981 24.44343963
+6 3 1 46.15137473 67.91033195 21.69960952
+6 4 1 43.43445759 67.92035996 24.46117874
+6 5 1 44.77576771 66.51314867 23.08370713
+6 6 1 47.48718060 66.55372561 25.80931020
+6 7 1 47.50769278 69.22828550 23.05043843
+6 8 1 44.77513229 69.25245448 25.80160700
+7 1 1 43.48210659 86.92603853 21.74700034
+7 2 1 46.17144253 86.86956636 24.43361907
+7 3 1 46.20300648 89.63977521 21.74852928
+7 4 1 43.48644954 89.64519103 24.41495191
+7 5 1 44.84651352 88.30099806 23.09084722
+7 6 1 47.52907959 88.28704075 25.82778290
+7 7 1 47.56115540 90.96605698 23.11878956
+7 8 1 44.79981537 90.96370341 25.79669691
+8 1 1 21.73373037 86.84879045 21.69691301
+8 2 1 24.47424955 86.84937425 24.47830784
+8 3 1 24.48215960 89.60819993 21.76276787
+8 4 1 21.76435791 89.59989174 24.46706449
+8 5 1 23.05247879 88.24331588 23.04909238
+8 6 1 25.77800152 88.30139834 25.81098549
+8 7 1 25.77983319 90.92881413 23.11721048
+8 8 1 23.12500579 91.01809321 25.75220081
+16 Eight_Node 8 4 4 4
+1 1 1 21.75321280 65.15248680 21.69358620
+1 2 1 24.43870559 65.15261636 24.48249316
+1 3 1 24.40466672 67.87397898 21.69064358
+1 4 1 21.74577087 67.88680393 24.43820181
+1 5 1 23.12168769 66.53875949 23.08292378
+1 6 1 25.83339563 66.53853779 25.83722566
+1 7 1 25.81172775 69.26772207 23.08460446
+1 8 1 23.04311403 69.25367651 25.83498719
+2 1 1 43.47339439 65.21773496 21.69957834
+2 2 1 46.19956085 65.13863773 24.39082243
+2 3 1 46.11732842 67.85820496 21.69646414
+2 4 1 43.47639154 67.88844158 24.47689713
+2 5 1 44.79195946 66.49473213 23.06053793
+2 6 1 47.49045296 66.55658311 25.84111017
+2 7 1 47.52583089 69.25050268 23.08811877
+2 8 1 44.82552223 69.27842721 25.82976497
+3 1 1 43.44258286 86.89619849 21.72051002
+3 2 1 46.12983650 86.85340393 24.47172768
+3 3 1 46.15763305 89.57877730 21.67804555
+3 4 1 43.40039705 89.60450339 24.44665169
+3 5 1 44.84745619 88.27962286 23.07208847
+3 6 1 47.52983659 88.20578572 25.76338693
+3 7 1 47.51515681 90.97828776 23.09958010
+3 8 1 44.84774692 90.95524200 25.78665353
+4 1 1 21.68808339 86.87402913 21.69301586
+4 2 1 24.47190217 86.90827311 24.46831940
+4 3 1 24.39598241 89.60918870 21.73933003
+4 4 1 21.69611217 89.61491197 24.39354653
+4 5 1 23.09645660 88.26393148 23.09621871
+4 6 1 25.75134091 88.25832899 25.78355516
+4 7 1 25.77031282 91.01801885 23.08410056
+4 8 1 23.10245677 90.96863350 25.83635629
+5 1 1 21.69047097 65.17053159 43.46813005
+5 2 1 24.40676023 65.13639590 46.16238943
+5 3 1 24.44318707 67.92478099 43.46227611
+5 4 1 21.69751536 67.87037115 46.19682394
+5 5 1 23.04805391 66.51098160 44.78783855
+5 6 1 25.80736916 66.55134626 47.48669092
+5 7 1 25.79071303 69.28132775 44.82147408
+5 8 1 23.11785265 69.28048458 47.52383841
+6 1 1 43.42551310 65.15371885 43.45077988
+6 2 1 46.20397504 65.14993893 46.19213665
+6 3 1 46.13928982 67.86128904 43.40343519
+6 4 1 43.43730437 67.91839557 46.15514992
+6 5 1 44.81790038 66.48851973 44.78708809
+6 6 1 47.52351562 66.48110475 47.49920185
+6 7 1 47.55281023 69.20537563 44.83441290
+6 8 1 44.81935523 69.21826928 47.48909260
+7 1 1 43.46492739 86.90266389 43.43250206
+7 2 1 46.19416770 86.90053574 46.20642114
+7 3 1 46.14788429 89.60589908 43.48125183
+7 4 1 43.42881959 89.63792811 46.19161914
+7 5 1 44.82140809 88.26395868 44.84268804
+7 6 1 47.48864108 88.29960729 47.55798768
+7 7 1 47.50605061 90.91951212 44.85574580
+7 8 1 44.84514053 90.98321486 47.56866381
+8 1 1 21.68962840 86.87658170 43.43750434
+8 2 1 24.40608246 86.86369824 46.19957769
+8 3 1 24.44063380 89.60231171 43.43889678
+8 4 1 21.74407257 89.63173994 46.15347477
+8 5 1 23.04207719 88.23613344 44.78584742
+8 6 1 25.76515346 88.26238226 47.56682799
+8 7 1 25.80514814 90.92446355 44.76969402
+8 8 1 23.12524379 91.01698855 47.50905206
+17 Eight_Node 8 4 4 4
+1 1 1 43.44340209 -0.02322517 0.01802068
+1 2 1 46.20425974 0.00857358 2.73621263
+1 3 1 46.11462233 2.75159254 0.00520929
+1 4 1 43.40210244 2.69900727 2.73929111
+1 5 1 44.77630206 1.38812913 1.36909860
+1 6 1 47.53561035 1.39690245 4.11425903
+1 7 1 47.50282193 4.03700755 1.37729904
+1 8 1 44.83054793 4.05068229 4.06403226
+2 1 1 65.20713148 -0.03331364 -0.04017093
+2 2 1 67.93147423 -0.04890941 2.68661600
+2 3 1 67.83958947 2.71072501 0.01952633
+2 4 1 65.14411533 2.67826918 2.71575675
+2 5 1 66.50112069 1.36475463 1.35058214
+2 6 1 69.22172041 1.38940348 4.04973459
+2 7 1 69.25115478 4.02718149 1.39486110
+2 8 1 66.49816087 4.08929788 4.12253363
+3 1 1 65.14412181 21.74343093 -0.04291840
+3 2 1 67.92966550 21.74010559 2.73635383
+3 3 1 67.84166738 24.42786475 0.00953762
+3 4 1 65.14756840 24.46497177 2.72218627
+3 5 1 66.50093391 23.11835747 1.37229932
+3 6 1 69.22015237 23.06666108 4.09006613
+3 7 1 69.25924988 25.79047509 1.37434885
+3 8 1 66.48585415 25.77015946 4.03284894
+4 1 1 43.46669360 21.74609934 0.02060782
+4 2 1 46.17641753 21.70762289 2.71613863
+4 3 1 46.15613446 24.40389899 0.03110340
+4 4 1 43.41139021 24.41764052 2.73985038
+4 5 1 44.84212020 23.04145929 1.38454334
+4 6 1 47.49533338 23.12312639 4.03313980
+4 7 1 47.57032664 25.77509844 1.33328547
+4 8 1 44.83873721 25.78078909 4.03947267
+5 1 1 43.42834596 0.04342931 21.72923266
+5 2 1 46.16220608 0.00620766 24.40044984
+5 3 1 46.17007074 2.73669480 21.67424440
+5 4 1 43.41663104 2.75830041 24.43880768
+5 5 1 44.78214736 1.36888491 23.07118213
+5 6 1 47.47636855 1.40315800 25.78190557
+5 7 1 47.51776927 4.05932047 23.11265157
+5 8 1 44.79187274 4.05677821 25.79239000
+6 1 1 65.21939521 0.04008064 21.67939188
+6 2 1 67.93055021 0.00977496 24.40393905
+6 3 1 67.87030446 2.73288617 21.76750809
+6 4 1 65.20012724 2.69977294 24.43801489
+6 5 1 66.55685335 1.36684206 23.08527862
+6 6 1 69.20115725 1.32466348 25.76056984
+6 7 1 69.21764792 4.09281813 23.08657626
+6 8 1 66.52763247 4.07883627 25.76362930
+7 1 1 65.13872303 21.73566198 21.77123027
+7 2 1 67.85630673 21.72723637 24.40981539
+7 3 1 67.84356033 24.48746567 21.75192651
+7 4 1 65.20280351 24.45486439 24.39648532
+7 5 1 66.51540395 23.13030368 23.07955403
+7 6 1 69.26633534 23.12767470 25.81855824
+7 7 1 69.21338061 25.83845656 23.10565455
+7 8 1 66.50370887 25.75142085 25.77957124
+8 1 1 43.44059805 21.69891479 21.71202463
+8 2 1 46.15931981 21.69543252 24.47848522
+8 3 1 46.17763272 24.48480456 21.73590485
+8 4 1 43.41686930 24.39624784 24.41868939
+8 5 1 44.81079917 23.11867623 23.11344727
+8 6 1 47.56342792 23.10795150 25.79867162
+8 7 1 47.50713501 25.76257438 23.03267851
+8 8 1 44.83364588 25.80852199 25.77390008
+18 Eight_Node 8 4 4 4
+1 1 1 43.41002752 -0.04779848 21.71996147
+1 2 1 46.13782762 0.03558176 24.39633930
+1 3 1 46.16226082 2.71178919 21.74063791
+1 4 1 43.41799750 2.72440781 24.41423394
+1 5 1 44.79572352 1.33022152 23.11408453
+1 6 1 47.52271947 1.30936348 25.79537989
+1 7 1 47.55611177 4.03383122 23.11595039
+1 8 1 44.82269862 4.09799381 25.82105886
+2 1 1 65.12512615 -0.00887879 21.75746301
+2 2 1 67.90744095 0.02562439 24.45126058
+2 3 1 67.87556207 2.74891782 21.68752303
+2 4 1 65.20729676 2.74850021 24.43779934
+2 5 1 66.53901326 1.37935069 23.03374697
+2 6 1 69.21117618 1.38811701 25.77598213
+2 7 1 69.23604153 4.10026083 23.10024107
+2 8 1 66.48539435 4.06296862 25.76994753
+3 1 1 65.16670579 21.71316542 21.71046946
+3 2 1 67.91549230 21.72157544 24.45260693
+3 3 1 67.85814823 24.42028450 21.72070509
+3 4 1 65.18225219 24.43213758 24.46740567
+3 5 1 66.51621166 23.05545847 23.06205474
+3 6 1 69.24276496 23.11671911 25.82146128
+3 7 1 69.21704247 25.84355968 23.12064195
+3 8 1 66.54377396 25.79885411 25.83427359
+4 1 1 43.46543370 21.73497727 21.67835634
+4 2 1 46.16588894 21.75845527 24.43157999
+4 3 1 46.20765263 24.42685170 21.71637641
+4 4 1 43.47806380 24.43295096 24.40920810
+4 5 1 44.81783768 23.04090549 23.04245032
+4 6 1 47.53348257 23.08521666 25.75912759
+4 7 1 47.51248381 25.74888054 23.11725433
+4 8 1 44.84075439 25.75546466 25.78280555
+5 1 1 43.42265291 0.01510716 43.44924579
+5 2 1 46.16925399 0.03618151 46.17086856
+5 3 1 46.17073132 2.73843035 43.42133385
+5 4 1 43.47224809 2.75834935 46.17496608
+5 5 1 44.84696929 1.33945570 44.78736027
+5 6 1 47.52812350 1.31355486 47.52353073
+5 7 1 47.48153876 4.08236341 44.85048806
+5 8 1 44.75763195 4.05696433 47.47295114
+6 1 1 65.15644321 -0.01594678 43.39850709
+6 2 1 67.85192573 0.01212586 46.16198473
+6 3 1 67.90621569 2.70116760 43.46927632
+6 4 1 65.18604919 2.74274564 46.14345810
+6 5 1 66.52880501 1.31504332 44.78762270
+6 6 1 69.24550337 1.39047808 47.56398467
+6 7 1 69.26907414 4.05144046 44.79599145
+6 8 1 66.55493808 4.11270387 47.56474266
+7 1 1 65.15917836 21.70726660 43.47249919
+7 2 1 67.88762864 21.75798288 46.15722327
+7 3 1 67.85251192 24.42845003 43.45285627
+7 4 1 65.19345432 24.42716877 46.21064725
+7 5 1 66.49427047 23.07120667 44.77594647
+7 6 1 69.21164484 23.11776552 47.56272488
+7 7 1 69.29060916 25.80303689 44.76003392
+7 8 1 66.48360003 25.77126029 47.56655654
+8 1 1 43.43117218 21.76866737 43.43597123
+8 2 1 46.11771694 21.75242721 46.18631639
+8 3 1 46.17177474 24.44455744 43.46803937
+8 4 1 43.41534807 24.42383166 46.15286673
+8 5 1 44.76813733 23.09428462 44.81092940
+8 6 1 47.48649191 23.11845386 47.47958266
+8 7 1 47.50889592 25.76709747 44.83206601
+8 8 1 44.77421115 25.75389135 47.55291866
+19 Eight_Node 8 4 4 4
+1 1 1 43.43457727 21.74874377 0.02137432
+1 2 1 46.20050557 21.70872040 2.74571287
+1 3 1 46.16555635 24.47162609 -0.02227443
+1 4 1 43.40910628 24.45335573 2.75718323
+1 5 1 44.78655048 23.08752670 1.36570902
+1 6 1 47.47939758 23.09355438 4.10178742
+1 7 1 47.50210887 25.74839528 1.34172340
+1 8 1 44.79726832 25.80746404 4.04108339
+2 1 1 65.12688844 21.76299649 0.00536002
+2 2 1 67.88043188 21.75201968 2.67433425
+2 3 1 67.90589191 24.47318543 -0.01045256
+2 4 1 65.16222332 24.48174837 2.68116221
+2 5 1 66.54336857 23.08136580 1.35779340
+2 6 1 69.25916049 23.08964785 4.09028980
+2 7 1 69.22024791 25.82308357 1.35229321
+2 8 1 66.50508924 25.76329310 4.09853619
+3 1 1 65.21414354 43.48542296 0.02890780
+3 2 1 67.93379248 43.49526632 2.71923184
+3 3 1 67.91024445 46.12163072 -0.04690181
+3 4 1 65.13299748 46.17604332 2.76043039
+3 5 1 66.52716886 44.84724642 1.32739512
+3 6 1 69.26482615 44.81961472 4.03683119
+3 7 1 69.22622351 47.54295822 1.36059688
+3 8 1 66.55006067 47.52155000 4.10586355
+4 1 1 43.45701112 43.45546767 0.03334082
+4 2 1 46.19909864 43.46272962 2.76478814
+4 3 1 46.17729705 46.20066561 0.00303425
+4 4 1 43.47965211 46.14931984 2.70766031
+4 5 1 44.82383389 44.84684947 1.39283291
+4 6 1 47.55897642 44.82044246 4.11471230
+4 7 1 47.57048025 47.48681256 1.33612488
+4 8 1 44.78816368 47.51861730 4.10604132
+5 1 1 43.48644449 21.73712792 21.68030903
+5 2 1 46.15245642 21.74305994 24.47618756
+5 3 1 46.12794982 24.47612783 21.75430176
+5 4 1 43.47767134 24.45448092 24.48900025
+5 5 1 44.82931150 23.07565622 23.13009493
+5 6 1 47.52321462 23.12894210 25.80397289
+5 7 1 47.54885014 25.81745679 23.03413189
+5 8 1 44.76785250 25.83587818 25.75252611
+6 1 1 65.16562401 21.72863089 21.75998198
+6 2 1 67.85942088 21.70747512 24.47423785
+6 3 1 67.88073134 24.46381326 21.68814037
+6 4 1 65.19304713 24.43839722 24.48518204
+6 5 1 66.52225901 23.06985783 23.06258996
+6 6 1 69.21551737 23.09482788 25.76302823
+6 7 1 69.22691854 25.79744934 23.11715293
+6 8 1 66.50122552 25.76286455 25.83951336
+7 1 1 65.19336864 43.43582276 21.68202208
+7 2 1 67.86922845 43.41692056 24.39683076
+7 3 1 67.87025667 46.15219706 21.74698122
+7 4 1 65.21890117 46.13985017 24.41315772
+7 5 1 66.50116035 44.77364875 23.10366583
+7 6 1 69.25171328 44.77271492 25.78971611
+7 7 1 69.23443903 47.51976875 23.10707252
+7 8 1 66.56382781 47.55315072 25.79720043
+8 1 1 43.47280231 43.49658639 21.76876154
+8 2 1 46.16547173 43.48278280 24.40412272
+8 3 1 46.16269991 46.16120003 21.71996612
+8 4 1 43.45557420 46.20706944 24.42307944
+8 5 1 44.79629734 44.83872331 23.08334673
+8 6 1 47.52580162 44.84622264 25.74727054
+8 7 1 47.51538632 47.55138673 23.08373496
+8 8 1 44.79002613 47.48181483 25.81543427
+20 Eight_Node 8 4 4 4
+1 1 1 43.45907202 21.68706563 21.67410428
+1 2 1 46.16614249 21.72956422 24.46639946
+1 3 1 46.17362142 24.39281182 21.74413699
+1 4 1 43.43068982 24.46024281 24.45581109
+1 5 1 44.83622056 23.05955857 23.07533030
+1 6 1 47.51332611 23.07792426 25.78144183
+1 7 1 47.47789351 25.76856710 23.07367545
+1 8 1 44.77894646 25.80393718 25.78252434
+2 1 1 65.18623947 21.69496906 21.73171260
+2 2 1 67.89534883 21.76808374 24.46517903
+2 3 1 67.92529152 24.44235375 21.72910934
+2 4 1 65.12537088 24.43905690 24.43425797
+2 5 1 66.48655635 23.07429589 23.08044656
+2 6 1 69.24276587 23.13155811 25.75536020
+2 7 1 69.24826950 25.77835043 23.06535907
+2 8 1 66.52338653 25.83716799 25.83447800
+3 1 1 65.13872320 43.42756030 21.73410092
+3 2 1 67.90671189 43.45834825 24.41588530
+3 3 1 67.90536542 46.16150941 21.72033654
+3 4 1 65.21376909 46.14051719 24.47494714
+3 5 1 66.54858959 44.82438173 23.06693910
+3 6 1 69.22634626 44.82484425 25.80380821
+3 7 1 69.20235203 47.48482714 23.10148968
+3 8 1 66.48202331 47.51988686 25.75835818
+4 1 1 43.46669010 43.42775532 21.73599619
+4 2 1 46.14984939 43.48029993 24.39313789
+4 3 1 46.21093499 46.18398891 21.67454509
+4 4 1 43.40579089 46.16130415 24.47896064
+4 5 1 44.79066901 44.75584836 23.11191058
+4 6 1 47.48757131 44.77930802 25.82445184
+4 7 1 47.52998009 47.55905790 23.11339981
+4 8 1 44.75795001 47.53393529 25.82565636
+5 1 1 43.45491648 21.75204547 43.46793692
+5 2 1 46.16615901 21.76058905 46.18227628
+5 3 1 46.13881507 24.44640047 43.48710065
+5 4 1 43.46261412 24.47775718 46.12310842
+5 5 1 44.77870895 23.06680073 44.81526828
+5 6 1 47.49160182 23.04070803 47.54307950
+5 7 1 47.51805103 25.76591861 44.85286701
+5 8 1 44.75778336 25.81586720 47.56134922
+6 1 1 65.19623017 21.72069744 43.42195154
+6 2 1 67.90306107 21.69012879 46.20856895
+6 3 1 67.89091471 24.42850520 43.44366101
+6 4 1 65.21861497 24.40080635 46.18574662
+6 5 1 66.49405662 23.05754446 44.78040235
+6 6 1 69.26258574 23.09486617 47.49933755
+6 7 1 69.24753206 25.82905144 44.76111319
+6 8 1 66.52225223 25.78270980 47.54767079
+7 1 1 65.20769934 43.47995894 43.43679834
+7 2 1 67.92680249 43.47366594 46.16715836
+7 3 1 67.92836517 46.12075503 43.43177065
+7 4 1 65.19643727 46.17956393 46.20915186
+7 5 1 66.56708014 44.82048181 44.79857038
+7 6 1 69.23752287 44.85017968 47.49732876
+7 7 1 69.22032070 47.47264679 44.76449144
+7 8 1 66.56337424 47.50220540 47.50865517
+8 1 1 43.49289843 43.42219989 43.48591543
+8 2 1 46.14841337 43.48284563 46.20837197
+8 3 1 46.16669552 46.20340917 43.42995821
+8 4 1 43.42519139 46.19015532 46.18767737
+8 5 1 44.84921101 44.80238112 44.84745742
+8 6 1 47.47599399 44.85144303 47.49255015
+8 7 1 47.53960158 47.56356161 44.84272809
+8 8 1 44.81334303 47.54754605 47.51422845
+21 Eight_Node 8 4 4 4
+1 1 1 43.46344752 43.41567851 -0.03574641
+1 2 1 46.19299850 43.45211226 2.74820098
+1 3 1 46.12021782 46.13070814 0.02290527
+1 4 1 43.44974663 46.12772255 2.73553966
+1 5 1 44.81027589 44.78073740 1.33262417
+1 6 1 47.53463504 44.85479121 4.05841302
+1 7 1 47.49353837 47.53572891 1.37653719
+1 8 1 44.82295691 47.51365074 4.10487033
+2 1 1 65.15043820 43.48179483 0.04207369
+2 2 1 67.93409495 43.45110761 2.68795249
+2 3 1 67.90471360 46.11669187 0.02460445
+2 4 1 65.15101400 46.20102841 2.66957924
+2 5 1 66.57331452 44.79884276 1.33928081
+2 6 1 69.25362189 44.85499189 4.10955144
+2 7 1 69.23895204 47.52110000 1.31974672
+2 8 1 66.53827292 47.49043726 4.03169121
+3 1 1 65.16882429 65.12801138 -0.01385956
+3 2 1 67.89136363 65.20424351 2.69711819
+3 3 1 67.90520177 67.86769977 -0.01707205
+3 4 1 65.15363008 67.88040782 2.67317866
+3 5 1 66.53328095 66.56885737 1.34937591
+3 6 1 69.25594405 66.53481910 4.07824269
+3 7 1 69.20032078 69.19735951 1.33690022
+3 8 1 66.56712584 69.19846664 4.08127844
+4 1 1 43.41227982 65.12233853 -0.03523347
+4 2 1 46.18153803 65.12493123 2.71161764
+4 3 1 46.18789827 67.90262550 -0.00990036
+4 4 1 43.48806575 67.89255591 2.68731323
+4 5 1 44.77525445 66.56310046 1.33012626
+4 6 1 47.50589538 66.55443801 4.08055030
+4 7 1 47.50989869 69.21464583 1.31152294
+4 8 1 44.79820501 69.25856581 4.10086185
+5 1 1 43.40777862 43.43757435 21.68896036
+5 2 1 46.20036869 43.43836091 24.44046447
+5 3 1 46.18825189 46.17434929 21.67447518
+5 4 1 43.47539440 46.11867668 24.44781735
+5 5 1 44.80900927 44.84173624 23.11714894
+5 6 1 47.53646687 44.80103983 25.75885391
+5 7 1 47.50033632 47.55513260 23.06894288
+5 8 1 44.83387094 47.51154494 25.76708301
+6 1 1 65.17082720 43.48939239 21.76313592
+6 2 1 67.89549353 43.41810829 24.48929397
+6 3 1 67.87682918 46.14794568 21.70155607
+6 4 1 65.14659565 46.11713040 24.42834980
+6 5 1 66.51945735 44.84432940 23.10318619
+6 6 1 69.24922139 44.85143858 25.76807872
+6 7 1 69.24756005 47.56847428 23.03380913
+6 8 1 66.49703813 47.48615175 25.76438490
+7 1 1 65.17074451 65.18390555 21.77254297
+7 2 1 67.87420661 65.21682991 24.40918477
+7 3 1 67.84635930 67.90258426 21.75746962
+7 4 1 65.18451198 67.87031420 24.44087245
+7 5 1 66.57064646 66.51179145 23.12341209
+7 6 1 69.25703643 66.50361698 25.76418850
+7 7 1 69.25556412 69.25871426 23.08910368
+7 8 1 66.50499597 69.23707903 25.81716912
+8 1 1 43.44313617 65.12928558 21.74008987
+8 2 1 46.13283341 65.21179139 24.42548038
+8 3 1 46.16635140 67.91323218 21.73113944
+8 4 1 43.41184700 67.88932483 24.48705253
+8 5 1 44.80288000 66.48827888 23.12094800
+8 6 1 47.53539120 66.51207053 25.84114181
+8 7 1 47.49256969 69.26556622 23.06184042
+8 8 1 44.77708006 69.21675804 25.80498044
+22 Eight_Node 8 4 4 4
+1 1 1 43.47308892 43.43143305 21.76636111
+1 2 1 46.16844028 43.44577815 24.45177603
+1 3 1 46.16796910 46.18933446 21.76577271
+1 4 1 43.48396099 46.11684714 24.46877625
+1 5 1 44.77432360 44.82883798 23.03670704
+1 6 1 47.48973198 44.79232161 25.76620712
+1 7 1 47.53645255 47.53128213 23.09338232
+1 8 1 44.85072499 47.47761720 25.80184130
+2 1 1 65.13457462 43.42733152 21.71483051
+2 2 1 67.91381566 43.47090323 24.44195838
+2 3 1 67.91494717 46.15365317 21.70688087
+2 4 1 65.16709576 46.20202728 24.46479632
+2 5 1 66.52778907 44.79401175 23.07408040
+2 6 1 69.22513495 44.80769630 25.74853196
+2 7 1 69.28905477 47.49346848 23.05685792
+2 8 1 66.56717797 47.47960383 25.79598007
+3 1 1 65.14461924 65.13971772 21.69378537
+3 2 1 67.85639620 65.16072014 24.47559453
+3 3 1 67.93142836 67.90322286 21.70433320
+3 4 1 65.15589360 67.86289121 24.42451717
+3 5 1 66.56079210 66.51307215 23.10890878
+3 6 1 69.24493139 66.48102106 25.79031113
+3 7 1 69.23976663 69.26434592 23.05640333
+3 8 1 66.51018650 69.21423362 25.82472397
+4 1 1 43.40215788 65.20357853 21.72894864
+4 2 1 46.18069030 65.16130591 24.46020644
+4 3 1 46.18120067 67.90412163 21.75342037
+4 4 1 43.49540732 67.89034750 24.39087613
+4 5 1 44.77835324 66.49542761 23.08253179
+4 6 1 47.49103383 66.54445977 25.82601469
+4 7 1 47.54061699 69.21983389 23.08465709
+4 8 1 44.85129662 69.26125614 25.78850861
+5 1 1 43.40062604 43.48085150 43.46262053
+5 2 1 46.16106079 43.47934001 46.20687334
+5 3 1 46.13115330 46.15587580 43.46035727
+5 4 1 43.39994561 46.16185512 46.19940901
+5 5 1 44.78275554 44.81429055 44.82405517
+5 6 1 47.55071734 44.83883890 47.53759877
+5 7 1 47.54610133 47.48024091 44.77986753
+5 8 1 44.84424684 47.52992811 47.49679367
+6 1 1 65.15965066 43.44242806 43.43548989
+6 2 1 67.84521286 43.44933564 46.15174657
+6 3 1 67.84323871 46.19640290 43.41559328
+6 4 1 65.12956521 46.21146927 46.19633113
+6 5 1 66.50245753 44.84361572 44.84220339
+6 6 1 69.21494271 44.83282249 47.48087964
+6 7 1 69.27638092 47.50837017 44.78034330
+6 8 1 66.57266809 47.51254521 47.53317912
+7 1 1 65.16110924 65.20925089 43.48081991
+7 2 1 67.92788851 65.17851802 46.19697747
+7 3 1 67.88363683 67.93734610 43.45735791
+7 4 1 65.13623809 67.89185356 46.18592025
+7 5 1 66.50590666 66.55724375 44.82496773
+7 6 1 69.26891175 66.53802419 47.51858972
+7 7 1 69.25327351 69.24170882 44.81080636
+7 8 1 66.52496777 69.21914664 47.50551256
+8 1 1 43.45242137 65.14354661 43.45513568
+8 2 1 46.11757687 65.14268481 46.13921462
+8 3 1 46.11759887 67.84036923 43.44621914
+8 4 1 43.45850863 67.90212538 46.20542186
+8 5 1 44.79537904 66.53876850 44.76833863
+8 6 1 47.49750642 66.48552126 47.56012517
+8 7 1 47.54730270 69.26620649 44.84672377
+8 8 1 44.83031998 69.29105056 47.55157247
+23 Eight_Node 8 4 4 4
+1 1 1 43.41268940 65.15987656 -0.01055906
+1 2 1 46.16761834 65.19901065 2.73176013
+1 3 1 46.15616647 67.90604009 0.04452631
+1 4 1 43.40562506 67.85065474 2.69682921
+1 5 1 44.77325053 66.56042367 1.39093039
+1 6 1 47.49146804 66.48609490 4.06780971
+1 7 1 47.49020176 69.25588219 1.40257178
+1 8 1 44.80234171 69.25225855 4.08664371
+2 1 1 65.13312038 65.21959394 -0.03663792
+2 2 1 67.87004718 65.18109876 2.71595170
+2 3 1 67.83914362 67.86693387 0.01681269
+2 4 1 65.15524034 67.84280151 2.73911147
+2 5 1 66.48882514 66.50027715 1.32503893
+2 6 1 69.29485601 66.53750323 4.06967697
+2 7 1 69.26812866 69.25490887 1.40004997
+2 8 1 66.50076820 69.22372330 4.07494717
+3 1 1 65.14772422 86.91215639 -0.01309739
+3 2 1 67.84179038 86.89516474 2.67778489
+3 3 1 67.91178658 89.63364530 0.02278746
+3 4 1 65.14141238 89.60855568 2.68377468
+3 5 1 66.55027344 88.20375307 1.38849204
+3 6 1 69.29314799 88.28583528 4.09280564
+3 7 1 69.25611193 90.96470566 1.36424690
+3 8 1 66.53038566 90.95579840 4.07756504
+4 1 1 43.41089541 86.85329795 -0.02029027
+4 2 1 46.20974121 86.90760630 2.75759164
+4 3 1 46.18531156 89.63856460 0.00040753
+4 4 1 43.45920200 89.56451033 2.67522182
+4 5 1 44.75724733 88.24745674 1.31158734
+4 6 1 47.48759507 88.21397917 4.11718394
+4 7 1 47.50104734 90.94226863 1.38891003
+4 8 1 44.81622007 90.95171188 4.04955981
+5 1 1 43.48760922 65.13908917 21.67837246
+5 2 1 46.15479304 65.19167897 24.45830190
+5 3 1 46.12270884 67.88088083 21.72999948
+5 4 1 43.47033240 67.90731640 24.43384745
+5 5 1 44.83100692 66.52938368 23.04348081
+5 6 1 47.48565945 66.49222619 25.81579021
+5 7 1 47.47286382 69.21772421 23.13072255
+5 8 1 44.84027355 69.24555372 25.75602858
+6 1 1 65.15946451 65.14320142 21.69959239
+6 2 1 67.88839561 65.20993471 24.40194050
+6 3 1 67.90103045 67.85082257 21.68877772
+6 4 1 65.17364787 67.91798924 24.41701775
+6 5 1 66.54212540 66.57094751 23.08956525
+6 6 1 69.23210170 66.50998822 25.82208847
+6 7 1 69.26259230 69.26112750 23.09773020
+6 8 1 66.54323940 69.24453390 25.84421961
+7 1 1 65.13265848 86.85128202 21.72333880
+7 2 1 67.92915953 86.88943244 24.48025252
+7 3 1 67.87995912 89.61372950 21.74785159
+7 4 1 65.21500081 89.61170524 24.43208377
+7 5 1 66.57436061 88.24419019 23.09349654
+7 6 1 69.25081168 88.26312261 25.75298282
+7 7 1 69.26001421 90.98163579 23.12124121
+7 8 1 66.56607182 90.98488781 25.80425415
+8 1 1 43.47243086 86.86668572 21.67585363
+8 2 1 46.18211145 86.88527032 24.43007789
+8 3 1 46.12883754 89.58110593 21.73001881
+8 4 1 43.43905387 89.65692333 24.44499872
+8 5 1 44.78644525 88.23748487 23.03375001
+8 6 1 47.55118865 88.20399285 25.82202068
+8 7 1 47.47775841 90.93333844 23.05705033
+8 8 1 44.78442228 90.93179649 25.78776038
+24 Eight_Node 8 4 4 4
+1 1 1 43.40424101 65.12825423 21.68312325
+1 2 1 46.14323464 65.12918756 24.45331686
+1 3 1 46.16793231 67.92169388 21.67768638
+1 4 1 43.46134374 67.85094466 24.48725075
+1 5 1 44.77198110 66.50353728 23.12604183
+1 6 1 47.55969189 66.56268620 25.74852475
+1 7 1 47.47521684 69.19740396 23.08402434
+1 8 1 44.84918109 69.21000555 25.77899999
+2 1 1 65.17066677 65.17785095 21.76778009
+2 2 1 67.86592151 65.15716940 24.45858340
+2 3 1 67.87503557 67.86922836 21.72905017
+2 4 1 65.14190826 67.87205198 24.48778999
+2 5 1 66.48926233 66.50026285 23.09427851
+2 6 1 69.22401440 66.53030350 25.81667578
+2 7 1 69.21072631 69.21221591 23.05409646
+2 8 1 66.55148614 69.25640726 25.84664765
+3 1 1 65.15633924 86.89583366 21.69214119
+3 2 1 67.93417145 86.91586721 24.45429939
+3 3 1 67.85627743 89.64245684 21.75774873
+3 4 1 65.13529519 89.57491293 24.47624842
+3 5 1 66.53343173 88.27944538 23.12543650
+3 6 1 69.27288072 88.21964605 25.76462794
+3 7 1 69.26603037 90.98224980 23.11870752
+3 8 1 66.55231385 90.95042846 25.80840618
+4 1 1 43.45922548 86.94187189 21.77191834
+4 2 1 46.16485057 86.89127838 24.45527243
+4 3 1 46.16453514 89.60603224 21.69281758
+4 4 1 43.41498829 89.61560615 24.43059263
+4 5 1 44.80729960 88.27738143 23.04838454
+4 6 1 47.49785449 88.28239130 25.77795854
+4 7 1 47.50662059 91.00944109 23.03324915
+4 8 1 44.79252536 90.93678983 25.84536822
+5 1 1 43.49153680 65.21244494 43.44892880
+5 2 1 46.17049842 65.18253459 46.18633283
+5 3 1 46.19247615 67.92411906 43.45847718
+5 4 1 43.40478458 67.90891857 46.15528944
+5 5 1 44.80714650 66.55519749 44.84743418
+5 6 1 47.53812599 66.54212712 47.57100771
+5 7 1 47.47288456 69.26698911 44.76568167
+5 8 1 44.81128279 69.22087097 47.50767470
+6 1 1 65.20538150 65.15449710 43.48817153
+6 2 1 67.90032836 65.21230407 46.17665496
+6 3 1 67.89848435 67.89277038 43.48962741
+6 4 1 65.12295311 67.84857451 46.13530508
+6 5 1 66.56896413 66.57613307 44.77301164
+6 6 1 69.22387218 66.52674932 47.49405146
+6 7 1 69.21645672 69.21358935 44.83645152
+6 8 1 66.49366779 69.25520228 47.55702062
+7 1 1 65.14395731 86.88879856 43.39966279
+7 2 1 67.84919412 86.88930469 46.17526887
+7 3 1 67.85794561 89.65337146 43.45530481
+7 4 1 65.22184926 89.61063221 46.17237829
+7 5 1 66.54716720 88.26782823 44.81373915
+7 6 1 69.25675550 88.22955335 47.54399182
+7 7 1 69.27015765 90.97971701 44.79051802
+7 8 1 66.51562553 90.94685766 47.47534501
+8 1 1 43.45273993 86.93311519 43.45256753
+8 2 1 46.21154128 86.90385879 46.11690414
+8 3 1 46.17415023 89.56397226 43.43316859
+8 4 1 43.49707879 89.64735083 46.15246718
+8 5 1 44.77485626 88.21078948 44.76959886
+8 6 1 47.49349944 88.28862488 47.50558787
+8 7 1 47.55800234 91.01253408 44.85494086
+8 8 1 44.78753128 90.99561981 47.53891820
+25 Eight_Node 8 4 4 4
+1 1 1 65.13723991 0.02807387 0.01239646
+1 2 1 67.84818142 -0.00803075 2.69508977
+1 3 1 67.88570936 2.68842277 -0.03121146
+1 4 1 65.12297215 2.73105091 2.69503841
+1 5 1 66.51048684 1.37138583 1.37997091
+1 6 1 69.23651537 1.40477831 4.03850552
+1 7 1 69.21857503 4.10206045 1.34895730
+1 8 1 66.49472423 4.10212483 4.03110551
+2 1 1 86.93341178 -0.01727600 0.02594118
+2 2 1 89.60004007 0.00386080 2.69463703
+2 3 1 89.64594568 2.70200169 -0.03877676
+2 4 1 86.93941070 2.74448769 2.69722429
+2 5 1 88.24685993 1.34919166 1.32552972
+2 6 1 90.99854332 1.38324009 4.10285259
+2 7 1 90.93709351 4.05997583 1.37559493
+2 8 1 88.21363497 4.09908504 4.05721558
+3 1 1 86.84612563 21.70843425 0.04119476
+3 2 1 89.59777295 21.70588650 2.67673063
+3 3 1 89.59970417 24.39910256 -0.04885080
+3 4 1 86.91040800 24.46912354 2.70523284
+3 5 1 88.29767871 23.08177984 1.35584398
+3 6 1 90.96754478 23.12066759 4.07452469
+3 7 1 90.95992858 25.77675365 1.35800152
+3 8 1 88.26345569 25.79135405 4.11332343
+4 1 1 65.12498943 21.71815151 -0.04107013
+4 2 1 67.87412448 21.75901119 2.76267338
+4 3 1 67.87100851 24.45253741 -0.02727098
+4 4 1 65.12641050 24.39204035 2.72616211
+4 5 1 66.53700174 23.11405983 1.38266914
+4 6 1 69.21486586 23.03879998 4.09769950
+4 7 1 69.21914160 25.82740696 1.36306385
+4 8 1 66.56185465 25.76474179 4.05897594
+5 1 1 65.21099838 -0.03855294 21.72456145
+5 2 1 67.87994771 0.04374052 24.40844702
+5 3 1 67.90263532 2.68174575 21.71925096
+5 4 1 65.15777464 2.68373664 24.46365705
+5 5 1 66.52356354 1.38037632 23.11941905
+5 6 1 69.20710609 1.40050309 25.84348522
+5 7 1 69.24059812 4.02663128 23.05764157
+5 8 1 66.49022886 4.04033412 25.77482043
+6 1 1 86.90165388 -0.04039065 21.76818999
+6 2 1 89.60822484 -0.02462206 24.39164902
+6 3 1 89.62018521 2.74603458 21.75963615
+6 4 1 86.90793431 2.72001074 24.39148767
+6 5 1 88.24314401 1.40662503 23.04943561
+6 6 1 91.00200183 1.37191968 25.81481255
+6 7 1 90.96696354 4.06335314 23.10950410
+6 8 1 88.27619117 4.07494568 25.74737657
+7 1 1 86.88977224 21.69937369 21.68209355
+7 2 1 89.61320250 21.71296500 24.48873440
+7 3 1 89.59090990 24.47599251 21.68907888
+7 4 1 86.90063691 24.42509539 24.39236536
+7 5 1 88.21344142 23.08874209 23.11852419
+7 6 1 90.92223671 23.05112066 25.82886704
+7 7 1 90.98361386 25.81590506 23.08553657
+7 8 1 88.22809160 25.79678414 25.75175150
+8 1 1 65.20768925 21.67470738 21.67807588
+8 2 1 67.89123704 21.68238375 24.42246950
+8 3 1 67.91328231 24.43145105 21.74166654
+8 4 1 65.14790810 24.48542208 24.39709333
+8 5 1 66.54161900 23.05246532 23.07265449
+8 6 1 69.22515831 23.03212541 25.84405356
+8 7 1 69.26455645 25.82717073 23.03178530
+8 8 1 66.54834837 25.81322377 25.76604134
+26 Eight_Node 8 4 4 4
+1 1 1 65.12952843 0.01903451 21.71532814
+1 2 1 67.87324161 0.04189027 24.47546640
+1 3 1 67.85757769 2.74045356 21.67607701
+1 4 1 65.15098237 2.66597562 24.45660025
+1 5 1 66.49887369 1.35772098 23.06217528
+1 6 1 69.21791429 1.38312380 25.77108805
+1 7 1 69.25804684 4.08227863 23.12318129
+1 8 1 66.49820533 4.03491540 25.82131950
+2 1 1 86.88213788 0.02861790 21.70387190
+2 2 1 89.57059092 0.04120687 24.46534731
+2 3 1 89.65936289 2.76481074 21.69256463
+2 4 1 86.85248833 2.68925381 24.41610091
+2 5 1 88.28221942 1.37708427 23.05415101
+2 6 1 90.98758703 1.34506570 25.84197617
+2 7 1 91.00359731 4.03447850 23.08695802
+2 8 1 88.22031098 4.11018909 25.84383736
+3 1 1 86.91945723 21.75067579 21.69178454
+3 2 1 89.59833967 21.77342740 24.42568655
+3 3 1 89.64274914 24.43809001 21.76010365
+3 4 1 86.94147216 24.47412934 24.48105219
+3 5 1 88.24000644 23.04509488 23.10814644
+3 6 1 91.00670303 23.07381208 25.78476708
+3 7 1 90.98415806 25.84318030 23.04419177
+3 8 1 88.28493677 25.82663233 25.81741757
+4 1 1 65.20180473 21.73197898 21.75673884
+4 2 1 67.89626176 21.76130516 24.48363126
+4 3 1 67.84259462 24.45129247 21.77177610
+4 4 1 65.15866810 24.39170779 24.42884610
+4 5 1 66.53834566 23.05736383 23.12217721
+4 6 1 69.19598963 23.06138305 25.82837713
+4 7 1 69.22004739 25.76544156 23.06233184
+4 8 1 66.49911034 25.82074040 25.83359291
+5 1 1 65.14488655 0.03562459 43.48349911
+5 2 1 67.87747393 -0.01020036 46.20155564
+5 3 1 67.86510696 2.73387654 43.49281925
+5 4 1 65.17892097 2.69050717 46.16804867
+5 5 1 66.53694156 1.35585762 44.77657128
+5 6 1 69.19739132 1.39125520 47.47155092
+5 7 1 69.26371047 4.05187984 44.78631727
+5 8 1 66.48471792 4.07998360 47.49104848
+6 1 1 86.86044027 0.00352167 43.43596056
+6 2 1 89.59358403 -0.02503235 46.15683614
+6 3 1 89.63589946 2.76210018 43.44915871
+6 4 1 86.87864162 2.68408102 46.18739473
+6 5 1 88.22367729 1.32400162 44.81470554
+6 6 1 90.96854433 1.31337552 47.47128665
+6 7 1 90.91971890 4.05003938 44.83875786
+6 8 1 88.28465960 4.05272565 47.56497455
+7 1 1 86.88900227 21.73265194 43.47281426
+7 2 1 89.57285172 21.69239152 46.19862072
+7 3 1 89.58748172 24.46391070 43.44310095
+7 4 1 86.87831027 24.48413315 46.17781441
+7 5 1 88.21180014 23.06030951 44.77916364
+7 6 1 91.01367232 23.09555458 47.49268313
+7 7 1 90.96049433 25.75961738 44.75647119
+7 8 1 88.25703587 25.78786613 47.50616846
+8 1 1 65.20533632 21.75176006 43.48351833
+8 2 1 67.90475863 21.76662636 46.19750229
+8 3 1 67.87866574 24.46221086 43.41852201
+8 4 1 65.12946296 24.38968230 46.15740884
+8 5 1 66.50646683 23.06877286 44.82595997
+8 6 1 69.19864873 23.10003660 47.50984193
+8 7 1 69.19909378 25.79649923 44.83083323
+8 8 1 66.49548355 25.81830122 47.56137213
+27 Eight_Node 8 4 4 4
+1 1 1 65.14425205 21.76616826 -0.02496874
+1 2 1 67.87489533 21.74185773 2.68255679
+1 3 1 67.88004528 24.45490615 -0.01897611
+1 4 1 65.13014679 24.46597069 2.73692303
+1 5 1 66.50172799 23.06745273 1.32875185
+1 6 1 69.24810886 23.11737982 4.08981578
+1 7 1 69.27263859 25.81114672 1.34762814
+1 8 1 66.50570483 25.75652293 4.09264984
+2 1 1 86.88001163 21.67724754 -0.01425290
+2 2 1 89.65080921 21.73764396 2.70793263
+2 3 1 89.56711994 24.46435749 0.00616596
+2 4 1 86.86206148 24.45507202 2.74413839
+2 5 1 88.22391496 23.12569504 1.36416140
+2 6 1 91.01869714 23.05666406 4.08653691
+2 7 1 90.97155235 25.76333097 1.32059880
+2 8 1 88.21258934 25.83613161 4.11963385
+3 1 1 86.84992045 43.44222800 0.00967578
+3 2 1 89.61748050 43.45705362 2.73222920
+3 3 1 89.58273331 46.11458893 0.02111917
+3 4 1 86.94523460 46.20357380 2.76200067
+3 5 1 88.23224411 44.83190318 1.37446867
+3 6 1 90.92426853 44.80121156 4.04512834
+3 7 1 90.99222729 47.49707649 1.36301250
+3 8 1 88.26026733 47.52901173 4.11396692
+4 1 1 65.13251803 43.46814944 -0.00177507
+4 2 1 67.84884342 43.49129549 2.70027664
+4 3 1 67.89935126 46.14086197 -0.03814854
+4 4 1 65.20525625 46.12326993 2.73759461
+4 5 1 66.57698126 44.77898758 1.31404031
+4 6 1 69.22962904 44.76614826 4.12286364
+4 7 1 69.20587127 47.48812191 1.31176763
+4 8 1 66.57965689 47.53130887 4.03126118
+5 1 1 65.12311366 21.71657668 21.70097026
+5 2 1 67.92110051 21.75286417 24.41411082
+5 3 1 67.83781839 24.41559812 21.68917483
+5 4 1 65.14500641 24.41169297 24.45625598
+5 5 1 66.52308541 23.12211427 23.11325269
+5 6 1 69.24313980 23.07914045 25.79789324
+5 7 1 69.29258152 25.78929734 23.07487485
+5 8 1 66.49565908 25.83714202 25.82654217
+6 1 1 86.91351264 21.75221494 21.71195238
+6 2 1 89.64414786 21.69457405 24.38955989
+6 3 1 89.62871120 24.46444876 21.73130061
+6 4 1 86.89977561 24.44408672 24.39329226
+6 5 1 88.25981526 23.11811437 23.03373968
+6 6 1 90.94505192 23.08357182 25.78696487
+6 7 1 90.98769079 25.76271609 23.09293501
+6 8 1 88.25378995 25.82561756 25.81086622
+7 1 1 86.91450368 43.42665919 21.76552249
+7 2 1 89.59741493 43.45964273 24.42287609
+7 3 1 89.64662169 46.18652084 21.73153169
+7 4 1 86.93916256 46.20476518 24.42618331
+7 5 1 88.23010545 44.78807318 23.05623454
+7 6 1 90.94786534 44.76644574 25.82368698
+7 7 1 90.95652490 47.55701190 23.03265517
+7 8 1 88.23421032 47.56728725 25.83419696
+8 1 1 65.22144508 43.49508997 21.76284568
+8 2 1 67.90195388 43.49459073 24.40402674
+8 3 1 67.88339202 46.17056163 21.75214598
+8 4 1 65.18060089 46.13344573 24.47656102
+8 5 1 66.53051875 44.82006227 23.03280263
+8 6 1 69.29380220 44.75840865 25.84589631
+8 7 1 69.25782468 47.51810702 23.09621037
+8 8 1 66.52724636 47.56498616 25.82871927
+28 Eight_Node 8 4 4 4
+1 1 1 65.12331701 21.71687025 21.70612473
+1 2 1 67.91543156 21.70597987 24.42447343
+1 3 1 67.93194512 24.44538113 21.70731429
+1 4 1 65.14585626 24.39040395 24.41012227
+1 5 1 66.49977932 23.10632260 23.12759740
+1 6 1 69.23378024 23.03803518 25.74932425
+1 7 1 69.29378687 25.83559955 23.11947561
+1 8 1 66.55140791 25.79795235 25.77959748
+2 1 1 86.88107677 21.72273257 21.69394919
+2 2 1 89.60391619 21.76859283 24.44151816
+2 3 1 89.61333073 24.43795766 21.72458711
+2 4 1 86.93525893 24.45440459 24.46314182
+2 5 1 88.29640469 23.10758309 23.10240283
+2 6 1 91.00309940 23.07320919 25.80844506
+2 7 1 90.94557638 25.83453120 23.11368343
+2 8 1 88.25125418 25.81206146 25.84305331
+3 1 1 86.87772479 43.45562807 21.76157792
+3 2 1 89.61284915 43.40604948 24.40938155
+3 3 1 89.57025554 46.15016701 21.68029316
+3 4 1 86.91981431 46.13066326 24.39079953
+3 5 1 88.20879195 44.75949453 23.11430705
+3 6 1 90.92303163 44.79304750 25.83148487
+3 7 1 91.00204465 47.49908531 23.03316015
+3 8 1 88.28877816 47.53645916 25.83882092
+4 1 1 65.19121671 43.47369990 21.73583633
+4 2 1 67.90514955 43.46018369 24.40135452
+4 3 1 67.86231486 46.18603475 21.76741415
+4 4 1 65.13789783 46.13233029 24.42090022
+4 5 1 66.53600674 44.84394896 23.04757523
+4 6 1 69.29051900 44.80407058 25.75251505
+4 7 1 69.24706152 47.50668187 23.07177307
+4 8 1 66.56964182 47.47430130 25.77667034
+5 1 1 65.17671041 21.70933796 43.44735313
+5 2 1 67.90603579 21.72008794 46.12251806
+5 3 1 67.89283954 24.39525623 43.43267681
+5 4 1 65.19723524 24.41463859 46.13648707
+5 5 1 66.49864598 23.03389049 44.81343087
+5 6 1 69.21347361 23.10486451 47.47811258
+5 7 1 69.20719238 25.80985552 44.81731715
+5 8 1 66.50815401 25.76235109 47.55578770
+6 1 1 86.90786847 21.72153106 43.41150166
+6 2 1 89.59490071 21.73564764 46.12815697
+6 3 1 89.61736984 24.47597155 43.43862935
+6 4 1 86.89981792 24.43069080 46.12567938
+6 5 1 88.25843653 23.04003735 44.84510302
+6 6 1 91.01197949 23.12372099 47.55854779
+6 7 1 90.94390754 25.80750406 44.83042961
+6 8 1 88.24716883 25.81690889 47.53461611
+7 1 1 86.85306284 43.40282117 43.48816893
+7 2 1 89.65181679 43.46998504 46.16599175
+7 3 1 89.64116367 46.20484790 43.47329961
+7 4 1 86.91395354 46.11825652 46.13882059
+7 5 1 88.23709700 44.80153147 44.78497348
+7 6 1 90.99933568 44.85512282 47.51057829
+7 7 1 90.99965973 47.50264332 44.83399388
+7 8 1 88.22986934 47.50620664 47.49066115
+8 1 1 65.17524923 43.42888634 43.48690623
+8 2 1 67.85059890 43.48769910 46.13529111
+8 3 1 67.85926220 46.18232717 43.46607656
+8 4 1 65.13657214 46.17336538 46.15027629
+8 5 1 66.54050873 44.79802339 44.80465771
+8 6 1 69.20524685 44.76470041 47.55624670
+8 7 1 69.20943185 47.55485720 44.78647240
+8 8 1 66.54806415 47.51256796 47.52020162
+29 Eight_Node 8 4 4 4
+1 1 1 65.14733708 43.42691187 -0.03454174
+1 2 1 67.91653767 43.39958817 2.75266402
+1 3 1 67.91608634 46.13850402 -0.02997085
+1 4 1 65.20430482 46.15665506 2.68723000
+1 5 1 66.53391553 44.84852686 1.39449505
+1 6 1 69.24946840 44.81068921 4.09648643
+1 7 1 69.22911225 47.47512348 1.35943574
+1 8 1 66.49083452 47.49973466 4.05430845
+2 1 1 86.89960888 43.40241226 -0.02651316
+2 2 1 89.56263383 43.48350069 2.76415231
+2 3 1 89.63232154 46.11544546 -0.03751719
+2 4 1 86.92186167 46.16104577 2.73637882
+2 5 1 88.23911423 44.84793441 1.33780890
+2 6 1 90.97836926 44.81255055 4.05010066
+2 7 1 90.94787438 47.56701981 1.40014029
+2 8 1 88.28909950 47.54381575 4.08023415
+3 1 1 86.87808888 65.13242916 0.04349545
+3 2 1 89.63920647 65.14779201 2.75379302
+3 3 1 89.61969957 67.84671542 -0.01787964
+3 4 1 86.86972669 67.91415329 2.74802703
+3 5 1 88.26651532 66.52342120 1.39316036
+3 6 1 90.95983740 66.49428935 4.08843234
+3 7 1 91.00988885 69.28426003 1.39034597
+3 8 1 88.24749232 69.24358452 4.08707245
+4 1 1 65.17550785 65.21390326 0.01790684
+4 2 1 67.92216732 65.18329506 2.67188886
+4 3 1 67.84539624 67.86204031 0.00923038
+4 4 1 65.21056668 67.92681217 2.72497947
+4 5 1 66.50641016 66.53883770 1.33211374
+4 6 1 69.24732934 66.52901866 4.11674340
+4 7 1 69.28565338 69.20018902 1.38967085
+4 8 1 66.53994400 69.25518739 4.06804966
+5 1 1 65.21098799 43.47570628 21.68844565
+5 2 1 67.87218810 43.42310150 24.41167742
+5 3 1 67.85810333 46.18059513 21.71076242
+5 4 1 65.14683438 46.14627836 24.47394178
+5 5 1 66.49442663 44.84276490 23.09182698
+5 6 1 69.24307434 44.77211726 25.84699534
+5 7 1 69.27810118 47.53332557 23.08510746
+5 8 1 66.54100331 47.51044171 25.75004421
+6 1 1 86.86468436 43.43168388 21.68425016
+6 2 1 89.63739833 43.45319765 24.47349628
+6 3 1 89.64999764 46.17190773 21.74001853
+6 4 1 86.86796512 46.12390588 24.46295020
+6 5 1 88.29123507 44.77731462 23.11644692
+6 6 1 90.96135579 44.81414422 25.83550244
+6 7 1 91.00943062 47.55268981 23.11451652
+6 8 1 88.27339805 47.55442767 25.82876576
+7 1 1 86.87255926 65.17971566 21.67911325
+7 2 1 89.58171547 65.21576347 24.40730159
+7 3 1 89.60196828 67.85794316 21.69741725
+7 4 1 86.88719350 67.84685860 24.46362655
+7 5 1 88.22575679 66.49460739 23.07755226
+7 6 1 90.96664984 66.52018025 25.84415288
+7 7 1 91.01369816 69.28041207 23.08910778
+7 8 1 88.21689922 69.26388637 25.77166919
+8 1 1 65.17705175 65.13686118 21.74207989
+8 2 1 67.85910842 65.21597289 24.46628592
+8 3 1 67.89358393 67.84855301 21.69484654
+8 4 1 65.16626203 67.90869173 24.43655408
+8 5 1 66.56890067 66.53543326 23.05760043
+8 6 1 69.21575417 66.48620921 25.82871885
+8 7 1 69.28397902 69.27904877 23.12097025
+8 8 1 66.56351594 69.24476029 25.78676247
+30 Eight_Node 8 4 4 4
+1 1 1 65.18154535 43.49135138 21.69371975
+1 2 1 67.93283607 43.46964534 24.40317984
+1 3 1 67.84038284 46.12845210 21.76236040
+1 4 1 65.15194165 46.19391670 24.46005819
+1 5 1 66.49919478 44.78949928 23.05618664
+1 6 1 69.20679203 44.78918775 25.81712963
+1 7 1 69.24568000 47.52542372 23.07829483
+1 8 1 66.54338333 47.52736345 25.76213907
+2 1 1 86.85598555 43.43120870 21.74458413
+2 2 1 89.64140487 43.45035906 24.47549823
+2 3 1 89.62772723 46.19477115 21.73708250
+2 4 1 86.93436038 46.14508836 24.41412873
+2 5 1 88.26706490 44.81968268 23.08685634
+2 6 1 90.94384495 44.83073655 25.81267146
+2 7 1 90.96528933 47.52685128 23.06117535
+2 8 1 88.24264962 47.56790916 25.76138130
+3 1 1 86.89521578 65.18287670 21.72403967
+3 2 1 89.60727072 65.13197179 24.46930701
+3 3 1 89.56790204 67.87378629 21.71378208
+3 4 1 86.86300455 67.92647425 24.47210779
+3 5 1 88.20603926 66.48358937 23.03770695
+3 6 1 90.94260832 66.49716194 25.79450405
+3 7 1 90.93195009 69.19940773 23.13171453
+3 8 1 88.29247602 69.20291899 25.78163400
+4 1 1 65.14218780 65.13642599 21.72960040
+4 2 1 67.88101389 65.15346284 24.43892254
+4 3 1 67.88561116 67.84171289 21.68190573
+4 4 1 65.16368972 67.90817204 24.47047442
+4 5 1 66.51983547 66.48138456 23.11814313
+4 6 1 69.19816729 66.50668279 25.80616969
+4 7 1 69.24362772 69.22167369 23.09296297
+4 8 1 66.49654513 69.27135383 25.75065431
+5 1 1 65.12544786 43.43031239 43.47776761
+5 2 1 67.92272129 43.48973558 46.15440102
+5 3 1 67.92910187 46.15160510 43.44944127
+5 4 1 65.14177155 46.17657338 46.13978044
+5 5 1 66.56758343 44.78792233 44.84713968
+5 6 1 69.25069621 44.79369306 47.53644134
+5 7 1 69.21848818 47.52021690 44.80047303
+5 8 1 66.50454546 47.47424992 47.48465657
+6 1 1 86.92610046 43.39980009 43.43142488
+6 2 1 89.58216798 43.40729560 46.16425599
+6 3 1 89.64951893 46.15701498 43.49297417
+6 4 1 86.87223722 46.19402281 46.11548137
+6 5 1 88.22124552 44.82973064 44.76006605
+6 6 1 90.96738229 44.80416883 47.55168455
+6 7 1 90.98244948 47.54575118 44.76252346
+6 8 1 88.22019813 47.52904544 47.52280448
+7 1 1 86.93743452 65.21641685 43.48026103
+7 2 1 89.63992724 65.14884338 46.17140242
+7 3 1 89.61220826 67.90469201 43.42593322
+7 4 1 86.88974144 67.86120527 46.18902491
+7 5 1 88.20614919 66.56207739 44.83932003
+7 6 1 90.93001895 66.56379159 47.48908064
+7 7 1 90.98476483 69.20147572 44.78389792
+7 8 1 88.26118914 69.29040224 47.53456443
+8 1 1 65.14037864 65.12680817 43.47877587
+8 2 1 67.86358150 65.16746580 46.18435569
+8 3 1 67.90689267 67.85666398 43.44904539
+8 4 1 65.21945282 67.87053009 46.17237820
+8 5 1 66.52197149 66.48235869 44.84949867
+8 6 1 69.23157368 66.57844839 47.51927748
+8 7 1 69.24894219 69.22497929 44.76160410
+8 8 1 66.55737240 69.22127694 47.55331728
+31 Eight_Node 8 4 4 4
+1 1 1 65.18533170 65.21282924 -0.01590160
+1 2 1 67.87134760 65.18892712 2.71697108
+1 3 1 67.93135745 67.87856480 0.03097436
+1 4 1 65.14743345 67.86645849 2.72431462
+1 5 1 66.53593000 66.50469532 1.31367477
+1 6 1 69.20136656 66.51555509 4.05859518
+1 7 1 69.23841674 69.24133638 1.34120566
+1 8 1 66.49937387 69.21838261 4.07308083
+2 1 1 86.94082561 65.21651341 0.04104308
+2 2 1 89.59115848 65.15407171 2.68959203
+2 3 1 89.64777422 67.90941523 0.04452234
+2 4 1 86.86004444 67.83979790 2.70547674
+2 5 1 88.21155565 66.52707579 1.36727984
+2 6 1 91.01830613 66.52466287 4.09743416
+2 7 1 90.99390932 69.26315031 1.36271591
+2 8 1 88.26857100 69.27979880 4.04411047
+3 1 1 86.84942854 86.91780892 -0.03497630
+3 2 1 89.63681776 86.88827968 2.75951114
+3 3 1 89.62732603 89.59368482 -0.03522706
+3 4 1 86.85031431 89.56966943 2.70933197
+3 5 1 88.27546011 88.30304618 1.38162123
+3 6 1 90.97210051 88.26175265 4.08165065
+3 7 1 90.92508477 90.97795905 1.31448907
+3 8 1 88.21981898 91.00814282 4.05363951
+4 1 1 65.18866181 86.87817188 -0.02970744
+4 2 1 67.88054161 86.90350081 2.75770859
+4 3 1 67.89495318 89.57612152 -0.04988028
+4 4 1 65.17387588 89.57080582 2.69834799
+4 5 1 66.48795524 88.20921326 1.38549940
+4 6 1 69.24971903 88.24501289 4.08741223
+4 7 1 69.28017030 90.92129042 1.40021287
+4 8 1 66.55387308 90.98115564 4.08396722
+5 1 1 65.20575403 65.18237495 21.75911348
+5 2 1 67.87240156 65.14037476 24.45111088
+5 3 1 67.91104806 67.93322950 21.75926551
+5 4 1 65.18266254 67.91936437 24.46145506
+5 5 1 66.53969041 66.55045805 23.04566536
+5 6 1 69.22875741 66.53775094 25.76952735
+5 7 1 69.22331616 69.20000960 23.03234366
+5 8 1 66.57878130 69.20080753 25.75925604
+6 1 1 86.91229328 65.17817121 21.68670991
+6 2 1 89.61594440 65.18571828 24.39818405
+6 3 1 89.63717783 67.85602047 21.68465634
+6 4 1 86.92804539 67.88176051 24.40194063
+6 5 1 88.27219870 66.50093233 23.08500227
+6 6 1 90.92940874 66.54895654 25.81091063
+6 7 1 90.95222298 69.20355739 23.09897632
+6 8 1 88.23359515 69.28112784 25.84181490
+7 1 1 86.85322120 86.85243367 21.67791179
+7 2 1 89.56271544 86.84718781 24.48634166
+7 3 1 89.59093756 89.63677193 21.73729768
+7 4 1 86.91677524 89.59389454 24.42163724
+7 5 1 88.22420749 88.20687144 23.08660586
+7 6 1 90.93397610 88.26649979 25.76797832
+7 7 1 90.93909055 90.94760101 23.04261954
+7 8 1 88.24770599 91.00016553 25.75640926
+8 1 1 65.18896937 86.84969619 21.69835442
+8 2 1 67.86574792 86.88134319 24.46660305
+8 3 1 67.84004183 89.60532203 21.71239704
+8 4 1 65.14958872 89.57713409 24.41190201
+8 5 1 66.53641979 88.28893841 23.12228017
+8 6 1 69.23258412 88.20921964 25.77623050
+8 7 1 69.26676322 90.95530693 23.07277212
+8 8 1 66.49968450 91.00595906 25.81270085
+32 Eight_Node 8 4 4 4
+1 1 1 65.16683356 65.17002298 21.67976791
+1 2 1 67.88323824 65.21016129 24.44953206
+1 3 1 67.90503439 67.87151160 21.71911449
+1 4 1 65.18935416 67.88600246 24.41638592
+1 5 1 66.49495474 66.51152852 23.06898282
+1 6 1 69.25630487 66.49607812 25.83086584
+1 7 1 69.21649624 69.25635981 23.09745218
+1 8 1 66.55296965 69.27590129 25.81645696
+2 1 1 86.85944699 65.15922297 21.68243355
+2 2 1 89.65696047 65.15209426 24.44753449
+2 3 1 89.64804771 67.90266311 21.76676635
+2 4 1 86.89220484 67.92181531 24.44979162
+2 5 1 88.23725430 66.51962842 23.10192330
+2 6 1 90.93042867 66.54523932 25.79888875
+2 7 1 90.96086505 69.20436051 23.09670355
+2 8 1 88.20837025 69.21262540 25.84622369
+3 1 1 86.85043043 86.93894561 21.72358243
+3 2 1 89.59566801 86.86089791 24.47923156
+3 3 1 89.58053965 89.62851300 21.72216690
+3 4 1 86.86103596 89.57515406 24.40766007
+3 5 1 88.21031507 88.30265706 23.05583492
+3 6 1 91.01421352 88.22979522 25.79876991
+3 7 1 90.93671378 90.98373834 23.06116429
+3 8 1 88.20634861 90.93374312 25.79076551
+4 1 1 65.12930105 86.85495546 21.71041396
+4 2 1 67.89863663 86.86976346 24.45219663
+4 3 1 67.90467887 89.63463249 21.77268349
+4 4 1 65.21812427 89.59474668 24.44454774
+4 5 1 66.57305763 88.28354907 23.10772154
+4 6 1 69.28235128 88.25369762 25.78352952
+4 7 1 69.23919470 90.99302521 23.07469170
+4 8 1 66.48932185 91.00665251 25.75997154
+5 1 1 65.21619001 65.20165532 43.44525012
+5 2 1 67.93570718 65.13746736 46.14369517
+5 3 1 67.84673981 67.85423978 43.44148544
+5 4 1 65.12863665 67.90847641 46.15794499
+5 5 1 66.52029485 66.52155885 44.78620705
+5 6 1 69.27816135 66.49682731 47.54241293
+5 7 1 69.20765484 69.26817677 44.79170347
+5 8 1 66.49544834 69.27399684 47.47903255
+6 1 1 86.92433706 65.15697601 43.41872106
+6 2 1 89.56926184 65.20970808 46.12036242
+6 3 1 89.64609696 67.86023147 43.45794852
+6 4 1 86.89932994 67.90485669 46.15359410
+6 5 1 88.24909189 66.51976327 44.81644276
+6 6 1 90.98893091 66.51168149 47.55890507
+6 7 1 91.01725414 69.25211335 44.82235826
+6 8 1 88.28900559 69.26884247 47.55006029
+7 1 1 86.84889789 86.89487162 43.48722959
+7 2 1 89.62331915 86.91927348 46.12539856
+7 3 1 89.57130419 89.57450617 43.42250717
+7 4 1 86.91205093 89.63157642 46.12622526
+7 5 1 88.29659601 88.27858430 44.84466857
+7 6 1 90.97362952 88.26060626 47.48742141
+7 7 1 90.95877980 90.98508039 44.85373955
+7 8 1 88.27879199 90.93755382 47.55246027
+8 1 1 65.21391203 86.86391554 43.49103436
+8 2 1 67.92652493 86.92380894 46.11543368
+8 3 1 67.92455163 89.65243759 43.40858058
+8 4 1 65.21290623 89.64413029 46.13296331
+8 5 1 66.50124534 88.24431288 44.81968692
+8 6 1 69.26566641 88.25332551 47.51431875
+8 7 1 69.22557811 90.92731813 44.79868611
+8 8 1 66.49619069 90.93101145 47.50579160
+33 Atom 1 1 1 1
+1 1 1 2.71660380 2.76191131 46.16448841
+34 Atom 1 1 1 1
+1 1 1 5.45475192 2.67284001 48.89633440
+35 Atom 1 1 1 1
+1 1 1 5.42453012 5.40531875 46.19128000
+36 Atom 1 1 1 1
+1 1 1 2.69972192 5.40031072 48.90599637
+37 Atom 1 1 1 1
+1 1 1 4.11403374 4.03065663 47.54533686
+38 Atom 1 1 1 1
+1 1 1 6.79481498 4.10663525 50.21331240
+39 Atom 1 1 1 1
+1 1 1 6.81228198 6.83019704 47.49290800
+40 Atom 1 1 1 1
+1 1 1 4.10002826 6.77759618 50.26765852
+41 Atom 1 1 1 1
+1 1 1 2.69373204 8.17595881 46.13496729
+42 Atom 1 1 1 1
+1 1 1 5.44420524 8.15428315 48.84876832
+43 Atom 1 1 1 1
+1 1 1 5.38152897 10.85901528 46.20574284
+44 Atom 1 1 1 1
+1 1 1 2.73107190 10.90370588 48.90201463
+45 Atom 1 1 1 1
+1 1 1 4.06050547 9.54353285 47.53848407
+46 Atom 1 1 1 1
+1 1 1 6.78904015 9.51751310 50.20533628
+47 Atom 1 1 1 1
+1 1 1 6.79330609 12.21526883 47.56171599
+48 Atom 1 1 1 1
+1 1 1 4.05494039 12.20867417 50.21159129
+49 Atom 1 1 1 1
+1 1 1 2.75550627 13.56919939 46.20660981
+50 Atom 1 1 1 1
+1 1 1 5.38714223 13.61155908 48.89535218
+51 Atom 1 1 1 1
+1 1 1 5.47920157 16.27506718 46.14666101
+52 Atom 1 1 1 1
+1 1 1 2.72175317 16.27207144 48.89304602
+53 Atom 1 1 1 1
+1 1 1 4.10382161 14.94439698 47.48808772
+54 Atom 1 1 1 1
+1 1 1 6.80939717 14.97591030 50.26979835
+55 Atom 1 1 1 1
+1 1 1 6.80692971 17.64491699 47.47949074
+56 Atom 1 1 1 1
+1 1 1 4.08851658 17.63312021 50.19219738
+57 Atom 1 1 1 1
+1 1 1 2.67160818 19.00488587 46.12655241
+58 Atom 1 1 1 1
+1 1 1 5.43145906 19.00615913 48.92456623
+59 Atom 1 1 1 1
+1 1 1 5.40150184 21.74642140 46.15981427
+60 Atom 1 1 1 1
+1 1 1 2.67130140 21.68034457 48.85433395
+61 Atom 1 1 1 1
+1 1 1 4.03602435 20.38324708 47.50950337
+62 Atom 1 1 1 1
+1 1 1 6.80009837 20.32828797 50.21055574
+63 Atom 1 1 1 1
+1 1 1 6.80240680 23.03349356 47.50954711
+64 Atom 1 1 1 1
+1 1 1 4.05381438 23.12060964 50.21988287
+65 Atom 1 1 1 1
+1 1 1 2.75477231 24.48891468 46.13833821
+66 Atom 1 1 1 1
+1 1 1 5.39624343 24.40942258 48.88078083
+67 Atom 1 1 1 1
+1 1 1 5.39431836 27.12153879 46.15230585
+68 Atom 1 1 1 1
+1 1 1 2.67294087 27.11669238 48.83562614
+69 Atom 1 1 1 1
+1 1 1 4.06400673 25.80876475 47.50667507
+70 Atom 1 1 1 1
+1 1 1 6.79508765 25.79977956 50.26152469
+71 Atom 1 1 1 1
+1 1 1 6.74744645 28.48759723 47.54614448
+72 Atom 1 1 1 1
+1 1 1 4.03975924 28.54143183 50.27068490
+73 Atom 1 1 1 1
+1 1 1 2.73567975 29.86815931 46.16603127
+74 Atom 1 1 1 1
+1 1 1 5.42435127 29.83180795 48.87230145
+75 Atom 1 1 1 1
+1 1 1 5.40787815 32.59635294 46.15261164
+76 Atom 1 1 1 1
+1 1 1 2.68418187 32.54025142 48.88271367
+77 Atom 1 1 1 1
+1 1 1 4.04791636 31.17859631 47.52773873
+78 Atom 1 1 1 1
+1 1 1 6.83139636 31.24495934 50.19134797
+79 Atom 1 1 1 1
+1 1 1 6.82074597 33.90176947 47.50939058
+80 Atom 1 1 1 1
+1 1 1 4.11097826 33.91890928 50.23443487
+81 Atom 1 1 1 1
+1 1 1 2.71812474 35.31970099 46.15819850
+82 Atom 1 1 1 1
+1 1 1 5.46661333 35.25193570 48.89234052
+83 Atom 1 1 1 1
+1 1 1 5.42241213 38.03429267 46.12952877
+84 Atom 1 1 1 1
+1 1 1 2.73683060 38.03940474 48.84065459
+85 Atom 1 1 1 1
+1 1 1 4.10077421 36.69164808 47.54577884
+86 Atom 1 1 1 1
+1 1 1 6.74601394 36.63331337 50.21546974
+87 Atom 1 1 1 1
+1 1 1 6.81879090 39.40957354 47.47385623
+88 Atom 1 1 1 1
+1 1 1 4.07832918 39.42286960 50.22782121
+89 Atom 1 1 1 1
+1 1 1 2.74182685 40.77250183 46.18670738
+90 Atom 1 1 1 1
+1 1 1 5.45410575 40.68266505 48.86724664
+91 Atom 1 1 1 1
+1 1 1 5.40015694 43.39809997 46.18592149
+92 Atom 1 1 1 1
+1 1 1 2.72402066 43.47902874 48.84921183
+93 Atom 1 1 1 1
+1 1 1 4.05397583 42.10756527 47.52761579
+94 Atom 1 1 1 1
+1 1 1 6.82343967 42.08159595 50.26019054
+95 Atom 1 1 1 1
+1 1 1 6.74340767 44.79280074 47.52058358
+96 Atom 1 1 1 1
+1 1 1 4.04637859 44.84882376 50.25706396
+97 Atom 1 1 1 1
+1 1 1 2.76496508 46.20408194 46.13551818
+98 Atom 1 1 1 1
+1 1 1 5.46652820 46.18558569 48.83724192
+99 Atom 1 1 1 1
+1 1 1 5.39100526 48.83855549 46.18076838
+100 Atom 1 1 1 1
+1 1 1 2.67796960 48.86072090 48.84803396
+101 Atom 1 1 1 1
+1 1 1 4.03123261 47.49784917 47.48710640
+102 Atom 1 1 1 1
+1 1 1 6.83120384 47.56488440 50.19956850
+103 Atom 1 1 1 1
+1 1 1 6.75867131 50.27980402 47.50485659
+104 Atom 1 1 1 1
+1 1 1 4.05033985 50.26826466 50.22677473
+105 Atom 1 1 1 1
+1 1 1 2.74388273 51.62614969 46.12040860
+106 Atom 1 1 1 1
+1 1 1 5.43688408 51.57819356 48.90059958
+107 Atom 1 1 1 1
+1 1 1 5.43137033 54.30388208 46.19857556
+108 Atom 1 1 1 1
+1 1 1 2.75153133 54.34271006 48.91901188
+109 Atom 1 1 1 1
+1 1 1 4.04394217 52.93559258 47.56247278
+110 Atom 1 1 1 1
+1 1 1 6.79324845 52.90800632 50.28397128
+111 Atom 1 1 1 1
+1 1 1 6.77944185 55.66136256 47.54012436
+112 Atom 1 1 1 1
+1 1 1 4.12241586 55.67372834 50.23502187
+113 Atom 1 1 1 1
+1 1 1 2.68843609 56.98586610 46.12164443
+114 Atom 1 1 1 1
+1 1 1 5.38562668 56.98222934 48.87365714
+115 Atom 1 1 1 1
+1 1 1 5.44213500 59.74294153 46.17525796
+116 Atom 1 1 1 1
+1 1 1 2.67916572 59.78221909 48.91353759
+117 Atom 1 1 1 1
+1 1 1 4.11154419 58.39351897 47.51366130
+118 Atom 1 1 1 1
+1 1 1 6.80724297 58.41847505 50.19288306
+119 Atom 1 1 1 1
+1 1 1 6.74423652 61.05949530 47.48000496
+120 Atom 1 1 1 1
+1 1 1 4.09248991 61.04876135 50.26577368
+121 Atom 1 1 1 1
+1 1 1 2.72642139 62.46546482 46.15400888
+122 Atom 1 1 1 1
+1 1 1 5.40575930 62.41149400 48.90815282
+123 Atom 1 1 1 1
+1 1 1 5.38205279 65.17131449 46.12213972
+124 Atom 1 1 1 1
+1 1 1 2.67850190 65.20456497 48.87374836
+125 Atom 1 1 1 1
+1 1 1 4.05510017 63.83903471 47.48117371
+126 Atom 1 1 1 1
+1 1 1 6.76697201 63.81736475 50.22268365
+127 Atom 1 1 1 1
+1 1 1 6.78600845 66.54092226 47.48667272
+128 Atom 1 1 1 1
+1 1 1 4.09251707 66.50699915 50.23373410
+129 Atom 1 1 1 1
+1 1 1 2.74558992 67.86772841 46.21021724
+130 Atom 1 1 1 1
+1 1 1 5.42359037 67.90254726 48.91705343
+131 Atom 1 1 1 1
+1 1 1 5.46970484 70.55621318 46.13336530
+132 Atom 1 1 1 1
+1 1 1 2.76345107 70.58373137 48.86822332
+133 Atom 1 1 1 1
+1 1 1 4.09184763 69.25755872 47.54211411
+134 Atom 1 1 1 1
+1 1 1 6.81342261 69.25288250 50.21645497
+135 Atom 1 1 1 1
+1 1 1 6.81284513 71.96155772 47.50090452
+136 Atom 1 1 1 1
+1 1 1 4.06025155 71.95020252 50.22642136
+137 Atom 1 1 1 1
+1 1 1 2.73880463 73.34524521 46.12734053
+138 Atom 1 1 1 1
+1 1 1 5.47845630 73.27398816 48.90206161
+139 Atom 1 1 1 1
+1 1 1 5.47494647 76.03365728 46.16428703
+140 Atom 1 1 1 1
+1 1 1 2.70606707 76.02428199 48.91856336
+141 Atom 1 1 1 1
+1 1 1 4.12271887 74.66645655 47.56914604
+142 Atom 1 1 1 1
+1 1 1 6.75545528 74.70469163 50.19318008
+143 Atom 1 1 1 1
+1 1 1 6.82944921 77.37025090 47.47638453
+144 Atom 1 1 1 1
+1 1 1 4.08440165 77.42439586 50.24640827
+145 Atom 1 1 1 1
+1 1 1 2.70811242 78.79744523 46.16071724
+146 Atom 1 1 1 1
+1 1 1 5.40995378 78.72571942 48.87336609
+147 Atom 1 1 1 1
+1 1 1 5.45967205 81.44869526 46.17016724
+148 Atom 1 1 1 1
+1 1 1 2.71350949 81.48311335 48.92210517
+149 Atom 1 1 1 1
+1 1 1 4.06763635 80.15159642 47.49097806
+150 Atom 1 1 1 1
+1 1 1 6.75509412 80.11057504 50.19025266
+151 Atom 1 1 1 1
+1 1 1 6.78842959 82.82865364 47.48859700
+152 Atom 1 1 1 1
+1 1 1 4.04468012 82.80647342 50.26875202
+153 Atom 1 1 1 1
+1 1 1 2.75221498 84.13371687 46.15807727
+154 Atom 1 1 1 1
+1 1 1 5.47987655 84.19682869 48.88270442
+155 Atom 1 1 1 1
+1 1 1 5.43457767 86.85896385 46.14501993
+156 Atom 1 1 1 1
+1 1 1 2.70765282 86.85446379 48.88062063
+157 Atom 1 1 1 1
+1 1 1 4.02533831 85.54883382 47.55274108
+158 Atom 1 1 1 1
+1 1 1 6.77680669 85.56110333 50.27565641
+159 Atom 1 1 1 1
+1 1 1 6.77586711 88.21560576 47.49878197
+160 Atom 1 1 1 1
+1 1 1 4.08462095 88.28775890 50.20666074
+161 Atom 1 1 1 1
+1 1 1 8.19357287 2.66734173 46.20108693
+162 Atom 1 1 1 1
+1 1 1 10.87005898 2.76503825 48.90487016
+163 Atom 1 1 1 1
+1 1 1 10.90076607 5.47320853 46.19400374
+164 Atom 1 1 1 1
+1 1 1 8.11842544 5.42709363 48.88015408
+165 Atom 1 1 1 1
+1 1 1 9.46894958 4.11628921 47.50117597
+166 Atom 1 1 1 1
+1 1 1 12.18380455 4.04940149 50.19822474
+167 Atom 1 1 1 1
+1 1 1 12.18653811 6.83545510 47.50072480
+168 Atom 1 1 1 1
+1 1 1 9.46417001 6.75298553 50.25930403
+169 Atom 1 1 1 1
+1 1 1 8.10719158 8.18210298 46.15574045
+170 Atom 1 1 1 1
+1 1 1 10.83702265 8.10518192 48.89354527
+171 Atom 1 1 1 1
+1 1 1 10.87520982 10.83877687 46.13087668
+172 Atom 1 1 1 1
+1 1 1 8.10275045 10.83032636 48.87609244
+173 Atom 1 1 1 1
+1 1 1 9.45607757 9.46210942 47.54502907
+174 Atom 1 1 1 1
+1 1 1 12.21185437 9.55127704 50.21265661
+175 Atom 1 1 1 1
+1 1 1 12.23304942 12.18582229 47.52994441
+176 Atom 1 1 1 1
+1 1 1 9.47765921 12.19632773 50.28672339
+177 Atom 1 1 1 1
+1 1 1 8.09739122 13.59980733 46.14485289
+178 Atom 1 1 1 1
+1 1 1 10.88622248 13.58767453 48.84454327
+179 Atom 1 1 1 1
+1 1 1 10.83659627 16.33718461 46.21080072
+180 Atom 1 1 1 1
+1 1 1 8.11021945 16.30637055 48.87083410
+181 Atom 1 1 1 1
+1 1 1 9.48169258 14.96652296 47.48479926
+182 Atom 1 1 1 1
+1 1 1 12.23859175 14.89185329 50.20251231
+183 Atom 1 1 1 1
+1 1 1 12.17217609 17.61251620 47.57047561
+184 Atom 1 1 1 1
+1 1 1 9.52973400 17.69458651 50.27242660
+185 Atom 1 1 1 1
+1 1 1 8.10187932 19.04326830 46.14660857
+186 Atom 1 1 1 1
+1 1 1 10.82752856 19.03660960 48.83807309
+187 Atom 1 1 1 1
+1 1 1 10.84744649 21.74619643 46.17720146
+188 Atom 1 1 1 1
+1 1 1 8.17427156 21.75678615 48.89515230
+189 Atom 1 1 1 1
+1 1 1 9.45459357 20.36839936 47.50717253
+190 Atom 1 1 1 1
+1 1 1 12.22935817 20.37898551 50.22651052
+191 Atom 1 1 1 1
+1 1 1 12.25510500 23.04845714 47.48962286
+192 Atom 1 1 1 1
+1 1 1 9.51680685 23.12678903 50.20324581
+193 Atom 1 1 1 1
+1 1 1 8.16250021 24.46596457 46.14770134
+194 Atom 1 1 1 1
+1 1 1 10.89879515 24.45176143 48.88207717
+195 Atom 1 1 1 1
+1 1 1 10.82652124 27.15456796 46.15983769
+196 Atom 1 1 1 1
+1 1 1 8.19366957 27.16094367 48.90011053
+197 Atom 1 1 1 1
+1 1 1 9.53397840 25.83730396 47.49088048
+198 Atom 1 1 1 1
+1 1 1 12.19069604 25.82704135 50.21337880
+199 Atom 1 1 1 1
+1 1 1 12.18822563 28.46769061 47.52179097
+200 Atom 1 1 1 1
+1 1 1 9.50612572 28.48251489 50.28099036
+201 Atom 1 1 1 1
+1 1 1 8.10954787 29.85069296 46.13077517
+202 Atom 1 1 1 1
+1 1 1 10.84778619 29.91067516 48.91998957
+203 Atom 1 1 1 1
+1 1 1 10.82441528 32.56627070 46.11610071
+204 Atom 1 1 1 1
+1 1 1 8.15993960 32.59669958 48.90243746
+205 Atom 1 1 1 1
+1 1 1 9.50078317 31.19389914 47.49977696
+206 Atom 1 1 1 1
+1 1 1 12.26421704 31.21126357 50.26168268
+207 Atom 1 1 1 1
+1 1 1 12.23970458 33.97534489 47.52448856
+208 Atom 1 1 1 1
+1 1 1 9.49088336 33.97616124 50.21761794
+209 Atom 1 1 1 1
+1 1 1 8.18624044 35.31235580 46.14257843
+210 Atom 1 1 1 1
+1 1 1 10.82516920 35.29926657 48.85968320
+211 Atom 1 1 1 1
+1 1 1 10.83392363 37.97399350 46.12284149
+212 Atom 1 1 1 1
+1 1 1 8.18863746 38.06446686 48.90040146
+213 Atom 1 1 1 1
+1 1 1 9.48560374 36.61300873 47.55402024
+214 Atom 1 1 1 1
+1 1 1 12.21203328 36.69660349 50.23396532
+215 Atom 1 1 1 1
+1 1 1 12.22164370 39.34104139 47.54152624
+216 Atom 1 1 1 1
+1 1 1 9.49786550 39.32524982 50.23083018
+217 Atom 1 1 1 1
+1 1 1 8.19542404 40.70368795 46.16514739
+218 Atom 1 1 1 1
+1 1 1 10.87118503 40.75275905 48.84228748
+219 Atom 1 1 1 1
+1 1 1 10.90808940 43.42371680 46.19716896
+220 Atom 1 1 1 1
+1 1 1 8.14865597 43.46549335 48.84164564
+221 Atom 1 1 1 1
+1 1 1 9.49408050 42.06941830 47.48888557
+222 Atom 1 1 1 1
+1 1 1 12.17464022 42.07385474 50.26011878
+223 Atom 1 1 1 1
+1 1 1 12.17157748 44.81686483 47.54146375
+224 Atom 1 1 1 1
+1 1 1 9.46342101 44.83778540 50.25461797
+225 Atom 1 1 1 1
+1 1 1 8.16473254 46.20308119 46.17446236
+226 Atom 1 1 1 1
+1 1 1 10.82859826 46.17079945 48.86931194
+227 Atom 1 1 1 1
+1 1 1 10.84596318 48.90519621 46.11405110
+228 Atom 1 1 1 1
+1 1 1 8.17031377 48.83006822 48.86397626
+229 Atom 1 1 1 1
+1 1 1 9.45987278 47.51365726 47.49462190
+230 Atom 1 1 1 1
+1 1 1 12.23603183 47.51363902 50.25838189
+231 Atom 1 1 1 1
+1 1 1 12.18817162 50.19786484 47.49300781
+232 Atom 1 1 1 1
+1 1 1 9.51230137 50.23925580 50.28096117
+233 Atom 1 1 1 1
+1 1 1 8.10947916 51.63201729 46.19812328
+234 Atom 1 1 1 1
+1 1 1 10.89791250 51.54940345 48.89499042
+235 Atom 1 1 1 1
+1 1 1 10.81728439 54.35370874 46.12829169
+236 Atom 1 1 1 1
+1 1 1 8.13855716 54.29470528 48.83833545
+237 Atom 1 1 1 1
+1 1 1 9.50189119 52.96037189 47.48529526
+238 Atom 1 1 1 1
+1 1 1 12.17958571 52.90667371 50.21956007
+239 Atom 1 1 1 1
+1 1 1 12.25895045 55.63411000 47.51977964
+240 Atom 1 1 1 1
+1 1 1 9.50624610 55.65844197 50.27804365
+241 Atom 1 1 1 1
+1 1 1 8.13199519 57.00904944 46.21211287
+242 Atom 1 1 1 1
+1 1 1 10.82030073 57.04999135 48.89188723
+243 Atom 1 1 1 1
+1 1 1 10.87394926 59.74283071 46.15500622
+244 Atom 1 1 1 1
+1 1 1 8.12057096 59.75061627 48.86702876
+245 Atom 1 1 1 1
+1 1 1 9.51869894 58.40814043 47.53251714
+246 Atom 1 1 1 1
+1 1 1 12.22474073 58.34065082 50.23079628
+247 Atom 1 1 1 1
+1 1 1 12.21254340 61.07863475 47.50839562
+248 Atom 1 1 1 1
+1 1 1 9.49392174 61.10834157 50.25654498
+249 Atom 1 1 1 1
+1 1 1 8.16811528 62.47228709 46.11755177
+250 Atom 1 1 1 1
+1 1 1 10.89867303 62.48190516 48.85063115
+251 Atom 1 1 1 1
+1 1 1 10.90338293 65.20663206 46.13125468
+252 Atom 1 1 1 1
+1 1 1 8.10459957 65.12861247 48.91260451
+253 Atom 1 1 1 1
+1 1 1 9.45944277 63.84320731 47.51394084
+254 Atom 1 1 1 1
+1 1 1 12.21611170 63.79366400 50.25417324
+255 Atom 1 1 1 1
+1 1 1 12.26836641 66.53881732 47.51517484
+256 Atom 1 1 1 1
+1 1 1 9.50360551 66.53312709 50.23981032
+257 Atom 1 1 1 1
+1 1 1 8.12822439 67.90977672 46.16142072
+258 Atom 1 1 1 1
+1 1 1 10.84389757 67.88682524 48.90126233
+259 Atom 1 1 1 1
+1 1 1 10.87951650 70.59853961 46.21342103
+260 Atom 1 1 1 1
+1 1 1 8.10552231 70.60105446 48.86301603
+261 Atom 1 1 1 1
+1 1 1 9.55057827 69.28764209 47.51777185
+262 Atom 1 1 1 1
+1 1 1 12.26764603 69.27941473 50.22953891
+263 Atom 1 1 1 1
+1 1 1 12.23257598 71.99170974 47.49501621
+264 Atom 1 1 1 1
+1 1 1 9.51753429 71.92418207 50.26249013
+265 Atom 1 1 1 1
+1 1 1 8.16783115 73.30280734 46.17387734
+266 Atom 1 1 1 1
+1 1 1 10.87455137 73.32290334 48.87811531
+267 Atom 1 1 1 1
+1 1 1 10.83115647 76.08016133 46.19714951
+268 Atom 1 1 1 1
+1 1 1 8.15157187 76.00321024 48.83891237
+269 Atom 1 1 1 1
+1 1 1 9.53972557 74.72134305 47.53449477
+270 Atom 1 1 1 1
+1 1 1 12.17247187 74.66087492 50.23989077
+271 Atom 1 1 1 1
+1 1 1 12.19304514 77.34763472 47.53782406
+272 Atom 1 1 1 1
+1 1 1 9.54422954 77.35813980 50.22792193
+273 Atom 1 1 1 1
+1 1 1 8.18982406 78.71153575 46.13895293
+274 Atom 1 1 1 1
+1 1 1 10.81632233 78.79555037 48.86139435
+275 Atom 1 1 1 1
+1 1 1 10.82190645 81.45578464 46.15408718
+276 Atom 1 1 1 1
+1 1 1 8.18647466 81.43339721 48.86422538
+277 Atom 1 1 1 1
+1 1 1 9.47367904 80.12320895 47.48546665
+278 Atom 1 1 1 1
+1 1 1 12.22241857 80.10498949 50.27614949
+279 Atom 1 1 1 1
+1 1 1 12.24935735 82.81554030 47.47463349
+280 Atom 1 1 1 1
+1 1 1 9.52071537 82.80096111 50.27115484
+281 Atom 1 1 1 1
+1 1 1 8.13131028 84.14706917 46.16444653
+282 Atom 1 1 1 1
+1 1 1 10.91155985 84.21640850 48.91946680
+283 Atom 1 1 1 1
+1 1 1 10.87814227 86.85546902 46.14987088
+284 Atom 1 1 1 1
+1 1 1 8.17968183 86.86247439 48.89650604
+285 Atom 1 1 1 1
+1 1 1 9.54741534 85.53972423 47.51294064
+286 Atom 1 1 1 1
+1 1 1 12.17936102 85.56696154 50.21582940
+287 Atom 1 1 1 1
+1 1 1 12.18188607 88.23646211 47.50496696
+288 Atom 1 1 1 1
+1 1 1 9.46191497 88.29536845 50.28324099
+289 Atom 1 1 1 1
+1 1 1 13.56448395 2.75124361 46.15021174
+290 Atom 1 1 1 1
+1 1 1 16.28070360 2.67818342 48.91686149
+291 Atom 1 1 1 1
+1 1 1 16.24473467 5.40557646 46.17544185
+292 Atom 1 1 1 1
+1 1 1 13.57803316 5.46098339 48.90030673
+293 Atom 1 1 1 1
+1 1 1 14.92411709 4.11876572 47.53406019
+294 Atom 1 1 1 1
+1 1 1 17.64962550 4.09273298 50.22043645
+295 Atom 1 1 1 1
+1 1 1 17.61759862 6.81432578 47.49883862
+296 Atom 1 1 1 1
+1 1 1 14.97201610 6.74463760 50.21570644
+297 Atom 1 1 1 1
+1 1 1 13.60403683 8.11053348 46.13785718
+298 Atom 1 1 1 1
+1 1 1 16.31972896 8.14901832 48.90895359
+299 Atom 1 1 1 1
+1 1 1 16.32852520 10.86206845 46.12632127
+300 Atom 1 1 1 1
+1 1 1 13.59703365 10.84263324 48.90417926
+301 Atom 1 1 1 1
+1 1 1 14.89495563 9.50878478 47.49955136
+302 Atom 1 1 1 1
+1 1 1 17.60137551 9.46877439 50.23568126
+303 Atom 1 1 1 1
+1 1 1 17.60694694 12.26751499 47.56428508
+304 Atom 1 1 1 1
+1 1 1 14.90014362 12.17659731 50.19045735
+305 Atom 1 1 1 1
+1 1 1 13.61427979 13.54417129 46.17101462
+306 Atom 1 1 1 1
+1 1 1 16.27164128 13.56816406 48.92706579
+307 Atom 1 1 1 1
+1 1 1 16.31621862 16.32626812 46.17503073
+308 Atom 1 1 1 1
+1 1 1 13.58998017 16.28210039 48.91747388
+309 Atom 1 1 1 1
+1 1 1 14.95494547 14.94543882 47.48044928
+310 Atom 1 1 1 1
+1 1 1 17.68150214 14.96890602 50.24599092
+311 Atom 1 1 1 1
+1 1 1 17.63155088 17.65506633 47.49582761
+312 Atom 1 1 1 1
+1 1 1 14.95699878 17.65928929 50.24053760
+313 Atom 1 1 1 1
+1 1 1 13.57828160 18.96964248 46.20623194
+314 Atom 1 1 1 1
+1 1 1 16.25295451 18.99531091 48.86381515
+315 Atom 1 1 1 1
+1 1 1 16.30067858 21.75110507 46.13881972
+316 Atom 1 1 1 1
+1 1 1 13.56133383 21.73243271 48.90738416
+317 Atom 1 1 1 1
+1 1 1 14.93756139 20.40892693 47.52039432
+318 Atom 1 1 1 1
+1 1 1 17.64518491 20.36607911 50.20792388
+319 Atom 1 1 1 1
+1 1 1 17.60602586 23.09015213 47.55011238
+320 Atom 1 1 1 1
+1 1 1 14.93619822 23.06966025 50.22720166
+321 Atom 1 1 1 1
+1 1 1 13.54336832 24.40269401 46.19635942
+322 Atom 1 1 1 1
+1 1 1 16.24842702 24.41416700 48.86200684
+323 Atom 1 1 1 1
+1 1 1 16.32058669 27.18816319 46.19974117
+324 Atom 1 1 1 1
+1 1 1 13.59708831 27.18782925 48.88517919
+325 Atom 1 1 1 1
+1 1 1 14.96967735 25.79119171 47.52060205
+326 Atom 1 1 1 1
+1 1 1 17.69528673 25.78481561 50.22709218
+327 Atom 1 1 1 1
+1 1 1 17.61124846 28.52898711 47.56058040
+328 Atom 1 1 1 1
+1 1 1 14.92365232 28.53926400 50.26374794
+329 Atom 1 1 1 1
+1 1 1 13.60573482 29.85491639 46.11761966
+330 Atom 1 1 1 1
+1 1 1 16.31466957 29.88175998 48.90494363
+331 Atom 1 1 1 1
+1 1 1 16.24708714 32.61831578 46.11530060
+332 Atom 1 1 1 1
+1 1 1 13.57017692 32.58035081 48.87100434
+333 Atom 1 1 1 1
+1 1 1 14.93884135 31.25024457 47.55171515
+334 Atom 1 1 1 1
+1 1 1 17.70067051 31.20694174 50.22763345
+335 Atom 1 1 1 1
+1 1 1 17.64747415 33.95754127 47.56148563
+336 Atom 1 1 1 1
+1 1 1 14.96578594 33.95742692 50.20419574
+337 Atom 1 1 1 1
+1 1 1 13.53875486 35.34338813 46.19438287
+338 Atom 1 1 1 1
+1 1 1 16.28157629 35.31615752 48.85688459
+339 Atom 1 1 1 1
+1 1 1 16.31993998 38.01088057 46.20352950
+340 Atom 1 1 1 1
+1 1 1 13.62105086 38.03759760 48.87606604
+341 Atom 1 1 1 1
+1 1 1 14.96645266 36.70697652 47.50719297
+342 Atom 1 1 1 1
+1 1 1 17.64064214 36.62894297 50.26664562
+343 Atom 1 1 1 1
+1 1 1 17.62276675 39.40211477 47.56579597
+344 Atom 1 1 1 1
+1 1 1 14.94818648 39.33932314 50.24213427
+345 Atom 1 1 1 1
+1 1 1 13.54042822 40.72328157 46.12869351
+346 Atom 1 1 1 1
+1 1 1 16.28564090 40.75292073 48.85315443
+347 Atom 1 1 1 1
+1 1 1 16.28101780 43.41388887 46.13343563
+348 Atom 1 1 1 1
+1 1 1 13.62668224 43.48722513 48.90449880
+349 Atom 1 1 1 1
+1 1 1 14.90063676 42.10047866 47.52841231
+350 Atom 1 1 1 1
+1 1 1 17.66157227 42.13460123 50.19867343
+351 Atom 1 1 1 1
+1 1 1 17.63045317 44.80311184 47.48869116
+352 Atom 1 1 1 1
+1 1 1 14.95400349 44.78436503 50.18760008
+353 Atom 1 1 1 1
+1 1 1 13.54943972 46.16631010 46.20327702
+354 Atom 1 1 1 1
+1 1 1 16.30076705 46.15703990 48.91228717
+355 Atom 1 1 1 1
+1 1 1 16.32448250 48.86388616 46.18600310
+356 Atom 1 1 1 1
+1 1 1 13.61737074 48.89182099 48.92247797
+357 Atom 1 1 1 1
+1 1 1 14.93925327 47.54057325 47.52129469
+358 Atom 1 1 1 1
+1 1 1 17.67226627 47.48732183 50.20679602
+359 Atom 1 1 1 1
+1 1 1 17.63092427 50.22806530 47.52064345
+360 Atom 1 1 1 1
+1 1 1 14.98374814 50.24773279 50.26427982
+361 Atom 1 1 1 1
+1 1 1 13.59525010 51.58718178 46.17951889
+362 Atom 1 1 1 1
+1 1 1 16.32586775 51.56546534 48.85563356
+363 Atom 1 1 1 1
+1 1 1 16.32088766 54.29251470 46.12821183
+364 Atom 1 1 1 1
+1 1 1 13.57905220 54.35164317 48.83487146
+365 Atom 1 1 1 1
+1 1 1 14.97504064 52.96209267 47.51300038
+366 Atom 1 1 1 1
+1 1 1 17.66304721 52.90409693 50.22807667
+367 Atom 1 1 1 1
+1 1 1 17.65146219 55.67877790 47.56300593
+368 Atom 1 1 1 1
+1 1 1 14.97804556 55.70753146 50.21904460
+369 Atom 1 1 1 1
+1 1 1 13.61525293 57.00195241 46.12199760
+370 Atom 1 1 1 1
+1 1 1 16.33877919 57.02845716 48.84055146
+371 Atom 1 1 1 1
+1 1 1 16.32843646 59.69718824 46.18937526
+372 Atom 1 1 1 1
+1 1 1 13.56611512 59.76347242 48.84575867
+373 Atom 1 1 1 1
+1 1 1 14.95681308 58.42895737 47.49780276
+374 Atom 1 1 1 1
+1 1 1 17.61523664 58.38573632 50.23457554
+375 Atom 1 1 1 1
+1 1 1 17.66678187 61.07578083 47.53611445
+376 Atom 1 1 1 1
+1 1 1 14.97888352 61.04925585 50.19816602
+377 Atom 1 1 1 1
+1 1 1 13.62225038 62.44113734 46.15338843
+378 Atom 1 1 1 1
+1 1 1 16.27704811 62.49580730 48.91091234
+379 Atom 1 1 1 1
+1 1 1 16.27110392 65.19183127 46.12555169
+380 Atom 1 1 1 1
+1 1 1 13.57421094 65.19638958 48.88010012
+381 Atom 1 1 1 1
+1 1 1 14.93817761 63.80977322 47.53758197
+382 Atom 1 1 1 1
+1 1 1 17.60575138 63.76925158 50.24643077
+383 Atom 1 1 1 1
+1 1 1 17.64672760 66.52731514 47.55464475
+384 Atom 1 1 1 1
+1 1 1 14.93172367 66.53300254 50.26773530
+385 Atom 1 1 1 1
+1 1 1 13.55975353 67.90776898 46.14452839
+386 Atom 1 1 1 1
+1 1 1 16.34195082 67.91882995 48.87613084
+387 Atom 1 1 1 1
+1 1 1 16.31120982 70.57908720 46.12233050
+388 Atom 1 1 1 1
+1 1 1 13.56460034 70.63017391 48.92490573
+389 Atom 1 1 1 1
+1 1 1 14.91857793 69.22496395 47.56960916
+390 Atom 1 1 1 1
+1 1 1 17.69700959 69.26155428 50.20386484
+391 Atom 1 1 1 1
+1 1 1 17.67733285 71.96814740 47.48504679
+392 Atom 1 1 1 1
+1 1 1 14.89948104 71.99773661 50.22297957
+393 Atom 1 1 1 1
+1 1 1 13.58436254 73.34308009 46.18425008
+394 Atom 1 1 1 1
+1 1 1 16.28695741 73.29696765 48.85097314
+395 Atom 1 1 1 1
+1 1 1 16.27895642 76.05421726 46.20849459
+396 Atom 1 1 1 1
+1 1 1 13.56455773 76.02576800 48.91249992
+397 Atom 1 1 1 1
+1 1 1 14.97520758 74.63085061 47.51073712
+398 Atom 1 1 1 1
+1 1 1 17.62549296 74.68696850 50.27939088
+399 Atom 1 1 1 1
+1 1 1 17.65873508 77.40529553 47.52783337
+400 Atom 1 1 1 1
+1 1 1 14.91422327 77.41564317 50.24666014
+401 Atom 1 1 1 1
+1 1 1 13.53609196 78.76192973 46.13073047
+402 Atom 1 1 1 1
+1 1 1 16.32195422 78.77243497 48.92010698
+403 Atom 1 1 1 1
+1 1 1 16.30645338 81.42014230 46.20043303
+404 Atom 1 1 1 1
+1 1 1 13.60194986 81.49946688 48.87079829
+405 Atom 1 1 1 1
+1 1 1 14.94751713 80.10985425 47.56692657
+406 Atom 1 1 1 1
+1 1 1 17.66566517 80.10164552 50.19333573
+407 Atom 1 1 1 1
+1 1 1 17.61759672 82.80004250 47.51700063
+408 Atom 1 1 1 1
+1 1 1 14.97439037 82.84316367 50.19705280
+409 Atom 1 1 1 1
+1 1 1 13.62731589 84.15317697 46.13210639
+410 Atom 1 1 1 1
+1 1 1 16.28107934 84.16568882 48.91127099
+411 Atom 1 1 1 1
+1 1 1 16.31768478 86.88065296 46.13130490
+412 Atom 1 1 1 1
+1 1 1 13.57465686 86.87029824 48.83435748
+413 Atom 1 1 1 1
+1 1 1 14.97284113 85.52938018 47.55985222
+414 Atom 1 1 1 1
+1 1 1 17.67345210 85.53117188 50.25145908
+415 Atom 1 1 1 1
+1 1 1 17.68272468 88.28431979 47.55256479
+416 Atom 1 1 1 1
+1 1 1 14.92922773 88.26679079 50.26460478
+417 Atom 1 1 1 1
+1 1 1 19.02231455 2.72422323 46.12693277
+418 Atom 1 1 1 1
+1 1 1 21.75137808 2.68653182 48.87636559
+419 Atom 1 1 1 1
+1 1 1 21.69170093 5.45172713 46.16380864
+420 Atom 1 1 1 1
+1 1 1 19.03554947 5.44649969 48.85082131
+421 Atom 1 1 1 1
+1 1 1 20.34536995 4.06556180 47.47331233
+422 Atom 1 1 1 1
+1 1 1 23.03662887 4.03740726 50.22968757
+423 Atom 1 1 1 1
+1 1 1 23.12033526 6.74896819 47.47834727
+424 Atom 1 1 1 1
+1 1 1 20.35654407 6.79181541 50.19100022
+425 Atom 1 1 1 1
+1 1 1 19.01303581 8.14459712 46.13300675
+426 Atom 1 1 1 1
+1 1 1 21.69532966 8.14345269 48.90674792
+427 Atom 1 1 1 1
+1 1 1 21.74103733 10.88663268 46.18169680
+428 Atom 1 1 1 1
+1 1 1 18.96390455 10.89257135 48.83290569
+429 Atom 1 1 1 1
+1 1 1 20.33286138 9.50533790 47.47642256
+430 Atom 1 1 1 1
+1 1 1 23.10793555 9.51533316 50.28417873
+431 Atom 1 1 1 1
+1 1 1 23.11362272 12.23888331 47.50365357
+432 Atom 1 1 1 1
+1 1 1 20.34564573 12.26624021 50.23985965
+433 Atom 1 1 1 1
+1 1 1 19.05815750 13.54944594 46.19159189
+434 Atom 1 1 1 1
+1 1 1 21.76348139 13.53349551 48.89040401
+435 Atom 1 1 1 1
+1 1 1 21.73096856 16.30255712 46.18245563
+436 Atom 1 1 1 1
+1 1 1 18.98202462 16.33317631 48.91328886
+437 Atom 1 1 1 1
+1 1 1 20.32431799 14.94157012 47.55458543
+438 Atom 1 1 1 1
+1 1 1 23.12193130 14.91021054 50.20296474
+439 Atom 1 1 1 1
+1 1 1 23.10063536 17.66611697 47.51509294
+440 Atom 1 1 1 1
+1 1 1 20.40665200 17.61143257 50.27292046
+441 Atom 1 1 1 1
+1 1 1 19.05728349 18.96461228 46.21014342
+442 Atom 1 1 1 1
+1 1 1 21.76693128 19.03400575 48.90609036
+443 Atom 1 1 1 1
+1 1 1 21.76531716 21.75160251 46.11714367
+444 Atom 1 1 1 1
+1 1 1 19.03867601 21.72090828 48.86532884
+445 Atom 1 1 1 1
+1 1 1 20.33428379 20.38432632 47.54528359
+446 Atom 1 1 1 1
+1 1 1 23.12850371 20.40391925 50.19351883
+447 Atom 1 1 1 1
+1 1 1 23.03804074 23.11604314 47.51271325
+448 Atom 1 1 1 1
+1 1 1 20.33489131 23.08343392 50.19304340
+449 Atom 1 1 1 1
+1 1 1 18.99554695 24.45629318 46.15133126
+450 Atom 1 1 1 1
+1 1 1 21.70842300 24.47074571 48.92675801
+451 Atom 1 1 1 1
+1 1 1 21.75669372 27.13930598 46.15870725
+452 Atom 1 1 1 1
+1 1 1 19.04940909 27.16313796 48.83093997
+453 Atom 1 1 1 1
+1 1 1 20.34690258 25.79302719 47.51429714
+454 Atom 1 1 1 1
+1 1 1 23.11226176 25.81797338 50.25988197
+455 Atom 1 1 1 1
+1 1 1 23.08692161 28.52794310 47.47637603
+456 Atom 1 1 1 1
+1 1 1 20.35088820 28.46553686 50.26773277
+457 Atom 1 1 1 1
+1 1 1 18.96516739 29.84365357 46.12731406
+458 Atom 1 1 1 1
+1 1 1 21.70287447 29.91459626 48.90139938
+459 Atom 1 1 1 1
+1 1 1 21.74090282 32.61679176 46.12843334
+460 Atom 1 1 1 1
+1 1 1 18.97936465 32.61119650 48.90574081
+461 Atom 1 1 1 1
+1 1 1 20.38094835 31.21448004 47.48443038
+462 Atom 1 1 1 1
+1 1 1 23.09028247 31.24124443 50.18950998
+463 Atom 1 1 1 1
+1 1 1 23.12689069 33.95541785 47.48282264
+464 Atom 1 1 1 1
+1 1 1 20.36218366 33.97922957 50.21132766
+465 Atom 1 1 1 1
+1 1 1 19.02743295 35.25660920 46.12113479
+466 Atom 1 1 1 1
+1 1 1 21.71088147 35.26928614 48.90673312
+467 Atom 1 1 1 1
+1 1 1 21.72122250 37.98520991 46.20524454
+468 Atom 1 1 1 1
+1 1 1 19.03089791 37.98339831 48.85324354
+469 Atom 1 1 1 1
+1 1 1 20.41142022 36.62672556 47.47609231
+470 Atom 1 1 1 1
+1 1 1 23.07060058 36.69694936 50.26390409
+471 Atom 1 1 1 1
+1 1 1 23.03191687 39.34234662 47.51934686
+472 Atom 1 1 1 1
+1 1 1 20.37111685 39.39024435 50.20991641
+473 Atom 1 1 1 1
+1 1 1 19.02245496 40.70401441 46.13248941
+474 Atom 1 1 1 1
+1 1 1 21.69097460 40.77830607 48.89844820
+475 Atom 1 1 1 1
+1 1 1 21.70803058 43.47421473 46.17048075
+476 Atom 1 1 1 1
+1 1 1 19.00585024 43.40160616 48.89256803
+477 Atom 1 1 1 1
+1 1 1 20.34570189 42.08595074 47.50914439
+478 Atom 1 1 1 1
+1 1 1 23.05309310 42.10635927 50.25490904
+479 Atom 1 1 1 1
+1 1 1 23.10626410 44.81260164 47.54688210
+480 Atom 1 1 1 1
+1 1 1 20.33073306 44.77022636 50.18935225
+481 Atom 1 1 1 1
+1 1 1 19.04433882 46.20945439 46.15287890
+482 Atom 1 1 1 1
+1 1 1 21.68770757 46.14930991 48.89004752
+483 Atom 1 1 1 1
+1 1 1 21.72233760 48.88859712 46.11525860
+484 Atom 1 1 1 1
+1 1 1 19.02429268 48.83074715 48.92535825
+485 Atom 1 1 1 1
+1 1 1 20.39465882 47.49961832 47.48505425
+486 Atom 1 1 1 1
+1 1 1 23.12473559 47.48734055 50.21946613
+487 Atom 1 1 1 1
+1 1 1 23.05189912 50.27587999 47.56543563
+488 Atom 1 1 1 1
+1 1 1 20.38067631 50.25441249 50.23021062
+489 Atom 1 1 1 1
+1 1 1 19.01301737 51.56474866 46.20171637
+490 Atom 1 1 1 1
+1 1 1 21.76106782 51.59198195 48.88819855
+491 Atom 1 1 1 1
+1 1 1 21.72012259 54.34795165 46.13976555
+492 Atom 1 1 1 1
+1 1 1 18.96349214 54.27700775 48.92285676
+493 Atom 1 1 1 1
+1 1 1 20.38156804 52.90655849 47.48067846
+494 Atom 1 1 1 1
+1 1 1 23.04991592 52.96881668 50.26779603
+495 Atom 1 1 1 1
+1 1 1 23.10168929 55.70465069 47.53206070
+496 Atom 1 1 1 1
+1 1 1 20.37163182 55.67765443 50.27521187
+497 Atom 1 1 1 1
+1 1 1 19.00490636 57.00886503 46.15387931
+498 Atom 1 1 1 1
+1 1 1 21.71239053 57.05615950 48.92422057
+499 Atom 1 1 1 1
+1 1 1 21.76642354 59.71916563 46.15178279
+500 Atom 1 1 1 1
+1 1 1 19.04271611 59.72342581 48.88108582
+501 Atom 1 1 1 1
+1 1 1 20.34931951 58.33921650 47.49128307
+502 Atom 1 1 1 1
+1 1 1 23.12254099 58.42025868 50.18742156
+503 Atom 1 1 1 1
+1 1 1 23.08374973 61.14575691 47.51240558
+504 Atom 1 1 1 1
+1 1 1 20.34087925 61.08918634 50.21566989
+505 Atom 1 1 1 1
+1 1 1 19.05641992 62.41681876 46.15573229
+506 Atom 1 1 1 1
+1 1 1 21.74443401 62.47093812 48.89851102
+507 Atom 1 1 1 1
+1 1 1 21.71866356 65.14014873 46.12594761
+508 Atom 1 1 1 1
+1 1 1 18.97073989 65.12506257 48.84694664
+509 Atom 1 1 1 1
+1 1 1 20.38742979 63.79575067 47.52754839
+510 Atom 1 1 1 1
+1 1 1 23.05440790 63.76520328 50.22505884
+511 Atom 1 1 1 1
+1 1 1 23.06197561 66.54782755 47.53772161
+512 Atom 1 1 1 1
+1 1 1 20.37123181 66.48157818 50.26535961
+513 Atom 1 1 1 1
+1 1 1 19.02609660 67.86651523 46.11475590
+514 Atom 1 1 1 1
+1 1 1 21.75077638 67.86747969 48.92457009
+515 Atom 1 1 1 1
+1 1 1 21.71728192 70.56487678 46.16749905
+516 Atom 1 1 1 1
+1 1 1 18.96443200 70.63810879 48.88540073
+517 Atom 1 1 1 1
+1 1 1 20.37612482 69.28050102 47.47275437
+518 Atom 1 1 1 1
+1 1 1 23.12165030 69.22987805 50.23007446
+519 Atom 1 1 1 1
+1 1 1 23.06245909 71.94151426 47.56238910
+520 Atom 1 1 1 1
+1 1 1 20.37185600 71.92126441 50.21548407
+521 Atom 1 1 1 1
+1 1 1 18.97541250 73.34414017 46.13051550
+522 Atom 1 1 1 1
+1 1 1 21.75760127 73.32616165 48.86287709
+523 Atom 1 1 1 1
+1 1 1 21.75790604 76.06591386 46.13561734
+524 Atom 1 1 1 1
+1 1 1 19.01042538 76.07895914 48.82969346
+525 Atom 1 1 1 1
+1 1 1 20.31830045 74.68088242 47.54982610
+526 Atom 1 1 1 1
+1 1 1 23.08502827 74.70144550 50.23206082
+527 Atom 1 1 1 1
+1 1 1 23.03663789 77.36928374 47.50349414
+528 Atom 1 1 1 1
+1 1 1 20.33297708 77.34549182 50.25469363
+529 Atom 1 1 1 1
+1 1 1 18.97591820 78.73528302 46.19419161
+530 Atom 1 1 1 1
+1 1 1 21.68393162 78.78799838 48.92082896
+531 Atom 1 1 1 1
+1 1 1 21.68605711 81.46191258 46.16910616
+532 Atom 1 1 1 1
+1 1 1 19.04320829 81.44457578 48.83297116
+533 Atom 1 1 1 1
+1 1 1 20.36641436 80.07555519 47.51736070
+534 Atom 1 1 1 1
+1 1 1 23.10597459 80.14280308 50.22081112
+535 Atom 1 1 1 1
+1 1 1 23.06185104 82.85679637 47.54581117
+536 Atom 1 1 1 1
+1 1 1 20.38751207 82.81049032 50.23294776
+537 Atom 1 1 1 1
+1 1 1 19.02583098 84.13961273 46.15291480
+538 Atom 1 1 1 1
+1 1 1 21.73488498 84.22027348 48.86255428
+539 Atom 1 1 1 1
+1 1 1 21.77399532 86.90041224 46.14878170
+540 Atom 1 1 1 1
+1 1 1 18.96934500 86.89626266 48.89323851
+541 Atom 1 1 1 1
+1 1 1 20.37745439 85.51976350 47.48595573
+542 Atom 1 1 1 1
+1 1 1 23.12676680 85.58788600 50.21971465
+543 Atom 1 1 1 1
+1 1 1 23.09363833 88.26750543 47.49825782
+544 Atom 1 1 1 1
+1 1 1 20.34443118 88.21100393 50.24414275
+545 Atom 1 1 1 1
+1 1 1 24.40364862 2.71916715 46.15591500
+546 Atom 1 1 1 1
+1 1 1 27.12269964 2.73199129 48.91900923
+547 Atom 1 1 1 1
+1 1 1 27.16612675 5.44959743 46.20366203
+548 Atom 1 1 1 1
+1 1 1 24.41644054 5.46915825 48.85792891
+549 Atom 1 1 1 1
+1 1 1 25.79859217 4.09107602 47.54188358
+550 Atom 1 1 1 1
+1 1 1 28.55233793 4.03689399 50.23905572
+551 Atom 1 1 1 1
+1 1 1 28.52752227 6.77462708 47.53511463
+552 Atom 1 1 1 1
+1 1 1 25.83635145 6.82983634 50.22370554
+553 Atom 1 1 1 1
+1 1 1 24.47873130 8.16591847 46.14813554
+554 Atom 1 1 1 1
+1 1 1 27.11285880 8.15445555 48.86026522
+555 Atom 1 1 1 1
+1 1 1 27.19769429 10.91082521 46.15542904
+556 Atom 1 1 1 1
+1 1 1 24.44892764 10.84481749 48.85028769
+557 Atom 1 1 1 1
+1 1 1 25.79872741 9.55002333 47.55914036
+558 Atom 1 1 1 1
+1 1 1 28.53504362 9.51943406 50.21311763
+559 Atom 1 1 1 1
+1 1 1 28.48402290 12.24842227 47.52567717
+560 Atom 1 1 1 1
+1 1 1 25.81062762 12.24967370 50.21218934
+561 Atom 1 1 1 1
+1 1 1 24.41853914 13.58386017 46.14609907
+562 Atom 1 1 1 1
+1 1 1 27.15757594 13.57020637 48.90865944
+563 Atom 1 1 1 1
+1 1 1 27.18619365 16.27429987 46.16848435
+564 Atom 1 1 1 1
+1 1 1 24.46919948 16.31173936 48.92063660
+565 Atom 1 1 1 1
+1 1 1 25.84218859 14.95676635 47.54965228
+566 Atom 1 1 1 1
+1 1 1 28.48435182 14.92528126 50.23613619
+567 Atom 1 1 1 1
+1 1 1 28.47562273 17.65401539 47.50875884
+568 Atom 1 1 1 1
+1 1 1 25.75567672 17.68899057 50.24195815
+569 Atom 1 1 1 1
+1 1 1 24.45057104 18.97925509 46.15837141
+570 Atom 1 1 1 1
+1 1 1 27.13433992 19.03599511 48.83632428
+571 Atom 1 1 1 1
+1 1 1 27.15661632 21.75776134 46.18244242
+572 Atom 1 1 1 1
+1 1 1 24.40597764 21.71367913 48.85780866
+573 Atom 1 1 1 1
+1 1 1 25.80173522 20.35660498 47.47404509
+574 Atom 1 1 1 1
+1 1 1 28.50638479 20.37134748 50.24956290
+575 Atom 1 1 1 1
+1 1 1 28.48273188 23.04535490 47.49815575
+576 Atom 1 1 1 1
+1 1 1 25.75641647 23.07049928 50.25306310
+577 Atom 1 1 1 1
+1 1 1 24.42121853 24.45244720 46.16695712
+578 Atom 1 1 1 1
+1 1 1 27.13260845 24.45591878 48.90870718
+579 Atom 1 1 1 1
+1 1 1 27.20289408 27.15514671 46.14448828
+580 Atom 1 1 1 1
+1 1 1 24.43658392 27.18718038 48.89433427
+581 Atom 1 1 1 1
+1 1 1 25.79488437 25.75527980 47.55139077
+582 Atom 1 1 1 1
+1 1 1 28.51922146 25.77528608 50.23915400
+583 Atom 1 1 1 1
+1 1 1 28.51880302 28.47911700 47.57083089
+584 Atom 1 1 1 1
+1 1 1 25.82476596 28.49222684 50.21273447
+585 Atom 1 1 1 1
+1 1 1 24.48608634 29.86291950 46.14570592
+586 Atom 1 1 1 1
+1 1 1 27.18709551 29.83672861 48.84386924
+587 Atom 1 1 1 1
+1 1 1 27.15505707 32.54016366 46.19472926
+588 Atom 1 1 1 1
+1 1 1 24.47462770 32.59899129 48.92803775
+589 Atom 1 1 1 1
+1 1 1 25.80547344 31.20934790 47.48114135
+590 Atom 1 1 1 1
+1 1 1 28.50319510 31.21572591 50.23285831
+591 Atom 1 1 1 1
+1 1 1 28.49414658 33.95574791 47.52105262
+592 Atom 1 1 1 1
+1 1 1 25.77074159 33.93710716 50.22697614
+593 Atom 1 1 1 1
+1 1 1 24.41659960 35.30635559 46.11833652
+594 Atom 1 1 1 1
+1 1 1 27.12752510 35.29356870 48.89673163
+595 Atom 1 1 1 1
+1 1 1 27.11600438 38.04230591 46.18003233
+596 Atom 1 1 1 1
+1 1 1 24.48608078 38.01546917 48.85201923
+597 Atom 1 1 1 1
+1 1 1 25.83099717 36.63238601 47.49691701
+598 Atom 1 1 1 1
+1 1 1 28.49227397 36.68383773 50.18714454
+599 Atom 1 1 1 1
+1 1 1 28.49196914 39.39554554 47.55606751
+600 Atom 1 1 1 1
+1 1 1 25.77641983 39.39070461 50.23097077
+601 Atom 1 1 1 1
+1 1 1 24.43446602 40.71745057 46.19759357
+602 Atom 1 1 1 1
+1 1 1 27.13138108 40.74318781 48.90270101
+603 Atom 1 1 1 1
+1 1 1 27.19342776 43.44955419 46.14225672
+604 Atom 1 1 1 1
+1 1 1 24.46654253 43.39911978 48.83385808
+605 Atom 1 1 1 1
+1 1 1 25.75473081 42.06940721 47.55649526
+606 Atom 1 1 1 1
+1 1 1 28.48699577 42.13303528 50.25890898
+607 Atom 1 1 1 1
+1 1 1 28.53221763 44.85325765 47.52084447
+608 Atom 1 1 1 1
+1 1 1 25.84103107 44.76492955 50.21367855
+609 Atom 1 1 1 1
+1 1 1 24.47004568 46.17837158 46.18690602
+610 Atom 1 1 1 1
+1 1 1 27.12310426 46.16580988 48.86071224
+611 Atom 1 1 1 1
+1 1 1 27.11109529 48.90574931 46.14373974
+612 Atom 1 1 1 1
+1 1 1 24.40098679 48.88428594 48.87626137
+613 Atom 1 1 1 1
+1 1 1 25.76115032 47.53864980 47.54867369
+614 Atom 1 1 1 1
+1 1 1 28.55591045 47.53251636 50.25167366
+615 Atom 1 1 1 1
+1 1 1 28.51435465 50.20936043 47.54522198
+616 Atom 1 1 1 1
+1 1 1 25.83014102 50.20892856 50.24241091
+617 Atom 1 1 1 1
+1 1 1 24.41727186 51.64096546 46.15305140
+618 Atom 1 1 1 1
+1 1 1 27.20041653 51.63372465 48.89415488
+619 Atom 1 1 1 1
+1 1 1 27.10751503 54.26072575 46.15843023
+620 Atom 1 1 1 1
+1 1 1 24.44057892 54.33831264 48.89408975
+621 Atom 1 1 1 1
+1 1 1 25.78937027 52.91233045 47.55819840
+622 Atom 1 1 1 1
+1 1 1 28.47544043 52.91286926 50.21618348
+623 Atom 1 1 1 1
+1 1 1 28.48494796 55.71679260 47.48358232
+624 Atom 1 1 1 1
+1 1 1 25.82237535 55.67575032 50.26155996
+625 Atom 1 1 1 1
+1 1 1 24.40856925 57.07308790 46.13675683
+626 Atom 1 1 1 1
+1 1 1 27.20097562 57.07169052 48.82959672
+627 Atom 1 1 1 1
+1 1 1 27.16609338 59.74578948 46.16606555
+628 Atom 1 1 1 1
+1 1 1 24.42473614 59.72864203 48.84425128
+629 Atom 1 1 1 1
+1 1 1 25.76231026 58.41245142 47.48056258
+630 Atom 1 1 1 1
+1 1 1 28.53342735 58.37210316 50.26633563
+631 Atom 1 1 1 1
+1 1 1 28.49680535 61.14830280 47.53591055
+632 Atom 1 1 1 1
+1 1 1 25.78928796 61.05556659 50.21971083
+633 Atom 1 1 1 1
+1 1 1 24.39798699 62.48966875 46.20123025
+634 Atom 1 1 1 1
+1 1 1 27.20135000 62.50132886 48.83642543
+635 Atom 1 1 1 1
+1 1 1 27.15327083 65.12915345 46.18517244
+636 Atom 1 1 1 1
+1 1 1 24.39033294 65.13633911 48.87670669
+637 Atom 1 1 1 1
+1 1 1 25.75884767 63.76763265 47.55283204
+638 Atom 1 1 1 1
+1 1 1 28.53869295 63.76675525 50.23586527
+639 Atom 1 1 1 1
+1 1 1 28.53417383 66.54867599 47.54819774
+640 Atom 1 1 1 1
+1 1 1 25.83245870 66.54309156 50.23820472
+641 Atom 1 1 1 1
+1 1 1 24.41342246 67.84009369 46.13679714
+642 Atom 1 1 1 1
+1 1 1 27.14001919 67.84032991 48.92341651
+643 Atom 1 1 1 1
+1 1 1 27.14994083 70.56754755 46.13018561
+644 Atom 1 1 1 1
+1 1 1 24.42128195 70.57971039 48.83944726
+645 Atom 1 1 1 1
+1 1 1 25.80954417 69.22185958 47.54053530
+646 Atom 1 1 1 1
+1 1 1 28.47694807 69.28833966 50.25822512
+647 Atom 1 1 1 1
+1 1 1 28.50301202 71.95754308 47.53380917
+648 Atom 1 1 1 1
+1 1 1 25.84288904 71.99029270 50.23924000
+649 Atom 1 1 1 1
+1 1 1 24.41844727 73.33686264 46.14616056
+650 Atom 1 1 1 1
+1 1 1 27.14816641 73.28272434 48.88398514
+651 Atom 1 1 1 1
+1 1 1 27.12766345 76.02089667 46.12139344
+652 Atom 1 1 1 1
+1 1 1 24.40468596 76.00213402 48.83221921
+653 Atom 1 1 1 1
+1 1 1 25.81788302 74.63637262 47.47933655
+654 Atom 1 1 1 1
+1 1 1 28.56224964 74.68241296 50.26176983
+655 Atom 1 1 1 1
+1 1 1 28.51980060 77.43778479 47.52016868
+656 Atom 1 1 1 1
+1 1 1 25.80813196 77.35862366 50.26676331
+657 Atom 1 1 1 1
+1 1 1 24.40190737 78.73335535 46.20570770
+658 Atom 1 1 1 1
+1 1 1 27.13732903 78.72463422 48.87098876
+659 Atom 1 1 1 1
+1 1 1 27.12722463 81.46328132 46.11735344
+660 Atom 1 1 1 1
+1 1 1 24.39548366 81.47002414 48.85552893
+661 Atom 1 1 1 1
+1 1 1 25.74898590 80.09855133 47.57098845
+662 Atom 1 1 1 1
+1 1 1 28.48520913 80.15208131 50.22539374
+663 Atom 1 1 1 1
+1 1 1 28.53466504 82.84627086 47.51920453
+664 Atom 1 1 1 1
+1 1 1 25.83037858 82.85825954 50.20494425
+665 Atom 1 1 1 1
+1 1 1 24.44779715 84.22742514 46.17019389
+666 Atom 1 1 1 1
+1 1 1 27.15203334 84.16892577 48.87208592
+667 Atom 1 1 1 1
+1 1 1 27.14999350 86.86669969 46.13386672
+668 Atom 1 1 1 1
+1 1 1 24.40804231 86.87962676 48.85188405
+669 Atom 1 1 1 1
+1 1 1 25.82339863 85.51792835 47.53844986
+670 Atom 1 1 1 1
+1 1 1 28.55673082 85.57841644 50.25786624
+671 Atom 1 1 1 1
+1 1 1 28.55498030 88.26340672 47.56890346
+672 Atom 1 1 1 1
+1 1 1 25.76423602 88.29188949 50.25592760
+673 Atom 1 1 1 1
+1 1 1 29.87724515 2.70553375 46.17176232
+674 Atom 1 1 1 1
+1 1 1 32.63577967 2.73989494 48.87806565
+675 Atom 1 1 1 1
+1 1 1 32.63074347 5.46283652 46.13421162
+676 Atom 1 1 1 1
+1 1 1 29.89787082 5.39135137 48.91980845
+677 Atom 1 1 1 1
+1 1 1 31.19530790 4.11861492 47.51197315
+678 Atom 1 1 1 1
+1 1 1 33.91883394 4.04099858 50.26328656
+679 Atom 1 1 1 1
+1 1 1 33.90322107 6.74941777 47.56192836
+680 Atom 1 1 1 1
+1 1 1 31.24149002 6.79894436 50.26536750
+681 Atom 1 1 1 1
+1 1 1 29.87881933 8.13273323 46.16038065
+682 Atom 1 1 1 1
+1 1 1 32.62459576 8.09852752 48.86437518
+683 Atom 1 1 1 1
+1 1 1 32.61070287 10.82419294 46.16370982
+684 Atom 1 1 1 1
+1 1 1 29.83450171 10.83841454 48.90363684
+685 Atom 1 1 1 1
+1 1 1 31.24684083 9.48300775 47.51035190
+686 Atom 1 1 1 1
+1 1 1 33.91371065 9.45992061 50.27986767
+687 Atom 1 1 1 1
+1 1 1 33.98571045 12.26706765 47.49444191
+688 Atom 1 1 1 1
+1 1 1 31.18946180 12.24981173 50.24627196
+689 Atom 1 1 1 1
+1 1 1 29.89839235 13.56944261 46.20952264
+690 Atom 1 1 1 1
+1 1 1 32.59377183 13.60350192 48.85887149
+691 Atom 1 1 1 1
+1 1 1 32.55817379 16.31347141 46.18618261
+692 Atom 1 1 1 1
+1 1 1 29.91157028 16.27899982 48.85367781
+693 Atom 1 1 1 1
+1 1 1 31.20983606 14.90390634 47.49067485
+694 Atom 1 1 1 1
+1 1 1 33.91242560 14.97427911 50.27785779
+695 Atom 1 1 1 1
+1 1 1 33.96408546 17.60185112 47.56587830
+696 Atom 1 1 1 1
+1 1 1 31.26877458 17.62182851 50.22494361
+697 Atom 1 1 1 1
+1 1 1 29.85119509 19.01250439 46.16135636
+698 Atom 1 1 1 1
+1 1 1 32.60352044 19.02233396 48.92773833
+699 Atom 1 1 1 1
+1 1 1 32.60774969 21.70647570 46.17581156
+700 Atom 1 1 1 1
+1 1 1 29.85687656 21.74025334 48.87727584
+701 Atom 1 1 1 1
+1 1 1 31.25327104 20.38092736 47.53045030
+702 Atom 1 1 1 1
+1 1 1 33.91950497 20.34568351 50.28375574
+703 Atom 1 1 1 1
+1 1 1 33.90222199 23.13171587 47.49428254
+704 Atom 1 1 1 1
+1 1 1 31.18054017 23.04231756 50.26665284
+705 Atom 1 1 1 1
+1 1 1 29.84607543 24.45759400 46.12285329
+706 Atom 1 1 1 1
+1 1 1 32.63248131 24.47816169 48.87868210
+707 Atom 1 1 1 1
+1 1 1 32.61385471 27.20330235 46.13285473
+708 Atom 1 1 1 1
+1 1 1 29.86343168 27.11538981 48.84313934
+709 Atom 1 1 1 1
+1 1 1 31.21389162 25.79704917 47.54750013
+710 Atom 1 1 1 1
+1 1 1 33.97387126 25.81321093 50.20786803
+711 Atom 1 1 1 1
+1 1 1 33.91518754 28.48414404 47.49808588
+712 Atom 1 1 1 1
+1 1 1 31.23456214 28.52093413 50.22298179
+713 Atom 1 1 1 1
+1 1 1 29.91133146 29.85817035 46.14123243
+714 Atom 1 1 1 1
+1 1 1 32.56860207 29.87907032 48.90301143
+715 Atom 1 1 1 1
+1 1 1 32.61902255 32.59419338 46.11879516
+716 Atom 1 1 1 1
+1 1 1 29.91341812 32.61930369 48.83611294
+717 Atom 1 1 1 1
+1 1 1 31.19033553 31.24457311 47.50509773
+718 Atom 1 1 1 1
+1 1 1 33.97680604 31.25685573 50.20620087
+719 Atom 1 1 1 1
+1 1 1 33.95522081 33.98832823 47.48622032
+720 Atom 1 1 1 1
+1 1 1 31.20325986 33.96538686 50.24803513
+721 Atom 1 1 1 1
+1 1 1 29.85718908 35.33123955 46.12292694
+722 Atom 1 1 1 1
+1 1 1 32.61879481 35.34854599 48.87929592
+723 Atom 1 1 1 1
+1 1 1 32.62643289 37.99614589 46.16475003
+724 Atom 1 1 1 1
+1 1 1 29.86284965 38.02412012 48.86376340
+725 Atom 1 1 1 1
+1 1 1 31.27737444 36.69589164 47.47530136
+726 Atom 1 1 1 1
+1 1 1 33.99039503 36.65631419 50.25868679
+727 Atom 1 1 1 1
+1 1 1 33.93108211 39.33329567 47.54773211
+728 Atom 1 1 1 1
+1 1 1 31.22910811 39.35156074 50.19959840
+729 Atom 1 1 1 1
+1 1 1 29.90048079 40.70432746 46.13855318
+730 Atom 1 1 1 1
+1 1 1 32.62897712 40.74337380 48.91481659
+731 Atom 1 1 1 1
+1 1 1 32.63504763 43.39833709 46.12973667
+732 Atom 1 1 1 1
+1 1 1 29.88779301 43.45960973 48.82957372
+733 Atom 1 1 1 1
+1 1 1 31.27700602 42.13884738 47.48231435
+734 Atom 1 1 1 1
+1 1 1 33.95362936 42.10636647 50.28652130
+735 Atom 1 1 1 1
+1 1 1 33.89489376 44.79527271 47.49027489
+736 Atom 1 1 1 1
+1 1 1 31.23364562 44.81472326 50.24994087
+737 Atom 1 1 1 1
+1 1 1 29.88501680 46.15212557 46.12674145
+738 Atom 1 1 1 1
+1 1 1 32.54777523 46.12788424 48.92752159
+739 Atom 1 1 1 1
+1 1 1 32.60377769 48.86316159 46.20761351
+740 Atom 1 1 1 1
+1 1 1 29.82806393 48.88436775 48.90328207
+741 Atom 1 1 1 1
+1 1 1 31.21480390 47.55872094 47.53625792
+742 Atom 1 1 1 1
+1 1 1 33.96918114 47.48431809 50.24108009
+743 Atom 1 1 1 1
+1 1 1 33.92926131 50.28397734 47.55966487
+744 Atom 1 1 1 1
+1 1 1 31.26452830 50.22220764 50.24224473
+745 Atom 1 1 1 1
+1 1 1 29.87364969 51.61909019 46.19296306
+746 Atom 1 1 1 1
+1 1 1 32.60887722 51.54789780 48.85319288
+747 Atom 1 1 1 1
+1 1 1 32.62507449 54.33479344 46.14655923
+748 Atom 1 1 1 1
+1 1 1 29.83006419 54.35518922 48.89233641
+749 Atom 1 1 1 1
+1 1 1 31.24811480 52.94504227 47.52903136
+750 Atom 1 1 1 1
+1 1 1 33.92596409 52.94894966 50.28516821
+751 Atom 1 1 1 1
+1 1 1 33.90038436 55.61913037 47.55321308
+752 Atom 1 1 1 1
+1 1 1 31.26950688 55.62160504 50.25638216
+753 Atom 1 1 1 1
+1 1 1 29.82168966 56.99239353 46.12215121
+754 Atom 1 1 1 1
+1 1 1 32.62000860 56.99032351 48.83163781
+755 Atom 1 1 1 1
+1 1 1 32.62034997 59.77097601 46.11958086
+756 Atom 1 1 1 1
+1 1 1 29.84498635 59.73193984 48.87491140
+757 Atom 1 1 1 1
+1 1 1 31.18951484 58.36322193 47.54505339
+758 Atom 1 1 1 1
+1 1 1 33.98276954 58.39479491 50.21335657
+759 Atom 1 1 1 1
+1 1 1 33.98455722 61.08866888 47.48368863
+760 Atom 1 1 1 1
+1 1 1 31.25408847 61.10850201 50.19057948
+761 Atom 1 1 1 1
+1 1 1 29.85504462 62.43285829 46.19394245
+762 Atom 1 1 1 1
+1 1 1 32.55895099 62.43379077 48.86856235
+763 Atom 1 1 1 1
+1 1 1 32.54839578 65.21206386 46.14234340
+764 Atom 1 1 1 1
+1 1 1 29.83133901 65.13572817 48.88319445
+765 Atom 1 1 1 1
+1 1 1 31.25100578 63.80104957 47.49558312
+766 Atom 1 1 1 1
+1 1 1 33.93877671 63.83898897 50.22839925
+767 Atom 1 1 1 1
+1 1 1 33.93104092 66.55685207 47.54443439
+768 Atom 1 1 1 1
+1 1 1 31.24443202 66.51200356 50.22870517
+769 Atom 1 1 1 1
+1 1 1 29.91421444 67.92984000 46.20595276
+770 Atom 1 1 1 1
+1 1 1 32.57325732 67.91314137 48.89425320
+771 Atom 1 1 1 1
+1 1 1 32.61870908 70.63624123 46.18487577
+772 Atom 1 1 1 1
+1 1 1 29.91371085 70.56486592 48.82981475
+773 Atom 1 1 1 1
+1 1 1 31.18538052 69.22776541 47.49819849
+774 Atom 1 1 1 1
+1 1 1 33.92118905 69.23596424 50.25623153
+775 Atom 1 1 1 1
+1 1 1 33.95644834 71.94657996 47.51200069
+776 Atom 1 1 1 1
+1 1 1 31.22807597 71.99976857 50.18802047
+777 Atom 1 1 1 1
+1 1 1 29.88810436 73.29254149 46.15528859
+778 Atom 1 1 1 1
+1 1 1 32.55908051 73.32922866 48.90254699
+779 Atom 1 1 1 1
+1 1 1 32.56681355 76.02382484 46.11665479
+780 Atom 1 1 1 1
+1 1 1 29.88536348 75.99470448 48.85422895
+781 Atom 1 1 1 1
+1 1 1 31.20630431 74.70875354 47.53139696
+782 Atom 1 1 1 1
+1 1 1 33.96434235 74.63233313 50.22802835
+783 Atom 1 1 1 1
+1 1 1 33.96122650 77.34520879 47.49052320
+784 Atom 1 1 1 1
+1 1 1 31.20179308 77.43222970 50.24447203
+785 Atom 1 1 1 1
+1 1 1 29.85547911 78.73160959 46.11458700
+786 Atom 1 1 1 1
+1 1 1 32.62889398 78.70670026 48.83646459
+787 Atom 1 1 1 1
+1 1 1 32.58545121 81.46951096 46.13011631
+788 Atom 1 1 1 1
+1 1 1 29.85133089 81.42543257 48.86666823
+789 Atom 1 1 1 1
+1 1 1 31.22255487 80.06936003 47.52546137
+790 Atom 1 1 1 1
+1 1 1 33.97704280 80.13552063 50.22824114
+791 Atom 1 1 1 1
+1 1 1 33.93444847 82.78343229 47.51205982
+792 Atom 1 1 1 1
+1 1 1 31.23916386 82.84225971 50.26116420
+793 Atom 1 1 1 1
+1 1 1 29.87044696 84.16500304 46.19314135
+794 Atom 1 1 1 1
+1 1 1 32.62993112 84.17458870 48.85513442
+795 Atom 1 1 1 1
+1 1 1 32.55832945 86.86014554 46.19123558
+796 Atom 1 1 1 1
+1 1 1 29.82331665 86.86435395 48.86997460
+797 Atom 1 1 1 1
+1 1 1 31.20144487 85.53738836 47.55978362
+798 Atom 1 1 1 1
+1 1 1 33.96009909 85.53383170 50.28369910
+799 Atom 1 1 1 1
+1 1 1 33.89494048 88.24849169 47.53043730
+800 Atom 1 1 1 1
+1 1 1 31.24115681 88.20423623 50.19353009
+801 Atom 1 1 1 1
+1 1 1 35.25807622 2.76101329 46.14335533
+802 Atom 1 1 1 1
+1 1 1 37.99939888 2.67739139 48.83706240
+803 Atom 1 1 1 1
+1 1 1 37.97300126 5.43733307 46.14214141
+804 Atom 1 1 1 1
+1 1 1 35.31642795 5.47163460 48.83660632
+805 Atom 1 1 1 1
+1 1 1 36.64819623 4.05205074 47.47546211
+806 Atom 1 1 1 1
+1 1 1 39.35551183 4.11788758 50.18776123
+807 Atom 1 1 1 1
+1 1 1 39.39935395 6.82744245 47.51641546
+808 Atom 1 1 1 1
+1 1 1 36.66922599 6.75655399 50.22624769
+809 Atom 1 1 1 1
+1 1 1 35.32343690 8.15326110 46.11908277
+810 Atom 1 1 1 1
+1 1 1 38.04495848 8.18179166 48.83532756
+811 Atom 1 1 1 1
+1 1 1 38.03826431 10.87852347 46.16168249
+812 Atom 1 1 1 1
+1 1 1 35.32582307 10.82249576 48.92709360
+813 Atom 1 1 1 1
+1 1 1 36.62434969 9.48775022 47.49349490
+814 Atom 1 1 1 1
+1 1 1 39.37181100 9.53897385 50.23619686
+815 Atom 1 1 1 1
+1 1 1 39.37538617 12.22666063 47.53391856
+816 Atom 1 1 1 1
+1 1 1 36.69586951 12.20884704 50.21725257
+817 Atom 1 1 1 1
+1 1 1 35.26068515 13.60536997 46.19720660
+818 Atom 1 1 1 1
+1 1 1 37.97475216 13.61327952 48.85885170
+819 Atom 1 1 1 1
+1 1 1 37.98032713 16.27274972 46.15942247
+820 Atom 1 1 1 1
+1 1 1 35.29842814 16.33427313 48.89984632
+821 Atom 1 1 1 1
+1 1 1 36.65243589 14.93414881 47.48235049
+822 Atom 1 1 1 1
+1 1 1 39.32499662 14.97727519 50.21695146
+823 Atom 1 1 1 1
+1 1 1 39.34258123 17.63591693 47.53479728
+824 Atom 1 1 1 1
+1 1 1 36.63565068 17.68421956 50.22707594
+825 Atom 1 1 1 1
+1 1 1 35.32759794 18.96113508 46.19790052
+826 Atom 1 1 1 1
+1 1 1 38.02673854 19.02898754 48.88237159
+827 Atom 1 1 1 1
+1 1 1 38.01170077 21.72358720 46.13452032
+828 Atom 1 1 1 1
+1 1 1 35.27556400 21.75591443 48.92603743
+829 Atom 1 1 1 1
+1 1 1 36.67129472 20.38702512 47.56344798
+830 Atom 1 1 1 1
+1 1 1 39.42077470 20.38169133 50.28363977
+831 Atom 1 1 1 1
+1 1 1 39.35247842 23.09532886 47.53904044
+832 Atom 1 1 1 1
+1 1 1 36.66283800 23.10040900 50.23816324
+833 Atom 1 1 1 1
+1 1 1 35.34821824 24.48689175 46.16770950
+834 Atom 1 1 1 1
+1 1 1 38.05577833 24.42411987 48.91065346
+835 Atom 1 1 1 1
+1 1 1 37.98292189 27.15293937 46.15315690
+836 Atom 1 1 1 1
+1 1 1 35.31104111 27.12560772 48.89864531
+837 Atom 1 1 1 1
+1 1 1 36.68092026 25.79701717 47.49368944
+838 Atom 1 1 1 1
+1 1 1 39.40070029 25.82939825 50.24703584
+839 Atom 1 1 1 1
+1 1 1 39.41726323 28.47124140 47.48036874
+840 Atom 1 1 1 1
+1 1 1 36.64857073 28.54290601 50.21808255
+841 Atom 1 1 1 1
+1 1 1 35.31267288 29.88109364 46.14447046
+842 Atom 1 1 1 1
+1 1 1 38.01889283 29.87142997 48.89136875
+843 Atom 1 1 1 1
+1 1 1 38.05796264 32.58440618 46.13742627
+844 Atom 1 1 1 1
+1 1 1 35.29691655 32.55657108 48.87907832
+845 Atom 1 1 1 1
+1 1 1 36.63201103 31.18473818 47.52973027
+846 Atom 1 1 1 1
+1 1 1 39.32883646 31.23387336 50.23855728
+847 Atom 1 1 1 1
+1 1 1 39.36674115 33.90489030 47.55184790
+848 Atom 1 1 1 1
+1 1 1 36.63388919 33.93362717 50.22840100
+849 Atom 1 1 1 1
+1 1 1 35.29330824 35.29460668 46.19260625
+850 Atom 1 1 1 1
+1 1 1 37.97930053 35.28737445 48.86072345
+851 Atom 1 1 1 1
+1 1 1 38.03608548 38.05688523 46.15559786
+852 Atom 1 1 1 1
+1 1 1 35.29532244 37.99285164 48.87658613
+853 Atom 1 1 1 1
+1 1 1 36.62762574 36.67979216 47.51881120
+854 Atom 1 1 1 1
+1 1 1 39.41181207 36.66474989 50.18880557
+855 Atom 1 1 1 1
+1 1 1 39.40206055 39.37286625 47.54366247
+856 Atom 1 1 1 1
+1 1 1 36.62747334 39.41758722 50.23558393
+857 Atom 1 1 1 1
+1 1 1 35.31296784 40.74124243 46.18422724
+858 Atom 1 1 1 1
+1 1 1 38.02668106 40.68419440 48.89013673
+859 Atom 1 1 1 1
+1 1 1 38.05543451 43.49290330 46.17935482
+860 Atom 1 1 1 1
+1 1 1 35.29621726 43.47427805 48.90734635
+861 Atom 1 1 1 1
+1 1 1 36.60948917 42.09090612 47.52451837
+862 Atom 1 1 1 1
+1 1 1 39.37070293 42.07492227 50.20475260
+863 Atom 1 1 1 1
+1 1 1 39.40245511 44.78625252 47.47703605
+864 Atom 1 1 1 1
+1 1 1 36.61124590 44.82646801 50.18817011
+865 Atom 1 1 1 1
+1 1 1 35.32579050 46.17649741 46.18636724
+866 Atom 1 1 1 1
+1 1 1 38.05205112 46.17203804 48.87726537
+867 Atom 1 1 1 1
+1 1 1 38.00561588 48.86040073 46.14283800
+868 Atom 1 1 1 1
+1 1 1 35.34197517 48.85036964 48.92039282
+869 Atom 1 1 1 1
+1 1 1 36.65396701 47.47271830 47.54288774
+870 Atom 1 1 1 1
+1 1 1 39.39571017 47.57052978 50.19501661
+871 Atom 1 1 1 1
+1 1 1 39.38843239 50.28293426 47.54775034
+872 Atom 1 1 1 1
+1 1 1 36.70594569 50.19898869 50.20836984
+873 Atom 1 1 1 1
+1 1 1 35.31954295 51.55684237 46.11519831
+874 Atom 1 1 1 1
+1 1 1 38.06140904 51.61997627 48.90058149
+875 Atom 1 1 1 1
+1 1 1 38.00653646 54.30884365 46.14033107
+876 Atom 1 1 1 1
+1 1 1 35.29621488 54.27570074 48.92788894
+877 Atom 1 1 1 1
+1 1 1 36.68312253 52.94104377 47.53624803
+878 Atom 1 1 1 1
+1 1 1 39.34223885 52.90537652 50.24886714
+879 Atom 1 1 1 1
+1 1 1 39.35280664 55.64637233 47.51120243
+880 Atom 1 1 1 1
+1 1 1 36.70879158 55.71458199 50.26499289
+881 Atom 1 1 1 1
+1 1 1 35.30643966 57.06018963 46.14400221
+882 Atom 1 1 1 1
+1 1 1 38.05904620 57.05192578 48.85782200
+883 Atom 1 1 1 1
+1 1 1 38.04371800 59.73469751 46.13787185
+884 Atom 1 1 1 1
+1 1 1 35.28870189 59.73006732 48.84139226
+885 Atom 1 1 1 1
+1 1 1 36.70087254 58.39363934 47.53751869
+886 Atom 1 1 1 1
+1 1 1 39.32748120 58.34494411 50.24787426
+887 Atom 1 1 1 1
+1 1 1 39.38697780 61.13466167 47.50230401
+888 Atom 1 1 1 1
+1 1 1 36.63089611 61.08438671 50.28463712
+889 Atom 1 1 1 1
+1 1 1 35.34390971 62.41119070 46.18281994
+890 Atom 1 1 1 1
+1 1 1 38.02305909 62.50580964 48.88782855
+891 Atom 1 1 1 1
+1 1 1 38.01991334 65.19198642 46.15737820
+892 Atom 1 1 1 1
+1 1 1 35.30182358 65.20991850 48.86405925
+893 Atom 1 1 1 1
+1 1 1 36.64401869 63.78927767 47.51116226
+894 Atom 1 1 1 1
+1 1 1 39.41266228 63.77507364 50.23217292
+895 Atom 1 1 1 1
+1 1 1 39.38134518 66.49345063 47.50784655
+896 Atom 1 1 1 1
+1 1 1 36.67528482 66.52006099 50.28474974
+897 Atom 1 1 1 1
+1 1 1 35.34234556 67.92028267 46.13595171
+898 Atom 1 1 1 1
+1 1 1 37.97991348 67.85492733 48.91285270
+899 Atom 1 1 1 1
+1 1 1 37.96945887 70.61783815 46.20383731
+900 Atom 1 1 1 1
+1 1 1 35.31345817 70.56723109 48.90765085
+901 Atom 1 1 1 1
+1 1 1 36.69374843 69.23833412 47.52945616
+902 Atom 1 1 1 1
+1 1 1 39.39807484 69.20326574 50.20926448
+903 Atom 1 1 1 1
+1 1 1 39.36446636 71.96097265 47.52086603
+904 Atom 1 1 1 1
+1 1 1 36.70698670 71.94613196 50.24544547
+905 Atom 1 1 1 1
+1 1 1 35.30775103 73.29399891 46.14224977
+906 Atom 1 1 1 1
+1 1 1 37.98031639 73.33785495 48.89680932
+907 Atom 1 1 1 1
+1 1 1 37.97728734 76.07222256 46.16698566
+908 Atom 1 1 1 1
+1 1 1 35.31920235 76.01967980 48.90055826
+909 Atom 1 1 1 1
+1 1 1 36.68492486 74.64107035 47.55934735
+910 Atom 1 1 1 1
+1 1 1 39.41525939 74.70767366 50.25114620
+911 Atom 1 1 1 1
+1 1 1 39.35773451 77.34703209 47.47988269
+912 Atom 1 1 1 1
+1 1 1 36.69415820 77.39927143 50.27731669
+913 Atom 1 1 1 1
+1 1 1 35.34947687 78.70145938 46.12090549
+914 Atom 1 1 1 1
+1 1 1 37.96738378 78.70237309 48.86788347
+915 Atom 1 1 1 1
+1 1 1 38.04889815 81.49113820 46.17453626
+916 Atom 1 1 1 1
+1 1 1 35.32227036 81.50309154 48.91527059
+917 Atom 1 1 1 1
+1 1 1 36.61913053 80.12140818 47.50237426
+918 Atom 1 1 1 1
+1 1 1 39.35223583 80.09395308 50.19907322
+919 Atom 1 1 1 1
+1 1 1 39.40040830 82.78286430 47.47499877
+920 Atom 1 1 1 1
+1 1 1 36.63054521 82.82808701 50.24093219
+921 Atom 1 1 1 1
+1 1 1 35.29691279 84.19494828 46.14434581
+922 Atom 1 1 1 1
+1 1 1 38.05507975 84.18898383 48.91690643
+923 Atom 1 1 1 1
+1 1 1 38.02503401 86.92956806 46.18063957
+924 Atom 1 1 1 1
+1 1 1 35.34853543 86.87761898 48.83005614
+925 Atom 1 1 1 1
+1 1 1 36.61603336 85.54049545 47.47646766
+926 Atom 1 1 1 1
+1 1 1 39.40306197 85.58278959 50.27889620
+927 Atom 1 1 1 1
+1 1 1 39.32724557 88.22286192 47.52049763
+928 Atom 1 1 1 1
+1 1 1 36.62556298 88.21684275 50.23825677
+929 Atom 1 1 1 1
+1 1 1 40.68316749 2.67768180 46.17173512
+930 Atom 1 1 1 1
+1 1 1 43.42949386 2.76386729 48.91641973
+931 Atom 1 1 1 1
+1 1 1 43.44756925 5.44035312 46.13131893
+932 Atom 1 1 1 1
+1 1 1 40.73888520 5.41083916 48.89896896
+933 Atom 1 1 1 1
+1 1 1 42.06259814 4.12207102 47.50909974
+934 Atom 1 1 1 1
+1 1 1 44.85373848 4.11484713 50.18836536
+935 Atom 1 1 1 1
+1 1 1 44.84572352 6.81885921 47.56732064
+936 Atom 1 1 1 1
+1 1 1 42.09555076 6.74867575 50.22122518
+937 Atom 1 1 1 1
+1 1 1 40.72154747 8.11057802 46.19950808
+938 Atom 1 1 1 1
+1 1 1 43.48744725 8.10353356 48.90604880
+939 Atom 1 1 1 1
+1 1 1 43.40273033 10.84300289 46.17340965
+940 Atom 1 1 1 1
+1 1 1 40.74498999 10.84694815 48.90950420
+941 Atom 1 1 1 1
+1 1 1 42.04495566 9.50411304 47.52312827
+942 Atom 1 1 1 1
+1 1 1 44.82032393 9.53038909 50.21818754
+943 Atom 1 1 1 1
+1 1 1 44.76732935 12.17067299 47.51175823
+944 Atom 1 1 1 1
+1 1 1 42.05338166 12.19565397 50.22543350
+945 Atom 1 1 1 1
+1 1 1 40.71074044 13.59666685 46.20431335
+946 Atom 1 1 1 1
+1 1 1 43.47707949 13.55026391 48.85559071
+947 Atom 1 1 1 1
+1 1 1 43.48573271 16.31705100 46.17998594
+948 Atom 1 1 1 1
+1 1 1 40.75985392 16.25313887 48.86948928
+949 Atom 1 1 1 1
+1 1 1 42.08479892 14.95764852 47.53589977
+950 Atom 1 1 1 1
+1 1 1 44.76095605 14.94788289 50.27918217
+951 Atom 1 1 1 1
+1 1 1 44.80574775 17.65440042 47.54480179
+952 Atom 1 1 1 1
+1 1 1 42.11828115 17.68447319 50.27049036
+953 Atom 1 1 1 1
+1 1 1 40.72766519 19.00964313 46.13905253
+954 Atom 1 1 1 1
+1 1 1 43.41942420 18.96050907 48.92850674
+955 Atom 1 1 1 1
+1 1 1 43.48679349 21.77360659 46.19797258
+956 Atom 1 1 1 1
+1 1 1 40.75546197 21.71682213 48.87378771
+957 Atom 1 1 1 1
+1 1 1 42.09633857 20.36956787 47.53235045
+958 Atom 1 1 1 1
+1 1 1 44.78137151 20.38303771 50.25702068
+959 Atom 1 1 1 1
+1 1 1 44.84383903 23.12507761 47.48807042
+960 Atom 1 1 1 1
+1 1 1 42.04655022 23.06451356 50.27173352
+961 Atom 1 1 1 1
+1 1 1 40.69204356 24.46693896 46.17627638
+962 Atom 1 1 1 1
+1 1 1 43.44545900 24.45460054 48.89226551
+963 Atom 1 1 1 1
+1 1 1 43.44166181 27.17444569 46.20638411
+964 Atom 1 1 1 1
+1 1 1 40.73488408 27.11168065 48.87629293
+965 Atom 1 1 1 1
+1 1 1 42.12788564 25.77265063 47.56164117
+966 Atom 1 1 1 1
+1 1 1 44.84404739 25.78014141 50.20042329
+967 Atom 1 1 1 1
+1 1 1 44.76162410 28.46838108 47.47492810
+968 Atom 1 1 1 1
+1 1 1 42.06554051 28.54156385 50.25661651
+969 Atom 1 1 1 1
+1 1 1 40.73307765 29.86942123 46.18277396
+970 Atom 1 1 1 1
+1 1 1 43.48240836 29.85498323 48.82983452
+971 Atom 1 1 1 1
+1 1 1 43.47136988 32.63513929 46.11960912
+972 Atom 1 1 1 1
+1 1 1 40.74953338 32.59239298 48.87312230
+973 Atom 1 1 1 1
+1 1 1 42.06240916 31.19279089 47.49488634
+974 Atom 1 1 1 1
+1 1 1 44.83840294 31.20563309 50.23876568
+975 Atom 1 1 1 1
+1 1 1 44.84765732 33.95524661 47.53884358
+976 Atom 1 1 1 1
+1 1 1 42.12282014 33.99116620 50.27969056
+977 Atom 1 1 1 1
+1 1 1 40.71066542 35.34542674 46.20785708
+978 Atom 1 1 1 1
+1 1 1 43.43911319 35.30544197 48.83066945
+979 Atom 1 1 1 1
+1 1 1 43.45968873 38.04545124 46.21116315
+980 Atom 1 1 1 1
+1 1 1 40.71316060 38.00128867 48.87732017
+981 Atom 1 1 1 1
+1 1 1 42.11111154 36.67381489 47.51331009
+982 Atom 1 1 1 1
+1 1 1 44.79683430 36.67852699 50.20640574
+983 Atom 1 1 1 1
+1 1 1 44.81467791 39.35554940 47.47349565
+984 Atom 1 1 1 1
+1 1 1 42.13885707 39.39854432 50.21469714
+985 Atom 1 1 1 1
+1 1 1 40.76556764 40.70488269 46.12034822
+986 Atom 1 1 1 1
+1 1 1 43.46646585 40.70429064 48.86500745
+987 Atom 1 1 1 1
+1 1 1 43.42236028 43.48695050 46.16848702
+988 Atom 1 1 1 1
+1 1 1 40.75404374 43.42342457 48.87570224
+989 Atom 1 1 1 1
+1 1 1 42.08731534 42.11792719 47.47164461
+990 Atom 1 1 1 1
+1 1 1 44.79022549 42.13352863 50.23830762
+991 Atom 1 1 1 1
+1 1 1 44.78818293 44.85199343 47.56189768
+992 Atom 1 1 1 1
+1 1 1 42.13652435 44.77835522 50.25907451
+993 Atom 1 1 1 1
+1 1 1 40.77263512 46.13026690 46.12206281
+994 Atom 1 1 1 1
+1 1 1 43.49370370 46.21087418 48.88591555
+995 Atom 1 1 1 1
+1 1 1 43.48764072 48.85795951 46.15388591
+996 Atom 1 1 1 1
+1 1 1 40.69587290 48.84467610 48.88026684
+997 Atom 1 1 1 1
+1 1 1 42.11064086 47.47862598 47.52845983
+998 Atom 1 1 1 1
+1 1 1 44.75798213 47.48308016 50.24240409
+999 Atom 1 1 1 1
+1 1 1 44.85171150 50.19502626 47.53756434
+1000 Atom 1 1 1 1
+1 1 1 42.07739863 50.23561965 50.23000267
+1001 Atom 1 1 1 1
+1 1 1 40.75033901 51.62063487 46.19645003
+1002 Atom 1 1 1 1
+1 1 1 43.42881238 51.56587468 48.83863300
+1003 Atom 1 1 1 1
+1 1 1 43.41574594 54.33061032 46.16460368
+1004 Atom 1 1 1 1
+1 1 1 40.76727219 54.31089715 48.91026096
+1005 Atom 1 1 1 1
+1 1 1 42.06647702 52.95160281 47.48508736
+1006 Atom 1 1 1 1
+1 1 1 44.82589755 52.95465267 50.27112056
+1007 Atom 1 1 1 1
+1 1 1 44.76406485 55.63095286 47.54344718
+1008 Atom 1 1 1 1
+1 1 1 42.11547374 55.62788135 50.28365362
+1009 Atom 1 1 1 1
+1 1 1 40.71767660 56.99151227 46.13939797
+1010 Atom 1 1 1 1
+1 1 1 43.49651701 56.99747037 48.85982521
+1011 Atom 1 1 1 1
+1 1 1 43.42903897 59.71256243 46.19910624
+1012 Atom 1 1 1 1
+1 1 1 40.73220005 59.69546177 48.90145010
+1013 Atom 1 1 1 1
+1 1 1 42.06110167 58.35035607 47.56930105
+1014 Atom 1 1 1 1
+1 1 1 44.76424332 58.38751382 50.24676339
+1015 Atom 1 1 1 1
+1 1 1 44.80966569 61.14267601 47.56540141
+1016 Atom 1 1 1 1
+1 1 1 42.09721443 61.05837643 50.19025307
+1017 Atom 1 1 1 1
+1 1 1 40.76357908 62.45685144 46.14657591
+1018 Atom 1 1 1 1
+1 1 1 43.43023574 62.47601210 48.85902174
+1019 Atom 1 1 1 1
+1 1 1 43.47496715 65.16339828 46.12074448
+1020 Atom 1 1 1 1
+1 1 1 40.71894527 65.19903825 48.91458038
+1021 Atom 1 1 1 1
+1 1 1 42.10861447 63.79435181 47.47832718
+1022 Atom 1 1 1 1
+1 1 1 44.80223038 63.77057049 50.21871086
+1023 Atom 1 1 1 1
+1 1 1 44.84074208 66.54394712 47.53997650
+1024 Atom 1 1 1 1
+1 1 1 42.08017797 66.54701669 50.27217634
+1025 Atom 1 1 1 1
+1 1 1 40.76678189 67.85084536 46.15330983
+1026 Atom 1 1 1 1
+1 1 1 43.41999536 67.89456558 48.83887053
+1027 Atom 1 1 1 1
+1 1 1 43.46034740 70.62149456 46.15948065
+1028 Atom 1 1 1 1
+1 1 1 40.78191399 70.56635985 48.91792147
+1029 Atom 1 1 1 1
+1 1 1 42.10848372 69.20904120 47.49852078
+1030 Atom 1 1 1 1
+1 1 1 44.85419537 69.21069834 50.26092353
+1031 Atom 1 1 1 1
+1 1 1 44.81879032 71.95293981 47.50272889
+1032 Atom 1 1 1 1
+1 1 1 42.06570482 72.00600715 50.21225085
+1033 Atom 1 1 1 1
+1 1 1 40.69643536 73.28007233 46.17681509
+1034 Atom 1 1 1 1
+1 1 1 43.49782430 73.33100648 48.85046681
+1035 Atom 1 1 1 1
+1 1 1 43.48265489 76.06624325 46.13558561
+1036 Atom 1 1 1 1
+1 1 1 40.68351204 76.04128998 48.84043799
+1037 Atom 1 1 1 1
+1 1 1 42.06505026 74.65433056 47.48316790
+1038 Atom 1 1 1 1
+1 1 1 44.85522800 74.72330555 50.19519714
+1039 Atom 1 1 1 1
+1 1 1 44.85252577 77.38786647 47.50857456
+1040 Atom 1 1 1 1
+1 1 1 42.07572891 77.38915969 50.28134647
+1041 Atom 1 1 1 1
+1 1 1 40.77898290 78.78016288 46.18374953
+1042 Atom 1 1 1 1
+1 1 1 43.39969170 78.78877133 48.90800122
+1043 Atom 1 1 1 1
+1 1 1 43.40887051 81.46602640 46.16388487
+1044 Atom 1 1 1 1
+1 1 1 40.69599641 81.50620381 48.88750509
+1045 Atom 1 1 1 1
+1 1 1 42.07521137 80.08760645 47.50969109
+1046 Atom 1 1 1 1
+1 1 1 44.82264627 80.11502624 50.20478491
+1047 Atom 1 1 1 1
+1 1 1 44.80701125 82.87154996 47.56812685
+1048 Atom 1 1 1 1
+1 1 1 42.10514011 82.77914063 50.26455691
+1049 Atom 1 1 1 1
+1 1 1 40.71977297 84.18594219 46.20162017
+1050 Atom 1 1 1 1
+1 1 1 43.42847872 84.22030006 48.83785850
+1051 Atom 1 1 1 1
+1 1 1 43.44463625 86.88914441 46.19338311
+1052 Atom 1 1 1 1
+1 1 1 40.70297097 86.86848189 48.88055891
+1053 Atom 1 1 1 1
+1 1 1 42.11700523 85.58077077 47.48114716
+1054 Atom 1 1 1 1
+1 1 1 44.82874571 85.53269275 50.24461134
+1055 Atom 1 1 1 1
+1 1 1 44.79690949 88.28601267 47.52217194
+1056 Atom 1 1 1 1
+1 1 1 42.07531783 88.22001788 50.19052989
+1057 Atom 1 1 1 1
+1 1 1 46.13064562 2.70809158 46.12303872
+1058 Atom 1 1 1 1
+1 1 1 48.90094543 2.71424426 48.90282593
+1059 Atom 1 1 1 1
+1 1 1 48.86091711 5.43202884 46.20271532
+1060 Atom 1 1 1 1
+1 1 1 46.20657301 5.44520711 48.90801499
+1061 Atom 1 1 1 1
+1 1 1 47.52617552 4.11671328 47.48510346
+1062 Atom 1 1 1 1
+1 1 1 50.21545669 4.11234824 50.22971648
+1063 Atom 1 1 1 1
+1 1 1 50.22208664 6.75962011 47.52619968
+1064 Atom 1 1 1 1
+1 1 1 47.47700533 6.75978115 50.25314745
+1065 Atom 1 1 1 1
+1 1 1 46.14653374 8.09973471 46.14418573
+1066 Atom 1 1 1 1
+1 1 1 48.85617382 8.13574485 48.86027896
+1067 Atom 1 1 1 1
+1 1 1 48.86200488 10.84025814 46.17133193
+1068 Atom 1 1 1 1
+1 1 1 46.19041994 10.87188473 48.91988253
+1069 Atom 1 1 1 1
+1 1 1 47.55888625 9.46385401 47.47367178
+1070 Atom 1 1 1 1
+1 1 1 50.21481114 9.46310435 50.27786758
+1071 Atom 1 1 1 1
+1 1 1 50.19881238 12.19923298 47.53613975
+1072 Atom 1 1 1 1
+1 1 1 47.51125031 12.18056229 50.20706669
+1073 Atom 1 1 1 1
+1 1 1 46.15343203 13.56062146 46.11352790
+1074 Atom 1 1 1 1
+1 1 1 48.91703242 13.60445302 48.87657457
+1075 Atom 1 1 1 1
+1 1 1 48.92054803 16.30990360 46.15338307
+1076 Atom 1 1 1 1
+1 1 1 46.16402980 16.27086448 48.87379621
+1077 Atom 1 1 1 1
+1 1 1 47.50973095 14.91280261 47.54069323
+1078 Atom 1 1 1 1
+1 1 1 50.21947780 14.96888508 50.28389927
+1079 Atom 1 1 1 1
+1 1 1 50.27163562 17.62827718 47.52654906
+1080 Atom 1 1 1 1
+1 1 1 47.54192833 17.60855400 50.24968907
+1081 Atom 1 1 1 1
+1 1 1 46.14312835 18.96947205 46.16639844
+1082 Atom 1 1 1 1
+1 1 1 48.91562002 18.99772654 48.86606639
+1083 Atom 1 1 1 1
+1 1 1 48.84487583 21.75421956 46.14883334
+1084 Atom 1 1 1 1
+1 1 1 46.18561680 21.76497316 48.85679011
+1085 Atom 1 1 1 1
+1 1 1 47.51897518 20.36062134 47.48672304
+1086 Atom 1 1 1 1
+1 1 1 50.19226135 20.39236350 50.22760643
+1087 Atom 1 1 1 1
+1 1 1 50.24542180 23.04669464 47.51823683
+1088 Atom 1 1 1 1
+1 1 1 47.50765852 23.13106207 50.21158750
+1089 Atom 1 1 1 1
+1 1 1 46.11726766 24.47899135 46.17516467
+1090 Atom 1 1 1 1
+1 1 1 48.83669981 24.46900403 48.87556410
+1091 Atom 1 1 1 1
+1 1 1 48.82910051 27.11187516 46.18539533
+1092 Atom 1 1 1 1
+1 1 1 46.15020366 27.19785391 48.83833188
+1093 Atom 1 1 1 1
+1 1 1 47.53912105 25.80247841 47.54507450
+1094 Atom 1 1 1 1
+1 1 1 50.25846840 25.74956528 50.20421398
+1095 Atom 1 1 1 1
+1 1 1 50.19231615 28.48764636 47.51865479
+1096 Atom 1 1 1 1
+1 1 1 47.56443032 28.48533127 50.21490035
+1097 Atom 1 1 1 1
+1 1 1 46.11642060 29.86728328 46.18826077
+1098 Atom 1 1 1 1
+1 1 1 48.92241265 29.90790320 48.84306899
+1099 Atom 1 1 1 1
+1 1 1 48.91250052 32.54792153 46.15556497
+1100 Atom 1 1 1 1
+1 1 1 46.11461018 32.60134399 48.83029017
+1101 Atom 1 1 1 1
+1 1 1 47.48720085 31.25896726 47.55864790
+1102 Atom 1 1 1 1
+1 1 1 50.22250716 31.19615752 50.22242816
+1103 Atom 1 1 1 1
+1 1 1 50.25491441 33.90405672 47.53699264
+1104 Atom 1 1 1 1
+1 1 1 47.51968456 33.89908238 50.24324920
+1105 Atom 1 1 1 1
+1 1 1 46.17506849 35.32975729 46.13998309
+1106 Atom 1 1 1 1
+1 1 1 48.92716098 35.27450993 48.85726117
+1107 Atom 1 1 1 1
+1 1 1 48.89799551 37.99234192 46.14879387
+1108 Atom 1 1 1 1
+1 1 1 46.14284160 38.00632536 48.91071263
+1109 Atom 1 1 1 1
+1 1 1 47.53504222 36.69011167 47.47710427
+1110 Atom 1 1 1 1
+1 1 1 50.21524547 36.65856143 50.22260203
+1111 Atom 1 1 1 1
+1 1 1 50.18969972 39.37272685 47.50043561
+1112 Atom 1 1 1 1
+1 1 1 47.47703813 39.37843059 50.22134996
+1113 Atom 1 1 1 1
+1 1 1 46.20015420 40.73036075 46.15297121
+1114 Atom 1 1 1 1
+1 1 1 48.88960268 40.75237837 48.92513433
+1115 Atom 1 1 1 1
+1 1 1 48.87365996 43.44795922 46.14847878
+1116 Atom 1 1 1 1
+1 1 1 46.18829103 43.44954746 48.89182288
+1117 Atom 1 1 1 1
+1 1 1 47.56985170 42.10106810 47.56191811
+1118 Atom 1 1 1 1
+1 1 1 50.23819039 42.07198140 50.26593555
+1119 Atom 1 1 1 1
+1 1 1 50.19466572 44.80542193 47.50726992
+1120 Atom 1 1 1 1
+1 1 1 47.49458210 44.82764526 50.24354778
+1121 Atom 1 1 1 1
+1 1 1 46.16677001 46.20286453 46.13522614
+1122 Atom 1 1 1 1
+1 1 1 48.86044908 46.13838657 48.92322707
+1123 Atom 1 1 1 1
+1 1 1 48.86937827 48.87202091 46.17767676
+1124 Atom 1 1 1 1
+1 1 1 46.12626758 48.91995698 48.86697976
+1125 Atom 1 1 1 1
+1 1 1 47.51905252 47.49451312 47.53647965
+1126 Atom 1 1 1 1
+1 1 1 50.24782895 47.53272262 50.28105802
+1127 Atom 1 1 1 1
+1 1 1 50.27823643 50.28529439 47.48446963
+1128 Atom 1 1 1 1
+1 1 1 47.48908268 50.18815911 50.19913917
+1129 Atom 1 1 1 1
+1 1 1 46.16318211 51.61957248 46.18622764
+1130 Atom 1 1 1 1
+1 1 1 48.85340910 51.63320861 48.84225507
+1131 Atom 1 1 1 1
+1 1 1 48.87483173 54.32595697 46.15000912
+1132 Atom 1 1 1 1
+1 1 1 46.20168020 54.28527755 48.86336378
+1133 Atom 1 1 1 1
+1 1 1 47.57073135 52.99745683 47.54053348
+1134 Atom 1 1 1 1
+1 1 1 50.22127007 52.99794242 50.23782091
+1135 Atom 1 1 1 1
+1 1 1 50.19610809 55.64594512 47.56342443
+1136 Atom 1 1 1 1
+1 1 1 47.51996472 55.70074798 50.22339872
+1137 Atom 1 1 1 1
+1 1 1 46.16106758 57.02050683 46.15606263
+1138 Atom 1 1 1 1
+1 1 1 48.92383921 56.98022734 48.83831519
+1139 Atom 1 1 1 1
+1 1 1 48.83842356 59.69459995 46.13155326
+1140 Atom 1 1 1 1
+1 1 1 46.13336793 59.71367643 48.90091621
+1141 Atom 1 1 1 1
+1 1 1 47.52719718 58.36185708 47.47574007
+1142 Atom 1 1 1 1
+1 1 1 50.21913268 58.34616589 50.26289041
+1143 Atom 1 1 1 1
+1 1 1 50.21996436 61.11191455 47.55660023
+1144 Atom 1 1 1 1
+1 1 1 47.50744354 61.12421915 50.19583963
+1145 Atom 1 1 1 1
+1 1 1 46.18107989 62.46622574 46.15844229
+1146 Atom 1 1 1 1
+1 1 1 48.86221905 62.45766645 48.91209676
+1147 Atom 1 1 1 1
+1 1 1 48.85330256 65.21861748 46.15034137
+1148 Atom 1 1 1 1
+1 1 1 46.17813691 65.19131003 48.86238541
+1149 Atom 1 1 1 1
+1 1 1 47.53550376 63.78509952 47.53410780
+1150 Atom 1 1 1 1
+1 1 1 50.22042912 63.84313132 50.27598189
+1151 Atom 1 1 1 1
+1 1 1 50.27727214 66.57069847 47.48139769
+1152 Atom 1 1 1 1
+1 1 1 47.51197427 66.52277102 50.24423040
+1153 Atom 1 1 1 1
+1 1 1 46.15903250 67.92068486 46.13833341
+1154 Atom 1 1 1 1
+1 1 1 48.85999574 67.85546358 48.91250565
+1155 Atom 1 1 1 1
+1 1 1 48.83505456 70.61912400 46.12959702
+1156 Atom 1 1 1 1
+1 1 1 46.15661765 70.60462532 48.89284604
+1157 Atom 1 1 1 1
+1 1 1 47.56883079 69.24975587 47.49874411
+1158 Atom 1 1 1 1
+1 1 1 50.20946896 69.26426423 50.19739165
+1159 Atom 1 1 1 1
+1 1 1 50.22986340 71.98482663 47.55869608
+1160 Atom 1 1 1 1
+1 1 1 47.50655486 71.97536125 50.22015093
+1161 Atom 1 1 1 1
+1 1 1 46.14663124 73.34810668 46.15627618
+1162 Atom 1 1 1 1
+1 1 1 48.88719371 73.27522430 48.87305203
+1163 Atom 1 1 1 1
+1 1 1 48.89512079 76.06669519 46.17595478
+1164 Atom 1 1 1 1
+1 1 1 46.15212176 76.01321312 48.85609107
+1165 Atom 1 1 1 1
+1 1 1 47.56487151 74.68624128 47.50440353
+1166 Atom 1 1 1 1
+1 1 1 50.21023230 74.68285514 50.24523340
+1167 Atom 1 1 1 1
+1 1 1 50.23817298 77.37811344 47.48075653
+1168 Atom 1 1 1 1
+1 1 1 47.51362740 77.38357751 50.19773063
+1169 Atom 1 1 1 1
+1 1 1 46.17309086 78.78609642 46.17605720
+1170 Atom 1 1 1 1
+1 1 1 48.83911059 78.71698774 48.90485904
+1171 Atom 1 1 1 1
+1 1 1 48.84960460 81.43753396 46.15962277
+1172 Atom 1 1 1 1
+1 1 1 46.11874685 81.51040265 48.90434189
+1173 Atom 1 1 1 1
+1 1 1 47.55713128 80.10263112 47.51017461
+1174 Atom 1 1 1 1
+1 1 1 50.20041279 80.08596548 50.23410442
+1175 Atom 1 1 1 1
+1 1 1 50.27463034 82.81562523 47.56442114
+1176 Atom 1 1 1 1
+1 1 1 47.55125812 82.85624317 50.26845782
+1177 Atom 1 1 1 1
+1 1 1 46.12118503 84.22143829 46.20812412
+1178 Atom 1 1 1 1
+1 1 1 48.84780327 84.18196678 48.92520412
+1179 Atom 1 1 1 1
+1 1 1 48.90160284 86.91340562 46.12765862
+1180 Atom 1 1 1 1
+1 1 1 46.13498333 86.90642359 48.91698040
+1181 Atom 1 1 1 1
+1 1 1 47.56674800 85.53744381 47.51556331
+1182 Atom 1 1 1 1
+1 1 1 50.20912242 85.53721626 50.19095612
+1183 Atom 1 1 1 1
+1 1 1 50.27165475 88.24269759 47.53838018
+1184 Atom 1 1 1 1
+1 1 1 47.51443349 88.23936997 50.18734963
+1185 Atom 1 1 1 1
+1 1 1 51.57083756 2.67983907 46.11622208
+1186 Atom 1 1 1 1
+1 1 1 54.28327421 2.71518173 48.88841393
+1187 Atom 1 1 1 1
+1 1 1 54.32344765 5.43837038 46.12753532
+1188 Atom 1 1 1 1
+1 1 1 51.58167900 5.42394187 48.83650795
+1189 Atom 1 1 1 1
+1 1 1 52.90308239 4.04607207 47.47587225
+1190 Atom 1 1 1 1
+1 1 1 55.63421850 4.02797236 50.22013073
+1191 Atom 1 1 1 1
+1 1 1 55.62377023 6.74340209 47.54262759
+1192 Atom 1 1 1 1
+1 1 1 52.97450999 6.82287905 50.18904437
+1193 Atom 1 1 1 1
+1 1 1 51.62602633 8.18708013 46.15255976
+1194 Atom 1 1 1 1
+1 1 1 54.35635648 8.15028754 48.88767115
+1195 Atom 1 1 1 1
+1 1 1 54.29234717 10.89285576 46.15462453
+1196 Atom 1 1 1 1
+1 1 1 51.56019746 10.87153527 48.88055595
+1197 Atom 1 1 1 1
+1 1 1 52.93905945 9.47304273 47.55218334
+1198 Atom 1 1 1 1
+1 1 1 55.63736735 9.47337305 50.27749313
+1199 Atom 1 1 1 1
+1 1 1 55.71621432 12.19231494 47.48372185
+1200 Atom 1 1 1 1
+1 1 1 52.99651797 12.18824379 50.22476379
+1201 Atom 1 1 1 1
+1 1 1 51.56323763 13.62501746 46.17454316
+1202 Atom 1 1 1 1
+1 1 1 54.27996249 13.62422957 48.87828252
+1203 Atom 1 1 1 1
+1 1 1 54.29236251 16.29166109 46.13260975
+1204 Atom 1 1 1 1
+1 1 1 51.59345130 16.26734962 48.91113740
+1205 Atom 1 1 1 1
+1 1 1 52.91729263 14.91491147 47.55901854
+1206 Atom 1 1 1 1
+1 1 1 55.64716770 14.97064987 50.28663236
+1207 Atom 1 1 1 1
+1 1 1 55.68862166 17.65569084 47.54498945
+1208 Atom 1 1 1 1
+1 1 1 52.94925910 17.64203555 50.25251445
+1209 Atom 1 1 1 1
+1 1 1 51.54614555 18.98903815 46.11798312
+1210 Atom 1 1 1 1
+1 1 1 54.32835929 18.96658671 48.87625541
+1211 Atom 1 1 1 1
+1 1 1 54.31932737 21.71510191 46.17384938
+1212 Atom 1 1 1 1
+1 1 1 51.63346124 21.68570667 48.86682222
+1213 Atom 1 1 1 1
+1 1 1 52.96834977 20.40766762 47.54824999
+1214 Atom 1 1 1 1
+1 1 1 55.70765441 20.34153506 50.19408533
+1215 Atom 1 1 1 1
+1 1 1 55.65030565 23.11848137 47.50317483
+1216 Atom 1 1 1 1
+1 1 1 52.96252178 23.03533591 50.23640388
+1217 Atom 1 1 1 1
+1 1 1 51.61228831 24.41922351 46.19547014
+1218 Atom 1 1 1 1
+1 1 1 54.29263434 24.46498868 48.84459905
+1219 Atom 1 1 1 1
+1 1 1 54.26802607 27.18255679 46.14303621
+1220 Atom 1 1 1 1
+1 1 1 51.55045909 27.17727358 48.87446062
+1221 Atom 1 1 1 1
+1 1 1 52.92213680 25.81841722 47.48576754
+1222 Atom 1 1 1 1
+1 1 1 55.63343988 25.76624179 50.23315298
+1223 Atom 1 1 1 1
+1 1 1 55.63884583 28.55301853 47.49023021
+1224 Atom 1 1 1 1
+1 1 1 52.95392989 28.46750242 50.24464591
+1225 Atom 1 1 1 1
+1 1 1 51.55279504 29.88704132 46.13778582
+1226 Atom 1 1 1 1
+1 1 1 54.35448965 29.89462078 48.86416116
+1227 Atom 1 1 1 1
+1 1 1 54.26658596 32.55801747 46.19841836
+1228 Atom 1 1 1 1
+1 1 1 51.62439135 32.59230263 48.87766357
+1229 Atom 1 1 1 1
+1 1 1 52.99765823 31.24949424 47.51397509
+1230 Atom 1 1 1 1
+1 1 1 55.70514581 31.26180292 50.23419862
+1231 Atom 1 1 1 1
+1 1 1 55.65731299 33.98014037 47.51967385
+1232 Atom 1 1 1 1
+1 1 1 52.97468470 33.96882548 50.21582387
+1233 Atom 1 1 1 1
+1 1 1 51.64291637 35.33497524 46.15256773
+1234 Atom 1 1 1 1
+1 1 1 54.32524845 35.29759562 48.83155073
+1235 Atom 1 1 1 1
+1 1 1 54.34297264 37.97760396 46.12306851
+1236 Atom 1 1 1 1
+1 1 1 51.62608313 38.02735452 48.90010669
+1237 Atom 1 1 1 1
+1 1 1 52.99931576 36.69914181 47.55387993
+1238 Atom 1 1 1 1
+1 1 1 55.70972150 36.65638016 50.23838374
+1239 Atom 1 1 1 1
+1 1 1 55.62916825 39.39052162 47.51068084
+1240 Atom 1 1 1 1
+1 1 1 52.93440250 39.38082382 50.27750992
+1241 Atom 1 1 1 1
+1 1 1 51.57505585 40.71355198 46.17720484
+1242 Atom 1 1 1 1
+1 1 1 54.34352919 40.74607650 48.88856663
+1243 Atom 1 1 1 1
+1 1 1 54.33343060 43.43143533 46.16915088
+1244 Atom 1 1 1 1
+1 1 1 51.61163835 43.48689105 48.92165285
+1245 Atom 1 1 1 1
+1 1 1 52.98879207 42.12065930 47.55266710
+1246 Atom 1 1 1 1
+1 1 1 55.63918601 42.13866210 50.28616129
+1247 Atom 1 1 1 1
+1 1 1 55.68457329 44.78461095 47.51532477
+1248 Atom 1 1 1 1
+1 1 1 52.90407146 44.76542613 50.27386307
+1249 Atom 1 1 1 1
+1 1 1 51.57524978 46.15978647 46.20629302
+1250 Atom 1 1 1 1
+1 1 1 54.26007254 46.17467559 48.86406610
+1251 Atom 1 1 1 1
+1 1 1 54.33256872 48.87430762 46.21288739
+1252 Atom 1 1 1 1
+1 1 1 51.62223785 48.83082622 48.89879732
+1253 Atom 1 1 1 1
+1 1 1 52.92092089 47.54279689 47.51438468
+1254 Atom 1 1 1 1
+1 1 1 55.63890543 47.51818852 50.22926761
+1255 Atom 1 1 1 1
+1 1 1 55.71509249 50.24325066 47.52205167
+1256 Atom 1 1 1 1
+1 1 1 52.96871214 50.25089406 50.20410645
+1257 Atom 1 1 1 1
+1 1 1 51.55549594 51.55935663 46.16962367
+1258 Atom 1 1 1 1
+1 1 1 54.32616236 51.59008519 48.84546557
+1259 Atom 1 1 1 1
+1 1 1 54.31030154 54.26655862 46.12835729
+1260 Atom 1 1 1 1
+1 1 1 51.61009964 54.28982028 48.92713068
+1261 Atom 1 1 1 1
+1 1 1 52.97450905 52.94814839 47.56192392
+1262 Atom 1 1 1 1
+1 1 1 55.62543842 52.99399271 50.27590537
+1263 Atom 1 1 1 1
+1 1 1 55.62526691 55.71130138 47.54698066
+1264 Atom 1 1 1 1
+1 1 1 52.91391761 55.65747889 50.23938491
+1265 Atom 1 1 1 1
+1 1 1 51.63976467 57.01354849 46.20099829
+1266 Atom 1 1 1 1
+1 1 1 54.32002724 57.03997285 48.85072223
+1267 Atom 1 1 1 1
+1 1 1 54.35239805 59.77988253 46.18364746
+1268 Atom 1 1 1 1
+1 1 1 51.64124369 59.69461700 48.89286627
+1269 Atom 1 1 1 1
+1 1 1 52.98601712 58.39669309 47.47296594
+1270 Atom 1 1 1 1
+1 1 1 55.69478396 58.42684894 50.22150428
+1271 Atom 1 1 1 1
+1 1 1 55.67776301 61.06473000 47.47250817
+1272 Atom 1 1 1 1
+1 1 1 52.95169353 61.10711011 50.28329072
+1273 Atom 1 1 1 1
+1 1 1 51.57532414 62.44134816 46.20646947
+1274 Atom 1 1 1 1
+1 1 1 54.31899308 62.45716431 48.88488461
+1275 Atom 1 1 1 1
+1 1 1 54.30647175 65.14870351 46.18754271
+1276 Atom 1 1 1 1
+1 1 1 51.60734469 65.17199780 48.87174430
+1277 Atom 1 1 1 1
+1 1 1 52.92697712 63.83281038 47.48626772
+1278 Atom 1 1 1 1
+1 1 1 55.67843284 63.84534981 50.20282029
+1279 Atom 1 1 1 1
+1 1 1 55.67335655 66.57495639 47.53598607
+1280 Atom 1 1 1 1
+1 1 1 52.97484232 66.53725645 50.21182704
+1281 Atom 1 1 1 1
+1 1 1 51.61200087 67.86499524 46.19685417
+1282 Atom 1 1 1 1
+1 1 1 54.31807161 67.87508598 48.91076579
+1283 Atom 1 1 1 1
+1 1 1 54.33081405 70.65229852 46.20416628
+1284 Atom 1 1 1 1
+1 1 1 51.63933159 70.59987648 48.84621352
+1285 Atom 1 1 1 1
+1 1 1 52.94992808 69.20567032 47.54070453
+1286 Atom 1 1 1 1
+1 1 1 55.69895128 69.26307471 50.23886821
+1287 Atom 1 1 1 1
+1 1 1 55.69403963 71.99155468 47.56360968
+1288 Atom 1 1 1 1
+1 1 1 52.95053805 71.93170464 50.21789945
+1289 Atom 1 1 1 1
+1 1 1 51.55667079 73.35861614 46.19350528
+1290 Atom 1 1 1 1
+1 1 1 54.26182455 73.27782763 48.89308247
+1291 Atom 1 1 1 1
+1 1 1 54.32178540 76.06559127 46.18245852
+1292 Atom 1 1 1 1
+1 1 1 51.61041327 76.00243505 48.87595478
+1293 Atom 1 1 1 1
+1 1 1 52.99885897 74.65173961 47.47132114
+1294 Atom 1 1 1 1
+1 1 1 55.68695800 74.69576519 50.28265814
+1295 Atom 1 1 1 1
+1 1 1 55.71447668 77.37647639 47.50355462
+1296 Atom 1 1 1 1
+1 1 1 52.97233538 77.35122371 50.18763854
+1297 Atom 1 1 1 1
+1 1 1 51.61599124 78.74669441 46.15683170
+1298 Atom 1 1 1 1
+1 1 1 54.26101094 78.78757581 48.83198675
+1299 Atom 1 1 1 1
+1 1 1 54.33748838 81.45968890 46.13789359
+1300 Atom 1 1 1 1
+1 1 1 51.60905932 81.43806973 48.89415336
+1301 Atom 1 1 1 1
+1 1 1 52.91598809 80.12304692 47.52082749
+1302 Atom 1 1 1 1
+1 1 1 55.63051280 80.11831120 50.24790528
+1303 Atom 1 1 1 1
+1 1 1 55.63519288 82.78063137 47.47995112
+1304 Atom 1 1 1 1
+1 1 1 52.92929346 82.77655761 50.20680743
+1305 Atom 1 1 1 1
+1 1 1 51.54649342 84.20141326 46.13321051
+1306 Atom 1 1 1 1
+1 1 1 54.35577420 84.21985280 48.84932742
+1307 Atom 1 1 1 1
+1 1 1 54.35238802 86.85957231 46.11716528
+1308 Atom 1 1 1 1
+1 1 1 51.56671257 86.89922550 48.84692893
+1309 Atom 1 1 1 1
+1 1 1 52.94774720 85.52572696 47.56066402
+1310 Atom 1 1 1 1
+1 1 1 55.69706325 85.58199788 50.19022914
+1311 Atom 1 1 1 1
+1 1 1 55.65384889 88.25519574 47.50844901
+1312 Atom 1 1 1 1
+1 1 1 52.94504515 88.23269646 50.20251630
+1313 Atom 1 1 1 1
+1 1 1 56.98349017 2.70298972 46.18991268
+1314 Atom 1 1 1 1
+1 1 1 59.73277831 2.75369919 48.86972364
+1315 Atom 1 1 1 1
+1 1 1 59.77418335 5.39165314 46.18426650
+1316 Atom 1 1 1 1
+1 1 1 56.99297470 5.47545029 48.91721495
+1317 Atom 1 1 1 1
+1 1 1 58.33619272 4.04359165 47.56354977
+1318 Atom 1 1 1 1
+1 1 1 61.11137909 4.06878124 50.27010302
+1319 Atom 1 1 1 1
+1 1 1 61.07120630 6.79475167 47.52597798
+1320 Atom 1 1 1 1
+1 1 1 58.34649999 6.78052366 50.28433152
+1321 Atom 1 1 1 1
+1 1 1 57.00956021 8.14199408 46.17821600
+1322 Atom 1 1 1 1
+1 1 1 59.73618274 8.10721159 48.86750857
+1323 Atom 1 1 1 1
+1 1 1 59.76180103 10.85177807 46.12352691
+1324 Atom 1 1 1 1
+1 1 1 56.98107025 10.89743940 48.85697362
+1325 Atom 1 1 1 1
+1 1 1 58.36663078 9.52914669 47.56163093
+1326 Atom 1 1 1 1
+1 1 1 61.13807991 9.50279878 50.28426282
+1327 Atom 1 1 1 1
+1 1 1 61.13339946 12.17497948 47.48277651
+1328 Atom 1 1 1 1
+1 1 1 58.40463159 12.22457476 50.26941085
+1329 Atom 1 1 1 1
+1 1 1 57.01532840 13.62094377 46.14301842
+1330 Atom 1 1 1 1
+1 1 1 59.75492924 13.60462410 48.83483071
+1331 Atom 1 1 1 1
+1 1 1 59.75547878 16.26572705 46.20888183
+1332 Atom 1 1 1 1
+1 1 1 57.04159803 16.34171385 48.86134733
+1333 Atom 1 1 1 1
+1 1 1 58.37816847 14.95699496 47.55758963
+1334 Atom 1 1 1 1
+1 1 1 61.12472420 14.92620669 50.24612833
+1335 Atom 1 1 1 1
+1 1 1 61.12936543 17.64430568 47.47698107
+1336 Atom 1 1 1 1
+1 1 1 58.37177854 17.64409807 50.22993535
+1337 Atom 1 1 1 1
+1 1 1 57.01145288 19.01148067 46.18945438
+1338 Atom 1 1 1 1
+1 1 1 59.70912396 19.03110689 48.86924557
+1339 Atom 1 1 1 1
+1 1 1 59.71799815 21.68903538 46.19948936
+1340 Atom 1 1 1 1
+1 1 1 56.99057239 21.68903656 48.91688288
+1341 Atom 1 1 1 1
+1 1 1 58.36673015 20.32794317 47.49547721
+1342 Atom 1 1 1 1
+1 1 1 61.10087786 20.36465943 50.26349715
+1343 Atom 1 1 1 1
+1 1 1 61.14721260 23.03707222 47.47726065
+1344 Atom 1 1 1 1
+1 1 1 58.34169474 23.11953363 50.19800804
+1345 Atom 1 1 1 1
+1 1 1 57.01056104 24.38952974 46.20838146
+1346 Atom 1 1 1 1
+1 1 1 59.73545262 24.45536661 48.87977750
+1347 Atom 1 1 1 1
+1 1 1 59.69695847 27.20124238 46.15303128
+1348 Atom 1 1 1 1
+1 1 1 57.04875615 27.19492253 48.88999462
+1349 Atom 1 1 1 1
+1 1 1 58.35235158 25.79289050 47.51367604
+1350 Atom 1 1 1 1
+1 1 1 61.13566126 25.79533040 50.23445915
+1351 Atom 1 1 1 1
+1 1 1 61.10719875 28.55006451 47.51149718
+1352 Atom 1 1 1 1
+1 1 1 58.34290693 28.47551987 50.24748197
+1353 Atom 1 1 1 1
+1 1 1 57.07238193 29.89654736 46.15194091
+1354 Atom 1 1 1 1
+1 1 1 59.78144686 29.86142036 48.89378525
+1355 Atom 1 1 1 1
+1 1 1 59.70299379 32.57732354 46.15836693
+1356 Atom 1 1 1 1
+1 1 1 57.00134468 32.61096072 48.92005992
+1357 Atom 1 1 1 1
+1 1 1 58.36437635 31.20251890 47.48969268
+1358 Atom 1 1 1 1
+1 1 1 61.05543672 31.27139085 50.25462840
+1359 Atom 1 1 1 1
+1 1 1 61.07063193 33.98108567 47.52266122
+1360 Atom 1 1 1 1
+1 1 1 58.41908607 33.94305159 50.24796135
+1361 Atom 1 1 1 1
+1 1 1 56.99743156 35.34496098 46.18806134
+1362 Atom 1 1 1 1
+1 1 1 59.71964955 35.33248365 48.86303654
+1363 Atom 1 1 1 1
+1 1 1 59.70651605 38.01516580 46.17416172
+1364 Atom 1 1 1 1
+1 1 1 57.04957221 38.05178087 48.90494254
+1365 Atom 1 1 1 1
+1 1 1 58.40334801 36.66708372 47.49144457
+1366 Atom 1 1 1 1
+1 1 1 61.13392459 36.61417856 50.25973017
+1367 Atom 1 1 1 1
+1 1 1 61.10715968 39.41939779 47.54951383
+1368 Atom 1 1 1 1
+1 1 1 58.42273306 39.42438727 50.26843498
+1369 Atom 1 1 1 1
+1 1 1 57.02944688 40.70420944 46.12737551
+1370 Atom 1 1 1 1
+1 1 1 59.70383605 40.69858476 48.90921652
+1371 Atom 1 1 1 1
+1 1 1 59.76509472 43.43330381 46.16616825
+1372 Atom 1 1 1 1
+1 1 1 56.97708788 43.43780039 48.85428214
+1373 Atom 1 1 1 1
+1 1 1 58.37221705 42.09741586 47.53538300
+1374 Atom 1 1 1 1
+1 1 1 61.14522780 42.10575198 50.27230432
+1375 Atom 1 1 1 1
+1 1 1 61.13321155 44.85519525 47.47303901
+1376 Atom 1 1 1 1
+1 1 1 58.34648572 44.83823351 50.19264593
+1377 Atom 1 1 1 1
+1 1 1 57.05581621 46.18889286 46.20998978
+1378 Atom 1 1 1 1
+1 1 1 59.70601632 46.14465257 48.92631125
+1379 Atom 1 1 1 1
+1 1 1 59.71362203 48.91529333 46.19793335
+1380 Atom 1 1 1 1
+1 1 1 56.98028710 48.91972743 48.88433082
+1381 Atom 1 1 1 1
+1 1 1 58.41478923 47.56121426 47.52924792
+1382 Atom 1 1 1 1
+1 1 1 61.08057145 47.54314097 50.21721271
+1383 Atom 1 1 1 1
+1 1 1 61.12783955 50.22193963 47.51754281
+1384 Atom 1 1 1 1
+1 1 1 58.38471421 50.24740798 50.28379584
+1385 Atom 1 1 1 1
+1 1 1 57.03171050 51.59144418 46.14849973
+1386 Atom 1 1 1 1
+1 1 1 59.79016965 51.59744249 48.84656603
+1387 Atom 1 1 1 1
+1 1 1 59.72278860 54.26116401 46.19394936
+1388 Atom 1 1 1 1
+1 1 1 57.03071082 54.30520409 48.91700648
+1389 Atom 1 1 1 1
+1 1 1 58.34269122 52.92922180 47.56669840
+1390 Atom 1 1 1 1
+1 1 1 61.07185929 52.99862677 50.27634275
+1391 Atom 1 1 1 1
+1 1 1 61.06364877 55.68422154 47.51921261
+1392 Atom 1 1 1 1
+1 1 1 58.39906086 55.66299209 50.26357885
+1393 Atom 1 1 1 1
+1 1 1 57.04271478 57.03423096 46.18455939
+1394 Atom 1 1 1 1
+1 1 1 59.77510711 57.02658308 48.83403188
+1395 Atom 1 1 1 1
+1 1 1 59.73109431 59.70884247 46.13580602
+1396 Atom 1 1 1 1
+1 1 1 56.98178330 59.75108192 48.87764053
+1397 Atom 1 1 1 1
+1 1 1 58.40090338 58.33417883 47.53776748
+1398 Atom 1 1 1 1
+1 1 1 61.09831744 58.37093447 50.26810147
+1399 Atom 1 1 1 1
+1 1 1 61.14084669 61.13011649 47.56409775
+1400 Atom 1 1 1 1
+1 1 1 58.41665180 61.06830668 50.20418955
+1401 Atom 1 1 1 1
+1 1 1 57.05863398 62.46919500 46.15728430
+1402 Atom 1 1 1 1
+1 1 1 59.72065074 62.45923243 48.85295207
+1403 Atom 1 1 1 1
+1 1 1 59.74313841 65.21481805 46.16473365
+1404 Atom 1 1 1 1
+1 1 1 56.97833280 65.17636842 48.90289987
+1405 Atom 1 1 1 1
+1 1 1 58.39415129 63.85392190 47.57086877
+1406 Atom 1 1 1 1
+1 1 1 61.12420336 63.83802367 50.28536368
+1407 Atom 1 1 1 1
+1 1 1 61.08251423 66.51131692 47.47186062
+1408 Atom 1 1 1 1
+1 1 1 58.42948231 66.50450779 50.19898333
+1409 Atom 1 1 1 1
+1 1 1 57.03092276 67.91995480 46.14947894
+1410 Atom 1 1 1 1
+1 1 1 59.72574076 67.91534966 48.84383361
+1411 Atom 1 1 1 1
+1 1 1 59.70695705 70.58915762 46.14319230
+1412 Atom 1 1 1 1
+1 1 1 57.00656572 70.63973204 48.84780535
+1413 Atom 1 1 1 1
+1 1 1 58.39630290 69.29058137 47.47624750
+1414 Atom 1 1 1 1
+1 1 1 61.14452190 69.20063438 50.23623859
+1415 Atom 1 1 1 1
+1 1 1 61.13141553 71.94701209 47.52021957
+1416 Atom 1 1 1 1
+1 1 1 58.35880420 71.93687766 50.25075361
+1417 Atom 1 1 1 1
+1 1 1 57.03083154 73.33308317 46.17698978
+1418 Atom 1 1 1 1
+1 1 1 59.69991949 73.29483624 48.87578917
+1419 Atom 1 1 1 1
+1 1 1 59.70303507 75.99277883 46.14175457
+1420 Atom 1 1 1 1
+1 1 1 56.98503484 76.01844726 48.84282877
+1421 Atom 1 1 1 1
+1 1 1 58.33442252 74.63471345 47.54852570
+1422 Atom 1 1 1 1
+1 1 1 61.12090681 74.65697317 50.23383940
+1423 Atom 1 1 1 1
+1 1 1 61.11635365 77.35323948 47.55754228
+1424 Atom 1 1 1 1
+1 1 1 58.42264818 77.44021440 50.26092662
+1425 Atom 1 1 1 1
+1 1 1 57.04894550 78.78329141 46.19292337
+1426 Atom 1 1 1 1
+1 1 1 59.72727698 78.73575956 48.92579343
+1427 Atom 1 1 1 1
+1 1 1 59.78663029 81.47897114 46.15016124
+1428 Atom 1 1 1 1
+1 1 1 57.04026473 81.41872184 48.86923458
+1429 Atom 1 1 1 1
+1 1 1 58.37863775 80.07686957 47.53713203
+1430 Atom 1 1 1 1
+1 1 1 61.05191598 80.09820301 50.20118684
+1431 Atom 1 1 1 1
+1 1 1 61.10149312 82.87152730 47.56294704
+1432 Atom 1 1 1 1
+1 1 1 58.37856215 82.85679418 50.20345564
+1433 Atom 1 1 1 1
+1 1 1 57.00706719 84.16592356 46.18018161
+1434 Atom 1 1 1 1
+1 1 1 59.78823950 84.18383065 48.92748999
+1435 Atom 1 1 1 1
+1 1 1 59.75150689 86.92766698 46.20168738
+1436 Atom 1 1 1 1
+1 1 1 57.04454331 86.92368473 48.87372843
+1437 Atom 1 1 1 1
+1 1 1 58.42184510 85.50314639 47.55660094
+1438 Atom 1 1 1 1
+1 1 1 61.11971350 85.49850904 50.18765165
+1439 Atom 1 1 1 1
+1 1 1 61.08577323 88.28505456 47.51867310
+1440 Atom 1 1 1 1
+1 1 1 58.41447470 88.25075770 50.20053110
+1441 Atom 1 1 1 1
+1 1 1 62.40861678 2.73189192 46.19504729
+1442 Atom 1 1 1 1
+1 1 1 65.17059836 2.67294559 48.86371658
+1443 Atom 1 1 1 1
+1 1 1 65.15227030 5.46510229 46.15023084
+1444 Atom 1 1 1 1
+1 1 1 62.47639631 5.42438796 48.85061882
+1445 Atom 1 1 1 1
+1 1 1 63.80032019 4.03353197 47.47539573
+1446 Atom 1 1 1 1
+1 1 1 66.57681442 4.04751095 50.28360701
+1447 Atom 1 1 1 1
+1 1 1 66.52375397 6.82875889 47.48618247
+1448 Atom 1 1 1 1
+1 1 1 63.76455962 6.74297810 50.27897887
+1449 Atom 1 1 1 1
+1 1 1 62.48882183 8.13375965 46.17066176
+1450 Atom 1 1 1 1
+1 1 1 65.15927653 8.11542948 48.90162983
+1451 Atom 1 1 1 1
+1 1 1 65.13155851 10.90813475 46.15658674
+1452 Atom 1 1 1 1
+1 1 1 62.43935435 10.87570457 48.87054695
+1453 Atom 1 1 1 1
+1 1 1 63.83289809 9.54907610 47.48553080
+1454 Atom 1 1 1 1
+1 1 1 66.56069449 9.45962165 50.24394600
+1455 Atom 1 1 1 1
+1 1 1 66.50572277 12.24696500 47.54983506
+1456 Atom 1 1 1 1
+1 1 1 63.78246408 12.20406645 50.20237149
+1457 Atom 1 1 1 1
+1 1 1 62.49322627 13.58257646 46.14914790
+1458 Atom 1 1 1 1
+1 1 1 65.19633235 13.52833488 48.85087523
+1459 Atom 1 1 1 1
+1 1 1 65.14986410 16.33540288 46.14772568
+1460 Atom 1 1 1 1
+1 1 1 62.45087986 16.27039842 48.85233784
+1461 Atom 1 1 1 1
+1 1 1 63.80051315 14.98447206 47.53317722
+1462 Atom 1 1 1 1
+1 1 1 66.49354767 14.93031037 50.26733254
+1463 Atom 1 1 1 1
+1 1 1 66.56549402 17.62320811 47.50453814
+1464 Atom 1 1 1 1
+1 1 1 63.77749189 17.69386945 50.28341413
+1465 Atom 1 1 1 1
+1 1 1 62.42202113 19.00971321 46.14061926
+1466 Atom 1 1 1 1
+1 1 1 65.19755163 18.96356448 48.84529933
+1467 Atom 1 1 1 1
+1 1 1 65.18212194 21.76259495 46.21253805
+1468 Atom 1 1 1 1
+1 1 1 62.42502042 21.73940746 48.91927727
+1469 Atom 1 1 1 1
+1 1 1 63.80277613 20.37237335 47.51610926
+1470 Atom 1 1 1 1
+1 1 1 66.48646661 20.35367769 50.20800343
+1471 Atom 1 1 1 1
+1 1 1 66.55790552 23.08066056 47.47362713
+1472 Atom 1 1 1 1
+1 1 1 63.83797549 23.10564040 50.25847620
+1473 Atom 1 1 1 1
+1 1 1 62.41293423 24.40480864 46.12109867
+1474 Atom 1 1 1 1
+1 1 1 65.19906183 24.47873650 48.92404054
+1475 Atom 1 1 1 1
+1 1 1 65.21396665 27.12703245 46.14634873
+1476 Atom 1 1 1 1
+1 1 1 62.49553969 27.19530125 48.83562877
+1477 Atom 1 1 1 1
+1 1 1 63.85376316 25.79274081 47.54019263
+1478 Atom 1 1 1 1
+1 1 1 66.54560299 25.81270285 50.22038244
+1479 Atom 1 1 1 1
+1 1 1 66.55723646 28.48133746 47.49197992
+1480 Atom 1 1 1 1
+1 1 1 63.80616232 28.48794655 50.27368769
+1481 Atom 1 1 1 1
+1 1 1 62.49348735 29.83384168 46.13339222
+1482 Atom 1 1 1 1
+1 1 1 65.18587838 29.88310006 48.88373846
+1483 Atom 1 1 1 1
+1 1 1 65.21407322 32.60133697 46.12138508
+1484 Atom 1 1 1 1
+1 1 1 62.43143704 32.63213185 48.85644507
+1485 Atom 1 1 1 1
+1 1 1 63.80829540 31.22810425 47.49149789
+1486 Atom 1 1 1 1
+1 1 1 66.54116532 31.19848416 50.26691419
+1487 Atom 1 1 1 1
+1 1 1 66.52922296 33.97710232 47.55519215
+1488 Atom 1 1 1 1
+1 1 1 63.77321318 33.89550900 50.21639538
+1489 Atom 1 1 1 1
+1 1 1 62.50300807 35.25463316 46.14491595
+1490 Atom 1 1 1 1
+1 1 1 65.16504427 35.34795413 48.90799031
+1491 Atom 1 1 1 1
+1 1 1 65.14166616 37.97887812 46.13345292
+1492 Atom 1 1 1 1
+1 1 1 62.48102363 38.05903167 48.89190859
+1493 Atom 1 1 1 1
+1 1 1 63.80094368 36.63683363 47.49455164
+1494 Atom 1 1 1 1
+1 1 1 66.49874229 36.70727247 50.21973807
+1495 Atom 1 1 1 1
+1 1 1 66.48294676 39.40871985 47.56987998
+1496 Atom 1 1 1 1
+1 1 1 63.80676439 39.40363908 50.20825340
+1497 Atom 1 1 1 1
+1 1 1 62.46948112 40.76240399 46.18571238
+1498 Atom 1 1 1 1
+1 1 1 65.14313345 40.71344076 48.86517468
+1499 Atom 1 1 1 1
+1 1 1 65.20057458 43.44750237 46.15198414
+1500 Atom 1 1 1 1
+1 1 1 62.42366192 43.49001846 48.86295100
+1501 Atom 1 1 1 1
+1 1 1 63.79098236 42.13674056 47.52571167
+1502 Atom 1 1 1 1
+1 1 1 66.54671111 42.09007898 50.22646949
+1503 Atom 1 1 1 1
+1 1 1 66.51233914 44.76958989 47.49337836
+1504 Atom 1 1 1 1
+1 1 1 63.78938473 44.78683444 50.19345146
+1505 Atom 1 1 1 1
+1 1 1 62.46786215 46.16748417 46.11389396
+1506 Atom 1 1 1 1
+1 1 1 65.15440720 46.20544361 48.84234568
+1507 Atom 1 1 1 1
+1 1 1 65.16816788 48.87721062 46.19091068
+1508 Atom 1 1 1 1
+1 1 1 62.47177866 48.83231232 48.83921178
+1509 Atom 1 1 1 1
+1 1 1 63.83889632 47.47366824 47.49331553
+1510 Atom 1 1 1 1
+1 1 1 66.50286889 47.49938831 50.28261122
+1511 Atom 1 1 1 1
+1 1 1 66.50998216 50.24190850 47.50732029
+1512 Atom 1 1 1 1
+1 1 1 63.76565540 50.23445813 50.22059565
+1513 Atom 1 1 1 1
+1 1 1 62.44569315 51.64206241 46.18537237
+1514 Atom 1 1 1 1
+1 1 1 65.21538905 51.58295764 48.86676142
+1515 Atom 1 1 1 1
+1 1 1 65.17281732 54.31571909 46.18571211
+1516 Atom 1 1 1 1
+1 1 1 62.43150888 54.26475424 48.85573926
+1517 Atom 1 1 1 1
+1 1 1 63.78786772 52.94725833 47.54697392
+1518 Atom 1 1 1 1
+1 1 1 66.56962316 52.92960637 50.23606494
+1519 Atom 1 1 1 1
+1 1 1 66.48921522 55.69163256 47.54552008
+1520 Atom 1 1 1 1
+1 1 1 63.83788060 55.68630050 50.26201822
+1521 Atom 1 1 1 1
+1 1 1 62.49980535 57.03919279 46.12519008
+1522 Atom 1 1 1 1
+1 1 1 65.18788263 57.06573448 48.87008990
+1523 Atom 1 1 1 1
+1 1 1 65.16959515 59.73967414 46.12100570
+1524 Atom 1 1 1 1
+1 1 1 62.49108174 59.76531715 48.91873434
+1525 Atom 1 1 1 1
+1 1 1 63.85504907 58.34470110 47.50261086
+1526 Atom 1 1 1 1
+1 1 1 66.54430510 58.41493481 50.22648908
+1527 Atom 1 1 1 1
+1 1 1 66.51081257 61.13701381 47.55043266
+1528 Atom 1 1 1 1
+1 1 1 63.83216892 61.12303971 50.22227350
+1529 Atom 1 1 1 1
+1 1 1 62.41072336 62.46331519 46.11503886
+1530 Atom 1 1 1 1
+1 1 1 65.16567634 62.50156722 48.92626369
+1531 Atom 1 1 1 1
+1 1 1 65.14431834 65.13348104 46.12420046
+1532 Atom 1 1 1 1
+1 1 1 62.40815031 65.13925735 48.85142247
+1533 Atom 1 1 1 1
+1 1 1 63.80198891 63.76542405 47.50629830
+1534 Atom 1 1 1 1
+1 1 1 66.51132471 63.84155828 50.21881631
+1535 Atom 1 1 1 1
+1 1 1 66.50018888 66.49660098 47.48774306
+1536 Atom 1 1 1 1
+1 1 1 63.82319476 66.57705556 50.24962113
+1537 Atom 1 1 1 1
+1 1 1 62.42072509 67.91826760 46.16094122
+1538 Atom 1 1 1 1
+1 1 1 65.15523917 67.87591878 48.85684979
+1539 Atom 1 1 1 1
+1 1 1 65.17137963 70.59044769 46.15122958
+1540 Atom 1 1 1 1
+1 1 1 62.49402422 70.59001584 48.92703602
+1541 Atom 1 1 1 1
+1 1 1 63.86198509 69.27801850 47.50091451
+1542 Atom 1 1 1 1
+1 1 1 66.48648029 69.21412193 50.26900110
+1543 Atom 1 1 1 1
+1 1 1 66.50506940 71.95052638 47.52268811
+1544 Atom 1 1 1 1
+1 1 1 63.85855054 71.91690056 50.26287918
+1545 Atom 1 1 1 1
+1 1 1 62.45471102 73.33870227 46.14496267
+1546 Atom 1 1 1 1
+1 1 1 65.21675492 73.28860377 48.91596154
+1547 Atom 1 1 1 1
+1 1 1 65.14772995 76.08381899 46.11633049
+1548 Atom 1 1 1 1
+1 1 1 62.46699392 76.06885267 48.91127526
+1549 Atom 1 1 1 1
+1 1 1 63.82677750 74.67941674 47.56081458
+1550 Atom 1 1 1 1
+1 1 1 66.49756594 74.70955347 50.28029559
+1551 Atom 1 1 1 1
+1 1 1 66.54315519 77.35486630 47.50777986
+1552 Atom 1 1 1 1
+1 1 1 63.84389437 77.44078696 50.21410995
+1553 Atom 1 1 1 1
+1 1 1 62.45349599 78.74812896 46.13385956
+1554 Atom 1 1 1 1
+1 1 1 65.21711512 78.79247377 48.86735810
+1555 Atom 1 1 1 1
+1 1 1 65.20342604 81.50791749 46.18432384
+1556 Atom 1 1 1 1
+1 1 1 62.43015184 81.51355154 48.86947767
+1557 Atom 1 1 1 1
+1 1 1 63.77190744 80.10329243 47.54423063
+1558 Atom 1 1 1 1
+1 1 1 66.56251210 80.07170459 50.21496208
+1559 Atom 1 1 1 1
+1 1 1 66.50569200 82.82768799 47.53724159
+1560 Atom 1 1 1 1
+1 1 1 63.77192434 82.86555625 50.19237999
+1561 Atom 1 1 1 1
+1 1 1 62.46080495 84.15600973 46.16287982
+1562 Atom 1 1 1 1
+1 1 1 65.13313755 84.19720727 48.87580836
+1563 Atom 1 1 1 1
+1 1 1 65.15795485 86.88683498 46.14112708
+1564 Atom 1 1 1 1
+1 1 1 62.47354892 86.88571660 48.86536641
+1565 Atom 1 1 1 1
+1 1 1 63.78045851 85.52145236 47.48241628
+1566 Atom 1 1 1 1
+1 1 1 66.53813092 85.48955396 50.27243978
+1567 Atom 1 1 1 1
+1 1 1 66.56768301 88.29525943 47.52018573
+1568 Atom 1 1 1 1
+1 1 1 63.79201607 88.28603355 50.26070345
+1569 Atom 1 1 1 1
+1 1 1 67.85704091 2.70762437 46.13374142
+1570 Atom 1 1 1 1
+1 1 1 70.59133988 2.69311506 48.84406335
+1571 Atom 1 1 1 1
+1 1 1 70.55378221 5.46300398 46.11993283
+1572 Atom 1 1 1 1
+1 1 1 67.86595441 5.39256391 48.86537116
+1573 Atom 1 1 1 1
+1 1 1 69.24168505 4.08513505 47.54896816
+1574 Atom 1 1 1 1
+1 1 1 71.96183110 4.10692443 50.23490678
+1575 Atom 1 1 1 1
+1 1 1 71.92091635 6.78106075 47.49074397
+1576 Atom 1 1 1 1
+1 1 1 69.26574242 6.80689920 50.19433196
+1577 Atom 1 1 1 1
+1 1 1 67.84633559 8.16851694 46.14987440
+1578 Atom 1 1 1 1
+1 1 1 70.55776263 8.11348521 48.91779968
+1579 Atom 1 1 1 1
+1 1 1 70.64047959 10.82808373 46.15826268
+1580 Atom 1 1 1 1
+1 1 1 67.87142998 10.85475157 48.92799306
+1581 Atom 1 1 1 1
+1 1 1 69.26556304 9.53222217 47.56744735
+1582 Atom 1 1 1 1
+1 1 1 71.92623510 9.50267766 50.23806384
+1583 Atom 1 1 1 1
+1 1 1 71.95470950 12.23047466 47.56836655
+1584 Atom 1 1 1 1
+1 1 1 69.21896652 12.25362132 50.26491072
+1585 Atom 1 1 1 1
+1 1 1 67.89693138 13.62407798 46.21049977
+1586 Atom 1 1 1 1
+1 1 1 70.62334839 13.61069774 48.90853024
+1587 Atom 1 1 1 1
+1 1 1 70.61722831 16.32331072 46.13369616
+1588 Atom 1 1 1 1
+1 1 1 67.85777604 16.29205077 48.89624176
+1589 Atom 1 1 1 1
+1 1 1 69.28122904 14.97257359 47.53458630
+1590 Atom 1 1 1 1
+1 1 1 71.93020778 14.94898358 50.26709589
+1591 Atom 1 1 1 1
+1 1 1 72.00934846 17.61583006 47.56545756
+1592 Atom 1 1 1 1
+1 1 1 69.21835494 17.68750397 50.23920052
+1593 Atom 1 1 1 1
+1 1 1 67.89202428 18.97377178 46.16009019
+1594 Atom 1 1 1 1
+1 1 1 70.64279937 19.02162211 48.86340372
+1595 Atom 1 1 1 1
+1 1 1 70.56518211 21.71650340 46.18779685
+1596 Atom 1 1 1 1
+1 1 1 67.91389574 21.75868579 48.85369738
+1597 Atom 1 1 1 1
+1 1 1 69.22041028 20.33160371 47.51255370
+1598 Atom 1 1 1 1
+1 1 1 71.98395152 20.36696749 50.21087667
+1599 Atom 1 1 1 1
+1 1 1 71.92547919 23.04475672 47.50233170
+1600 Atom 1 1 1 1
+1 1 1 69.24958931 23.12235733 50.25501611
+1601 Atom 1 1 1 1
+1 1 1 67.88843156 24.41132579 46.17117186
+1602 Atom 1 1 1 1
+1 1 1 70.64731362 24.47219842 48.90139276
+1603 Atom 1 1 1 1
+1 1 1 70.56549601 27.10693104 46.14738676
+1604 Atom 1 1 1 1
+1 1 1 67.92965584 27.13499257 48.89805315
+1605 Atom 1 1 1 1
+1 1 1 69.20502159 25.78269718 47.48207847
+1606 Atom 1 1 1 1
+1 1 1 71.93582106 25.77644889 50.24835565
+1607 Atom 1 1 1 1
+1 1 1 71.94524324 28.55159145 47.56873294
+1608 Atom 1 1 1 1
+1 1 1 69.19891045 28.53931808 50.22702820
+1609 Atom 1 1 1 1
+1 1 1 67.91292136 29.88209475 46.14570587
+1610 Atom 1 1 1 1
+1 1 1 70.64134262 29.89191089 48.84677350
+1611 Atom 1 1 1 1
+1 1 1 70.63766395 32.58185907 46.12324902
+1612 Atom 1 1 1 1
+1 1 1 67.87001981 32.57365615 48.89060916
+1613 Atom 1 1 1 1
+1 1 1 69.29066871 31.25672056 47.56848151
+1614 Atom 1 1 1 1
+1 1 1 71.99859608 31.20302864 50.28505931
+1615 Atom 1 1 1 1
+1 1 1 71.92031002 33.91263237 47.49032922
+1616 Atom 1 1 1 1
+1 1 1 69.26595849 33.98267962 50.25804451
+1617 Atom 1 1 1 1
+1 1 1 67.86161062 35.34575965 46.12933588
+1618 Atom 1 1 1 1
+1 1 1 70.64333767 35.28911167 48.91493119
+1619 Atom 1 1 1 1
+1 1 1 70.61281813 38.03604447 46.14506278
+1620 Atom 1 1 1 1
+1 1 1 67.84370100 38.06327878 48.83446078
+1621 Atom 1 1 1 1
+1 1 1 69.23345302 36.70136848 47.47144641
+1622 Atom 1 1 1 1
+1 1 1 71.99679071 36.63288526 50.24735548
+1623 Atom 1 1 1 1
+1 1 1 71.97058121 39.39158068 47.56289013
+1624 Atom 1 1 1 1
+1 1 1 69.20428731 39.37980518 50.27687834
+1625 Atom 1 1 1 1
+1 1 1 67.84297889 40.68972161 46.19740271
+1626 Atom 1 1 1 1
+1 1 1 70.62225569 40.71638260 48.90190227
+1627 Atom 1 1 1 1
+1 1 1 70.55938840 43.49300993 46.17837518
+1628 Atom 1 1 1 1
+1 1 1 67.86498029 43.42061373 48.84063413
+1629 Atom 1 1 1 1
+1 1 1 69.26873392 42.09731240 47.52966647
+1630 Atom 1 1 1 1
+1 1 1 71.95408091 42.05230660 50.22154515
+1631 Atom 1 1 1 1
+1 1 1 71.95612756 44.75824537 47.49516322
+1632 Atom 1 1 1 1
+1 1 1 69.21479307 44.82424192 50.24724663
+1633 Atom 1 1 1 1
+1 1 1 67.84190961 46.12885051 46.12706816
+1634 Atom 1 1 1 1
+1 1 1 70.58460005 46.17978077 48.87808072
+1635 Atom 1 1 1 1
+1 1 1 70.60732472 48.86290083 46.20657907
+1636 Atom 1 1 1 1
+1 1 1 67.91726922 48.83255096 48.85814680
+1637 Atom 1 1 1 1
+1 1 1 69.21312970 47.47881843 47.50227636
+1638 Atom 1 1 1 1
+1 1 1 71.92114662 47.55456828 50.26320732
+1639 Atom 1 1 1 1
+1 1 1 71.94809039 50.22360762 47.53314515
+1640 Atom 1 1 1 1
+1 1 1 69.25342381 50.28340973 50.19312055
+1641 Atom 1 1 1 1
+1 1 1 67.84870023 51.62932028 46.12380090
+1642 Atom 1 1 1 1
+1 1 1 70.60248559 51.61563150 48.87502287
+1643 Atom 1 1 1 1
+1 1 1 70.57251327 54.29843158 46.16696373
+1644 Atom 1 1 1 1
+1 1 1 67.87667984 54.29363513 48.85657785
+1645 Atom 1 1 1 1
+1 1 1 69.21323756 52.91192044 47.48219555
+1646 Atom 1 1 1 1
+1 1 1 71.96206668 52.99893984 50.27930447
+1647 Atom 1 1 1 1
+1 1 1 71.99210281 55.68025837 47.55025323
+1648 Atom 1 1 1 1
+1 1 1 69.20615532 55.67802782 50.23031345
+1649 Atom 1 1 1 1
+1 1 1 67.86106561 57.02095703 46.14614580
+1650 Atom 1 1 1 1
+1 1 1 70.55619461 57.06032982 48.91327480
+1651 Atom 1 1 1 1
+1 1 1 70.56176242 59.72100853 46.17712327
+1652 Atom 1 1 1 1
+1 1 1 67.90169601 59.75505729 48.88015911
+1653 Atom 1 1 1 1
+1 1 1 69.27438679 58.37050011 47.52225834
+1654 Atom 1 1 1 1
+1 1 1 71.97814570 58.39472211 50.27422042
+1655 Atom 1 1 1 1
+1 1 1 71.94564404 61.07596546 47.51945619
+1656 Atom 1 1 1 1
+1 1 1 69.20190144 61.07426032 50.18925240
+1657 Atom 1 1 1 1
+1 1 1 67.85507877 62.41804816 46.20035435
+1658 Atom 1 1 1 1
+1 1 1 70.56882823 62.46073200 48.90995206
+1659 Atom 1 1 1 1
+1 1 1 70.57709411 65.20037198 46.13260025
+1660 Atom 1 1 1 1
+1 1 1 67.90924944 65.12868692 48.86477352
+1661 Atom 1 1 1 1
+1 1 1 69.28248529 63.80192357 47.47845575
+1662 Atom 1 1 1 1
+1 1 1 71.94583163 63.81708246 50.22054695
+1663 Atom 1 1 1 1
+1 1 1 71.92594120 66.51875479 47.56267310
+1664 Atom 1 1 1 1
+1 1 1 69.28634759 66.54193903 50.26923914
+1665 Atom 1 1 1 1
+1 1 1 67.85523907 67.84488636 46.17023019
+1666 Atom 1 1 1 1
+1 1 1 70.56020152 67.90309856 48.84193871
+1667 Atom 1 1 1 1
+1 1 1 70.61623262 70.58646051 46.16730334
+1668 Atom 1 1 1 1
+1 1 1 67.87550358 70.63173281 48.91221318
+1669 Atom 1 1 1 1
+1 1 1 69.28000403 69.24632846 47.51853259
+1670 Atom 1 1 1 1
+1 1 1 71.92812742 69.27079903 50.19523298
+1671 Atom 1 1 1 1
+1 1 1 71.91803130 71.91306844 47.49236109
+1672 Atom 1 1 1 1
+1 1 1 69.25138255 71.94788344 50.18796533
+1673 Atom 1 1 1 1
+1 1 1 67.93533226 73.32490955 46.18069041
+1674 Atom 1 1 1 1
+1 1 1 70.63962739 73.28121020 48.84648706
+1675 Atom 1 1 1 1
+1 1 1 70.61656250 76.01315737 46.19227066
+1676 Atom 1 1 1 1
+1 1 1 67.93592713 75.98959934 48.87013072
+1677 Atom 1 1 1 1
+1 1 1 69.25169131 74.72328249 47.57048432
+1678 Atom 1 1 1 1
+1 1 1 71.92189726 74.64829148 50.21411491
+1679 Atom 1 1 1 1
+1 1 1 71.95045567 77.36846236 47.49153513
+1680 Atom 1 1 1 1
+1 1 1 69.23746502 77.35900054 50.20230333
+1681 Atom 1 1 1 1
+1 1 1 67.89982872 78.74900398 46.17722513
+1682 Atom 1 1 1 1
+1 1 1 70.56118797 78.74489680 48.87723447
+1683 Atom 1 1 1 1
+1 1 1 70.62068834 81.43026062 46.15732508
+1684 Atom 1 1 1 1
+1 1 1 67.89141783 81.51423558 48.90311749
+1685 Atom 1 1 1 1
+1 1 1 69.21925920 80.07695159 47.50444096
+1686 Atom 1 1 1 1
+1 1 1 71.97273673 80.10278658 50.21770449
+1687 Atom 1 1 1 1
+1 1 1 71.98211810 82.78510845 47.48662640
+1688 Atom 1 1 1 1
+1 1 1 69.24545524 82.82519862 50.20874859
+1689 Atom 1 1 1 1
+1 1 1 67.85965686 84.16794223 46.12558440
+1690 Atom 1 1 1 1
+1 1 1 70.64334113 84.20001202 48.84889793
+1691 Atom 1 1 1 1
+1 1 1 70.56466406 86.89321783 46.15259813
+1692 Atom 1 1 1 1
+1 1 1 67.92822725 86.89718028 48.86573528
+1693 Atom 1 1 1 1
+1 1 1 69.25723122 85.55729703 47.47985527
+1694 Atom 1 1 1 1
+1 1 1 71.91297796 85.51614640 50.25915652
+1695 Atom 1 1 1 1
+1 1 1 71.98535716 88.27475947 47.47573639
+1696 Atom 1 1 1 1
+1 1 1 69.22678389 88.23632034 50.28174841
+1697 Atom 1 1 1 1
+1 1 1 73.30466980 2.71959654 46.12160820
+1698 Atom 1 1 1 1
+1 1 1 76.07617490 2.72997889 48.85359455
+1699 Atom 1 1 1 1
+1 1 1 76.00819565 5.45436054 46.16843464
+1700 Atom 1 1 1 1
+1 1 1 73.34048689 5.42583927 48.84699295
+1701 Atom 1 1 1 1
+1 1 1 74.66539804 4.11902951 47.50783360
+1702 Atom 1 1 1 1
+1 1 1 77.36789102 4.03061123 50.20498446
+1703 Atom 1 1 1 1
+1 1 1 77.37667750 6.76759474 47.47388897
+1704 Atom 1 1 1 1
+1 1 1 74.68418717 6.78924616 50.27195954
+1705 Atom 1 1 1 1
+1 1 1 73.28556337 8.13652336 46.14636209
+1706 Atom 1 1 1 1
+1 1 1 76.04808501 8.09980480 48.84347390
+1707 Atom 1 1 1 1
+1 1 1 76.04726571 10.85871361 46.12280203
+1708 Atom 1 1 1 1
+1 1 1 73.33279913 10.82685855 48.86983503
+1709 Atom 1 1 1 1
+1 1 1 74.70835519 9.48254488 47.47571591
+1710 Atom 1 1 1 1
+1 1 1 77.43048663 9.48339989 50.21750093
+1711 Atom 1 1 1 1
+1 1 1 77.39531558 12.24627713 47.53714559
+1712 Atom 1 1 1 1
+1 1 1 74.69765012 12.22273345 50.28243986
+1713 Atom 1 1 1 1
+1 1 1 73.31652552 13.55445184 46.19923710
+1714 Atom 1 1 1 1
+1 1 1 76.06011954 13.60890152 48.83888554
+1715 Atom 1 1 1 1
+1 1 1 76.04490158 16.32450123 46.14320945
+1716 Atom 1 1 1 1
+1 1 1 73.33744282 16.28024562 48.88509742
+1717 Atom 1 1 1 1
+1 1 1 74.69054928 14.96155851 47.52276577
+1718 Atom 1 1 1 1
+1 1 1 77.43123305 14.93154279 50.20248490
+1719 Atom 1 1 1 1
+1 1 1 77.34618456 17.66739542 47.56740569
+1720 Atom 1 1 1 1
+1 1 1 74.66419451 17.61044112 50.20417578
+1721 Atom 1 1 1 1
+1 1 1 73.27646150 18.98143061 46.14603532
+1722 Atom 1 1 1 1
+1 1 1 75.99311662 19.02890808 48.90020843
+1723 Atom 1 1 1 1
+1 1 1 76.07065502 21.73145651 46.14931133
+1724 Atom 1 1 1 1
+1 1 1 73.31468367 21.73200653 48.87812358
+1725 Atom 1 1 1 1
+1 1 1 74.66572338 20.37588035 47.52785544
+1726 Atom 1 1 1 1
+1 1 1 77.43758366 20.38870372 50.26889255
+1727 Atom 1 1 1 1
+1 1 1 77.43046640 23.12606617 47.49024706
+1728 Atom 1 1 1 1
+1 1 1 74.70830077 23.08988912 50.23205459
+1729 Atom 1 1 1 1
+1 1 1 73.31630855 24.39957689 46.19627556
+1730 Atom 1 1 1 1
+1 1 1 76.02904468 24.45380698 48.89091976
+1731 Atom 1 1 1 1
+1 1 1 76.05389827 27.12225352 46.11822691
+1732 Atom 1 1 1 1
+1 1 1 73.34912952 27.14153362 48.83465968
+1733 Atom 1 1 1 1
+1 1 1 74.65888258 25.77416514 47.54661387
+1734 Atom 1 1 1 1
+1 1 1 77.35770557 25.78591618 50.23462268
+1735 Atom 1 1 1 1
+1 1 1 77.40247230 28.47875620 47.53651522
+1736 Atom 1 1 1 1
+1 1 1 74.67551337 28.50769312 50.20825693
+1737 Atom 1 1 1 1
+1 1 1 73.34228319 29.86998227 46.17461153
+1738 Atom 1 1 1 1
+1 1 1 75.99369073 29.84725630 48.90701741
+1739 Atom 1 1 1 1
+1 1 1 76.03065591 32.58740409 46.20974335
+1740 Atom 1 1 1 1
+1 1 1 73.29636598 32.54503183 48.87345002
+1741 Atom 1 1 1 1
+1 1 1 74.62636588 31.21813165 47.53901364
+1742 Atom 1 1 1 1
+1 1 1 77.35089784 31.17867189 50.26355246
+1743 Atom 1 1 1 1
+1 1 1 77.41932921 33.92979332 47.47813564
+1744 Atom 1 1 1 1
+1 1 1 74.65543739 33.93769067 50.26960450
+1745 Atom 1 1 1 1
+1 1 1 73.27481906 35.32201686 46.18344387
+1746 Atom 1 1 1 1
+1 1 1 75.98471776 35.32554011 48.91007028
+1747 Atom 1 1 1 1
+1 1 1 76.01864522 38.01165792 46.11538305
+1748 Atom 1 1 1 1
+1 1 1 73.30546820 37.98849368 48.84478486
+1749 Atom 1 1 1 1
+1 1 1 74.64201610 36.62338785 47.49276100
+1750 Atom 1 1 1 1
+1 1 1 77.39693237 36.64249590 50.28618673
+1751 Atom 1 1 1 1
+1 1 1 77.41488511 39.39327364 47.48637664
+1752 Atom 1 1 1 1
+1 1 1 74.65873279 39.36558705 50.24579098
+1753 Atom 1 1 1 1
+1 1 1 73.31559774 40.77720627 46.20895973
+1754 Atom 1 1 1 1
+1 1 1 76.01175622 40.78141084 48.85044897
+1755 Atom 1 1 1 1
+1 1 1 76.00464245 43.49170012 46.16516312
+1756 Atom 1 1 1 1
+1 1 1 73.32083034 43.45826859 48.84292569
+1757 Atom 1 1 1 1
+1 1 1 74.67584017 42.12807529 47.47272466
+1758 Atom 1 1 1 1
+1 1 1 77.40560152 42.06867810 50.25406516
+1759 Atom 1 1 1 1
+1 1 1 77.43284938 44.83148169 47.52279186
+1760 Atom 1 1 1 1
+1 1 1 74.72168371 44.81769361 50.27652969
+1761 Atom 1 1 1 1
+1 1 1 73.28500503 46.14129535 46.12984345
+1762 Atom 1 1 1 1
+1 1 1 76.01440446 46.11892992 48.87912416
+1763 Atom 1 1 1 1
+1 1 1 76.02513866 48.89365745 46.14837699
+1764 Atom 1 1 1 1
+1 1 1 73.31050733 48.83704463 48.91069953
+1765 Atom 1 1 1 1
+1 1 1 74.66378697 47.55047460 47.55242944
+1766 Atom 1 1 1 1
+1 1 1 77.43097052 47.48575046 50.28560790
+1767 Atom 1 1 1 1
+1 1 1 77.35236930 50.24564353 47.54688181
+1768 Atom 1 1 1 1
+1 1 1 74.72421553 50.25272481 50.25602539
+1769 Atom 1 1 1 1
+1 1 1 73.27913391 51.54973448 46.18539465
+1770 Atom 1 1 1 1
+1 1 1 75.98796032 51.63591093 48.84760037
+1771 Atom 1 1 1 1
+1 1 1 76.01853574 54.31723752 46.12998190
+1772 Atom 1 1 1 1
+1 1 1 73.27353752 54.31261823 48.91321216
+1773 Atom 1 1 1 1
+1 1 1 74.70874348 52.98511454 47.49651382
+1774 Atom 1 1 1 1
+1 1 1 77.35110966 52.95471522 50.28347175
+1775 Atom 1 1 1 1
+1 1 1 77.43199031 55.68796770 47.50861268
+1776 Atom 1 1 1 1
+1 1 1 74.66745950 55.64113832 50.25252141
+1777 Atom 1 1 1 1
+1 1 1 73.33542651 56.99408056 46.12631899
+1778 Atom 1 1 1 1
+1 1 1 75.99490503 57.05043095 48.84615192
+1779 Atom 1 1 1 1
+1 1 1 76.06489448 59.76255637 46.14621475
+1780 Atom 1 1 1 1
+1 1 1 73.34202159 59.77645937 48.84415887
+1781 Atom 1 1 1 1
+1 1 1 74.64639734 58.42222587 47.50234630
+1782 Atom 1 1 1 1
+1 1 1 77.36561617 58.37947429 50.22411310
+1783 Atom 1 1 1 1
+1 1 1 77.39721149 61.12528350 47.55015080
+1784 Atom 1 1 1 1
+1 1 1 74.70633784 61.09473581 50.27192455
+1785 Atom 1 1 1 1
+1 1 1 73.35137311 62.46744270 46.13183623
+1786 Atom 1 1 1 1
+1 1 1 76.01836079 62.42132058 48.89052506
+1787 Atom 1 1 1 1
+1 1 1 76.07924634 65.15654328 46.15456205
+1788 Atom 1 1 1 1
+1 1 1 73.35287551 65.15914971 48.84456441
+1789 Atom 1 1 1 1
+1 1 1 74.64946404 63.86158355 47.52025780
+1790 Atom 1 1 1 1
+1 1 1 77.43226501 63.78647993 50.22639892
+1791 Atom 1 1 1 1
+1 1 1 77.39632281 66.50748691 47.53071918
+1792 Atom 1 1 1 1
+1 1 1 74.68979536 66.49755235 50.28475505
+1793 Atom 1 1 1 1
+1 1 1 73.30515951 67.89718124 46.18789484
+1794 Atom 1 1 1 1
+1 1 1 76.00569900 67.90542226 48.83728141
+1795 Atom 1 1 1 1
+1 1 1 76.03989023 70.61545307 46.13572485
+1796 Atom 1 1 1 1
+1 1 1 73.31755597 70.64853357 48.83953681
+1797 Atom 1 1 1 1
+1 1 1 74.69455316 69.23193633 47.54680832
+1798 Atom 1 1 1 1
+1 1 1 77.36762893 69.21620078 50.26375080
+1799 Atom 1 1 1 1
+1 1 1 77.36174074 71.92423866 47.48828791
+1800 Atom 1 1 1 1
+1 1 1 74.65076876 71.95722827 50.28231877
+1801 Atom 1 1 1 1
+1 1 1 73.35766122 73.27177319 46.14279208
+1802 Atom 1 1 1 1
+1 1 1 76.03880519 73.28485347 48.83419141
+1803 Atom 1 1 1 1
+1 1 1 75.99148285 76.07635704 46.12141872
+1804 Atom 1 1 1 1
+1 1 1 73.35425116 75.98785691 48.83232581
+1805 Atom 1 1 1 1
+1 1 1 74.62827286 74.70978715 47.55559908
+1806 Atom 1 1 1 1
+1 1 1 77.39124580 74.62914800 50.21406821
+1807 Atom 1 1 1 1
+1 1 1 77.38218927 77.40370921 47.50957563
+1808 Atom 1 1 1 1
+1 1 1 74.72340707 77.35338683 50.22873405
+1809 Atom 1 1 1 1
+1 1 1 73.34630814 78.70481179 46.13035471
+1810 Atom 1 1 1 1
+1 1 1 76.07517875 78.79030731 48.88919993
+1811 Atom 1 1 1 1
+1 1 1 75.98475295 81.47294556 46.18582635
+1812 Atom 1 1 1 1
+1 1 1 73.35472585 81.50306995 48.87503550
+1813 Atom 1 1 1 1
+1 1 1 74.68774394 80.08795611 47.55685894
+1814 Atom 1 1 1 1
+1 1 1 77.39413347 80.10544828 50.23671947
+1815 Atom 1 1 1 1
+1 1 1 77.36521201 82.85041118 47.50109052
+1816 Atom 1 1 1 1
+1 1 1 74.70747494 82.87261850 50.22098116
+1817 Atom 1 1 1 1
+1 1 1 73.27470941 84.16744674 46.21277637
+1818 Atom 1 1 1 1
+1 1 1 76.02307945 84.17213768 48.88424188
+1819 Atom 1 1 1 1
+1 1 1 75.99648177 86.88949308 46.15069439
+1820 Atom 1 1 1 1
+1 1 1 73.28725986 86.88956040 48.86223437
+1821 Atom 1 1 1 1
+1 1 1 74.62865598 85.49870905 47.48734733
+1822 Atom 1 1 1 1
+1 1 1 77.36551728 85.54699410 50.28639085
+1823 Atom 1 1 1 1
+1 1 1 77.41004770 88.30054608 47.51726258
+1824 Atom 1 1 1 1
+1 1 1 74.71902696 88.28250563 50.21517208
+1825 Atom 1 1 1 1
+1 1 1 78.70535777 2.71082804 46.20804175
+1826 Atom 1 1 1 1
+1 1 1 81.47641118 2.69697106 48.91521384
+1827 Atom 1 1 1 1
+1 1 1 81.41573880 5.39647435 46.20587851
+1828 Atom 1 1 1 1
+1 1 1 78.70151287 5.40141596 48.83473236
+1829 Atom 1 1 1 1
+1 1 1 80.11665287 4.11063258 47.55520884
+1830 Atom 1 1 1 1
+1 1 1 82.87080647 4.06334872 50.23032814
+1831 Atom 1 1 1 1
+1 1 1 82.86519211 6.77305527 47.47949759
+1832 Atom 1 1 1 1
+1 1 1 80.13679735 6.82456019 50.28104356
+1833 Atom 1 1 1 1
+1 1 1 78.71310392 8.13868200 46.13068150
+1834 Atom 1 1 1 1
+1 1 1 81.46577070 8.17821523 48.89646412
+1835 Atom 1 1 1 1
+1 1 1 81.46323657 10.87218261 46.21202829
+1836 Atom 1 1 1 1
+1 1 1 78.76891456 10.84329658 48.92162362
+1837 Atom 1 1 1 1
+1 1 1 80.10104989 9.47324555 47.56304901
+1838 Atom 1 1 1 1
+1 1 1 82.83670213 9.45663134 50.28470608
+1839 Atom 1 1 1 1
+1 1 1 82.85543007 12.24450429 47.49644687
+1840 Atom 1 1 1 1
+1 1 1 80.13410877 12.24834889 50.18784879
+1841 Atom 1 1 1 1
+1 1 1 78.71214621 13.53322303 46.18503599
+1842 Atom 1 1 1 1
+1 1 1 81.48345630 13.59858953 48.84955386
+1843 Atom 1 1 1 1
+1 1 1 81.44999964 16.26345972 46.18385806
+1844 Atom 1 1 1 1
+1 1 1 78.70477822 16.32246581 48.83567110
+1845 Atom 1 1 1 1
+1 1 1 80.06780754 14.88796694 47.49528842
+1846 Atom 1 1 1 1
+1 1 1 82.77474770 14.96030660 50.19597630
+1847 Atom 1 1 1 1
+1 1 1 82.86025898 17.63254278 47.54681183
+1848 Atom 1 1 1 1
+1 1 1 80.14888034 17.62823059 50.26119940
+1849 Atom 1 1 1 1
+1 1 1 78.76734889 18.99984424 46.20149736
+1850 Atom 1 1 1 1
+1 1 1 81.42569649 18.98964593 48.84135790
+1851 Atom 1 1 1 1
+1 1 1 81.48051435 21.72265251 46.13151937
+1852 Atom 1 1 1 1
+1 1 1 78.74734892 21.69397267 48.91291442
+1853 Atom 1 1 1 1
+1 1 1 80.15134390 20.35411737 47.51722556
+1854 Atom 1 1 1 1
+1 1 1 82.82948564 20.38021884 50.20555023
+1855 Atom 1 1 1 1
+1 1 1 82.86316890 23.07625800 47.53773237
+1856 Atom 1 1 1 1
+1 1 1 80.14958518 23.10976529 50.27847679
+1857 Atom 1 1 1 1
+1 1 1 78.73092622 24.43245844 46.19642997
+1858 Atom 1 1 1 1
+1 1 1 81.47319777 24.44331546 48.92272645
+1859 Atom 1 1 1 1
+1 1 1 81.50244011 27.19783852 46.19342381
+1860 Atom 1 1 1 1
+1 1 1 78.75406936 27.12908598 48.84133838
+1861 Atom 1 1 1 1
+1 1 1 80.08221916 25.83467982 47.55191146
+1862 Atom 1 1 1 1
+1 1 1 82.78247953 25.80723262 50.20699693
+1863 Atom 1 1 1 1
+1 1 1 82.79928844 28.47902872 47.55123670
+1864 Atom 1 1 1 1
+1 1 1 80.09734535 28.49337777 50.21514443
+1865 Atom 1 1 1 1
+1 1 1 78.72713360 29.83555262 46.16963887
+1866 Atom 1 1 1 1
+1 1 1 81.47953614 29.89904134 48.90476725
+1867 Atom 1 1 1 1
+1 1 1 81.46632588 32.62308423 46.12789937
+1868 Atom 1 1 1 1
+1 1 1 78.78595944 32.56236454 48.84414594
+1869 Atom 1 1 1 1
+1 1 1 80.06704261 31.20890467 47.52786405
+1870 Atom 1 1 1 1
+1 1 1 82.86142158 31.18508365 50.20616828
+1871 Atom 1 1 1 1
+1 1 1 82.82979650 33.89606106 47.48136226
+1872 Atom 1 1 1 1
+1 1 1 80.06083178 33.93528274 50.25867408
+1873 Atom 1 1 1 1
+1 1 1 78.74824060 35.34454783 46.18686887
+1874 Atom 1 1 1 1
+1 1 1 81.49785154 35.30621346 48.91883118
+1875 Atom 1 1 1 1
+1 1 1 81.47603193 37.96912151 46.19534733
+1876 Atom 1 1 1 1
+1 1 1 78.76044075 38.03521062 48.90295431
+1877 Atom 1 1 1 1
+1 1 1 80.06378974 36.64951341 47.47966752
+1878 Atom 1 1 1 1
+1 1 1 82.80542304 36.69058358 50.20500078
+1879 Atom 1 1 1 1
+1 1 1 82.86335374 39.38085922 47.50259083
+1880 Atom 1 1 1 1
+1 1 1 80.13561528 39.37620645 50.18854400
+1881 Atom 1 1 1 1
+1 1 1 78.78893569 40.73410468 46.16523327
+1882 Atom 1 1 1 1
+1 1 1 81.50670137 40.75817975 48.85714532
+1883 Atom 1 1 1 1
+1 1 1 81.50149939 43.40822341 46.13040580
+1884 Atom 1 1 1 1
+1 1 1 78.70201714 43.45762192 48.85539262
+1885 Atom 1 1 1 1
+1 1 1 80.05793049 42.10092485 47.49214730
+1886 Atom 1 1 1 1
+1 1 1 82.78708579 42.05487389 50.22127571
+1887 Atom 1 1 1 1
+1 1 1 82.77958457 44.77903754 47.57087078
+1888 Atom 1 1 1 1
+1 1 1 80.15674545 44.79691188 50.22900982
+1889 Atom 1 1 1 1
+1 1 1 78.70326658 46.12916270 46.19567630
+1890 Atom 1 1 1 1
+1 1 1 81.41501630 46.16408817 48.84751511
+1891 Atom 1 1 1 1
+1 1 1 81.48596604 48.88174912 46.16125712
+1892 Atom 1 1 1 1
+1 1 1 78.78405709 48.88666212 48.88101108
+1893 Atom 1 1 1 1
+1 1 1 80.06978897 47.52840915 47.52583579
+1894 Atom 1 1 1 1
+1 1 1 82.85638706 47.54203140 50.20356856
+1895 Atom 1 1 1 1
+1 1 1 82.85658815 50.19518106 47.56479782
+1896 Atom 1 1 1 1
+1 1 1 80.14901365 50.21947297 50.20831968
+1897 Atom 1 1 1 1
+1 1 1 78.74358484 51.56703451 46.12755831
+1898 Atom 1 1 1 1
+1 1 1 81.42643719 51.64255525 48.87045039
+1899 Atom 1 1 1 1
+1 1 1 81.42473556 54.27046069 46.11885229
+1900 Atom 1 1 1 1
+1 1 1 78.72059992 54.32821767 48.87184688
+1901 Atom 1 1 1 1
+1 1 1 80.15392378 52.97158650 47.57034858
+1902 Atom 1 1 1 1
+1 1 1 82.85816677 52.95883464 50.21122514
+1903 Atom 1 1 1 1
+1 1 1 82.85580983 55.70130822 47.50233138
+1904 Atom 1 1 1 1
+1 1 1 80.13405764 55.64442516 50.21849993
+1905 Atom 1 1 1 1
+1 1 1 78.74585483 57.00748983 46.18532803
+1906 Atom 1 1 1 1
+1 1 1 81.48671676 57.02992917 48.88221834
+1907 Atom 1 1 1 1
+1 1 1 81.45692883 59.77291333 46.16119404
+1908 Atom 1 1 1 1
+1 1 1 78.74107724 59.78422750 48.86346154
+1909 Atom 1 1 1 1
+1 1 1 80.06569142 58.33424307 47.52286078
+1910 Atom 1 1 1 1
+1 1 1 82.84706863 58.34991585 50.19990769
+1911 Atom 1 1 1 1
+1 1 1 82.87127369 61.09850480 47.49224465
+1912 Atom 1 1 1 1
+1 1 1 80.12773758 61.10870135 50.20813416
+1913 Atom 1 1 1 1
+1 1 1 78.75798271 62.48643563 46.19114135
+1914 Atom 1 1 1 1
+1 1 1 81.48297751 62.50458061 48.92482535
+1915 Atom 1 1 1 1
+1 1 1 81.44616075 65.19115612 46.14198478
+1916 Atom 1 1 1 1
+1 1 1 78.75991183 65.21849700 48.92350856
+1917 Atom 1 1 1 1
+1 1 1 80.07927512 63.80854290 47.57106438
+1918 Atom 1 1 1 1
+1 1 1 82.81479778 63.78780320 50.23899687
+1919 Atom 1 1 1 1
+1 1 1 82.80330654 66.48055016 47.49384649
+1920 Atom 1 1 1 1
+1 1 1 80.11049200 66.56398738 50.21864910
+1921 Atom 1 1 1 1
+1 1 1 78.72207779 67.89599345 46.20805782
+1922 Atom 1 1 1 1
+1 1 1 81.46080828 67.86336504 48.86295973
+1923 Atom 1 1 1 1
+1 1 1 81.41869394 70.59152009 46.18936113
+1924 Atom 1 1 1 1
+1 1 1 78.77644177 70.57210947 48.83826417
+1925 Atom 1 1 1 1
+1 1 1 80.12000605 69.28599929 47.53120616
+1926 Atom 1 1 1 1
+1 1 1 82.82985850 69.26246298 50.23938629
+1927 Atom 1 1 1 1
+1 1 1 82.83215197 71.92289605 47.54649064
+1928 Atom 1 1 1 1
+1 1 1 80.08053881 71.92641510 50.24274802
+1929 Atom 1 1 1 1
+1 1 1 78.74724611 73.28914635 46.21229246
+1930 Atom 1 1 1 1
+1 1 1 81.49466027 73.36015812 48.83986317
+1931 Atom 1 1 1 1
+1 1 1 81.46936073 76.07223987 46.13500118
+1932 Atom 1 1 1 1
+1 1 1 78.78875101 76.02945114 48.88889038
+1933 Atom 1 1 1 1
+1 1 1 80.13732450 74.66198974 47.47906364
+1934 Atom 1 1 1 1
+1 1 1 82.77565266 74.65179936 50.21689774
+1935 Atom 1 1 1 1
+1 1 1 82.78392034 77.41408845 47.48256267
+1936 Atom 1 1 1 1
+1 1 1 80.07857672 77.39418081 50.24993743
+1937 Atom 1 1 1 1
+1 1 1 78.79295511 78.72179251 46.11769162
+1938 Atom 1 1 1 1
+1 1 1 81.51411873 78.79100812 48.89272906
+1939 Atom 1 1 1 1
+1 1 1 81.50596567 81.49517751 46.11629758
+1940 Atom 1 1 1 1
+1 1 1 78.70546064 81.47835368 48.88631240
+1941 Atom 1 1 1 1
+1 1 1 80.10984524 80.08042132 47.53419457
+1942 Atom 1 1 1 1
+1 1 1 82.77597863 80.08619325 50.24060068
+1943 Atom 1 1 1 1
+1 1 1 82.86399556 82.83265711 47.51872875
+1944 Atom 1 1 1 1
+1 1 1 80.09081238 82.86189265 50.27410460
+1945 Atom 1 1 1 1
+1 1 1 78.75518822 84.14143323 46.11430987
+1946 Atom 1 1 1 1
+1 1 1 81.43278034 84.20719996 48.85156747
+1947 Atom 1 1 1 1
+1 1 1 81.44619561 86.86670913 46.11431264
+1948 Atom 1 1 1 1
+1 1 1 78.69991142 86.87650755 48.84460975
+1949 Atom 1 1 1 1
+1 1 1 80.05849983 85.58634781 47.55015752
+1950 Atom 1 1 1 1
+1 1 1 82.83556525 85.50009063 50.20964251
+1951 Atom 1 1 1 1
+1 1 1 82.77915388 88.29118557 47.50953057
+1952 Atom 1 1 1 1
+1 1 1 80.15109107 88.30075639 50.26062926
+1953 Atom 1 1 1 1
+1 1 1 84.19165969 2.73443903 46.14495919
+1954 Atom 1 1 1 1
+1 1 1 86.94094055 2.75171851 48.84140911
+1955 Atom 1 1 1 1
+1 1 1 86.86928088 5.46453685 46.19999929
+1956 Atom 1 1 1 1
+1 1 1 84.17995491 5.46909840 48.83789206
+1957 Atom 1 1 1 1
+1 1 1 85.56157750 4.04142759 47.47211342
+1958 Atom 1 1 1 1
+1 1 1 88.21902485 4.03204881 50.24838604
+1959 Atom 1 1 1 1
+1 1 1 88.27638341 6.83717966 47.55207459
+1960 Atom 1 1 1 1
+1 1 1 85.53178379 6.74457270 50.25795507
+1961 Atom 1 1 1 1
+1 1 1 84.19290911 8.13650212 46.17934117
+1962 Atom 1 1 1 1
+1 1 1 86.94317753 8.17254807 48.90139368
+1963 Atom 1 1 1 1
+1 1 1 86.94066338 10.84732065 46.19303803
+1964 Atom 1 1 1 1
+1 1 1 84.16391169 10.90799814 48.90847400
+1965 Atom 1 1 1 1
+1 1 1 85.58671087 9.52842160 47.53864186
+1966 Atom 1 1 1 1
+1 1 1 88.20571833 9.52699597 50.26167207
+1967 Atom 1 1 1 1
+1 1 1 88.27033633 12.20865320 47.48238423
+1968 Atom 1 1 1 1
+1 1 1 85.53561939 12.25768013 50.22213509
+1969 Atom 1 1 1 1
+1 1 1 84.21315173 13.59862230 46.14958854
+1970 Atom 1 1 1 1
+1 1 1 86.89434041 13.62664339 48.85133305
+1971 Atom 1 1 1 1
+1 1 1 86.88405703 16.27514782 46.15873195
+1972 Atom 1 1 1 1
+1 1 1 84.14545144 16.29169174 48.84995856
+1973 Atom 1 1 1 1
+1 1 1 85.58813965 14.96509516 47.49685388
+1974 Atom 1 1 1 1
+1 1 1 88.26320077 14.93506083 50.28203956
+1975 Atom 1 1 1 1
+1 1 1 88.26311228 17.61375071 47.51217049
+1976 Atom 1 1 1 1
+1 1 1 85.58715165 17.61377030 50.20123138
+1977 Atom 1 1 1 1
+1 1 1 84.20337865 19.02539568 46.19403651
+1978 Atom 1 1 1 1
+1 1 1 86.93920910 19.04014686 48.83225506
+1979 Atom 1 1 1 1
+1 1 1 86.84921351 21.68033623 46.19391945
+1980 Atom 1 1 1 1
+1 1 1 84.21778410 21.70565962 48.83532207
+1981 Atom 1 1 1 1
+1 1 1 85.52687506 20.37619226 47.55031478
+1982 Atom 1 1 1 1
+1 1 1 88.21630782 20.36175737 50.24503385
+1983 Atom 1 1 1 1
+1 1 1 88.24326454 23.05759057 47.56606576
+1984 Atom 1 1 1 1
+1 1 1 85.52059071 23.07985490 50.26410005
+1985 Atom 1 1 1 1
+1 1 1 84.21358838 24.41825103 46.18734187
+1986 Atom 1 1 1 1
+1 1 1 86.85057128 24.46462451 48.92402698
+1987 Atom 1 1 1 1
+1 1 1 86.92728960 27.19946951 46.16891482
+1988 Atom 1 1 1 1
+1 1 1 84.18429755 27.16114490 48.92315897
+1989 Atom 1 1 1 1
+1 1 1 85.51991119 25.80227625 47.51888244
+1990 Atom 1 1 1 1
+1 1 1 88.28482299 25.74982293 50.24193171
+1991 Atom 1 1 1 1
+1 1 1 88.29464737 28.46575499 47.52555024
+1992 Atom 1 1 1 1
+1 1 1 85.52277933 28.49836803 50.24656591
+1993 Atom 1 1 1 1
+1 1 1 84.20590265 29.88195804 46.13288108
+1994 Atom 1 1 1 1
+1 1 1 86.90554973 29.89421878 48.84634156
+1995 Atom 1 1 1 1
+1 1 1 86.86774936 32.57894324 46.11612008
+1996 Atom 1 1 1 1
+1 1 1 84.14649905 32.60521580 48.90163302
+1997 Atom 1 1 1 1
+1 1 1 85.55891791 31.23965600 47.50158031
+1998 Atom 1 1 1 1
+1 1 1 88.24878606 31.22186689 50.26438956
+1999 Atom 1 1 1 1
+1 1 1 88.22879229 33.94830235 47.47671518
+2000 Atom 1 1 1 1
+1 1 1 85.49211375 33.94872136 50.19888934
+2001 Atom 1 1 1 1
+1 1 1 84.21608941 35.26834979 46.11385459
+2002 Atom 1 1 1 1
+1 1 1 86.90133985 35.26196502 48.83614154
+2003 Atom 1 1 1 1
+1 1 1 86.91404880 38.03514001 46.21297542
+2004 Atom 1 1 1 1
+1 1 1 84.13083300 38.00651525 48.90250658
+2005 Atom 1 1 1 1
+1 1 1 85.50307958 36.61482974 47.47610350
+2006 Atom 1 1 1 1
+1 1 1 88.28932213 36.63250409 50.23730888
+2007 Atom 1 1 1 1
+1 1 1 88.29037236 39.39625973 47.49378812
+2008 Atom 1 1 1 1
+1 1 1 85.56772337 39.34767303 50.19370921
+2009 Atom 1 1 1 1
+1 1 1 84.18051192 40.71601498 46.14652120
+2010 Atom 1 1 1 1
+1 1 1 86.87427992 40.73897876 48.87830711
+2011 Atom 1 1 1 1
+1 1 1 86.92969514 43.40292438 46.16529208
+2012 Atom 1 1 1 1
+1 1 1 84.13229492 43.41211563 48.91014945
+2013 Atom 1 1 1 1
+1 1 1 85.57079214 42.04152269 47.49712082
+2014 Atom 1 1 1 1
+1 1 1 88.25992226 42.13946254 50.20536711
+2015 Atom 1 1 1 1
+1 1 1 88.22613032 44.79131321 47.54905275
+2016 Atom 1 1 1 1
+1 1 1 85.55639676 44.83552628 50.25726258
+2017 Atom 1 1 1 1
+1 1 1 84.14079563 46.20028687 46.20979513
+2018 Atom 1 1 1 1
+1 1 1 86.89715162 46.14548487 48.85684130
+2019 Atom 1 1 1 1
+1 1 1 86.94565133 48.89379520 46.11375568
+2020 Atom 1 1 1 1
+1 1 1 84.17078637 48.89839243 48.84242474
+2021 Atom 1 1 1 1
+1 1 1 85.55058210 47.56079473 47.48037072
+2022 Atom 1 1 1 1
+1 1 1 88.23298698 47.51220260 50.24697173
+2023 Atom 1 1 1 1
+1 1 1 88.29055511 50.21068195 47.54807641
+2024 Atom 1 1 1 1
+1 1 1 85.51232658 50.28170433 50.27406145
+2025 Atom 1 1 1 1
+1 1 1 84.15669945 51.64351008 46.18006351
+2026 Atom 1 1 1 1
+1 1 1 86.91047399 51.63570773 48.88412350
+2027 Atom 1 1 1 1
+1 1 1 86.90497097 54.26790210 46.14282597
+2028 Atom 1 1 1 1
+1 1 1 84.18678662 54.35801417 48.85291438
+2029 Atom 1 1 1 1
+1 1 1 85.52597663 52.91832650 47.51398852
+2030 Atom 1 1 1 1
+1 1 1 88.27586051 52.93964206 50.22303574
+2031 Atom 1 1 1 1
+1 1 1 88.26488011 55.65256786 47.50384448
+2032 Atom 1 1 1 1
+1 1 1 85.48987634 55.64161874 50.23763808
+2033 Atom 1 1 1 1
+1 1 1 84.14771348 56.98579116 46.13522744
+2034 Atom 1 1 1 1
+1 1 1 86.86414320 57.03260539 48.86532808
+2035 Atom 1 1 1 1
+1 1 1 86.88805190 59.75498346 46.21124228
+2036 Atom 1 1 1 1
+1 1 1 84.22857164 59.74911133 48.83297920
+2037 Atom 1 1 1 1
+1 1 1 85.53328061 58.37230574 47.51017578
+2038 Atom 1 1 1 1
+1 1 1 88.25652647 58.33449793 50.23667714
+2039 Atom 1 1 1 1
+1 1 1 88.25097057 61.13215687 47.53739242
+2040 Atom 1 1 1 1
+1 1 1 85.50135710 61.10000026 50.19908891
+2041 Atom 1 1 1 1
+1 1 1 84.16907789 62.43123961 46.19416031
+2042 Atom 1 1 1 1
+1 1 1 86.89306541 62.44818602 48.84595544
+2043 Atom 1 1 1 1
+1 1 1 86.85684002 65.20050654 46.14223642
+2044 Atom 1 1 1 1
+1 1 1 84.21644073 65.20295841 48.86571836
+2045 Atom 1 1 1 1
+1 1 1 85.50406229 63.82648794 47.49728263
+2046 Atom 1 1 1 1
+1 1 1 88.22125382 63.81572337 50.27126941
+2047 Atom 1 1 1 1
+1 1 1 88.20383938 66.53620299 47.55712749
+2048 Atom 1 1 1 1
+1 1 1 85.57193350 66.56455043 50.25094075
+2049 Atom 1 1 1 1
+1 1 1 84.17624165 67.88289825 46.16702484
+2050 Atom 1 1 1 1
+1 1 1 86.85618076 67.88346765 48.90204980
+2051 Atom 1 1 1 1
+1 1 1 86.91172320 70.56610847 46.21055917
+2052 Atom 1 1 1 1
+1 1 1 84.13362518 70.58900453 48.87934891
+2053 Atom 1 1 1 1
+1 1 1 85.51617368 69.27521004 47.53086657
+2054 Atom 1 1 1 1
+1 1 1 88.25857302 69.28594963 50.21289966
+2055 Atom 1 1 1 1
+1 1 1 88.24120604 71.94563861 47.53752953
+2056 Atom 1 1 1 1
+1 1 1 85.52440958 71.98391454 50.24727091
+2057 Atom 1 1 1 1
+1 1 1 84.17791580 73.34339133 46.19006829
+2058 Atom 1 1 1 1
+1 1 1 86.88112012 73.33086120 48.83447934
+2059 Atom 1 1 1 1
+1 1 1 86.90651409 76.02577412 46.14202298
+2060 Atom 1 1 1 1
+1 1 1 84.13120322 76.07768511 48.92048598
+2061 Atom 1 1 1 1
+1 1 1 85.58737611 74.69386354 47.53425354
+2062 Atom 1 1 1 1
+1 1 1 88.21941291 74.67605643 50.26051568
+2063 Atom 1 1 1 1
+1 1 1 88.29700101 77.38418540 47.48026124
+2064 Atom 1 1 1 1
+1 1 1 85.49899027 77.34736547 50.24001884
+2065 Atom 1 1 1 1
+1 1 1 84.14219232 78.79016421 46.19281578
+2066 Atom 1 1 1 1
+1 1 1 86.91057986 78.73446017 48.84786229
+2067 Atom 1 1 1 1
+1 1 1 86.85914234 81.48341905 46.20216756
+2068 Atom 1 1 1 1
+1 1 1 84.18556884 81.45928496 48.91789672
+2069 Atom 1 1 1 1
+1 1 1 85.53485380 80.15453033 47.48935604
+2070 Atom 1 1 1 1
+1 1 1 88.20591248 80.12476495 50.23009599
+2071 Atom 1 1 1 1
+1 1 1 88.25330879 82.85289710 47.52172564
+2072 Atom 1 1 1 1
+1 1 1 85.52637509 82.81463199 50.25329020
+2073 Atom 1 1 1 1
+1 1 1 84.13908238 84.15167169 46.15806945
+2074 Atom 1 1 1 1
+1 1 1 86.94489345 84.22237198 48.85230559
+2075 Atom 1 1 1 1
+1 1 1 86.88993461 86.87229478 46.21111441
+2076 Atom 1 1 1 1
+1 1 1 84.14344461 86.88578679 48.83963250
+2077 Atom 1 1 1 1
+1 1 1 85.54862584 85.50794422 47.47790327
+2078 Atom 1 1 1 1
+1 1 1 88.26149392 85.53729691 50.20191111
+2079 Atom 1 1 1 1
+1 1 1 88.29775865 88.20652113 47.53475306
+2080 Atom 1 1 1 1
+1 1 1 85.54503171 88.28607846 50.19293406
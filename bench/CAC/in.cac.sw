@@ -0,0 +1,22 @@
+# Si CAC block with an atomistic slab, Stillinger-Weber potential
+
+variable	data index data.cac.sw
+
+units		metal
+boundary	s s s
+atom_style	CAC 8 8
+newton		off
+
+read_data	${data}
+
+pair_style	CAC/sw
+pair_coeff	* * Si.sw Si
+
+compute		nodal_temp all nodal_temp
+thermo_style	custom step c_nodal_temp
+thermo		5
+
+fix		1 all nve_CAC
+
+timestep	0.001
+run		20
@@ -345,8 +345,63 @@ void CommKokkos::reverse_comm_device()
 
 void CommKokkos::forward_comm_fix(Fix *fix, int size)
 {
-  k_sendlist.sync<LMPHostType>();
-  CommBrick::forward_comm_fix(fix,size);
+  if (fix->execution_space == Device && dynamic_cast<KokkosBase*>(fix)) {
+    k_sendlist.sync<LMPDeviceType>();
+    forward_comm_fix_device<LMPDeviceType>(fix,size);
+  } else {
+    k_sendlist.sync<LMPHostType>();
+    CommBrick::forward_comm_fix(fix,size);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   forward comm of a Kokkos fix that packs its own data on the device
+   if self, unpack directly from the send buffer
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void CommKokkos::forward_comm_fix_device(Fix *fix, int size)
+{
+  int iswap,n;
+  MPI_Request request;
+
+  int nsize = size ? size : fix->comm_forward;
+  KokkosBase* fixKKBase = dynamic_cast<KokkosBase*>(fix);
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+    int n = MAX(max_buf_pair,nsize*sendnum[iswap]);
+    n = MAX(n,nsize*recvnum[iswap]);
+    if (n > max_buf_pair)
+      grow_buf_pair(n);
+  }
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+
+    // pack buffer
+
+    n = fixKKBase->pack_forward_comm_kokkos(sendnum[iswap],k_sendlist,
+                                            iswap,k_buf_send_pair,
+                                            pbc_flag[iswap],pbc[iswap]);
+    DeviceType::fence();
+
+    // exchange with another proc
+
+    if (sendproc[iswap] != me) {
+      if (recvnum[iswap])
+        MPI_Irecv(k_buf_recv_pair.view<DeviceType>().ptr_on_device(),
+                  nsize*recvnum[iswap],MPI_DOUBLE,
+                  recvproc[iswap],0,world,&request);
+      if (sendnum[iswap])
+        MPI_Send(k_buf_send_pair.view<DeviceType>().ptr_on_device(),n,
+                 MPI_DOUBLE,sendproc[iswap],0,world);
+      if (recvnum[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+      fixKKBase->unpack_forward_comm_kokkos(recvnum[iswap],firstrecv[iswap],
+                                            k_buf_recv_pair);
+    } else
+      fixKKBase->unpack_forward_comm_kokkos(recvnum[iswap],firstrecv[iswap],
+                                            k_buf_send_pair);
+    DeviceType::fence();
+  }
 }
 
 void CommKokkos::reverse_comm_fix(Fix *fix, int size)
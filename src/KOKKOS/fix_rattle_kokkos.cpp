@@ -0,0 +1,889 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include <string.h>
+#include "fix_rattle_kokkos.h"
+#include "atom_kokkos.h"
+#include "atom_masks.h"
+#include "comm.h"
+#include "force.h"
+#include "modify.h"
+#include "update.h"
+#include "memory_kokkos.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+enum{V,VP,XSHAKE};
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+FixRattleKokkos<DeviceType>::FixRattleKokkos(LAMMPS *lmp, int narg, char **arg) :
+  FixShakeKokkos<DeviceType>(lmp, narg, arg)
+{
+  this->rattle = 1;
+  this->datamask_modify = F_MASK | V_MASK;
+
+  // allocate memory for unconstrained velocity update
+
+  vp = NULL;
+  grow_arrays(this->atom->nmax);
+
+  // default communication mode
+  // necessary for compatibility with SHAKE
+  // see pack_forward and unpack_forward
+
+  comm_mode = XSHAKE;
+  this->vflag_post_force = 0;
+
+  // 2 = RATTLE determinant = 0.0
+
+  this->k_error_flag = DAT::tdual_int_1d("rattle:error_flag",3);
+  this->d_error_flag = this->k_error_flag.template view<DeviceType>();
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+FixRattleKokkos<DeviceType>::~FixRattleKokkos()
+{
+  if (this->copymode) return;
+
+  this->memoryKK->destroy_kokkos(k_vp,vp);
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+int FixRattleKokkos<DeviceType>::setmask()
+{
+  int mask = 0;
+  mask |= PRE_NEIGHBOR;
+  mask |= POST_FORCE;
+  mask |= POST_FORCE_RESPA;
+  mask |= FINAL_INTEGRATE;
+  mask |= FINAL_INTEGRATE_RESPA;
+  return mask;
+}
+
+/* ----------------------------------------------------------------------
+   initialize RATTLE and check that this is the last final_integrate fix
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::init()
+{
+  FixShakeKokkos<DeviceType>::init();
+
+  // show a warning if any final-integrate fix comes after this one
+
+  int after = 0;
+  int flag = 0;
+  for (int i = 0; i < this->modify->nfix; i++) {
+    if (strcmp(this->id,this->modify->fix[i]->id) == 0) after = 1;
+    else if ((this->modify->fmask[i] & FINAL_INTEGRATE) && after) flag = 1;
+  }
+
+  if (flag && this->comm->me == 0)
+    this->error->warning(FLERR,
+                   "Fix rattle should come after all other integration fixes ");
+}
+
+/* ----------------------------------------------------------------------
+   This method carries out an unconstrained velocity update first and
+   then applies the velocity corrections directly (v and vp are modified).
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::post_force(int vflag)
+{
+  // remember vflag for the coordinate correction in this->final_integrate
+
+  this->vflag_post_force = vflag;
+
+  this->atomKK->sync(this->execution_space,this->datamask_read);
+  this->set_views();
+  d_vp = k_vp.template view<DeviceType>();
+
+  // unconstrained velocity update by half a timestep
+  // similar to FixShake::unconstrained_update()
+
+  dtfv = 0.5 * this->update->dt * this->force->ftm2v;
+
+  this->copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,
+                       TagFixRattleUnconstrainedV>(0,this->nlocal_kk),*this);
+  this->copymode = 0;
+
+  // communicate the unconstrained velocities
+
+  if (this->nprocs > 1) {
+    comm_mode = VP;
+    k_vp.template modify<DeviceType>();
+    this->comm->forward_comm_fix(this);
+    k_vp.template sync<DeviceType>();
+  }
+
+  // correct the velocity for each molecule accordingly
+
+  vrattle_all();
+}
+
+/* ----------------------------------------------------------------------
+   let SHAKE calculate the constraining forces for the coordinates
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::final_integrate()
+{
+  comm_mode = XSHAKE;
+  FixShakeKokkos<DeviceType>::post_force(this->vflag_post_force);
+}
+
+/* ----------------------------------------------------------------------
+  Let shake calculate new constraining forces for the coordinates;
+  As opposed to the regular shake call, this method is usually called from
+  end_of_step fixes after the second velocity integration has happened.
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::shake_end_of_step(int vflag)
+{
+  if (this->nprocs > 1) {
+    this->atomKK->sync(this->execution_space,this->datamask_read);
+    this->set_views();
+    comm_mode = V;
+    this->comm->forward_comm_fix(this);
+    this->atomKK->sync(this->execution_space,V_MASK);
+  }
+
+  comm_mode = XSHAKE;
+  FixShakeKokkos<DeviceType>::shake_end_of_step(vflag);
+}
+
+/* ----------------------------------------------------------------------
+  Let shake calculate new constraining forces and correct the
+  coordinates. Nothing to do for rattle here.
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::correct_coordinates(int vflag)
+{
+  comm_mode = XSHAKE;
+  FixShakeKokkos<DeviceType>::correct_coordinates(vflag);
+}
+
+/* ----------------------------------------------------------------------
+   Remove the velocity component along any bond.
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::correct_velocities()
+{
+  this->atomKK->sync(this->execution_space,this->datamask_read);
+  this->set_views();
+  d_vp = k_vp.template view<DeviceType>();
+
+  // Copy current velocities instead of unconstrained_update, because the
+  // correction should happen instantaneously and not after the next half step.
+
+  this->copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixRattleCopyV>
+                       (0,this->nlocal_kk),*this);
+  this->copymode = 0;
+
+  // communicate the unconstrained velocities
+
+  if (this->nprocs > 1) {
+    comm_mode = VP;
+    k_vp.template modify<DeviceType>();
+    this->comm->forward_comm_fix(this);
+    k_vp.template sync<DeviceType>();
+  }
+
+  // correct the velocity for each molecule accordingly
+
+  vrattle_all();
+  this->atomKK->modified(this->execution_space,V_MASK);
+}
+
+/* ----------------------------------------------------------------------
+   velocity correction of all clusters in the list
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::vrattle_all()
+{
+  this->copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixRattleVrattle>
+                       (0,this->nlist),*this);
+  this->copymode = 0;
+
+  error_check();
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::error_check()
+{
+  FixShakeKokkos<DeviceType>::error_check();
+  if (this->k_error_flag.h_view(2))
+    this->error->one(FLERR,"Rattle determinant = 0.0");
+}
+
+/* ----------------------------------------------------------------------
+   carry out an unconstrained velocity update (vp is modified)
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::operator()(TagFixRattleUnconstrainedV,
+                                             const int &i) const
+{
+  if (this->d_shake_flag[i]) {
+    double dtfvinvm;
+    if (this->rmass_flag) dtfvinvm = dtfv / this->d_rmass[i];
+    else dtfvinvm = dtfv / this->d_mass[this->d_type[i]];
+    for (int k = 0; k < 3; k++)
+      d_vp(i,k) = this->d_v(i,k) + dtfvinvm * this->d_f(i,k);
+  } else d_vp(i,0) = d_vp(i,1) = d_vp(i,2) = 0.0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::operator()(TagFixRattleCopyV,
+                                             const int &i) const
+{
+  if (this->d_shake_flag[i]) {
+    for (int k = 0; k < 3; k++)
+      d_vp(i,k) = this->d_v(i,k);
+  } else d_vp(i,0) = d_vp(i,1) = d_vp(i,2) = 0.0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::operator()(TagFixRattleVrattle,
+                                             const int &i) const
+{
+  const int flag = this->d_shake_flag[this->d_list[i]];
+  if (flag == 2) vrattle2(i);
+  else if (flag == 3) vrattle3(i);
+  else if (flag == 4) vrattle4(i);
+  else vrattle3angle(i);
+}
+
+/* ----------------------------------------------------------------------
+   velocity correction of cluster i of the list, same math as
+   FixRattle::vrattle2() etc, atoms are found via d_closest
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::vrattle3angle(int i) const
+{
+  double c[3], l[3], a[3][3], r01[3], imass[3],
+         r02[3], r12[3], vp01[3], vp02[3], vp12[3];
+
+  // local atom IDs and constraint distances
+
+  const int i0 = this->d_closest(i,0);
+  const int i1 = this->d_closest(i,1);
+  const int i2 = this->d_closest(i,2);
+
+  // r01,r02,r12 = distance vec between atoms
+
+  for (int k = 0; k < 3; k++) {
+    r01[k] = this->d_x(i1,k) - this->d_x(i0,k);
+    r02[k] = this->d_x(i2,k) - this->d_x(i0,k);
+    r12[k] = this->d_x(i2,k) - this->d_x(i1,k);
+  }
+
+  // take into account periodicity
+
+  this->minimum_image(r01);
+  this->minimum_image(r02);
+  this->minimum_image(r12);
+
+  // v01,v02,v12 = velocity differences
+
+  for (int k = 0; k < 3; k++) {
+    vp01[k] = d_vp(i1,k) - d_vp(i0,k);
+    vp02[k] = d_vp(i2,k) - d_vp(i0,k);
+    vp12[k] = d_vp(i2,k) - d_vp(i1,k);
+  }
+
+  // matrix coeffs and rhs for lamda equations
+
+  if (this->rmass_flag) {
+    imass[0] = 1.0/this->d_rmass[i0];
+    imass[1] = 1.0/this->d_rmass[i1];
+    imass[2] = 1.0/this->d_rmass[i2];
+  } else {
+    imass[0] = 1.0/this->d_mass[this->d_type[i0]];
+    imass[1] = 1.0/this->d_mass[this->d_type[i1]];
+    imass[2] = 1.0/this->d_mass[this->d_type[i2]];
+  }
+
+  // setup matrix
+
+  a[0][0]   =   (imass[1] + imass[0])   * (r01[0]*r01[0] + r01[1]*r01[1] + r01[2]*r01[2]);
+  a[0][1]   =   (imass[0]           )   * (r01[0]*r02[0] + r01[1]*r02[1] + r01[2]*r02[2]);
+  a[0][2]   =   (-imass[1]          )   * (r01[0]*r12[0] + r01[1]*r12[1] + r01[2]*r12[2]);
+  a[1][0]   =   a[0][1];
+  a[1][1]   =   (imass[0] + imass[2])   * (r02[0]*r02[0] + r02[1]*r02[1] + r02[2]*r02[2]);
+  a[1][2]   =   (imass[2]           )   * (r02[0]*r12[0] + r02[1]*r12[1] + r02[2]*r12[2]);
+  a[2][0]   =   a[0][2];
+  a[2][1]   =   a[1][2];
+  a[2][2]   =   (imass[2] + imass[1])   * (r12[0]*r12[0] + r12[1]*r12[1] + r12[2]*r12[2]);
+
+  // setup RHS
+
+  c[0]  = -(vp01[0]*r01[0] + vp01[1]*r01[1] + vp01[2]*r01[2]);
+  c[1]  = -(vp02[0]*r02[0] + vp02[1]*r02[1] + vp02[2]*r02[2]);
+  c[2]  = -(vp12[0]*r12[0] + vp12[1]*r12[1] + vp12[2]*r12[2]);
+
+  // calculate the inverse matrix exactly
+
+  if (!solve3x3exactly(a,c,l)) return;
+
+  // add corrections to the velocities if processor owns atom
+
+  const int nlocal = this->nlocal_kk;
+  if (i0 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i0,k)  -=  imass[0]*  (  l[0] * r01[k] + l[1] * r02[k] );
+  }
+  if (i1 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i1,k)  -=  imass[1] * ( -l[0] * r01[k] + l[2] * r12[k] );
+  }
+  if (i2 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i2,k) -=   imass[2] * ( -l[1] * r02[k] - l[2] * r12[k] );
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::vrattle2(int i) const
+{
+  double imass[2], r01[3], vp01[3];
+
+  // local atom IDs and constraint distances
+
+  const int i0 = this->d_closest(i,0);
+  const int i1 = this->d_closest(i,1);
+
+  // r01 = distance vec between atoms, with PBC
+
+  for (int k = 0; k < 3; k++)
+    r01[k] = this->d_x(i1,k) - this->d_x(i0,k);
+  this->minimum_image(r01);
+
+  // v01 = distance vectors for velocities
+
+  for (int k = 0; k < 3; k++)
+    vp01[k] = d_vp(i1,k) - d_vp(i0,k);
+
+  // matrix coeffs and rhs for lamda equations
+
+  if (this->rmass_flag) {
+    imass[0] = 1.0/this->d_rmass[i0];
+    imass[1] = 1.0/this->d_rmass[i1];
+  } else {
+    imass[0] = 1.0/this->d_mass[this->d_type[i0]];
+    imass[1] = 1.0/this->d_mass[this->d_type[i1]];
+  }
+
+  // Lagrange multiplier: exact solution
+
+  const double l01 = - (r01[0]*vp01[0] + r01[1]*vp01[1] + r01[2]*vp01[2]) /
+    ((r01[0]*r01[0] + r01[1]*r01[1] + r01[2]*r01[2]) * (imass[0] + imass[1]));
+
+  // add corrections to the velocities if the process owns this atom
+
+  const int nlocal = this->nlocal_kk;
+  if (i0 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i0,k) -= imass[0] * l01 * r01[k];
+  }
+  if (i1 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i1,k) -= imass[1] * (-l01) * r01[k];
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::vrattle3(int i) const
+{
+  double imass[3], r01[3], r02[3], vp01[3], vp02[3],
+         a[2][2],c[2],l[2];
+
+  // local atom IDs and constraint distances
+
+  const int i0 = this->d_closest(i,0);
+  const int i1 = this->d_closest(i,1);
+  const int i2 = this->d_closest(i,2);
+
+  // r01,r02 = distance vec between atoms, with PBC
+
+  for (int k = 0; k < 3; k++) {
+    r01[k] = this->d_x(i1,k) - this->d_x(i0,k);
+    r02[k] = this->d_x(i2,k) - this->d_x(i0,k);
+  }
+
+  this->minimum_image(r01);
+  this->minimum_image(r02);
+
+  // vp01,vp02 =  distance vectors between velocities
+
+  for (int k = 0; k < 3; k++) {
+    vp01[k] = d_vp(i1,k) - d_vp(i0,k);
+    vp02[k] = d_vp(i2,k) - d_vp(i0,k);
+  }
+
+  if (this->rmass_flag) {
+    imass[0] = 1.0/this->d_rmass[i0];
+    imass[1] = 1.0/this->d_rmass[i1];
+    imass[2] = 1.0/this->d_rmass[i2];
+  } else {
+    imass[0] = 1.0/this->d_mass[this->d_type[i0]];
+    imass[1] = 1.0/this->d_mass[this->d_type[i1]];
+    imass[2] = 1.0/this->d_mass[this->d_type[i2]];
+  }
+
+  // setup matrix
+
+  a[0][0]   =   (imass[1] + imass[0])   * (r01[0]*r01[0] + r01[1]*r01[1] + r01[2]*r01[2]);
+  a[0][1]   =   (imass[0]           )   * (r01[0]*r02[0] + r01[1]*r02[1] + r01[2]*r02[2]);
+  a[1][0]   =   a[0][1];
+  a[1][1]   =   (imass[0] + imass[2])   * (r02[0]*r02[0] + r02[1]*r02[1] + r02[2]*r02[2]);
+
+  // setup RHS
+
+  c[0]  = - (vp01[0]*r01[0] + vp01[1]*r01[1] + vp01[2]*r01[2]);
+  c[1]  = - (vp02[0]*r02[0] + vp02[1]*r02[1] + vp02[2]*r02[2]);
+
+  // calculate the inverse 2x2 matrix exactly
+
+  if (!solve2x2exactly(a,c,l)) return;
+
+  // add corrections to the velocities if the process owns this atom
+
+  const int nlocal = this->nlocal_kk;
+  if (i0 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i0,k) -= imass[0] * (  l[0] * r01[k] + l[1] * r02[k] );
+  }
+  if (i1 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i1,k) -= imass[1] * ( -l[0] * r01[k] );
+  }
+  if (i2 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i2,k) -= imass[2] * ( -l[1] * r02[k] );
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::vrattle4(int i) const
+{
+  double imass[4], c[3], l[3], a[3][3],
+         r01[3], r02[3], r03[3], vp01[3], vp02[3], vp03[3];
+
+  // local atom IDs and constraint distances
+
+  const int i0 = this->d_closest(i,0);
+  const int i1 = this->d_closest(i,1);
+  const int i2 = this->d_closest(i,2);
+  const int i3 = this->d_closest(i,3);
+
+  // r01,r02,r12 = distance vec between atoms, with PBC
+
+  for (int k = 0; k < 3; k++) {
+    r01[k] = this->d_x(i1,k) - this->d_x(i0,k);
+    r02[k] = this->d_x(i2,k) - this->d_x(i0,k);
+    r03[k] = this->d_x(i3,k) - this->d_x(i0,k);
+  }
+
+  this->minimum_image(r01);
+  this->minimum_image(r02);
+  this->minimum_image(r03);
+
+  // vp01,vp02,vp03 = distance vectors between velocities
+
+  for (int k = 0; k < 3; k++) {
+    vp01[k] = d_vp(i1,k) - d_vp(i0,k);
+    vp02[k] = d_vp(i2,k) - d_vp(i0,k);
+    vp03[k] = d_vp(i3,k) - d_vp(i0,k);
+  }
+
+  // matrix coeffs and rhs for lamda equations
+
+  if (this->rmass_flag) {
+    imass[0] = 1.0/this->d_rmass[i0];
+    imass[1] = 1.0/this->d_rmass[i1];
+    imass[2] = 1.0/this->d_rmass[i2];
+    imass[3] = 1.0/this->d_rmass[i3];
+  } else {
+    imass[0] = 1.0/this->d_mass[this->d_type[i0]];
+    imass[1] = 1.0/this->d_mass[this->d_type[i1]];
+    imass[2] = 1.0/this->d_mass[this->d_type[i2]];
+    imass[3] = 1.0/this->d_mass[this->d_type[i3]];
+  }
+
+  // setup matrix
+
+  a[0][0]   =   (imass[0] + imass[1])   * (r01[0]*r01[0] + r01[1]*r01[1] + r01[2]*r01[2]);
+  a[0][1]   =   (imass[0]           )   * (r01[0]*r02[0] + r01[1]*r02[1] + r01[2]*r02[2]);
+  a[0][2]   =   (imass[0]           )   * (r01[0]*r03[0] + r01[1]*r03[1] + r01[2]*r03[2]);
+  a[1][0]   =   a[0][1];
+  a[1][1]   =   (imass[0] + imass[2])   * (r02[0]*r02[0] + r02[1]*r02[1] + r02[2]*r02[2]);
+  a[1][2]   =   (imass[0]           )   * (r02[0]*r03[0] + r02[1]*r03[1] + r02[2]*r03[2]);
+  a[2][0]   =   a[0][2];
+  a[2][1]   =   a[1][2];
+  a[2][2]   =   (imass[0] + imass[3])   * (r03[0]*r03[0] + r03[1]*r03[1] + r03[2]*r03[2]);
+
+  // setup RHS
+
+  c[0]  = - (vp01[0]*r01[0] + vp01[1]*r01[1] + vp01[2]*r01[2]);
+  c[1]  = - (vp02[0]*r02[0] + vp02[1]*r02[1] + vp02[2]*r02[2]);
+  c[2]  = - (vp03[0]*r03[0] + vp03[1]*r03[1] + vp03[2]*r03[2]);
+
+  // calculate the inverse 3x3 matrix exactly
+
+  if (!solve3x3exactly(a,c,l)) return;
+
+  // add corrections to the velocities if the process owns this atom
+
+  const int nlocal = this->nlocal_kk;
+  if (i0 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i0,k) -= imass[0] * (  l[0] * r01[k] + l[1] * r02[k] + l[2] * r03[k]);
+  }
+  if (i1 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i1,k) -= imass[1] * (-l[0] * r01[k]);
+  }
+  if (i2 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i2,k) -= imass[2] * ( -l[1] * r02[k]);
+  }
+  if (i3 < nlocal) {
+    for (int k=0; k<3; k++)
+      this->d_v(i3,k) -= imass[3] * ( -l[2] * r03[k]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   exact solutions, return 0 and flag the error if the matrix is singular
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+int FixRattleKokkos<DeviceType>::solve2x2exactly(const double a[][2],
+                                                 const double c[],
+                                                 double l[]) const
+{
+  double determ, determinv;
+
+  // calculate the determinant of the matrix
+
+  determ = a[0][0] * a[1][1] - a[0][1] * a[1][0];
+
+  // check if matrix is actually invertible
+
+  if (determ == 0.0) {
+    this->d_error_flag[2] = 1;
+    return 0;
+  }
+  determinv = 1.0/determ;
+
+  // Calculate the solution:  (l01, l02)^T = A^(-1) * c
+
+  l[0] = determinv * ( a[1][1] * c[0]  - a[0][1] * c[1]);
+  l[1] = determinv * (-a[1][0] * c[0]  + a[0][0] * c[1]);
+  return 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+int FixRattleKokkos<DeviceType>::solve3x3exactly(const double a[][3],
+                                                 const double c[],
+                                                 double l[]) const
+{
+  double ai[3][3];
+  double determ, determinv;
+
+  // calculate the determinant of the matrix
+
+  determ = a[0][0]*a[1][1]*a[2][2] + a[0][1]*a[1][2]*a[2][0] +
+    a[0][2]*a[1][0]*a[2][1] - a[0][0]*a[1][2]*a[2][1] -
+    a[0][1]*a[1][0]*a[2][2] - a[0][2]*a[1][1]*a[2][0];
+
+  // check if matrix is actually invertible
+
+  if (determ == 0.0) {
+    this->d_error_flag[2] = 1;
+    return 0;
+  }
+
+  // calculate the inverse 3x3 matrix: A^(-1) = (ai_jk)
+
+  determinv = 1.0/determ;
+  ai[0][0] =  determinv * (a[1][1]*a[2][2] - a[1][2]*a[2][1]);
+  ai[0][1] = -determinv * (a[0][1]*a[2][2] - a[0][2]*a[2][1]);
+  ai[0][2] =  determinv * (a[0][1]*a[1][2] - a[0][2]*a[1][1]);
+  ai[1][0] = -determinv * (a[1][0]*a[2][2] - a[1][2]*a[2][0]);
+  ai[1][1] =  determinv * (a[0][0]*a[2][2] - a[0][2]*a[2][0]);
+  ai[1][2] = -determinv * (a[0][0]*a[1][2] - a[0][2]*a[1][0]);
+  ai[2][0] =  determinv * (a[1][0]*a[2][1] - a[1][1]*a[2][0]);
+  ai[2][1] = -determinv * (a[0][0]*a[2][1] - a[0][1]*a[2][0]);
+  ai[2][2] =  determinv * (a[0][0]*a[1][1] - a[0][1]*a[1][0]);
+
+  // calculate the solution:  (l01, l02, l12)^T = A^(-1) * c
+
+  for (int i=0; i<3; i++) {
+    l[i] = 0;
+    for (int j=0; j<3; j++)
+      l[i] += ai[i][j] * c[j];
+  }
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   forward comm on the host, used by CommKokkos
+   when the fix runs on the host
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+int FixRattleKokkos<DeviceType>::pack_forward_comm(int n, int *list,
+                                                   double *buf,
+                                                   int pbc_flag, int *pbc)
+{
+  int i,j,m;
+  m = 0;
+
+  switch (comm_mode) {
+    case XSHAKE:
+      m = FixShakeKokkos<DeviceType>::pack_forward_comm(n,list,buf,
+                                                        pbc_flag,pbc);
+      break;
+
+    case VP:
+      k_vp.template sync<LMPHostType>();
+      for (i = 0; i < n; i++) {
+        j = list[i];
+        buf[m++] = vp[j][0];
+        buf[m++] = vp[j][1];
+        buf[m++] = vp[j][2];
+      }
+      break;
+
+    case V:
+      this->atomKK->sync(Host,V_MASK);
+      double **v = this->atom->v;
+      for (i = 0; i < n; i++) {
+        j = list[i];
+        buf[m++] = v[j][0];
+        buf[m++] = v[j][1];
+        buf[m++] = v[j][2];
+      }
+      break;
+  }
+  return m;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::unpack_forward_comm(int n, int first,
+                                                      double *buf)
+{
+  int i, m, last;
+  m = 0;
+  last = first + n;
+
+  switch (comm_mode) {
+    case XSHAKE:
+      FixShakeKokkos<DeviceType>::unpack_forward_comm(n,first,buf);
+      break;
+
+    case VP:
+      for (i = first; i < last; i++) {
+        vp[i][0] = buf[m++];
+        vp[i][1] = buf[m++];
+        vp[i][2] = buf[m++];
+      }
+      k_vp.template modify<LMPHostType>();
+      break;
+
+    case V:
+      double **v = this->atom->v;
+      for (i = first; i < last; i++) {
+        v[i][0] = buf[m++];
+        v[i][1] = buf[m++];
+        v[i][2] = buf[m++];
+      }
+      this->atomKK->modified(Host,V_MASK);
+      break;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   forward comm on the device
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+int FixRattleKokkos<DeviceType>::pack_forward_comm_kokkos(
+  int n, DAT::tdual_int_2d k_sendlist, int iswap_in,
+  DAT::tdual_xfloat_1d &buf, int pbc_flag_in, int *pbc)
+{
+  if (comm_mode == XSHAKE)
+    return FixShakeKokkos<DeviceType>::pack_forward_comm_kokkos(
+      n,k_sendlist,iswap_in,buf,pbc_flag_in,pbc);
+
+  this->d_sendlist = k_sendlist.view<DeviceType>();
+  this->iswap = iswap_in;
+  this->d_buf = buf.view<DeviceType>();
+
+  this->copymode = 1;
+  if (comm_mode == VP)
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixRattlePackVP>
+                         (0,n),*this);
+  else
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixRattlePackV>
+                         (0,n),*this);
+  this->copymode = 0;
+  return 3*n;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::unpack_forward_comm_kokkos(
+  int n, int first_in, DAT::tdual_xfloat_1d &buf)
+{
+  if (comm_mode == XSHAKE) {
+    FixShakeKokkos<DeviceType>::unpack_forward_comm_kokkos(n,first_in,buf);
+    return;
+  }
+
+  this->first = first_in;
+  this->d_buf = buf.view<DeviceType>();
+
+  this->copymode = 1;
+  if (comm_mode == VP)
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixRattleUnpackVP>
+                         (0,n),*this);
+  else
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixRattleUnpackV>
+                         (0,n),*this);
+  this->copymode = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::operator()(TagFixRattlePackVP,
+                                             const int &i) const
+{
+  const int j = this->d_sendlist(this->iswap,i);
+  this->d_buf[3*i] = d_vp(j,0);
+  this->d_buf[3*i+1] = d_vp(j,1);
+  this->d_buf[3*i+2] = d_vp(j,2);
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::operator()(TagFixRattleUnpackVP,
+                                             const int &i) const
+{
+  const int j = this->first + i;
+  d_vp(j,0) = this->d_buf[3*i];
+  d_vp(j,1) = this->d_buf[3*i+1];
+  d_vp(j,2) = this->d_buf[3*i+2];
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::operator()(TagFixRattlePackV,
+                                             const int &i) const
+{
+  const int j = this->d_sendlist(this->iswap,i);
+  this->d_buf[3*i] = this->d_v(j,0);
+  this->d_buf[3*i+1] = this->d_v(j,1);
+  this->d_buf[3*i+2] = this->d_v(j,2);
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixRattleKokkos<DeviceType>::operator()(TagFixRattleUnpackV,
+                                             const int &i) const
+{
+  const int j = this->first + i;
+  this->d_v(j,0) = this->d_buf[3*i];
+  this->d_v(j,1) = this->d_buf[3*i+1];
+  this->d_v(j,2) = this->d_buf[3*i+2];
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of local atom-based arrays
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+double FixRattleKokkos<DeviceType>::memory_usage()
+{
+  int nmax = this->atom->nmax;
+  double bytes = FixShakeKokkos<DeviceType>::memory_usage();
+  bytes += nmax*3 * sizeof(double);
+  return bytes;
+}
+
+/* ----------------------------------------------------------------------
+   allocate local atom-based arrays
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixRattleKokkos<DeviceType>::grow_arrays(int nmax)
+{
+  FixShakeKokkos<DeviceType>::grow_arrays(nmax);
+  this->memoryKK->destroy_kokkos(k_vp,vp);
+  this->memoryKK->create_kokkos(k_vp,vp,nmax,3,"rattle:vp");
+}
+
+namespace LAMMPS_NS {
+template class FixRattleKokkos<LMPDeviceType>;
+#ifdef KOKKOS_HAVE_CUDA
+template class FixRattleKokkos<LMPHostType>;
+#endif
+}
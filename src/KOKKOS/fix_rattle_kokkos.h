@@ -0,0 +1,135 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(rattle/kk,FixRattleKokkos<LMPDeviceType>)
+FixStyle(rattle/kk/device,FixRattleKokkos<LMPDeviceType>)
+FixStyle(rattle/kk/host,FixRattleKokkos<LMPHostType>)
+
+#else
+
+#ifndef LMP_FIX_RATTLE_KOKKOS_H
+#define LMP_FIX_RATTLE_KOKKOS_H
+
+#include "fix_shake_kokkos.h"
+
+namespace LAMMPS_NS {
+
+struct TagFixRattleUnconstrainedV{};
+struct TagFixRattleCopyV{};
+struct TagFixRattleVrattle{};
+struct TagFixRattlePackVP{};
+struct TagFixRattleUnpackVP{};
+struct TagFixRattlePackV{};
+struct TagFixRattleUnpackV{};
+
+// RATTLE on top of the Kokkos SHAKE, the same as FixRattle does
+//   on top of FixShake, but FixRattle itself is not a base class
+
+template<class DeviceType>
+class FixRattleKokkos : public FixShakeKokkos<DeviceType> {
+ public:
+  typedef DeviceType device_type;
+  typedef ArrayTypes<DeviceType> AT;
+
+  FixRattleKokkos(class LAMMPS *, int, char **);
+  virtual ~FixRattleKokkos();
+  int setmask();
+  virtual void init();
+  virtual void post_force(int);
+  virtual void final_integrate();
+
+  virtual void correct_coordinates(int);
+  virtual void correct_velocities();
+  virtual void shake_end_of_step(int);
+
+  virtual double memory_usage();
+  virtual void grow_arrays(int);
+  virtual int pack_forward_comm(int, int *, double *, int, int *);
+  virtual void unpack_forward_comm(int, int, double *);
+  int pack_forward_comm_kokkos(int, DAT::tdual_int_2d, int,
+                               DAT::tdual_xfloat_1d &, int, int *);
+  void unpack_forward_comm_kokkos(int, int, DAT::tdual_xfloat_1d &);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixRattleUnconstrainedV, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixRattleCopyV, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixRattleVrattle, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixRattlePackVP, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixRattleUnpackVP, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixRattlePackV, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixRattleUnpackV, const int&) const;
+
+ protected:
+  double **vp;                // unconstrained velocities, aliases k_vp
+  int comm_mode;              // mode for communication pack/unpack
+  double dtfv;
+
+  DAT::tdual_double_2d k_vp;
+  typename AT::t_double_2d d_vp;
+
+  void vrattle_all();
+  virtual void error_check();
+
+  KOKKOS_INLINE_FUNCTION
+  void vrattle2(int) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void vrattle3(int) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void vrattle4(int) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void vrattle3angle(int) const;
+
+  KOKKOS_INLINE_FUNCTION
+  int solve2x2exactly(const double a[][2], const double c[], double l[]) const;
+
+  KOKKOS_INLINE_FUNCTION
+  int solve3x3exactly(const double a[][3], const double c[], double l[]) const;
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+W: Fix rattle should come after all other integration fixes
+
+This fix is designed to work after all other integration fixes change
+atom positions.  Thus it should be the last integration fix specified.
+If not, it will not satisfy the desired constraints as well as it
+otherwise would.
+
+E: Rattle determinant = 0.0
+
+The determinant of the matrix being solved for a single cluster
+specified by the fix rattle command is numerically invalid.
+
+*/
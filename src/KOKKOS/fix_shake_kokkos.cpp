@@ -0,0 +1,1473 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "fix_shake_kokkos.h"
+#include "atom_kokkos.h"
+#include "atom_masks.h"
+#include "comm.h"
+#include "domain.h"
+#include "force.h"
+#include "update.h"
+#include "memory_kokkos.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+FixShakeKokkos<DeviceType>::FixShakeKokkos(LAMMPS *lmp, int narg, char **arg) :
+  FixShake(lmp, narg, arg)
+{
+  kokkosable = 1;
+  atomKK = (AtomKokkos *) atom;
+  execution_space = ExecutionSpaceFromDevice<DeviceType>::space;
+
+  datamask_read = X_MASK | V_MASK | F_MASK | TYPE_MASK | RMASS_MASK;
+  datamask_modify = F_MASK;
+
+  // FixShake() flagged the constrained bonds and angles on the host
+
+  atomKK->modified(Host,BOND_MASK | ANGLE_MASK);
+
+  // FixShake() found the clusters in plain host arrays
+  // move shake_flag,shake_type into DualViews the FixShake pointers alias,
+  //   shake_atom is only used on the host and stays as it is
+  // xshake,ftmp,vtmp are replaced by views
+
+  int *shake_flag_tmp = shake_flag;
+  int **shake_type_tmp = shake_type;
+  shake_flag = NULL;
+  shake_type = NULL;
+  memory->destroy(xshake);
+  memory->destroy(ftmp);
+  memory->destroy(vtmp);
+
+  grow_arrays(atom->nmax);
+
+  int nlocal = atom->nlocal;
+  for (int i = 0; i < nlocal; i++) {
+    shake_flag[i] = shake_flag_tmp[i];
+    shake_type[i][0] = shake_type_tmp[i][0];
+    shake_type[i][1] = shake_type_tmp[i][1];
+    shake_type[i][2] = shake_type_tmp[i][2];
+  }
+  memory->destroy(shake_flag_tmp);
+  memory->destroy(shake_type_tmp);
+  k_shake_flag.template modify<LMPHostType>();
+  k_shake_type.template modify<LMPHostType>();
+
+  k_error_flag = DAT::tdual_int_1d("shake:error_flag",2);
+  d_error_flag = k_error_flag.template view<DeviceType>();
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+FixShakeKokkos<DeviceType>::~FixShakeKokkos()
+{
+  if (copymode) return;
+
+  // ~FixShake() restores the bond and angle types on the host
+  //   and frees shake_flag,shake_type with memory->destroy()
+  // hand it a plain copy of shake_flag, it does not read shake_type
+
+  atomKK->sync(Host,BOND_MASK | ANGLE_MASK);
+  atomKK->modified(Host,BOND_MASK | ANGLE_MASK);
+
+  int nlocal = atom->nlocal;
+  int *shake_flag_tmp;
+  memory->create(shake_flag_tmp,nlocal,"shake:shake_flag");
+  for (int i = 0; i < nlocal; i++) shake_flag_tmp[i] = shake_flag[i];
+
+  memoryKK->destroy_kokkos(k_shake_flag,shake_flag);
+  memoryKK->destroy_kokkos(k_shake_type,shake_type);
+  memoryKK->destroy_kokkos(k_xshake,xshake);
+  memoryKK->destroy_kokkos(k_vatom,vatom);
+  shake_flag = shake_flag_tmp;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::init()
+{
+  FixShake::init();
+
+  if (strstr(update->integrate_style,"respa"))
+    error->all(FLERR,"Cannot (yet) use rRESPA with Kokkos fix shake");
+
+  // constraint distances are set by FixShake::init()
+
+  int nbondtypes = atom->nbondtypes;
+  k_bond_distance = DAT::tdual_float_1d("shake:bond_distance",nbondtypes+1);
+  for (int i = 1; i <= nbondtypes; i++)
+    k_bond_distance.h_view(i) = bond_distance[i];
+  k_bond_distance.template modify<LMPHostType>();
+  k_bond_distance.template sync<DeviceType>();
+  d_bond_distance = k_bond_distance.template view<DeviceType>();
+
+  int nangletypes = atom->nangletypes;
+  k_angle_distance = DAT::tdual_float_1d("shake:angle_distance",nangletypes+1);
+  for (int i = 1; i <= nangletypes; i++)
+    k_angle_distance.h_view(i) = angle_distance[i];
+  k_angle_distance.template modify<LMPHostType>();
+  k_angle_distance.template sync<DeviceType>();
+  d_angle_distance = k_angle_distance.template view<DeviceType>();
+
+  atomKK->k_mass.template modify<LMPHostType>();
+  atomKK->k_mass.template sync<DeviceType>();
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::setup(int vflag)
+{
+  // stats() uses coords on the host
+
+  if (output_every) atomKK->sync(Host,X_MASK);
+
+  FixShake::setup(vflag);
+}
+
+/* ----------------------------------------------------------------------
+   build list of SHAKE clusters on the host with FixShake::pre_neighbor()
+   copy it and the local indices of cluster atoms to the device
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::pre_neighbor()
+{
+  FixShake::pre_neighbor();
+
+  // shake_flag,shake_type may have been changed on the host
+  //   by exchange, sorting or molecule insertion
+
+  k_shake_flag.template modify<LMPHostType>();
+  k_shake_type.template modify<LMPHostType>();
+  k_shake_flag.template sync<DeviceType>();
+  k_shake_type.template sync<DeviceType>();
+
+  if (nlist > (int) k_list.h_view.dimension_0()) {
+    k_list = DAT::tdual_int_1d("shake:list",maxlist);
+    k_closest = DAT::tdual_int_2d("shake:closest",maxlist,4);
+  }
+
+  int m,n;
+  for (int i = 0; i < nlist; i++) {
+    m = list[i];
+    k_list.h_view(i) = m;
+    n = shake_flag[m];
+    if (n == 1) n = 3;
+    for (int k = 0; k < n; k++)
+      k_closest.h_view(i,k) = atom->map(shake_atom[m][k]);
+  }
+
+  k_list.template modify<LMPHostType>();
+  k_closest.template modify<LMPHostType>();
+  k_list.template sync<DeviceType>();
+  k_closest.template sync<DeviceType>();
+  d_list = k_list.template view<DeviceType>();
+  d_closest = k_closest.template view<DeviceType>();
+}
+
+/* ----------------------------------------------------------------------
+   compute the force adjustment for SHAKE constraint
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::post_force(int vflag)
+{
+  if (update->ntimestep == next_output) {
+    atomKK->sync(Host,X_MASK);
+    stats();
+  }
+
+  atomKK->sync(execution_space,datamask_read);
+  set_views();
+
+  // xshake = unconstrained move with current v,f
+  // communicate results if necessary
+
+  copymode = 1;
+
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixShakeUnconstrained>
+                       (0,nlocal_kk),*this);
+
+  if (nprocs > 1) {
+    k_xshake.template modify<DeviceType>();
+    comm->forward_comm_fix(this);
+    k_xshake.template sync<DeviceType>();
+  }
+
+  // virial setup
+
+  v_init_kokkos(vflag);
+
+  // loop over clusters to add constraint forces
+
+  EV_FLOAT ev;
+  if (evflag)
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<DeviceType,
+                            TagFixShakePostForce<1> >(0,nlist),*this,ev);
+  else
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,
+                         TagFixShakePostForce<0> >(0,nlist),*this);
+
+  copymode = 0;
+
+  if (evflag) {
+    if (vflag_global)
+      for (int n = 0; n < 6; n++) virial[n] += ev.v[n];
+    if (vflag_atom) {
+      k_vatom.template modify<DeviceType>();
+      k_vatom.template sync<LMPHostType>();
+    }
+  }
+
+  error_check();
+
+  // store vflag for coordinate_constraints_end_of_step()
+
+  vflag_post_force = vflag;
+}
+
+/* ----------------------------------------------------------------------
+   views of atom quantities and box settings used by the kernels
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::set_views()
+{
+  d_x = atomKK->k_x.template view<DeviceType>();
+  d_v = atomKK->k_v.template view<DeviceType>();
+  d_f = atomKK->k_f.template view<DeviceType>();
+  d_type = atomKK->k_type.template view<DeviceType>();
+  d_mass = atomKK->k_mass.template view<DeviceType>();
+  rmass_flag = atom->rmass_flag;
+  if (rmass_flag) d_rmass = atomKK->k_rmass.template view<DeviceType>();
+  d_shake_flag = k_shake_flag.template view<DeviceType>();
+  d_shake_type = k_shake_type.template view<DeviceType>();
+  d_xshake = k_xshake.template view<DeviceType>();
+  nlocal_kk = atom->nlocal;
+
+  triclinic = domain->triclinic;
+  xperiodic = domain->xperiodic;
+  yperiodic = domain->yperiodic;
+  zperiodic = domain->zperiodic;
+  xprd = domain->xprd;
+  yprd = domain->yprd;
+  zprd = domain->zprd;
+  xprd_half = domain->xprd_half;
+  yprd_half = domain->yprd_half;
+  zprd_half = domain->zprd_half;
+  xy = domain->xy;
+  xz = domain->xz;
+  yz = domain->yz;
+}
+
+/* ----------------------------------------------------------------------
+   set up the virial like Fix::v_setup() does,
+   but with a per-atom virial that is a DualView
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::v_init_kokkos(int vflag)
+{
+  if (!vflag) {
+    evflag = 0;
+    return;
+  }
+
+  if (thermo_virial && vflag/4 && atom->nmax > maxvatom) {
+    maxvatom = atom->nmax;
+    memoryKK->destroy_kokkos(k_vatom,vatom);
+    memoryKK->create_kokkos(k_vatom,vatom,maxvatom,"shake:vatom");
+  }
+
+  v_setup(vflag);
+
+  if (vflag_atom) {
+    k_vatom.template modify<LMPHostType>();
+    k_vatom.template sync<DeviceType>();
+    d_vatom = k_vatom.template view<DeviceType>();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   report clusters the device could not solve
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::error_check()
+{
+  k_error_flag.template modify<DeviceType>();
+  k_error_flag.template sync<LMPHostType>();
+
+  int warn = k_error_flag.h_view(0);
+  int fail = k_error_flag.h_view(1);
+  if (!warn && !fail) return;
+
+  if (warn) error->warning(FLERR,"Shake determinant < 0.0",0);
+  if (fail) error->one(FLERR,"Shake determinant = 0.0");
+
+  k_error_flag.h_view(0) = 0;
+  k_error_flag.h_view(1) = 0;
+  k_error_flag.template modify<LMPHostType>();
+  k_error_flag.template sync<DeviceType>();
+}
+
+/* ----------------------------------------------------------------------
+   update the unconstrained position of each atom
+   only for SHAKE clusters, else set to 0.0
+   assumes NVE update, seems to be accurate enough for NVT,NPT,NPH as well
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakeUnconstrained,
+                                            const int &i) const
+{
+  if (d_shake_flag[i]) {
+    double dtfmsq;
+    if (rmass_flag) dtfmsq = dtfsq / d_rmass[i];
+    else dtfmsq = dtfsq / d_mass[d_type[i]];
+    d_xshake(i,0) = d_x(i,0) + dtv*d_v(i,0) + dtfmsq*d_f(i,0);
+    d_xshake(i,1) = d_x(i,1) + dtv*d_v(i,1) + dtfmsq*d_f(i,1);
+    d_xshake(i,2) = d_x(i,2) + dtv*d_v(i,2) + dtfmsq*d_f(i,2);
+  } else d_xshake(i,2) = d_xshake(i,1) = d_xshake(i,0) = 0.0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+template<int EVFLAG>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakePostForce<EVFLAG>,
+                                            const int &i, EV_FLOAT &ev) const
+{
+  const int m = d_list[i];
+  const int flag = d_shake_flag[m];
+  if (flag == 2) shake<EVFLAG>(i,ev);
+  else if (flag == 3) shake3<EVFLAG>(i,ev);
+  else if (flag == 4) shake4<EVFLAG>(i,ev);
+  else shake3angle<EVFLAG>(i,ev);
+}
+
+template<class DeviceType>
+template<int EVFLAG>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakePostForce<EVFLAG>,
+                                            const int &i) const
+{
+  EV_FLOAT ev;
+  this->template operator()<EVFLAG>(TagFixShakePostForce<EVFLAG>(),i,ev);
+}
+
+/* ----------------------------------------------------------------------
+   SHAKE of cluster i of the list, same math as FixShake::shake() etc
+   atoms are found via d_closest instead of atom->map()
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+template<int EVFLAG>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::shake(int i, EV_FLOAT &ev) const
+{
+  int nvlist,vlist[2];
+  double v[6];
+  double invmass0,invmass1;
+
+  // local atom IDs and constraint distances
+
+  const int m = d_list[i];
+  const int i0 = d_closest(i,0);
+  const int i1 = d_closest(i,1);
+  const double bond1 = d_bond_distance[d_shake_type(m,0)];
+
+  // r01 = distance vec between atoms, with PBC
+
+  double r01[3];
+  r01[0] = d_x(i0,0) - d_x(i1,0);
+  r01[1] = d_x(i0,1) - d_x(i1,1);
+  r01[2] = d_x(i0,2) - d_x(i1,2);
+  minimum_image(r01);
+
+  // s01 = distance vec after unconstrained update, with PBC
+
+  double s01[3];
+  s01[0] = d_xshake(i0,0) - d_xshake(i1,0);
+  s01[1] = d_xshake(i0,1) - d_xshake(i1,1);
+  s01[2] = d_xshake(i0,2) - d_xshake(i1,2);
+  minimum_image_once(s01);
+
+  // scalar distances between atoms
+
+  const double r01sq = r01[0]*r01[0] + r01[1]*r01[1] + r01[2]*r01[2];
+  const double s01sq = s01[0]*s01[0] + s01[1]*s01[1] + s01[2]*s01[2];
+
+  // a,b,c = coeffs in quadratic equation for lamda
+
+  if (rmass_flag) {
+    invmass0 = 1.0/d_rmass[i0];
+    invmass1 = 1.0/d_rmass[i1];
+  } else {
+    invmass0 = 1.0/d_mass[d_type[i0]];
+    invmass1 = 1.0/d_mass[d_type[i1]];
+  }
+
+  const double a = (invmass0+invmass1)*(invmass0+invmass1) * r01sq;
+  const double b = 2.0 * (invmass0+invmass1) *
+    (s01[0]*r01[0] + s01[1]*r01[1] + s01[2]*r01[2]);
+  const double c = s01sq - bond1*bond1;
+
+  // error check
+
+  double determ = b*b - 4.0*a*c;
+  if (determ < 0.0) {
+    d_error_flag[0] = 1;
+    determ = 0.0;
+  }
+
+  // exact quadratic solution for lamda
+
+  double lamda,lamda1,lamda2;
+  lamda1 = (-b+sqrt(determ)) / (2.0*a);
+  lamda2 = (-b-sqrt(determ)) / (2.0*a);
+
+  if (fabs(lamda1) <= fabs(lamda2)) lamda = lamda1;
+  else lamda = lamda2;
+
+  // update forces if atom is owned by this processor
+
+  lamda /= dtfsq;
+
+  if (i0 < nlocal_kk) {
+    d_f(i0,0) += lamda*r01[0];
+    d_f(i0,1) += lamda*r01[1];
+    d_f(i0,2) += lamda*r01[2];
+  }
+
+  if (i1 < nlocal_kk) {
+    d_f(i1,0) -= lamda*r01[0];
+    d_f(i1,1) -= lamda*r01[1];
+    d_f(i1,2) -= lamda*r01[2];
+  }
+
+  if (EVFLAG) {
+    nvlist = 0;
+    if (i0 < nlocal_kk) vlist[nvlist++] = i0;
+    if (i1 < nlocal_kk) vlist[nvlist++] = i1;
+
+    v[0] = lamda*r01[0]*r01[0];
+    v[1] = lamda*r01[1]*r01[1];
+    v[2] = lamda*r01[2]*r01[2];
+    v[3] = lamda*r01[0]*r01[1];
+    v[4] = lamda*r01[0]*r01[2];
+    v[5] = lamda*r01[1]*r01[2];
+
+    v_tally(ev,nvlist,vlist,2.0,v);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+template<int EVFLAG>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::shake3(int i, EV_FLOAT &ev) const
+{
+  int nvlist,vlist[3];
+  double v[6];
+  double invmass0,invmass1,invmass2;
+
+  // local atom IDs and constraint distances
+
+  const int m = d_list[i];
+  const int i0 = d_closest(i,0);
+  const int i1 = d_closest(i,1);
+  const int i2 = d_closest(i,2);
+  const double bond1 = d_bond_distance[d_shake_type(m,0)];
+  const double bond2 = d_bond_distance[d_shake_type(m,1)];
+
+  // r01,r02 = distance vec between atoms, with PBC
+
+  double r01[3];
+  r01[0] = d_x(i0,0) - d_x(i1,0);
+  r01[1] = d_x(i0,1) - d_x(i1,1);
+  r01[2] = d_x(i0,2) - d_x(i1,2);
+  minimum_image(r01);
+
+  double r02[3];
+  r02[0] = d_x(i0,0) - d_x(i2,0);
+  r02[1] = d_x(i0,1) - d_x(i2,1);
+  r02[2] = d_x(i0,2) - d_x(i2,2);
+  minimum_image(r02);
+
+  // s01,s02 = distance vec after unconstrained update, with PBC
+
+  double s01[3];
+  s01[0] = d_xshake(i0,0) - d_xshake(i1,0);
+  s01[1] = d_xshake(i0,1) - d_xshake(i1,1);
+  s01[2] = d_xshake(i0,2) - d_xshake(i1,2);
+  minimum_image_once(s01);
+
+  double s02[3];
+  s02[0] = d_xshake(i0,0) - d_xshake(i2,0);
+  s02[1] = d_xshake(i0,1) - d_xshake(i2,1);
+  s02[2] = d_xshake(i0,2) - d_xshake(i2,2);
+  minimum_image_once(s02);
+
+  // scalar distances between atoms
+
+  const double r01sq = r01[0]*r01[0] + r01[1]*r01[1] + r01[2]*r01[2];
+  const double r02sq = r02[0]*r02[0] + r02[1]*r02[1] + r02[2]*r02[2];
+  const double s01sq = s01[0]*s01[0] + s01[1]*s01[1] + s01[2]*s01[2];
+  const double s02sq = s02[0]*s02[0] + s02[1]*s02[1] + s02[2]*s02[2];
+
+  // matrix coeffs and rhs for lamda equations
+
+  if (rmass_flag) {
+    invmass0 = 1.0/d_rmass[i0];
+    invmass1 = 1.0/d_rmass[i1];
+    invmass2 = 1.0/d_rmass[i2];
+  } else {
+    invmass0 = 1.0/d_mass[d_type[i0]];
+    invmass1 = 1.0/d_mass[d_type[i1]];
+    invmass2 = 1.0/d_mass[d_type[i2]];
+  }
+
+  const double a11 = 2.0 * (invmass0+invmass1) *
+    (s01[0]*r01[0] + s01[1]*r01[1] + s01[2]*r01[2]);
+  const double a12 = 2.0 * invmass0 *
+    (s01[0]*r02[0] + s01[1]*r02[1] + s01[2]*r02[2]);
+  const double a21 = 2.0 * invmass0 *
+    (s02[0]*r01[0] + s02[1]*r01[1] + s02[2]*r01[2]);
+  const double a22 = 2.0 * (invmass0+invmass2) *
+    (s02[0]*r02[0] + s02[1]*r02[1] + s02[2]*r02[2]);
+
+  // inverse of matrix
+
+  const double determ = a11*a22 - a12*a21;
+  if (determ == 0.0) {
+    d_error_flag[1] = 1;
+    return;
+  }
+  const double determinv = 1.0/determ;
+
+  const double a11inv = a22*determinv;
+  const double a12inv = -a12*determinv;
+  const double a21inv = -a21*determinv;
+  const double a22inv = a11*determinv;
+
+  // quadratic correction coeffs
+
+  const double r0102 = (r01[0]*r02[0] + r01[1]*r02[1] + r01[2]*r02[2]);
+
+  const double quad1_0101 = (invmass0+invmass1)*(invmass0+invmass1) * r01sq;
+  const double quad1_0202 = invmass0*invmass0 * r02sq;
+  const double quad1_0102 = 2.0 * (invmass0+invmass1)*invmass0 * r0102;
+
+  const double quad2_0202 = (invmass0+invmass2)*(invmass0+invmass2) * r02sq;
+  const double quad2_0101 = invmass0*invmass0 * r01sq;
+  const double quad2_0102 = 2.0 * (invmass0+invmass2)*invmass0 * r0102;
+
+  // iterate until converged
+
+  double lamda01 = 0.0;
+  double lamda02 = 0.0;
+  int niter = 0;
+  int done = 0;
+
+  double quad1,quad2,b1,b2,lamda01_new,lamda02_new;
+
+  while (!done && niter < max_iter) {
+    quad1 = quad1_0101 * lamda01*lamda01 + quad1_0202 * lamda02*lamda02 +
+      quad1_0102 * lamda01*lamda02;
+    quad2 = quad2_0101 * lamda01*lamda01 + quad2_0202 * lamda02*lamda02 +
+      quad2_0102 * lamda01*lamda02;
+
+    b1 = bond1*bond1 - s01sq - quad1;
+    b2 = bond2*bond2 - s02sq - quad2;
+
+    lamda01_new = a11inv*b1 + a12inv*b2;
+    lamda02_new = a21inv*b1 + a22inv*b2;
+
+    done = 1;
+    if (fabs(lamda01_new-lamda01) > tolerance) done = 0;
+    if (fabs(lamda02_new-lamda02) > tolerance) done = 0;
+
+    lamda01 = lamda01_new;
+    lamda02 = lamda02_new;
+
+    // stop iterations before we have a floating point overflow
+    // max double is < 1.0e308, so 1e150 is a reasonable cutoff
+
+    if (fabs(lamda01) > 1e150 || fabs(lamda02) > 1e150) done = 1;
+
+    niter++;
+  }
+
+  // update forces if atom is owned by this processor
+
+  lamda01 = lamda01/dtfsq;
+  lamda02 = lamda02/dtfsq;
+
+  if (i0 < nlocal_kk) {
+    d_f(i0,0) += lamda01*r01[0] + lamda02*r02[0];
+    d_f(i0,1) += lamda01*r01[1] + lamda02*r02[1];
+    d_f(i0,2) += lamda01*r01[2] + lamda02*r02[2];
+  }
+
+  if (i1 < nlocal_kk) {
+    d_f(i1,0) -= lamda01*r01[0];
+    d_f(i1,1) -= lamda01*r01[1];
+    d_f(i1,2) -= lamda01*r01[2];
+  }
+
+  if (i2 < nlocal_kk) {
+    d_f(i2,0) -= lamda02*r02[0];
+    d_f(i2,1) -= lamda02*r02[1];
+    d_f(i2,2) -= lamda02*r02[2];
+  }
+
+  if (EVFLAG) {
+    nvlist = 0;
+    if (i0 < nlocal_kk) vlist[nvlist++] = i0;
+    if (i1 < nlocal_kk) vlist[nvlist++] = i1;
+    if (i2 < nlocal_kk) vlist[nvlist++] = i2;
+
+    v[0] = lamda01*r01[0]*r01[0] + lamda02*r02[0]*r02[0];
+    v[1] = lamda01*r01[1]*r01[1] + lamda02*r02[1]*r02[1];
+    v[2] = lamda01*r01[2]*r01[2] + lamda02*r02[2]*r02[2];
+    v[3] = lamda01*r01[0]*r01[1] + lamda02*r02[0]*r02[1];
+    v[4] = lamda01*r01[0]*r01[2] + lamda02*r02[0]*r02[2];
+    v[5] = lamda01*r01[1]*r01[2] + lamda02*r02[1]*r02[2];
+
+    v_tally(ev,nvlist,vlist,3.0,v);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+template<int EVFLAG>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::shake4(int i, EV_FLOAT &ev) const
+{
+  int nvlist,vlist[4];
+  double v[6];
+  double invmass0,invmass1,invmass2,invmass3;
+
+  // local atom IDs and constraint distances
+
+  const int m = d_list[i];
+  const int i0 = d_closest(i,0);
+  const int i1 = d_closest(i,1);
+  const int i2 = d_closest(i,2);
+  const int i3 = d_closest(i,3);
+  const double bond1 = d_bond_distance[d_shake_type(m,0)];
+  const double bond2 = d_bond_distance[d_shake_type(m,1)];
+  const double bond3 = d_bond_distance[d_shake_type(m,2)];
+
+  // r01,r02,r03 = distance vec between atoms, with PBC
+
+  double r01[3];
+  r01[0] = d_x(i0,0) - d_x(i1,0);
+  r01[1] = d_x(i0,1) - d_x(i1,1);
+  r01[2] = d_x(i0,2) - d_x(i1,2);
+  minimum_image(r01);
+
+  double r02[3];
+  r02[0] = d_x(i0,0) - d_x(i2,0);
+  r02[1] = d_x(i0,1) - d_x(i2,1);
+  r02[2] = d_x(i0,2) - d_x(i2,2);
+  minimum_image(r02);
+
+  double r03[3];
+  r03[0] = d_x(i0,0) - d_x(i3,0);
+  r03[1] = d_x(i0,1) - d_x(i3,1);
+  r03[2] = d_x(i0,2) - d_x(i3,2);
+  minimum_image(r03);
+
+  // s01,s02,s03 = distance vec after unconstrained update, with PBC
+
+  double s01[3];
+  s01[0] = d_xshake(i0,0) - d_xshake(i1,0);
+  s01[1] = d_xshake(i0,1) - d_xshake(i1,1);
+  s01[2] = d_xshake(i0,2) - d_xshake(i1,2);
+  minimum_image_once(s01);
+
+  double s02[3];
+  s02[0] = d_xshake(i0,0) - d_xshake(i2,0);
+  s02[1] = d_xshake(i0,1) - d_xshake(i2,1);
+  s02[2] = d_xshake(i0,2) - d_xshake(i2,2);
+  minimum_image_once(s02);
+
+  double s03[3];
+  s03[0] = d_xshake(i0,0) - d_xshake(i3,0);
+  s03[1] = d_xshake(i0,1) - d_xshake(i3,1);
+  s03[2] = d_xshake(i0,2) - d_xshake(i3,2);
+  minimum_image_once(s03);
+
+  // scalar distances between atoms
+
+  const double r01sq = r01[0]*r01[0] + r01[1]*r01[1] + r01[2]*r01[2];
+  const double r02sq = r02[0]*r02[0] + r02[1]*r02[1] + r02[2]*r02[2];
+  const double r03sq = r03[0]*r03[0] + r03[1]*r03[1] + r03[2]*r03[2];
+  const double s01sq = s01[0]*s01[0] + s01[1]*s01[1] + s01[2]*s01[2];
+  const double s02sq = s02[0]*s02[0] + s02[1]*s02[1] + s02[2]*s02[2];
+  const double s03sq = s03[0]*s03[0] + s03[1]*s03[1] + s03[2]*s03[2];
+
+  // matrix coeffs and rhs for lamda equations
+
+  if (rmass_flag) {
+    invmass0 = 1.0/d_rmass[i0];
+    invmass1 = 1.0/d_rmass[i1];
+    invmass2 = 1.0/d_rmass[i2];
+    invmass3 = 1.0/d_rmass[i3];
+  } else {
+    invmass0 = 1.0/d_mass[d_type[i0]];
+    invmass1 = 1.0/d_mass[d_type[i1]];
+    invmass2 = 1.0/d_mass[d_type[i2]];
+    invmass3 = 1.0/d_mass[d_type[i3]];
+  }
+
+  const double a11 = 2.0 * (invmass0+invmass1) *
+    (s01[0]*r01[0] + s01[1]*r01[1] + s01[2]*r01[2]);
+  const double a12 = 2.0 * invmass0 *
+    (s01[0]*r02[0] + s01[1]*r02[1] + s01[2]*r02[2]);
+  const double a13 = 2.0 * invmass0 *
+    (s01[0]*r03[0] + s01[1]*r03[1] + s01[2]*r03[2]);
+  const double a21 = 2.0 * invmass0 *
+    (s02[0]*r01[0] + s02[1]*r01[1] + s02[2]*r01[2]);
+  const double a22 = 2.0 * (invmass0+invmass2) *
+    (s02[0]*r02[0] + s02[1]*r02[1] + s02[2]*r02[2]);
+  const double a23 = 2.0 * invmass0 *
+    (s02[0]*r03[0] + s02[1]*r03[1] + s02[2]*r03[2]);
+  const double a31 = 2.0 * invmass0 *
+    (s03[0]*r01[0] + s03[1]*r01[1] + s03[2]*r01[2]);
+  const double a32 = 2.0 * invmass0 *
+    (s03[0]*r02[0] + s03[1]*r02[1] + s03[2]*r02[2]);
+  const double a33 = 2.0 * (invmass0+invmass3) *
+    (s03[0]*r03[0] + s03[1]*r03[1] + s03[2]*r03[2]);
+
+  // inverse of matrix;
+
+  const double determ = a11*a22*a33 + a12*a23*a31 + a13*a21*a32 -
+    a11*a23*a32 - a12*a21*a33 - a13*a22*a31;
+  if (determ == 0.0) {
+    d_error_flag[1] = 1;
+    return;
+  }
+  const double determinv = 1.0/determ;
+
+  const double a11inv = determinv * (a22*a33 - a23*a32);
+  const double a12inv = -determinv * (a12*a33 - a13*a32);
+  const double a13inv = determinv * (a12*a23 - a13*a22);
+  const double a21inv = -determinv * (a21*a33 - a23*a31);
+  const double a22inv = determinv * (a11*a33 - a13*a31);
+  const double a23inv = -determinv * (a11*a23 - a13*a21);
+  const double a31inv = determinv * (a21*a32 - a22*a31);
+  const double a32inv = -determinv * (a11*a32 - a12*a31);
+  const double a33inv = determinv * (a11*a22 - a12*a21);
+
+  // quadratic correction coeffs
+
+  const double r0102 = (r01[0]*r02[0] + r01[1]*r02[1] + r01[2]*r02[2]);
+  const double r0103 = (r01[0]*r03[0] + r01[1]*r03[1] + r01[2]*r03[2]);
+  const double r0203 = (r02[0]*r03[0] + r02[1]*r03[1] + r02[2]*r03[2]);
+
+  const double quad1_0101 = (invmass0+invmass1)*(invmass0+invmass1) * r01sq;
+  const double quad1_0202 = invmass0*invmass0 * r02sq;
+  const double quad1_0303 = invmass0*invmass0 * r03sq;
+  const double quad1_0102 = 2.0 * (invmass0+invmass1)*invmass0 * r0102;
+  const double quad1_0103 = 2.0 * (invmass0+invmass1)*invmass0 * r0103;
+  const double quad1_0203 = 2.0 * invmass0*invmass0 * r0203;
+
+  const double quad2_0101 = invmass0*invmass0 * r01sq;
+  const double quad2_0202 = (invmass0+invmass2)*(invmass0+invmass2) * r02sq;
+  const double quad2_0303 = invmass0*invmass0 * r03sq;
+  const double quad2_0102 = 2.0 * (invmass0+invmass2)*invmass0 * r0102;
+  const double quad2_0103 = 2.0 * invmass0*invmass0 * r0103;
+  const double quad2_0203 = 2.0 * (invmass0+invmass2)*invmass0 * r0203;
+
+  const double quad3_0101 = invmass0*invmass0 * r01sq;
+  const double quad3_0202 = invmass0*invmass0 * r02sq;
+  const double quad3_0303 = (invmass0+invmass3)*(invmass0+invmass3) * r03sq;
+  const double quad3_0102 = 2.0 * invmass0*invmass0 * r0102;
+  const double quad3_0103 = 2.0 * (invmass0+invmass3)*invmass0 * r0103;
+  const double quad3_0203 = 2.0 * (invmass0+invmass3)*invmass0 * r0203;
+
+  // iterate until converged
+
+  double lamda01 = 0.0;
+  double lamda02 = 0.0;
+  double lamda03 = 0.0;
+  int niter = 0;
+  int done = 0;
+
+  double quad1,quad2,quad3,b1,b2,b3,lamda01_new,lamda02_new,lamda03_new;
+
+  while (!done && niter < max_iter) {
+    quad1 = quad1_0101 * lamda01*lamda01 +
+      quad1_0202 * lamda02*lamda02 +
+      quad1_0303 * lamda03*lamda03 +
+      quad1_0102 * lamda01*lamda02 +
+      quad1_0103 * lamda01*lamda03 +
+      quad1_0203 * lamda02*lamda03;
+
+    quad2 = quad2_0101 * lamda01*lamda01 +
+      quad2_0202 * lamda02*lamda02 +
+      quad2_0303 * lamda03*lamda03 +
+      quad2_0102 * lamda01*lamda02 +
+      quad2_0103 * lamda01*lamda03 +
+      quad2_0203 * lamda02*lamda03;
+
+    quad3 = quad3_0101 * lamda01*lamda01 +
+      quad3_0202 * lamda02*lamda02 +
+      quad3_0303 * lamda03*lamda03 +
+      quad3_0102 * lamda01*lamda02 +
+      quad3_0103 * lamda01*lamda03 +
+      quad3_0203 * lamda02*lamda03;
+
+    b1 = bond1*bond1 - s01sq - quad1;
+    b2 = bond2*bond2 - s02sq - quad2;
+    b3 = bond3*bond3 - s03sq - quad3;
+
+    lamda01_new = a11inv*b1 + a12inv*b2 + a13inv*b3;
+    lamda02_new = a21inv*b1 + a22inv*b2 + a23inv*b3;
+    lamda03_new = a31inv*b1 + a32inv*b2 + a33inv*b3;
+
+    done = 1;
+    if (fabs(lamda01_new-lamda01) > tolerance) done = 0;
+    if (fabs(lamda02_new-lamda02) > tolerance) done = 0;
+    if (fabs(lamda03_new-lamda03) > tolerance) done = 0;
+
+    lamda01 = lamda01_new;
+    lamda02 = lamda02_new;
+    lamda03 = lamda03_new;
+
+    // stop iterations before we have a floating point overflow
+    // max double is < 1.0e308, so 1e150 is a reasonable cutoff
+
+    if (fabs(lamda01) > 1e150 || fabs(lamda02) > 1e150
+        || fabs(lamda03) > 1e150) done = 1;
+
+    niter++;
+  }
+
+  // update forces if atom is owned by this processor
+
+  lamda01 = lamda01/dtfsq;
+  lamda02 = lamda02/dtfsq;
+  lamda03 = lamda03/dtfsq;
+
+  if (i0 < nlocal_kk) {
+    d_f(i0,0) += lamda01*r01[0] + lamda02*r02[0] + lamda03*r03[0];
+    d_f(i0,1) += lamda01*r01[1] + lamda02*r02[1] + lamda03*r03[1];
+    d_f(i0,2) += lamda01*r01[2] + lamda02*r02[2] + lamda03*r03[2];
+  }
+
+  if (i1 < nlocal_kk) {
+    d_f(i1,0) -= lamda01*r01[0];
+    d_f(i1,1) -= lamda01*r01[1];
+    d_f(i1,2) -= lamda01*r01[2];
+  }
+
+  if (i2 < nlocal_kk) {
+    d_f(i2,0) -= lamda02*r02[0];
+    d_f(i2,1) -= lamda02*r02[1];
+    d_f(i2,2) -= lamda02*r02[2];
+  }
+
+  if (i3 < nlocal_kk) {
+    d_f(i3,0) -= lamda03*r03[0];
+    d_f(i3,1) -= lamda03*r03[1];
+    d_f(i3,2) -= lamda03*r03[2];
+  }
+
+  if (EVFLAG) {
+    nvlist = 0;
+    if (i0 < nlocal_kk) vlist[nvlist++] = i0;
+    if (i1 < nlocal_kk) vlist[nvlist++] = i1;
+    if (i2 < nlocal_kk) vlist[nvlist++] = i2;
+    if (i3 < nlocal_kk) vlist[nvlist++] = i3;
+
+    v[0] = lamda01*r01[0]*r01[0]+lamda02*r02[0]*r02[0]+lamda03*r03[0]*r03[0];
+    v[1] = lamda01*r01[1]*r01[1]+lamda02*r02[1]*r02[1]+lamda03*r03[1]*r03[1];
+    v[2] = lamda01*r01[2]*r01[2]+lamda02*r02[2]*r02[2]+lamda03*r03[2]*r03[2];
+    v[3] = lamda01*r01[0]*r01[1]+lamda02*r02[0]*r02[1]+lamda03*r03[0]*r03[1];
+    v[4] = lamda01*r01[0]*r01[2]+lamda02*r02[0]*r02[2]+lamda03*r03[0]*r03[2];
+    v[5] = lamda01*r01[1]*r01[2]+lamda02*r02[1]*r02[2]+lamda03*r03[1]*r03[2];
+
+    v_tally(ev,nvlist,vlist,4.0,v);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+template<int EVFLAG>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::shake3angle(int i, EV_FLOAT &ev) const
+{
+  int nvlist,vlist[3];
+  double v[6];
+  double invmass0,invmass1,invmass2;
+
+  // local atom IDs and constraint distances
+
+  const int m = d_list[i];
+  const int i0 = d_closest(i,0);
+  const int i1 = d_closest(i,1);
+  const int i2 = d_closest(i,2);
+  const double bond1 = d_bond_distance[d_shake_type(m,0)];
+  const double bond2 = d_bond_distance[d_shake_type(m,1)];
+  const double bond12 = d_angle_distance[d_shake_type(m,2)];
+
+  // r01,r02,r12 = distance vec between atoms, with PBC
+
+  double r01[3];
+  r01[0] = d_x(i0,0) - d_x(i1,0);
+  r01[1] = d_x(i0,1) - d_x(i1,1);
+  r01[2] = d_x(i0,2) - d_x(i1,2);
+  minimum_image(r01);
+
+  double r02[3];
+  r02[0] = d_x(i0,0) - d_x(i2,0);
+  r02[1] = d_x(i0,1) - d_x(i2,1);
+  r02[2] = d_x(i0,2) - d_x(i2,2);
+  minimum_image(r02);
+
+  double r12[3];
+  r12[0] = d_x(i1,0) - d_x(i2,0);
+  r12[1] = d_x(i1,1) - d_x(i2,1);
+  r12[2] = d_x(i1,2) - d_x(i2,2);
+  minimum_image(r12);
+
+  // s01,s02,s12 = distance vec after unconstrained update, with PBC
+
+  double s01[3];
+  s01[0] = d_xshake(i0,0) - d_xshake(i1,0);
+  s01[1] = d_xshake(i0,1) - d_xshake(i1,1);
+  s01[2] = d_xshake(i0,2) - d_xshake(i1,2);
+  minimum_image_once(s01);
+
+  double s02[3];
+  s02[0] = d_xshake(i0,0) - d_xshake(i2,0);
+  s02[1] = d_xshake(i0,1) - d_xshake(i2,1);
+  s02[2] = d_xshake(i0,2) - d_xshake(i2,2);
+  minimum_image_once(s02);
+
+  double s12[3];
+  s12[0] = d_xshake(i1,0) - d_xshake(i2,0);
+  s12[1] = d_xshake(i1,1) - d_xshake(i2,1);
+  s12[2] = d_xshake(i1,2) - d_xshake(i2,2);
+  minimum_image_once(s12);
+
+  // scalar distances between atoms
+
+  const double r01sq = r01[0]*r01[0] + r01[1]*r01[1] + r01[2]*r01[2];
+  const double r02sq = r02[0]*r02[0] + r02[1]*r02[1] + r02[2]*r02[2];
+  const double r12sq = r12[0]*r12[0] + r12[1]*r12[1] + r12[2]*r12[2];
+  const double s01sq = s01[0]*s01[0] + s01[1]*s01[1] + s01[2]*s01[2];
+  const double s02sq = s02[0]*s02[0] + s02[1]*s02[1] + s02[2]*s02[2];
+  const double s12sq = s12[0]*s12[0] + s12[1]*s12[1] + s12[2]*s12[2];
+
+  // matrix coeffs and rhs for lamda equations
+
+  if (rmass_flag) {
+    invmass0 = 1.0/d_rmass[i0];
+    invmass1 = 1.0/d_rmass[i1];
+    invmass2 = 1.0/d_rmass[i2];
+  } else {
+    invmass0 = 1.0/d_mass[d_type[i0]];
+    invmass1 = 1.0/d_mass[d_type[i1]];
+    invmass2 = 1.0/d_mass[d_type[i2]];
+  }
+
+  const double a11 = 2.0 * (invmass0+invmass1) *
+    (s01[0]*r01[0] + s01[1]*r01[1] + s01[2]*r01[2]);
+  const double a12 = 2.0 * invmass0 *
+    (s01[0]*r02[0] + s01[1]*r02[1] + s01[2]*r02[2]);
+  const double a13 = - 2.0 * invmass1 *
+    (s01[0]*r12[0] + s01[1]*r12[1] + s01[2]*r12[2]);
+  const double a21 = 2.0 * invmass0 *
+    (s02[0]*r01[0] + s02[1]*r01[1] + s02[2]*r01[2]);
+  const double a22 = 2.0 * (invmass0+invmass2) *
+    (s02[0]*r02[0] + s02[1]*r02[1] + s02[2]*r02[2]);
+  const double a23 = 2.0 * invmass2 *
+    (s02[0]*r12[0] + s02[1]*r12[1] + s02[2]*r12[2]);
+  const double a31 = - 2.0 * invmass1 *
+    (s12[0]*r01[0] + s12[1]*r01[1] + s12[2]*r01[2]);
+  const double a32 = 2.0 * invmass2 *
+    (s12[0]*r02[0] + s12[1]*r02[1] + s12[2]*r02[2]);
+  const double a33 = 2.0 * (invmass1+invmass2) *
+    (s12[0]*r12[0] + s12[1]*r12[1] + s12[2]*r12[2]);
+
+  // inverse of matrix
+
+  const double determ = a11*a22*a33 + a12*a23*a31 + a13*a21*a32 -
+    a11*a23*a32 - a12*a21*a33 - a13*a22*a31;
+  if (determ == 0.0) {
+    d_error_flag[1] = 1;
+    return;
+  }
+  const double determinv = 1.0/determ;
+
+  const double a11inv = determinv * (a22*a33 - a23*a32);
+  const double a12inv = -determinv * (a12*a33 - a13*a32);
+  const double a13inv = determinv * (a12*a23 - a13*a22);
+  const double a21inv = -determinv * (a21*a33 - a23*a31);
+  const double a22inv = determinv * (a11*a33 - a13*a31);
+  const double a23inv = -determinv * (a11*a23 - a13*a21);
+  const double a31inv = determinv * (a21*a32 - a22*a31);
+  const double a32inv = -determinv * (a11*a32 - a12*a31);
+  const double a33inv = determinv * (a11*a22 - a12*a21);
+
+  // quadratic correction coeffs
+
+  const double r0102 = (r01[0]*r02[0] + r01[1]*r02[1] + r01[2]*r02[2]);
+  const double r0112 = (r01[0]*r12[0] + r01[1]*r12[1] + r01[2]*r12[2]);
+  const double r0212 = (r02[0]*r12[0] + r02[1]*r12[1] + r02[2]*r12[2]);
+
+  const double quad1_0101 = (invmass0+invmass1)*(invmass0+invmass1) * r01sq;
+  const double quad1_0202 = invmass0*invmass0 * r02sq;
+  const double quad1_1212 = invmass1*invmass1 * r12sq;
+  const double quad1_0102 = 2.0 * (invmass0+invmass1)*invmass0 * r0102;
+  const double quad1_0112 = - 2.0 * (invmass0+invmass1)*invmass1 * r0112;
+  const double quad1_0212 = - 2.0 * invmass0*invmass1 * r0212;
+
+  const double quad2_0101 = invmass0*invmass0 * r01sq;
+  const double quad2_0202 = (invmass0+invmass2)*(invmass0+invmass2) * r02sq;
+  const double quad2_1212 = invmass2*invmass2 * r12sq;
+  const double quad2_0102 = 2.0 * (invmass0+invmass2)*invmass0 * r0102;
+  const double quad2_0112 = 2.0 * invmass0*invmass2 * r0112;
+  const double quad2_0212 = 2.0 * (invmass0+invmass2)*invmass2 * r0212;
+
+  const double quad3_0101 = invmass1*invmass1 * r01sq;
+  const double quad3_0202 = invmass2*invmass2 * r02sq;
+  const double quad3_1212 = (invmass1+invmass2)*(invmass1+invmass2) * r12sq;
+  const double quad3_0102 = - 2.0 * invmass1*invmass2 * r0102;
+  const double quad3_0112 = - 2.0 * (invmass1+invmass2)*invmass1 * r0112;
+  const double quad3_0212 = 2.0 * (invmass1+invmass2)*invmass2 * r0212;
+
+  // iterate until converged
+
+  double lamda01 = 0.0;
+  double lamda02 = 0.0;
+  double lamda12 = 0.0;
+  int niter = 0;
+  int done = 0;
+
+  double quad1,quad2,quad3,b1,b2,b3,lamda01_new,lamda02_new,lamda12_new;
+
+  while (!done && niter < max_iter) {
+
+    quad1 = quad1_0101 * lamda01*lamda01 +
+      quad1_0202 * lamda02*lamda02 +
+      quad1_1212 * lamda12*lamda12 +
+      quad1_0102 * lamda01*lamda02 +
+      quad1_0112 * lamda01*lamda12 +
+      quad1_0212 * lamda02*lamda12;
+
+    quad2 = quad2_0101 * lamda01*lamda01 +
+      quad2_0202 * lamda02*lamda02 +
+      quad2_1212 * lamda12*lamda12 +
+      quad2_0102 * lamda01*lamda02 +
+      quad2_0112 * lamda01*lamda12 +
+      quad2_0212 * lamda02*lamda12;
+
+    quad3 = quad3_0101 * lamda01*lamda01 +
+      quad3_0202 * lamda02*lamda02 +
+      quad3_1212 * lamda12*lamda12 +
+      quad3_0102 * lamda01*lamda02 +
+      quad3_0112 * lamda01*lamda12 +
+      quad3_0212 * lamda02*lamda12;
+
+    b1 = bond1*bond1 - s01sq - quad1;
+    b2 = bond2*bond2 - s02sq - quad2;
+    b3 = bond12*bond12 - s12sq - quad3;
+
+    lamda01_new = a11inv*b1 + a12inv*b2 + a13inv*b3;
+    lamda02_new = a21inv*b1 + a22inv*b2 + a23inv*b3;
+    lamda12_new = a31inv*b1 + a32inv*b2 + a33inv*b3;
+
+    done = 1;
+    if (fabs(lamda01_new-lamda01) > tolerance) done = 0;
+    if (fabs(lamda02_new-lamda02) > tolerance) done = 0;
+    if (fabs(lamda12_new-lamda12) > tolerance) done = 0;
+
+    lamda01 = lamda01_new;
+    lamda02 = lamda02_new;
+    lamda12 = lamda12_new;
+
+    // stop iterations before we have a floating point overflow
+    // max double is < 1.0e308, so 1e150 is a reasonable cutoff
+
+    if (fabs(lamda01) > 1e150 || fabs(lamda02) > 1e150
+        || fabs(lamda12) > 1e150) done = 1;
+
+    niter++;
+  }
+
+  // update forces if atom is owned by this processor
+
+  lamda01 = lamda01/dtfsq;
+  lamda02 = lamda02/dtfsq;
+  lamda12 = lamda12/dtfsq;
+
+  if (i0 < nlocal_kk) {
+    d_f(i0,0) += lamda01*r01[0] + lamda02*r02[0];
+    d_f(i0,1) += lamda01*r01[1] + lamda02*r02[1];
+    d_f(i0,2) += lamda01*r01[2] + lamda02*r02[2];
+  }
+
+  if (i1 < nlocal_kk) {
+    d_f(i1,0) -= lamda01*r01[0] - lamda12*r12[0];
+    d_f(i1,1) -= lamda01*r01[1] - lamda12*r12[1];
+    d_f(i1,2) -= lamda01*r01[2] - lamda12*r12[2];
+  }
+
+  if (i2 < nlocal_kk) {
+    d_f(i2,0) -= lamda02*r02[0] + lamda12*r12[0];
+    d_f(i2,1) -= lamda02*r02[1] + lamda12*r12[1];
+    d_f(i2,2) -= lamda02*r02[2] + lamda12*r12[2];
+  }
+
+  if (EVFLAG) {
+    nvlist = 0;
+    if (i0 < nlocal_kk) vlist[nvlist++] = i0;
+    if (i1 < nlocal_kk) vlist[nvlist++] = i1;
+    if (i2 < nlocal_kk) vlist[nvlist++] = i2;
+
+    v[0] = lamda01*r01[0]*r01[0]+lamda02*r02[0]*r02[0]+lamda12*r12[0]*r12[0];
+    v[1] = lamda01*r01[1]*r01[1]+lamda02*r02[1]*r02[1]+lamda12*r12[1]*r12[1];
+    v[2] = lamda01*r01[2]*r01[2]+lamda02*r02[2]*r02[2]+lamda12*r12[2]*r12[2];
+    v[3] = lamda01*r01[0]*r01[1]+lamda02*r02[0]*r02[1]+lamda12*r12[0]*r12[1];
+    v[4] = lamda01*r01[0]*r01[2]+lamda02*r02[0]*r02[2]+lamda12*r12[0]*r12[2];
+    v[5] = lamda01*r01[1]*r01[2]+lamda02*r02[1]*r02[2]+lamda12*r12[1]*r12[2];
+
+    v_tally(ev,nvlist,vlist,3.0,v);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   tally virial into global and per-atom accumulators, see Fix::v_tally()
+   clusters are spread over threads, so per-atom sums are atomic
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::v_tally(EV_FLOAT &ev, int n, int *vlist,
+                                         double total, double *v) const
+{
+  if (vflag_global) {
+    const double fraction = n/total;
+    ev.v[0] += fraction*v[0];
+    ev.v[1] += fraction*v[1];
+    ev.v[2] += fraction*v[2];
+    ev.v[3] += fraction*v[3];
+    ev.v[4] += fraction*v[4];
+    ev.v[5] += fraction*v[5];
+  }
+
+  if (vflag_atom) {
+    const double fraction = 1.0/total;
+    for (int i = 0; i < n; i++) {
+      const int m = vlist[i];
+      Kokkos::atomic_add(&d_vatom(m,0),fraction*v[0]);
+      Kokkos::atomic_add(&d_vatom(m,1),fraction*v[1]);
+      Kokkos::atomic_add(&d_vatom(m,2),fraction*v[2]);
+      Kokkos::atomic_add(&d_vatom(m,3),fraction*v[3]);
+      Kokkos::atomic_add(&d_vatom(m,4),fraction*v[4]);
+      Kokkos::atomic_add(&d_vatom(m,5),fraction*v[5]);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   add coordinate constraining forces
+   this method is called at the end of a timestep
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::shake_end_of_step(int vflag)
+{
+  dtv     = update->dt;
+  dtfsq   = 0.5 * update->dt * update->dt * force->ftm2v;
+  FixShakeKokkos<DeviceType>::post_force(vflag);
+  if (!rattle) dtfsq = update->dt * update->dt * force->ftm2v;
+
+  // also called outside of ModifyKokkos, which would mark f otherwise
+
+  atomKK->modified(execution_space,F_MASK);
+}
+
+/* ----------------------------------------------------------------------
+   calculate constraining forces based on the current configuration
+   change coordinates, see FixShake::correct_coordinates()
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::correct_coordinates(int vflag)
+{
+  atomKK->sync(execution_space,datamask_read);
+  set_views();
+  int nlocal = atom->nlocal;
+
+  if ((int) d_ftmp.dimension_0() < nlocal) {
+    d_ftmp = typename AT::t_f_array("shake:ftmp",atom->nmax);
+    d_vtmp = typename AT::t_f_array("shake:vtmp",atom->nmax);
+  }
+
+  // save current forces and velocities and zero them,
+  //   so the unconstrained update of post_force() has no effect
+
+  copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixShakeSaveZeroVF>
+                       (0,nlocal),*this);
+  copymode = 0;
+
+  // call SHAKE to correct the coordinates which were updated without
+  //   constraints, with velocity Verlet timestep
+
+  atomKK->modified(execution_space,V_MASK | F_MASK);
+  dtfsq   = 0.5 * update->dt * update->dt * force->ftm2v;
+  FixShakeKokkos<DeviceType>::post_force(vflag);
+
+  // integrate coordinates: x' = xnp1 + dt^2/2m_i * f,
+  //   where f is the constraining force, then restore f,v
+
+  copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixShakeCorrectX>
+                       (0,nlocal),*this);
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixShakeRestoreVF>
+                       (0,nlocal),*this);
+  copymode = 0;
+
+  if (!rattle) dtfsq = update->dt * update->dt * force->ftm2v;
+
+  // communicate changes
+  // coordinates are sent as xshake, so the xshake comm can be used
+
+  if (nprocs > 1) {
+    int nghost = atom->nghost;
+    copymode = 1;
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixShakeCopyXLocal>
+                         (0,nlocal),*this);
+    copymode = 0;
+
+    k_xshake.template modify<DeviceType>();
+    comm->forward_comm_fix(this);
+    k_xshake.template sync<DeviceType>();
+
+    first = nlocal;
+    copymode = 1;
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagFixShakeCopyXGhost>
+                         (0,nghost),*this);
+    copymode = 0;
+  }
+
+  atomKK->modified(execution_space,X_MASK | V_MASK | F_MASK);
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakeSaveZeroVF,
+                                            const int &i) const
+{
+  for (int k = 0; k < 3; k++) {
+    d_ftmp(i,k) = d_f(i,k);
+    d_vtmp(i,k) = d_v(i,k);
+    d_v(i,k) = 0.0;
+    d_f(i,k) = 0.0;
+  }
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakeCorrectX,
+                                            const int &i) const
+{
+  double dtfmsq;
+  if (rmass_flag) dtfmsq = dtfsq / d_rmass[i];
+  else dtfmsq = dtfsq / d_mass[d_type[i]];
+  d_x(i,0) = d_x(i,0) + dtfmsq*d_f(i,0);
+  d_x(i,1) = d_x(i,1) + dtfmsq*d_f(i,1);
+  d_x(i,2) = d_x(i,2) + dtfmsq*d_f(i,2);
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakeRestoreVF,
+                                            const int &i) const
+{
+  for (int k = 0; k < 3; k++) {
+    d_f(i,k) = d_ftmp(i,k);
+    d_v(i,k) = d_vtmp(i,k);
+  }
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakeCopyXLocal,
+                                            const int &i) const
+{
+  d_xshake(i,0) = d_x(i,0);
+  d_xshake(i,1) = d_x(i,1);
+  d_xshake(i,2) = d_x(i,2);
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakeCopyXGhost,
+                                            const int &i) const
+{
+  const int j = first + i;
+  d_x(j,0) = d_xshake(j,0);
+  d_x(j,1) = d_xshake(j,1);
+  d_x(j,2) = d_xshake(j,2);
+}
+
+/* ----------------------------------------------------------------------
+   forward comm of xshake on the host, used by CommKokkos
+   when the fix runs on the host
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+int FixShakeKokkos<DeviceType>::pack_forward_comm(int n, int *list, double *buf,
+                                                  int pbc_flag, int *pbc)
+{
+  k_xshake.template sync<LMPHostType>();
+  return FixShake::pack_forward_comm(n,list,buf,pbc_flag,pbc);
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::unpack_forward_comm(int n, int first,
+                                                     double *buf)
+{
+  FixShake::unpack_forward_comm(n,first,buf);
+  k_xshake.template modify<LMPHostType>();
+}
+
+/* ----------------------------------------------------------------------
+   forward comm of xshake on the device
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+int FixShakeKokkos<DeviceType>::pack_forward_comm_kokkos(
+  int n, DAT::tdual_int_2d k_sendlist, int iswap_in,
+  DAT::tdual_xfloat_1d &buf, int pbc_flag_in, int *pbc)
+{
+  d_sendlist = k_sendlist.view<DeviceType>();
+  iswap = iswap_in;
+  d_buf = buf.view<DeviceType>();
+  pbc_flag = pbc_flag_in;
+  if (pbc_flag) {
+    if (domain->triclinic == 0) {
+      pbc_dx = pbc[0]*domain->xprd;
+      pbc_dy = pbc[1]*domain->yprd;
+      pbc_dz = pbc[2]*domain->zprd;
+    } else {
+      pbc_dx = pbc[0]*domain->xprd + pbc[5]*domain->xy + pbc[4]*domain->xz;
+      pbc_dy = pbc[1]*domain->yprd + pbc[3]*domain->yz;
+      pbc_dz = pbc[2]*domain->zprd;
+    }
+  } else pbc_dx = pbc_dy = pbc_dz = 0.0;
+
+  d_xshake = k_xshake.template view<DeviceType>();
+  copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,
+                       TagFixShakePackForwardComm>(0,n),*this);
+  copymode = 0;
+  return 3*n;
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakePackForwardComm,
+                                            const int &i) const
+{
+  const int j = d_sendlist(iswap,i);
+  d_buf[3*i] = d_xshake(j,0) + pbc_dx;
+  d_buf[3*i+1] = d_xshake(j,1) + pbc_dy;
+  d_buf[3*i+2] = d_xshake(j,2) + pbc_dz;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::unpack_forward_comm_kokkos(
+  int n, int first_in, DAT::tdual_xfloat_1d &buf)
+{
+  first = first_in;
+  d_buf = buf.view<DeviceType>();
+  d_xshake = k_xshake.template view<DeviceType>();
+  copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,
+                       TagFixShakeUnpackForwardComm>(0,n),*this);
+  copymode = 0;
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::operator()(TagFixShakeUnpackForwardComm,
+                                            const int &i) const
+{
+  d_xshake(first+i,0) = d_buf[3*i];
+  d_xshake(first+i,1) = d_buf[3*i+1];
+  d_xshake(first+i,2) = d_buf[3*i+2];
+}
+
+/* ----------------------------------------------------------------------
+   allocate local atom-based arrays
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void FixShakeKokkos<DeviceType>::grow_arrays(int nmax)
+{
+  memoryKK->grow_kokkos(k_shake_flag,shake_flag,nmax,"shake:shake_flag");
+  memory->grow(shake_atom,nmax,4,"shake:shake_atom");
+  memoryKK->grow_kokkos(k_shake_type,shake_type,nmax,3,"shake:shake_type");
+  memoryKK->destroy_kokkos(k_xshake,xshake);
+  memoryKK->create_kokkos(k_xshake,xshake,nmax,3,"shake:xshake");
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+double FixShakeKokkos<DeviceType>::memory_usage()
+{
+  double bytes = FixShake::memory_usage();
+  bytes += k_list.h_view.dimension_0() * 5 * sizeof(int);
+  bytes += d_ftmp.dimension_0() * 6 * sizeof(double);
+  return bytes;
+}
+
+namespace LAMMPS_NS {
+template class FixShakeKokkos<LMPDeviceType>;
+#ifdef KOKKOS_HAVE_CUDA
+template class FixShakeKokkos<LMPHostType>;
+#endif
+}
@@ -0,0 +1,341 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(shake/kk,FixShakeKokkos<LMPDeviceType>)
+FixStyle(shake/kk/device,FixShakeKokkos<LMPDeviceType>)
+FixStyle(shake/kk/host,FixShakeKokkos<LMPHostType>)
+
+#else
+
+#ifndef LMP_FIX_SHAKE_KOKKOS_H
+#define LMP_FIX_SHAKE_KOKKOS_H
+
+#include <math.h>
+#include "fix_shake.h"
+#include "kokkos_type.h"
+#include "kokkos_base.h"
+
+namespace LAMMPS_NS {
+
+struct TagFixShakeUnconstrained{};
+
+template<int EVFLAG>
+struct TagFixShakePostForce{};
+
+struct TagFixShakePackForwardComm{};
+struct TagFixShakeUnpackForwardComm{};
+struct TagFixShakeSaveZeroVF{};
+struct TagFixShakeCorrectX{};
+struct TagFixShakeRestoreVF{};
+struct TagFixShakeCopyXLocal{};
+struct TagFixShakeCopyXGhost{};
+
+template<class DeviceType>
+class FixShakeKokkos : public FixShake, public KokkosBase {
+ public:
+  typedef DeviceType device_type;
+  typedef ArrayTypes<DeviceType> AT;
+  typedef EV_FLOAT value_type;
+
+  FixShakeKokkos(class LAMMPS *, int, char **);
+  virtual ~FixShakeKokkos();
+  virtual void init();
+  virtual void setup(int);
+  virtual void pre_neighbor();
+  virtual void post_force(int);
+
+  virtual double memory_usage();
+  virtual void grow_arrays(int);
+
+  virtual int pack_forward_comm(int, int *, double *, int, int *);
+  virtual void unpack_forward_comm(int, int, double *);
+  int pack_forward_comm_kokkos(int, DAT::tdual_int_2d, int,
+                               DAT::tdual_xfloat_1d &, int, int *);
+  void unpack_forward_comm_kokkos(int, int, DAT::tdual_xfloat_1d &);
+
+  virtual void shake_end_of_step(int);
+  virtual void correct_coordinates(int);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakeUnconstrained, const int&) const;
+
+  template<int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakePostForce<EVFLAG>, const int&, EV_FLOAT &) const;
+
+  template<int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakePostForce<EVFLAG>, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakePackForwardComm, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakeUnpackForwardComm, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakeSaveZeroVF, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakeCorrectX, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakeRestoreVF, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakeCopyXLocal, const int&) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagFixShakeCopyXGhost, const int&) const;
+
+ protected:
+  typename AT::t_x_array d_x;
+  typename AT::t_v_array d_v;
+  typename AT::t_f_array d_f;
+  typename AT::t_float_1d d_rmass;
+  typename AT::t_float_1d_randomread d_mass;
+  typename AT::t_int_1d_randomread d_type;
+  int rmass_flag;
+
+  // per-atom arrays, host pointers of FixShake alias the host views
+  // shake_flag and shake_type are set on the host
+  //   and copied to the device at each reneighboring
+  // xshake is computed and communicated on the device
+
+  DAT::tdual_int_1d k_shake_flag;
+  DAT::tdual_int_2d k_shake_type;
+  DAT::tdual_double_2d k_xshake;
+  typename AT::t_int_1d d_shake_flag;
+  typename AT::t_int_2d d_shake_type;
+  typename AT::t_double_2d d_xshake;
+
+  // clusters I compute and the local indices of their atoms,
+  //   found with atom->map() once per reneighboring since the
+  //   map does not change between reneighborings
+
+  DAT::tdual_int_1d k_list;
+  DAT::tdual_int_2d k_closest;
+  typename AT::t_int_1d d_list;
+  typename AT::t_int_2d d_closest;
+
+  DAT::tdual_float_1d k_bond_distance,k_angle_distance;
+  typename AT::t_float_1d d_bond_distance,d_angle_distance;
+
+  DAT::tdual_virial_array k_vatom;
+  typename AT::t_virial_array d_vatom;
+
+  // flags set on the device when a cluster cannot be solved
+  // 0 = SHAKE determinant < 0.0, 1 = SHAKE determinant = 0.0,
+  //   derived classes may add more
+
+  DAT::tdual_int_1d k_error_flag;
+  typename AT::t_int_1d d_error_flag;
+
+  // saved v,f of correct_coordinates()
+
+  typename AT::t_f_array d_ftmp,d_vtmp;
+
+  // forward comm
+
+  int iswap,first,pbc_flag;
+  double pbc_dx,pbc_dy,pbc_dz;
+  typename AT::t_int_2d d_sendlist;
+  typename AT::t_xfloat_1d_um d_buf;
+
+  // box settings for minimum image convention on the device
+
+  int triclinic,xperiodic,yperiodic,zperiodic;
+  double xprd,yprd,zprd,xprd_half,yprd_half,zprd_half,xy,xz,yz;
+
+  int nlocal_kk;
+
+  void set_views();
+  void v_init_kokkos(int);
+  virtual void error_check();
+
+  KOKKOS_INLINE_FUNCTION
+  void minimum_image(double *) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void minimum_image_once(double *) const;
+
+  template<int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void shake(int, EV_FLOAT &) const;
+
+  template<int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void shake3(int, EV_FLOAT &) const;
+
+  template<int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void shake4(int, EV_FLOAT &) const;
+
+  template<int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void shake3angle(int, EV_FLOAT &) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void v_tally(EV_FLOAT &, int, int *, double, double *) const;
+};
+
+/* ----------------------------------------------------------------------
+   minimum image convention, see Domain::minimum_image()
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::minimum_image(double *delta) const
+{
+  if (triclinic == 0) {
+    if (xperiodic) {
+      while (fabs(delta[0]) > xprd_half) {
+        if (delta[0] < 0.0) delta[0] += xprd;
+        else delta[0] -= xprd;
+      }
+    }
+    if (yperiodic) {
+      while (fabs(delta[1]) > yprd_half) {
+        if (delta[1] < 0.0) delta[1] += yprd;
+        else delta[1] -= yprd;
+      }
+    }
+    if (zperiodic) {
+      while (fabs(delta[2]) > zprd_half) {
+        if (delta[2] < 0.0) delta[2] += zprd;
+        else delta[2] -= zprd;
+      }
+    }
+
+  } else {
+    if (zperiodic) {
+      while (fabs(delta[2]) > zprd_half) {
+        if (delta[2] < 0.0) {
+          delta[2] += zprd;
+          delta[1] += yz;
+          delta[0] += xz;
+        } else {
+          delta[2] -= zprd;
+          delta[1] -= yz;
+          delta[0] -= xz;
+        }
+      }
+    }
+    if (yperiodic) {
+      while (fabs(delta[1]) > yprd_half) {
+        if (delta[1] < 0.0) {
+          delta[1] += yprd;
+          delta[0] += xy;
+        } else {
+          delta[1] -= yprd;
+          delta[0] -= xy;
+        }
+      }
+    }
+    if (xperiodic) {
+      while (fabs(delta[0]) > xprd_half) {
+        if (delta[0] < 0.0) delta[0] += xprd;
+        else delta[0] -= xprd;
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   minimum image convention shifting by one box length at most,
+   see Domain::minimum_image_once()
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void FixShakeKokkos<DeviceType>::minimum_image_once(double *delta) const
+{
+  if (triclinic == 0) {
+    if (xperiodic) {
+      if (fabs(delta[0]) > xprd_half) {
+        if (delta[0] < 0.0) delta[0] += xprd;
+        else delta[0] -= xprd;
+      }
+    }
+    if (yperiodic) {
+      if (fabs(delta[1]) > yprd_half) {
+        if (delta[1] < 0.0) delta[1] += yprd;
+        else delta[1] -= yprd;
+      }
+    }
+    if (zperiodic) {
+      if (fabs(delta[2]) > zprd_half) {
+        if (delta[2] < 0.0) delta[2] += zprd;
+        else delta[2] -= zprd;
+      }
+    }
+
+  } else {
+    if (zperiodic) {
+      if (fabs(delta[2]) > zprd_half) {
+        if (delta[2] < 0.0) {
+          delta[2] += zprd;
+          delta[1] += yz;
+          delta[0] += xz;
+        } else {
+          delta[2] -= zprd;
+          delta[1] -= yz;
+          delta[0] -= xz;
+        }
+      }
+    }
+    if (yperiodic) {
+      if (fabs(delta[1]) > yprd_half) {
+        if (delta[1] < 0.0) {
+          delta[1] += yprd;
+          delta[0] += xy;
+        } else {
+          delta[1] -= yprd;
+          delta[0] -= xy;
+        }
+      }
+    }
+    if (xperiodic) {
+      if (fabs(delta[0]) > xprd_half) {
+        if (delta[0] < 0.0) delta[0] += xprd;
+        else delta[0] -= xprd;
+      }
+    }
+  }
+}
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Cannot (yet) use rRESPA with Kokkos fix shake
+
+Kokkos has no rRESPA integrator, use run_style verlet.
+
+E: Shake determinant = 0.0
+
+The determinant of the quadratic equation being solved for a single
+cluster specified by the fix shake command is numerically invalid.
+
+W: Shake determinant < 0.0
+
+The determinant of the quadratic equation being solved for a single
+cluster specified by the fix shake command is numerically suspect.  LAMMPS
+will set it to 0.0 and continue.
+
+*/
@@ -0,0 +1,1614 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include "meam_kokkos.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+MEAMKokkos<DeviceType>::MEAMKokkos(Memory *mem) : MEAM(mem)
+{
+  d_errorflag = typename AT::t_int_1d("meam:errorflag",1);
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+MEAMKokkos<DeviceType>::~MEAMKokkos()
+{
+  if (copymode) return;
+}
+
+/* ----------------------------------------------------------------------
+   copy atom type to element map and pair potential splines to the device
+   must be called after MEAM::meam_setup_done()
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void MEAMKokkos<DeviceType>::meam_setup_done_kokkos(int ntypes, int *map)
+{
+  DAT::tdual_int_1d k_map = DAT::tdual_int_1d("meam:map",ntypes+1);
+  for (int i = 1; i <= ntypes; i++) k_map.h_view(i) = map[i];
+  k_map.template modify<LMPHostType>();
+  k_map.template sync<DeviceType>();
+  d_map = k_map.template view<DeviceType>();
+
+  const int npair = (neltypes * (neltypes + 1)) / 2;
+  double **src[7] = {phirar,phirar1,phirar2,phirar3,phirar4,phirar5,phirar6};
+  typename AT::t_ffloat_2d *dst[7] = {&d_phirar,&d_phirar1,&d_phirar2,
+                                      &d_phirar3,&d_phirar4,&d_phirar5,
+                                      &d_phirar6};
+
+  for (int m = 0; m < 7; m++) {
+    DAT::tdual_ffloat_2d k_spline =
+      DAT::tdual_ffloat_2d("meam:phirar",npair,nrar);
+    for (int ind = 0; ind < npair; ind++)
+      for (int j = 0; j < nrar; j++)
+        k_spline.h_view(ind,j) = src[m][ind][j];
+    k_spline.template modify<LMPHostType>();
+    k_spline.template sync<DeviceType>();
+    *dst[m] = k_spline.template view<DeviceType>();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   grow per-atom and per-pair arrays if necessary and zero out the
+   densities that are summed over local and ghost atoms
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void MEAMKokkos<DeviceType>::meam_dens_setup(int atom_nmax, int nall,
+                                             int nrows, int maxneighs)
+{
+  if (atom_nmax > nmax) {
+    nmax = atom_nmax;
+
+    k_rho = DAT::tdual_ffloat_1d("meam:rho",nmax);
+    k_rho0 = DAT::tdual_ffloat_1d("meam:rho0",nmax);
+    k_rho1 = DAT::tdual_ffloat_1d("meam:rho1",nmax);
+    k_rho2 = DAT::tdual_ffloat_1d("meam:rho2",nmax);
+    k_rho3 = DAT::tdual_ffloat_1d("meam:rho3",nmax);
+    k_frhop = DAT::tdual_ffloat_1d("meam:frhop",nmax);
+    k_gamma = DAT::tdual_ffloat_1d("meam:gamma",nmax);
+    k_dgamma1 = DAT::tdual_ffloat_1d("meam:dgamma1",nmax);
+    k_dgamma2 = DAT::tdual_ffloat_1d("meam:dgamma2",nmax);
+    k_dgamma3 = DAT::tdual_ffloat_1d("meam:dgamma3",nmax);
+    k_arho2b = DAT::tdual_ffloat_1d("meam:arho2b",nmax);
+    k_arho1 = DAT::tdual_ffloat_2d("meam:arho1",nmax,3);
+    k_arho2 = DAT::tdual_ffloat_2d("meam:arho2",nmax,6);
+    k_arho3 = DAT::tdual_ffloat_2d("meam:arho3",nmax,10);
+    k_arho3b = DAT::tdual_ffloat_2d("meam:arho3b",nmax,3);
+    k_t_ave = DAT::tdual_ffloat_2d("meam:t_ave",nmax,3);
+    k_tsq_ave = DAT::tdual_ffloat_2d("meam:tsq_ave",nmax,3);
+
+    d_rho = k_rho.template view<DeviceType>();
+    d_rho0 = k_rho0.template view<DeviceType>();
+    d_rho1 = k_rho1.template view<DeviceType>();
+    d_rho2 = k_rho2.template view<DeviceType>();
+    d_rho3 = k_rho3.template view<DeviceType>();
+    d_frhop = k_frhop.template view<DeviceType>();
+    d_gamma = k_gamma.template view<DeviceType>();
+    d_dgamma1 = k_dgamma1.template view<DeviceType>();
+    d_dgamma2 = k_dgamma2.template view<DeviceType>();
+    d_dgamma3 = k_dgamma3.template view<DeviceType>();
+    d_arho2b = k_arho2b.template view<DeviceType>();
+    d_arho1 = k_arho1.template view<DeviceType>();
+    d_arho2 = k_arho2.template view<DeviceType>();
+    d_arho3 = k_arho3.template view<DeviceType>();
+    d_arho3b = k_arho3b.template view<DeviceType>();
+    d_t_ave = k_t_ave.template view<DeviceType>();
+    d_tsq_ave = k_tsq_ave.template view<DeviceType>();
+  }
+
+  if ((int) d_scrfcn.dimension_0() < nrows ||
+      (int) d_scrfcn.dimension_1() < maxneighs) {
+    d_scrfcn = typename AT::t_ffloat_2d("meam:scrfcn",nrows,maxneighs);
+    d_dscrfcn = typename AT::t_ffloat_2d("meam:dscrfcn",nrows,maxneighs);
+    d_fcpair = typename AT::t_ffloat_2d("meam:fcpair",nrows,maxneighs);
+  }
+
+  copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagMEAMZero>(0,nall),
+                       *this);
+  copymode = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::operator()(TagMEAMZero, const int &i) const
+{
+  d_rho0[i] = 0.0;
+  d_arho2b[i] = 0.0;
+  for (int m = 0; m < 3; m++) {
+    d_arho1(i,m) = 0.0;
+    d_arho3b(i,m) = 0.0;
+    d_t_ave(i,m) = 0.0;
+    d_tsq_ave(i,m) = 0.0;
+  }
+  for (int m = 0; m < 6; m++) d_arho2(i,m) = 0.0;
+  for (int m = 0; m < 10; m++) d_arho3(i,m) = 0.0;
+}
+
+/* ----------------------------------------------------------------------
+   screening functions and partial densities of all pairs
+   the per-pair values are indexed by (i,jn) of the half list
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void MEAMKokkos<DeviceType>::
+meam_dens_init(int inum, int neighflag,
+               typename AT::t_x_array_randomread x_in,
+               typename AT::t_int_1d_randomread type_in,
+               NeighListKokkos<DeviceType> *listhalf,
+               NeighListKokkos<DeviceType> *listfull)
+{
+  x = x_in;
+  type = type_in;
+  d_ilist_half = listhalf->d_ilist;
+  d_numneigh_half = listhalf->d_numneigh;
+  d_neighbors_half = listhalf->d_neighbors;
+  d_numneigh_full = listfull->d_numneigh;
+  d_neighbors_full = listfull->d_neighbors;
+
+  copymode = 1;
+  if (neighflag == HALF)
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,
+                         TagMEAMDensInit<HALF> >(0,inum),*this);
+  else
+    Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,
+                         TagMEAMDensInit<HALFTHREAD> >(0,inum),*this);
+  copymode = 0;
+}
+
+template<class DeviceType>
+template<int NEIGHFLAG>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::operator()(TagMEAMDensInit<NEIGHFLAG>,
+                                        const int &ii) const
+{
+  const int i = d_ilist_half[ii];
+  if (d_map[type[i]] < 0) return;
+
+  getscreen(i);
+  calc_rho1<NEIGHFLAG>(i);
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::getscreen(int i) const
+{
+  int jn,j,kn,k;
+  int eltj,eltk;
+  double delxij,delyij,delzij,rij2,rij;
+  double xjtmp,yjtmp,zjtmp,delxik,delyik,delzik,rik2;
+  double xktmp,yktmp,zktmp,delxjk,delyjk,delzjk,rjk2;
+  double xik,xjk,sij,fcij,sfcij,dfcij,sikj,dfikj,cikj;
+  double Cmin,Cmax,delc,rbound,a,coef1,coef2;
+  double dCikj,dscr;
+  double rnorm,fc,dfc;
+
+  const double drinv = 1.0 / delr_meam;
+  const int elti = d_map[type[i]];
+
+  const double xitmp = x(i,0);
+  const double yitmp = x(i,1);
+  const double zitmp = x(i,2);
+
+  const int numneigh = d_numneigh_half[i];
+  const int numneigh_full = d_numneigh_full[i];
+
+  for (jn = 0; jn < numneigh; jn++) {
+    j = d_neighbors_half(i,jn) & NEIGHMASK;
+
+    // pairs with unmapped atoms never contribute
+
+    eltj = d_map[type[j]];
+    if (eltj < 0) {
+      d_scrfcn(i,jn) = 0.0;
+      d_dscrfcn(i,jn) = 0.0;
+      d_fcpair(i,jn) = 0.0;
+      continue;
+    }
+
+    // first compute screening function itself, sij
+
+    xjtmp = x(j,0);
+    yjtmp = x(j,1);
+    zjtmp = x(j,2);
+    delxij = xjtmp - xitmp;
+    delyij = yjtmp - yitmp;
+    delzij = zjtmp - zitmp;
+    rij2 = delxij * delxij + delyij * delyij + delzij * delzij;
+    rij = sqrt(rij2);
+
+    if (rij > rc_meam) {
+      fcij = 0.0;
+      dfcij = 0.0;
+      sij = 0.0;
+    } else {
+      rnorm = (rc_meam - rij) * drinv;
+      sij = 1.0;
+
+      // if rjk2 > ebound*rijsq, atom k is definitely outside the ellipse
+
+      rbound = ebound_meam[elti][eltj] * rij2;
+      for (kn = 0; kn < numneigh_full; kn++) {
+        k = d_neighbors_full(i,kn) & NEIGHMASK;
+        eltk = d_map[type[k]];
+        if (eltk < 0) continue;
+        if (k == j) continue;
+
+        delxjk = x(k,0) - xjtmp;
+        delyjk = x(k,1) - yjtmp;
+        delzjk = x(k,2) - zjtmp;
+        rjk2 = delxjk * delxjk + delyjk * delyjk + delzjk * delzjk;
+        if (rjk2 > rbound) continue;
+
+        delxik = x(k,0) - xitmp;
+        delyik = x(k,1) - yitmp;
+        delzik = x(k,2) - zitmp;
+        rik2 = delxik * delxik + delyik * delyik + delzik * delzik;
+        if (rik2 > rbound) continue;
+
+        xik = rik2 / rij2;
+        xjk = rjk2 / rij2;
+        a = 1 - (xik - xjk) * (xik - xjk);
+
+        // if a < 0, then ellipse equation doesn't describe this case and
+        // atom k can't possibly screen i-j
+
+        if (a <= 0.0) continue;
+
+        cikj = (2.0 * (xik + xjk) + a - 2.0) / a;
+        Cmax = Cmax_meam[elti][eltj][eltk];
+        Cmin = Cmin_meam[elti][eltj][eltk];
+        if (cikj >= Cmax) continue;
+
+        // note that cikj may be slightly negative (within numerical
+        // tolerance) if atoms are colinear, so don't reject that case here
+        // (other negative cikj cases were handled by the test on "a" above)
+
+        else if (cikj <= Cmin) {
+          sij = 0.0;
+          break;
+        } else {
+          delc = Cmax - Cmin;
+          cikj = (cikj - Cmin) / delc;
+          sikj = fcut(cikj);
+        }
+        sij *= sikj;
+      }
+
+      fc = dfcut(rnorm,dfc);
+      fcij = fc;
+      dfcij = dfc * drinv;
+    }
+
+    // now compute derivatives
+
+    dscr = 0.0;
+    sfcij = sij * fcij;
+    if (!iszero(sfcij) && !iszero(sfcij - 1.0)) {
+      rbound = ebound_meam[elti][eltj] * rij2;
+      for (kn = 0; kn < numneigh_full; kn++) {
+        k = d_neighbors_full(i,kn) & NEIGHMASK;
+        if (k == j) continue;
+        eltk = d_map[type[k]];
+        if (eltk < 0) continue;
+
+        xktmp = x(k,0);
+        yktmp = x(k,1);
+        zktmp = x(k,2);
+        delxjk = xktmp - xjtmp;
+        delyjk = yktmp - yjtmp;
+        delzjk = zktmp - zjtmp;
+        rjk2 = delxjk * delxjk + delyjk * delyjk + delzjk * delzjk;
+        if (rjk2 > rbound) continue;
+
+        delxik = xktmp - xitmp;
+        delyik = yktmp - yitmp;
+        delzik = zktmp - zitmp;
+        rik2 = delxik * delxik + delyik * delyik + delzik * delzik;
+        if (rik2 > rbound) continue;
+
+        xik = rik2 / rij2;
+        xjk = rjk2 / rij2;
+        a = 1 - (xik - xjk) * (xik - xjk);
+        if (a <= 0.0) continue;
+
+        cikj = (2.0 * (xik + xjk) + a - 2.0) / a;
+        Cmax = Cmax_meam[elti][eltj][eltk];
+        Cmin = Cmin_meam[elti][eltj][eltk];
+
+        // note that we never have 0<cikj<Cmin here, else sij=0
+        //   (rejected above)
+
+        if (cikj >= Cmax) continue;
+
+        delc = Cmax - Cmin;
+        cikj = (cikj - Cmin) / delc;
+        sikj = dfcut(cikj,dfikj);
+        coef1 = dfikj / (delc * sikj);
+        dCikj = dCfunc(rij2,rik2,rjk2);
+        dscr += coef1 * dCikj;
+      }
+      coef1 = sfcij;
+      coef2 = sij * dfcij / rij;
+      dscr = dscr * coef1 - coef2;
+    }
+
+    d_dscrfcn(i,jn) = dscr;
+    d_scrfcn(i,jn) = sij;
+    d_fcpair(i,jn) = fcij;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   sum partial densities of i and its half list neighbors
+   the sums over neighbors of i are done locally, contributions to j
+   are atomic for the threaded half neighbor list
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+template<int NEIGHFLAG>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::calc_rho1(int i) const
+{
+  Kokkos::View<F_FLOAT*, typename DAT::t_ffloat_1d::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_rho0 = d_rho0;
+  Kokkos::View<F_FLOAT*, typename DAT::t_ffloat_1d::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_arho2b = d_arho2b;
+  Kokkos::View<F_FLOAT**, typename DAT::t_ffloat_2d::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_arho1 = d_arho1;
+  Kokkos::View<F_FLOAT**, typename DAT::t_ffloat_2d::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_arho2 = d_arho2;
+  Kokkos::View<F_FLOAT**, typename DAT::t_ffloat_2d::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_arho3 = d_arho3;
+  Kokkos::View<F_FLOAT**, typename DAT::t_ffloat_2d::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_arho3b = d_arho3b;
+  Kokkos::View<F_FLOAT**, typename DAT::t_ffloat_2d::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_t_ave = d_t_ave;
+  Kokkos::View<F_FLOAT**, typename DAT::t_ffloat_2d::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_tsq_ave = d_tsq_ave;
+
+  int jn,j,m,n,p,eltj;
+  int nv2,nv3;
+  double delij[3],rij2,rij,sij;
+  double ai,aj,rhoa0j,rhoa1j,rhoa2j,rhoa3j,A1j,A2j,A3j;
+  double ro0i,ro0j;
+  double rhoa0i,rhoa1i,rhoa2i,rhoa3i,A1i,A2i,A3i;
+
+  // sums for atom i
+
+  double rho0_i = 0.0;
+  double arho2b_i = 0.0;
+  double arho1_i[3] = {0.0,0.0,0.0};
+  double arho3b_i[3] = {0.0,0.0,0.0};
+  double t_ave_i[3] = {0.0,0.0,0.0};
+  double tsq_ave_i[3] = {0.0,0.0,0.0};
+  double arho2_i[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
+  double arho3_i[10] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
+
+  const int elti = d_map[type[i]];
+  const double xtmp = x(i,0);
+  const double ytmp = x(i,1);
+  const double ztmp = x(i,2);
+  const int numneigh = d_numneigh_half[i];
+
+  for (jn = 0; jn < numneigh; jn++) {
+    if (iszero(d_scrfcn(i,jn))) continue;
+
+    j = d_neighbors_half(i,jn) & NEIGHMASK;
+    sij = d_scrfcn(i,jn) * d_fcpair(i,jn);
+    delij[0] = x(j,0) - xtmp;
+    delij[1] = x(j,1) - ytmp;
+    delij[2] = x(j,2) - ztmp;
+    rij2 = delij[0] * delij[0] + delij[1] * delij[1] + delij[2] * delij[2];
+    if (rij2 >= cutforcesq) continue;
+
+    eltj = d_map[type[j]];
+    rij = sqrt(rij2);
+    ai = rij / re_meam[elti][elti] - 1.0;
+    aj = rij / re_meam[eltj][eltj] - 1.0;
+    ro0i = rho0_meam[elti];
+    ro0j = rho0_meam[eltj];
+    rhoa0j = ro0j * exp(-beta0_meam[eltj] * aj) * sij;
+    rhoa1j = ro0j * exp(-beta1_meam[eltj] * aj) * sij;
+    rhoa2j = ro0j * exp(-beta2_meam[eltj] * aj) * sij;
+    rhoa3j = ro0j * exp(-beta3_meam[eltj] * aj) * sij;
+    rhoa0i = ro0i * exp(-beta0_meam[elti] * ai) * sij;
+    rhoa1i = ro0i * exp(-beta1_meam[elti] * ai) * sij;
+    rhoa2i = ro0i * exp(-beta2_meam[elti] * ai) * sij;
+    rhoa3i = ro0i * exp(-beta3_meam[elti] * ai) * sij;
+    if (ialloy == 1) {
+      rhoa1j = rhoa1j * t1_meam[eltj];
+      rhoa2j = rhoa2j * t2_meam[eltj];
+      rhoa3j = rhoa3j * t3_meam[eltj];
+      rhoa1i = rhoa1i * t1_meam[elti];
+      rhoa2i = rhoa2i * t2_meam[elti];
+      rhoa3i = rhoa3i * t3_meam[elti];
+    }
+    rho0_i += rhoa0j;
+    a_rho0[j] += rhoa0i;
+
+    // for ialloy = 2, use single-element value (not average)
+
+    if (ialloy != 2) {
+      t_ave_i[0] += t1_meam[eltj] * rhoa0j;
+      t_ave_i[1] += t2_meam[eltj] * rhoa0j;
+      t_ave_i[2] += t3_meam[eltj] * rhoa0j;
+      a_t_ave(j,0) += t1_meam[elti] * rhoa0i;
+      a_t_ave(j,1) += t2_meam[elti] * rhoa0i;
+      a_t_ave(j,2) += t3_meam[elti] * rhoa0i;
+    }
+    if (ialloy == 1) {
+      tsq_ave_i[0] += t1_meam[eltj] * t1_meam[eltj] * rhoa0j;
+      tsq_ave_i[1] += t2_meam[eltj] * t2_meam[eltj] * rhoa0j;
+      tsq_ave_i[2] += t3_meam[eltj] * t3_meam[eltj] * rhoa0j;
+      a_tsq_ave(j,0) += t1_meam[elti] * t1_meam[elti] * rhoa0i;
+      a_tsq_ave(j,1) += t2_meam[elti] * t2_meam[elti] * rhoa0i;
+      a_tsq_ave(j,2) += t3_meam[elti] * t3_meam[elti] * rhoa0i;
+    }
+    arho2b_i += rhoa2j;
+    a_arho2b[j] += rhoa2i;
+
+    A1j = rhoa1j / rij;
+    A2j = rhoa2j / rij2;
+    A3j = rhoa3j / (rij2 * rij);
+    A1i = rhoa1i / rij;
+    A2i = rhoa2i / rij2;
+    A3i = rhoa3i / (rij2 * rij);
+    nv2 = 0;
+    nv3 = 0;
+    for (m = 0; m < 3; m++) {
+      arho1_i[m] += A1j * delij[m];
+      a_arho1(j,m) -= A1i * delij[m];
+      arho3b_i[m] += rhoa3j * delij[m] / rij;
+      a_arho3b(j,m) -= rhoa3i * delij[m] / rij;
+      for (n = m; n < 3; n++) {
+        arho2_i[nv2] += A2j * delij[m] * delij[n];
+        a_arho2(j,nv2) += A2i * delij[m] * delij[n];
+        nv2 = nv2 + 1;
+        for (p = n; p < 3; p++) {
+          arho3_i[nv3] += A3j * delij[m] * delij[n] * delij[p];
+          a_arho3(j,nv3) -= A3i * delij[m] * delij[n] * delij[p];
+          nv3 = nv3 + 1;
+        }
+      }
+    }
+  }
+
+  a_rho0[i] += rho0_i;
+  a_arho2b[i] += arho2b_i;
+  for (m = 0; m < 3; m++) {
+    a_arho1(i,m) += arho1_i[m];
+    a_arho3b(i,m) += arho3b_i[m];
+    a_t_ave(i,m) += t_ave_i[m];
+    a_tsq_ave(i,m) += tsq_ave_i[m];
+  }
+  for (m = 0; m < 6; m++) a_arho2(i,m) += arho2_i[m];
+  for (m = 0; m < 10; m++) a_arho3(i,m) += arho3_i[m];
+}
+
+/* ----------------------------------------------------------------------
+   move the reverse communicated densities between device and host
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void MEAMKokkos<DeviceType>::dens_to_host()
+{
+  k_rho0.template modify<DeviceType>();
+  k_rho0.template sync<LMPHostType>();
+  k_arho2b.template modify<DeviceType>();
+  k_arho2b.template sync<LMPHostType>();
+  k_arho1.template modify<DeviceType>();
+  k_arho1.template sync<LMPHostType>();
+  k_arho2.template modify<DeviceType>();
+  k_arho2.template sync<LMPHostType>();
+  k_arho3.template modify<DeviceType>();
+  k_arho3.template sync<LMPHostType>();
+  k_arho3b.template modify<DeviceType>();
+  k_arho3b.template sync<LMPHostType>();
+  k_t_ave.template modify<DeviceType>();
+  k_t_ave.template sync<LMPHostType>();
+  k_tsq_ave.template modify<DeviceType>();
+  k_tsq_ave.template sync<LMPHostType>();
+}
+
+template<class DeviceType>
+void MEAMKokkos<DeviceType>::dens_to_device()
+{
+  k_rho0.template modify<LMPHostType>();
+  k_rho0.template sync<DeviceType>();
+  k_arho2b.template modify<LMPHostType>();
+  k_arho2b.template sync<DeviceType>();
+  k_arho1.template modify<LMPHostType>();
+  k_arho1.template sync<DeviceType>();
+  k_arho2.template modify<LMPHostType>();
+  k_arho2.template sync<DeviceType>();
+  k_arho3.template modify<LMPHostType>();
+  k_arho3.template sync<DeviceType>();
+  k_arho3b.template modify<LMPHostType>();
+  k_arho3b.template sync<DeviceType>();
+  k_t_ave.template modify<LMPHostType>();
+  k_t_ave.template sync<DeviceType>();
+  k_tsq_ave.template modify<LMPHostType>();
+  k_tsq_ave.template sync<DeviceType>();
+}
+
+/* ----------------------------------------------------------------------
+   complete the densities and embedding energy of owned atoms
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void MEAMKokkos<DeviceType>::meam_dens_final(int nlocal, int eflag_either_in,
+                                             int eflag_global_in,
+                                             int eflag_atom_in,
+                                             double &eng_vdwl,
+                                             typename AT::t_efloat_1d eatom,
+                                             int &errorflag)
+{
+  eflag_either = eflag_either_in;
+  eflag_global = eflag_global_in;
+  eflag_atom = eflag_atom_in;
+  d_eatom = eatom;
+
+  Kokkos::deep_copy(d_errorflag,0);
+
+  EV_FLOAT ev;
+  copymode = 1;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<DeviceType,TagMEAMDensFinal>
+                          (0,nlocal),*this,ev);
+  copymode = 0;
+  eng_vdwl += ev.evdwl;
+
+  typename AT::t_int_1d::HostMirror h_errorflag =
+    Kokkos::create_mirror_view(d_errorflag);
+  Kokkos::deep_copy(h_errorflag,d_errorflag);
+  errorflag = h_errorflag(0);
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::operator()(TagMEAMDensFinal, const int &i,
+                                        EV_FLOAT &ev) const
+{
+  int m,errorflag;
+  double rhob,G,dG,Gbar,dGbar,gam,shp[3],Z;
+  double B,denom,rho_bkgd;
+
+  const int elti = d_map[type[i]];
+  if (elti < 0) return;
+
+  d_rho1[i] = 0.0;
+  d_rho2[i] = -1.0 / 3.0 * d_arho2b[i] * d_arho2b[i];
+  d_rho3[i] = 0.0;
+  for (m = 0; m < 3; m++) {
+    d_rho1[i] = d_rho1[i] + d_arho1(i,m) * d_arho1(i,m);
+    d_rho3[i] = d_rho3[i] - 3.0 / 5.0 * d_arho3b(i,m) * d_arho3b(i,m);
+  }
+  for (m = 0; m < 6; m++)
+    d_rho2[i] = d_rho2[i] + v2D[m] * d_arho2(i,m) * d_arho2(i,m);
+  for (m = 0; m < 10; m++)
+    d_rho3[i] = d_rho3[i] + v3D[m] * d_arho3(i,m) * d_arho3(i,m);
+
+  if (d_rho0[i] > 0.0) {
+    if (ialloy == 1) {
+      d_t_ave(i,0) = (d_tsq_ave(i,0) != 0.0) ?
+        d_t_ave(i,0) / d_tsq_ave(i,0) : 0.0;
+      d_t_ave(i,1) = (d_tsq_ave(i,1) != 0.0) ?
+        d_t_ave(i,1) / d_tsq_ave(i,1) : 0.0;
+      d_t_ave(i,0) = (d_tsq_ave(i,2) != 0.0) ?
+        d_t_ave(i,2) / d_tsq_ave(i,2) : 0.0;
+    } else if (ialloy == 2) {
+      d_t_ave(i,0) = t1_meam[elti];
+      d_t_ave(i,1) = t2_meam[elti];
+      d_t_ave(i,2) = t3_meam[elti];
+    } else {
+      d_t_ave(i,0) = d_t_ave(i,0) / d_rho0[i];
+      d_t_ave(i,1) = d_t_ave(i,1) / d_rho0[i];
+      d_t_ave(i,2) = d_t_ave(i,2) / d_rho0[i];
+    }
+  }
+
+  d_gamma[i] = d_t_ave(i,0) * d_rho1[i] + d_t_ave(i,1) * d_rho2[i] +
+    d_t_ave(i,2) * d_rho3[i];
+
+  if (d_rho0[i] > 0.0)
+    d_gamma[i] = d_gamma[i] / (d_rho0[i] * d_rho0[i]);
+
+  Z = Z_meam[elti];
+
+  errorflag = 0;
+  G = G_gam(d_gamma[i],ibar_meam[elti],errorflag);
+  if (errorflag != 0) {
+    d_errorflag[0] = errorflag;
+    return;
+  }
+  get_shpfcn(lattce_meam[elti][elti],shp);
+  if (ibar_meam[elti] <= 0) {
+    Gbar = 1.0;
+    dGbar = 0.0;
+  } else {
+    if (mix_ref_t == 1)
+      gam = (d_t_ave(i,0) * shp[0] + d_t_ave(i,1) * shp[1] +
+             d_t_ave(i,2) * shp[2]) / (Z * Z);
+    else
+      gam = (t1_meam[elti] * shp[0] + t2_meam[elti] * shp[1] +
+             t3_meam[elti] * shp[2]) / (Z * Z);
+    Gbar = G_gam(gam,ibar_meam[elti],errorflag);
+  }
+  d_rho[i] = d_rho0[i] * G;
+
+  if (mix_ref_t == 1) {
+    if (ibar_meam[elti] <= 0) {
+      Gbar = 1.0;
+      dGbar = 0.0;
+    } else {
+      gam = (d_t_ave(i,0) * shp[0] + d_t_ave(i,1) * shp[1] +
+             d_t_ave(i,2) * shp[2]) / (Z * Z);
+      Gbar = dG_gam(gam,ibar_meam[elti],dGbar);
+    }
+    rho_bkgd = rho0_meam[elti] * Z * Gbar;
+  } else {
+    if (bkgd_dyn == 1)
+      rho_bkgd = rho0_meam[elti] * Z;
+    else
+      rho_bkgd = rho_ref_meam[elti];
+  }
+  rhob = d_rho[i] / rho_bkgd;
+  denom = 1.0 / rho_bkgd;
+
+  G = dG_gam(d_gamma[i],ibar_meam[elti],dG);
+
+  d_dgamma1[i] = (G - 2 * dG * d_gamma[i]) * denom;
+
+  if (!iszero(d_rho0[i]))
+    d_dgamma2[i] = (dG / d_rho0[i]) * denom;
+  else
+    d_dgamma2[i] = 0.0;
+
+  // dgamma3 is nonzero only if we are using the "mixed" rule for
+  // computing t in the reference system (which is not correct, but
+  // included for backward compatibility
+
+  if (mix_ref_t == 1)
+    d_dgamma3[i] = d_rho0[i] * G * dGbar / (Gbar * Z * Z) * denom;
+  else
+    d_dgamma3[i] = 0.0;
+
+  B = A_meam[elti] * Ec_meam[elti][elti];
+
+  if (!iszero(rhob)) {
+    double phi;
+    if (emb_lin_neg == 1 && rhob <= 0) {
+      d_frhop[i] = -B;
+      phi = -B * rhob;
+    } else {
+      d_frhop[i] = B * (log(rhob) + 1.0);
+      phi = B * rhob * log(rhob);
+    }
+    if (eflag_either != 0) {
+      if (eflag_global != 0) ev.evdwl += phi;
+      if (eflag_atom != 0) d_eatom[i] += phi;
+    }
+  } else {
+    if (emb_lin_neg == 1)
+      d_frhop[i] = -B;
+    else
+      d_frhop[i] = B;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   forces of all pairs of the half list and of the atoms screening them
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void MEAMKokkos<DeviceType>::meam_force(int inum, int neighflag,
+                                        int eflag_either_in,
+                                        int eflag_global_in,
+                                        int eflag_atom_in, int vflag_atom_in,
+                                        double &eng_vdwl,
+                                        typename AT::t_f_array f_in,
+                                        typename AT::t_efloat_1d eatom,
+                                        typename AT::t_virial_array vatom)
+{
+  eflag_either = eflag_either_in;
+  eflag_global = eflag_global_in;
+  eflag_atom = eflag_atom_in;
+  vflag_atom = vflag_atom_in;
+  f = f_in;
+  d_eatom = eatom;
+  d_vatom = vatom;
+
+  EV_FLOAT ev;
+  copymode = 1;
+  if (neighflag == HALF)
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<DeviceType,
+                            TagMEAMForce<HALF> >(0,inum),*this,ev);
+  else
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<DeviceType,
+                            TagMEAMForce<HALFTHREAD> >(0,inum),*this,ev);
+  copymode = 0;
+  eng_vdwl += ev.evdwl;
+}
+
+template<class DeviceType>
+template<int NEIGHFLAG>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::operator()(TagMEAMForce<NEIGHFLAG>,
+                                        const int &ii, EV_FLOAT &ev) const
+{
+  // the f, eatom and vatom arrays are atomic for Half/Thread neighbor style
+
+  Kokkos::View<F_FLOAT*[3], typename DAT::t_f_array::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_f = f;
+  Kokkos::View<E_FLOAT*, typename DAT::t_efloat_1d::array_layout,DeviceType,
+    Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> > a_eatom = d_eatom;
+  Kokkos::View<F_FLOAT*[6], typename DAT::t_virial_array::array_layout,
+    DeviceType,Kokkos::MemoryTraits<AtomicF<NEIGHFLAG>::value> >
+    a_vatom = d_vatom;
+
+  int j,jn,k,kn,kk,m,n,p,q;
+  int nv2,nv3,eltj,eltk,ind;
+  double delij[3],rij2,rij,rij3;
+  double v[6],fi[3],fj[3];
+  double pp,dUdrij,dUdsij,dUdrijm[3],force,forcem;
+  double r,recip,phi,phip;
+  double sij;
+  double a1,a1i,a1j,a2,a2i,a2j;
+  double a3i,a3j;
+  double shpi[3],shpj[3];
+  double ai,aj,ro0i,ro0j,invrei,invrej;
+  double rhoa0j,drhoa0j,rhoa0i,drhoa0i;
+  double rhoa1j,drhoa1j,rhoa1i,drhoa1i;
+  double rhoa2j,drhoa2j,rhoa2i,drhoa2i;
+  double a3,a3a,rhoa3j,drhoa3j,rhoa3i,drhoa3i;
+  double drho0dr1,drho0dr2,drho0ds1,drho0ds2;
+  double drho1dr1,drho1dr2,drho1ds1,drho1ds2;
+  double drho1drm1[3],drho1drm2[3];
+  double drho2dr1,drho2dr2,drho2ds1,drho2ds2;
+  double drho2drm1[3],drho2drm2[3];
+  double drho3dr1,drho3dr2,drho3ds1,drho3ds2;
+  double drho3drm1[3],drho3drm2[3];
+  double dt1dr1,dt1dr2,dt1ds1,dt1ds2;
+  double dt2dr1,dt2dr2,dt2ds1,dt2ds2;
+  double dt3dr1,dt3dr2,dt3ds1,dt3ds2;
+  double drhodr1,drhodr2,drhods1,drhods2,drhodrm1[3],drhodrm2[3];
+  double arg;
+  double arg1i1,arg1j1,arg1i2,arg1j2,arg1i3,arg1j3,arg3i3,arg3j3;
+  double dsij1,dsij2,force1,force2;
+  double t1i,t2i,t3i,t1j,t2j,t3j;
+
+  const double third = 1.0 / 3.0;
+  const double sixth = 1.0 / 6.0;
+
+  // compute forces on atom i
+
+  const int i = d_ilist_half[ii];
+  const int elti = d_map[type[i]];
+  if (elti < 0) return;
+
+  const double xitmp = x(i,0);
+  const double yitmp = x(i,1);
+  const double zitmp = x(i,2);
+  const int numneigh = d_numneigh_half[i];
+  const int numneigh_full = d_numneigh_full[i];
+
+  double fitmp[3] = {0.0,0.0,0.0};
+
+  // treat each pair
+
+  for (jn = 0; jn < numneigh; jn++) {
+    j = d_neighbors_half(i,jn) & NEIGHMASK;
+    eltj = d_map[type[j]];
+
+    if (iszero(d_scrfcn(i,jn)) || eltj < 0) continue;
+
+    sij = d_scrfcn(i,jn) * d_fcpair(i,jn);
+    delij[0] = x(j,0) - xitmp;
+    delij[1] = x(j,1) - yitmp;
+    delij[2] = x(j,2) - zitmp;
+    rij2 = delij[0] * delij[0] + delij[1] * delij[1] + delij[2] * delij[2];
+    if (rij2 >= cutforcesq) continue;
+
+    rij = sqrt(rij2);
+    r = rij;
+
+    // compute phi and phip
+
+    ind = eltind[elti][eltj];
+    pp = rij * rdrar;
+    kk = (int) pp;
+    kk = MIN(kk,nrar - 2);
+    pp = pp - kk;
+    pp = MIN(pp,1.0);
+    phi = ((d_phirar3(ind,kk) * pp + d_phirar2(ind,kk)) * pp +
+           d_phirar1(ind,kk)) * pp + d_phirar(ind,kk);
+    phip = (d_phirar6(ind,kk) * pp + d_phirar5(ind,kk)) * pp +
+      d_phirar4(ind,kk);
+    recip = 1.0 / r;
+
+    if (eflag_either != 0) {
+      if (eflag_global != 0) ev.evdwl += phi * sij;
+      if (eflag_atom != 0) {
+        a_eatom[i] += 0.5 * phi * sij;
+        a_eatom[j] += 0.5 * phi * sij;
+      }
+    }
+
+    // compute pair densities and derivatives
+
+    invrei = 1.0 / re_meam[elti][elti];
+    ai = rij * invrei - 1.0;
+    ro0i = rho0_meam[elti];
+    rhoa0i = ro0i * exp(-beta0_meam[elti] * ai);
+    drhoa0i = -beta0_meam[elti] * invrei * rhoa0i;
+    rhoa1i = ro0i * exp(-beta1_meam[elti] * ai);
+    drhoa1i = -beta1_meam[elti] * invrei * rhoa1i;
+    rhoa2i = ro0i * exp(-beta2_meam[elti] * ai);
+    drhoa2i = -beta2_meam[elti] * invrei * rhoa2i;
+    rhoa3i = ro0i * exp(-beta3_meam[elti] * ai);
+    drhoa3i = -beta3_meam[elti] * invrei * rhoa3i;
+
+    if (elti != eltj) {
+      invrej = 1.0 / re_meam[eltj][eltj];
+      aj = rij * invrej - 1.0;
+      ro0j = rho0_meam[eltj];
+      rhoa0j = ro0j * exp(-beta0_meam[eltj] * aj);
+      drhoa0j = -beta0_meam[eltj] * invrej * rhoa0j;
+      rhoa1j = ro0j * exp(-beta1_meam[eltj] * aj);
+      drhoa1j = -beta1_meam[eltj] * invrej * rhoa1j;
+      rhoa2j = ro0j * exp(-beta2_meam[eltj] * aj);
+      drhoa2j = -beta2_meam[eltj] * invrej * rhoa2j;
+      rhoa3j = ro0j * exp(-beta3_meam[eltj] * aj);
+      drhoa3j = -beta3_meam[eltj] * invrej * rhoa3j;
+    } else {
+      rhoa0j = rhoa0i;
+      drhoa0j = drhoa0i;
+      rhoa1j = rhoa1i;
+      drhoa1j = drhoa1i;
+      rhoa2j = rhoa2i;
+      drhoa2j = drhoa2i;
+      rhoa3j = rhoa3i;
+      drhoa3j = drhoa3i;
+    }
+
+    const double t1mi = t1_meam[elti];
+    const double t2mi = t2_meam[elti];
+    const double t3mi = t3_meam[elti];
+    const double t1mj = t1_meam[eltj];
+    const double t2mj = t2_meam[eltj];
+    const double t3mj = t3_meam[eltj];
+
+    if (ialloy == 1) {
+      rhoa1j  *= t1mj;
+      rhoa2j  *= t2mj;
+      rhoa3j  *= t3mj;
+      rhoa1i  *= t1mi;
+      rhoa2i  *= t2mi;
+      rhoa3i  *= t3mi;
+      drhoa1j *= t1mj;
+      drhoa2j *= t2mj;
+      drhoa3j *= t3mj;
+      drhoa1i *= t1mi;
+      drhoa2i *= t2mi;
+      drhoa3i *= t3mi;
+    }
+
+    nv2 = 0;
+    nv3 = 0;
+    arg1i1 = 0.0;
+    arg1j1 = 0.0;
+    arg1i2 = 0.0;
+    arg1j2 = 0.0;
+    arg1i3 = 0.0;
+    arg1j3 = 0.0;
+    arg3i3 = 0.0;
+    arg3j3 = 0.0;
+    for (n = 0; n < 3; n++) {
+      for (p = n; p < 3; p++) {
+        for (q = p; q < 3; q++) {
+          arg = delij[n] * delij[p] * delij[q] * v3D[nv3];
+          arg1i3 = arg1i3 + d_arho3(i,nv3) * arg;
+          arg1j3 = arg1j3 - d_arho3(j,nv3) * arg;
+          nv3 = nv3 + 1;
+        }
+        arg = delij[n] * delij[p] * v2D[nv2];
+        arg1i2 = arg1i2 + d_arho2(i,nv2) * arg;
+        arg1j2 = arg1j2 + d_arho2(j,nv2) * arg;
+        nv2 = nv2 + 1;
+      }
+      arg1i1 = arg1i1 + d_arho1(i,n) * delij[n];
+      arg1j1 = arg1j1 - d_arho1(j,n) * delij[n];
+      arg3i3 = arg3i3 + d_arho3b(i,n) * delij[n];
+      arg3j3 = arg3j3 - d_arho3b(j,n) * delij[n];
+    }
+
+    // rho0 terms
+
+    drho0dr1 = drhoa0j * sij;
+    drho0dr2 = drhoa0i * sij;
+
+    // rho1 terms
+
+    a1 = 2 * sij / rij;
+    drho1dr1 = a1 * (drhoa1j - rhoa1j / rij) * arg1i1;
+    drho1dr2 = a1 * (drhoa1i - rhoa1i / rij) * arg1j1;
+    a1 = 2.0 * sij / rij;
+    for (m = 0; m < 3; m++) {
+      drho1drm1[m] = a1 * rhoa1j * d_arho1(i,m);
+      drho1drm2[m] = -a1 * rhoa1i * d_arho1(j,m);
+    }
+
+    // rho2 terms
+
+    a2 = 2 * sij / rij2;
+    drho2dr1 = a2 * (drhoa2j - 2 * rhoa2j / rij) * arg1i2 -
+      2.0 / 3.0 * d_arho2b[i] * drhoa2j * sij;
+    drho2dr2 = a2 * (drhoa2i - 2 * rhoa2i / rij) * arg1j2 -
+      2.0 / 3.0 * d_arho2b[j] * drhoa2i * sij;
+    a2 = 4 * sij / rij2;
+    for (m = 0; m < 3; m++) {
+      drho2drm1[m] = 0.0;
+      drho2drm2[m] = 0.0;
+      for (n = 0; n < 3; n++) {
+        drho2drm1[m] = drho2drm1[m] + d_arho2(i,vind2D[m][n]) * delij[n];
+        drho2drm2[m] = drho2drm2[m] - d_arho2(j,vind2D[m][n]) * delij[n];
+      }
+      drho2drm1[m] = a2 * rhoa2j * drho2drm1[m];
+      drho2drm2[m] = -a2 * rhoa2i * drho2drm2[m];
+    }
+
+    // rho3 terms
+
+    rij3 = rij * rij2;
+    a3 = 2 * sij / rij3;
+    a3a = 6.0 / 5.0 * sij / rij;
+    drho3dr1 = a3 * (drhoa3j - 3 * rhoa3j / rij) * arg1i3 -
+      a3a * (drhoa3j - rhoa3j / rij) * arg3i3;
+    drho3dr2 = a3 * (drhoa3i - 3 * rhoa3i / rij) * arg1j3 -
+      a3a * (drhoa3i - rhoa3i / rij) * arg3j3;
+    a3 = 6 * sij / rij3;
+    a3a = 6 * sij / (5 * rij);
+    for (m = 0; m < 3; m++) {
+      drho3drm1[m] = 0.0;
+      drho3drm2[m] = 0.0;
+      nv2 = 0;
+      for (n = 0; n < 3; n++) {
+        for (p = n; p < 3; p++) {
+          arg = delij[n] * delij[p] * v2D[nv2];
+          drho3drm1[m] = drho3drm1[m] + d_arho3(i,vind3D[m][n][p]) * arg;
+          drho3drm2[m] = drho3drm2[m] + d_arho3(j,vind3D[m][n][p]) * arg;
+          nv2 = nv2 + 1;
+        }
+      }
+      drho3drm1[m] = (a3 * drho3drm1[m] - a3a * d_arho3b(i,m)) * rhoa3j;
+      drho3drm2[m] = (-a3 * drho3drm2[m] + a3a * d_arho3b(j,m)) * rhoa3i;
+    }
+
+    // compute derivatives of weighting functions t wrt rij
+
+    t1i = d_t_ave(i,0);
+    t2i = d_t_ave(i,1);
+    t3i = d_t_ave(i,2);
+    t1j = d_t_ave(j,0);
+    t2j = d_t_ave(j,1);
+    t3j = d_t_ave(j,2);
+
+    if (ialloy == 1) {
+
+      a1i = 0.0;
+      a1j = 0.0;
+      a2i = 0.0;
+      a2j = 0.0;
+      a3i = 0.0;
+      a3j = 0.0;
+      if (!iszero(d_tsq_ave(i,0)))
+        a1i = drhoa0j * sij / d_tsq_ave(i,0);
+      if (!iszero(d_tsq_ave(j,0)))
+        a1j = drhoa0i * sij / d_tsq_ave(j,0);
+      if (!iszero(d_tsq_ave(i,1)))
+        a2i = drhoa0j * sij / d_tsq_ave(i,1);
+      if (!iszero(d_tsq_ave(j,1)))
+        a2j = drhoa0i * sij / d_tsq_ave(j,1);
+      if (!iszero(d_tsq_ave(i,2)))
+        a3i = drhoa0j * sij / d_tsq_ave(i,2);
+      if (!iszero(d_tsq_ave(j,2)))
+        a3j = drhoa0i * sij / d_tsq_ave(j,2);
+
+      dt1dr1 = a1i * (t1mj - t1i * t1mj*t1mj);
+      dt1dr2 = a1j * (t1mi - t1j * t1mi*t1mi);
+      dt2dr1 = a2i * (t2mj - t2i * t2mj*t2mj);
+      dt2dr2 = a2j * (t2mi - t2j * t2mi*t2mi);
+      dt3dr1 = a3i * (t3mj - t3i * t3mj*t3mj);
+      dt3dr2 = a3j * (t3mi - t3j * t3mi*t3mi);
+
+    } else if (ialloy == 2) {
+
+      dt1dr1 = 0.0;
+      dt1dr2 = 0.0;
+      dt2dr1 = 0.0;
+      dt2dr2 = 0.0;
+      dt3dr1 = 0.0;
+      dt3dr2 = 0.0;
+
+    } else {
+
+      ai = 0.0;
+      if (!iszero(d_rho0[i]))
+        ai = drhoa0j * sij / d_rho0[i];
+      aj = 0.0;
+      if (!iszero(d_rho0[j]))
+        aj = drhoa0i * sij / d_rho0[j];
+
+      dt1dr1 = ai * (t1mj - t1i);
+      dt1dr2 = aj * (t1mi - t1j);
+      dt2dr1 = ai * (t2mj - t2i);
+      dt2dr2 = aj * (t2mi - t2j);
+      dt3dr1 = ai * (t3mj - t3i);
+      dt3dr2 = aj * (t3mi - t3j);
+    }
+
+    // compute derivatives of total density wrt rij, sij and rij(3)
+
+    get_shpfcn(lattce_meam[elti][elti],shpi);
+    get_shpfcn(lattce_meam[eltj][eltj],shpj);
+    drhodr1 = d_dgamma1[i] * drho0dr1 +
+      d_dgamma2[i] * (dt1dr1 * d_rho1[i] + t1i * drho1dr1 +
+                      dt2dr1 * d_rho2[i] + t2i * drho2dr1 +
+                      dt3dr1 * d_rho3[i] + t3i * drho3dr1) -
+      d_dgamma3[i] * (shpi[0] * dt1dr1 + shpi[1] * dt2dr1 + shpi[2] * dt3dr1);
+    drhodr2 = d_dgamma1[j] * drho0dr2 +
+      d_dgamma2[j] * (dt1dr2 * d_rho1[j] + t1j * drho1dr2 +
+                      dt2dr2 * d_rho2[j] + t2j * drho2dr2 +
+                      dt3dr2 * d_rho3[j] + t3j * drho3dr2) -
+      d_dgamma3[j] * (shpj[0] * dt1dr2 + shpj[1] * dt2dr2 + shpj[2] * dt3dr2);
+    for (m = 0; m < 3; m++) {
+      drhodrm1[m] = d_dgamma2[i] * (t1i * drho1drm1[m] + t2i * drho2drm1[m] +
+                                    t3i * drho3drm1[m]);
+      drhodrm2[m] = d_dgamma2[j] * (t1j * drho1drm2[m] + t2j * drho2drm2[m] +
+                                    t3j * drho3drm2[m]);
+    }
+
+    // compute derivatives wrt sij, but only if necessary
+
+    drhods1 = drhods2 = 0.0;
+    if (!iszero(d_dscrfcn(i,jn))) {
+      drho0ds1 = rhoa0j;
+      drho0ds2 = rhoa0i;
+      a1 = 2.0 / rij;
+      drho1ds1 = a1 * rhoa1j * arg1i1;
+      drho1ds2 = a1 * rhoa1i * arg1j1;
+      a2 = 2.0 / rij2;
+      drho2ds1 = a2 * rhoa2j * arg1i2 - 2.0 / 3.0 * d_arho2b[i] * rhoa2j;
+      drho2ds2 = a2 * rhoa2i * arg1j2 - 2.0 / 3.0 * d_arho2b[j] * rhoa2i;
+      a3 = 2.0 / rij3;
+      a3a = 6.0 / (5.0 * rij);
+      drho3ds1 = a3 * rhoa3j * arg1i3 - a3a * rhoa3j * arg3i3;
+      drho3ds2 = a3 * rhoa3i * arg1j3 - a3a * rhoa3i * arg3j3;
+
+      if (ialloy == 1) {
+
+        a1i = 0.0;
+        a1j = 0.0;
+        a2i = 0.0;
+        a2j = 0.0;
+        a3i = 0.0;
+        a3j = 0.0;
+        if (!iszero(d_tsq_ave(i,0)))
+          a1i = rhoa0j / d_tsq_ave(i,0);
+        if (!iszero(d_tsq_ave(j,0)))
+          a1j = rhoa0i / d_tsq_ave(j,0);
+        if (!iszero(d_tsq_ave(i,1)))
+          a2i = rhoa0j / d_tsq_ave(i,1);
+        if (!iszero(d_tsq_ave(j,1)))
+          a2j = rhoa0i / d_tsq_ave(j,1);
+        if (!iszero(d_tsq_ave(i,2)))
+          a3i = rhoa0j / d_tsq_ave(i,2);
+        if (!iszero(d_tsq_ave(j,2)))
+          a3j = rhoa0i / d_tsq_ave(j,2);
+
+        dt1ds1 = a1i * (t1mj - t1i * t1mj*t1mj);
+        dt1ds2 = a1j * (t1mi - t1j * t1mi*t1mi);
+        dt2ds1 = a2i * (t2mj - t2i * t2mj*t2mj);
+        dt2ds2 = a2j * (t2mi - t2j * t2mi*t2mi);
+        dt3ds1 = a3i * (t3mj - t3i * t3mj*t3mj);
+        dt3ds2 = a3j * (t3mi - t3j * t3mi*t3mi);
+
+      } else if (ialloy == 2) {
+
+        dt1ds1 = 0.0;
+        dt1ds2 = 0.0;
+        dt2ds1 = 0.0;
+        dt2ds2 = 0.0;
+        dt3ds1 = 0.0;
+        dt3ds2 = 0.0;
+
+      } else {
+
+        ai = 0.0;
+        if (!iszero(d_rho0[i]))
+          ai = rhoa0j / d_rho0[i];
+        aj = 0.0;
+        if (!iszero(d_rho0[j]))
+          aj = rhoa0i / d_rho0[j];
+
+        dt1ds1 = ai * (t1mj - t1i);
+        dt1ds2 = aj * (t1mi - t1j);
+        dt2ds1 = ai * (t2mj - t2i);
+        dt2ds2 = aj * (t2mi - t2j);
+        dt3ds1 = ai * (t3mj - t3i);
+        dt3ds2 = aj * (t3mi - t3j);
+      }
+
+      drhods1 = d_dgamma1[i] * drho0ds1 +
+        d_dgamma2[i] * (dt1ds1 * d_rho1[i] + t1i * drho1ds1 +
+                        dt2ds1 * d_rho2[i] + t2i * drho2ds1 +
+                        dt3ds1 * d_rho3[i] + t3i * drho3ds1) -
+        d_dgamma3[i] * (shpi[0] * dt1ds1 + shpi[1] * dt2ds1 +
+                        shpi[2] * dt3ds1);
+      drhods2 = d_dgamma1[j] * drho0ds2 +
+        d_dgamma2[j] * (dt1ds2 * d_rho1[j] + t1j * drho1ds2 +
+                        dt2ds2 * d_rho2[j] + t2j * drho2ds2 +
+                        dt3ds2 * d_rho3[j] + t3j * drho3ds2) -
+        d_dgamma3[j] * (shpj[0] * dt1ds2 + shpj[1] * dt2ds2 +
+                        shpj[2] * dt3ds2);
+    }
+
+    // compute derivatives of energy wrt rij, sij and rij[3]
+
+    dUdrij = phip * sij + d_frhop[i] * drhodr1 + d_frhop[j] * drhodr2;
+    dUdsij = 0.0;
+    if (!iszero(d_dscrfcn(i,jn)))
+      dUdsij = phi + d_frhop[i] * drhods1 + d_frhop[j] * drhods2;
+    for (m = 0; m < 3; m++)
+      dUdrijm[m] = d_frhop[i] * drhodrm1[m] + d_frhop[j] * drhodrm2[m];
+
+    // add the part of the force due to dUdrij and dUdsij
+
+    force = dUdrij * recip + dUdsij * d_dscrfcn(i,jn);
+    for (m = 0; m < 3; m++) {
+      forcem = delij[m] * force + dUdrijm[m];
+      fitmp[m] += forcem;
+      a_f(j,m) -= forcem;
+    }
+
+    // tabulate per-atom virial as symmetrized stress tensor
+
+    if (vflag_atom != 0) {
+      fi[0] = delij[0] * force + dUdrijm[0];
+      fi[1] = delij[1] * force + dUdrijm[1];
+      fi[2] = delij[2] * force + dUdrijm[2];
+      v[0] = -0.5 * (delij[0] * fi[0]);
+      v[1] = -0.5 * (delij[1] * fi[1]);
+      v[2] = -0.5 * (delij[2] * fi[2]);
+      v[3] = -0.25 * (delij[0] * fi[1] + delij[1] * fi[0]);
+      v[4] = -0.25 * (delij[0] * fi[2] + delij[2] * fi[0]);
+      v[5] = -0.25 * (delij[1] * fi[2] + delij[2] * fi[1]);
+
+      for (m = 0; m < 6; m++) {
+        a_vatom(i,m) += v[m];
+        a_vatom(j,m) += v[m];
+      }
+    }
+
+    // now compute forces on other atoms k due to change in sij
+
+    if (iszero(sij) || iszero(sij - 1.0)) continue;
+
+    const double rbound = rij2 * ebound_meam[elti][eltj];
+
+    for (kn = 0; kn < numneigh_full; kn++) {
+      k = d_neighbors_full(i,kn) & NEIGHMASK;
+      eltk = d_map[type[k]];
+      if (k == j || eltk < 0) continue;
+
+      double xik,xjk,cikj,sikj,dfc,a;
+      double dCikj1,dCikj2;
+      double delc,rik2,rjk2;
+      double dxik,dyik,dzik,dxjk,dyjk,dzjk;
+
+      const double Cmax = Cmax_meam[elti][eltj][eltk];
+      const double Cmin = Cmin_meam[elti][eltj][eltk];
+
+      delc = Cmax - Cmin;
+      dxjk = x(k,0) - x(j,0);
+      dyjk = x(k,1) - x(j,1);
+      dzjk = x(k,2) - x(j,2);
+      rjk2 = dxjk * dxjk + dyjk * dyjk + dzjk * dzjk;
+      if (rjk2 > rbound) continue;
+
+      dxik = x(k,0) - xitmp;
+      dyik = x(k,1) - yitmp;
+      dzik = x(k,2) - zitmp;
+      rik2 = dxik * dxik + dyik * dyik + dzik * dzik;
+      if (rik2 > rbound) continue;
+
+      xik = rik2 / rij2;
+      xjk = rjk2 / rij2;
+      a = 1 - (xik - xjk) * (xik - xjk);
+      if (iszero(a)) continue;
+
+      cikj = (2.0 * (xik + xjk) + a - 2.0) / a;
+      if (cikj < Cmin || cikj > Cmax) continue;
+
+      cikj = (cikj - Cmin) / delc;
+      sikj = dfcut(cikj,dfc);
+      dCfunc2(rij2,rik2,rjk2,dCikj1,dCikj2);
+      a = sij / delc * dfc / sikj;
+      dsij1 = a * dCikj1;
+      dsij2 = a * dCikj2;
+
+      if (iszero(dsij1) && iszero(dsij2)) continue;
+
+      force1 = dUdsij * dsij1;
+      force2 = dUdsij * dsij2;
+
+      fitmp[0] += force1 * dxik;
+      fitmp[1] += force1 * dyik;
+      fitmp[2] += force1 * dzik;
+      a_f(j,0) += force2 * dxjk;
+      a_f(j,1) += force2 * dyjk;
+      a_f(j,2) += force2 * dzjk;
+      a_f(k,0) -= force1 * dxik + force2 * dxjk;
+      a_f(k,1) -= force1 * dyik + force2 * dyjk;
+      a_f(k,2) -= force1 * dzik + force2 * dzjk;
+
+      // tabulate per-atom virial as symmetrized stress tensor
+
+      if (vflag_atom != 0) {
+        fi[0] = force1 * dxik;
+        fi[1] = force1 * dyik;
+        fi[2] = force1 * dzik;
+        fj[0] = force2 * dxjk;
+        fj[1] = force2 * dyjk;
+        fj[2] = force2 * dzjk;
+        v[0] = -third * (dxik * fi[0] + dxjk * fj[0]);
+        v[1] = -third * (dyik * fi[1] + dyjk * fj[1]);
+        v[2] = -third * (dzik * fi[2] + dzjk * fj[2]);
+        v[3] = -sixth * (dxik * fi[1] + dxjk * fj[1] +
+                         dyik * fi[0] + dyjk * fj[0]);
+        v[4] = -sixth * (dxik * fi[2] + dxjk * fj[2] +
+                         dzik * fi[0] + dzjk * fj[0]);
+        v[5] = -sixth * (dyik * fi[2] + dyjk * fj[2] +
+                         dzik * fi[1] + dzjk * fj[1]);
+
+        for (m = 0; m < 6; m++) {
+          a_vatom(i,m) += v[m];
+          a_vatom(j,m) += v[m];
+          a_vatom(k,m) += v[m];
+        }
+      }
+    }
+  }
+
+  a_f(i,0) += fitmp[0];
+  a_f(i,1) += fitmp[1];
+  a_f(i,2) += fitmp[2];
+}
+
+/* ----------------------------------------------------------------------
+   forward communication of the completed densities on the device
+   same 38 values per atom and order as PairMEAMC::pack_forward_comm()
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+int MEAMKokkos<DeviceType>::pack_forward_comm_kokkos(int n,
+                                                     DAT::tdual_int_2d k_sendlist,
+                                                     int iswap_in,
+                                                     DAT::tdual_xfloat_1d &buf)
+{
+  d_sendlist = k_sendlist.view<DeviceType>();
+  iswap = iswap_in;
+  v_buf = buf.view<DeviceType>();
+  copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagMEAMPackForwardComm>
+                       (0,n),*this);
+  copymode = 0;
+  return n*38;
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::operator()(TagMEAMPackForwardComm,
+                                        const int &i) const
+{
+  const int j = d_sendlist(iswap,i);
+  int m = i*38;
+  v_buf[m++] = d_rho0[j];
+  v_buf[m++] = d_rho1[j];
+  v_buf[m++] = d_rho2[j];
+  v_buf[m++] = d_rho3[j];
+  v_buf[m++] = d_frhop[j];
+  v_buf[m++] = d_gamma[j];
+  v_buf[m++] = d_dgamma1[j];
+  v_buf[m++] = d_dgamma2[j];
+  v_buf[m++] = d_dgamma3[j];
+  v_buf[m++] = d_arho2b[j];
+  for (int k = 0; k < 3; k++) v_buf[m++] = d_arho1(j,k);
+  for (int k = 0; k < 6; k++) v_buf[m++] = d_arho2(j,k);
+  for (int k = 0; k < 10; k++) v_buf[m++] = d_arho3(j,k);
+  for (int k = 0; k < 3; k++) v_buf[m++] = d_arho3b(j,k);
+  for (int k = 0; k < 3; k++) v_buf[m++] = d_t_ave(j,k);
+  for (int k = 0; k < 3; k++) v_buf[m++] = d_tsq_ave(j,k);
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void MEAMKokkos<DeviceType>::unpack_forward_comm_kokkos(int n, int first_in,
+                                                        DAT::tdual_xfloat_1d &buf)
+{
+  first = first_in;
+  v_buf = buf.view<DeviceType>();
+  copymode = 1;
+  Kokkos::parallel_for(Kokkos::RangePolicy<DeviceType,TagMEAMUnpackForwardComm>
+                       (0,n),*this);
+  copymode = 0;
+}
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::operator()(TagMEAMUnpackForwardComm,
+                                        const int &i) const
+{
+  const int j = i + first;
+  int m = i*38;
+  d_rho0[j] = v_buf[m++];
+  d_rho1[j] = v_buf[m++];
+  d_rho2[j] = v_buf[m++];
+  d_rho3[j] = v_buf[m++];
+  d_frhop[j] = v_buf[m++];
+  d_gamma[j] = v_buf[m++];
+  d_dgamma1[j] = v_buf[m++];
+  d_dgamma2[j] = v_buf[m++];
+  d_dgamma3[j] = v_buf[m++];
+  d_arho2b[j] = v_buf[m++];
+  for (int k = 0; k < 3; k++) d_arho1(j,k) = v_buf[m++];
+  for (int k = 0; k < 6; k++) d_arho2(j,k) = v_buf[m++];
+  for (int k = 0; k < 10; k++) d_arho3(j,k) = v_buf[m++];
+  for (int k = 0; k < 3; k++) d_arho3b(j,k) = v_buf[m++];
+  for (int k = 0; k < 3; k++) d_t_ave(j,k) = v_buf[m++];
+  for (int k = 0; k < 3; k++) d_tsq_ave(j,k) = v_buf[m++];
+}
+
+/* ----------------------------------------------------------------------
+   device versions of the MEAM library functions in meam_funcs.cpp
+   and meam.h, see there for the meaning of the arguments
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+double MEAMKokkos<DeviceType>::G_gam(const double gamma, const int ibar,
+                                     int &errorflag) const
+{
+  double gsmooth_switchpoint;
+
+  switch (ibar) {
+    case 0:
+    case 4:
+      gsmooth_switchpoint = -gsmooth_factor / (gsmooth_factor + 1);
+      if (gamma < gsmooth_switchpoint) {
+        double G = 1 / (gsmooth_factor + 1) *
+          pow((gsmooth_switchpoint / gamma),gsmooth_factor);
+        return sqrt(G);
+      } else {
+        return sqrt(1.0 + gamma);
+      }
+    case 1:
+      return exp(gamma / 2.0);
+    case 3:
+      return 2.0 / (1.0 + exp(-gamma));
+    case -5:
+      if ((1.0 + gamma) >= 0) {
+        return sqrt(1.0 + gamma);
+      } else {
+        return -sqrt(-1.0 - gamma);
+      }
+  }
+  errorflag = 1;
+  return 0.0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+double MEAMKokkos<DeviceType>::dG_gam(const double gamma, const int ibar,
+                                      double &dG) const
+{
+  double gsmooth_switchpoint;
+  double G;
+
+  switch (ibar) {
+    case 0:
+    case 4:
+      gsmooth_switchpoint = -gsmooth_factor / (gsmooth_factor + 1);
+      if (gamma < gsmooth_switchpoint) {
+        G = 1 / (gsmooth_factor + 1) *
+          pow((gsmooth_switchpoint / gamma),gsmooth_factor);
+        G = sqrt(G);
+        dG = -gsmooth_factor * G / (2.0 * gamma);
+        return G;
+      } else {
+        G = sqrt(1.0 + gamma);
+        dG = 1.0 / (2.0 * G);
+        return G;
+      }
+    case 1:
+      G = exp(gamma / 2.0);
+      dG = G / 2.0;
+      return G;
+    case 3:
+      G = 2.0 / (1.0 + exp(-gamma));
+      dG = G * (2.0 - G) / 2;
+      return G;
+    case -5:
+      if ((1.0 + gamma) >= 0) {
+        G = sqrt(1.0 + gamma);
+        dG = 1.0 / (2.0 * G);
+        return G;
+      } else {
+        G = -sqrt(-1.0 - gamma);
+        dG = -1.0 / (2.0 * G);
+        return G;
+      }
+  }
+  dG = 1.0;
+  return 0.0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::get_shpfcn(const lattice_t latt, double *s)
+{
+  switch (latt) {
+    case FCC:
+    case BCC:
+    case B1:
+    case B2:
+      s[0] = 0.0;
+      s[1] = 0.0;
+      s[2] = 0.0;
+      break;
+    case HCP:
+      s[0] = 0.0;
+      s[1] = 0.0;
+      s[2] = 1.0 / 3.0;
+      break;
+    case DIA:
+      s[0] = 0.0;
+      s[1] = 0.0;
+      s[2] = 32.0 / 9.0;
+      break;
+    case DIM:
+      s[0] = 1.0;
+      s[1] = 2.0 / 3.0;
+      s[2] = 0.40;
+      break;
+    default:
+      s[0] = 0.0;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+bool MEAMKokkos<DeviceType>::iszero(const double f)
+{
+  return fabs(f) < 1e-20;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+double MEAMKokkos<DeviceType>::fcut(const double xi)
+{
+  double a;
+  if (xi >= 1.0)
+    return 1.0;
+  else if (xi <= 0.0)
+    return 0.0;
+  else {
+    a = 1.0 - xi;
+    a *= a; a *= a;
+    a = 1.0 - a;
+    return a * a;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+double MEAMKokkos<DeviceType>::dfcut(const double xi, double &dfc)
+{
+  double a,a3,a4,a1m4;
+  if (xi >= 1.0) {
+    dfc = 0.0;
+    return 1.0;
+  } else if (xi <= 0.0) {
+    dfc = 0.0;
+    return 0.0;
+  } else {
+    a = 1.0 - xi;
+    a3 = a * a * a;
+    a4 = a * a3;
+    a1m4 = 1.0-a4;
+
+    dfc = 8 * a1m4 * a3;
+    return a1m4*a1m4;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+double MEAMKokkos<DeviceType>::dCfunc(const double rij2, const double rik2,
+                                      const double rjk2)
+{
+  double rij4,a,asq,b,denom;
+
+  rij4 = rij2 * rij2;
+  a = rik2 - rjk2;
+  b = rik2 + rjk2;
+  asq = a*a;
+  denom = rij4 - asq;
+  denom = denom * denom;
+  return -4 * (-2 * rij2 * asq + rij4 * b + asq * b) / denom;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+KOKKOS_INLINE_FUNCTION
+void MEAMKokkos<DeviceType>::dCfunc2(const double rij2, const double rik2,
+                                     const double rjk2,
+                                     double &dCikj1, double &dCikj2)
+{
+  double rij4,rik4,rjk4,a,denom;
+
+  rij4 = rij2 * rij2;
+  rik4 = rik2 * rik2;
+  rjk4 = rjk2 * rjk2;
+  a = rik2 - rjk2;
+  denom = rij4 - a * a;
+  denom = denom * denom;
+  dCikj1 = 4 * rij2 * (rij4 + rik4 + 2 * rik2 * rjk2 - 3 * rjk4 -
+                       2 * rij2 * a) / denom;
+  dCikj2 = 4 * rij2 * (rij4 - 3 * rik4 + 2 * rik2 * rjk2 + rjk4 +
+                       2 * rij2 * a) / denom;
+}
+
+/* ---------------------------------------------------------------------- */
+
+namespace LAMMPS_NS {
+template class MEAMKokkos<LMPDeviceType>;
+#ifdef KOKKOS_HAVE_CUDA
+template class MEAMKokkos<LMPHostType>;
+#endif
+}
@@ -0,0 +1,166 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_MEAM_KOKKOS_H
+#define LMP_MEAM_KOKKOS_H
+
+#include "meam.h"
+#include "kokkos_type.h"
+#include "pair_kokkos.h"
+#include "neigh_list_kokkos.h"
+
+namespace LAMMPS_NS {
+
+struct TagMEAMZero{};
+
+template<int NEIGHFLAG>
+struct TagMEAMDensInit{};
+
+struct TagMEAMDensFinal{};
+
+template<int NEIGHFLAG>
+struct TagMEAMForce{};
+
+struct TagMEAMPackForwardComm{};
+struct TagMEAMUnpackForwardComm{};
+
+// the MEAM library with its three stages run as Kokkos kernels
+// element parameters are fixed-size members of MEAM and travel with
+//   the functor, the pair tables and per-atom arrays are views
+
+template<class DeviceType>
+class MEAMKokkos : public MEAM {
+ public:
+  typedef DeviceType device_type;
+  typedef ArrayTypes<DeviceType> AT;
+  typedef EV_FLOAT value_type;
+
+  MEAMKokkos(Memory *);
+  ~MEAMKokkos();
+
+  void meam_setup_done_kokkos(int, int *);
+  void meam_dens_setup(int, int, int, int);
+  void meam_dens_init(int, int, typename AT::t_x_array_randomread,
+                      typename AT::t_int_1d_randomread,
+                      NeighListKokkos<DeviceType> *,
+                      NeighListKokkos<DeviceType> *);
+  void dens_to_host();
+  void dens_to_device();
+  void meam_dens_final(int, int, int, int, double &,
+                       typename AT::t_efloat_1d, int &);
+  void meam_force(int, int, int, int, int, int, double &,
+                  typename AT::t_f_array, typename AT::t_efloat_1d,
+                  typename AT::t_virial_array);
+
+  int pack_forward_comm_kokkos(int, DAT::tdual_int_2d, int,
+                               DAT::tdual_xfloat_1d &);
+  void unpack_forward_comm_kokkos(int, int, DAT::tdual_xfloat_1d &);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagMEAMZero, const int &) const;
+
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagMEAMDensInit<NEIGHFLAG>, const int &) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagMEAMDensFinal, const int &, EV_FLOAT &) const;
+
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagMEAMForce<NEIGHFLAG>, const int &, EV_FLOAT &) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagMEAMPackForwardComm, const int &) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagMEAMUnpackForwardComm, const int &) const;
+
+  // per-atom arrays, the host views are used by the host comm routines
+
+  DAT::tdual_ffloat_1d k_rho,k_rho0,k_rho1,k_rho2,k_rho3,k_frhop;
+  DAT::tdual_ffloat_1d k_gamma,k_dgamma1,k_dgamma2,k_dgamma3,k_arho2b;
+  DAT::tdual_ffloat_2d k_arho1,k_arho2,k_arho3,k_arho3b,k_t_ave,k_tsq_ave;
+
+ protected:
+  typename AT::t_ffloat_1d d_rho,d_rho0,d_rho1,d_rho2,d_rho3,d_frhop;
+  typename AT::t_ffloat_1d d_gamma,d_dgamma1,d_dgamma2,d_dgamma3,d_arho2b;
+  typename AT::t_ffloat_2d d_arho1,d_arho2,d_arho3,d_arho3b,d_t_ave,d_tsq_ave;
+
+  // screening function, its derivative and the radial cutoff
+  //   for each pair of the half neighbor list
+
+  typename AT::t_ffloat_2d d_scrfcn,d_dscrfcn,d_fcpair;
+
+  // atom type to element map and pair potential spline coefficients
+
+  typename AT::t_int_1d d_map;
+  typename AT::t_ffloat_2d d_phirar,d_phirar1,d_phirar2,d_phirar3;
+  typename AT::t_ffloat_2d d_phirar4,d_phirar5,d_phirar6;
+
+  typename AT::t_x_array_randomread x;
+  typename AT::t_int_1d_randomread type;
+  typename AT::t_f_array f;
+  typename AT::t_efloat_1d d_eatom;
+  typename AT::t_virial_array d_vatom;
+
+  typename AT::t_int_1d_randomread d_ilist_half;
+  typename AT::t_int_1d_randomread d_numneigh_half;
+  typename AT::t_neighbors_2d d_neighbors_half;
+  typename AT::t_int_1d_randomread d_numneigh_full;
+  typename AT::t_neighbors_2d d_neighbors_full;
+
+  typename AT::t_int_1d d_errorflag;
+
+  int eflag_either,eflag_global,eflag_atom,vflag_atom;
+
+  int iswap,first;
+  typename AT::t_int_2d d_sendlist;
+  typename AT::t_xfloat_1d_um v_buf;
+
+  KOKKOS_INLINE_FUNCTION
+  void getscreen(int) const;
+
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void calc_rho1(int) const;
+
+  KOKKOS_INLINE_FUNCTION
+  double G_gam(const double, const int, int &) const;
+
+  KOKKOS_INLINE_FUNCTION
+  double dG_gam(const double, const int, double &) const;
+
+  KOKKOS_INLINE_FUNCTION
+  static void get_shpfcn(const lattice_t, double *);
+
+  KOKKOS_INLINE_FUNCTION
+  static bool iszero(const double);
+
+  KOKKOS_INLINE_FUNCTION
+  static double fcut(const double);
+
+  KOKKOS_INLINE_FUNCTION
+  static double dfcut(const double, double &);
+
+  KOKKOS_INLINE_FUNCTION
+  static double dCfunc(const double, const double, const double);
+
+  KOKKOS_INLINE_FUNCTION
+  static void dCfunc2(const double, const double, const double,
+                      double &, double &);
+};
+
+}
+
+#endif
@@ -37,8 +37,10 @@ template<class Device>
 void NeighListKokkos<Device>::grow(int nmax)
 {
   // skip if this list is already long enough to store nmax atoms
+  //  and maxneighs neighbors
 
-  if (nmax <= maxatoms) return;
+  if (nmax <= maxatoms &&
+      (int) d_neighbors.dimension_1() >= maxneighs) return;
   maxatoms = nmax;
 
   k_ilist =
@@ -0,0 +1,263 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(airebo/kk,PairAIREBOKokkos<LMPDeviceType>)
+PairStyle(airebo/kk/device,PairAIREBOKokkos<LMPDeviceType>)
+PairStyle(airebo/kk/host,PairAIREBOKokkos<LMPHostType>)
+
+#else
+
+#ifndef LMP_PAIR_AIREBO_KOKKOS_H
+#define LMP_PAIR_AIREBO_KOKKOS_H
+
+#include "pair_kokkos.h"
+#include "pair_airebo.h"
+#include "neigh_list_kokkos.h"
+
+namespace LAMMPS_NS {
+
+struct TagPairAIREBONeigh{};
+
+template<int NEIGHFLAG, int EVFLAG>
+struct TagPairAIREBOFREBO{};
+
+template<int NEIGHFLAG, int EVFLAG>
+struct TagPairAIREBOFLJ{};
+
+template<int NEIGHFLAG, int EVFLAG>
+struct TagPairAIREBOTorsion{};
+
+// copy of the PairAIREBO parameters and spline tables used by the kernels
+
+struct params_airebo {
+  double Nmin,Nmax,NCmin,NCmax,thmin,thmax;
+  double rcmin[2][2],rcmax[2][2],rcmaxsq[2][2],rcmaxp[2][2];
+  double Q[2][2],alpha[2][2],A[2][2],rho[2][2],BIJc[2][2][3],Beta[2][2][3];
+  double rcLJmin[2][2],rcLJmax[2][2],bLJmin[2][2],bLJmax[2][2];
+  double sigma[2][2],epsilonT[2][2];
+
+  double cutljsq[2][2],lj1[2][2],lj2[2][2],lj3[2][2],lj4[2][2];
+  double cut3rebo,sigcut,sigmin;
+
+  double gCdom[5],gC1[4][6],gC2[4][6],gHdom[4],gH[3][6];
+  double pCCdom[2][2],pCHdom[2][2],pCC[4][4][16],pCH[4][4][16];
+  double piCCdom[3][2],piCHdom[3][2],piHHdom[3][2];
+  double piCC[4][4][9][64],piCH[4][4][9][64],piHH[4][4][9][64];
+  double Tijdom[3][2],Tijc[4][4][9][64];
+
+  double PCCf[5][5],PCCdfdx[5][5],PCCdfdy[5][5],PCHf[5][5];
+  double PCHdfdx[5][5],PCHdfdy[5][5];
+  double piCCf[5][5][11],piCCdfdx[5][5][11];
+  double piCCdfdy[5][5][11],piCCdfdz[5][5][11];
+  double piCHf[5][5][11],piCHdfdx[5][5][11];
+  double piCHdfdy[5][5][11],piCHdfdz[5][5][11];
+  double piHHf[5][5][11],piHHdfdx[5][5][11];
+  double piHHdfdy[5][5][11],piHHdfdz[5][5][11];
+  double Tf[5][5][10],Tdfdx[5][5][10],Tdfdy[5][5][10],Tdfdz[5][5][10];
+};
+
+template<class DeviceType>
+class PairAIREBOKokkos;
+
+// kernels of pair airebo/kk
+// PairAIREBO carries its spline tables as members and is too large to be
+//   copied into a kernel launch, the kernels live in this functor instead,
+//   which only holds views and flags
+
+template<class DeviceType>
+class PairAIREBOKokkosFunctor {
+ public:
+  typedef DeviceType device_type;
+  typedef ArrayTypes<DeviceType> AT;
+  typedef EV_FLOAT value_type;
+
+  PairAIREBOKokkosFunctor(PairAIREBOKokkos<DeviceType> *);
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagPairAIREBONeigh, const int &) const;
+
+  template<int NEIGHFLAG, int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagPairAIREBOFREBO<NEIGHFLAG,EVFLAG>,
+                  const int &, EV_FLOAT &) const;
+
+  template<int NEIGHFLAG, int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagPairAIREBOFREBO<NEIGHFLAG,EVFLAG>, const int &) const;
+
+  template<int NEIGHFLAG, int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagPairAIREBOFLJ<NEIGHFLAG,EVFLAG>,
+                  const int &, EV_FLOAT &) const;
+
+  template<int NEIGHFLAG, int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagPairAIREBOFLJ<NEIGHFLAG,EVFLAG>, const int &) const;
+
+  template<int NEIGHFLAG, int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagPairAIREBOTorsion<NEIGHFLAG,EVFLAG>,
+                  const int &, EV_FLOAT &) const;
+
+  template<int NEIGHFLAG, int EVFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagPairAIREBOTorsion<NEIGHFLAG,EVFLAG>, const int &) const;
+
+  typename AT::t_x_array_randomread x;
+  typename AT::t_f_array f;
+  typename AT::t_int_1d_randomread type;
+  typename AT::t_tagint_1d tag;
+  typename AT::t_efloat_1d d_eatom;
+  typename AT::t_virial_array d_vatom;
+
+  typename AT::t_neighbors_2d d_neighbors;
+  typename AT::t_int_1d_randomread d_ilist;
+  typename AT::t_int_1d_randomread d_numneigh;
+
+  // REBO neighbors of owned and ghost atoms, with wij and dwij of each pair
+
+  typename AT::t_int_1d d_REBO_numneigh;
+  typename AT::t_int_2d d_REBO_neighs;
+  typename AT::t_ffloat_2d d_REBO_w,d_REBO_dw;
+  typename AT::t_ffloat_1d d_nC,d_nH;
+  typename AT::t_int_scalar d_resize,d_new_maxneighs;
+
+  typename AT::t_int_1d d_map;
+  Kokkos::View<const params_airebo*,DeviceType> d_params;
+
+  int ljflag,torflag,morseflag;
+  int eflag,eflag_atom,vflag_atom;
+
+ private:
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  double bondorder(int, int, double *, double, double) const;
+
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  double bondorderLJ(int, int, double *, double, double,
+                     double *, double) const;
+
+  KOKKOS_INLINE_FUNCTION
+  double gSpline(double, double, int, double *, double *) const;
+
+  KOKKOS_INLINE_FUNCTION
+  double PijSpline(double, double, int, int, double *) const;
+
+  KOKKOS_INLINE_FUNCTION
+  double piRCSpline(double, double, double, int, int, double *) const;
+
+  KOKKOS_INLINE_FUNCTION
+  double TijSpline(double, double, double, double *) const;
+
+  KOKKOS_INLINE_FUNCTION
+  static double Sp5th(double, const double *, double *);
+
+  KOKKOS_INLINE_FUNCTION
+  static double Spbicubic(double, double, const double *, double *);
+
+  KOKKOS_INLINE_FUNCTION
+  static double Sptricubic(double, double, double, const double *, double *);
+
+  KOKKOS_INLINE_FUNCTION
+  static double Sp(double, double, double, double &);
+
+  KOKKOS_INLINE_FUNCTION
+  static double Sp2(double, double, double, double &);
+
+  KOKKOS_INLINE_FUNCTION
+  static double kronecker(const int, const int);
+
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void ev_tally(const int, const int, const double, const double,
+                const double, const double, const double) const;
+
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void ev_tally4(const int, const int, const int, const int, const double,
+                 double *, double *, double *,
+                 double *, double *, double *) const;
+
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void v_tally2(const int, const int, const double, double *) const;
+
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void v_tally3(const int, const int, const int,
+                double *, double *, double *, double *) const;
+
+  template<int NEIGHFLAG>
+  KOKKOS_INLINE_FUNCTION
+  void v_tally4(const int, const int, const int, const int,
+                double *, double *, double *,
+                double *, double *, double *) const;
+};
+
+template<class DeviceType>
+class PairAIREBOKokkos : public PairAIREBO {
+ public:
+  typedef DeviceType device_type;
+  typedef ArrayTypes<DeviceType> AT;
+  typedef EV_FLOAT value_type;
+
+  PairAIREBOKokkos(class LAMMPS *);
+  virtual ~PairAIREBOKokkos();
+  virtual void compute(int, int);
+  void coeff(int, char **);
+  void init_style();
+  double init_one(int, int);
+
+ protected:
+  typename AT::t_x_array x;
+  typename AT::t_f_array f;
+
+  DAT::tdual_efloat_1d k_eatom;
+  DAT::tdual_virial_array k_vatom;
+  typename AT::t_efloat_1d d_eatom;
+  typename AT::t_virial_array d_vatom;
+
+  typename AT::t_int_1d d_REBO_numneigh;
+  typename AT::t_int_2d d_REBO_neighs;
+  typename AT::t_ffloat_2d d_REBO_w,d_REBO_dw;
+  typename AT::t_ffloat_1d d_nC,d_nH;
+  typename AT::t_int_scalar d_resize,d_new_maxneighs;
+  int maxREBO;
+
+  DAT::tdual_int_1d k_map;
+  Kokkos::DualView<params_airebo*,DeviceType> k_params;
+
+  int neighflag;
+  int nlocal,nall,eflag,vflag;
+
+  void setup_params();
+
+  friend class PairAIREBOKokkosFunctor<DeviceType>;
+  friend void pair_virial_fdotr_compute<PairAIREBOKokkos>(PairAIREBOKokkos*);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Cannot use chosen neighbor list style with pair airebo/kk
+
+Self-explanatory.
+
+*/
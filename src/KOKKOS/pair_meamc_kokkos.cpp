@@ -0,0 +1,328 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "kokkos.h"
+#include "pair_kokkos.h"
+#include "pair_meamc_kokkos.h"
+#include "meam_kokkos.h"
+#include "atom_kokkos.h"
+#include "force.h"
+#include "comm.h"
+#include "neighbor.h"
+#include "neigh_list_kokkos.h"
+#include "neigh_request.h"
+#include "memory_kokkos.h"
+#include "error.h"
+#include "atom_masks.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+PairMEAMCKokkos<DeviceType>::PairMEAMCKokkos(LAMMPS *lmp) : PairMEAMC(lmp)
+{
+  respa_enable = 0;
+
+  atomKK = (AtomKokkos *) atom;
+  execution_space = ExecutionSpaceFromDevice<DeviceType>::space;
+  datamask_read = X_MASK | F_MASK | TYPE_MASK | ENERGY_MASK | VIRIAL_MASK;
+  datamask_modify = F_MASK | ENERGY_MASK | VIRIAL_MASK;
+
+  // replace the MEAM library instance of the parent class
+
+  delete meam_inst;
+  meam_inst_kk = new MEAMKokkos<DeviceType>(memory);
+  meam_inst = meam_inst_kk;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+PairMEAMCKokkos<DeviceType>::~PairMEAMCKokkos()
+{
+  if (!copymode) {
+    memoryKK->destroy_kokkos(k_eatom,eatom);
+    memoryKK->destroy_kokkos(k_vatom,vatom);
+    delete meam_inst_kk;
+    meam_inst = NULL;
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void PairMEAMCKokkos<DeviceType>::compute(int eflag_in, int vflag_in)
+{
+  eflag = eflag_in;
+  vflag = vflag_in;
+
+  if (eflag || vflag) ev_setup(eflag,vflag,0);
+  else evflag = vflag_fdotr = eflag_global = vflag_global =
+         eflag_atom = vflag_atom = 0;
+
+  // reallocate per-atom arrays if necessary
+
+  if (eflag_atom) {
+    memoryKK->destroy_kokkos(k_eatom,eatom);
+    memoryKK->create_kokkos(k_eatom,eatom,maxeatom,"pair:eatom");
+    d_eatom = k_eatom.view<DeviceType>();
+  }
+  if (vflag_atom) {
+    memoryKK->destroy_kokkos(k_vatom,vatom);
+    memoryKK->create_kokkos(k_vatom,vatom,maxvatom,6,"pair:vatom");
+    d_vatom = k_vatom.view<DeviceType>();
+  }
+
+  atomKK->sync(execution_space,datamask_read);
+  if (eflag || vflag) atomKK->modified(execution_space,datamask_modify);
+  else atomKK->modified(execution_space,F_MASK);
+
+  x = atomKK->k_x.view<DeviceType>();
+  f = atomKK->k_f.view<DeviceType>();
+  type = atomKK->k_type.view<DeviceType>();
+  nlocal = atom->nlocal;
+  nall = atom->nlocal + atom->nghost;
+
+  NeighListKokkos<DeviceType>* k_halflist =
+    static_cast<NeighListKokkos<DeviceType>*>(listhalf);
+  NeighListKokkos<DeviceType>* k_fulllist =
+    static_cast<NeighListKokkos<DeviceType>*>(listfull);
+  int inum_half = listhalf->inum;
+
+  // per-pair screening arrays follow the shape of the half neighbor list
+
+  meam_inst_kk->meam_dens_setup(atom->nmax,nall,
+                                k_halflist->d_neighbors.dimension_0(),
+                                k_halflist->d_neighbors.dimension_1());
+
+  // 3 stages of MEAM calculation
+  // loop over my atoms followed by communication
+
+  meam_inst_kk->meam_dens_init(inum_half,neighflag,x,type,
+                               k_halflist,k_fulllist);
+
+  // communicate and sum densities (on the host)
+
+  meam_inst_kk->dens_to_host();
+  comm->reverse_comm_pair(this);
+  meam_inst_kk->dens_to_device();
+
+  int errorflag = 0;
+  meam_inst_kk->meam_dens_final(nlocal,eflag_either,eflag_global,eflag_atom,
+                                eng_vdwl,d_eatom,errorflag);
+  if (errorflag) {
+    char str[128];
+    sprintf(str,"MEAM library error %d",errorflag);
+    error->one(FLERR,str);
+  }
+
+  comm->forward_comm_pair(this);
+
+  meam_inst_kk->meam_force(inum_half,neighflag,eflag_either,eflag_global,
+                           eflag_atom,vflag_atom,eng_vdwl,f,d_eatom,d_vatom);
+
+  if (vflag_fdotr) pair_virial_fdotr_compute(this);
+
+  if (eflag_atom) {
+    k_eatom.template modify<DeviceType>();
+    k_eatom.template sync<LMPHostType>();
+  }
+
+  if (vflag_atom) {
+    k_vatom.template modify<DeviceType>();
+    k_vatom.template sync<LMPHostType>();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   set coeffs, then copy the element map and pair splines to the device
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void PairMEAMCKokkos<DeviceType>::coeff(int narg, char **arg)
+{
+  PairMEAMC::coeff(narg,arg);
+  meam_inst_kk->meam_setup_done_kokkos(atom->ntypes,map);
+}
+
+/* ----------------------------------------------------------------------
+   init specific to this pair style
+------------------------------------------------------------------------- */
+
+template<class DeviceType>
+void PairMEAMCKokkos<DeviceType>::init_style()
+{
+  PairMEAMC::init_style();
+
+  // irequest = full and half neigh requests made by parent class
+
+  neighflag = lmp->kokkos->neighflag;
+
+  for (int irequest = neighbor->nrequest - 2;
+       irequest < neighbor->nrequest; irequest++) {
+    neighbor->requests[irequest]->
+      kokkos_host = Kokkos::Impl::is_same<DeviceType,LMPHostType>::value &&
+      !Kokkos::Impl::is_same<DeviceType,LMPDeviceType>::value;
+    neighbor->requests[irequest]->
+      kokkos_device = Kokkos::Impl::is_same<DeviceType,LMPDeviceType>::value;
+  }
+
+  if (neighflag == FULL)
+    error->all(FLERR,"Cannot use full neighbor list style with pair meam/c/kk");
+  else if (neighflag != HALF && neighflag != HALFTHREAD)
+    error->all(FLERR,"Cannot use chosen neighbor list style with pair meam/c/kk");
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+int PairMEAMCKokkos<DeviceType>::
+pack_forward_comm_kokkos(int n, DAT::tdual_int_2d k_sendlist, int iswap_in,
+                         DAT::tdual_xfloat_1d &buf, int pbc_flag, int *pbc)
+{
+  return meam_inst_kk->pack_forward_comm_kokkos(n,k_sendlist,iswap_in,buf);
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void PairMEAMCKokkos<DeviceType>::
+unpack_forward_comm_kokkos(int n, int first_in, DAT::tdual_xfloat_1d &buf)
+{
+  meam_inst_kk->unpack_forward_comm_kokkos(n,first_in,buf);
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+int PairMEAMCKokkos<DeviceType>::pack_forward_comm(int n, int *list,
+                                                   double *buf,
+                                                   int pbc_flag, int *pbc)
+{
+  MEAMKokkos<DeviceType> *mk = meam_inst_kk;
+  int i,j,k,m;
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    buf[m++] = mk->k_rho0.h_view[j];
+    buf[m++] = mk->k_rho1.h_view[j];
+    buf[m++] = mk->k_rho2.h_view[j];
+    buf[m++] = mk->k_rho3.h_view[j];
+    buf[m++] = mk->k_frhop.h_view[j];
+    buf[m++] = mk->k_gamma.h_view[j];
+    buf[m++] = mk->k_dgamma1.h_view[j];
+    buf[m++] = mk->k_dgamma2.h_view[j];
+    buf[m++] = mk->k_dgamma3.h_view[j];
+    buf[m++] = mk->k_arho2b.h_view[j];
+    for (k = 0; k < 3; k++) buf[m++] = mk->k_arho1.h_view(j,k);
+    for (k = 0; k < 6; k++) buf[m++] = mk->k_arho2.h_view(j,k);
+    for (k = 0; k < 10; k++) buf[m++] = mk->k_arho3.h_view(j,k);
+    for (k = 0; k < 3; k++) buf[m++] = mk->k_arho3b.h_view(j,k);
+    for (k = 0; k < 3; k++) buf[m++] = mk->k_t_ave.h_view(j,k);
+    for (k = 0; k < 3; k++) buf[m++] = mk->k_tsq_ave.h_view(j,k);
+  }
+
+  return m;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void PairMEAMCKokkos<DeviceType>::unpack_forward_comm(int n, int first,
+                                                      double *buf)
+{
+  MEAMKokkos<DeviceType> *mk = meam_inst_kk;
+  int i,k,m,last;
+
+  m = 0;
+  last = first + n;
+  for (i = first; i < last; i++) {
+    mk->k_rho0.h_view[i] = buf[m++];
+    mk->k_rho1.h_view[i] = buf[m++];
+    mk->k_rho2.h_view[i] = buf[m++];
+    mk->k_rho3.h_view[i] = buf[m++];
+    mk->k_frhop.h_view[i] = buf[m++];
+    mk->k_gamma.h_view[i] = buf[m++];
+    mk->k_dgamma1.h_view[i] = buf[m++];
+    mk->k_dgamma2.h_view[i] = buf[m++];
+    mk->k_dgamma3.h_view[i] = buf[m++];
+    mk->k_arho2b.h_view[i] = buf[m++];
+    for (k = 0; k < 3; k++) mk->k_arho1.h_view(i,k) = buf[m++];
+    for (k = 0; k < 6; k++) mk->k_arho2.h_view(i,k) = buf[m++];
+    for (k = 0; k < 10; k++) mk->k_arho3.h_view(i,k) = buf[m++];
+    for (k = 0; k < 3; k++) mk->k_arho3b.h_view(i,k) = buf[m++];
+    for (k = 0; k < 3; k++) mk->k_t_ave.h_view(i,k) = buf[m++];
+    for (k = 0; k < 3; k++) mk->k_tsq_ave.h_view(i,k) = buf[m++];
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+int PairMEAMCKokkos<DeviceType>::pack_reverse_comm(int n, int first,
+                                                   double *buf)
+{
+  MEAMKokkos<DeviceType> *mk = meam_inst_kk;
+  int i,k,m,last;
+
+  m = 0;
+  last = first + n;
+  for (i = first; i < last; i++) {
+    buf[m++] = mk->k_rho0.h_view[i];
+    buf[m++] = mk->k_arho2b.h_view[i];
+    for (k = 0; k < 3; k++) buf[m++] = mk->k_arho1.h_view(i,k);
+    for (k = 0; k < 6; k++) buf[m++] = mk->k_arho2.h_view(i,k);
+    for (k = 0; k < 10; k++) buf[m++] = mk->k_arho3.h_view(i,k);
+    for (k = 0; k < 3; k++) buf[m++] = mk->k_arho3b.h_view(i,k);
+    for (k = 0; k < 3; k++) buf[m++] = mk->k_t_ave.h_view(i,k);
+    for (k = 0; k < 3; k++) buf[m++] = mk->k_tsq_ave.h_view(i,k);
+  }
+
+  return m;
+}
+
+/* ---------------------------------------------------------------------- */
+
+template<class DeviceType>
+void PairMEAMCKokkos<DeviceType>::unpack_reverse_comm(int n, int *list,
+                                                      double *buf)
+{
+  MEAMKokkos<DeviceType> *mk = meam_inst_kk;
+  int i,j,k,m;
+
+  m = 0;
+  for (i = 0; i < n; i++) {
+    j = list[i];
+    mk->k_rho0.h_view[j] += buf[m++];
+    mk->k_arho2b.h_view[j] += buf[m++];
+    for (k = 0; k < 3; k++) mk->k_arho1.h_view(j,k) += buf[m++];
+    for (k = 0; k < 6; k++) mk->k_arho2.h_view(j,k) += buf[m++];
+    for (k = 0; k < 10; k++) mk->k_arho3.h_view(j,k) += buf[m++];
+    for (k = 0; k < 3; k++) mk->k_arho3b.h_view(j,k) += buf[m++];
+    for (k = 0; k < 3; k++) mk->k_t_ave.h_view(j,k) += buf[m++];
+    for (k = 0; k < 3; k++) mk->k_tsq_ave.h_view(j,k) += buf[m++];
+  }
+}
+
+namespace LAMMPS_NS {
+template class PairMEAMCKokkos<LMPDeviceType>;
+#ifdef KOKKOS_HAVE_CUDA
+template class PairMEAMCKokkos<LMPHostType>;
+#endif
+}
@@ -0,0 +1,94 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(meam/c/kk,PairMEAMCKokkos<LMPDeviceType>)
+PairStyle(meam/c/kk/device,PairMEAMCKokkos<LMPDeviceType>)
+PairStyle(meam/c/kk/host,PairMEAMCKokkos<LMPHostType>)
+
+#else
+
+#ifndef LMP_PAIR_MEAMC_KOKKOS_H
+#define LMP_PAIR_MEAMC_KOKKOS_H
+
+#include "kokkos_base.h"
+#include "pair_kokkos.h"
+#include "pair_meamc.h"
+#include "meam_kokkos.h"
+#include "neigh_list_kokkos.h"
+
+namespace LAMMPS_NS {
+
+template<class DeviceType>
+class PairMEAMCKokkos : public PairMEAMC, public KokkosBase {
+ public:
+  enum {EnabledNeighFlags=HALFTHREAD|HALF};
+  enum {COUL_FLAG=0};
+  typedef DeviceType device_type;
+  typedef ArrayTypes<DeviceType> AT;
+  typedef EV_FLOAT value_type;
+
+  PairMEAMCKokkos(class LAMMPS *);
+  virtual ~PairMEAMCKokkos();
+  void compute(int, int);
+  void coeff(int, char **);
+  void init_style();
+
+  int pack_forward_comm_kokkos(int, DAT::tdual_int_2d, int,
+                               DAT::tdual_xfloat_1d&, int, int *);
+  void unpack_forward_comm_kokkos(int, int, DAT::tdual_xfloat_1d&);
+  int pack_forward_comm(int, int *, double *, int, int *);
+  void unpack_forward_comm(int, int, double *);
+  int pack_reverse_comm(int, int, double *);
+  void unpack_reverse_comm(int, int *, double *);
+
+ protected:
+  class MEAMKokkos<DeviceType> *meam_inst_kk;
+
+  typename AT::t_x_array_randomread x;
+  typename AT::t_f_array f;
+  typename AT::t_int_1d_randomread type;
+
+  DAT::tdual_efloat_1d k_eatom;
+  DAT::tdual_virial_array k_vatom;
+  typename AT::t_efloat_1d d_eatom;
+  typename AT::t_virial_array d_vatom;
+
+  int neighflag,nlocal,nall,eflag,vflag;
+
+  friend void pair_virial_fdotr_compute<PairMEAMCKokkos>(PairMEAMCKokkos*);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Cannot use full neighbor list style with pair meam/c/kk
+
+The MEAM screening and density kernels are written for the half
+neighbor list with newton on, use the "neigh half" option of the
+"package kokkos"_package.html command.
+
+E: Cannot use chosen neighbor list style with pair meam/c/kk
+
+That style is not supported by Kokkos.
+
+E: MEAM library error %d
+
+A call to the MEAM library returned an error.
+
+*/
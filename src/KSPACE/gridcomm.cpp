@@ -20,7 +20,7 @@
 
 using namespace LAMMPS_NS;
 
-#define SWAPDELTA 8
+#define NEIGHDELTA 8
 
 /* ---------------------------------------------------------------------- */
 
@@ -32,6 +32,7 @@ GridComm::GridComm(LAMMPS *lmp, MPI_Comm gcomm, int forward, int reverse,
 {
   gridcomm = gcomm;
   MPI_Comm_rank(gridcomm,&me);
+  MPI_Comm_size(gridcomm,&nprocs);
 
   nforward = forward;
   nreverse = reverse;
@@ -64,8 +65,11 @@ GridComm::GridComm(LAMMPS *lmp, MPI_Comm gcomm, int forward, int reverse,
   proczlo = pzlo;
   proczhi = pzhi;
 
-  nswap = 0;
-  swap = NULL;
+  nneigh = 0;
+  neigh = NULL;
+  self = -1;
+  recvrequest = sendrequest = NULL;
+  nbuf = 0;
   buf1 = buf2 = NULL;
 }
 
@@ -81,6 +85,7 @@ GridComm::GridComm(LAMMPS *lmp, MPI_Comm gcomm, int forward, int reverse,
 {
   gridcomm = gcomm;
   MPI_Comm_rank(gridcomm,&me);
+  MPI_Comm_size(gridcomm,&nprocs);
 
   nforward = forward;
   nreverse = reverse;
@@ -113,8 +118,11 @@ GridComm::GridComm(LAMMPS *lmp, MPI_Comm gcomm, int forward, int reverse,
   proczlo = pzlo;
   proczhi = pzhi;
 
-  nswap = 0;
-  swap = NULL;
+  nneigh = 0;
+  neigh = NULL;
+  self = -1;
+  recvrequest = sendrequest = NULL;
+  nbuf = 0;
   buf1 = buf2 = NULL;
 }
 
@@ -122,11 +130,13 @@ GridComm::GridComm(LAMMPS *lmp, MPI_Comm gcomm, int forward, int reverse,
 
 GridComm::~GridComm()
 {
-  for (int i = 0; i < nswap; i++) {
-    memory->destroy(swap[i].packlist);
-    memory->destroy(swap[i].unpacklist);
+  for (int i = 0; i < nneigh; i++) {
+    memory->destroy(neigh[i].ownlist);
+    memory->destroy(neigh[i].ghostlist);
   }
-  memory->sfree(swap);
+  memory->sfree(neigh);
+  memory->sfree(recvrequest);
+  memory->sfree(sendrequest);
 
   memory->destroy(buf1);
   memory->destroy(buf2);
@@ -202,359 +212,254 @@ int GridComm::ghost_overlap()
 }
 
 /* ----------------------------------------------------------------------
-   create swap stencil for grid own/ghost communication
-   swaps covers all 3 dimensions and both directions
-   swaps cover multiple iterations in a direction if need grid pts
-     from further away than nearest-neighbor proc
-   same swap list used by forward and reverse communication
+   create list of neighbor procs for grid own/ghost communication
+   every proc knows the owned and ghost extents of all procs,
+     so it finds the procs that own its ghost grid pts
+     and the procs that have its owned grid pts as ghosts without
+     further communication, both sides list the pts in the same order
+   the global grid is the bounding box of all owned grid pts,
+     ghost grid pts outside of it are its periodic images,
+     this gives the same values as passing planes from neighbor to neighbor
+   grid pts from further away than nearest-neighbor procs
+     are exchanged directly with the proc that owns them
+   same lists used by forward and reverse communication
 ------------------------------------------------------------------------- */
 
 void GridComm::setup()
 {
-  int nsent,sendfirst,sendlast,recvfirst,recvlast;
-  int sendplanes,recvplanes;
-  int notdoneme,notdone;
-
-  int maxswap = 6;
-  swap = (Swap *) memory->smalloc(maxswap*sizeof(Swap),"Commgrid:swap");
-  nswap = 0;
-
-  // send own grid pts to -x processor, recv ghost grid pts from +x processor
-
-  nsent = 0;
-  sendfirst = inxlo;
-  sendlast = inxhi;
-  recvfirst = inxhi+1;
-  notdone = 1;
-
-  while (notdone) {
-    if (nswap == maxswap) {
-      maxswap += SWAPDELTA;
-      swap = (Swap *)
-        memory->srealloc(swap,maxswap*sizeof(Swap),"Commgrid:swap");
-    }
+  int i,p;
 
-    swap[nswap].sendproc = procxlo;
-    swap[nswap].recvproc = procxhi;
-    sendplanes = MIN(sendlast-sendfirst+1,ghostxlo-nsent);
-    swap[nswap].npack =
-      indices(swap[nswap].packlist,
-              sendfirst,sendfirst+sendplanes-1,inylo,inyhi,inzlo,inzhi);
-
-    if (procxlo != me)
-      MPI_Sendrecv(&sendplanes,1,MPI_INT,procxlo,0,
-                   &recvplanes,1,MPI_INT,procxhi,0,gridcomm,MPI_STATUS_IGNORE);
-    else recvplanes = sendplanes;
-
-    swap[nswap].nunpack =
-      indices(swap[nswap].unpacklist,
-              recvfirst,recvfirst+recvplanes-1,inylo,inyhi,inzlo,inzhi);
-
-    nsent += sendplanes;
-    sendfirst += sendplanes;
-    sendlast += recvplanes;
-    recvfirst += recvplanes;
-    nswap++;
-
-    if (nsent < ghostxlo) notdoneme = 1;
-    else notdoneme = 0;
-    MPI_Allreduce(&notdoneme,&notdone,1,MPI_INT,MPI_SUM,gridcomm);
-  }
-
-  // send own grid pts to +x processor, recv ghost grid pts from -x processor
+  int **extent;
+  memory->create(extent,nprocs,12,"Commgrid:extent");
 
-  nsent = 0;
-  sendfirst = inxlo;
-  sendlast = inxhi;
-  recvlast = inxlo-1;
-  notdone = 1;
+  int myextent[12] = {inxlo,inxhi,inylo,inyhi,inzlo,inzhi,
+                      outxlo,outxhi,outylo,outyhi,outzlo,outzhi};
+  MPI_Allgather(myextent,12,MPI_INT,&extent[0][0],12,MPI_INT,gridcomm);
 
-  while (notdone) {
-    if (nswap == maxswap) {
-      maxswap += 1;
-      swap = (Swap *)
-        memory->srealloc(swap,maxswap*sizeof(Swap),"Commgrid:swap");
-    }
-
-    swap[nswap].sendproc = procxhi;
-    swap[nswap].recvproc = procxlo;
-    sendplanes = MIN(sendlast-sendfirst+1,ghostxhi-nsent);
-    swap[nswap].npack =
-      indices(swap[nswap].packlist,
-              sendlast-sendplanes+1,sendlast,inylo,inyhi,inzlo,inzhi);
-
-    if (procxhi != me)
-      MPI_Sendrecv(&sendplanes,1,MPI_INT,procxhi,0,
-                   &recvplanes,1,MPI_INT,procxlo,0,gridcomm,MPI_STATUS_IGNORE);
-    else recvplanes = sendplanes;
-
-    swap[nswap].nunpack =
-      indices(swap[nswap].unpacklist,
-              recvlast-recvplanes+1,recvlast,inylo,inyhi,inzlo,inzhi);
-
-    nsent += sendplanes;
-    sendfirst -= recvplanes;
-    sendlast -= sendplanes;
-    recvlast -= recvplanes;
-    nswap++;
-
-    if (nsent < ghostxhi) notdoneme = 1;
-    else notdoneme = 0;
-    MPI_Allreduce(&notdoneme,&notdone,1,MPI_INT,MPI_SUM,gridcomm);
+  int lo[3],hi[3];
+  for (i = 0; i < 3; i++) {
+    lo[i] = extent[me][2*i];
+    hi[i] = extent[me][2*i+1];
   }
-
-  // send own grid pts to -y processor, recv ghost grid pts from +y processor
-
-  nsent = 0;
-  sendfirst = inylo;
-  sendlast = inyhi;
-  recvfirst = inyhi+1;
-  notdone = 1;
-
-  while (notdone) {
-    if (nswap == maxswap) {
-      maxswap += SWAPDELTA;
-      swap = (Swap *)
-        memory->srealloc(swap,maxswap*sizeof(Swap),"Commgrid:swap");
+  for (p = 0; p < nprocs; p++) {
+    if (extent[p][1] < extent[p][0] || extent[p][3] < extent[p][2] ||
+        extent[p][5] < extent[p][4]) continue;
+    for (i = 0; i < 3; i++) {
+      lo[i] = MIN(lo[i],extent[p][2*i]);
+      hi[i] = MAX(hi[i],extent[p][2*i+1]);
     }
-
-    swap[nswap].sendproc = procylo;
-    swap[nswap].recvproc = procyhi;
-    sendplanes = MIN(sendlast-sendfirst+1,ghostylo-nsent);
-    swap[nswap].npack =
-      indices(swap[nswap].packlist,
-              outxlo,outxhi,sendfirst,sendfirst+sendplanes-1,inzlo,inzhi);
-
-    if (procylo != me)
-      MPI_Sendrecv(&sendplanes,1,MPI_INT,procylo,0,
-                   &recvplanes,1,MPI_INT,procyhi,0,gridcomm,MPI_STATUS_IGNORE);
-    else recvplanes = sendplanes;
-
-    swap[nswap].nunpack =
-      indices(swap[nswap].unpacklist,
-              outxlo,outxhi,recvfirst,recvfirst+recvplanes-1,inzlo,inzhi);
-
-    nsent += sendplanes;
-    sendfirst += sendplanes;
-    sendlast += recvplanes;
-    recvfirst += recvplanes;
-    nswap++;
-
-    if (nsent < ghostylo) notdoneme = 1;
-    else notdoneme = 0;
-    MPI_Allreduce(&notdoneme,&notdone,1,MPI_INT,MPI_SUM,gridcomm);
   }
+  for (i = 0; i < 3; i++) period[i] = hi[i]-lo[i]+1;
 
-  // send own grid pts to +y processor, recv ghost grid pts from -y processor
+  // ghost pts of mine owned by proc p and owned pts of mine that p needs
+  // both are empty for most procs
 
-  nsent = 0;
-  sendfirst = inylo;
-  sendlast = inyhi;
-  recvlast = inylo-1;
-  notdone = 1;
+  int maxneigh = 0;
+  int *ownlist,*ghostlist;
 
-  while (notdone) {
-    if (nswap == maxswap) {
-      maxswap += 1;
-      swap = (Swap *)
-        memory->srealloc(swap,maxswap*sizeof(Swap),"Commgrid:swap");
-    }
-
-    swap[nswap].sendproc = procyhi;
-    swap[nswap].recvproc = procylo;
-    sendplanes = MIN(sendlast-sendfirst+1,ghostyhi-nsent);
-    swap[nswap].npack =
-      indices(swap[nswap].packlist,
-              outxlo,outxhi,sendlast-sendplanes+1,sendlast,inzlo,inzhi);
-
-    if (procyhi != me)
-      MPI_Sendrecv(&sendplanes,1,MPI_INT,procyhi,0,
-                   &recvplanes,1,MPI_INT,procylo,0,gridcomm,MPI_STATUS_IGNORE);
-    else recvplanes = sendplanes;
-
-    swap[nswap].nunpack =
-      indices(swap[nswap].unpacklist,
-              outxlo,outxhi,recvlast-recvplanes+1,recvlast,inzlo,inzhi);
-
-    nsent += sendplanes;
-    sendfirst -= recvplanes;
-    sendlast -= sendplanes;
-    recvlast -= recvplanes;
-    nswap++;
-
-    if (nsent < ghostyhi) notdoneme = 1;
-    else notdoneme = 0;
-    MPI_Allreduce(&notdoneme,&notdone,1,MPI_INT,MPI_SUM,gridcomm);
-  }
-
-  // send own grid pts to -z processor, recv ghost grid pts from +z processor
-
-  nsent = 0;
-  sendfirst = inzlo;
-  sendlast = inzhi;
-  recvfirst = inzhi+1;
-  notdone = 1;
+  for (p = 0; p < nprocs; p++) {
+    int ngh = overlap(ghostlist,&extent[me][6],&extent[p][0],p == me,1);
+    int nown = overlap(ownlist,&extent[me][0],&extent[p][6],p == me,-1);
+    if (ngh == 0 && nown == 0) continue;
 
-  while (notdone) {
-    if (nswap == maxswap) {
-      maxswap += SWAPDELTA;
-      swap = (Swap *)
-        memory->srealloc(swap,maxswap*sizeof(Swap),"Commgrid:swap");
+    if (nneigh == maxneigh) {
+      maxneigh += NEIGHDELTA;
+      neigh = (Neighbor *)
+        memory->srealloc(neigh,maxneigh*sizeof(Neighbor),"Commgrid:neigh");
     }
 
-    swap[nswap].sendproc = proczlo;
-    swap[nswap].recvproc = proczhi;
-    sendplanes = MIN(sendlast-sendfirst+1,ghostzlo-nsent);
-    swap[nswap].npack =
-      indices(swap[nswap].packlist,
-              outxlo,outxhi,outylo,outyhi,sendfirst,sendfirst+sendplanes-1);
-
-    if (proczlo != me)
-      MPI_Sendrecv(&sendplanes,1,MPI_INT,proczlo,0,
-                   &recvplanes,1,MPI_INT,proczhi,0,gridcomm,MPI_STATUS_IGNORE);
-    else recvplanes = sendplanes;
-
-    swap[nswap].nunpack =
-      indices(swap[nswap].unpacklist,
-              outxlo,outxhi,outylo,outyhi,recvfirst,recvfirst+recvplanes-1);
-
-    nsent += sendplanes;
-    sendfirst += sendplanes;
-    sendlast += recvplanes;
-    recvfirst += recvplanes;
-    nswap++;
-
-    if (nsent < ghostzlo) notdoneme = 1;
-    else notdoneme = 0;
-    MPI_Allreduce(&notdoneme,&notdone,1,MPI_INT,MPI_SUM,gridcomm);
+    if (p == me) self = nneigh;
+    neigh[nneigh].proc = p;
+    neigh[nneigh].nown = nown;
+    neigh[nneigh].nghost = ngh;
+    neigh[nneigh].ownlist = ownlist;
+    neigh[nneigh].ghostlist = ghostlist;
+    nneigh++;
   }
 
-  // send own grid pts to +z processor, recv ghost grid pts from -z processor
+  memory->destroy(extent);
 
-  nsent = 0;
-  sendfirst = inzlo;
-  sendlast = inzhi;
-  recvlast = inzlo-1;
-  notdone = 1;
+  // each neighbor proc has its own section of the send and recv buf
+  // nbuf = max of all forward/reverse pack/unpack
 
-  while (notdone) {
-    if (nswap == maxswap) {
-      maxswap += 1;
-      swap = (Swap *)
-        memory->srealloc(swap,maxswap*sizeof(Swap),"Commgrid:swap");
-    }
-
-    swap[nswap].sendproc = proczhi;
-    swap[nswap].recvproc = proczlo;
-    sendplanes = MIN(sendlast-sendfirst+1,ghostzhi-nsent);
-    swap[nswap].npack =
-      indices(swap[nswap].packlist,
-              outxlo,outxhi,outylo,outyhi,sendlast-sendplanes+1,sendlast);
-
-    if (proczhi != me)
-      MPI_Sendrecv(&sendplanes,1,MPI_INT,proczhi,0,
-                   &recvplanes,1,MPI_INT,proczlo,0,gridcomm,MPI_STATUS_IGNORE);
-    else recvplanes = sendplanes;
-
-    swap[nswap].nunpack =
-      indices(swap[nswap].unpacklist,
-              outxlo,outxhi,outylo,outyhi,recvlast-recvplanes+1,recvlast);
-
-    nsent += sendplanes;
-    sendfirst -= recvplanes;
-    sendlast -= sendplanes;
-    recvlast -= recvplanes;
-    nswap++;
-
-    if (nsent < ghostzhi) notdoneme = 1;
-    else notdoneme = 0;
-    MPI_Allreduce(&notdoneme,&notdone,1,MPI_INT,MPI_SUM,gridcomm);
+  int nown = 0;
+  int nghost = 0;
+  for (i = 0; i < nneigh; i++) {
+    neigh[i].ownoffset = nown;
+    neigh[i].ghostoffset = nghost;
+    nown += neigh[i].nown;
+    nghost += neigh[i].nghost;
   }
 
-  // nbuf = max of any forward/reverse pack/unpack
-
-  nbuf = 0;
-  for (int i = 0; i < nswap; i++) {
-    nbuf = MAX(nbuf,swap[i].npack);
-    nbuf = MAX(nbuf,swap[i].nunpack);
-  }
-  nbuf *= MAX(nforward,nreverse);
+  nbuf = MAX(nown,nghost) * MAX(nforward,nreverse);
   memory->create(buf1,nbuf,"Commgrid:buf1");
   memory->create(buf2,nbuf,"Commgrid:buf2");
+
+  recvrequest = (MPI_Request *)
+    memory->smalloc(MAX(nneigh,1)*sizeof(MPI_Request),"Commgrid:recvrequest");
+  sendrequest = (MPI_Request *)
+    memory->smalloc(MAX(nneigh,1)*sizeof(MPI_Request),"Commgrid:sendrequest");
 }
 
 /* ----------------------------------------------------------------------
-   use swap list in forward order to acquire copy of all needed ghost grid pts
+   send my owned grid pts to all procs that have them as ghosts
+   in one message per proc, all messages are in flight together
+   each message is unpacked as soon as it arrives
 ------------------------------------------------------------------------- */
 
 void GridComm::forward_comm(KSpace *kspace, int which)
 {
-  for (int m = 0; m < nswap; m++) {
-    if (swap[m].sendproc == me)
-      kspace->pack_forward(which,buf2,swap[m].npack,swap[m].packlist);
-    else
-      kspace->pack_forward(which,buf1,swap[m].npack,swap[m].packlist);
-
-    if (swap[m].sendproc != me) {
-      MPI_Irecv(buf2,nforward*swap[m].nunpack,MPI_FFT_SCALAR,
-                swap[m].recvproc,0,gridcomm,&request);
-      MPI_Send(buf1,nforward*swap[m].npack,MPI_FFT_SCALAR,
-               swap[m].sendproc,0,gridcomm);
-      MPI_Wait(&request,MPI_STATUS_IGNORE);
-    }
+  int i,m,nrecv,nsend;
+
+  nrecv = 0;
+  for (i = 0; i < nneigh; i++) {
+    recvrequest[i] = MPI_REQUEST_NULL;
+    if (i == self || neigh[i].nghost == 0) continue;
+    MPI_Irecv(&buf2[nforward*neigh[i].ghostoffset],nforward*neigh[i].nghost,
+              MPI_FFT_SCALAR,neigh[i].proc,0,gridcomm,&recvrequest[i]);
+    nrecv++;
+  }
 
-    kspace->unpack_forward(which,buf2,swap[m].nunpack,swap[m].unpacklist);
+  nsend = 0;
+  for (i = 0; i < nneigh; i++) {
+    if (neigh[i].nown == 0) continue;
+    FFT_SCALAR *buf = &buf1[nforward*neigh[i].ownoffset];
+    kspace->pack_forward(which,buf,neigh[i].nown,neigh[i].ownlist);
+    if (i == self) continue;
+    MPI_Isend(buf,nforward*neigh[i].nown,MPI_FFT_SCALAR,
+              neigh[i].proc,0,gridcomm,&sendrequest[nsend++]);
   }
+
+  // periodic images of my own grid pts
+
+  if (self >= 0 && neigh[self].nghost)
+    kspace->unpack_forward(which,&buf1[nforward*neigh[self].ownoffset],
+                           neigh[self].nghost,neigh[self].ghostlist);
+
+  while (nrecv--) {
+    MPI_Waitany(nneigh,recvrequest,&m,MPI_STATUS_IGNORE);
+    kspace->unpack_forward(which,&buf2[nforward*neigh[m].ghostoffset],
+                           neigh[m].nghost,neigh[m].ghostlist);
+  }
+
+  if (nsend) MPI_Waitall(nsend,sendrequest,MPI_STATUS_IGNORE);
 }
 
 /* ----------------------------------------------------------------------
-   use swap list in reverse order to compute fully summed value
-   for each owned grid pt that some other proc has copy of as a ghost grid pt
+   send my ghost grid pts to the procs that own them
+   in one message per proc, all messages are in flight together
+   each owner sums the contributions into its owned grid pts
 ------------------------------------------------------------------------- */
 
 void GridComm::reverse_comm(KSpace *kspace, int which)
 {
-  for (int m = nswap-1; m >= 0; m--) {
-    if (swap[m].recvproc == me)
-      kspace->pack_reverse(which,buf2,swap[m].nunpack,swap[m].unpacklist);
-    else
-      kspace->pack_reverse(which,buf1,swap[m].nunpack,swap[m].unpacklist);
-
-    if (swap[m].recvproc != me) {
-      MPI_Irecv(buf2,nreverse*swap[m].npack,MPI_FFT_SCALAR,
-                swap[m].sendproc,0,gridcomm,&request);
-      MPI_Send(buf1,nreverse*swap[m].nunpack,MPI_FFT_SCALAR,
-               swap[m].recvproc,0,gridcomm);
-      MPI_Wait(&request,MPI_STATUS_IGNORE);
-    }
+  int i,m,nrecv,nsend;
+
+  nrecv = 0;
+  for (i = 0; i < nneigh; i++) {
+    recvrequest[i] = MPI_REQUEST_NULL;
+    if (i == self || neigh[i].nown == 0) continue;
+    MPI_Irecv(&buf1[nreverse*neigh[i].ownoffset],nreverse*neigh[i].nown,
+              MPI_FFT_SCALAR,neigh[i].proc,0,gridcomm,&recvrequest[i]);
+    nrecv++;
+  }
 
-    kspace->unpack_reverse(which,buf2,swap[m].npack,swap[m].packlist);
+  nsend = 0;
+  for (i = 0; i < nneigh; i++) {
+    if (neigh[i].nghost == 0) continue;
+    FFT_SCALAR *buf = &buf2[nreverse*neigh[i].ghostoffset];
+    kspace->pack_reverse(which,buf,neigh[i].nghost,neigh[i].ghostlist);
+    if (i == self) continue;
+    MPI_Isend(buf,nreverse*neigh[i].nghost,MPI_FFT_SCALAR,
+              neigh[i].proc,0,gridcomm,&sendrequest[nsend++]);
   }
+
+  // periodic images of my own grid pts
+
+  if (self >= 0 && neigh[self].nown)
+    kspace->unpack_reverse(which,&buf2[nreverse*neigh[self].ghostoffset],
+                           neigh[self].nown,neigh[self].ownlist);
+
+  while (nrecv--) {
+    MPI_Waitany(nneigh,recvrequest,&m,MPI_STATUS_IGNORE);
+    kspace->unpack_reverse(which,&buf1[nreverse*neigh[m].ownoffset],
+                           neigh[m].nown,neigh[m].ownlist);
+  }
+
+  if (nsend) MPI_Waitall(nsend,sendrequest,MPI_STATUS_IGNORE);
 }
 
 /* ----------------------------------------------------------------------
-   create 1d list of offsets into 3d array section (xlo:xhi,ylo:yhi,zlo:zhi)
+   create 1d list of offsets into 3d array of all grid pts in box a
+     that are in box b or one of its periodic images b + sign*shift
+   a and b = inclusive lo/hi indices of each dim
+   skip b itself if flag self is set
+   images are visited in order of increasing shift for either sign,
+     so box pairs (a,b) and (b,a) with opposite sign list matching pts
    assume 3d array is allocated as (outxlo_max:outxhi_max,outylo_max:outyhi_max,
      outzlo_max:outzhi_max)
 ------------------------------------------------------------------------- */
 
-int GridComm::indices(int *&list,
-                       int xlo, int xhi, int ylo, int yhi, int zlo, int zhi)
+int GridComm::overlap(int *&list, int *a, int *b, int self, int sign)
 {
-  int nmax = (xhi-xlo+1) * (yhi-ylo+1) * (zhi-zlo+1);
-  memory->create(list,nmax,"Commgrid:list");
+  int i,ix,iy,iz,sx,sy,sz,pass;
+  int smin[3],smax[3],lo[3],hi[3];
+
+  list = NULL;
+  for (i = 0; i < 3; i++) {
+    if (a[2*i+1] < a[2*i] || b[2*i+1] < b[2*i]) return 0;
+    int d1 = a[2*i] - b[2*i+1];
+    int d2 = a[2*i+1] - b[2*i];
+    int tmin = (d1 > 0) ? (d1+period[i]-1)/period[i] : -((-d1)/period[i]);
+    int tmax = (d2 >= 0) ? d2/period[i] : -((-d2+period[i]-1)/period[i]);
+    if (tmin > tmax) return 0;
+    if (sign > 0) {
+      smin[i] = tmin;
+      smax[i] = tmax;
+    } else {
+      smin[i] = -tmax;
+      smax[i] = -tmin;
+    }
+  }
 
   int nx = (outxhi_max-outxlo_max+1);
   int ny = (outyhi_max-outylo_max+1);
 
+  // 1st pass counts pts, 2nd pass fills list
+
   int n = 0;
-  int ix,iy,iz;
-  for (iz = zlo; iz <= zhi; iz++)
-    for (iy = ylo; iy <= yhi; iy++)
-      for (ix = xlo; ix <= xhi; ix++)
-        list[n++] = (iz-outzlo_max)*ny*nx + (iy-outylo_max)*nx + (ix-outxlo_max);
+  for (pass = 0; pass < 2; pass++) {
+    if (pass == 1) {
+      if (n == 0) return 0;
+      memory->create(list,n,"Commgrid:list");
+      n = 0;
+    }
+
+    for (sz = smin[2]; sz <= smax[2]; sz++)
+      for (sy = smin[1]; sy <= smax[1]; sy++)
+        for (sx = smin[0]; sx <= smax[0]; sx++) {
+          if (self && sx == 0 && sy == 0 && sz == 0) continue;
+          int shift[3] = {sx,sy,sz};
+          for (i = 0; i < 3; i++) {
+            lo[i] = MAX(a[2*i],b[2*i] + sign*shift[i]*period[i]);
+            hi[i] = MIN(a[2*i+1],b[2*i+1] + sign*shift[i]*period[i]);
+          }
+          if (lo[0] > hi[0] || lo[1] > hi[1] || lo[2] > hi[2]) continue;
+
+          if (pass == 0) {
+            n += (hi[0]-lo[0]+1) * (hi[1]-lo[1]+1) * (hi[2]-lo[2]+1);
+            continue;
+          }
+
+          for (iz = lo[2]; iz <= hi[2]; iz++)
+            for (iy = lo[1]; iy <= hi[1]; iy++)
+              for (ix = lo[0]; ix <= hi[0]; ix++)
+                list[n++] = (iz-outzlo_max)*ny*nx + (iy-outylo_max)*nx +
+                  (ix-outxlo_max);
+        }
+  }
 
-  return nmax;
+  return n;
 }
 
 /* ----------------------------------------------------------------------
@@ -107,6 +107,7 @@ class PPPM : public KSpace {
 
   void set_grid_global();
   void set_grid_local();
+  void set_fft_local();
   void adjust_gewald();
   double newton_raphson_f();
   double derivf();
@@ -137,6 +138,17 @@ class PPPM : public KSpace {
   virtual void fieldforce_ik();
   virtual void fieldforce_ad();
 
+  // charge assignment and interpolation with compile-time stencil order
+  // loop over atoms in list, or over all owned atoms if list is NULL
+  // *_special() return 0 if order has no specialized loop
+
+  int make_rho_special(int *, int);
+  int fieldforce_ik_special(int *, int);
+  int fieldforce_ad_special(int *, int);
+  template <int ORDER> void make_rho_order(int *, int);
+  template <int ORDER> void fieldforce_ik_order(int *, int);
+  template <int ORDER> void fieldforce_ad_order(int *, int);
+
   virtual void poisson_peratom();
   virtual void fieldforce_peratom();
   void procs2grid2d(int,int,int,int *, int*);
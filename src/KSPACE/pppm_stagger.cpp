@@ -22,9 +22,11 @@
 #include <math.h>
 #include "pppm_stagger.h"
 #include "atom.h"
+#include "comm.h"
 #include "gridcomm.h"
 #include "force.h"
 #include "domain.h"
+#include "fft3d_wrap.h"
 #include "memory.h"
 #include "error.h"
 
@@ -38,8 +40,9 @@ using namespace MathSpecial;
 #define OFFSET 16384
 #define EPS_HOC 1.0e-7
 
-enum{REVERSE_RHO};
-enum{FORWARD_IK,FORWARD_AD,FORWARD_IK_PERATOM,FORWARD_AD_PERATOM};
+enum{REVERSE_RHO,REVERSE_RHO_INTERLACED};
+enum{FORWARD_IK,FORWARD_AD,FORWARD_IK_PERATOM,FORWARD_AD_PERATOM,
+     FORWARD_IK_INTERLACED,FORWARD_AD_INTERLACED};
 
 #ifdef FFT_SINGLE
 #define ZEROF 0.0f
@@ -53,11 +56,13 @@ enum{FORWARD_IK,FORWARD_AD,FORWARD_IK_PERATOM,FORWARD_AD_PERATOM};
 
 PPPMStagger::PPPMStagger(LAMMPS *lmp, int narg, char **arg) :
   PPPM(lmp, narg, arg),
-  gf_b2(NULL)
+  gf_b2(NULL), density_brick2(NULL), vdx_brick2(NULL), vdy_brick2(NULL),
+  vdz_brick2(NULL), u_brick2(NULL), density_fft2(NULL), part2grid2(NULL)
 {
   if (narg < 1) error->all(FLERR,"Illegal kspace_style pppm/stagger command");
   stagger_flag = 1;
   group_group_enable = 0;
+  nmax2 = 0;
 
   memory->create(gf_b2,8,7,"pppm_stagger:gf_b2");
   gf_b2[1][0] = 1.0;
@@ -97,6 +102,8 @@ PPPMStagger::PPPMStagger(LAMMPS *lmp, int narg, char **arg) :
 PPPMStagger::~PPPMStagger()
 {
   memory->destroy(gf_b2);
+  deallocate_interlaced();
+  memory->destroy(part2grid2);
 }
 
 /* ----------------------------------------------------------------------
@@ -153,6 +160,84 @@ void PPPMStagger::compute(int eflag, int vflag)
 
   nstagger = 2;
 
+  // per-atom energy/virial need the extra FFTs and bricks of each grid,
+  //   so those steps solve one grid after the other
+
+  if (evflag_atom) compute_sequential();
+  else compute_interlaced();
+
+  // update qsum and qsqsum, if atom count has changed and energy needed
+
+  if ((eflag_global || eflag_atom) && atom->natoms != natoms_original) {
+    qsum_qsq();
+    natoms_original = atom->natoms;
+  }
+
+  // sum global energy across procs and add in volume-dependent term
+
+  const double qscale = qqrd2e * scale;
+
+  if (eflag_global) {
+    double energy_all;
+    MPI_Allreduce(&energy,&energy_all,1,MPI_DOUBLE,MPI_SUM,world);
+    energy = energy_all;
+
+    energy *= 0.5*volume/float(nstagger);
+    energy -= g_ewald*qsqsum/MY_PIS +
+      MY_PI2*qsum*qsum / (g_ewald*g_ewald*volume);
+    energy *= qscale;
+  }
+
+  // sum global virial across procs
+
+  if (vflag_global) {
+    double virial_all[6];
+    MPI_Allreduce(virial,virial_all,6,MPI_DOUBLE,MPI_SUM,world);
+    for (i = 0; i < 6; i++)
+      virial[i] = 0.5*qscale*volume*virial_all[i]/float(nstagger);
+  }
+
+  // per-atom energy/virial
+  // energy includes self-energy correction
+  // ntotal accounts for TIP4P tallying eatom/vatom for ghost atoms
+
+  if (evflag_atom) {
+    double *q = atom->q;
+    int nlocal = atom->nlocal;
+    int ntotal = nlocal;
+    if (tip4pflag) ntotal += atom->nghost;
+
+    if (eflag_atom) {
+      for (i = 0; i < nlocal; i++) {
+        eatom[i] *= 0.5;
+        eatom[i] -= g_ewald*q[i]*q[i]/MY_PIS + MY_PI2*q[i]*qsum /
+          (g_ewald*g_ewald*volume);
+        eatom[i] *= qscale;
+      }
+      for (i = nlocal; i < ntotal; i++) eatom[i] *= 0.5*qscale;
+    }
+
+    if (vflag_atom) {
+      for (i = 0; i < ntotal; i++)
+        for (j = 0; j < 6; j++) vatom[i][j] *= 0.5*qscale;
+    }
+  }
+
+  // 2d slab correction
+
+  if (slabflag == 1) slabcorr();
+
+  // convert atoms back from lamda to box coords
+
+  if (triclinic) domain->lamda2x(atom->nlocal);
+}
+
+/* ----------------------------------------------------------------------
+   solve the two grids one after the other
+------------------------------------------------------------------------- */
+
+void PPPMStagger::compute_sequential()
+{
   stagger = 0.0;
   for (int n=0; n<nstagger; n++) {
 
@@ -201,71 +286,293 @@ void PPPMStagger::compute(int eflag, int vflag)
 
     stagger += 1.0/float(nstagger);
   }
+}
 
-  // update qsum and qsqsum, if atom count has changed and energy needed
+/* ----------------------------------------------------------------------
+   solve the two grids together
+   the ghost cells of both grids are exchanged in one communication
+   and their densities go through one complex FFT as real and imaginary part
+------------------------------------------------------------------------- */
 
-  if ((eflag_global || eflag_atom) && atom->natoms != natoms_original) {
-    qsum_qsq();
-    natoms_original = atom->natoms;
+void PPPMStagger::compute_interlaced()
+{
+  if (atom->nmax > nmax2) {
+    memory->destroy(part2grid2);
+    nmax2 = atom->nmax;
+    memory->create(part2grid2,nmax2,3,"pppm_stagger:part2grid2");
   }
 
-  // sum global energy across procs and add in volume-dependent term
+  // find grid points for all my particles
+  // map my particle charge onto my local 3d density grid
+  // the 2nd grid is done by swapping it in as the current grid
 
-  const double qscale = qqrd2e * scale;
+  stagger = 0.0;
+  particle_map();
+  make_rho();
 
-  if (eflag_global) {
-    double energy_all;
-    MPI_Allreduce(&energy,&energy_all,1,MPI_DOUBLE,MPI_SUM,world);
-    energy = energy_all;
+  swap_grids();
+  stagger = 1.0/float(nstagger);
+  particle_map();
+  make_rho();
+  swap_grids();
 
-    energy *= 0.5*volume/float(nstagger);
-    energy -= g_ewald*qsqsum/MY_PIS +
-      MY_PI2*qsum*qsum / (g_ewald*g_ewald*volume);
-    energy *= qscale;
+  // all procs communicate density values of both grids
+  //   from their ghost cells to fully sum contribution in their 3d bricks
+  // remap from 3d decomposition to FFT decomposition
+
+  cg->reverse_comm(this,REVERSE_RHO_INTERLACED);
+  brick2fft();
+  swap_grids();
+  brick2fft();
+  swap_grids();
+
+  // compute potential gradient on both FFT grids and
+  //   portion of e_long on this proc's FFT grid
+  // return gradients (electric fields) in 3d brick decomposition
+
+  if (differentiation_flag == 1) poisson_ad_interlaced();
+  else poisson_ik_interlaced();
+
+  // all procs communicate E-field values of both grids
+  // to fill ghost cells surrounding their 3d bricks
+
+  if (differentiation_flag == 1) cg->forward_comm(this,FORWARD_AD_INTERLACED);
+  else cg->forward_comm(this,FORWARD_IK_INTERLACED);
+
+  // calculate the force on my particles from both grids
+
+  stagger = 0.0;
+  fieldforce();
+
+  swap_grids();
+  stagger = 1.0/float(nstagger);
+  fieldforce();
+  swap_grids();
+}
+
+/* ----------------------------------------------------------------------
+   exchange the arrays of the 1st and 2nd grid,
+   so that the PPPM methods operate on the 2nd grid
+------------------------------------------------------------------------- */
+
+void PPPMStagger::swap_grids()
+{
+  FFT_SCALAR ***tmp3d;
+  FFT_SCALAR *tmp1d;
+  int **tmp2d;
+
+  tmp3d = density_brick;
+  density_brick = density_brick2;
+  density_brick2 = tmp3d;
+  tmp1d = density_fft; density_fft = density_fft2; density_fft2 = tmp1d;
+  tmp2d = part2grid; part2grid = part2grid2; part2grid2 = tmp2d;
+
+  if (differentiation_flag == 1) {
+    tmp3d = u_brick; u_brick = u_brick2; u_brick2 = tmp3d;
+  } else {
+    tmp3d = vdx_brick; vdx_brick = vdx_brick2; vdx_brick2 = tmp3d;
+    tmp3d = vdy_brick; vdy_brick = vdy_brick2; vdy_brick2 = tmp3d;
+    tmp3d = vdz_brick; vdz_brick = vdz_brick2; vdz_brick2 = tmp3d;
   }
+}
 
-  // sum global virial across procs
+/* ----------------------------------------------------------------------
+   FFT-based Poisson solver for ik on both grids
+   density of 1st grid is the real part, of 2nd grid the imaginary part
+   energy and virial cross terms of the two grids cancel in the k-sum,
+     since greensfn and vg are even in k
+   the gradients of each grid stay real if the Nyquist terms are dropped,
+     those only add to the imaginary part in PPPM::poisson_ik()
+------------------------------------------------------------------------- */
 
-  if (vflag_global) {
-    double virial_all[6];
-    MPI_Allreduce(virial,virial_all,6,MPI_DOUBLE,MPI_SUM,world);
-    for (i = 0; i < 6; i++)
-      virial[i] = 0.5*qscale*volume*virial_all[i]/float(nstagger);
+void PPPMStagger::poisson_ik_interlaced()
+{
+  int i,j,k,n;
+  double eng,fk;
+
+  // transform charge density of both grids (r -> k)
+
+  n = 0;
+  for (i = 0; i < nfft; i++) {
+    work1[n++] = density_fft[i];
+    work1[n++] = density_fft2[i];
   }
 
-  // per-atom energy/virial
-  // energy includes self-energy correction
-  // ntotal accounts for TIP4P tallying eatom/vatom for ghost atoms
+  fft1->compute(work1,work1,1);
 
-  if (evflag_atom) {
-    double *q = atom->q;
-    int nlocal = atom->nlocal;
-    int ntotal = nlocal;
-    if (tip4pflag) ntotal += atom->nghost;
+  // global energy and virial contribution
 
-    if (eflag_atom) {
-      for (i = 0; i < nlocal; i++) {
-        eatom[i] *= 0.5;
-        eatom[i] -= g_ewald*q[i]*q[i]/MY_PIS + MY_PI2*q[i]*qsum /
-          (g_ewald*g_ewald*volume);
-        eatom[i] *= qscale;
+  double scaleinv = 1.0/(nx_pppm*ny_pppm*nz_pppm);
+  double s2 = scaleinv*scaleinv;
+
+  if (eflag_global || vflag_global) {
+    if (vflag_global) {
+      n = 0;
+      for (i = 0; i < nfft; i++) {
+        eng = s2 * greensfn[i] * (work1[n]*work1[n] + work1[n+1]*work1[n+1]);
+        for (j = 0; j < 6; j++) virial[j] += eng*vg[i][j];
+        if (eflag_global) energy += eng;
+        n += 2;
+      }
+    } else {
+      n = 0;
+      for (i = 0; i < nfft; i++) {
+        energy +=
+          s2 * greensfn[i] * (work1[n]*work1[n] + work1[n+1]*work1[n+1]);
+        n += 2;
       }
-      for (i = nlocal; i < ntotal; i++) eatom[i] *= 0.5*qscale;
     }
+  }
 
-    if (vflag_atom) {
-      for (i = 0; i < ntotal; i++)
-        for (j = 0; j < 6; j++) vatom[i][j] *= 0.5*qscale;
+  // scale by 1/total-grid-pts to get rho(k)
+  // multiply by Green's function to get V(k)
+
+  n = 0;
+  for (i = 0; i < nfft; i++) {
+    work1[n++] *= scaleinv * greensfn[i];
+    work1[n++] *= scaleinv * greensfn[i];
+  }
+
+  // compute gradients of V(r) in each of 3 dims by transformimg -ik*V(k)
+  // FFT leaves data in 3d brick decomposition
+  // real part goes to the 1st grid, imaginary part to the 2nd grid
+
+  // x direction gradient
+
+  n = 0;
+  for (k = nzlo_fft; k <= nzhi_fft; k++)
+    for (j = nylo_fft; j <= nyhi_fft; j++)
+      for (i = nxlo_fft; i <= nxhi_fft; i++) {
+        fk = (2*i == nx_pppm) ? 0.0 : fkx[i];
+        work2[n] = fk*work1[n+1];
+        work2[n+1] = -fk*work1[n];
+        n += 2;
+      }
+
+  fft2->compute(work2,work2,-1);
+
+  n = 0;
+  for (k = nzlo_in; k <= nzhi_in; k++)
+    for (j = nylo_in; j <= nyhi_in; j++)
+      for (i = nxlo_in; i <= nxhi_in; i++) {
+        vdx_brick[k][j][i] = work2[n];
+        vdx_brick2[k][j][i] = work2[n+1];
+        n += 2;
+      }
+
+  // y direction gradient
+
+  n = 0;
+  for (k = nzlo_fft; k <= nzhi_fft; k++)
+    for (j = nylo_fft; j <= nyhi_fft; j++) {
+      fk = (2*j == ny_pppm) ? 0.0 : fky[j];
+      for (i = nxlo_fft; i <= nxhi_fft; i++) {
+        work2[n] = fk*work1[n+1];
+        work2[n+1] = -fk*work1[n];
+        n += 2;
+      }
     }
+
+  fft2->compute(work2,work2,-1);
+
+  n = 0;
+  for (k = nzlo_in; k <= nzhi_in; k++)
+    for (j = nylo_in; j <= nyhi_in; j++)
+      for (i = nxlo_in; i <= nxhi_in; i++) {
+        vdy_brick[k][j][i] = work2[n];
+        vdy_brick2[k][j][i] = work2[n+1];
+        n += 2;
+      }
+
+  // z direction gradient
+
+  n = 0;
+  for (k = nzlo_fft; k <= nzhi_fft; k++) {
+    fk = (2*k == nz_pppm) ? 0.0 : fkz[k];
+    for (j = nylo_fft; j <= nyhi_fft; j++)
+      for (i = nxlo_fft; i <= nxhi_fft; i++) {
+        work2[n] = fk*work1[n+1];
+        work2[n+1] = -fk*work1[n];
+        n += 2;
+      }
   }
 
-  // 2d slab correction
+  fft2->compute(work2,work2,-1);
 
-  if (slabflag == 1) slabcorr();
+  n = 0;
+  for (k = nzlo_in; k <= nzhi_in; k++)
+    for (j = nylo_in; j <= nyhi_in; j++)
+      for (i = nxlo_in; i <= nxhi_in; i++) {
+        vdz_brick[k][j][i] = work2[n];
+        vdz_brick2[k][j][i] = work2[n+1];
+        n += 2;
+      }
+}
 
-  // convert atoms back from lamda to box coords
+/* ----------------------------------------------------------------------
+   FFT-based Poisson solver for ad on both grids
+   density of 1st grid is the real part, of 2nd grid the imaginary part
+------------------------------------------------------------------------- */
 
-  if (triclinic) domain->lamda2x(atom->nlocal);
+void PPPMStagger::poisson_ad_interlaced()
+{
+  int i,j,k,n;
+  double eng;
+
+  // transform charge density of both grids (r -> k)
+
+  n = 0;
+  for (i = 0; i < nfft; i++) {
+    work1[n++] = density_fft[i];
+    work1[n++] = density_fft2[i];
+  }
+
+  fft1->compute(work1,work1,1);
+
+  // global energy and virial contribution
+
+  double scaleinv = 1.0/(nx_pppm*ny_pppm*nz_pppm);
+  double s2 = scaleinv*scaleinv;
+
+  if (eflag_global || vflag_global) {
+    if (vflag_global) {
+      n = 0;
+      for (i = 0; i < nfft; i++) {
+        eng = s2 * greensfn[i] * (work1[n]*work1[n] + work1[n+1]*work1[n+1]);
+        for (j = 0; j < 6; j++) virial[j] += eng*vg[i][j];
+        if (eflag_global) energy += eng;
+        n += 2;
+      }
+    } else {
+      n = 0;
+      for (i = 0; i < nfft; i++) {
+        energy +=
+          s2 * greensfn[i] * (work1[n]*work1[n] + work1[n+1]*work1[n+1]);
+        n += 2;
+      }
+    }
+  }
+
+  // scale by 1/total-grid-pts to get rho(k)
+  // multiply by Green's function to get V(k)
+
+  n = 0;
+  for (i = 0; i < nfft; i++) {
+    work2[n] = scaleinv * greensfn[i] * work1[n];
+    work2[n+1] = scaleinv * greensfn[i] * work1[n+1];
+    n += 2;
+  }
+
+  fft2->compute(work2,work2,-1);
+
+  n = 0;
+  for (k = nzlo_in; k <= nzhi_in; k++)
+    for (j = nylo_in; j <= nyhi_in; j++)
+      for (i = nxlo_in; i <= nxhi_in; i++) {
+        u_brick[k][j][i] = work2[n];
+        u_brick2[k][j][i] = work2[n+1];
+        n += 2;
+      }
 }
 
 /* ----------------------------------------------------------------------
@@ -972,27 +1279,194 @@ void PPPMStagger::fieldforce_peratom()
 }
 
 /* ----------------------------------------------------------------------
-   perform and time the 1d FFTs required for N timesteps
+   allocate memory of the 2nd grid in addition to PPPM
+   ghost grid object is recreated to hold the values of both grids
 ------------------------------------------------------------------------- */
 
-int PPPMStagger::timing_1d(int n, double &time1d)
+void PPPMStagger::allocate()
 {
-  PPPM::timing_1d(n,time1d);
-  time1d *= 2.0;
+  PPPM::allocate();
+
+  memory->create3d_offset(density_brick2,nzlo_out,nzhi_out,nylo_out,nyhi_out,
+                          nxlo_out,nxhi_out,"pppm_stagger:density_brick2");
+  memory->create(density_fft2,nfft_both,"pppm_stagger:density_fft2");
+
+  if (differentiation_flag == 1) {
+    memory->create3d_offset(u_brick2,nzlo_out,nzhi_out,nylo_out,nyhi_out,
+                            nxlo_out,nxhi_out,"pppm_stagger:u_brick2");
+  } else {
+    memory->create3d_offset(vdx_brick2,nzlo_out,nzhi_out,nylo_out,nyhi_out,
+                            nxlo_out,nxhi_out,"pppm_stagger:vdx_brick2");
+    memory->create3d_offset(vdy_brick2,nzlo_out,nzhi_out,nylo_out,nyhi_out,
+                            nxlo_out,nxhi_out,"pppm_stagger:vdy_brick2");
+    memory->create3d_offset(vdz_brick2,nzlo_out,nzhi_out,nylo_out,nyhi_out,
+                            nxlo_out,nxhi_out,"pppm_stagger:vdz_brick2");
+  }
 
-  if (differentiation_flag) return 2;
-  return 4;
+  int (*procneigh)[2] = comm->procneigh;
+
+  delete cg;
+  if (differentiation_flag == 1)
+    cg = new GridComm(lmp,world,2,2,
+                      nxlo_in,nxhi_in,nylo_in,nyhi_in,nzlo_in,nzhi_in,
+                      nxlo_out,nxhi_out,nylo_out,nyhi_out,nzlo_out,nzhi_out,
+                      procneigh[0][0],procneigh[0][1],procneigh[1][0],
+                      procneigh[1][1],procneigh[2][0],procneigh[2][1]);
+  else
+    cg = new GridComm(lmp,world,6,2,
+                      nxlo_in,nxhi_in,nylo_in,nyhi_in,nzlo_in,nzhi_in,
+                      nxlo_out,nxhi_out,nylo_out,nyhi_out,nzlo_out,nzhi_out,
+                      procneigh[0][0],procneigh[0][1],procneigh[1][0],
+                      procneigh[1][1],procneigh[2][0],procneigh[2][1]);
 }
 
 /* ----------------------------------------------------------------------
-   perform and time the 3d FFTs required for N timesteps
+   deallocate memory that depends on # of K-vectors and order
 ------------------------------------------------------------------------- */
 
-int PPPMStagger::timing_3d(int n, double &time3d)
+void PPPMStagger::deallocate()
 {
-  PPPM::timing_3d(n,time3d);
-  time3d *= 2.0;
+  PPPM::deallocate();
+  deallocate_interlaced();
+}
+
+/* ----------------------------------------------------------------------
+   deallocate memory of the 2nd grid
+------------------------------------------------------------------------- */
 
-  if (differentiation_flag) return 2;
-  return 4;
+void PPPMStagger::deallocate_interlaced()
+{
+  memory->destroy3d_offset(density_brick2,nzlo_out,nylo_out,nxlo_out);
+  memory->destroy3d_offset(u_brick2,nzlo_out,nylo_out,nxlo_out);
+  memory->destroy3d_offset(vdx_brick2,nzlo_out,nylo_out,nxlo_out);
+  memory->destroy3d_offset(vdy_brick2,nzlo_out,nylo_out,nxlo_out);
+  memory->destroy3d_offset(vdz_brick2,nzlo_out,nylo_out,nxlo_out);
+  memory->destroy(density_fft2);
+}
+
+/* ----------------------------------------------------------------------
+   pack own values of both grids to buf to send to another proc
+------------------------------------------------------------------------- */
+
+void PPPMStagger::pack_forward(int flag, FFT_SCALAR *buf,
+                               int nlist, int *list)
+{
+  int n = 0;
+
+  if (flag == FORWARD_IK_INTERLACED) {
+    FFT_SCALAR *xsrc = &vdx_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *ysrc = &vdy_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *zsrc = &vdz_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *xsrc2 = &vdx_brick2[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *ysrc2 = &vdy_brick2[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *zsrc2 = &vdz_brick2[nzlo_out][nylo_out][nxlo_out];
+    for (int i = 0; i < nlist; i++) {
+      buf[n++] = xsrc[list[i]];
+      buf[n++] = ysrc[list[i]];
+      buf[n++] = zsrc[list[i]];
+      buf[n++] = xsrc2[list[i]];
+      buf[n++] = ysrc2[list[i]];
+      buf[n++] = zsrc2[list[i]];
+    }
+  } else if (flag == FORWARD_AD_INTERLACED) {
+    FFT_SCALAR *src = &u_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *src2 = &u_brick2[nzlo_out][nylo_out][nxlo_out];
+    for (int i = 0; i < nlist; i++) {
+      buf[n++] = src[list[i]];
+      buf[n++] = src2[list[i]];
+    }
+  } else PPPM::pack_forward(flag,buf,nlist,list);
+}
+
+/* ----------------------------------------------------------------------
+   unpack another proc's own values of both grids from buf
+   and set own ghost values
+------------------------------------------------------------------------- */
+
+void PPPMStagger::unpack_forward(int flag, FFT_SCALAR *buf,
+                                 int nlist, int *list)
+{
+  int n = 0;
+
+  if (flag == FORWARD_IK_INTERLACED) {
+    FFT_SCALAR *xdest = &vdx_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *ydest = &vdy_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *zdest = &vdz_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *xdest2 = &vdx_brick2[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *ydest2 = &vdy_brick2[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *zdest2 = &vdz_brick2[nzlo_out][nylo_out][nxlo_out];
+    for (int i = 0; i < nlist; i++) {
+      xdest[list[i]] = buf[n++];
+      ydest[list[i]] = buf[n++];
+      zdest[list[i]] = buf[n++];
+      xdest2[list[i]] = buf[n++];
+      ydest2[list[i]] = buf[n++];
+      zdest2[list[i]] = buf[n++];
+    }
+  } else if (flag == FORWARD_AD_INTERLACED) {
+    FFT_SCALAR *dest = &u_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *dest2 = &u_brick2[nzlo_out][nylo_out][nxlo_out];
+    for (int i = 0; i < nlist; i++) {
+      dest[list[i]] = buf[n++];
+      dest2[list[i]] = buf[n++];
+    }
+  } else PPPM::unpack_forward(flag,buf,nlist,list);
+}
+
+/* ----------------------------------------------------------------------
+   pack ghost values of both grids into buf to send to another proc
+------------------------------------------------------------------------- */
+
+void PPPMStagger::pack_reverse(int flag, FFT_SCALAR *buf,
+                               int nlist, int *list)
+{
+  int n = 0;
+
+  if (flag == REVERSE_RHO_INTERLACED) {
+    FFT_SCALAR *src = &density_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *src2 = &density_brick2[nzlo_out][nylo_out][nxlo_out];
+    for (int i = 0; i < nlist; i++) {
+      buf[n++] = src[list[i]];
+      buf[n++] = src2[list[i]];
+    }
+  } else PPPM::pack_reverse(flag,buf,nlist,list);
+}
+
+/* ----------------------------------------------------------------------
+   unpack another proc's ghost values of both grids from buf
+   and add to own values
+------------------------------------------------------------------------- */
+
+void PPPMStagger::unpack_reverse(int flag, FFT_SCALAR *buf,
+                                 int nlist, int *list)
+{
+  int n = 0;
+
+  if (flag == REVERSE_RHO_INTERLACED) {
+    FFT_SCALAR *dest = &density_brick[nzlo_out][nylo_out][nxlo_out];
+    FFT_SCALAR *dest2 = &density_brick2[nzlo_out][nylo_out][nxlo_out];
+    for (int i = 0; i < nlist; i++) {
+      dest[list[i]] += buf[n++];
+      dest2[list[i]] += buf[n++];
+    }
+  } else PPPM::unpack_reverse(flag,buf,nlist,list);
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of local arrays
+------------------------------------------------------------------------- */
+
+double PPPMStagger::memory_usage()
+{
+  double bytes = PPPM::memory_usage();
+  int nbrick = (nxhi_out-nxlo_out+1) * (nyhi_out-nylo_out+1) *
+    (nzhi_out-nzlo_out+1);
+  if (differentiation_flag == 1) {
+    bytes += 2 * nbrick * sizeof(FFT_SCALAR);
+  } else {
+    bytes += 4 * nbrick * sizeof(FFT_SCALAR);
+  }
+  bytes += nfft_both * sizeof(FFT_SCALAR);
+  bytes += nmax2*3 * sizeof(int);
+  return bytes;
 }
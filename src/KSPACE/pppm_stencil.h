@@ -0,0 +1,165 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_PPPM_STENCIL_H
+#define LMP_PPPM_STENCIL_H
+
+#include "pppm.h"
+
+// ask the compiler to fully unroll the fixed-length stencil loops,
+//   which -O2 does not do by itself for the larger orders
+
+#if defined(__clang__)
+#define PPPM_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && !defined(__INTEL_COMPILER) && (__GNUC__ >= 8)
+#define PPPM_UNROLL _Pragma("GCC unroll 8")
+#else
+#define PPPM_UNROLL
+#endif
+
+namespace LAMMPS_NS {
+
+// charge assignment and field interpolation for one particle
+//   with the stencil order known at compile time
+// weights of the ORDER stencil pts in each dim are held in local arrays,
+//   w[k] belongs to grid pt nlower+k, nlower = -(ORDER-1)/2
+// all loops have a fixed trip count and run over the contiguous x dim
+//   of the grid innermost, interpolation sums each x row of the stencil
+//   into scalars before weighting it with the y and z weights
+
+namespace PPPMStencil {
+
+  // weights in all 3 dims from the polynomial coefficients
+  //   of rho_coeff (NCOEFF = ORDER) or drho_coeff (NCOEFF = ORDER-1)
+  // dx,dy,dz = distance of particle from "lower left" grid pt
+
+  template <int ORDER, int NCOEFF>
+  static inline void weights(FFT_SCALAR *wx, FFT_SCALAR *wy, FFT_SCALAR *wz,
+                             const FFT_SCALAR dx, const FFT_SCALAR dy,
+                             const FFT_SCALAR dz, FFT_SCALAR * const *coeff)
+  {
+    const int nlower = -(ORDER-1)/2;
+    PPPM_UNROLL
+    for (int k = 0; k < ORDER; k++) {
+      FFT_SCALAR r1 = 0.0, r2 = 0.0, r3 = 0.0;
+      PPPM_UNROLL
+      for (int l = NCOEFF-1; l >= 0; l--) {
+        const FFT_SCALAR c = coeff[l][nlower+k];
+        r1 = c + r1*dx;
+        r2 = c + r2*dy;
+        r3 = c + r3*dz;
+      }
+      wx[k] = r1;
+      wy[k] = r2;
+      wz[k] = r3;
+    }
+  }
+
+  // add charge z0 to the stencil around grid pt (nx,ny,nz)
+
+  template <int ORDER>
+  static inline void spread(FFT_SCALAR ***brick,
+                            const int nx, const int ny, const int nz,
+                            const FFT_SCALAR *wx, const FFT_SCALAR *wy,
+                            const FFT_SCALAR *wz, const FFT_SCALAR z0)
+  {
+    const int nlower = -(ORDER-1)/2;
+    for (int n = 0; n < ORDER; n++) {
+      FFT_SCALAR **plane = brick[nz+nlower+n];
+      const FFT_SCALAR y0 = z0*wz[n];
+      for (int m = 0; m < ORDER; m++) {
+        FFT_SCALAR *row = &plane[ny+nlower+m][nx+nlower];
+        const FFT_SCALAR x0 = y0*wy[m];
+        PPPM_UNROLL
+        for (int l = 0; l < ORDER; l++) row[l] += x0*wx[l];
+      }
+    }
+  }
+
+  // E-field from the 3 gradient bricks of ik differentiation
+
+  template <int ORDER>
+  static inline void gather_ik(FFT_SCALAR ***vdx, FFT_SCALAR ***vdy,
+                               FFT_SCALAR ***vdz,
+                               const int nx, const int ny, const int nz,
+                               const FFT_SCALAR *wx, const FFT_SCALAR *wy,
+                               const FFT_SCALAR *wz, FFT_SCALAR *ek)
+  {
+    const int nlower = -(ORDER-1)/2;
+    FFT_SCALAR ekx = 0.0, eky = 0.0, ekz = 0.0;
+
+    for (int n = 0; n < ORDER; n++) {
+      const int mz = nz+nlower+n;
+      for (int m = 0; m < ORDER; m++) {
+        const int my = ny+nlower+m;
+        const FFT_SCALAR *rowx = &vdx[mz][my][nx+nlower];
+        const FFT_SCALAR *rowy = &vdy[mz][my][nx+nlower];
+        const FFT_SCALAR *rowz = &vdz[mz][my][nx+nlower];
+        FFT_SCALAR sx = 0.0, sy = 0.0, sz = 0.0;
+        PPPM_UNROLL
+        for (int l = 0; l < ORDER; l++) {
+          sx += wx[l]*rowx[l];
+          sy += wx[l]*rowy[l];
+          sz += wx[l]*rowz[l];
+        }
+        const FFT_SCALAR y0 = wz[n]*wy[m];
+        ekx -= y0*sx;
+        eky -= y0*sy;
+        ekz -= y0*sz;
+      }
+    }
+
+    ek[0] = ekx;
+    ek[1] = eky;
+    ek[2] = ekz;
+  }
+
+  // unscaled E-field from the potential brick of ad differentiation
+  // dw = derivatives of the weights
+
+  template <int ORDER>
+  static inline void gather_ad(FFT_SCALAR ***u,
+                               const int nx, const int ny, const int nz,
+                               const FFT_SCALAR *wx, const FFT_SCALAR *wy,
+                               const FFT_SCALAR *wz, const FFT_SCALAR *dwx,
+                               const FFT_SCALAR *dwy, const FFT_SCALAR *dwz,
+                               FFT_SCALAR *ek)
+  {
+    const int nlower = -(ORDER-1)/2;
+    FFT_SCALAR ekx = 0.0, eky = 0.0, ekz = 0.0;
+
+    for (int n = 0; n < ORDER; n++) {
+      const int mz = nz+nlower+n;
+      for (int m = 0; m < ORDER; m++) {
+        const FFT_SCALAR *row = &u[mz][ny+nlower+m][nx+nlower];
+        FFT_SCALAR s = 0.0, ds = 0.0;
+        PPPM_UNROLL
+        for (int l = 0; l < ORDER; l++) {
+          s += wx[l]*row[l];
+          ds += dwx[l]*row[l];
+        }
+        ekx += wy[m]*wz[n]*ds;
+        eky += dwy[m]*wz[n]*s;
+        ekz += wy[m]*dwz[n]*s;
+      }
+    }
+
+    ek[0] = ekx;
+    ek[1] = eky;
+    ek[2] = ekz;
+  }
+}
+
+}
+
+#endif
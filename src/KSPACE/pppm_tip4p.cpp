@@ -17,6 +17,7 @@
 
 #include <math.h>
 #include "pppm_tip4p.h"
+#include "pppm_stencil.h"
 #include "atom.h"
 #include "domain.h"
 #include "force.h"
@@ -116,6 +117,14 @@ void PPPMTIP4P::particle_map()
 
 void PPPMTIP4P::make_rho()
 {
+  switch (order) {
+  case 3: make_rho_tip4p<3>(); return;
+  case 4: make_rho_tip4p<4>(); return;
+  case 5: make_rho_tip4p<5>(); return;
+  case 6: make_rho_tip4p<6>(); return;
+  case 7: make_rho_tip4p<7>(); return;
+  }
+
   int i,l,m,n,nx,ny,nz,mx,my,mz,iH1,iH2;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
   double *xi,xM[3];
@@ -172,6 +181,14 @@ void PPPMTIP4P::make_rho()
 
 void PPPMTIP4P::fieldforce_ik()
 {
+  switch (order) {
+  case 3: fieldforce_ik_tip4p<3>(); return;
+  case 4: fieldforce_ik_tip4p<4>(); return;
+  case 5: fieldforce_ik_tip4p<5>(); return;
+  case 6: fieldforce_ik_tip4p<6>(); return;
+  case 7: fieldforce_ik_tip4p<7>(); return;
+  }
+
   int i,l,m,n,nx,ny,nz,mx,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
   FFT_SCALAR ekx,eky,ekz;
@@ -259,6 +276,14 @@ void PPPMTIP4P::fieldforce_ik()
 
 void PPPMTIP4P::fieldforce_ad()
 {
+  switch (order) {
+  case 3: fieldforce_ad_tip4p<3>(); return;
+  case 4: fieldforce_ad_tip4p<4>(); return;
+  case 5: fieldforce_ad_tip4p<5>(); return;
+  case 6: fieldforce_ad_tip4p<6>(); return;
+  case 7: fieldforce_ad_tip4p<7>(); return;
+  }
+
   int i,l,m,n,nx,ny,nz,mx,my,mz;
   FFT_SCALAR dx,dy,dz;
   FFT_SCALAR ekx,eky,ekz;
@@ -374,6 +399,202 @@ void PPPMTIP4P::fieldforce_ad()
 }
 
 
+/* ----------------------------------------------------------------------
+   same as make_rho() with stencil order known at compile time
+------------------------------------------------------------------------- */
+
+template <int ORDER>
+void PPPMTIP4P::make_rho_tip4p()
+{
+  FFT_SCALAR wx[ORDER],wy[ORDER],wz[ORDER];
+  int iH1,iH2;
+  double *xi,xM[3];
+
+  FFT_SCALAR *vec = &density_brick[nzlo_out][nylo_out][nxlo_out];
+  for (int i = 0; i < ngrid; i++) vec[i] = ZEROF;
+
+  int *type = atom->type;
+  double *q = atom->q;
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (type[i] == typeO) {
+      find_M(i,iH1,iH2,xM);
+      xi = xM;
+    } else xi = x[i];
+
+    const int nx = part2grid[i][0];
+    const int ny = part2grid[i][1];
+    const int nz = part2grid[i][2];
+
+    const FFT_SCALAR dx = nx+shiftone - (xi[0]-boxlo[0])*delxinv;
+    const FFT_SCALAR dy = ny+shiftone - (xi[1]-boxlo[1])*delyinv;
+    const FFT_SCALAR dz = nz+shiftone - (xi[2]-boxlo[2])*delzinv;
+
+    PPPMStencil::weights<ORDER,ORDER>(wx,wy,wz,dx,dy,dz,rho_coeff);
+
+    PPPMStencil::spread<ORDER>(density_brick,nx,ny,nz,wx,wy,wz,
+                               delvolinv*q[i]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same as fieldforce_ik() with stencil order known at compile time
+------------------------------------------------------------------------- */
+
+template <int ORDER>
+void PPPMTIP4P::fieldforce_ik_tip4p()
+{
+  FFT_SCALAR wx[ORDER],wy[ORDER],wz[ORDER];
+  FFT_SCALAR ek[3];
+  int iH1,iH2;
+  double *xi,xM[3];
+
+  double *q = atom->q;
+  double **x = atom->x;
+  double **f = atom->f;
+
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (type[i] == typeO) {
+      find_M(i,iH1,iH2,xM);
+      xi = xM;
+    } else xi = x[i];
+
+    const int nx = part2grid[i][0];
+    const int ny = part2grid[i][1];
+    const int nz = part2grid[i][2];
+
+    const FFT_SCALAR dx = nx+shiftone - (xi[0]-boxlo[0])*delxinv;
+    const FFT_SCALAR dy = ny+shiftone - (xi[1]-boxlo[1])*delyinv;
+    const FFT_SCALAR dz = nz+shiftone - (xi[2]-boxlo[2])*delzinv;
+
+    PPPMStencil::weights<ORDER,ORDER>(wx,wy,wz,dx,dy,dz,rho_coeff);
+
+    PPPMStencil::gather_ik<ORDER>(vdx_brick,vdy_brick,vdz_brick,
+                                  nx,ny,nz,wx,wy,wz,ek);
+
+    // convert E-field to force, M site force is spread to O and H atoms
+
+    const double qfactor = qqrd2e * scale * q[i];
+    const double fx = qfactor*ek[0];
+    const double fy = qfactor*ek[1];
+    const double fz = qfactor*ek[2];
+
+    if (type[i] != typeO) {
+      f[i][0] += fx;
+      f[i][1] += fy;
+      if (slabflag != 2) f[i][2] += fz;
+
+    } else {
+      f[i][0] += fx*(1 - alpha);
+      f[i][1] += fy*(1 - alpha);
+      if (slabflag != 2) f[i][2] += fz*(1 - alpha);
+
+      f[iH1][0] += 0.5*alpha*fx;
+      f[iH1][1] += 0.5*alpha*fy;
+      if (slabflag != 2) f[iH1][2] += 0.5*alpha*fz;
+
+      f[iH2][0] += 0.5*alpha*fx;
+      f[iH2][1] += 0.5*alpha*fy;
+      if (slabflag != 2) f[iH2][2] += 0.5*alpha*fz;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same as fieldforce_ad() with stencil order known at compile time
+------------------------------------------------------------------------- */
+
+template <int ORDER>
+void PPPMTIP4P::fieldforce_ad_tip4p()
+{
+  FFT_SCALAR wx[ORDER],wy[ORDER],wz[ORDER];
+  FFT_SCALAR dwx[ORDER],dwy[ORDER],dwz[ORDER];
+  FFT_SCALAR ek[3];
+  int iH1,iH2;
+  double *xi,xM[3];
+  double sf;
+
+  double *prd;
+  if (triclinic == 0) prd = domain->prd;
+  else prd = domain->prd_lamda;
+
+  const double hx_inv = nx_pppm/prd[0];
+  const double hy_inv = ny_pppm/prd[1];
+  const double hz_inv = nz_pppm/prd[2];
+
+  double *q = atom->q;
+  double **x = atom->x;
+  double **f = atom->f;
+
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+
+  const double qfactor = qqrd2e * scale;
+
+  for (int i = 0; i < nlocal; i++) {
+    if (type[i] == typeO) {
+      find_M(i,iH1,iH2,xM);
+      xi = xM;
+    } else xi = x[i];
+
+    const int nx = part2grid[i][0];
+    const int ny = part2grid[i][1];
+    const int nz = part2grid[i][2];
+    const FFT_SCALAR dx = nx+shiftone - (xi[0]-boxlo[0])*delxinv;
+    const FFT_SCALAR dy = ny+shiftone - (xi[1]-boxlo[1])*delyinv;
+    const FFT_SCALAR dz = nz+shiftone - (xi[2]-boxlo[2])*delzinv;
+
+    PPPMStencil::weights<ORDER,ORDER>(wx,wy,wz,dx,dy,dz,rho_coeff);
+    PPPMStencil::weights<ORDER,ORDER-1>(dwx,dwy,dwz,dx,dy,dz,drho_coeff);
+
+    PPPMStencil::gather_ad<ORDER>(u_brick,nx,ny,nz,wx,wy,wz,dwx,dwy,dwz,ek);
+
+    // convert E-field to force and substract self forces
+    // M site force is spread to O and H atoms
+
+    const double s1 = xi[0]*hx_inv;
+    const double s2 = xi[1]*hy_inv;
+    const double s3 = xi[2]*hz_inv;
+    const double qsq2 = 2.0*q[i]*q[i];
+
+    sf = sf_coeff[0]*sin(2*MY_PI*s1);
+    sf += sf_coeff[1]*sin(4*MY_PI*s1);
+    const double fx = qfactor*(ek[0]*hx_inv*q[i] - sf*qsq2);
+
+    sf = sf_coeff[2]*sin(2*MY_PI*s2);
+    sf += sf_coeff[3]*sin(4*MY_PI*s2);
+    const double fy = qfactor*(ek[1]*hy_inv*q[i] - sf*qsq2);
+
+    sf = sf_coeff[4]*sin(2*MY_PI*s3);
+    sf += sf_coeff[5]*sin(4*MY_PI*s3);
+    const double fz = qfactor*(ek[2]*hz_inv*q[i] - sf*qsq2);
+
+    if (type[i] != typeO) {
+      f[i][0] += fx;
+      f[i][1] += fy;
+      if (slabflag != 2) f[i][2] += fz;
+
+    } else {
+      f[i][0] += fx*(1 - alpha);
+      f[i][1] += fy*(1 - alpha);
+      if (slabflag != 2) f[i][2] += fz*(1 - alpha);
+
+      f[iH1][0] += 0.5*alpha*fx;
+      f[iH1][1] += 0.5*alpha*fy;
+      if (slabflag != 2) f[iH1][2] += 0.5*alpha*fz;
+
+      f[iH2][0] += 0.5*alpha*fx;
+      f[iH2][1] += 0.5*alpha*fy;
+      if (slabflag != 2) f[iH2][2] += 0.5*alpha*fz;
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    interpolate from grid to get electric field & force on my particles
 ------------------------------------------------------------------------- */
@@ -39,6 +39,12 @@ class PPPMTIP4P : public PPPM {
 
  private:
   void find_M(int, int &, int &, double *);
+
+  // loops with compile-time stencil order, see PPPM::make_rho_order()
+
+  template <int ORDER> void make_rho_tip4p();
+  template <int ORDER> void fieldforce_ik_tip4p();
+  template <int ORDER> void fieldforce_ad_tip4p();
 };
 
 }
@@ -22,6 +22,12 @@
 #define MIN(A,B) ((A) < (B) ? (A) : (B))
 #define MAX(A,B) ((A) > (B) ? (A) : (B))
 
+static struct remap_plan_3d *remap_3d_plan(MPI_Comm,
+                                           int, int, int, int, int, int,
+                                           int, int, int, int, int, int,
+                                           int, int, int, int, int,
+                                           int, int, int);
+
 /* ----------------------------------------------------------------------
    Data layout for 3d remaps:
 
@@ -203,6 +209,87 @@ void remap_3d(FFT_SCALAR *in, FFT_SCALAR *out, FFT_SCALAR *buf,
   }
 }
 
+/* ----------------------------------------------------------------------
+   Start a nonblocking 3d remap
+
+   Arguments:
+   in           starting address of input data on this proc
+   plan         plan returned by previous call to remap_3d_create_plan_batch
+
+   all data is packed before return, so in can be overwritten
+     as soon as remap_3d_start() returns
+------------------------------------------------------------------------- */
+
+void remap_3d_start(FFT_SCALAR *in, struct remap_plan_3d *plan)
+{
+  int isend,irecv;
+  FFT_SCALAR *scratch = plan->scratch;
+
+  // post all recvs into scratch space
+
+  for (irecv = 0; irecv < plan->nrecv; irecv++)
+    MPI_Irecv(&scratch[plan->recv_bufloc[irecv]],plan->recv_size[irecv],
+              MPI_FFT_SCALAR,plan->recv_proc[irecv],0,
+              plan->comm,&plan->request[irecv]);
+
+  // pack each message into its own section of sendbuf and post its send
+
+  for (isend = 0; isend < plan->nsend; isend++) {
+    plan->pack(&in[plan->send_offset[isend]],
+               &plan->sendbuf[plan->send_bufloc[isend]],
+               &plan->packplan[isend]);
+    MPI_Isend(&plan->sendbuf[plan->send_bufloc[isend]],plan->send_size[isend],
+              MPI_FFT_SCALAR,plan->send_proc[isend],0,plan->comm,
+              &plan->send_request[isend]);
+  }
+
+  // copy in -> scratch for self data
+
+  if (plan->self) {
+    isend = plan->nsend;
+    irecv = plan->nrecv;
+    plan->pack(&in[plan->send_offset[isend]],
+               &scratch[plan->recv_bufloc[irecv]],
+               &plan->packplan[isend]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   Complete a nonblocking 3d remap started by remap_3d_start()
+
+   Arguments:
+   out          starting address of where output data for this proc
+                  will be placed
+   plan         same plan that was passed to remap_3d_start()
+------------------------------------------------------------------------- */
+
+void remap_3d_finish(FFT_SCALAR *out, struct remap_plan_3d *plan)
+{
+  int i,irecv;
+  FFT_SCALAR *scratch = plan->scratch;
+
+  // copy scratch -> out for self data
+
+  if (plan->self) {
+    irecv = plan->nrecv;
+    plan->unpack(&scratch[plan->recv_bufloc[irecv]],
+                 &out[plan->recv_offset[irecv]],&plan->unpackplan[irecv]);
+  }
+
+  // unpack all messages from scratch -> out as they arrive
+
+  for (i = 0; i < plan->nrecv; i++) {
+    MPI_Waitany(plan->nrecv,plan->request,&irecv,MPI_STATUS_IGNORE);
+    plan->unpack(&scratch[plan->recv_bufloc[irecv]],
+                 &out[plan->recv_offset[irecv]],&plan->unpackplan[irecv]);
+  }
+
+  // sendbuf can be reused once all sends have completed
+
+  if (plan->nsend)
+    MPI_Waitall(plan->nsend,plan->send_request,MPI_STATUS_IGNORE);
+}
+
 /* ----------------------------------------------------------------------
    Create plan for performing a 3d remap
 
@@ -236,11 +323,63 @@ struct remap_plan_3d *remap_3d_create_plan(
   int out_klo, int out_khi,
   int nqty, int permute, int memory, int precision, int usecollective)
 
+{
+  return remap_3d_plan(comm,in_ilo,in_ihi,in_jlo,in_jhi,in_klo,in_khi,
+                       out_ilo,out_ihi,out_jlo,out_jhi,out_klo,out_khi,
+                       nqty,permute,memory,precision,usecollective,0,0,-1);
+}
+
+/* ----------------------------------------------------------------------
+   Create plan for a nonblocking 3d remap of a batch of planes
+
+   Arguments:
+   comm,in_*,out_*,nqty,permute,precision
+                        same as for remap_3d_create_plan()
+   batch_klo,batch_khi  range of the slow input index moved by this plan
+
+   the slow input index must be distributed the same way on input
+     and output, so that planes batch_klo to batch_khi only go to procs
+     which own the same planes on output
+   offsets and strides refer to the full in and out extents,
+     so the plans of all batches work on the same in and out arrays
+   all procs in comm must use the same number of batches,
+     a batch can be empty on some procs
+   the plan always provides its own memory and uses point-to-point MPI,
+     it is used with remap_3d_start() and remap_3d_finish()
+------------------------------------------------------------------------- */
+
+struct remap_plan_3d *remap_3d_create_plan_batch(
+  MPI_Comm comm,
+  int in_ilo, int in_ihi, int in_jlo, int in_jhi,
+  int in_klo, int in_khi,
+  int out_ilo, int out_ihi, int out_jlo, int out_jhi,
+  int out_klo, int out_khi,
+  int nqty, int permute, int precision, int batch_klo, int batch_khi)
+
+{
+  return remap_3d_plan(comm,in_ilo,in_ihi,in_jlo,in_jhi,in_klo,in_khi,
+                       out_ilo,out_ihi,out_jlo,out_jhi,out_klo,out_khi,
+                       nqty,permute,1,precision,0,1,batch_klo,batch_khi);
+}
+
+/* ----------------------------------------------------------------------
+   create a remap plan, for a single batch of planes if batch is set
+------------------------------------------------------------------------- */
+
+static struct remap_plan_3d *remap_3d_plan(
+  MPI_Comm comm,
+  int in_ilo, int in_ihi, int in_jlo, int in_jhi,
+  int in_klo, int in_khi,
+  int out_ilo, int out_ihi, int out_jlo, int out_jhi,
+  int out_klo, int out_khi,
+  int nqty, int permute, int memory, int precision, int usecollective,
+  int batch, int batch_klo, int batch_khi)
+
 {
 
   struct remap_plan_3d *plan;
   struct extent_3d *inarray, *outarray;
-  struct extent_3d in,out,overlap;
+  struct extent_3d in,out,inb,outb,overlap;
   int i,iproc,nsend,nrecv,ibuf,size,me,nprocs;
 
   // query MPI info
@@ -280,6 +419,21 @@ struct remap_plan_3d *remap_3d_create_plan(
   out.khi = out_khi;
   out.ksize = out.khi - out.klo + 1;
 
+  // inb,outb = part of in,out extents moved by this plan
+  // a batch only moves planes batch_klo to batch_khi of the slow index
+
+  inb = in;
+  outb = out;
+
+  if (batch) {
+    inb.klo = MAX(in.klo,batch_klo);
+    inb.khi = MIN(in.khi,batch_khi);
+    inb.ksize = MAX(inb.khi - inb.klo + 1,0);
+    outb.klo = MAX(out.klo,batch_klo);
+    outb.khi = MIN(out.khi,batch_khi);
+    outb.ksize = MAX(outb.khi - outb.klo + 1,0);
+  }
+
   // combine output extents across all procs
 
   inarray = (struct extent_3d *) malloc(nprocs*sizeof(struct extent_3d));
@@ -288,7 +442,7 @@ struct remap_plan_3d *remap_3d_create_plan(
   outarray = (struct extent_3d *) malloc(nprocs*sizeof(struct extent_3d));
   if (outarray == NULL) return NULL;
 
-  MPI_Allgather(&out,sizeof(struct extent_3d),MPI_BYTE,
+  MPI_Allgather(&outb,sizeof(struct extent_3d),MPI_BYTE,
                 outarray,sizeof(struct extent_3d),MPI_BYTE,comm);
 
   // count send collides, including self
@@ -298,7 +452,7 @@ struct remap_plan_3d *remap_3d_create_plan(
   for (i = 0; i < nprocs; i++) {
     iproc++;
     if (iproc == nprocs) iproc = 0;
-    nsend += remap_3d_collide(&in,&outarray[iproc],&overlap);
+    nsend += remap_3d_collide(&inb,&outarray[iproc],&overlap);
   }
 
   // malloc space for send info
@@ -323,7 +477,7 @@ struct remap_plan_3d *remap_3d_create_plan(
   for (i = 0; i < nprocs; i++) {
     iproc++;
     if (iproc == nprocs) iproc = 0;
-    if (remap_3d_collide(&in,&outarray[iproc],&overlap)) {
+    if (remap_3d_collide(&inb,&outarray[iproc],&overlap)) {
       plan->send_proc[nsend] = iproc;
       plan->send_offset[nsend] = nqty *
         ((overlap.klo-in.klo)*in.jsize*in.isize +
@@ -351,7 +505,7 @@ struct remap_plan_3d *remap_3d_create_plan(
 
   // combine input extents across all procs
 
-  MPI_Allgather(&in,sizeof(struct extent_3d),MPI_BYTE,
+  MPI_Allgather(&inb,sizeof(struct extent_3d),MPI_BYTE,
                 inarray,sizeof(struct extent_3d),MPI_BYTE,comm);
 
   // count recv collides, including self
@@ -361,7 +515,7 @@ struct remap_plan_3d *remap_3d_create_plan(
   for (i = 0; i < nprocs; i++) {
     iproc++;
     if (iproc == nprocs) iproc = 0;
-    nrecv += remap_3d_collide(&out,&inarray[iproc],&overlap);
+    nrecv += remap_3d_collide(&outb,&inarray[iproc],&overlap);
   }
 
   // malloc space for recv info
@@ -408,7 +562,7 @@ struct remap_plan_3d *remap_3d_create_plan(
   for (i = 0; i < nprocs; i++) {
     iproc++;
     if (iproc == nprocs) iproc = 0;
-    if (remap_3d_collide(&out,&inarray[iproc],&overlap)) {
+    if (remap_3d_collide(&outb,&inarray[iproc],&overlap)) {
       plan->recv_proc[nrecv] = iproc;
       plan->recv_bufloc[nrecv] = ibuf;
 
@@ -576,12 +730,29 @@ struct remap_plan_3d *remap_3d_create_plan(
   free(outarray);
 
   // find biggest send message (not including self) and malloc space for it
+  // a batch keeps all its sends in flight, so it needs space for all of them
 
   plan->sendbuf = NULL;
+  plan->send_bufloc = NULL;
+  plan->send_request = NULL;
 
   size = 0;
-  for (nsend = 0; nsend < plan->nsend; nsend++)
-    size = MAX(size,plan->send_size[nsend]);
+  if (batch) {
+    if (plan->nsend) {
+      plan->send_bufloc = (int *) malloc(plan->nsend*sizeof(int));
+      plan->send_request =
+        (MPI_Request *) malloc(plan->nsend*sizeof(MPI_Request));
+      if (plan->send_bufloc == NULL || plan->send_request == NULL)
+        return NULL;
+    }
+    for (nsend = 0; nsend < plan->nsend; nsend++) {
+      plan->send_bufloc[nsend] = size;
+      size += plan->send_size[nsend];
+    }
+  } else {
+    for (nsend = 0; nsend < plan->nsend; nsend++)
+      size = MAX(size,plan->send_size[nsend]);
+  }
 
   if (size) {
     plan->sendbuf = (FFT_SCALAR *) malloc(size*sizeof(FFT_SCALAR));
@@ -596,7 +767,7 @@ struct remap_plan_3d *remap_3d_create_plan(
   if (memory == 1) {
     if (nrecv > 0) {
       plan->scratch =
-        (FFT_SCALAR *) malloc(nqty*out.isize*out.jsize*out.ksize *
+        (FFT_SCALAR *) malloc(nqty*outb.isize*outb.jsize*outb.ksize *
                               sizeof(FFT_SCALAR));
       if (plan->scratch == NULL) return NULL;
     }
@@ -654,6 +825,8 @@ void remap_3d_destroy_plan(struct remap_plan_3d *plan)
     free(plan->send_proc);
     free(plan->packplan);
     if (plan->sendbuf) free(plan->sendbuf);
+    if (plan->send_bufloc) free(plan->send_bufloc);
+    if (plan->send_request) free(plan->send_request);
   }
 
   if (plan->nrecv || plan->self) {
@@ -39,6 +39,9 @@ struct remap_plan_3d {
   int *recv_proc;                   // proc to recv each message from
   int *recv_bufloc;                 // offset in scratch buf for each recv
   MPI_Request *request;             // MPI request for each posted recv
+  int *send_bufloc;                 // offset in sendbuf for each send
+                                    //   of a nonblocking remap
+  MPI_Request *send_request;        // MPI request for each posted send
   struct pack_plan_3d *unpackplan;  // unpack plan for each recv message
   int nrecv;                        // # of recvs from other procs
   int nsend;                        // # of sends to other procs
@@ -65,6 +68,12 @@ struct remap_plan_3d *remap_3d_create_plan(MPI_Comm,
                                            int, int, int, int, int, int,
                                            int, int, int, int, int, int,
                                            int, int, int, int, int);
+struct remap_plan_3d *remap_3d_create_plan_batch(MPI_Comm,
+                                                 int, int, int, int, int, int,
+                                                 int, int, int, int, int, int,
+                                                 int, int, int, int, int);
+void remap_3d_start(FFT_SCALAR *, struct remap_plan_3d *);
+void remap_3d_finish(FFT_SCALAR *, struct remap_plan_3d *);
 void remap_3d_destroy_plan(struct remap_plan_3d *);
 int remap_3d_collide(struct extent_3d *,
                      struct extent_3d *, struct extent_3d *);
@@ -60,6 +60,9 @@ class PairAIREBO : public Pair {
   MyPage<int> *ipage;              // neighbor list pages
   int *REBO_numneigh;              // # of pair neighbors for each atom
   int **REBO_firstneigh;           // ptr to 1st neighbor of each atom
+  MyPage<double> *wpage;           // REBO neighbor weight pages
+  double **REBO_firstw;            // ptr to wij,dwij of 1st neighbor of
+                                   //   each atom, stored as pairs
 
   double *closestdistsq;           // closest owned atom dist to each ghost
   double *nC,*nH;                  // sum of weighting fns with REBO neighs
@@ -31,6 +31,7 @@ class AtomVecAngle : public AtomVec {
   void grow(int);
   void grow_reset();
   void copy(int, int, int);
+  int permute(int, int *);
   virtual int pack_comm(int, int *, double *, int, int *);
   virtual int pack_comm_vel(int, int *, double *, int, int *);
   virtual void unpack_comm(int, int, double *);
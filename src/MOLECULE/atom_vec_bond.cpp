@@ -133,6 +133,28 @@ void AtomVecBond::copy(int i, int j, int delflag)
       modify->fix[atom->extra_grow[iextra]]->copy_arrays(i,j,delflag);
 }
 
+/* ----------------------------------------------------------------------
+   reorder 1st n atoms one per-atom array at a time
+   new atom I = old atom permute[I], fix arrays are left to Atom::sort()
+------------------------------------------------------------------------- */
+
+int AtomVecBond::permute(int n, int *permute)
+{
+  permute_array(tag,n,1,permute);
+  permute_array(type,n,1,permute);
+  permute_array(mask,n,1,permute);
+  permute_array(image,n,1,permute);
+  permute_array(x[0],n,3,permute);
+  permute_array(v[0],n,3,permute);
+  permute_array(molecule,n,1,permute);
+  permute_array(num_bond,n,1,permute);
+  permute_array(bond_type[0],n,atom->bond_per_atom,permute);
+  permute_array(bond_atom[0],n,atom->bond_per_atom,permute);
+  permute_array(nspecial[0],n,3,permute);
+  permute_array(special[0],n,atom->maxspecial,permute);
+  return 1;
+}
+
 /* ---------------------------------------------------------------------- */
 
 int AtomVecBond::pack_comm(int n, int *list, double *buf,
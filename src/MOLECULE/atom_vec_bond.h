@@ -30,6 +30,7 @@ class AtomVecBond : public AtomVec {
   void grow(int);
   void grow_reset();
   void copy(int, int, int);
+  int permute(int, int *);
   int pack_comm(int, int *, double *, int, int *);
   int pack_comm_vel(int, int *, double *, int, int *);
   void unpack_comm(int, int, double *);
@@ -213,6 +213,46 @@ void AtomVecFull::copy(int i, int j, int delflag)
       modify->fix[atom->extra_grow[iextra]]->copy_arrays(i,j,delflag);
 }
 
+/* ----------------------------------------------------------------------
+   reorder 1st n atoms one per-atom array at a time
+   new atom I = old atom permute[I], fix arrays are left to Atom::sort()
+------------------------------------------------------------------------- */
+
+int AtomVecFull::permute(int n, int *permute)
+{
+  permute_array(tag,n,1,permute);
+  permute_array(type,n,1,permute);
+  permute_array(mask,n,1,permute);
+  permute_array(image,n,1,permute);
+  permute_array(x[0],n,3,permute);
+  permute_array(v[0],n,3,permute);
+  permute_array(q,n,1,permute);
+  permute_array(molecule,n,1,permute);
+  permute_array(num_bond,n,1,permute);
+  permute_array(bond_type[0],n,atom->bond_per_atom,permute);
+  permute_array(bond_atom[0],n,atom->bond_per_atom,permute);
+  permute_array(num_angle,n,1,permute);
+  permute_array(angle_type[0],n,atom->angle_per_atom,permute);
+  permute_array(angle_atom1[0],n,atom->angle_per_atom,permute);
+  permute_array(angle_atom2[0],n,atom->angle_per_atom,permute);
+  permute_array(angle_atom3[0],n,atom->angle_per_atom,permute);
+  permute_array(num_dihedral,n,1,permute);
+  permute_array(dihedral_type[0],n,atom->dihedral_per_atom,permute);
+  permute_array(dihedral_atom1[0],n,atom->dihedral_per_atom,permute);
+  permute_array(dihedral_atom2[0],n,atom->dihedral_per_atom,permute);
+  permute_array(dihedral_atom3[0],n,atom->dihedral_per_atom,permute);
+  permute_array(dihedral_atom4[0],n,atom->dihedral_per_atom,permute);
+  permute_array(num_improper,n,1,permute);
+  permute_array(improper_type[0],n,atom->improper_per_atom,permute);
+  permute_array(improper_atom1[0],n,atom->improper_per_atom,permute);
+  permute_array(improper_atom2[0],n,atom->improper_per_atom,permute);
+  permute_array(improper_atom3[0],n,atom->improper_per_atom,permute);
+  permute_array(improper_atom4[0],n,atom->improper_per_atom,permute);
+  permute_array(nspecial[0],n,3,permute);
+  permute_array(special[0],n,atom->maxspecial,permute);
+  return 1;
+}
+
 /* ---------------------------------------------------------------------- */
 
 int AtomVecFull::pack_comm(int n, int *list, double *buf,
@@ -88,6 +88,8 @@ FixRattle::FixRattle(LAMMPS *lmp, int narg, char **arg) :
 
 FixRattle::~FixRattle()
 {
+  if (copymode) return;
+
   memory->destroy(vp);
 
 
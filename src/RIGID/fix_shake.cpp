@@ -231,6 +231,8 @@ FixShake::FixShake(LAMMPS *lmp, int narg, char **arg) :
 
 FixShake::~FixShake()
 {
+  if (copymode) return;
+
   // unregister callbacks to this fix from Atom class
 
   atom->delete_callback(id,0);
@@ -324,7 +326,7 @@ void FixShake::init()
 
   int count = 0;
   for (i = 0; i < modify->nfix; i++)
-    if (strcmp(modify->fix[i]->style,"shake") == 0) count++;
+    if (strncmp(modify->fix[i]->style,"shake",5) == 0) count++;
   if (count > 1) error->all(FLERR,"More than one fix shake");
 
   // cannot use with minimization since SHAKE turns off bonds
@@ -336,12 +338,12 @@ void FixShake::init()
   // error if npt,nph fix comes before shake fix
 
   for (i = 0; i < modify->nfix; i++) {
-    if (strcmp(modify->fix[i]->style,"npt") == 0) break;
-    if (strcmp(modify->fix[i]->style,"nph") == 0) break;
+    if (strncmp(modify->fix[i]->style,"npt",3) == 0) break;
+    if (strncmp(modify->fix[i]->style,"nph",3) == 0) break;
   }
   if (i < modify->nfix) {
     for (int j = i; j < modify->nfix; j++)
-      if (strcmp(modify->fix[j]->style,"shake") == 0)
+      if (strncmp(modify->fix[j]->style,"shake",5) == 0)
         error->all(FLERR,"Shake fix must come before NPT/NPH fix");
   }
 
@@ -48,6 +48,7 @@ extern "C" {
 #define MPI_UNDEFINED -1
 #define MPI_COMM_NULL -1
 #define MPI_GROUP_EMPTY -1
+#define MPI_REQUEST_NULL -1
 
 #define MPI_ANY_SOURCE -1
 #define MPI_STATUS_IGNORE NULL
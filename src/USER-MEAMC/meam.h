@@ -17,7 +17,9 @@ public:
   MEAM(Memory* mem);
   ~MEAM();
 
-private:
+  int copymode;
+
+protected:
   Memory* memory;
 
   // cutforce = force cutoff
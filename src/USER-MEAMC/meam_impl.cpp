@@ -25,6 +25,8 @@ using namespace LAMMPS_NS;
 MEAM::MEAM(Memory* mem)
   : memory(mem)
 {
+  copymode = 0;
+
   phir = phirar = phirar1 = phirar2 = phirar3 = phirar4 = phirar5 = phirar6 = NULL;
 
   nmax = 0;
@@ -38,6 +40,8 @@ MEAM::MEAM(Memory* mem)
 
 MEAM::~MEAM()
 {
+  if (copymode) return;
+
   memory->destroy(this->phirar6);
   memory->destroy(this->phirar5);
   memory->destroy(this->phirar4);
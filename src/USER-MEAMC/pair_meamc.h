@@ -42,7 +42,7 @@ class PairMEAMC : public Pair {
   void unpack_reverse_comm(int, int *, double *);
   double memory_usage();
 
- private:
+ protected:
   class MEAM *meam_inst;
   double cutmax;                // max cutoff for all elements
   int nelements;                // # of unique elements
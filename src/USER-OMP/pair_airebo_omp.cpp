@@ -86,6 +86,8 @@ void PairAIREBOOMP::compute(int eflag, int vflag)
 /* ----------------------------------------------------------------------
    create REBO neighbor list from main neighbor list
    REBO neighbor list stores neighbors of ghost atoms
+   the switching fn wij = Sp(rij) and its derivative of each REBO pair
+     are stored alongside, the same as PairAIREBO::REBO_neigh()
 ------------------------------------------------------------------------- */
 
 void PairAIREBOOMP::REBO_neigh_thr()
@@ -96,11 +98,14 @@ void PairAIREBOOMP::REBO_neigh_thr()
     maxlocal = atom->nmax;
     memory->destroy(REBO_numneigh);
     memory->sfree(REBO_firstneigh);
+    memory->sfree(REBO_firstw);
     memory->destroy(nC);
     memory->destroy(nH);
     memory->create(REBO_numneigh,maxlocal,"AIREBO:numneigh");
     REBO_firstneigh = (int **) memory->smalloc(maxlocal*sizeof(int *),
                                                "AIREBO:firstneigh");
+    REBO_firstw = (double **) memory->smalloc(maxlocal*sizeof(double *),
+                                              "AIREBO:firstw");
     memory->create(nC,maxlocal,"AIREBO:nC");
     memory->create(nH,maxlocal,"AIREBO:nH");
   }
@@ -110,9 +115,10 @@ void PairAIREBOOMP::REBO_neigh_thr()
 #endif
   {
     int i,j,ii,jj,n,jnum,itype,jtype;
-    double xtmp,ytmp,ztmp,delx,dely,delz,rsq,dS;
+    double xtmp,ytmp,ztmp,delx,dely,delz,rsq,wij,dwij;
     int *ilist,*jlist,*numneigh,**firstneigh;
     int *neighptr;
+    double *wptr;
 
     double **x = atom->x;
     int *type = atom->type;
@@ -137,13 +143,16 @@ void PairAIREBOOMP::REBO_neigh_thr()
 
     // each thread has its own page allocator
     MyPage<int> &ipg = ipage[tid];
+    MyPage<double> &wpg = wpage[tid];
     ipg.reset();
+    wpg.reset();
 
     for (ii = iifrom; ii < iito; ii++) {
       i = ilist[ii];
 
       n = 0;
       neighptr = ipg.vget();
+      wptr = wpg.vget();
 
       xtmp = x[i][0];
       ytmp = x[i][1];
@@ -163,18 +172,21 @@ void PairAIREBOOMP::REBO_neigh_thr()
         rsq = delx*delx + dely*dely + delz*delz;
 
         if (rsq < rcmaxsq[itype][jtype]) {
+          wij = Sp(sqrt(rsq),rcmin[itype][jtype],rcmax[itype][jtype],dwij);
+          wptr[2*n] = wij;
+          wptr[2*n+1] = dwij;
           neighptr[n++] = j;
-          if (jtype == 0)
-            nC[i] += Sp(sqrt(rsq),rcmin[itype][jtype],rcmax[itype][jtype],dS);
-          else
-            nH[i] += Sp(sqrt(rsq),rcmin[itype][jtype],rcmax[itype][jtype],dS);
+          if (jtype == 0) nC[i] += wij;
+          else nH[i] += wij;
         }
       }
 
       REBO_firstneigh[i] = neighptr;
+      REBO_firstw[i] = wptr;
       REBO_numneigh[i] = n;
       ipg.vgot(n);
-      if (ipg.status())
+      wpg.vgot(2*n);
+      if (ipg.status() || wpg.status())
         error->one(FLERR,"REBO list overflow, boost neigh_modify one");
     }
   }
@@ -237,7 +249,8 @@ void PairAIREBOOMP::FREBO_thr(int ifrom, int ito, int evflag, int eflag,
       delz = x[i][2] - x[j][2];
       rsq = delx*delx + dely*dely + delz*delz;
       rij = sqrt(rsq);
-      wij = Sp(rij,rcmin[itype][jtype],rcmax[itype][jtype],dwij);
+      wij = REBO_firstw[i][2*k];
+      dwij = REBO_firstw[i][2*k+1];
       if (wij <= TOL) continue;
 
       Qij = Q[itype][jtype];
@@ -383,7 +396,8 @@ void PairAIREBOOMP::FLJ_thr(int ifrom, int ito, int evflag, int eflag,
       if (testpath) {
 
         // test all 3-body paths = I-K-J
-        // I-K interactions come from atom I's REBO neighbors
+        // I-K interactions come from atom I's REBO neighbors,
+        //   wik is taken from the weights stored with them
         // if wik > current best, compute wkj
         // if best = 1.0, done
 
@@ -392,17 +406,16 @@ void PairAIREBOOMP::FLJ_thr(int ifrom, int ito, int evflag, int eflag,
           k = REBO_neighs_i[kk];
           if (k == j) continue;
           ktype = map[type[k]];
+          wik = REBO_firstw[i][2*kk];
 
-          delik[0] = x[i][0] - x[k][0];
-          delik[1] = x[i][1] - x[k][1];
-          delik[2] = x[i][2] - x[k][2];
-          rsq = delik[0]*delik[0] + delik[1]*delik[1] + delik[2]*delik[2];
-          if (rsq < rcmaxsq[itype][ktype]) {
+          if (wik > best) {
+            dwik = REBO_firstw[i][2*kk+1];
+            delik[0] = x[i][0] - x[k][0];
+            delik[1] = x[i][1] - x[k][1];
+            delik[2] = x[i][2] - x[k][2];
+            rsq = delik[0]*delik[0] + delik[1]*delik[1] + delik[2]*delik[2];
             rik = sqrt(rsq);
-            wik = Sp(rik,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
-          } else { dwik = wik = 0.0; rikS = rik = 1.0; }
 
-          if (wik > best) {
             deljk[0] = x[j][0] - x[k][0];
             deljk[1] = x[j][1] - x[k][1];
             deljk[2] = x[j][2] - x[k][2];
@@ -434,7 +447,8 @@ void PairAIREBOOMP::FLJ_thr(int ifrom, int ito, int evflag, int eflag,
             }
 
             // test all 4-body paths = I-K-M-J
-            // K-M interactions come from atom K's REBO neighbors
+            // K-M interactions come from atom K's REBO neighbors,
+            //   wkm is taken from the weights stored with them
             // if wik*wkm > current best, compute wmj
             // if best = 1.0, done
 
@@ -443,16 +457,17 @@ void PairAIREBOOMP::FLJ_thr(int ifrom, int ito, int evflag, int eflag,
               m = REBO_neighs_k[mm];
               if (m == i || m == j) continue;
               mtype = map[type[m]];
-              delkm[0] = x[k][0] - x[m][0];
-              delkm[1] = x[k][1] - x[m][1];
-              delkm[2] = x[k][2] - x[m][2];
-              rsq = delkm[0]*delkm[0] + delkm[1]*delkm[1] + delkm[2]*delkm[2];
-              if (rsq < rcmaxsq[ktype][mtype]) {
-                rkm = sqrt(rsq);
-                wkm = Sp(rkm,rcmin[ktype][mtype],rcmax[ktype][mtype],dwkm);
-              } else { dwkm = wkm = 0.0; rkmS = rkm = 1.0; }
+              wkm = REBO_firstw[k][2*mm];
 
               if (wik*wkm > best) {
+                dwkm = REBO_firstw[k][2*mm+1];
+                delkm[0] = x[k][0] - x[m][0];
+                delkm[1] = x[k][1] - x[m][1];
+                delkm[2] = x[k][2] - x[m][2];
+                rsq = delkm[0]*delkm[0] + delkm[1]*delkm[1] +
+                  delkm[2]*delkm[2];
+                rkm = sqrt(rsq);
+
                 deljm[0] = x[j][0] - x[m][0];
                 deljm[1] = x[j][1] - x[m][1];
                 deljm[2] = x[j][2] - x[m][2];
@@ -719,7 +734,8 @@ void PairAIREBOOMP::TORSION_thr(int ifrom, int ito, int evflag, int eflag,
       del23[1] = -del32[1];
       del23[2] = -del32[2];
       r23 = r32;
-      w23 = Sp(r23,rcmin[itype][jtype],rcmax[itype][jtype],dw23);
+      w23 = REBO_firstw[i][2*jj];
+      dw23 = REBO_firstw[i][2*jj+1];
 
       for (kk = 0; kk < REBO_numneigh[i]; kk++) {
         k = REBO_neighs_i[kk];
@@ -743,7 +759,8 @@ void PairAIREBOOMP::TORSION_thr(int ifrom, int ito, int evflag, int eflag,
         rjk2 = deljk[0]*deljk[0] + deljk[1]*deljk[1] + deljk[2]*deljk[2];
         rjk=sqrt(rjk2);
         rik2 = r21*r21;
-        w21 = Sp(r21,rcmin[itype][ktype],rcmax[itype][ktype],dw21);
+        w21 = REBO_firstw[i][2*kk];
+        dw21 = REBO_firstw[i][2*kk+1];
 
         rij = r32;
         rik = r21;
@@ -769,7 +786,8 @@ void PairAIREBOOMP::TORSION_thr(int ifrom, int ito, int evflag, int eflag,
           cos234 = MAX(cos234,-1.0);
           sin234 = sqrt(1.0 - cos234*cos234);
           if (sin234 < TOL) continue;
-          w34 = Sp(r34,rcmin[jtype][ltype],rcmax[jtype][ltype],dw34);
+          w34 = REBO_firstw[j][2*ll];
+          dw34 = REBO_firstw[j][2*ll+1];
           delil[0] = del23[0] + del34[0];
           delil[1] = del23[1] + del34[1];
           delil[2] = del23[2] + del34[2];
@@ -1075,7 +1093,7 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
       rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
       lamdajik = 4.0*kronecker(itype,1) *
         ((rho[ktype][1]-rikmag)-(rho[jtype][1]-rijmag));
-      wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dS);
+      wik = REBO_firstw[i][2*k];
       Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
         (wik*kronecker(itype,1));
       cosjik = ((rij[0]*rik[0])+(rij[1]*rik[1])+(rij[2]*rik[2])) /
@@ -1115,7 +1133,8 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
       rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
       lamdajik = 4.0*kronecker(itype,1) *
         ((rho[ktype][1]-rikmag)-(rho[jtype][1]-rijmag));
-      wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+      wik = REBO_firstw[i][2*k];
+      dwik = REBO_firstw[i][2*k+1];
 
       const double invrikm = 1.0/rikmag;
       const double invrijkm = invrijm*invrikm;
@@ -1221,7 +1240,7 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
       rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
       lamdaijl = 4.0*kronecker(jtype,1) *
         ((rho[ltype][1]-rjlmag)-(rho[itype][1]-rijmag));
-      wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dS);
+      wjl = REBO_firstw[j][2*l];
       Nlj = nC[atoml]-(wjl*kronecker(jtype,0)) +
         nH[atoml]-(wjl*kronecker(jtype,1));
       cosijl = -1.0*((rij[0]*rjl[0])+(rij[1]*rjl[1])+(rij[2]*rjl[2])) /
@@ -1256,7 +1275,8 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
       rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
       lamdaijl = 4.0*kronecker(jtype,1) *
         ((rho[ltype][1]-rjlmag)-(rho[itype][1]-rijmag));
-      wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+      wjl = REBO_firstw[j][2*l];
+      dwjl = REBO_firstw[j][2*l+1];
 
       const double invrjlm = 1.0/rjlmag;
       const double invrijlm = invrijm*invrjlm;
@@ -1365,7 +1385,8 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
       rik[1] = x[atomi][1]-x[atomk][1];
       rik[2] = x[atomi][2]-x[atomk][2];
       rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
-      wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+      wik = REBO_firstw[i][2*k];
+      dwik = REBO_firstw[i][2*k+1];
       Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
         (wik*kronecker(itype,1));
       SpN = Sp(Nki,Nmin,Nmax,dNki);
@@ -1404,7 +1425,7 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
             rkn[1] = x[atomk][1]-x[atomn][1];
             rkn[2] = x[atomk][2]-x[atomn][2];
             rknmag = sqrt((rkn[0]*rkn[0])+(rkn[1]*rkn[1])+(rkn[2]*rkn[2]));
-            Sp(rknmag,rcmin[ktype][ntype],rcmax[ktype][ntype],dwkn);
+            dwkn = REBO_firstw[atomk][2*n+1];
 
             tmp2 = VA*dN3[2]*(2.0*NconjtmpI*wik*dNki*dwkn)/rknmag;
             f[atomk][0] -= tmp2*rkn[0];
@@ -1432,7 +1453,8 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
       rjl[1] = x[atomj][1]-x[atoml][1];
       rjl[2] = x[atomj][2]-x[atoml][2];
       rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
-      wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+      wjl = REBO_firstw[atomj][2*l];
+      dwjl = REBO_firstw[atomj][2*l+1];
       Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
         (wjl*kronecker(jtype,1));
       SpN = Sp(Nlj,Nmin,Nmax,dNlj);
@@ -1471,7 +1493,7 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
             rln[1] = x[atoml][1]-x[atomn][1];
             rln[2] = x[atoml][2]-x[atomn][2];
             rlnmag = sqrt((rln[0]*rln[0])+(rln[1]*rln[1])+(rln[2]*rln[2]));
-            Sp(rlnmag,rcmin[ltype][ntype],rcmax[ltype][ntype],dwln);
+            dwln = REBO_firstw[atoml][2*n+1];
 
             tmp2 = VA*dN3[2]*(2.0*NconjtmpJ*wjl*dNlj*dwln)/rlnmag;
             f[atoml][0] -= tmp2*rln[0];
@@ -1716,7 +1738,8 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
         rik[1] = x[atomi][1]-x[atomk][1];
         rik[2] = x[atomi][2]-x[atomk][2];
         rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
-        wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+        wik = REBO_firstw[i][2*k];
+        dwik = REBO_firstw[i][2*k+1];
         Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
           (wik*kronecker(itype,1));
         SpN = Sp(Nki,Nmin,Nmax,dNki);
@@ -1755,7 +1778,7 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
               rkn[1] = x[atomk][1]-x[atomn][1];
               rkn[2] = x[atomk][2]-x[atomn][2];
               rknmag = sqrt((rkn[0]*rkn[0])+(rkn[1]*rkn[1])+(rkn[2]*rkn[2]));
-              Sp(rknmag,rcmin[ktype][ntype],rcmax[ktype][ntype],dwkn);
+              dwkn = REBO_firstw[atomk][2*n+1];
 
               tmp2 = VA*dN3[2]*(2.0*NconjtmpI*wik*dNki*dwkn)*Etmp/rknmag;
               f[atomk][0] -= tmp2*rkn[0];
@@ -1783,7 +1806,8 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
         rjl[1] = x[atomj][1]-x[atoml][1];
         rjl[2] = x[atomj][2]-x[atoml][2];
         rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
-        wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+        wjl = REBO_firstw[j][2*l];
+        dwjl = REBO_firstw[j][2*l+1];
         Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
           (wjl*kronecker(jtype,1));
         SpN = Sp(Nlj,Nmin,Nmax,dNlj);
@@ -1822,7 +1846,7 @@ double PairAIREBOOMP::bondorder_thr(int i, int j, double rij[3], double rijmag,
               rln[1] = x[atoml][1]-x[atomn][1];
               rln[2] = x[atoml][2]-x[atomn][2];
               rlnmag = sqrt((rln[0]*rln[0])+(rln[1]*rln[1])+(rln[2]*rln[2]));
-              Sp(rlnmag,rcmin[ltype][ntype],rcmax[ltype][ntype],dwln);
+              dwln = REBO_firstw[atoml][2*n+1];
 
               tmp2 = VA*dN3[2]*(2.0*NconjtmpJ*wjl*dNlj*dwln)*Etmp/rlnmag;
               f[atoml][0] -= tmp2*rln[0];
@@ -1939,7 +1963,7 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
       rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
       lamdajik = 4.0*kronecker(itype,1) *
         ((rho[ktype][1]-rikmag)-(rho[jtype][1]-rijmag_mod));
-      wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dS);
+      wik = REBO_firstw[i][2*k];
       Nki = nC[atomk]-(wik*kronecker(itype,0))+
         nH[atomk]-(wik*kronecker(itype,1));
       cosjik = ((rij[0]*rik[0])+(rij[1]*rik[1])+(rij[2]*rik[2])) /
@@ -1980,7 +2004,7 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
       rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
       lamdaijl = 4.0*kronecker(jtype,1) *
         ((rho[ltype][1]-rjlmag)-(rho[itype][1]-rijmag_mod));
-      wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dS);
+      wjl = REBO_firstw[j][2*l];
       Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
         (wjl*kronecker(jtype,1));
       cosijl = -1.0*((rij[0]*rjl[0])+(rij[1]*rjl[1])+(rij[2]*rjl[2])) /
@@ -2115,7 +2139,8 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
         rikmag = sqrt(rik[0]*rik[0] + rik[1]*rik[1] + rik[2]*rik[2]);
         lamdajik = 4.0*kronecker(itype,1) *
           ((rho[ktype][1]-rikmag)-(rho[jtype][1]-rijmag_mod));
-        wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+        wik = REBO_firstw[i][2*k];
+        dwik = REBO_firstw[i][2*k+1];
         cosjik = (rij[0]*rik[0] + rij[1]*rik[1] + rij[2]*rik[2]) /
           (rijmag*rikmag);
         cosjik = MIN(cosjik,1.0);
@@ -2220,7 +2245,8 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
         rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
         lamdaijl = 4.0*kronecker(jtype,1) *
           ((rho[ltype][1]-rjlmag)-(rho[itype][1]-rijmag_mod));
-        wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+        wjl = REBO_firstw[j][2*l];
+        dwjl = REBO_firstw[j][2*l+1];
         cosijl = (-1.0*((rij[0]*rjl[0])+(rij[1]*rjl[1])+(rij[2]*rjl[2]))) /
           (rijmag*rjlmag);
         cosijl = MIN(cosijl,1.0);
@@ -2322,7 +2348,8 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
         rik[1] = x[atomi][1]-x[atomk][1];
         rik[2] = x[atomi][2]-x[atomk][2];
         rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
-        wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+        wik = REBO_firstw[i][2*k];
+        dwik = REBO_firstw[i][2*k+1];
         Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
           (wik*kronecker(itype,1));
         SpN = Sp(Nki,Nmin,Nmax,dNki);
@@ -2361,7 +2388,7 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
               rkn[1] = x[atomk][1]-x[atomn][1];
               rkn[2] = x[atomk][2]-x[atomn][2];
               rknmag = sqrt((rkn[0]*rkn[0])+(rkn[1]*rkn[1])+(rkn[2]*rkn[2]));
-              Sp(rknmag,rcmin[ktype][ntype],rcmax[ktype][ntype],dwkn);
+              dwkn = REBO_firstw[atomk][2*n+1];
 
               tmp2 = VA*dN3[2]*(2.0*NconjtmpI*wik*dNki*dwkn)/rknmag;
               f[atomk][0] -= tmp2*rkn[0];
@@ -2389,7 +2416,8 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
         rjl[1] = x[atomj][1]-x[atoml][1];
         rjl[2] = x[atomj][2]-x[atoml][2];
         rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
-        wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+        wjl = REBO_firstw[atomj][2*l];
+        dwjl = REBO_firstw[atomj][2*l+1];
         Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
           (wjl*kronecker(jtype,1));
         SpN = Sp(Nlj,Nmin,Nmax,dNlj);
@@ -2428,7 +2456,7 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
               rln[1] = x[atoml][1]-x[atomn][1];
               rln[2] = x[atoml][2]-x[atomn][2];
               rlnmag = sqrt((rln[0]*rln[0])+(rln[1]*rln[1])+(rln[2]*rln[2]));
-              Sp(rlnmag,rcmin[ltype][ntype],rcmax[ltype][ntype],dwln);
+              dwln = REBO_firstw[atoml][2*n+1];
 
               tmp2 = VA*dN3[2]*(2.0*NconjtmpJ*wjl*dNlj*dwln)/rlnmag;
               f[atoml][0] -= tmp2*rln[0];
@@ -2664,7 +2692,8 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
           rik[1] = x[atomi][1]-x[atomk][1];
           rik[2] = x[atomi][2]-x[atomk][2];
           rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
-          wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+          wik = REBO_firstw[i][2*k];
+          dwik = REBO_firstw[i][2*k+1];
           Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
             (wik*kronecker(itype,1));
           SpN = Sp(Nki,Nmin,Nmax,dNki);
@@ -2703,7 +2732,7 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
                 rkn[1] = x[atomk][1]-x[atomn][1];
                 rkn[2] = x[atomk][2]-x[atomn][2];
                 rknmag = sqrt((rkn[0]*rkn[0])+(rkn[1]*rkn[1])+(rkn[2]*rkn[2]));
-                Sp(rknmag,rcmin[ktype][ntype],rcmax[ktype][ntype],dwkn);
+                dwkn = REBO_firstw[atomk][2*n+1];
 
                 tmp2 = VA*dN3[2]*(2.0*NconjtmpI*wik*dNki*dwkn)*Etmp/rknmag;
                 f[atomk][0] -= tmp2*rkn[0];
@@ -2731,7 +2760,8 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
           rjl[1] = x[atomj][1]-x[atoml][1];
           rjl[2] = x[atomj][2]-x[atoml][2];
           rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
-          wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+          wjl = REBO_firstw[j][2*l];
+          dwjl = REBO_firstw[j][2*l+1];
           Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
             (wjl*kronecker(jtype,1));
           SpN = Sp(Nlj,Nmin,Nmax,dNlj);
@@ -2770,7 +2800,7 @@ double PairAIREBOOMP::bondorderLJ_thr(int i, int j, double rij_mod[3], double ri
                 rln[1] = x[atoml][1]-x[atomn][1];
                 rln[2] = x[atoml][2]-x[atomn][2];
                 rlnmag = sqrt((rln[0]*rln[0])+(rln[1]*rln[1])+(rln[2]*rln[2]));
-                Sp(rlnmag,rcmin[ltype][ntype],rcmax[ltype][ntype],dwln);
+                dwln = REBO_firstw[atoml][2*n+1];
 
                 tmp2 = VA*dN3[2]*(2.0*NconjtmpJ*wjl*dNlj*dwln)*Etmp/rlnmag;
                 f[atoml][0] -= tmp2*rln[0];
@@ -0,0 +1,43 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+   based on PairTersoffOMP by Axel Kohlmeyer (Temple U)
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(gw/omp,PairGWOMP)
+
+#else
+
+#ifndef LMP_PAIR_GW_OMP_H
+#define LMP_PAIR_GW_OMP_H
+
+#include "pair_gw.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairGWOMP : public PairGW, public ThrOMP {
+
+ public:
+  PairGWOMP(class LAMMPS *);
+
+  virtual void compute(int, int);
+  virtual double memory_usage();
+
+ private:
+  template <int EVFLAG, int EFLAG, int VFLAG_ATOM>
+  void eval(int ifrom, int ito, ThrData * const thr);
+};
+
+}
+
+#endif
+#endif
@@ -0,0 +1,45 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(gw/zbl/omp,PairGWZBLOMP)
+
+#else
+
+#ifndef LMP_PAIR_GW_ZBL_OMP_H
+#define LMP_PAIR_GW_ZBL_OMP_H
+
+#include "pair_gw_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairGWZBLOMP : public PairGWOMP {
+ public:
+  PairGWZBLOMP(class LAMMPS *);
+  virtual ~PairGWZBLOMP() {}
+
+ protected:
+  double global_a_0;                // Bohr radius for Coulomb repulsion
+  double global_epsilon_0;        // permittivity of vacuum for Coulomb repulsion
+  double global_e;                // proton charge (negative of electron charge)
+
+  virtual void read_file(char *);
+  virtual void repulsive(Param *, double, double &, int, double &);
+
+  virtual double gw_fa(double, Param *);
+  virtual double gw_fa_d(double, Param *);
+
+  double F_fermi(double, Param *);
+  double F_fermi_d(double, Param *);
+};
+
+}
+
+#endif
+#endif
@@ -0,0 +1,54 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+   based on PairAIREBOOMP by Axel Kohlmeyer (Temple U)
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(lcbop/omp,PairLCBOPOMP)
+
+#else
+
+#ifndef LMP_PAIR_LCBOP_OMP_H
+#define LMP_PAIR_LCBOP_OMP_H
+
+#include "pair_lcbop.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairLCBOPOMP : public PairLCBOP, public ThrOMP {
+
+ public:
+  PairLCBOPOMP(class LAMMPS *);
+
+  virtual void compute(int, int);
+  virtual double memory_usage();
+
+ protected:
+  void SR_neigh_thr();
+  void FSR_thr(int ifrom, int ito, int evflag, int eflag,
+               int vflag_atom, ThrData * const thr);
+  void FLR_thr(int ifrom, int ito, int evflag, int eflag,
+               int vflag_atom, ThrData * const thr);
+  void FNij_thr(int i, int j, double factor, int vflag_atom,
+                ThrData * const thr);
+  void FMij_thr(int i, int j, double factor, int vflag_atom,
+                ThrData * const thr);
+  double bondorder_thr(int i, int j, double rij[3], double rijmag,
+                       double VA, int vflag_atom, ThrData * const thr);
+  double b_thr(int i, int j, double rij[3], double rijmag,
+               double VA, int vflag_atom, ThrData * const thr);
+};
+
+}
+
+#endif
+#endif
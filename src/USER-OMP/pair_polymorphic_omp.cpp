@@ -0,0 +1,402 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   This software is distributed under the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include <string.h>
+#include "pair_polymorphic_omp.h"
+#include "atom.h"
+#include "comm.h"
+#include "force.h"
+#include "memory.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+
+#include "suffix.h"
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairPolymorphicOMP::PairPolymorphicOMP(LAMMPS *lmp) :
+  PairPolymorphic(lmp), ThrOMP(lmp, THR_PAIR)
+{
+  suffix_flag |= Suffix::OMP;
+  respa_enable = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairPolymorphicOMP::compute(int eflag, int vflag)
+{
+  if (eflag || vflag) {
+    ev_setup(eflag,vflag);
+  } else evflag = vflag_fdotr = vflag_atom = 0;
+
+  const int nall = atom->nlocal + atom->nghost;
+  const int nthreads = comm->nthreads;
+  const int inum = list->inum;
+
+#if defined(_OPENMP)
+#pragma omp parallel default(none) shared(eflag,vflag)
+#endif
+  {
+    int ifrom, ito, tid;
+
+    loop_setup_thr(ifrom, ito, tid, inum, nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+    ev_setup_thr(eflag, vflag, nall, eatom, vatom, thr);
+
+    if (evflag) {
+      if (eflag) {
+        if (vflag_atom) eval<1,1,1>(ifrom, ito, thr);
+        else eval<1,1,0>(ifrom, ito, thr);
+      } else {
+        if (vflag_atom) eval<1,0,1>(ifrom, ito, thr);
+        else eval<1,0,0>(ifrom, ito, thr);
+      }
+    } else eval<0,0,0>(ifrom, ito, thr);
+
+    thr->timer(Timer::PAIR);
+    reduce_thr(this, eflag, vflag, thr);
+  } // end of omp parallel region
+}
+
+/* ----------------------------------------------------------------------
+   the V and W neighbor lists of each atom are built in per-thread
+   arrays, delV and delW hold delx,dely,delz,r of each entry
+------------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int VFLAG_ATOM>
+void PairPolymorphicOMP::eval(int iifrom, int iito, ThrData * const thr)
+{
+  tagint itag,jtag;
+  int i,j,k,ii,jj,kk,kk1,jnum;
+  int itype,jtype,ktype;
+  int iparam_ii,iparam_jj,iparam_kk,iparam_ij,iparam_ik,iparam_ijk;
+  double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
+  double rsq,r0,r1,r2;
+  double delr1[3],delr2[3],fi[3],fj[3],fk[3];
+  double zeta_ij,prefactor,wfac,pfac,gfac,fa,fa_d,bij,bij_d;
+  double costheta;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+  double emb;
+
+  int neighsize_thr,numneighV_thr,numneighW_thr,numneighW1_thr;
+  int *neighV_thr,*neighW_thr,*neighW1_thr;
+  double **delV_thr,**delW_thr;
+
+  evdwl = 0.0;
+  delx = dely = delz = 0.0;
+  emb = 0.0;
+
+  const dbl3_t * _noalias const x = (dbl3_t *) atom->x[0];
+  dbl3_t * _noalias const f = (dbl3_t *) thr->get_f()[0];
+  const tagint * _noalias const tag = atom->tag;
+  const int * _noalias const type = atom->type;
+  const int nlocal = atom->nlocal;
+
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+
+  neighsize_thr = neighsize;
+  memory->create(neighV_thr,neighsize_thr,"pair_thr:neighV_thr");
+  memory->create(neighW_thr,neighsize_thr,"pair_thr:neighW_thr");
+  memory->create(neighW1_thr,neighsize_thr,"pair_thr:neighW1_thr");
+  memory->create(delV_thr,neighsize_thr,4,"pair_thr:delV_thr");
+  memory->create(delW_thr,neighsize_thr,4,"pair_thr:delW_thr");
+
+  // loop over full neighbor list of my atoms
+
+  for (ii = iifrom; ii < iito; ++ii) {
+    i = ilist[ii];
+    itag = tag[i];
+    itype = map[type[i]];
+    xtmp = x[i].x;
+    ytmp = x[i].y;
+    ztmp = x[i].z;
+
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    if (neighsize_thr < jnum) {
+      neighsize_thr = jnum + 20;
+      memory->grow(neighV_thr,neighsize_thr,"pair_thr:neighV_thr");
+      memory->grow(neighW_thr,neighsize_thr,"pair_thr:neighW_thr");
+      memory->grow(neighW1_thr,neighsize_thr,"pair_thr:neighW1_thr");
+      memory->grow(delV_thr,neighsize_thr,4,"pair_thr:delV_thr");
+      memory->grow(delW_thr,neighsize_thr,4,"pair_thr:delW_thr");
+    }
+
+    if (eta) {
+      iparam_ii = elem2param[itype][itype];
+      PairParameters & p = pairParameters[iparam_ii];
+      emb = (p.F)->get_vmax();
+    }
+
+    numneighV_thr = -1;
+    numneighW_thr = -1;
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      j &= NEIGHMASK;
+      jtype = map[type[j]];
+
+      delx = xtmp - x[j].x;
+      dely = ytmp - x[j].y;
+      delz = ztmp - x[j].z;
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq >= cutmaxsq) continue;
+      r0 = sqrt(rsq);
+
+      iparam_ij = elem2param[itype][jtype];
+      PairParameters & p = pairParameters[iparam_ij];
+
+// do not include the neighbor if get_vmax() <= epsilon because the function is near zero
+      if (eta) {
+        if (emb > epsilon) {
+          iparam_jj = elem2param[jtype][jtype];
+          PairParameters & q = pairParameters[iparam_jj];
+          if (rsq < (q.W)->get_xmaxsq() && (q.W)->get_vmax() > epsilon) {
+            numneighW_thr = numneighW_thr + 1;
+            neighW_thr[numneighW_thr] = j;
+            delW_thr[numneighW_thr][0] = delx;
+            delW_thr[numneighW_thr][1] = dely;
+            delW_thr[numneighW_thr][2] = delz;
+            delW_thr[numneighW_thr][3] = r0;
+          }
+        }
+      } else {
+        if ((p.F)->get_vmax() > epsilon) {
+          if (rsq < (p.V)->get_xmaxsq() && (p.V)->get_vmax() > epsilon) {
+            numneighV_thr = numneighV_thr + 1;
+            neighV_thr[numneighV_thr] = j;
+            delV_thr[numneighV_thr][0] = delx;
+            delV_thr[numneighV_thr][1] = dely;
+            delV_thr[numneighV_thr][2] = delz;
+            delV_thr[numneighV_thr][3] = r0;
+          }
+          if (rsq < (p.W)->get_xmaxsq() && (p.W)->get_vmax() > epsilon) {
+            numneighW_thr = numneighW_thr + 1;
+            neighW_thr[numneighW_thr] = j;
+            delW_thr[numneighW_thr][0] = delx;
+            delW_thr[numneighW_thr][1] = dely;
+            delW_thr[numneighW_thr][2] = delz;
+            delW_thr[numneighW_thr][3] = r0;
+          }
+        }
+      }
+
+    // two-body interactions, skip half of them
+
+      jtag = tag[j];
+      if (itag > jtag) {
+        if ((itag+jtag) % 2 == 0) continue;
+      } else if (itag < jtag) {
+        if ((itag+jtag) % 2 == 1) continue;
+      } else {
+        if (x[j].z < ztmp) continue;
+        if (x[j].z == ztmp && x[j].y < ytmp) continue;
+        if (x[j].z == ztmp && x[j].y == ytmp && x[j].x < xtmp) continue;
+      }
+
+      if (rsq >= (p.U)->get_xmaxsq() || (p.U)->get_vmax() <= epsilon) continue;
+      (p.U)->value(r0,evdwl,EFLAG,fpair,1);
+      fpair = -fpair/r0;
+
+      f[i].x += delx*fpair;
+      f[i].y += dely*fpair;
+      f[i].z += delz*fpair;
+      f[j].x -= delx*fpair;
+      f[j].y -= dely*fpair;
+      f[j].z -= delz*fpair;
+
+      if (EVFLAG) ev_tally_thr(this,i,j,nlocal,/* newton_pair */ 1,
+                               evdwl,0.0,fpair,delx,dely,delz,thr);
+    }
+
+    if (eta) {
+
+      if (emb > epsilon) {
+
+        iparam_ii = elem2param[itype][itype];
+        PairParameters & p = pairParameters[iparam_ii];
+
+        // accumulate bondorder zeta for each i-j interaction via loop over k
+
+        zeta_ij = 0.0;
+
+        for (kk = 0; kk <= numneighW_thr; kk++) {
+          k = neighW_thr[kk];
+          ktype = map[type[k]];
+
+          iparam_kk = elem2param[ktype][ktype];
+          PairParameters & q = pairParameters[iparam_kk];
+
+          (q.W)->value(delW_thr[kk][3],wfac,1,fpair,0);
+
+          zeta_ij += wfac;
+        }
+
+        // pairwise force due to zeta
+
+        (p.F)->value(zeta_ij,bij,1,bij_d,1);
+
+        prefactor = 0.5* bij_d;
+        if (EFLAG) evdwl = -0.5*bij;
+
+        if (EVFLAG) ev_tally_thr(this,i,i,nlocal,/* newton_pair */ 1,
+                                 evdwl,0.0,0.0,delx,dely,delz,thr);
+
+        // attractive term via loop over k
+
+        for (kk = 0; kk <= numneighW_thr; kk++) {
+          k = neighW_thr[kk];
+          ktype = map[type[k]];
+
+          delr2[0] = -delW_thr[kk][0];
+          delr2[1] = -delW_thr[kk][1];
+          delr2[2] = -delW_thr[kk][2];
+          r2 = delW_thr[kk][3];
+
+          iparam_kk = elem2param[ktype][ktype];
+          PairParameters & q = pairParameters[iparam_kk];
+
+          (q.W)->value(r2,wfac,0,fpair,1);
+          fpair = -prefactor*fpair/r2;
+
+          f[i].x += delr2[0]*fpair;
+          f[i].y += delr2[1]*fpair;
+          f[i].z += delr2[2]*fpair;
+          f[k].x -= delr2[0]*fpair;
+          f[k].y -= delr2[1]*fpair;
+          f[k].z -= delr2[2]*fpair;
+
+          if (VFLAG_ATOM) v_tally2_thr(i,k,-fpair,delr2,thr);
+        }
+      }
+
+    } else {
+
+      for (jj = 0; jj <= numneighV_thr; jj++) {
+        j = neighV_thr[jj];
+        jtype = map[type[j]];
+
+        iparam_ij = elem2param[itype][jtype];
+        PairParameters & p = pairParameters[iparam_ij];
+
+        delr1[0] = -delV_thr[jj][0];
+        delr1[1] = -delV_thr[jj][1];
+        delr1[2] = -delV_thr[jj][2];
+        r1 = delV_thr[jj][3];
+
+        // accumulate bondorder zeta for each i-j interaction via loop over k
+
+        zeta_ij = 0.0;
+
+        numneighW1_thr = -1;
+        for (kk = 0; kk <= numneighW_thr; kk++) {
+          k = neighW_thr[kk];
+          if (j == k) continue;
+          ktype = map[type[k]];
+          iparam_ijk = elem3param[jtype][itype][ktype];
+          TripletParameters & trip = tripletParameters[iparam_ijk];
+          if ((trip.G)->get_vmax() <= epsilon) continue;
+
+          numneighW1_thr = numneighW1_thr + 1;
+          neighW1_thr[numneighW1_thr] = kk;
+
+          delr2[0] = -delW_thr[kk][0];
+          delr2[1] = -delW_thr[kk][1];
+          delr2[2] = -delW_thr[kk][2];
+          r2 = delW_thr[kk][3];
+
+          costheta = (delr1[0]*delr2[0] + delr1[1]*delr2[1] +
+                      delr1[2]*delr2[2]) / (r1*r2);
+
+          iparam_ik = elem2param[itype][ktype];
+          PairParameters & q = pairParameters[iparam_ik];
+
+          (q.W)->value(r2,wfac,1,fpair,0);
+          (q.P)->value(r1-(p.xi)*r2,pfac,1,fpair,0);
+          (trip.G)->value(costheta,gfac,1,fpair,0);
+
+          zeta_ij += wfac*pfac*gfac;
+        }
+
+        // pairwise force due to zeta
+
+        (p.V)->value(r1,fa,1,fa_d,1);
+        (p.F)->value(zeta_ij,bij,1,bij_d,1);
+        fpair = -0.5*bij*fa_d / r1;
+        prefactor = 0.5* fa * bij_d;
+        if (EFLAG) evdwl = -0.5*bij*fa;
+
+        f[i].x += delr1[0]*fpair;
+        f[i].y += delr1[1]*fpair;
+        f[i].z += delr1[2]*fpair;
+        f[j].x -= delr1[0]*fpair;
+        f[j].y -= delr1[1]*fpair;
+        f[j].z -= delr1[2]*fpair;
+
+        if (EVFLAG) ev_tally_thr(this,i,j,nlocal,/* newton_pair */ 1,evdwl,0.0,
+                                 -fpair,-delr1[0],-delr1[1],-delr1[2],thr);
+
+        // attractive term via loop over k
+
+        for (kk1 = 0; kk1 <= numneighW1_thr; kk1++) {
+          kk = neighW1_thr[kk1];
+          k = neighW_thr[kk];
+          ktype = map[type[k]];
+          iparam_ijk = elem3param[jtype][itype][ktype];
+          TripletParameters & trip = tripletParameters[iparam_ijk];
+
+          delr2[0] = -delW_thr[kk][0];
+          delr2[1] = -delW_thr[kk][1];
+          delr2[2] = -delW_thr[kk][2];
+          r2 = delW_thr[kk][3];
+
+          iparam_ik = elem2param[itype][ktype];
+          PairParameters & q = pairParameters[iparam_ik];
+
+          attractive(&q,&trip,prefactor,r1,r2,delr1,delr2,fi,fj,fk);
+
+          f[i].x += fi[0];
+          f[i].y += fi[1];
+          f[i].z += fi[2];
+          f[j].x += fj[0];
+          f[j].y += fj[1];
+          f[j].z += fj[2];
+          f[k].x += fk[0];
+          f[k].y += fk[1];
+          f[k].z += fk[2];
+
+          if (VFLAG_ATOM) v_tally3_thr(i,j,k,fj,fk,delr1,delr2,thr);
+        }
+      }
+    }
+  }
+
+  memory->destroy(neighV_thr);
+  memory->destroy(neighW_thr);
+  memory->destroy(neighW1_thr);
+  memory->destroy(delV_thr);
+  memory->destroy(delW_thr);
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairPolymorphicOMP::memory_usage()
+{
+  double bytes = memory_usage_thr();
+  bytes += PairPolymorphic::memory_usage();
+
+  return bytes;
+}
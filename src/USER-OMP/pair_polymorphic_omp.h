@@ -0,0 +1,39 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(polymorphic/omp,PairPolymorphicOMP)
+
+#else
+
+#ifndef LMP_PAIR_POLYMORPHIC_OMP_H
+#define LMP_PAIR_POLYMORPHIC_OMP_H
+
+#include "pair_polymorphic.h"
+#include "thr_omp.h"
+
+namespace LAMMPS_NS {
+
+class PairPolymorphicOMP : public PairPolymorphic, public ThrOMP {
+
+ public:
+  PairPolymorphicOMP(class LAMMPS *);
+
+  virtual void compute(int, int);
+  virtual double memory_usage();
+
+ private:
+  template <int EVFLAG, int EFLAG, int VFLAG_ATOM>
+  void eval(int ifrom, int ito, ThrData * const thr);
+};
+
+}
+
+#endif
+#endif
@@ -17,6 +17,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <algorithm>
 #include "atom.h"
 #include "style_atom.h"
 #include "atom_vec.h"
@@ -53,6 +54,7 @@ using namespace MathConst;
 #define MAXWORD 300
 #define MAXELEMENT 100
 enum{LAYOUT_UNIFORM,LAYOUT_NONUNIFORM,LAYOUT_TILED};    // several files
+enum{SORT_XYZ,SORT_MORTON,SORT_HILBERT};
 
 /* ---------------------------------------------------------------------- */
 
@@ -68,8 +70,10 @@ Atom::Atom(LAMMPS *lmp) : Pointers(lmp)
   sortfreq = 1000;
   nextsort = 0;
   userbinsize = 0.0;
+  sortorder = SORT_XYZ;
   maxbin = maxnext = 0;
   binhead = NULL;
+  binorder = NULL;
   next = permute = NULL;
 
   // initialize atom arrays
@@ -265,6 +269,7 @@ Atom::~Atom()
 
   delete [] firstgroupname;
   memory->destroy(binhead);
+  memory->destroy(binorder);
   memory->destroy(next);
   memory->destroy(permute);
 
@@ -426,6 +431,7 @@ void Atom::settings(Atom *old)
   map_style = old->map_style;
   sortfreq = old->sortfreq;
   userbinsize = old->userbinsize;
+  sortorder = old->sortorder;
   if (old->firstgroupname) {
     int n = strlen(old->firstgroupname) + 1;
     firstgroupname = new char[n];
@@ -656,6 +662,13 @@ void Atom::modify_params(int narg, char **arg)
         error->all(FLERR,"Atom_modify sort and first options "
                    "cannot be used together");
       iarg += 3;
+    } else if (strcmp(arg[iarg],"sort/order") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal atom_modify command");
+      if (strcmp(arg[iarg+1],"xyz") == 0) sortorder = SORT_XYZ;
+      else if (strcmp(arg[iarg+1],"morton") == 0) sortorder = SORT_MORTON;
+      else if (strcmp(arg[iarg+1],"hilbert") == 0) sortorder = SORT_HILBERT;
+      else error->all(FLERR,"Illegal atom_modify command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal atom_modify command");
   }
 }
@@ -2035,6 +2048,7 @@ void Atom::sort()
     iy = MIN(iy,nbiny-1);
     iz = MIN(iz,nbinz-1);
     ibin = iz*nbiny*nbinx + iy*nbinx + ix;
+    if (sortorder != SORT_XYZ) ibin = binorder[ibin];
     next[i] = binhead[ibin];
     binhead[ibin] = i;
   }
@@ -2051,6 +2065,12 @@ void Atom::sort()
     }
   }
 
+  // atom styles that support it apply permute one per-atom array at a time
+  // then only per-atom arrays of fixes are left to reorder below
+
+  int fixonly = avec->permute(nlocal,permute);
+  if (fixonly && nextra_grow == 0) return;
+
   // current = current permutation, just reuse next vector
   // current[I] = J means Ith current atom is Jth old atom
 
@@ -2066,13 +2086,13 @@ void Atom::sort()
 
   for (i = 0; i < nlocal; i++) {
     if (current[i] == permute[i]) continue;
-    avec->copy(i,nlocal,0);
+    sort_copy(i,nlocal,fixonly);
     empty = i;
     while (permute[empty] != i) {
-      avec->copy(permute[empty],empty,0);
+      sort_copy(permute[empty],empty,fixonly);
       empty = current[empty] = permute[empty];
     }
-    avec->copy(nlocal,empty,0);
+    sort_copy(nlocal,empty,fixonly);
     current[empty] = permute[empty];
   }
 
@@ -2187,9 +2207,120 @@ void Atom::setup_sort_bins()
 
   if (nbins > maxbin) {
     memory->destroy(binhead);
+    memory->destroy(binorder);
     maxbin = nbins;
     memory->create(binhead,maxbin,"atom:binhead");
+    memory->create(binorder,maxbin,"atom:binorder");
   }
+
+  if (sortorder != SORT_XYZ) setup_sort_curve();
+}
+
+/* ----------------------------------------------------------------------
+   copy atom I to J during sort
+   only per-atom arrays of fixes if atom style already permuted its own
+------------------------------------------------------------------------- */
+
+void Atom::sort_copy(int i, int j, int fixonly)
+{
+  if (!fixonly) {
+    avec->copy(i,j,0);
+    return;
+  }
+  for (int iextra = 0; iextra < nextra_grow; iextra++)
+    modify->fix[extra_grow[iextra]]->copy_arrays(i,j,0);
+}
+
+/* ----------------------------------------------------------------------
+   position of 3d bin (ix,iy,iz) along a Morton or Hilbert curve
+   nbits = bits per dimension, 2d bins have iz = 0 and ndim = 2
+   Hilbert index via transposed form of Skilling, AIP Conf Proc 707 (2004)
+------------------------------------------------------------------------- */
+
+static uint64_t sort_curve_key(int order, int ndim, int nbits,
+                               int ix, int iy, int iz)
+{
+  unsigned int c[3];
+  c[0] = ix;
+  c[1] = iy;
+  c[2] = iz;
+
+  if (order == SORT_HILBERT) {
+    unsigned int p,q,t;
+    unsigned int m = 1U << (nbits-1);
+    int d;
+
+    for (q = m; q > 1; q >>= 1) {
+      p = q - 1;
+      for (d = 0; d < ndim; d++)
+        if (c[d] & q) c[0] ^= p;
+        else {
+          t = (c[0] ^ c[d]) & p;
+          c[0] ^= t;
+          c[d] ^= t;
+        }
+    }
+
+    for (d = 1; d < ndim; d++) c[d] ^= c[d-1];
+    t = 0;
+    for (q = m; q > 1; q >>= 1)
+      if (c[ndim-1] & q) t ^= q - 1;
+    for (d = 0; d < ndim; d++) c[d] ^= t;
+  }
+
+  // interleave bits, most significant first, x slowest
+
+  uint64_t key = 0;
+  for (int b = nbits-1; b >= 0; b--)
+    for (int d = 0; d < ndim; d++)
+      key = (key << 1) | ((c[d] >> b) & 1);
+  return key;
+}
+
+/* ----------------------------------------------------------------------
+   binorder = rank of each xyz bin along the Morton or Hilbert curve
+   curve spans the next power of 2 of the largest bin count,
+     bins outside the actual grid are skipped
+------------------------------------------------------------------------- */
+
+namespace {
+struct SortCurveLess {
+  const uint64_t *key;
+  SortCurveLess(const uint64_t *k) : key(k) {}
+  bool operator()(int i, int j) const { return key[i] < key[j]; }
+};
+}
+
+void Atom::setup_sort_curve()
+{
+  int ndim = domain->dimension;
+  int nmaxdim = MAX(nbinx,nbiny);
+  if (ndim == 3) nmaxdim = MAX(nmaxdim,nbinz);
+
+  int nbits = 1;
+  while ((1 << nbits) < nmaxdim) nbits++;
+  if (ndim*nbits > 63)
+    error->one(FLERR,"Too many atom sorting bins for sort/order curve");
+
+  uint64_t *key;
+  int *index;
+  memory->create(key,nbins,"atom:sortkey");
+  memory->create(index,nbins,"atom:sortindex");
+
+  int ix,iy,iz,ibin;
+  for (iz = 0; iz < nbinz; iz++)
+    for (iy = 0; iy < nbiny; iy++)
+      for (ix = 0; ix < nbinx; ix++) {
+        ibin = iz*nbiny*nbinx + iy*nbinx + ix;
+        key[ibin] = sort_curve_key(sortorder,ndim,nbits,ix,iy,iz);
+        index[ibin] = ibin;
+      }
+
+  std::sort(index,index+nbins,SortCurveLess(key));
+  for (int m = 0; m < nbins; m++) binorder[index[m]] = m;
+
+  memory->destroy(key);
+  memory->destroy(index);
 }
 
 /* ----------------------------------------------------------------------
@@ -209,6 +209,7 @@ class Atom : protected Pointers {
   int sortfreq;             // sort atoms every this many steps, 0 = off
   bigint nextsort;          // next timestep to sort on
   double userbinsize;       // requested sort bin size
+  int sortorder;            // order of sort bins, 0/1/2 = xyz/morton/hilbert
 
   // indices of atoms with same ID
 
@@ -337,6 +338,7 @@ class Atom : protected Pointers {
   int *binhead;                   // 1st atom in each bin
   int *next;                      // next atom in bin
   int *permute;                   // permutation vector
+  int *binorder;                  // rank of each xyz bin along sort curve
   double bininvx,bininvy,bininvz; // inverse actual bin sizes
   double bboxlo[3],bboxhi[3];     // bounding box of my sub-domain
 
@@ -344,6 +346,8 @@ class Atom : protected Pointers {
   char *memstr;                   // string of array names already counted
 
   void setup_sort_bins();
+  void setup_sort_curve();
+  void sort_copy(int, int, int);
   int next_prime(int);
 
  private:
@@ -537,4 +541,9 @@ E: Too many atom sorting bins
 This is likely due to an immense simulation box that has blown up
 to a large size.
 
+E: Too many atom sorting bins for sort/order curve
+
+The curve index of a bin must fit in 63 bits, so a sub-domain can
+have at most 2^21 bins per dimension in 3d.
+
 */
@@ -17,6 +17,7 @@
 #include "atom.h"
 #include "force.h"
 #include "domain.h"
+#include "memory.h"
 #include "error.h"
 
 using namespace LAMMPS_NS;
@@ -37,6 +38,9 @@ AtomVec::AtomVec(LAMMPS *lmp) : Pointers(lmp)
 
   nargcopy = 0;
   argcopy = NULL;
+
+  permbuf = NULL;
+  maxpermbuf = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -45,6 +49,19 @@ AtomVec::~AtomVec()
 {
   for (int i = 0; i < nargcopy; i++) delete [] argcopy[i];
   delete [] argcopy;
+  memory->sfree(permbuf);
+}
+
+/* ----------------------------------------------------------------------
+   insure permbuf holds at least nbytes
+------------------------------------------------------------------------- */
+
+void AtomVec::grow_permbuf(bigint nbytes)
+{
+  if (nbytes <= maxpermbuf) return;
+  maxpermbuf = nbytes;
+  memory->sfree(permbuf);
+  permbuf = (char *) memory->smalloc(maxpermbuf,"atom:permbuf");
 }
 
 /* ----------------------------------------------------------------------
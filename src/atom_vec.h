@@ -57,6 +57,7 @@ class AtomVec : protected Pointers {
   virtual void grow(int) = 0;
   virtual void grow_reset() = 0;
   virtual void copy(int, int, int) = 0;
+  virtual int permute(int, int *) {return 0;}
   virtual void clear_bonus() {}
   virtual void force_clear(int, size_t) {}
 
@@ -144,6 +145,30 @@ class AtomVec : protected Pointers {
 
   void grow_nmax();
   int grow_nmax_bonus(int);
+
+  // scratch space for permute_array()
+
+  char *permbuf;
+  bigint maxpermbuf;
+
+  void grow_permbuf(bigint);
+
+  // reorder 1st n rows of a contiguous per-atom array of ncol values/row
+  // new row I = old row permute[I], gathered into permbuf and copied back
+
+  template <class T>
+  void permute_array(T *array, int n, int ncol, int *permute) {
+    bigint nvalues = (bigint) n*ncol;
+    grow_permbuf(nvalues*sizeof(T));
+    T *buf = (T *) permbuf;
+    T *row;
+    bigint m = 0;
+    for (int i = 0; i < n; i++) {
+      row = &array[(bigint) permute[i]*ncol];
+      for (int k = 0; k < ncol; k++) buf[m++] = row[k];
+    }
+    for (m = 0; m < nvalues; m++) array[m] = buf[m];
+  }
 };
 
 }
@@ -228,6 +228,32 @@ void AtomVecCAC::copy(int i, int j, int delflag)
       modify->fix[atom->extra_grow[iextra]]->copy_arrays(i,j,delflag);
 }
 
+/* ----------------------------------------------------------------------
+   reorder 1st n atoms one per-atom array at a time
+   new atom I = old atom permute[I], fix arrays are left to Atom::sort()
+------------------------------------------------------------------------- */
+
+int AtomVecCAC::permute(int n, int *permute)
+{
+  int nodal = nodes_per_element*maxpoly*3;
+
+  permute_array(tag,n,1,permute);
+  permute_array(type,n,1,permute);
+  permute_array(mask,n,1,permute);
+  permute_array(image,n,1,permute);
+  permute_array(x[0],n,3,permute);
+  permute_array(v[0],n,3,permute);
+  permute_array(element_type,n,1,permute);
+  permute_array(element_scale[0],n,3,permute);
+  permute_array(poly_count,n,1,permute);
+  permute_array(node_types[0],n,maxpoly,permute);
+  permute_array(nodal_positions[0][0][0],n,nodal,permute);
+  permute_array(initial_nodal_positions[0][0][0],n,nodal,permute);
+  permute_array(nodal_velocities[0][0][0],n,nodal,permute);
+  permute_array(nodal_gradients[0][0][0],n,nodal,permute);
+  return 1;
+}
+
 /* ---------------------------------------------------------------------- */
 
 int AtomVecCAC::pack_comm(int n, int *list, double *buf,
@@ -32,6 +32,7 @@ class AtomVecCAC : public AtomVec {
   void grow(int);
   void grow_reset();
   void copy(int, int, int);
+  int permute(int, int *);
   void process_args(int, char **);
   virtual int pack_comm(int, int *, double *, int, int *);
   virtual int pack_comm_vel(int, int *, double *, int, int *);
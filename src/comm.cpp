@@ -28,6 +28,7 @@
 #include "dump.h"
 #include "group.h"
 #include "procmap.h"
+#include "comm_shm.h"
 #include "accelerator_kokkos.h"
 #include "memory.h"
 #include "error.h"
@@ -55,6 +56,8 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
   cutghostuser = 0.0;
   cutusermulti = NULL;
   ghost_velocity = 0;
+  overlap_flag = 0;
+  shmem_flag = 0;
 
   user_procgrid[0] = user_procgrid[1] = user_procgrid[2] = 0;
   coregrid[0] = coregrid[1] = coregrid[2] = 1;
@@ -299,6 +302,24 @@ void Comm::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) ghost_velocity = 0;
       else error->all(FLERR,"Illegal comm_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"overlap") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) overlap_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) overlap_flag = 0;
+      else error->all(FLERR,"Illegal comm_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"shmem") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) shmem_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) shmem_flag = 0;
+      else error->all(FLERR,"Illegal comm_modify command");
+      if (shmem_flag && !CommShm::available()) {
+        if (me == 0)
+          error->warning(FLERR,"Comm_modify shmem requires an MPI-3 library, "
+                         "setting is ignored");
+        shmem_flag = 0;
+      }
+      iarg += 2;
     } else error->all(FLERR,"Illegal comm_modify command");
   }
 }
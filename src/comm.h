@@ -30,6 +30,9 @@ class Comm : protected Pointers {
 
   int me,nprocs;                    // proc info
   int ghost_velocity;               // 1 if ghost atoms have velocity, 0 if not
+  int overlap_flag;                 // 1 if forward comm can overlap pair compute
+  int shmem_flag;                   // 1 if forward comm to procs on my node
+                                    //   goes through a shared-memory window
   double cutghost[3];               // cutoffs used for acquiring ghost atoms
   double cutghostuser;              // user-specified ghost cutoff (mode == 0)
   double *cutusermulti;            // per type user ghost cutoff (mode == 1)
@@ -72,6 +75,8 @@ class Comm : protected Pointers {
 
   virtual void setup() = 0;                      // setup 3d comm pattern
   virtual void forward_comm(int dummy = 0) = 0;  // forward comm of atom coords
+  virtual void forward_comm_start() {forward_comm();}  // split forward comm,
+  virtual void forward_comm_finish() {}                // default is blocking
   virtual void reverse_comm() = 0;               // reverse comm of forces
   virtual void exchange() = 0;                   // move atoms to new procs
   virtual void borders() = 0;                    // setup list of atoms to comm
@@ -182,6 +187,11 @@ E: Cannot set cutoff/multi before simulation box is defined
 
 Self-explanatory.
 
+W: Comm_modify shmem requires an MPI-3 library, setting is ignored
+
+LAMMPS was built with an MPI library that does not support
+shared-memory windows, e.g. the serial STUBS library.
+
 E: Specified processors != physical processors
 
 The 3d grid of processors defined by the processors command does not
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include "comm_brick.h"
 #include "comm_tiled.h"
+#include "comm_shm.h"
 #include "universe.h"
 #include "atom.h"
 #include "atom_vec.h"
@@ -58,7 +59,8 @@ CommBrick::CommBrick(LAMMPS *lmp) :
   size_reverse_send(NULL), size_reverse_recv(NULL),
   slablo(NULL), slabhi(NULL), multilo(NULL), multihi(NULL),
   cutghostmulti(NULL), pbc_flag(NULL), pbc(NULL), firstrecv(NULL),
-  sendlist(NULL), maxsendlist(NULL), buf_send(NULL), buf_recv(NULL)
+  sendlist(NULL), maxsendlist(NULL), buf_send(NULL), buf_recv(NULL),
+  overlap_request(NULL), shm(NULL), shmsend(NULL), shmrecv(NULL)
 {
   style = 0;
   layout = LAYOUT_UNIFORM;
@@ -82,6 +84,8 @@ CommBrick::~CommBrick()
 
   memory->destroy(buf_send);
   memory->destroy(buf_recv);
+
+  delete shm;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -127,6 +131,9 @@ void CommBrick::init_buffers()
   nswap = 0;
   maxswap = 6;
   allocate_swap(maxswap);
+  nswap_overlap = 0;
+  overlap_active = 0;
+  shm = NULL;
 
   sendlist = (int **) memory->smalloc(maxswap*sizeof(int *),"comm:sendlist");
   memory->create(maxsendlist,maxswap,"comm:maxsendlist");
@@ -474,7 +481,9 @@ void CommBrick::forward_comm(int dummy)
 
   for (int iswap = 0; iswap < nswap; iswap++) {
     if (sendproc[iswap] != me) {
-      if (comm_x_only) {
+      if (shm && (shmsend[iswap] >= 0 || shmrecv[iswap] >= 0)) {
+        forward_swap_shm(iswap);
+      } else if (comm_x_only) {
         if (size_forward_recv[iswap]) {
           buf = x[firstrecv[iswap]];
           MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
@@ -522,6 +531,155 @@ void CommBrick::forward_comm(int dummy)
   }
 }
 
+/* ----------------------------------------------------------------------
+   forward comm of one swap with a send or recv proc on my node
+   data for a proc on my node is packed into my segment of the shared window
+   data from a proc on my node is unpacked from its segment in place
+   the other side of the swap, if off-node, is a regular MPI message
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_swap_shm(int iswap)
+{
+  int n;
+  MPI_Request request;
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+  double *buf;
+
+  int isend = shmsend[iswap];
+  int irecv = shmrecv[iswap];
+
+  if (irecv < 0 && size_forward_recv[iswap]) {
+    if (comm_x_only) buf = x[firstrecv[iswap]];
+    else buf = buf_recv;
+    MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
+              recvproc[iswap],0,world,&request);
+  }
+
+  if (isend >= 0) buf = shm->send_begin(isend);
+  else buf = buf_send;
+  if (ghost_velocity)
+    n = avec->pack_comm_vel(sendnum[iswap],sendlist[iswap],
+                            buf,pbc_flag[iswap],pbc[iswap]);
+  else
+    n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                        buf,pbc_flag[iswap],pbc[iswap]);
+  if (isend >= 0) shm->send_end(isend);
+  else if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+
+  if (irecv >= 0) {
+    buf = shm->recv_begin(irecv);
+    if (comm_x_only) {
+      if (size_forward_recv[iswap])
+        memcpy(x[firstrecv[iswap]],buf,size_forward_recv[iswap]*sizeof(double));
+    } else if (ghost_velocity)
+      avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],buf);
+    else avec->unpack_comm(recvnum[iswap],firstrecv[iswap],buf);
+    shm->recv_end(irecv);
+
+  } else {
+    if (size_forward_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+    if (ghost_velocity)
+      avec->unpack_comm_vel(recvnum[iswap],firstrecv[iswap],buf_recv);
+    else if (!comm_x_only)
+      avec->unpack_comm(recvnum[iswap],firstrecv[iswap],buf_recv);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   first half of a forward comm that is overlapped with force computation
+   post recvs and sends of the leading swaps that only send owned atoms,
+     the remaining swaps relay ghosts and are done by forward_comm_finish()
+   only for coords directly into x, else do a regular blocking forward_comm()
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_start()
+{
+  int iswap,n;
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+
+  if (!comm_x_only || nswap_overlap == 0) {
+    overlap_active = 0;
+    forward_comm();
+    return;
+  }
+
+  overlap_active = 1;
+
+  // post all recvs before any send so blocking sends cannot deadlock
+
+  // data from a proc on my node is read from the shared window in finish
+
+  for (iswap = 0; iswap < nswap_overlap; iswap++)
+    if (sendproc[iswap] != me && size_forward_recv[iswap] &&
+        !(shm && shmrecv[iswap] >= 0))
+      MPI_Irecv(x[firstrecv[iswap]],size_forward_recv[iswap],MPI_DOUBLE,
+                recvproc[iswap],0,world,&overlap_request[iswap]);
+
+  for (iswap = 0; iswap < nswap_overlap; iswap++) {
+    if (sendproc[iswap] != me && shm && shmsend[iswap] >= 0) {
+      avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                      shm->send_begin(shmsend[iswap]),
+                      pbc_flag[iswap],pbc[iswap]);
+      shm->send_end(shmsend[iswap]);
+    } else if (sendproc[iswap] != me) {
+      n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                          buf_send,pbc_flag[iswap],pbc[iswap]);
+      if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+    } else if (sendnum[iswap])
+      avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                      x[firstrecv[iswap]],pbc_flag[iswap],pbc[iswap]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   second half of an overlapped forward comm
+   wait for the posted swaps, then do the remaining swaps as forward_comm()
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_finish()
+{
+  int iswap,n;
+  MPI_Request request;
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+  double *buf;
+
+  if (!overlap_active) return;
+  overlap_active = 0;
+
+  for (iswap = 0; iswap < nswap_overlap; iswap++) {
+    if (sendproc[iswap] == me) continue;
+    if (shm && shmrecv[iswap] >= 0) {
+      buf = shm->recv_begin(shmrecv[iswap]);
+      if (size_forward_recv[iswap])
+        memcpy(x[firstrecv[iswap]],buf,size_forward_recv[iswap]*sizeof(double));
+      shm->recv_end(shmrecv[iswap]);
+    } else if (size_forward_recv[iswap])
+      MPI_Wait(&overlap_request[iswap],MPI_STATUS_IGNORE);
+  }
+
+  for (iswap = nswap_overlap; iswap < nswap; iswap++) {
+    if (sendproc[iswap] != me && shm &&
+        (shmsend[iswap] >= 0 || shmrecv[iswap] >= 0))
+      forward_swap_shm(iswap);
+    else if (sendproc[iswap] != me) {
+      if (size_forward_recv[iswap]) {
+        buf = x[firstrecv[iswap]];
+        MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
+                  recvproc[iswap],0,world,&request);
+      }
+      n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                          buf_send,pbc_flag[iswap],pbc[iswap]);
+      if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+      if (size_forward_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+    } else if (sendnum[iswap])
+      avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                      x[firstrecv[iswap]],pbc_flag[iswap],pbc[iswap]);
+  }
+}
+
 /* ----------------------------------------------------------------------
    reverse communication of forces on atoms every timestep
    other per-atom attributes may also be sent via pack/unpack routines
@@ -867,6 +1025,31 @@ void CommBrick::borders()
     }
   }
 
+  // nswap_overlap = # of leading swaps that send only owned atoms
+  // those can be posted by forward_comm_start() since they do not
+  //   relay ghosts received in an earlier swap
+  // must be the same on all procs so posted sends and recvs match
+
+  if (overlap_flag) {
+    int nlocal = atom->nlocal;
+    int noverlap = 0;
+    for (iswap = 0; iswap < nswap; iswap++) {
+      for (i = 0; i < sendnum[iswap]; i++)
+        if (sendlist[iswap][i] >= nlocal) break;
+      if (i < sendnum[iswap]) break;
+      noverlap++;
+    }
+    MPI_Allreduce(&noverlap,&nswap_overlap,1,MPI_INT,MPI_MIN,world);
+  } else nswap_overlap = 0;
+
+  // forward comm with procs on my node through a shared window
+
+  if (shmem_flag && nprocs > 1) setup_shm();
+  else if (shm) {
+    delete shm;
+    shm = NULL;
+  }
+
   // insure send/recv buffers are long enough for all forward & reverse comm
 
   int max = MAX(maxforward*smax,maxreverse*rmax);
@@ -1350,6 +1533,30 @@ int CommBrick::exchange_variable(int n, double *inbuf, double *&outbuf)
   return nrecv;
 }
 
+/* ----------------------------------------------------------------------
+   assign the forward comm of swaps with procs on my node to the shared window
+   sends and recvs are added in swap order, which matches on both procs
+   called from borders() on all procs, since the window may be reallocated
+------------------------------------------------------------------------- */
+
+void CommBrick::setup_shm()
+{
+  if (shm == NULL) shm = new CommShm(lmp);
+  shm->reset();
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    shmsend[iswap] = shmrecv[iswap] = -1;
+    if (sendproc[iswap] == me) continue;
+    if (shm->onnode(sendproc[iswap]))
+      shmsend[iswap] = shm->add_send(sendproc[iswap],
+                                     (bigint) sendnum[iswap]*size_forward);
+    if (shm->onnode(recvproc[iswap]))
+      shmrecv[iswap] = shm->add_recv(recvproc[iswap]);
+  }
+
+  shm->setup();
+}
+
 /* ----------------------------------------------------------------------
    realloc the size of the send buffer as needed with BUFFACTOR and bufextra
    if flag = 1, realloc
@@ -1429,6 +1636,9 @@ void CommBrick::allocate_swap(int n)
   memory->create(firstrecv,n,"comm:firstrecv");
   memory->create(pbc_flag,n,"comm:pbc_flag");
   memory->create(pbc,n,6,"comm:pbc");
+  overlap_request = new MPI_Request[n];
+  memory->create(shmsend,n,"comm:shmsend");
+  memory->create(shmrecv,n,"comm:shmrecv");
 }
 
 /* ----------------------------------------------------------------------
@@ -1459,6 +1669,9 @@ void CommBrick::free_swap()
   memory->destroy(firstrecv);
   memory->destroy(pbc_flag);
   memory->destroy(pbc);
+  delete [] overlap_request;
+  memory->destroy(shmsend);
+  memory->destroy(shmrecv);
 }
 
 /* ----------------------------------------------------------------------
@@ -1484,5 +1697,6 @@ bigint CommBrick::memory_usage()
     bytes += memory->usage(sendlist[i],maxsendlist[i]);
   bytes += memory->usage(buf_send,maxsend+bufextra);
   bytes += memory->usage(buf_recv,maxrecv);
+  if (shm) bytes += shm->memory_usage();
   return bytes;
 }
@@ -27,6 +27,8 @@ class CommBrick : public Comm {
   virtual void init();
   virtual void setup();                        // setup 3d comm pattern
   virtual void forward_comm(int dummy = 0);    // forward comm of atom coords
+  virtual void forward_comm_start();           // post forward comm of coords
+  virtual void forward_comm_finish();          // complete forward comm
   virtual void reverse_comm();                 // reverse comm of forces
   virtual void exchange();                     // move atoms to new procs
   virtual void borders();                      // setup list of atoms to comm
@@ -69,6 +71,15 @@ class CommBrick : public Comm {
   int **sendlist;                   // list of atoms to send in each swap
   int *maxsendlist;                 // max size of send list for each swap
 
+  int nswap_overlap;                // # of leading swaps sending only owned
+                                    //   atoms, can be posted before finish
+  int overlap_active;               // 1 if forward comm has been started
+  MPI_Request *overlap_request;     // recv requests of posted swaps
+
+  class CommShm *shm;               // shared window for procs on my node
+  int *shmsend,*shmrecv;            // index of send/recv of each swap in shm
+                                    //   -1 if it goes through MPI
+
   double *buf_send;                 // send buffer for all comm
   double *buf_recv;                 // recv buffer for all comm
   int maxsend,maxrecv;              // current size of send/recv buffer
@@ -84,6 +95,8 @@ class CommBrick : public Comm {
   virtual void grow_recv(int);              // free/allocate recv buffer
   virtual void grow_list(int, int);         // reallocate one sendlist
   virtual void grow_swap(int);              // grow swap and multi arrays
+  void setup_shm();                         // assign swaps to shared window
+  void forward_swap_shm(int);               // forward comm of one swap
   virtual void allocate_swap(int);          // allocate swap arrays
   virtual void allocate_multi(int);         // allocate multi arrays
   virtual void free_swap();                 // free swap arrays
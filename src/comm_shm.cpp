@@ -0,0 +1,325 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <stdlib.h>
+#include "comm_shm.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+#define SHMFACTOR 1.5
+#define SHMMIN 1000
+
+// tags of the zero-length signal messages
+// distinct from tag 0 used by regular comm between the same procs
+
+enum{TAG_READY=7001,TAG_DONE=7002};
+
+/* ----------------------------------------------------------------------
+   node-local exchange of forward comm data through an MPI-3 shared window
+   every proc owns one segment of the window, its sends are packed there
+   a proc on the same node unpacks directly from the sender's segment,
+     so the data is copied once instead of passing through MPI buffers
+------------------------------------------------------------------------- */
+
+CommShm::CommShm(LAMMPS *lmp) : Pointers(lmp)
+{
+  MPI_Comm_rank(world,&me);
+
+  nsend = nrecv = 0;
+  maxsend = maxrecv = 0;
+  sendproc = recvproc = NULL;
+  sendsize = sendoffset = recvoffset = NULL;
+  sendptr = recvptr = NULL;
+  senddone = recvrequest = NULL;
+
+  maxseg = 0;
+  segment = NULL;
+  nodesize = 1;
+
+#ifdef LMP_MPI_SHM
+  MPI_Comm_split_type(world,MPI_COMM_TYPE_SHARED,me,MPI_INFO_NULL,&nodecomm);
+  MPI_Comm_size(nodecomm,&nodesize);
+  MPI_Comm_group(world,&worldgroup);
+  MPI_Comm_group(nodecomm,&nodegroup);
+  win = MPI_WIN_NULL;
+#endif
+}
+
+/* ---------------------------------------------------------------------- */
+
+CommShm::~CommShm()
+{
+  drain();
+  free_window();
+
+#ifdef LMP_MPI_SHM
+  MPI_Group_free(&worldgroup);
+  MPI_Group_free(&nodegroup);
+  MPI_Comm_free(&nodecomm);
+#endif
+
+  memory->destroy(sendproc);
+  memory->destroy(recvproc);
+  memory->destroy(sendsize);
+  memory->destroy(sendoffset);
+  memory->destroy(recvoffset);
+  memory->sfree(sendptr);
+  memory->sfree(recvptr);
+  memory->sfree(senddone);
+  memory->sfree(recvrequest);
+}
+
+/* ----------------------------------------------------------------------
+   return 1 if this build can exchange data through shared windows
+------------------------------------------------------------------------- */
+
+int CommShm::available()
+{
+#ifdef LMP_MPI_SHM
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   return 1 if proc is another proc on my node
+------------------------------------------------------------------------- */
+
+int CommShm::onnode(int proc)
+{
+  if (proc == me || nodesize == 1) return 0;
+
+#ifdef LMP_MPI_SHM
+  int noderank;
+  MPI_Group_translate_ranks(worldgroup,1,&proc,nodegroup,&noderank);
+  if (noderank != MPI_UNDEFINED) return 1;
+#endif
+
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   start a new list of sends and recvs
+   wait until all data of previous sends has been read
+------------------------------------------------------------------------- */
+
+void CommShm::reset()
+{
+  drain();
+  nsend = nrecv = 0;
+}
+
+/* ----------------------------------------------------------------------
+   add a send of n doubles to proc, return its index
+   sends and recvs between a pair of procs must be added in the same order
+------------------------------------------------------------------------- */
+
+int CommShm::add_send(int proc, bigint n)
+{
+  if (nsend == maxsend) {
+    maxsend += 16;
+    memory->grow(sendproc,maxsend,"comm/shm:sendproc");
+    memory->grow(sendsize,maxsend,"comm/shm:sendsize");
+    memory->grow(sendoffset,maxsend,"comm/shm:sendoffset");
+    sendptr = (double **)
+      memory->srealloc(sendptr,maxsend*sizeof(double *),"comm/shm:sendptr");
+    senddone = (MPI_Request *)
+      memory->srealloc(senddone,maxsend*sizeof(MPI_Request),
+                       "comm/shm:senddone");
+  }
+
+  sendproc[nsend] = proc;
+  sendsize[nsend] = n;
+  senddone[nsend] = MPI_REQUEST_NULL;
+  return nsend++;
+}
+
+/* ----------------------------------------------------------------------
+   add a recv from proc, return its index
+------------------------------------------------------------------------- */
+
+int CommShm::add_recv(int proc)
+{
+  if (nrecv == maxrecv) {
+    maxrecv += 16;
+    memory->grow(recvproc,maxrecv,"comm/shm:recvproc");
+    memory->grow(recvoffset,maxrecv,"comm/shm:recvoffset");
+    recvptr = (double **)
+      memory->srealloc(recvptr,maxrecv*sizeof(double *),"comm/shm:recvptr");
+    recvrequest = (MPI_Request *)
+      memory->srealloc(recvrequest,maxrecv*sizeof(MPI_Request),
+                       "comm/shm:recvrequest");
+  }
+
+  recvproc[nrecv] = proc;
+  return nrecv++;
+}
+
+/* ----------------------------------------------------------------------
+   lay out sends in my segment and locate recvs in segments of other procs
+   collective over world, the window is reallocated on my node
+     if any of its procs needs a larger segment
+------------------------------------------------------------------------- */
+
+void CommShm::setup()
+{
+#ifdef LMP_MPI_SHM
+  int i;
+
+  bigint n = 0;
+  for (i = 0; i < nsend; i++) {
+    sendoffset[i] = n;
+    n += sendsize[i];
+  }
+
+  bigint nmax;
+  MPI_Allreduce(&n,&nmax,1,MPI_LMP_BIGINT,MPI_MAX,nodecomm);
+
+  if (win == MPI_WIN_NULL || nmax > maxseg) {
+    free_window();
+    maxseg = MAX(static_cast<bigint> (SHMFACTOR*nmax),SHMMIN);
+
+    // each segment is placed in memory local to its proc
+
+    MPI_Info info;
+    MPI_Info_create(&info);
+    MPI_Info_set(info,(char *) "alloc_shared_noncontig",(char *) "true");
+    MPI_Win_allocate_shared(maxseg*sizeof(double),sizeof(double),info,
+                            nodecomm,&segment,&win);
+    MPI_Info_free(&info);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK,win);
+  }
+
+  for (i = 0; i < nsend; i++) sendptr[i] = &segment[sendoffset[i]];
+
+  // tell each receiver where its data starts in my segment
+
+  for (i = 0; i < nrecv; i++)
+    MPI_Irecv(&recvoffset[i],1,MPI_LMP_BIGINT,recvproc[i],0,world,
+              &recvrequest[i]);
+  for (i = 0; i < nsend; i++)
+    MPI_Send(&sendoffset[i],1,MPI_LMP_BIGINT,sendproc[i],0,world);
+  if (nrecv) MPI_Waitall(nrecv,recvrequest,MPI_STATUS_IGNORE);
+
+  int proc,noderank,dispunit;
+  MPI_Aint size;
+  double *ptr;
+
+  for (i = 0; i < nrecv; i++) {
+    proc = recvproc[i];
+    MPI_Group_translate_ranks(worldgroup,1,&proc,nodegroup,&noderank);
+    MPI_Win_shared_query(win,noderank,&size,&dispunit,&ptr);
+    recvptr[i] = &ptr[recvoffset[i]];
+  }
+#else
+  if (nsend || nrecv)
+    error->one(FLERR,"Comm shmem requires an MPI-3 library");
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   return where to pack data of send i
+   wait until the receiver has read the previous data of this send
+------------------------------------------------------------------------- */
+
+double *CommShm::send_begin(int i)
+{
+#ifdef LMP_MPI_SHM
+  if (senddone[i] != MPI_REQUEST_NULL) {
+    MPI_Wait(&senddone[i],MPI_STATUS_IGNORE);
+    MPI_Win_sync(win);
+  }
+#endif
+  return sendptr[i];
+}
+
+/* ----------------------------------------------------------------------
+   signal the receiver of send i that its data is in place
+------------------------------------------------------------------------- */
+
+void CommShm::send_end(int i)
+{
+#ifdef LMP_MPI_SHM
+  MPI_Win_sync(win);
+  MPI_Send(NULL,0,MPI_DOUBLE,sendproc[i],TAG_READY,world);
+  MPI_Irecv(NULL,0,MPI_DOUBLE,sendproc[i],TAG_DONE,world,&senddone[i]);
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   wait for the data of recv i, return where to unpack it from
+------------------------------------------------------------------------- */
+
+double *CommShm::recv_begin(int i)
+{
+#ifdef LMP_MPI_SHM
+  MPI_Recv(NULL,0,MPI_DOUBLE,recvproc[i],TAG_READY,world,MPI_STATUS_IGNORE);
+  MPI_Win_sync(win);
+#endif
+  return recvptr[i];
+}
+
+/* ----------------------------------------------------------------------
+   signal the sender of recv i that its data has been read
+------------------------------------------------------------------------- */
+
+void CommShm::recv_end(int i)
+{
+#ifdef LMP_MPI_SHM
+  MPI_Win_sync(win);
+  MPI_Send(NULL,0,MPI_DOUBLE,recvproc[i],TAG_DONE,world);
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   complete the DONE recvs of all sends
+------------------------------------------------------------------------- */
+
+void CommShm::drain()
+{
+#ifdef LMP_MPI_SHM
+  if (nsend) MPI_Waitall(nsend,senddone,MPI_STATUS_IGNORE);
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   free the node window, collective over my node
+------------------------------------------------------------------------- */
+
+void CommShm::free_window()
+{
+#ifdef LMP_MPI_SHM
+  if (win == MPI_WIN_NULL) return;
+  MPI_Win_unlock_all(win);
+  MPI_Win_free(&win);
+  win = MPI_WIN_NULL;
+  segment = NULL;
+  maxseg = 0;
+#endif
+}
+
+/* ---------------------------------------------------------------------- */
+
+bigint CommShm::memory_usage()
+{
+  bigint bytes = maxseg*sizeof(double);
+  bytes += (bigint) maxsend * (sizeof(int) + 2*sizeof(bigint) +
+                               sizeof(double *) + sizeof(MPI_Request));
+  bytes += (bigint) maxrecv * (sizeof(int) + sizeof(bigint) +
+                               sizeof(double *) + sizeof(MPI_Request));
+  return bytes;
+}
@@ -0,0 +1,89 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_COMM_SHM_H
+#define LMP_COMM_SHM_H
+
+#include "pointers.h"
+
+// shared-memory windows need an MPI-3 library, not available with STUBS
+
+#if !defined(MPI_STUBS) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+#define LMP_MPI_SHM
+#endif
+
+namespace LAMMPS_NS {
+
+class CommShm : protected Pointers {
+ public:
+  int nodesize;                     // # of procs on my node
+
+  CommShm(class LAMMPS *);
+  ~CommShm();
+  static int available();
+  int onnode(int);
+
+  void reset();
+  int add_send(int, bigint);
+  int add_recv(int);
+  void setup();
+
+  double *send_begin(int);
+  void send_end(int);
+  double *recv_begin(int);
+  void recv_end(int);
+
+  bigint memory_usage();
+
+ private:
+  int me;
+
+  // each send writes its data into my segment of the node window
+  // each recv reads its data from the segment of the sending proc
+  // a READY message from the sender says the data is in place,
+  //   a DONE message from the receiver says the data has been read
+
+  int nsend,nrecv;                  // # of sends/recvs through the window
+  int maxsend,maxrecv;              // allocated length of send/recv lists
+  int *sendproc,*recvproc;          // proc of each send/recv
+  bigint *sendsize;                 // # of doubles of each send
+  bigint *sendoffset,*recvoffset;   // offset of each send/recv in a segment
+  double **sendptr,**recvptr;       // location of each send/recv
+  MPI_Request *senddone;            // posted recv of DONE for each send
+  MPI_Request *recvrequest;         // recvs of offsets in setup()
+
+  bigint maxseg;                    // length of my segment in doubles
+  double *segment;                  // my segment of the window
+
+#ifdef LMP_MPI_SHM
+  MPI_Comm nodecomm;                // procs that share memory with me
+  MPI_Group worldgroup,nodegroup;
+  MPI_Win win;                      // node window of all segments
+#endif
+
+  void drain();
+  void free_window();
+};
+
+}
+
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Comm shmem requires an MPI-3 library
+
+Shared-memory windows are not supported by the MPI library LAMMPS was
+built with.  Use comm_modify shmem no.
+
+*/
@@ -18,6 +18,7 @@
 #include <cstring>
 #include "comm_tiled.h"
 #include "comm_brick.h"
+#include "comm_shm.h"
 #include "atom.h"
 #include "atom_vec.h"
 #include "domain.h"
@@ -76,6 +77,9 @@ CommTiled::~CommTiled()
   memory->destroy(overlap);
   deallocate_swap(nswap);
   memory->sfree(rcbinfo);
+  delete shm;
+  memory->destroy(shmsend);
+  memory->destroy(shmrecv);
    if (mode == Comm::MULTI) {
     memory->destroy(cutghostmulti);
   }
@@ -109,6 +113,10 @@ void CommTiled::init_buffers()
   allocate_swap(nswap);
 
   rcbinfo = NULL;
+
+  shm = NULL;
+  shmsend = shmrecv = NULL;
+  maxshmsend = maxshmrecv = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -540,12 +548,21 @@ void CommTiled::forward_comm(int /*dummy*/)
   // copy data to self if sendself is set
   // wait on all procs except self and unpack received data
   // if comm_x_only set, exchange or copy directly to x, don't unpack
+  // if shared window is used, ishm/jshm = 1st send/recv of swap in shm lists
+
+  int ishm = 0;
+  int jshm = 0;
 
   for (int iswap = 0; iswap < nswap; iswap++) {
     nsend = nsendproc[iswap] - sendself[iswap];
     nrecv = nrecvproc[iswap] - sendself[iswap];
 
-    if (comm_x_only) {
+    if (shm) {
+      forward_swap_shm(iswap,ishm,jshm);
+      if (sendother[iswap]) ishm += nsend;
+      if (recvother[iswap]) jshm += nrecv;
+
+    } else if (comm_x_only) {
       if (recvother[iswap]) {
         for (i = 0; i < nrecv; i++)
           MPI_Irecv(x[firstrecv[iswap][i]],size_forward_recv[iswap][i],
@@ -626,6 +643,102 @@ void CommTiled::forward_comm(int /*dummy*/)
   }
 }
 
+/* ----------------------------------------------------------------------
+   forward comm of one swap when a shared window is used
+   ishm/jshm = index of 1st send/recv of this swap in shmsend/shmrecv
+   data for procs on my node is packed into my segment of the shared window
+   data from procs on my node is unpacked from their segments in place
+------------------------------------------------------------------------- */
+
+void CommTiled::forward_swap_shm(int iswap, int ishm, int jshm)
+{
+  int i,j,irecv,n;
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+  double *buf;
+
+  int nsend = nsendproc[iswap] - sendself[iswap];
+  int nrecv = nrecvproc[iswap] - sendself[iswap];
+  if (!sendother[iswap]) nsend = 0;
+  if (!recvother[iswap]) nrecv = 0;
+
+  for (i = 0; i < nrecv; i++) {
+    if (shmrecv[jshm+i] >= 0) requests[i] = MPI_REQUEST_NULL;
+    else if (comm_x_only)
+      MPI_Irecv(x[firstrecv[iswap][i]],size_forward_recv[iswap][i],
+                MPI_DOUBLE,recvproc[iswap][i],0,world,&requests[i]);
+    else
+      MPI_Irecv(&buf_recv[size_forward*forward_recv_offset[iswap][i]],
+                size_forward_recv[iswap][i],
+                MPI_DOUBLE,recvproc[iswap][i],0,world,&requests[i]);
+  }
+
+  for (i = 0; i < nsend; i++) {
+    j = shmsend[ishm+i];
+    if (j >= 0) buf = shm->send_begin(j);
+    else buf = buf_send;
+    if (ghost_velocity)
+      n = avec->pack_comm_vel(sendnum[iswap][i],sendlist[iswap][i],
+                              buf,pbc_flag[iswap][i],pbc[iswap][i]);
+    else
+      n = avec->pack_comm(sendnum[iswap][i],sendlist[iswap][i],
+                          buf,pbc_flag[iswap][i],pbc[iswap][i]);
+    if (j >= 0) shm->send_end(j);
+    else MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap][i],0,world);
+  }
+
+  if (sendself[iswap]) {
+    nsend = nsendproc[iswap] - 1;
+    irecv = nrecvproc[iswap] - 1;
+    if (comm_x_only)
+      avec->pack_comm(sendnum[iswap][nsend],sendlist[iswap][nsend],
+                      x[firstrecv[iswap][irecv]],pbc_flag[iswap][nsend],
+                      pbc[iswap][nsend]);
+    else if (ghost_velocity) {
+      avec->pack_comm_vel(sendnum[iswap][nsend],sendlist[iswap][nsend],
+                          buf_send,pbc_flag[iswap][nsend],pbc[iswap][nsend]);
+      avec->unpack_comm_vel(recvnum[iswap][irecv],firstrecv[iswap][irecv],
+                            buf_send);
+    } else {
+      avec->pack_comm(sendnum[iswap][nsend],sendlist[iswap][nsend],
+                      buf_send,pbc_flag[iswap][nsend],pbc[iswap][nsend]);
+      avec->unpack_comm(recvnum[iswap][irecv],firstrecv[iswap][irecv],
+                        buf_send);
+    }
+  }
+
+  // unpack from procs on my node while messages from other nodes arrive
+
+  for (i = 0; i < nrecv; i++) {
+    j = shmrecv[jshm+i];
+    if (j < 0) continue;
+    buf = shm->recv_begin(j);
+    if (comm_x_only) {
+      if (size_forward_recv[iswap][i])
+        memcpy(x[firstrecv[iswap][i]],buf,
+               size_forward_recv[iswap][i]*sizeof(double));
+    } else if (ghost_velocity)
+      avec->unpack_comm_vel(recvnum[iswap][i],firstrecv[iswap][i],buf);
+    else avec->unpack_comm(recvnum[iswap][i],firstrecv[iswap][i],buf);
+    shm->recv_end(j);
+  }
+
+  if (nrecv == 0) return;
+  if (comm_x_only) {
+    MPI_Waitall(nrecv,requests,MPI_STATUS_IGNORE);
+    return;
+  }
+
+  while (1) {
+    MPI_Waitany(nrecv,requests,&irecv,MPI_STATUS_IGNORE);
+    if (irecv == MPI_UNDEFINED) break;
+    buf = &buf_recv[size_forward*forward_recv_offset[iswap][irecv]];
+    if (ghost_velocity)
+      avec->unpack_comm_vel(recvnum[iswap][irecv],firstrecv[iswap][irecv],buf);
+    else avec->unpack_comm(recvnum[iswap][irecv],firstrecv[iswap][irecv],buf);
+  }
+}
+
 /* ----------------------------------------------------------------------
    reverse communication of forces on atoms every timestep
    other per-atom attributes may also be sent via pack/unpack routines
@@ -1102,6 +1215,14 @@ void CommTiled::borders()
   max = MAX(maxforward*rmaxall,maxreverse*smaxall);
   if (max > maxrecv) grow_recv(max);
 
+  // forward comm with procs on my node through a shared window
+
+  if (shmem_flag && nprocs > 1) setup_shm();
+  else if (shm) {
+    delete shm;
+    shm = NULL;
+  }
+
   // reset global->local map
 
   if (map_style) atom->map_set();
@@ -1952,6 +2073,66 @@ int CommTiled::coord2proc(double *x, int &igx, int &igy, int &igz)
   return point_drop_tiled_recurse(x,0,nprocs-1);
 }
 
+/* ----------------------------------------------------------------------
+   assign the forward comm with procs on my node to the shared window
+   sends and recvs are added in swap order, a pair of procs exchanges
+     at most one message per swap, so the order matches on both procs
+   called from borders() on all procs, since the window may be reallocated
+------------------------------------------------------------------------- */
+
+void CommTiled::setup_shm()
+{
+  int i,nsend,nrecv;
+
+  if (shm == NULL) shm = new CommShm(lmp);
+  shm->reset();
+
+  int ntotal = 0;
+  int mtotal = 0;
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    if (sendother[iswap]) ntotal += nsendproc[iswap] - sendself[iswap];
+    if (recvother[iswap]) mtotal += nrecvproc[iswap] - sendself[iswap];
+  }
+  if (ntotal > maxshmsend) {
+    maxshmsend = ntotal;
+    memory->destroy(shmsend);
+    memory->create(shmsend,maxshmsend,"comm:shmsend");
+  }
+  if (mtotal > maxshmrecv) {
+    maxshmrecv = mtotal;
+    memory->destroy(shmrecv);
+    memory->create(shmrecv,maxshmrecv,"comm:shmrecv");
+  }
+
+  int ishm = 0;
+  int jshm = 0;
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    if (sendother[iswap]) {
+      nsend = nsendproc[iswap] - sendself[iswap];
+      for (i = 0; i < nsend; i++) {
+        if (shm->onnode(sendproc[iswap][i]))
+          shmsend[ishm] =
+            shm->add_send(sendproc[iswap][i],
+                          (bigint) sendnum[iswap][i]*size_forward);
+        else shmsend[ishm] = -1;
+        ishm++;
+      }
+    }
+    if (recvother[iswap]) {
+      nrecv = nrecvproc[iswap] - sendself[iswap];
+      for (i = 0; i < nrecv; i++) {
+        if (shm->onnode(recvproc[iswap][i]))
+          shmrecv[jshm] = shm->add_recv(recvproc[iswap][i]);
+        else shmrecv[jshm] = -1;
+        jshm++;
+      }
+    }
+  }
+
+  shm->setup();
+}
+
 /* ----------------------------------------------------------------------
    realloc the size of the send buffer as needed with BUFFACTOR and bufextra
    if flag = 1, realloc
@@ -2209,5 +2390,6 @@ void CommTiled::deallocate_swap(int n)
 bigint CommTiled::memory_usage()
 {
   bigint bytes = 0;
+  if (shm) bytes += shm->memory_usage();
   return bytes;
 }
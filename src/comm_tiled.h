@@ -97,6 +97,11 @@ class CommTiled : public Comm {
   int maxreqstat;               // max size of Request and Status vectors
   MPI_Request *requests;
 
+  class CommShm *shm;          // shared window for procs on my node
+  int *shmsend,*shmrecv;       // index in shm of each send/recv to other procs
+                               //   over all swaps, -1 if it goes through MPI
+  int maxshmsend,maxshmrecv;   // current length of shmsend/shmrecv
+
   struct RCBinfo {
     double mysplit[3][2];      // fractional RCB bounding box for one proc
     double cutfrac;            // fractional position of cut this proc owns
@@ -149,6 +154,8 @@ class CommTiled : public Comm {
   void grow_swap_send(int, int, int);  // grow swap arrays for send and recv
   void grow_swap_recv(int, int);
   void deallocate_swap(int);           // deallocate swap arrays
+  void setup_shm();                    // assign swaps to shared window
+  void forward_swap_shm(int, int, int);  // forward comm of one swap
 
 };
 
@@ -28,6 +28,13 @@
 #include "modify.h"
 #include "fix.h"
 
+#ifdef LAMMPS_ZLIB
+#include <zlib.h>
+#endif
+#ifdef LAMMPS_ZSTD
+#include <zstd.h>
+#endif
+
 using namespace LAMMPS_NS;
 
 #if defined(LMP_QSORT)
@@ -39,8 +46,10 @@ Dump *Dump::dumpptr;
 
 #define BIG 1.0e20
 #define EPSILON 1.0e-6
+#define NSAMPLE 32          // # of sampled sort keys per proc
 
 enum{ASCEND,DESCEND};
+enum{PIPE,GZIP,ZSTD};
 
 /* ---------------------------------------------------------------------- */
 
@@ -92,9 +101,19 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   index = proclist = NULL;
   irregular = NULL;
 
+  maxsample = 0;
+  sample = sampleall = splitter = NULL;
+  samplecounts = sampledispls = NULL;
+
   maxsbuf = 0;
   sbuf = NULL;
 
+  maxzbuf = 0;
+  zbuf = NULL;
+  nzme = 0;
+  zstate = NULL;
+  zscratch = NULL;
+
   maxpbc = 0;
   xpbc = vpbc = NULL;
   imagepbc = NULL;
@@ -110,6 +129,8 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   fp = NULL;
   singlefile_opened = 0;
   compressed = 0;
+  zformat = PIPE;
+  zinline = 0;
   binary = 0;
   multifile = 0;
 
@@ -141,7 +162,27 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   char *suffix = filename + strlen(filename) - strlen(".bin");
   if (suffix > filename && strcmp(suffix,".bin") == 0) binary = 1;
   suffix = filename + strlen(filename) - strlen(".gz");
-  if (suffix > filename && strcmp(suffix,".gz") == 0) compressed = 1;
+  if (suffix > filename && strcmp(suffix,".gz") == 0) {
+    compressed = 1;
+#ifdef LAMMPS_ZLIB
+    zformat = GZIP;
+#endif
+  }
+  suffix = filename + strlen(filename) - strlen(".zst");
+  if (suffix > filename && strcmp(suffix,".zst") == 0) {
+#ifdef LAMMPS_ZSTD
+    compressed = 1;
+    zformat = ZSTD;
+#else
+    error->all(FLERR,"Dump file ending in .zst requires "
+               "LAMMPS built with -DLAMMPS_ZSTD");
+#endif
+  }
+
+  // same default level as the gzip pipe, zstd default for zstd
+
+  zlevel = 6;
+  if (zformat == ZSTD) zlevel = 3;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -170,7 +211,15 @@ Dump::~Dump()
   memory->destroy(proclist);
   delete irregular;
 
+  memory->destroy(sample);
+  memory->destroy(sampleall);
+  memory->destroy(samplecounts);
+  memory->destroy(sampledispls);
+  memory->destroy(splitter);
+
   memory->destroy(sbuf);
+  memory->destroy(zbuf);
+  free_zstate();
 
   if (pbcflag) {
     memory->destroy(xpbc);
@@ -183,13 +232,15 @@ Dump::~Dump()
   // XTC style sets fp to NULL since it closes file in its destructor
 
   if (multifile == 0 && fp != NULL) {
-    if (compressed) {
+    if (compressed && !zinline) {
       if (filewriter) pclose(fp);
     } else {
       if (filewriter) fclose(fp);
     }
     fp = NULL;
   }
+
+  if (zscratch) fclose(zscratch);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -211,12 +262,19 @@ void Dump::init()
     ids = idsort = NULL;
     index = proclist = NULL;
     irregular = NULL;
+
+    memory->destroy(sample);
+    memory->destroy(sampleall);
+    memory->destroy(samplecounts);
+    memory->destroy(sampledispls);
+    memory->destroy(splitter);
+
+    maxsample = 0;
+    sample = sampleall = splitter = NULL;
+    samplecounts = sampledispls = NULL;
   }
 
   if (sort_flag) {
-    if (multiproc > 1)
-      error->all(FLERR,
-                 "Cannot dump sort when multiple dump files are written");
     if (sortcol == 0 && atom->tag_enable == 0)
       error->all(FLERR,"Cannot dump sort on atom IDs with no atom IDs defined");
     if (sortcol && sortcol > size_one)
@@ -224,6 +282,18 @@ void Dump::init()
     if (nprocs > 1 && irregular == NULL)
       irregular = new Irregular(lmp);
 
+    // proc 0 gathers up to NSAMPLE keys per proc, plus one per proc
+    //   for procs whose share rounds down to zero
+
+    if (nprocs > 1 && splitter == NULL) {
+      memory->create(splitter,nprocs,"dump:splitter");
+      if (me == 0) {
+        memory->create(sampleall,(NSAMPLE+1)*nprocs,"dump:sampleall");
+        memory->create(samplecounts,nprocs,"dump:samplecounts");
+        memory->create(sampledispls,nprocs,"dump:sampledispls");
+      }
+    }
+
     bigint size = group->count(igroup);
     if (size > MAXSMALLINT) error->all(FLERR,"Too many atoms to dump sort");
     int isize = static_cast<int> (size);
@@ -343,16 +413,6 @@ void Dump::write()
   if (multiproc != nprocs) MPI_Allreduce(&nme,&nmax,1,MPI_INT,MPI_MAX,world);
   else nmax = nme;
 
-  // write timestep header
-  // for multiproc,
-  //   nheader = # of lines in this file via Allreduce on clustercomm
-
-  bigint nheader = ntotal;
-  if (multiproc)
-    MPI_Allreduce(&bnme,&nheader,1,MPI_LMP_BIGINT,MPI_SUM,clustercomm);
-
-  if (filewriter) write_header(nheader);
-
   // insure buf is sized for packing and communicating
   // use nmax to insure filewriter proc can receive info from others
   // limit nmax*size_one to int since used as arg in MPI calls
@@ -400,6 +460,27 @@ void Dump::write()
   else pack(NULL);
   if (sort_flag) sort();
 
+  // write timestep header
+  // for multiproc,
+  //   nheader = # of lines in this file via Allreduce on clustercomm
+  //   done after sort since sort changes # of lines on each proc
+
+  bigint nheader = ntotal;
+  if (multiproc) {
+    bnme = nme;
+    MPI_Allreduce(&bnme,&nheader,1,MPI_LMP_BIGINT,MPI_SUM,clustercomm);
+  }
+
+  // if compressing in-process, header is compressed as its own chunk
+
+  if (filewriter) {
+    if (zinline) {
+      FILE *fpfile = zscratch_begin();
+      write_header(nheader);
+      zscratch_end(fpfile);
+    } else write_header(nheader);
+  }
+
   // if buffering, convert doubles into strings
   // insure sbuf is sized for communicating
   // cannot buffer if output is to binary file
@@ -416,6 +497,21 @@ void Dump::write()
       maxsbuf = nsmax;
       memory->grow(sbuf,maxsbuf,"dump:sbuf");
     }
+
+    // if compressing in-process, each proc compresses its own string
+    // insure zbuf is sized for filewriter to receive compressed strings
+
+    if (zinline) {
+      nzme = compress_string(sbuf,nsme);
+      int nzmax;
+      if (multiproc != nprocs)
+        MPI_Allreduce(&nzme,&nzmax,1,MPI_INT,MPI_MAX,world);
+      else nzmax = nzme;
+      if (nzmax > maxzbuf) {
+        maxzbuf = nzmax;
+        memory->grow(zbuf,maxzbuf,"dump:zbuf");
+      }
+    }
   }
 
   // filewriter = 1 = this proc writes to file
@@ -430,6 +526,8 @@ void Dump::write()
 
   if (buffer_flag == 0 || binary) {
     if (filewriter) {
+      FILE *fpfile = NULL;
+      if (zinline) fpfile = zscratch_begin();
       for (int iproc = 0; iproc < nclusterprocs; iproc++) {
         if (iproc) {
           MPI_Irecv(buf,maxbuf*size_one,MPI_DOUBLE,me+iproc,0,world,&request);
@@ -441,6 +539,7 @@ void Dump::write()
 
         write_data(nlines,buf);
       }
+      if (zinline) zscratch_end(fpfile);
       if (flush_flag && fp) fflush(fp);
 
     } else {
@@ -449,24 +548,34 @@ void Dump::write()
     }
 
   // comm and output sbuf = one big string of formatted values per proc
+  // if compressing in-process, zbuf = compressed sbuf of each proc
 
   } else {
+    char *cbuf = sbuf;
+    int maxcbuf = maxsbuf;
+    int ncme = nsme;
+    if (zinline) {
+      cbuf = zbuf;
+      maxcbuf = maxzbuf;
+      ncme = nzme;
+    }
+
     if (filewriter) {
       for (int iproc = 0; iproc < nclusterprocs; iproc++) {
         if (iproc) {
-          MPI_Irecv(sbuf,maxsbuf,MPI_CHAR,me+iproc,0,world,&request);
+          MPI_Irecv(cbuf,maxcbuf,MPI_CHAR,me+iproc,0,world,&request);
           MPI_Send(&tmp,0,MPI_INT,me+iproc,0,world);
           MPI_Wait(&request,&status);
           MPI_Get_count(&status,MPI_CHAR,&nchars);
-        } else nchars = nsme;
+        } else nchars = ncme;
 
-        write_data(nchars,(double *) sbuf);
+        write_data(nchars,(double *) cbuf);
       }
       if (flush_flag && fp) fflush(fp);
 
     } else {
       MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,MPI_STATUS_IGNORE);
-      MPI_Rsend(sbuf,nsme,MPI_CHAR,fileproc,0,world);
+      MPI_Rsend(cbuf,ncme,MPI_CHAR,fileproc,0,world);
     }
   }
 
@@ -481,7 +590,7 @@ void Dump::write()
   // if file per timestep, close file if I am filewriter
 
   if (multifile) {
-    if (compressed) {
+    if (compressed && !zinline) {
       if (filewriter && fp != NULL) pclose(fp);
     } else {
       if (filewriter && fp != NULL) fclose(fp);
@@ -493,11 +602,15 @@ void Dump::write()
 /* ----------------------------------------------------------------------
    generic opening of a dump file
    ASCII or binary or gzipped
+   gzipped or zstd file is compressed in-process if LAMMPS was built
+     with zlib or zstd, else gzipped file is written via a gzip pipe
    some derived classes override this function
 ------------------------------------------------------------------------- */
 
 void Dump::openfile()
 {
+  zinline = (compressed && zformat != PIPE);
+
   // single file, already opened, so just return
 
   if (singlefile_opened) return;
@@ -527,8 +640,19 @@ void Dump::openfile()
 
   // each proc with filewriter = 1 opens a file
 
+  // in-process compressed output is a series of complete gzip members
+  //   or zstd frames, so appending to an existing file is valid
+
   if (filewriter) {
-    if (compressed) {
+    if (zinline) {
+      if (append_flag) fp = fopen(filecurrent,"ab");
+      else fp = fopen(filecurrent,"wb");
+      if (zscratch == NULL) {
+        zscratch = tmpfile();
+        if (zscratch == NULL)
+          error->one(FLERR,"Cannot open scratch file for compressed dump");
+      }
+    } else if (compressed) {
 #ifdef LAMMPS_GZIP
       char gzip[128];
       sprintf(gzip,"gzip -6 > %s",filecurrent);
@@ -604,8 +728,12 @@ void Dump::sort()
     }
 
     // proclist[i] = which proc Ith datum will be sent to
+    // if reordering, each proc gets a uniform range of consecutive IDs
+    // else each proc gets the range of keys below its splitter,
+    //   splitters are chosen from sampled keys so that procs get
+    //   about equal # of datums for any distribution of keys
 
-    if (sortcol == 0) {
+    if (reorderflag) {
       tagint min = MAXTAGINT;
       tagint max = 0;
       for (i = 0; i < nme; i++) {
@@ -627,24 +755,23 @@ void Dump::sort()
       }
 
     } else {
-      double min = BIG;
-      double max = -BIG;
-      for (i = 0; i < nme; i++) {
-        value = buf[i*size_one + sortcolm1];
-        min = MIN(min,value);
-        max = MAX(max,value);
-      }
-      double minall,maxall;
-      MPI_Allreduce(&min,&minall,1,MPI_DOUBLE,MPI_MIN,world);
-      MPI_Allreduce(&max,&maxall,1,MPI_DOUBLE,MPI_MAX,world);
-      double range = maxall-minall + EPSILON*(maxall-minall);
-      if (range == 0.0) range = EPSILON;
+      sample_splitters();
 
+      // binary search for 1st proc whose splitter is above value
       // proc assignment is inverted if sortorder = DESCEND
 
+      int lo,hi,mid;
       for (i = 0; i < nme; i++) {
-        value = buf[i*size_one + sortcolm1];
-        iproc = static_cast<int> ((value-minall)/range * nprocs);
+        if (sortcol == 0) value = ids[i];
+        else value = buf[i*size_one + sortcolm1];
+        lo = 0;
+        hi = nprocs-1;
+        while (lo < hi) {
+          mid = (lo+hi)/2;
+          if (value < splitter[mid]) hi = mid;
+          else lo = mid+1;
+        }
+        iproc = lo;
         if (sortorder == DESCEND) iproc = nprocs-1 - iproc;
         proclist[i] = iproc;
       }
@@ -728,6 +855,79 @@ void Dump::sort()
     memcpy(&buf[i*size_one],&bufsort[index[i]*size_one],nbytes);
 }
 
+/* ----------------------------------------------------------------------
+   choose splitters for parallel sort from a sample of sort keys
+   each proc samples keys in proportion to its # of datums,
+     so procs with more datums weigh more in the choice
+   proc 0 sorts all samples and picks splitters at equal spacing
+   splitter[i] = lowest key of proc I+1, splitter[nprocs-1] is unused
+   IDs are sampled as doubles, conversion keeps their order
+------------------------------------------------------------------------- */
+
+void Dump::sample_splitters()
+{
+  int i;
+
+  int nsample = 0;
+  if (ntotal) nsample = static_cast<int> ((bigint) NSAMPLE*nprocs*nme/ntotal);
+  if (nme && nsample == 0) nsample = 1;
+  nsample = MIN(nsample,nme);
+
+  if (nsample > maxsample) {
+    maxsample = nsample;
+    memory->destroy(sample);
+    memory->create(sample,maxsample,"dump:sample");
+  }
+
+  // sample keys at regular stride through my unsorted datums
+
+  int m;
+  for (i = 0; i < nsample; i++) {
+    m = static_cast<int> ((bigint) i*nme/nsample);
+    if (sortcol == 0) sample[i] = ids[m];
+    else sample[i] = buf[m*size_one + sortcolm1];
+  }
+
+  MPI_Gather(&nsample,1,MPI_INT,samplecounts,1,MPI_INT,0,world);
+
+  int nall = 0;
+  if (me == 0) {
+    for (i = 0; i < nprocs; i++) {
+      sampledispls[i] = nall;
+      nall += samplecounts[i];
+    }
+  }
+
+  MPI_Gatherv(sample,nsample,MPI_DOUBLE,
+              sampleall,samplecounts,sampledispls,MPI_DOUBLE,0,world);
+
+  if (me == 0) {
+    qsort(sampleall,nall,sizeof(double),samplecompare);
+    for (i = 0; i < nprocs-1; i++) {
+      if (nall) splitter[i] = sampleall[(bigint) (i+1)*nall/nprocs];
+      else splitter[i] = BIG;
+    }
+    splitter[nprocs-1] = BIG;
+  }
+
+  MPI_Bcast(splitter,nprocs,MPI_DOUBLE,0,world);
+}
+
+/* ----------------------------------------------------------------------
+   compare two sampled sort keys
+   called via qsort() in sample_splitters() method
+------------------------------------------------------------------------- */
+
+int Dump::samplecompare(const void *pi, const void *pj)
+{
+  double vi = *((const double *) pi);
+  double vj = *((const double *) pj);
+
+  if (vi < vj) return -1;
+  else if (vi > vj) return 1;
+  else return 0;
+}
+
 #if defined(LMP_QSORT)
 
 /* ----------------------------------------------------------------------
@@ -876,6 +1076,19 @@ void Dump::modify_params(int narg, char **arg)
         error->all(FLERR,"Dump_modify buffer yes not allowed for this style");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"compression_level") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
+      if (!compressed || zformat == PIPE)
+        error->all(FLERR,"Dump_modify compression_level requires "
+                   "in-process compression");
+      zlevel = force->inumeric(FLERR,arg[iarg+1]);
+      if (zformat == GZIP && (zlevel < 0 || zlevel > 9))
+        error->all(FLERR,"Illegal dump_modify command");
+      if (zformat == ZSTD && (zlevel < 1 || zlevel > 22))
+        error->all(FLERR,"Illegal dump_modify command");
+      free_zstate();
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"every") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
       int idump;
@@ -1059,6 +1272,138 @@ void Dump::pbc_allocate()
   memory->create(imagepbc,maxpbc,"dump:imagebpc");
 }
 
+/* ----------------------------------------------------------------------
+   compress n chars of str into zbuf as one complete gzip member or zstd
+     frame, so chunks compressed by different procs can be written one
+     after another and the file is still read by gzip or zstd
+   return # of compressed bytes
+------------------------------------------------------------------------- */
+
+int Dump::compress_string(char *str, int n)
+{
+  if (n == 0) return 0;
+
+  int nz = 0;
+
+#ifdef LAMMPS_ZLIB
+  if (zformat == GZIP) {
+    z_stream *zs = (z_stream *) zstate;
+
+    // windowBits 15+16 = deflate with gzip header and trailer
+    // stream is kept and reset for each chunk
+
+    if (zs == NULL) {
+      zs = (z_stream *) memory->smalloc(sizeof(z_stream),"dump:zstate");
+      zs->zalloc = Z_NULL;
+      zs->zfree = Z_NULL;
+      zs->opaque = Z_NULL;
+      if (deflateInit2(zs,zlevel,Z_DEFLATED,15+16,8,Z_DEFAULT_STRATEGY) != Z_OK)
+        error->one(FLERR,"Dump compression failed");
+      zstate = zs;
+    } else deflateReset(zs);
+
+    bigint nbound = deflateBound(zs,n);
+    if (nbound > MAXSMALLINT)
+      error->one(FLERR,"Too much buffered per-proc info for dump");
+    if (nbound > maxzbuf) {
+      maxzbuf = nbound;
+      memory->grow(zbuf,maxzbuf,"dump:zbuf");
+    }
+
+    zs->next_in = (Bytef *) str;
+    zs->avail_in = n;
+    zs->next_out = (Bytef *) zbuf;
+    zs->avail_out = maxzbuf;
+    if (deflate(zs,Z_FINISH) != Z_STREAM_END)
+      error->one(FLERR,"Dump compression failed");
+    nz = maxzbuf - zs->avail_out;
+  }
+#endif
+
+#ifdef LAMMPS_ZSTD
+  if (zformat == ZSTD) {
+    if (zstate == NULL) {
+      zstate = ZSTD_createCCtx();
+      if (zstate == NULL) error->one(FLERR,"Dump compression failed");
+    }
+
+    bigint nbound = ZSTD_compressBound(n);
+    if (nbound > MAXSMALLINT)
+      error->one(FLERR,"Too much buffered per-proc info for dump");
+    if (nbound > maxzbuf) {
+      maxzbuf = nbound;
+      memory->grow(zbuf,maxzbuf,"dump:zbuf");
+    }
+
+    size_t nbytes = ZSTD_compressCCtx((ZSTD_CCtx *) zstate,zbuf,maxzbuf,
+                                      str,n,zlevel);
+    if (ZSTD_isError(nbytes)) error->one(FLERR,"Dump compression failed");
+    nz = nbytes;
+  }
+#endif
+
+  return nz;
+}
+
+/* ----------------------------------------------------------------------
+   redirect text the filewriter writes to fp into the scratch file
+   return the dump file fp pointed to
+------------------------------------------------------------------------- */
+
+FILE *Dump::zscratch_begin()
+{
+  FILE *fpfile = fp;
+  rewind(zscratch);
+  fp = zscratch;
+  return fpfile;
+}
+
+/* ----------------------------------------------------------------------
+   compress text accumulated in scratch file as one chunk
+   write it to dump file fpfile and point fp back to it
+------------------------------------------------------------------------- */
+
+void Dump::zscratch_end(FILE *fpfile)
+{
+  fp = fpfile;
+
+  bigint n = ftell(zscratch);
+  if (n > MAXSMALLINT)
+    error->one(FLERR,"Too much buffered per-proc info for dump");
+  if (n > maxsbuf) {
+    maxsbuf = n;
+    memory->grow(sbuf,maxsbuf,"dump:sbuf");
+  }
+
+  rewind(zscratch);
+  if (fread(sbuf,1,n,zscratch) != (size_t) n)
+    error->one(FLERR,"Dump compression failed");
+
+  int nz = compress_string(sbuf,n);
+  fwrite(zbuf,1,nz,fp);
+}
+
+/* ----------------------------------------------------------------------
+   free zlib stream or zstd context
+------------------------------------------------------------------------- */
+
+void Dump::free_zstate()
+{
+  if (zstate == NULL) return;
+
+#ifdef LAMMPS_ZLIB
+  if (zformat == GZIP) {
+    deflateEnd((z_stream *) zstate);
+    memory->sfree(zstate);
+  }
+#endif
+#ifdef LAMMPS_ZSTD
+  if (zformat == ZSTD) ZSTD_freeCCtx((ZSTD_CCtx *) zstate);
+#endif
+
+  zstate = NULL;
+}
+
 /* ----------------------------------------------------------------------
    return # of bytes of allocated memory
 ------------------------------------------------------------------------- */
@@ -1067,7 +1412,15 @@ bigint Dump::memory_usage()
 {
   bigint bytes = memory->usage(buf,size_one*maxbuf);
   bytes += memory->usage(sbuf,maxsbuf);
+  bytes += memory->usage(zbuf,maxzbuf);
   if (sort_flag) {
+    bytes += memory->usage(sample,maxsample);
+    if (splitter) bytes += memory->usage(splitter,nprocs);
+    if (sampleall) {
+      bytes += memory->usage(sampleall,(NSAMPLE+1)*nprocs);
+      bytes += memory->usage(samplecounts,nprocs);
+      bytes += memory->usage(sampledispls,nprocs);
+    }
     if (sortcol == 0) bytes += memory->usage(ids,maxids);
     bytes += memory->usage(bufsort,size_one*maxsort);
     if (sortcol == 0) bytes += memory->usage(idsort,maxsort);
@@ -55,6 +55,11 @@ class Dump : protected Pointers {
   int me,nprocs;             // proc info
 
   int compressed;            // 1 if dump file is written compressed, 0 no
+  int zformat;               // GZIP or ZSTD if compressed in-process,
+                             // PIPE if compressed by a gzip pipe
+  int zinline;               // 1 if file was opened for in-process
+                             // compression, 0 if not
+  int zlevel;                // compression level for in-process
   int binary;                // 1 if dump file is written binary, 0 no
   int multifile;             // 0 = one big file, 1 = one file per timestep
   int multiproc;             // 0 = proc 0 writes for all,
@@ -110,6 +115,12 @@ class Dump : protected Pointers {
   int maxsbuf;               // size of sbuf
   char *sbuf;                // memory for atom quantities in string format
 
+  int maxzbuf;               // size of zbuf
+  char *zbuf;                // memory for compressed string output
+  int nzme;                  // # of compressed bytes in output from me
+  void *zstate;              // zlib stream or zstd context
+  FILE *zscratch;            // holds text written to fp until compressed
+
   int maxids;                // size of ids
   int maxsort;               // size of bufsort, idsort, index
   int maxproc;               // size of proclist
@@ -118,6 +129,13 @@ class Dump : protected Pointers {
   tagint *idsort;
   int *index,*proclist;
 
+  int maxsample;             // size of sample
+  double *sample;            // sort keys I sample to choose splitters
+  double *sampleall;         // sampled keys from all procs, only on proc 0
+  int *samplecounts;         // # of sampled keys from each proc, on proc 0
+  int *sampledispls;         // offset of sampled keys of each proc, on proc 0
+  double *splitter;          // splitter[i] = upper bound of keys of proc i
+
   double **xpbc,**vpbc;
   imageint *imagepbc;
   int maxpbc;
@@ -134,7 +152,14 @@ class Dump : protected Pointers {
   virtual void write_data(int, double *) = 0;
   void pbc_allocate();
 
+  int compress_string(char *, int);
+  FILE *zscratch_begin();
+  void zscratch_end(FILE *);
+  void free_zstate();
+
   void sort();
+  void sample_splitters();
+  static int samplecompare(const void *, const void *);
 #if defined(LMP_QSORT)
   static int idcompare(const void *, const void *);
   static int bufcompare(const void *, const void *);
@@ -157,11 +182,6 @@ E: Dump file MPI-IO output not allowed with % in filename
 This is because a % signifies one file per processor and MPI-IO
 creates one large file for all processors.
 
-E: Cannot dump sort when multiple dump files are written
-
-In this mode, each processor dumps its atoms to a file, so
-no sorting is allowed.
-
 E: Cannot dump sort on atom IDs with no atom IDs defined
 
 Self-explanatory.
@@ -184,6 +204,26 @@ E: Too much buffered per-proc info for dump
 The size of the buffered string must fit in a 32-bit integer for a
 dump.
 
+E: Dump file ending in .zst requires LAMMPS built with -DLAMMPS_ZSTD
+
+Zstd-compressed dump files are only written in-process with the zstd
+library.
+
+E: Cannot open scratch file for compressed dump
+
+The writing proc of a compressed dump file could not create a
+temporary file to hold text before it is compressed.
+
+E: Dump compression failed
+
+The zlib or zstd library returned an error while compressing dump
+output.
+
+E: Dump_modify compression_level requires in-process compression
+
+The compression level can only be set for a dump file ending in .gz
+or .zst when LAMMPS is built with -DLAMMPS_ZLIB or -DLAMMPS_ZSTD.
+
 E: Cannot open gzipped file
 
 LAMMPS was compiled without support for reading and writing gzipped
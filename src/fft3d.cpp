@@ -34,6 +34,10 @@
 #define MIN(A,B) ((A) < (B) ? (A) : (B))
 #define MAX(A,B) ((A) > (B) ? (A) : (B))
 
+static FFT_DATA *fft_3d_pipeline(FFT_DATA *, FFT_DATA *, int,
+                                 struct fft_plan_3d *);
+static void fft_1d_planes(FFT_DATA *, int, int, int, struct fft_plan_3d *);
+
 /* ----------------------------------------------------------------------
    Data layout for 3d FFTs:
 
@@ -94,83 +98,89 @@ void fft_3d(FFT_DATA *in, FFT_DATA *out, int flag, struct fft_plan_3d *plan)
   else
     data = in;
 
-  // 1d FFTs along fast axis
+  // with pipelined transposes, the 1d FFTs along fast and mid axes
+  //   and the two mid-remaps are done one batch of planes at a time
+
+  if (plan->nbatch) data = fft_3d_pipeline(data,out,flag,plan);
+  else {
+    // 1d FFTs along fast axis
 
-  total = plan->total1;
-  length = plan->length1;
+    total = plan->total1;
+    length = plan->length1;
 
 #if defined(FFT_MKL)
-  if (flag == -1)
-    DftiComputeForward(plan->handle_fast,data);
-  else
-    DftiComputeBackward(plan->handle_fast,data);
+    if (flag == -1)
+      DftiComputeForward(plan->handle_fast,data);
+    else
+      DftiComputeBackward(plan->handle_fast,data);
 #elif defined(FFT_FFTW2)
-  if (flag == -1)
-    fftw(plan->plan_fast_forward,total/length,data,1,length,NULL,0,0);
-  else
-    fftw(plan->plan_fast_backward,total/length,data,1,length,NULL,0,0);
+    if (flag == -1)
+      fftw(plan->plan_fast_forward,total/length,data,1,length,NULL,0,0);
+    else
+      fftw(plan->plan_fast_backward,total/length,data,1,length,NULL,0,0);
 #elif defined(FFT_FFTW3)
-  if (flag == -1)
-    theplan=plan->plan_fast_forward;
-  else
-    theplan=plan->plan_fast_backward;
-  FFTW_API(execute_dft)(theplan,data,data);
+    if (flag == -1)
+      theplan=plan->plan_fast_forward;
+    else
+      theplan=plan->plan_fast_backward;
+    FFTW_API(execute_dft)(theplan,data,data);
 #else
-  if (flag == -1)
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_fast_forward,&data[offset],&data[offset]);
-  else
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_fast_backward,&data[offset],&data[offset]);
+    if (flag == -1)
+      for (offset = 0; offset < total; offset += length)
+        kiss_fft(plan->cfg_fast_forward,&data[offset],&data[offset]);
+    else
+      for (offset = 0; offset < total; offset += length)
+        kiss_fft(plan->cfg_fast_backward,&data[offset],&data[offset]);
 #endif
 
-  // 1st mid-remap to prepare for 2nd FFTs
-  // copy = loc for remap result
+    // 1st mid-remap to prepare for 2nd FFTs
+    // copy = loc for remap result
 
-  if (plan->mid1_target == 0) copy = out;
-  else copy = plan->copy;
-  remap_3d((FFT_SCALAR *) data, (FFT_SCALAR *) copy,
-           (FFT_SCALAR *) plan->scratch, plan->mid1_plan);
-  data = copy;
+    if (plan->mid1_target == 0) copy = out;
+    else copy = plan->copy;
+    remap_3d((FFT_SCALAR *) data, (FFT_SCALAR *) copy,
+             (FFT_SCALAR *) plan->scratch, plan->mid1_plan);
+    data = copy;
 
-  // 1d FFTs along mid axis
+    // 1d FFTs along mid axis
 
-  total = plan->total2;
-  length = plan->length2;
+    total = plan->total2;
+    length = plan->length2;
 
 #if defined(FFT_MKL)
-  if (flag == -1)
-    DftiComputeForward(plan->handle_mid,data);
-  else
-    DftiComputeBackward(plan->handle_mid,data);
+    if (flag == -1)
+      DftiComputeForward(plan->handle_mid,data);
+    else
+      DftiComputeBackward(plan->handle_mid,data);
 #elif defined(FFT_FFTW2)
-  if (flag == -1)
-    fftw(plan->plan_mid_forward,total/length,data,1,length,NULL,0,0);
-  else
-    fftw(plan->plan_mid_backward,total/length,data,1,length,NULL,0,0);
+    if (flag == -1)
+      fftw(plan->plan_mid_forward,total/length,data,1,length,NULL,0,0);
+    else
+      fftw(plan->plan_mid_backward,total/length,data,1,length,NULL,0,0);
 #elif defined(FFT_FFTW3)
-  if (flag == -1)
-    theplan=plan->plan_mid_forward;
-  else
-    theplan=plan->plan_mid_backward;
-  FFTW_API(execute_dft)(theplan,data,data);
+    if (flag == -1)
+      theplan=plan->plan_mid_forward;
+    else
+      theplan=plan->plan_mid_backward;
+    FFTW_API(execute_dft)(theplan,data,data);
 #else
-  if (flag == -1)
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_mid_forward,&data[offset],&data[offset]);
-  else
-    for (offset = 0; offset < total; offset += length)
-      kiss_fft(plan->cfg_mid_backward,&data[offset],&data[offset]);
+    if (flag == -1)
+      for (offset = 0; offset < total; offset += length)
+        kiss_fft(plan->cfg_mid_forward,&data[offset],&data[offset]);
+    else
+      for (offset = 0; offset < total; offset += length)
+        kiss_fft(plan->cfg_mid_backward,&data[offset],&data[offset]);
 #endif
 
-  // 2nd mid-remap to prepare for 3rd FFTs
-  // copy = loc for remap result
+    // 2nd mid-remap to prepare for 3rd FFTs
+    // copy = loc for remap result
 
-  if (plan->mid2_target == 0) copy = out;
-  else copy = plan->copy;
-  remap_3d((FFT_SCALAR *) data, (FFT_SCALAR *) copy,
-           (FFT_SCALAR *) plan->scratch, plan->mid2_plan);
-  data = copy;
+    if (plan->mid2_target == 0) copy = out;
+    else copy = plan->copy;
+    remap_3d((FFT_SCALAR *) data, (FFT_SCALAR *) copy,
+             (FFT_SCALAR *) plan->scratch, plan->mid2_plan);
+    data = copy;
+  }
 
   // 1d FFTs along slow axis
 
@@ -249,6 +259,8 @@ void fft_3d(FFT_DATA *in, FFT_DATA *out, int flag, struct fft_plan_3d *plan)
                           2 = permute twice = slow->fast, fast->mid, mid->slow
    nbuf                 returns size of internal storage buffers used by FFT
    usecollective        use collective MPI operations for remapping data
+   nbatch               # of batches for pipelined mid-remaps
+                          0 = blocking mid-remaps
 ------------------------------------------------------------------------- */
 
 struct fft_plan_3d *fft_3d_create_plan(
@@ -257,7 +269,7 @@ struct fft_plan_3d *fft_3d_create_plan(
        int in_klo, int in_khi,
        int out_ilo, int out_ihi, int out_jlo, int out_jhi,
        int out_klo, int out_khi,
-       int scaled, int permute, int *nbuf, int usecollective)
+       int scaled, int permute, int *nbuf, int usecollective, int nbatch)
 {
   struct fft_plan_3d *plan;
   int me,nprocs;
@@ -267,6 +279,7 @@ struct fft_plan_3d *fft_3d_create_plan(
   int third_ilo,third_ihi,third_jlo,third_jhi,third_klo,third_khi;
   int out_size,first_size,second_size,third_size,copy_size,scratch_size;
   int np1,np2,ip1,ip2;
+  int i,nplanes;
 
   // query MPI info
 
@@ -293,6 +306,14 @@ struct fft_plan_3d *fft_3d_create_plan(
   else
     flag = 1;
 
+  // pipelined mid-remaps need the 1st FFTs on the np1 x np2 pencils,
+  //   so that the 1st mid-remap keeps each slow plane on the same procs
+
+  if (nbatch > 0 &&
+      (in_jlo != ip1*nmid/np1 || in_jhi != (ip1+1)*nmid/np1 - 1 ||
+       in_klo != ip2*nslow/np2 || in_khi != (ip2+1)*nslow/np2 - 1))
+    flag = 1;
+
   MPI_Allreduce(&flag,&remapflag,1,MPI_INT,MPI_MAX,comm);
 
   if (remapflag == 0) {
@@ -350,8 +371,10 @@ struct fft_plan_3d *fft_3d_create_plan(
   // if final distribution is permute=2 with all procs owning entire slow axis
   //   then this remapping goes directly to final distribution
   //  third indices = distribution after 3rd set of FFTs
+  // pipelined mid-remaps always go to the np1 x np2 pencils,
+  //   so that the 2nd mid-remap keeps each fast index on the same procs
 
-  if (permute == 2 && out_klo == 0 && out_khi == nslow-1)
+  if (nbatch == 0 && permute == 2 && out_klo == 0 && out_khi == nslow-1)
     flag = 0;
   else
     flag = 1;
@@ -480,6 +503,67 @@ struct fft_plan_3d *fft_3d_create_plan(
   }
   else plan->scratch = NULL;
 
+  // batched mid-remaps for pipelined transposes
+  // the slow index of the 1st and 2nd FFTs is split into nbatch batches
+  //   of planes, the mid-remap of one batch is in flight
+  //   while the 1d FFTs of the next batch are computed
+  // the 1st mid-remap moves data only between procs with the same ip2,
+  //   the 2nd only between procs with the same ip1,
+  //   so the partners of each batch own the same planes
+  // each batch plan keeps its own send and recv buffers,
+  //   which add about first_size + 2*second_size + third_size to nbuf
+
+  plan->nbatch = 0;
+  plan->plane1 = plan->plane2 = NULL;
+  plan->nplane1 = plan->nplane2 = 0;
+  plan->mid1_batch = plan->mid2_batch = NULL;
+
+  if (nbatch > 0) {
+    plan->nbatch = nbatch;
+    plan->plane1 = (int *) malloc((nbatch+1)*sizeof(int));
+    plan->plane2 = (int *) malloc((nbatch+1)*sizeof(int));
+    plan->mid1_batch = (struct remap_plan_3d **)
+      malloc(nbatch*sizeof(struct remap_plan_3d *));
+    plan->mid2_batch = (struct remap_plan_3d **)
+      malloc(nbatch*sizeof(struct remap_plan_3d *));
+    if (plan->plane1 == NULL || plan->plane2 == NULL ||
+        plan->mid1_batch == NULL || plan->mid2_batch == NULL) return NULL;
+
+    nplanes = MAX(first_khi-first_klo+1,0);
+    for (i = 0; i <= nbatch; i++) plan->plane1[i] = i*nplanes/nbatch;
+    plan->nplane1 = nfast * MAX(first_jhi-first_jlo+1,0);
+
+    for (i = 0; i < nbatch; i++) {
+      plan->mid1_batch[i] =
+        remap_3d_create_plan_batch(comm,
+                                   first_ilo,first_ihi,first_jlo,first_jhi,
+                                   first_klo,first_khi,
+                                   second_ilo,second_ihi,second_jlo,second_jhi,
+                                   second_klo,second_khi,2,1,FFT_PRECISION,
+                                   first_klo+plan->plane1[i],
+                                   first_klo+plan->plane1[i+1]-1);
+      if (plan->mid1_batch[i] == NULL) return NULL;
+    }
+
+    nplanes = MAX(second_ihi-second_ilo+1,0);
+    for (i = 0; i <= nbatch; i++) plan->plane2[i] = i*nplanes/nbatch;
+    plan->nplane2 = nmid * MAX(second_khi-second_klo+1,0);
+
+    for (i = 0; i < nbatch; i++) {
+      plan->mid2_batch[i] =
+        remap_3d_create_plan_batch(comm,
+                                   second_jlo,second_jhi,second_klo,second_khi,
+                                   second_ilo,second_ihi,
+                                   third_jlo,third_jhi,third_klo,third_khi,
+                                   third_ilo,third_ihi,2,1,FFT_PRECISION,
+                                   second_ilo+plan->plane2[i],
+                                   second_ilo+plan->plane2[i+1]-1);
+      if (plan->mid2_batch[i] == NULL) return NULL;
+    }
+
+    *nbuf += first_size + 2*second_size + third_size;
+  }
+
   // system specific pre-computation of 1d FFT coeffs
   // and scaling normalization
 
@@ -511,6 +595,30 @@ struct fft_plan_3d *fft_3d_create_plan(
   DftiSetValue(plan->handle_slow, DFTI_OUTPUT_DISTANCE, (MKL_LONG)nslow);
   DftiCommitDescriptor(plan->handle_slow);
 
+  plan->handle_plane1 = plan->handle_plane2 = NULL;
+
+  if (plan->nplane1) {
+    DftiCreateDescriptor( &(plan->handle_plane1), FFT_MKL_PREC, DFTI_COMPLEX,
+                          1, (MKL_LONG)nfast);
+    DftiSetValue(plan->handle_plane1, DFTI_NUMBER_OF_TRANSFORMS,
+                 (MKL_LONG)plan->nplane1/nfast);
+    DftiSetValue(plan->handle_plane1, DFTI_PLACEMENT,DFTI_INPLACE);
+    DftiSetValue(plan->handle_plane1, DFTI_INPUT_DISTANCE, (MKL_LONG)nfast);
+    DftiSetValue(plan->handle_plane1, DFTI_OUTPUT_DISTANCE, (MKL_LONG)nfast);
+    DftiCommitDescriptor(plan->handle_plane1);
+  }
+
+  if (plan->nplane2) {
+    DftiCreateDescriptor( &(plan->handle_plane2), FFT_MKL_PREC, DFTI_COMPLEX,
+                          1, (MKL_LONG)nmid);
+    DftiSetValue(plan->handle_plane2, DFTI_NUMBER_OF_TRANSFORMS,
+                 (MKL_LONG)plan->nplane2/nmid);
+    DftiSetValue(plan->handle_plane2, DFTI_PLACEMENT,DFTI_INPLACE);
+    DftiSetValue(plan->handle_plane2, DFTI_INPUT_DISTANCE, (MKL_LONG)nmid);
+    DftiSetValue(plan->handle_plane2, DFTI_OUTPUT_DISTANCE, (MKL_LONG)nmid);
+    DftiCommitDescriptor(plan->handle_plane2);
+  }
+
   if (scaled == 0)
     plan->scaled = 0;
   else {
@@ -594,6 +702,38 @@ struct fft_plan_3d *fft_3d_create_plan(
                             NULL,&nslow,1,plan->length3,
                             FFTW_BACKWARD,FFTW_ESTIMATE);
 
+  // plans for a single plane of pipelined 1st and 2nd FFTs
+  // planes start at any offset in the data, so they may be unaligned
+
+  plan->plan_plane1_forward = plan->plan_plane1_backward = NULL;
+  plan->plan_plane2_forward = plan->plan_plane2_backward = NULL;
+
+  if (plan->nplane1) {
+    plan->plan_plane1_forward =
+      FFTW_API(plan_many_dft)(1, &nfast,plan->nplane1/nfast,
+                              NULL,&nfast,1,nfast,
+                              NULL,&nfast,1,nfast,
+                              FFTW_FORWARD,FFTW_ESTIMATE | FFTW_UNALIGNED);
+    plan->plan_plane1_backward =
+      FFTW_API(plan_many_dft)(1, &nfast,plan->nplane1/nfast,
+                              NULL,&nfast,1,nfast,
+                              NULL,&nfast,1,nfast,
+                              FFTW_BACKWARD,FFTW_ESTIMATE | FFTW_UNALIGNED);
+  }
+
+  if (plan->nplane2) {
+    plan->plan_plane2_forward =
+      FFTW_API(plan_many_dft)(1, &nmid,plan->nplane2/nmid,
+                              NULL,&nmid,1,nmid,
+                              NULL,&nmid,1,nmid,
+                              FFTW_FORWARD,FFTW_ESTIMATE | FFTW_UNALIGNED);
+    plan->plan_plane2_backward =
+      FFTW_API(plan_many_dft)(1, &nmid,plan->nplane2/nmid,
+                              NULL,&nmid,1,nmid,
+                              NULL,&nmid,1,nmid,
+                              FFTW_BACKWARD,FFTW_ESTIMATE | FFTW_UNALIGNED);
+  }
+
   if (scaled == 0)
     plan->scaled = 0;
   else {
@@ -642,6 +782,101 @@ struct fft_plan_3d *fft_3d_create_plan(
   return plan;
 }
 
+/* ----------------------------------------------------------------------
+   1d FFTs along fast and mid axes with pipelined mid-remaps
+   data = input to 1st FFTs, return location of input to 3rd FFTs
+------------------------------------------------------------------------- */
+
+static FFT_DATA *fft_3d_pipeline(FFT_DATA *data, FFT_DATA *out, int flag,
+                                 struct fft_plan_3d *plan)
+{
+  int ibatch;
+  FFT_DATA *copy;
+  int nbatch = plan->nbatch;
+
+  // 1d FFTs along fast axis, one batch of planes at a time
+  // the 1st mid-remap of each batch starts as soon as its FFTs are done
+  // all batches are packed before any is unpacked, so copy can be data
+
+  for (ibatch = 0; ibatch < nbatch; ibatch++) {
+    fft_1d_planes(&data[plan->plane1[ibatch]*plan->nplane1],
+                  plan->plane1[ibatch+1]-plan->plane1[ibatch],1,flag,plan);
+    remap_3d_start((FFT_SCALAR *) data,plan->mid1_batch[ibatch]);
+  }
+
+  if (plan->mid1_target == 0) copy = out;
+  else copy = plan->copy;
+  for (ibatch = 0; ibatch < nbatch; ibatch++)
+    remap_3d_finish((FFT_SCALAR *) copy,plan->mid1_batch[ibatch]);
+  data = copy;
+
+  // 1d FFTs along mid axis and 2nd mid-remap, same as above
+
+  for (ibatch = 0; ibatch < nbatch; ibatch++) {
+    fft_1d_planes(&data[plan->plane2[ibatch]*plan->nplane2],
+                  plan->plane2[ibatch+1]-plan->plane2[ibatch],2,flag,plan);
+    remap_3d_start((FFT_SCALAR *) data,plan->mid2_batch[ibatch]);
+  }
+
+  if (plan->mid2_target == 0) copy = out;
+  else copy = plan->copy;
+  for (ibatch = 0; ibatch < nbatch; ibatch++)
+    remap_3d_finish((FFT_SCALAR *) copy,plan->mid2_batch[ibatch]);
+
+  return copy;
+}
+
+/* ----------------------------------------------------------------------
+   1d FFTs of nplanes consecutive planes of the 1st (which = 1)
+     or 2nd (which = 2) FFTs
+------------------------------------------------------------------------- */
+
+static void fft_1d_planes(FFT_DATA *data, int nplanes, int which, int flag,
+                          struct fft_plan_3d *plan)
+{
+  int offset;
+  int nplane = (which == 1) ? plan->nplane1 : plan->nplane2;
+  int total = nplanes*nplane;
+
+#if defined(FFT_MKL)
+  DFTI_DESCRIPTOR *handle =
+    (which == 1) ? plan->handle_plane1 : plan->handle_plane2;
+  for (offset = 0; offset < total; offset += nplane) {
+    if (flag == -1)
+      DftiComputeForward(handle,&data[offset]);
+    else
+      DftiComputeBackward(handle,&data[offset]);
+  }
+#elif defined(FFT_FFTW2)
+  int length = (which == 1) ? plan->length1 : plan->length2;
+  fftw_plan theplan;
+  if (which == 1)
+    theplan = (flag == -1) ? plan->plan_fast_forward : plan->plan_fast_backward;
+  else
+    theplan = (flag == -1) ? plan->plan_mid_forward : plan->plan_mid_backward;
+  fftw(theplan,total/length,data,1,length,NULL,0,0);
+#elif defined(FFT_FFTW3)
+  FFTW_API(plan) theplan;
+  if (which == 1)
+    theplan = (flag == -1) ?
+      plan->plan_plane1_forward : plan->plan_plane1_backward;
+  else
+    theplan = (flag == -1) ?
+      plan->plan_plane2_forward : plan->plan_plane2_backward;
+  for (offset = 0; offset < total; offset += nplane)
+    FFTW_API(execute_dft)(theplan,&data[offset],&data[offset]);
+#else
+  int length = (which == 1) ? plan->length1 : plan->length2;
+  kiss_fft_cfg cfg;
+  if (which == 1)
+    cfg = (flag == -1) ? plan->cfg_fast_forward : plan->cfg_fast_backward;
+  else
+    cfg = (flag == -1) ? plan->cfg_mid_forward : plan->cfg_mid_backward;
+  for (offset = 0; offset < total; offset += length)
+    kiss_fft(cfg,&data[offset],&data[offset]);
+#endif
+}
+
 /* ----------------------------------------------------------------------
    Destroy a 3d fft plan
 ------------------------------------------------------------------------- */
@@ -653,6 +888,17 @@ void fft_3d_destroy_plan(struct fft_plan_3d *plan)
   if (plan->mid2_plan) remap_3d_destroy_plan(plan->mid2_plan);
   if (plan->post_plan) remap_3d_destroy_plan(plan->post_plan);
 
+  for (int i = 0; i < plan->nbatch; i++) {
+    remap_3d_destroy_plan(plan->mid1_batch[i]);
+    remap_3d_destroy_plan(plan->mid2_batch[i]);
+  }
+  if (plan->nbatch) {
+    free(plan->mid1_batch);
+    free(plan->mid2_batch);
+    free(plan->plane1);
+    free(plan->plane2);
+  }
+
   if (plan->copy) free(plan->copy);
   if (plan->scratch) free(plan->scratch);
 
@@ -660,6 +906,8 @@ void fft_3d_destroy_plan(struct fft_plan_3d *plan)
   DftiFreeDescriptor(&(plan->handle_fast));
   DftiFreeDescriptor(&(plan->handle_mid));
   DftiFreeDescriptor(&(plan->handle_slow));
+  if (plan->handle_plane1) DftiFreeDescriptor(&(plan->handle_plane1));
+  if (plan->handle_plane2) DftiFreeDescriptor(&(plan->handle_plane2));
 #elif defined(FFT_FFTW2)
   if (plan->plan_slow_forward != plan->plan_fast_forward &&
       plan->plan_slow_forward != plan->plan_mid_forward) {
@@ -679,6 +927,14 @@ void fft_3d_destroy_plan(struct fft_plan_3d *plan)
   FFTW_API(destroy_plan)(plan->plan_mid_backward);
   FFTW_API(destroy_plan)(plan->plan_fast_forward);
   FFTW_API(destroy_plan)(plan->plan_fast_backward);
+  if (plan->plan_plane1_forward) {
+    FFTW_API(destroy_plan)(plan->plan_plane1_forward);
+    FFTW_API(destroy_plan)(plan->plan_plane1_backward);
+  }
+  if (plan->plan_plane2_forward) {
+    FFTW_API(destroy_plan)(plan->plan_plane2_forward);
+    FFTW_API(destroy_plan)(plan->plan_plane2_backward);
+  }
 #else
   if (plan->cfg_slow_forward != plan->cfg_fast_forward &&
       plan->cfg_slow_forward != plan->cfg_mid_forward) {
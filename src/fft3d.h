@@ -133,11 +133,20 @@ struct fft_plan_3d {
   int normnum;                      // # of values to rescale
   double norm;                      // normalization factor for rescaling
 
+                                    // pipelined transposes
+  int nbatch;                       // # of batches, 0 = blocking remaps
+  int *plane1,*plane2;              // 1st plane of each batch of 1st,2nd FFTs
+  int nplane1,nplane2;              // # of values in a plane of 1st,2nd FFTs
+  struct remap_plan_3d **mid1_batch;    // 1st mid-remap of each batch
+  struct remap_plan_3d **mid2_batch;    // 2nd mid-remap of each batch
+
                                     // system specific 1d FFT info
 #if defined(FFT_MKL)
   DFTI_DESCRIPTOR *handle_fast;
   DFTI_DESCRIPTOR *handle_mid;
   DFTI_DESCRIPTOR *handle_slow;
+  DFTI_DESCRIPTOR *handle_plane1;
+  DFTI_DESCRIPTOR *handle_plane2;
 #elif defined(FFT_FFTW2)
   fftw_plan plan_fast_forward;
   fftw_plan plan_fast_backward;
@@ -152,6 +161,10 @@ struct fft_plan_3d {
   FFTW_API(plan) plan_mid_backward;
   FFTW_API(plan) plan_slow_forward;
   FFTW_API(plan) plan_slow_backward;
+  FFTW_API(plan) plan_plane1_forward;
+  FFTW_API(plan) plan_plane1_backward;
+  FFTW_API(plan) plan_plane2_forward;
+  FFTW_API(plan) plan_plane2_backward;
 #elif defined(FFT_KISSFFT)
   kiss_fft_cfg cfg_fast_forward;
   kiss_fft_cfg cfg_fast_backward;
@@ -169,7 +182,7 @@ extern "C" {
   struct fft_plan_3d *fft_3d_create_plan(MPI_Comm, int, int, int,
                                          int, int, int, int, int,
                                          int, int, int, int, int, int, int,
-                                         int, int, int *, int);
+                                         int, int, int *, int, int);
   void fft_3d_destroy_plan(struct fft_plan_3d *);
   void factor(int, int *, int *);
   void bifactor(int, int *, int *);
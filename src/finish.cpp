@@ -33,11 +33,13 @@
 #include "neigh_list.h"
 #include "neigh_request.h"
 #include "output.h"
+#include "modify.h"
+#include "fix.h"
+#include "dump.h"
 #include "memory.h"
 #include "error.h"
 
 #ifdef LMP_USER_OMP
-#include "modify.h"
 #include "fix_omp.h"
 #include "thr_data.h"
 #endif
@@ -462,6 +464,10 @@ void Finish::end(int flag)
     }
   }
 
+  // append events of this run to timer trace file
+
+  if (timer->has_trace()) timer->write_trace();
+
   // further timing breakdowns
 
   if (timeflag && timer->has_normal()) {
@@ -523,6 +529,8 @@ void Finish::end(int flag)
       if (screen) fprintf(screen,fmt,time,time/time_loop*100.0);
       if (logfile) fprintf(logfile,fmt,time,time/time_loop*100.0);
     }
+
+    if (timer->has_full()) detail_timings(time_loop);
   }
 
 #ifdef LMP_USER_OMP
@@ -808,6 +816,8 @@ void Finish::end(int flag)
                   nspec_all/atom->natoms);
         fprintf(screen,"Neighbor list builds = " BIGINT_FORMAT "\n",
                 neighbor->ncalls);
+        if (neighbor->skinauto)
+          fprintf(screen,"Adapted neighbor skin = %g\n",neighbor->skin);
         if (neighbor->dist_check)
           fprintf(screen,"Dangerous builds = " BIGINT_FORMAT "\n",
                   neighbor->ndanger);
@@ -825,6 +835,8 @@ void Finish::end(int flag)
                   nspec_all/atom->natoms);
         fprintf(logfile,"Neighbor list builds = " BIGINT_FORMAT "\n",
                 neighbor->ncalls);
+        if (neighbor->skinauto)
+          fprintf(logfile,"Adapted neighbor skin = %g\n",neighbor->skin);
         if (neighbor->dist_check)
           fprintf(logfile,"Dangerous builds = " BIGINT_FORMAT "\n",
                   neighbor->ndanger);
@@ -884,6 +896,101 @@ void Finish::stats(int n, double *data,
   *pmin = min;
 }
 
+/* ----------------------------------------------------------------------
+   print wall time spent in each fix, dump, and thermo output during run
+   sorted by average time across procs, most expensive first
+   fixes and output that took no time on any proc are skipped
+------------------------------------------------------------------------- */
+
+void Finish::detail_timings(double time_loop)
+{
+  int i,j,k;
+
+  int me,nprocs;
+  MPI_Comm_rank(world,&me);
+  MPI_Comm_size(world,&nprocs);
+
+  int nfix = modify->nfix;
+  int ndump = output->ndump;
+  int n = nfix + ndump + 1;
+
+  double *time,*time_sq,*time_min,*time_max,*time_ave,*time_var;
+  memory->create(time,n,"finish:time");
+  memory->create(time_sq,n,"finish:time_sq");
+  memory->create(time_min,n,"finish:time_min");
+  memory->create(time_max,n,"finish:time_max");
+  memory->create(time_ave,n,"finish:time_ave");
+  memory->create(time_var,n,"finish:time_var");
+
+  for (i = 0; i < nfix; i++) time[i] = modify->time_fix[i];
+  for (i = 0; i < ndump; i++) time[nfix+i] = output->time_dump[i];
+  time[n-1] = output->time_thermo;
+  for (i = 0; i < n; i++) time_sq[i] = time[i]*time[i];
+
+  MPI_Allreduce(time,time_min,n,MPI_DOUBLE,MPI_MIN,world);
+  MPI_Allreduce(time,time_max,n,MPI_DOUBLE,MPI_MAX,world);
+  MPI_Allreduce(time,time_ave,n,MPI_DOUBLE,MPI_SUM,world);
+  MPI_Allreduce(time_sq,time_var,n,MPI_DOUBLE,MPI_SUM,world);
+
+  if (me == 0) {
+    const char hdr[] = "\nFix and output timing breakdown:\n"
+      "Fix/Dump        |  min time  |  avg time  |  max time  "
+      "|%varavg| %total\n"
+      "-----------------------------------------------"
+      "------------------------\n";
+    const char fmt[] = "%-16.16s|%- 12.5g|%- 12.5g|%- 12.5g|%6.1f |%6.2f\n";
+
+    // % variance from the average as measure of load imbalance
+
+    int *order = new int[n];
+    for (i = 0; i < n; i++) {
+      time_ave[i] /= nprocs;
+      time_var[i] /= nprocs;
+      if ((time_ave[i] > 0.001) &&
+          ((time_var[i]/time_ave[i] - time_ave[i]) > 1.0e-10))
+        time_var[i] = sqrt(time_var[i]/time_ave[i] - time_ave[i])*100.0;
+      else time_var[i] = 0.0;
+      order[i] = i;
+    }
+
+    // insertion sort of entries by decreasing average time
+
+    for (i = 1; i < n; i++) {
+      k = order[i];
+      for (j = i; j > 0 && time_ave[order[j-1]] < time_ave[k]; j--)
+        order[j] = order[j-1];
+      order[j] = k;
+    }
+
+    if (screen) fputs(hdr,screen);
+    if (logfile) fputs(hdr,logfile);
+
+    char label[32];
+    for (i = 0; i < n; i++) {
+      k = order[i];
+      if (time_max[k] <= 0.0) continue;
+      if (k < nfix) snprintf(label,32,"fix %s",modify->fix[k]->id);
+      else if (k < n-1) snprintf(label,32,"dump %s",output->dump[k-nfix]->id);
+      else strcpy(label,"Thermo");
+
+      double percent = time_ave[k]/time_loop*100.0;
+      if (screen) fprintf(screen,fmt,label,time_min[k],time_ave[k],
+                          time_max[k],time_var[k],percent);
+      if (logfile) fprintf(logfile,fmt,label,time_min[k],time_ave[k],
+                           time_max[k],time_var[k],percent);
+    }
+
+    delete [] order;
+  }
+
+  memory->destroy(time);
+  memory->destroy(time_sq);
+  memory->destroy(time_min);
+  memory->destroy(time_max);
+  memory->destroy(time_ave);
+  memory->destroy(time_var);
+}
+
 /* ---------------------------------------------------------------------- */
 
 void mpi_timings(const char *label, Timer *t, enum Timer::ttype tt,
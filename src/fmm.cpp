@@ -0,0 +1,1468 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+   fast multipole method for open boundaries
+   Coulombics are split as for MSM, the coul/msm pair styles compute
+     1/r - gamma(r/a)/a inside the cutoff a, this style computes the rest:
+     gamma(r/a)/a by direct sum for pairs in adjacent leaf cells and 1/r
+     by multipole expansions for pairs in well-separated cells
+   expansions and their translations follow Greengard and Rokhlin,
+     Acta Numerica 6 (1997) 229-269
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fmm.h"
+#include "atom.h"
+#include "comm.h"
+#include "gridcomm.h"
+#include "irregular.h"
+#include "neighbor.h"
+#include "force.h"
+#include "pair.h"
+#include "domain.h"
+#include "memory.h"
+#include "error.h"
+
+#include "math_const.h"
+
+using namespace LAMMPS_NS;
+using namespace MathConst;
+
+#define MAXLEVELS 14
+#define MAXMPOLE 20
+#define REPLICATE 8
+#define OFFSET 16384
+#define LEAFCOST 1.2
+#define NQUAD 8
+#define DSCALE 0.75
+#define DELTA 1024
+
+enum{REVERSE_MPOLE};
+enum{FORWARD_MPOLE};
+
+// index of coeff n,m in an expansion with all m, and with m >= 0 only
+
+static inline int nm_index(int n, int m) { return n*n+n+m; }
+static inline int jk_index(int j, int k) { return j*(j+1)/2+k; }
+
+// i^e for even e
+
+static inline double ipow_even(int e) { return ((e/2) & 1) ? -1.0 : 1.0; }
+
+// 1 if a cell holds any charge, all coeffs of an empty cell are 0.0
+
+static inline int occupied(const double *coeff, int n)
+{
+  for (int i = 0; i < n; i++)
+    if (coeff[i] != 0.0) return 1;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FMM::FMM(LAMMPS *lmp, int narg, char **arg) : KSpace(lmp, narg, arg),
+  rcoeff1(NULL), rcoeff2(NULL), m2m_coeff(NULL), m2l_coeff(NULL),
+  l2l_coeff(NULL), m2l_irreg(NULL), m2m_reg(NULL), l2l_reg(NULL),
+  work1(NULL), work2(NULL), needlo(NULL), needhi(NULL), nearhead(NULL),
+  nearghost(NULL), part2cell(NULL), nextown(NULL), nextghost(NULL),
+  phi(NULL), efield(NULL), sendbuf(NULL), recvbuf(NULL), proclist(NULL),
+  irregular(NULL)
+{
+  if (narg < 1) error->all(FLERR,"Illegal kspace_style fmm command");
+
+  msmflag = 1;
+
+  accuracy_relative = fabs(force->numeric(FLERR,arg[0]));
+
+  // order of the splitting function, as for MSM
+
+  order = 10;
+
+  MPI_Comm_rank(world,&me);
+  MPI_Comm_size(world,&nprocs);
+
+  pmax = nterms = nfull = nirreg = 0;
+  nlevels = 0;
+
+  ncell = new int[MAXLEVELS];
+  hcell = new double[MAXLEVELS];
+  replicated = new int[MAXLEVELS];
+  nbrick = new int[MAXLEVELS];
+  memory->create(inlo,MAXLEVELS,3,"fmm:inlo");
+  memory->create(inhi,MAXLEVELS,3,"fmm:inhi");
+  memory->create(tlo,MAXLEVELS,3,"fmm:tlo");
+  memory->create(thi,MAXLEVELS,3,"fmm:thi");
+  memory->create(outlo,MAXLEVELS,3,"fmm:outlo");
+  memory->create(outhi,MAXLEVELS,3,"fmm:outhi");
+
+  mpole = new double*[MAXLEVELS];
+  local = new double*[MAXLEVELS];
+  cg = new GridComm*[MAXLEVELS];
+  for (int n = 0; n < MAXLEVELS; n++) {
+    mpole[n] = local[n] = NULL;
+    cg[n] = NULL;
+    nbrick[n] = 0;
+  }
+
+  nmax = maxrecv = maxsend = maxnear = 0;
+  nrecv = 0;
+  for (int i = 0; i < 3; i++) boxlo_setup[i] = boxhi_setup[i] = 0.0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FMM::~FMM()
+{
+  deallocate();
+  deallocate_tables();
+
+  delete [] ncell;
+  delete [] hcell;
+  delete [] replicated;
+  delete [] nbrick;
+  memory->destroy(inlo);
+  memory->destroy(inhi);
+  memory->destroy(tlo);
+  memory->destroy(thi);
+  memory->destroy(outlo);
+  memory->destroy(outhi);
+  delete [] mpole;
+  delete [] local;
+  delete [] cg;
+
+  memory->destroy(part2cell);
+  memory->destroy(nextown);
+  memory->destroy(phi);
+  memory->destroy(efield);
+  memory->destroy(nextghost);
+  memory->destroy(recvbuf);
+  memory->destroy(sendbuf);
+  memory->destroy(proclist);
+}
+
+/* ----------------------------------------------------------------------
+   called once before run
+------------------------------------------------------------------------- */
+
+void FMM::init()
+{
+  if (me == 0) {
+    if (screen) fprintf(screen,"FMM initialization ...\n");
+    if (logfile) fprintf(logfile,"FMM initialization ...\n");
+  }
+
+  // error check
+
+  triclinic_check();
+  if (domain->dimension == 2)
+    error->all(FLERR,"Cannot (yet) use FMM with 2d simulation");
+  if (comm->style != 0)
+    error->universe_all(FLERR,"FMM can only currently be used with "
+                        "comm_style brick");
+  if (domain->xperiodic || domain->yperiodic || domain->zperiodic)
+    error->all(FLERR,"Cannot (yet) use FMM with periodic boundaries");
+
+  if (!atom->q_flag) error->all(FLERR,"Kspace style requires atom attribute q");
+
+  if (order < 4 || order > 10 || order%2 != 0)
+    error->all(FLERR,"FMM order must be 4, 6, 8, or 10");
+  if (mpole_order < 0 || mpole_order > MAXMPOLE)
+    error->all(FLERR,"FMM multipole order must be between 1 and 20");
+
+  if (sizeof(FFT_SCALAR) != 8)
+    error->all(FLERR,"Cannot (yet) use single precision with FMM "
+               "(remove -DFFT_SINGLE from Makefile and recompile)");
+
+  // extract short-range Coulombic cutoff from pair style
+
+  pair_check();
+
+  int itmp;
+  double *p_cutoff = (double *) force->pair->extract("cut_coul",itmp);
+  if (p_cutoff == NULL)
+    error->all(FLERR,"KSpace style is incompatible with Pair style");
+  cutoff = *p_cutoff;
+
+  // compute qsum & qsqsum and error if not charge-neutral
+
+  scale = 1.0;
+  qqrd2e = force->qqrd2e;
+  qsum_qsq();
+  natoms_original = atom->natoms;
+
+  // set accuracy (force units) from accuracy_relative or accuracy_absolute
+
+  if (accuracy_relative <= 0.0 && accuracy_absolute < 0.0)
+    error->all(FLERR,"KSpace accuracy must be > 0");
+  if (accuracy_absolute >= 0.0) accuracy = accuracy_absolute;
+  else accuracy = accuracy_relative * two_charge_force;
+
+  // lowest multipole order that meets the accuracy, unless set by user
+  // the leaf level depends on the order and the error on the levels,
+  //   raise the order until it meets the accuracy on its own levels,
+  //   a higher order only coarsens the leaf level, so this terminates
+
+  if (mpole_order) {
+    pmax = mpole_order;
+    set_levels();
+  } else {
+    pmax = 1;
+    while (1) {
+      set_levels();
+      int p = pmax;
+      while (p < MAXMPOLE && estimate_far_error(p) > accuracy) p++;
+      if (p == pmax) break;
+      pmax = p;
+    }
+    if (estimate_far_error(pmax) > accuracy && me == 0)
+      error->warning(FLERR,"FMM cannot reach the requested accuracy, "
+                     "multipole order set to 20");
+  }
+
+  allocate_tables();
+  setup();
+
+  double estimated_error = estimate_total_error();
+
+  // output tree stats
+
+  int ncell_max = 0;
+  for (int n = 2; n < nlevels; n++) ncell_max += nbrick[n];
+  int tmp = ncell_max;
+  MPI_Allreduce(&tmp,&ncell_max,1,MPI_INT,MPI_MAX,world);
+
+  if (me == 0) {
+    if (screen) {
+      fprintf(screen,"  levels = %d, leaf cell size = %g\n",
+              nlevels,hcell[nlevels-1]);
+      fprintf(screen,"  multipole order = %d\n",pmax);
+      fprintf(screen,"  octree cells/proc = %d\n",ncell_max);
+      fprintf(screen,"  estimated absolute RMS force accuracy = %g\n",
+              estimated_error);
+      fprintf(screen,"  estimated relative force accuracy = %g\n",
+              estimated_error/two_charge_force);
+    }
+    if (logfile) {
+      fprintf(logfile,"  levels = %d, leaf cell size = %g\n",
+              nlevels,hcell[nlevels-1]);
+      fprintf(logfile,"  multipole order = %d\n",pmax);
+      fprintf(logfile,"  octree cells/proc = %d\n",ncell_max);
+      fprintf(logfile,"  estimated absolute RMS force accuracy = %g\n",
+              estimated_error);
+      fprintf(logfile,"  estimated relative force accuracy = %g\n",
+              estimated_error/two_charge_force);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   set up the octree for the current box and sub-domains
+   called by init() and whenever the box changes
+------------------------------------------------------------------------- */
+
+void FMM::setup()
+{
+  if (pmax == 0) return;
+
+  deallocate();
+  set_levels();
+  set_extents();
+  allocate();
+  level_tables();
+
+  for (int i = 0; i < 3; i++) {
+    boxlo_setup[i] = domain->boxlo[i];
+    boxhi_setup[i] = domain->boxhi[i];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   compute the FMM long-range force, energy, virial
+------------------------------------------------------------------------- */
+
+void FMM::compute(int eflag, int vflag)
+{
+  int i;
+
+  // set energy/virial flags
+
+  if (eflag || vflag) ev_setup(eflag,vflag);
+  else evflag = evflag_atom = eflag_global = vflag_global =
+    eflag_atom = vflag_atom = eflag_either = vflag_either = 0;
+
+  if (vflag_atom)
+    error->all(FLERR,"Cannot (yet) compute per-atom virial "
+               "with kspace_style FMM");
+
+  // must switch on global energy computation for scalar pressure
+
+  if (scalar_pressure_flag && vflag_either) {
+    if (eflag == 0 || eflag == 2) {
+      eflag++;
+      ev_setup(eflag,vflag);
+    }
+  }
+
+  // if atom count has changed, update qsum and qsqsum
+
+  if (atom->natoms != natoms_original) {
+    qsum_qsq();
+    natoms_original = atom->natoms;
+  }
+
+  // return if there are no charges
+
+  if (qsqsum == 0.0) return;
+
+  // rebuild the octree if the box has changed since the last setup()
+  // the box is the same on all procs, so all of them rebuild
+
+  if (domain->box_change) {
+    int change = 0;
+    for (i = 0; i < 3; i++)
+      if (domain->boxlo[i] != boxlo_setup[i] ||
+          domain->boxhi[i] != boxhi_setup[i]) change = 1;
+    if (change) setup();
+  }
+
+  // extend size of per-atom arrays if necessary
+
+  if (atom->nmax > nmax) {
+    memory->destroy(part2cell);
+    memory->destroy(nextown);
+    memory->destroy(phi);
+    memory->destroy(efield);
+    nmax = atom->nmax;
+    memory->create(part2cell,nmax,3,"fmm:part2cell");
+    memory->create(nextown,nmax,"fmm:nextown");
+    memory->create(phi,nmax,"fmm:phi");
+    memory->create(efield,nmax,3,"fmm:efield");
+  }
+
+  // find the leaf cell of each of my particles
+
+  particle_map();
+
+  int nlocal = atom->nlocal;
+  for (i = 0; i < nlocal; i++) {
+    phi[i] = 0.0;
+    efield[i][0] = efield[i][1] = efield[i][2] = 0.0;
+  }
+
+  // far field: upward pass of multipoles, exchange of cells
+  //   of the interaction lists, downward pass of local expansions
+
+  if (nlevels > 2) {
+    upward();
+    downward();
+    evaluate();
+  }
+
+  // near field: direct sum over adjacent leaf cells
+
+  near_exchange();
+  direct();
+
+  // force, energy and virial of my particles
+  // the virial is sum of x f since all interactions are pairwise
+  //   and non-periodic, x is taken from the root cell center
+
+  const double qscale = qqrd2e * scale;
+  double **x = atom->x;
+  double **f = atom->f;
+  double *q = atom->q;
+
+  double xc = rootlo[0] + 0.5*rootside;
+  double yc = rootlo[1] + 0.5*rootside;
+  double zc = rootlo[2] + 0.5*rootside;
+
+  double esum = 0.0;
+  double vsum[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
+
+  for (i = 0; i < nlocal; i++) {
+    const double qfactor = qscale*q[i];
+    const double fx = qfactor*efield[i][0];
+    const double fy = qfactor*efield[i][1];
+    const double fz = qfactor*efield[i][2];
+    f[i][0] += fx;
+    f[i][1] += fy;
+    f[i][2] += fz;
+
+    if (eflag_global) esum += q[i]*phi[i];
+    if (eflag_atom) eatom[i] += 0.5*qfactor*phi[i];
+    if (vflag_global) {
+      const double dx = x[i][0] - xc;
+      const double dy = x[i][1] - yc;
+      const double dz = x[i][2] - zc;
+      vsum[0] += dx*fx;
+      vsum[1] += dy*fy;
+      vsum[2] += dz*fz;
+      vsum[3] += dx*fy;
+      vsum[4] += dx*fz;
+      vsum[5] += dy*fz;
+    }
+  }
+
+  // sum global energy and virial across procs
+
+  if (eflag_global) {
+    double energy_all;
+    MPI_Allreduce(&esum,&energy_all,1,MPI_DOUBLE,MPI_SUM,world);
+    energy = 0.5*qscale*energy_all;
+  }
+
+  if (vflag_global && !scalar_pressure_flag)
+    MPI_Allreduce(vsum,virial,6,MPI_DOUBLE,MPI_SUM,world);
+
+  // fast compute of scalar pressure (if requested)
+
+  if (scalar_pressure_flag && vflag_global)
+    for (i = 0; i < 3; i++) virial[i] = energy/3.0;
+}
+
+/* ----------------------------------------------------------------------
+   root cell and # of levels
+   root cell is a cube around the box, padded by the skin so atoms
+     that have moved out of a shrink-wrapped box stay inside it
+   leaf level is the finest one with cells no smaller than the cutoff
+     that still hold LEAFCOST*(pmax+1)^2 atoms on average,
+     this balances the direct sum over adjacent leaf cells
+     against M2L, whose cost per cell grows as pmax^4
+------------------------------------------------------------------------- */
+
+void FMM::set_levels()
+{
+  double pad = neighbor->skin;
+  double maxprd = MAX(domain->xprd,MAX(domain->yprd,domain->zprd));
+
+  rootside = maxprd + 2.0*pad;
+  for (int i = 0; i < 3; i++) rootlo[i] = domain->boxlo[i] - pad;
+
+  double volume = domain->xprd * domain->yprd * domain->zprd;
+  double density = 0.0;
+  if (volume > 0.0) density = atom->natoms/volume;
+  double nleaf = LEAFCOST*(pmax+1)*(pmax+1);
+
+  int leaf = 0;
+  while (leaf < MAXLEVELS-1) {
+    double h = rootside/(1 << (leaf+1));
+    if (h < cutoff || density*h*h*h < nleaf) break;
+    leaf++;
+  }
+  nlevels = leaf+1;
+
+  for (int n = 0; n < nlevels; n++) {
+    ncell[n] = 1 << n;
+    hcell[n] = rootside/ncell[n];
+    replicated[n] = (ncell[n] <= REPLICATE) ? 1 : 0;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   cell extents of each level on this proc
+   a cell is owned by the proc whose sub-domain contains its center,
+     the lowest and highest procs in a dim also own the cells beyond
+     the box, so that owned cells tile every level
+   target cells cover my sub-domain extended by 1/2 the skin
+------------------------------------------------------------------------- */
+
+void FMM::set_extents()
+{
+  int i,n;
+
+  double *prd = domain->prd;
+  double *boxlo = domain->boxlo;
+  double *split[3] = {comm->xsplit,comm->ysplit,comm->zsplit};
+  double margin = 0.5*neighbor->skin;
+
+  for (n = 0; n < nlevels; n++) {
+    for (i = 0; i < 3; i++) {
+      int loc = comm->myloc[i];
+      double lo = boxlo[i] + prd[i]*split[i][loc];
+      double hi = boxlo[i] + prd[i]*split[i][loc+1];
+
+      tlo[n][i] = MAX(0,cell_index(lo-margin,i,n));
+      thi[n][i] = MIN(ncell[n]-1,cell_index(hi+margin,i,n));
+
+      if (replicated[n]) {
+        inlo[n][i] = outlo[n][i] = 0;
+        inhi[n][i] = outhi[n][i] = ncell[n]-1;
+        continue;
+      }
+
+      if (loc == 0) inlo[n][i] = 0;
+      else inlo[n][i] = static_cast<int> (ceil((lo-rootlo[i])/hcell[n] - 0.5));
+      if (loc == comm->procgrid[i]-1) inhi[n][i] = ncell[n]-1;
+      else inhi[n][i] =
+             static_cast<int> (ceil((hi-rootlo[i])/hcell[n] - 0.5)) - 1;
+
+      // interaction lists reach 3 cells beyond a target cell
+
+      outlo[n][i] = MAX(0,tlo[n][i]-3);
+      outhi[n][i] = MIN(ncell[n]-1,thi[n][i]+3);
+      if (inlo[n][i] <= inhi[n][i]) {
+        outlo[n][i] = MIN(outlo[n][i],inlo[n][i]);
+        outhi[n][i] = MAX(outhi[n][i],inhi[n][i]);
+      }
+    }
+  }
+
+  // leaf cells whose particles each proc grid slab needs for the near field
+  // target cells of the slab plus one cell on either side
+
+  int leaf = nlevels-1;
+
+  memory->destroy(needlo);
+  memory->destroy(needhi);
+  int maxgrid = MAX(comm->procgrid[0],MAX(comm->procgrid[1],comm->procgrid[2]));
+  memory->create(needlo,3,maxgrid,"fmm:needlo");
+  memory->create(needhi,3,maxgrid,"fmm:needhi");
+
+  for (i = 0; i < 3; i++) {
+    for (int loc = 0; loc < comm->procgrid[i]; loc++) {
+      double lo = boxlo[i] + prd[i]*split[i][loc];
+      double hi = boxlo[i] + prd[i]*split[i][loc+1];
+      needlo[i][loc] = MAX(0,cell_index(lo-margin,i,leaf)-1);
+      needhi[i][loc] = MIN(ncell[leaf]-1,cell_index(hi+margin,i,leaf)+1);
+    }
+    nearlo[i] = needlo[i][comm->myloc[i]];
+    nearhi[i] = needhi[i][comm->myloc[i]];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   allocate expansions and ghost cell comm of each level
+------------------------------------------------------------------------- */
+
+void FMM::allocate()
+{
+  for (int n = 2; n < nlevels; n++) {
+    nbrick[n] = (outhi[n][0]-outlo[n][0]+1) * (outhi[n][1]-outlo[n][1]+1) *
+      (outhi[n][2]-outlo[n][2]+1);
+    memory->create(mpole[n],2*nterms*nbrick[n],"fmm:mpole");
+    memory->create(local[n],2*nterms*nbrick[n],"fmm:local");
+
+    if (replicated[n]) continue;
+
+    cg[n] = new GridComm(lmp,world,2*nterms,2*nterms,
+                         inlo[n][0],inhi[n][0],inlo[n][1],inhi[n][1],
+                         inlo[n][2],inhi[n][2],
+                         outlo[n][0],outhi[n][0],outlo[n][1],outhi[n][1],
+                         outlo[n][2],outhi[n][2],
+                         comm->procneigh[0][0],comm->procneigh[0][1],
+                         comm->procneigh[1][0],comm->procneigh[1][1],
+                         comm->procneigh[2][0],comm->procneigh[2][1]);
+    cg[n]->setup();
+  }
+
+  maxnear = (nearhi[0]-nearlo[0]+1) * (nearhi[1]-nearlo[1]+1) *
+    (nearhi[2]-nearlo[2]+1);
+  memory->create(nearhead,maxnear,"fmm:nearhead");
+  memory->create(nearghost,maxnear,"fmm:nearghost");
+
+  irregular = new Irregular(lmp);
+}
+
+/* ----------------------------------------------------------------------
+   deallocate expansions and ghost cell comm of each level
+------------------------------------------------------------------------- */
+
+void FMM::deallocate()
+{
+  for (int n = 0; n < MAXLEVELS; n++) {
+    memory->destroy(mpole[n]);
+    memory->destroy(local[n]);
+    delete cg[n];
+    mpole[n] = local[n] = NULL;
+    cg[n] = NULL;
+    nbrick[n] = 0;
+  }
+
+  memory->destroy(nearhead);
+  memory->destroy(nearghost);
+  nearhead = nearghost = NULL;
+  maxnear = 0;
+
+  memory->destroy(needlo);
+  memory->destroy(needhi);
+  needlo = needhi = NULL;
+
+  delete irregular;
+  irregular = NULL;
+}
+
+/* ----------------------------------------------------------------------
+   translation coefficients that depend only on the multipole order
+   A_n^m = (-1)^n / sqrt((n-m)!(n+m)!), all factors i^e have even e
+------------------------------------------------------------------------- */
+
+void FMM::allocate_tables()
+{
+  int j,k,n,m;
+
+  deallocate_tables();
+
+  nterms = (pmax+1)*(pmax+2)/2;
+  nfull = (pmax+1)*(pmax+1);
+  nirreg = (2*pmax+1)*(2*pmax+1);
+
+  double fact[4*MAXMPOLE+2];
+  fact[0] = 1.0;
+  for (n = 1; n < 4*MAXMPOLE+2; n++) fact[n] = fact[n-1]*n;
+
+  double *anm;
+  memory->create(anm,nirreg,"fmm:anm");
+  for (n = 0; n <= 2*pmax; n++)
+    for (m = -n; m <= n; m++)
+      anm[nm_index(n,m)] = ((n & 1) ? -1.0 : 1.0) / sqrt(fact[n-m]*fact[n+m]);
+
+  // recursion of regular harmonics in n for fixed m >= 0
+
+  memory->create(rcoeff1,nirreg,"fmm:rcoeff1");
+  memory->create(rcoeff2,nirreg,"fmm:rcoeff2");
+  for (n = 0; n <= 2*pmax; n++)
+    for (m = 0; m <= n; m++) {
+      if (n == m) {
+        rcoeff1[nm_index(n,m)] = (m > 0) ? sqrt((2.0*m-1.0)/(2.0*m)) : 1.0;
+        rcoeff2[nm_index(n,m)] = 0.0;
+      } else {
+        double denom = sqrt((double) (n+m)*(n-m));
+        rcoeff1[nm_index(n,m)] = (2*n-1) / denom;
+        rcoeff2[nm_index(n,m)] = sqrt((double) (n+m-1)*(n-m-1)) / denom;
+      }
+    }
+
+  memory->create(m2m_coeff,nterms,nfull,"fmm:m2m_coeff");
+  memory->create(m2l_coeff,nterms,nfull,"fmm:m2l_coeff");
+  memory->create(l2l_coeff,nterms,nfull,"fmm:l2l_coeff");
+
+  for (j = 0; j <= pmax; j++)
+    for (k = 0; k <= j; k++) {
+      int jk = jk_index(j,k);
+      for (n = 0; n <= pmax; n++)
+        for (m = -n; m <= n; m++) {
+          int nm = nm_index(n,m);
+
+          m2m_coeff[jk][nm] = 0.0;
+          if (n <= j && abs(k-m) <= j-n)
+            m2m_coeff[jk][nm] = ipow_even(abs(k)-abs(m)-abs(k-m)) *
+              anm[nm] * anm[nm_index(j-n,k-m)] / anm[nm_index(j,k)];
+
+          m2l_coeff[jk][nm] = ipow_even(abs(k-m)-abs(k)-abs(m)) *
+            anm[nm] * anm[nm_index(j,k)] /
+            (((n & 1) ? -1.0 : 1.0) * anm[nm_index(j+n,m-k)]);
+
+          l2l_coeff[jk][nm] = 0.0;
+          if (n >= j && abs(m-k) <= n-j)
+            l2l_coeff[jk][nm] = ipow_even(abs(m)-abs(m-k)-abs(k)) *
+              anm[nm_index(n-j,m-k)] * anm[nm_index(j,k)] /
+              ((((n+j) & 1) ? -1.0 : 1.0) * anm[nm]);
+        }
+    }
+
+  memory->destroy(anm);
+
+  memory->create(work1,nirreg,"fmm:work1");
+  memory->create(work2,nirreg,"fmm:work2");
+
+  // irregular harmonics S_N^M(d) / |d|^(2N+1) of offsets d between
+  //   the centers of cells with unit edge length,
+  //   M2L at a level scales them by the cell edge length
+
+  memory->create(m2l_irreg,343,nirreg,"fmm:m2l_irreg");
+
+  for (int dz = -3; dz <= 3; dz++)
+    for (int dy = -3; dy <= 3; dy++)
+      for (int dx = -3; dx <= 3; dx++) {
+        if (abs(dx) <= 1 && abs(dy) <= 1 && abs(dz) <= 1) continue;
+        fmm_complex *t = m2l_irreg[(dz+3)*49 + (dy+3)*7 + dx+3];
+        regular(dx,dy,dz,2*pmax,t);
+        double rsq = dx*dx + dy*dy + dz*dz;
+        double rinv = 1.0/sqrt(rsq);
+        double rsqinv = 1.0/rsq;
+        for (n = 0; n <= 2*pmax; n++) {
+          for (m = -n; m <= n; m++) t[nm_index(n,m)] *= rinv;
+          rinv *= rsqinv;
+        }
+      }
+
+  // interaction list of a cell = children of the neighbors of its parent
+  //   that are not its own neighbors
+  // offsets depend on the parity of the cell index in each dim
+
+  for (int parity = 0; parity < 8; parity++) {
+    int bx = parity & 1;
+    int by = (parity >> 1) & 1;
+    int bz = (parity >> 2) & 1;
+    nilist[parity] = 0;
+    for (int dz = -2-bz; dz <= 3-bz; dz++)
+      for (int dy = -2-by; dy <= 3-by; dy++)
+        for (int dx = -2-bx; dx <= 3-bx; dx++) {
+          if (abs(dx) <= 1 && abs(dy) <= 1 && abs(dz) <= 1) continue;
+          ilist[parity][nilist[parity]++] = (dz+3)*49 + (dy+3)*7 + dx+3;
+        }
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FMM::deallocate_tables()
+{
+  memory->destroy(rcoeff1);
+  memory->destroy(rcoeff2);
+  memory->destroy(m2m_coeff);
+  memory->destroy(m2l_coeff);
+  memory->destroy(l2l_coeff);
+  memory->destroy(m2l_irreg);
+  memory->destroy(m2m_reg);
+  memory->destroy(l2l_reg);
+  memory->destroy(work1);
+  memory->destroy(work2);
+  rcoeff1 = rcoeff2 = NULL;
+  m2m_coeff = m2l_coeff = l2l_coeff = NULL;
+  m2l_irreg = NULL;
+  m2m_reg = l2l_reg = NULL;
+  work1 = work2 = NULL;
+}
+
+/* ----------------------------------------------------------------------
+   regular harmonics of the offsets between a child cell center
+     and its parent center on each level
+   M2M uses conj S_n^m(child - parent), L2L uses S_n^m(parent - child)
+------------------------------------------------------------------------- */
+
+void FMM::level_tables()
+{
+  memory->destroy(m2m_reg);
+  memory->destroy(l2l_reg);
+  memory->create(m2m_reg,nlevels,8,nfull,"fmm:m2m_reg");
+  memory->create(l2l_reg,nlevels,8,nfull,"fmm:l2l_reg");
+
+  for (int n = 3; n < nlevels; n++)
+    for (int child = 0; child < 8; child++) {
+      double half = 0.5*hcell[n];
+      double dx = (child & 1) ? half : -half;
+      double dy = ((child >> 1) & 1) ? half : -half;
+      double dz = ((child >> 2) & 1) ? half : -half;
+      regular(dx,dy,dz,pmax,m2m_reg[n][child]);
+      for (int nm = 0; nm < nfull; nm++)
+        m2m_reg[n][child][nm] = conj(m2m_reg[n][child][nm]);
+      regular(-dx,-dy,-dz,pmax,l2l_reg[n][child]);
+    }
+}
+
+/* ----------------------------------------------------------------------
+   index of the cell of a level that coord x in dim falls into
+------------------------------------------------------------------------- */
+
+int FMM::cell_index(double x, int dim, int n)
+{
+  return static_cast<int> ((x-rootlo[dim])/hcell[n] + OFFSET) - OFFSET;
+}
+
+/* ----------------------------------------------------------------------
+   offset of global cell ix,iy,iz in the out brick of level n
+------------------------------------------------------------------------- */
+
+int FMM::cell_offset(int n, int ix, int iy, int iz)
+{
+  int nx = outhi[n][0]-outlo[n][0]+1;
+  int ny = outhi[n][1]-outlo[n][1]+1;
+  return ((iz-outlo[n][2])*ny + iy-outlo[n][1])*nx + ix-outlo[n][0];
+}
+
+/* ----------------------------------------------------------------------
+   find the leaf cell of each of my particles
+   check that it is one of my target cells
+------------------------------------------------------------------------- */
+
+void FMM::particle_map()
+{
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+  int leaf = nlevels-1;
+
+  int flag = 0;
+  for (int i = 0; i < nlocal; i++)
+    for (int d = 0; d < 3; d++) {
+      int c = cell_index(x[i][d],d,leaf);
+      if (c < tlo[leaf][d] || c > thi[leaf][d]) flag = 1;
+      part2cell[i][d] = c;
+    }
+
+  if (flag) error->one(FLERR,"Out of range atoms - cannot compute FMM");
+}
+
+/* ----------------------------------------------------------------------
+   upward pass
+   multipoles of my particles in their leaf cells, shifted to the parent
+     cells up to level 2, then the partial sums of all procs are added
+     in the owned cells and copied to the ghost cells that need them
+------------------------------------------------------------------------- */
+
+void FMM::upward()
+{
+  int i,j,k,n,ix,iy,iz;
+
+  for (n = 2; n < nlevels; n++)
+    memset(mpole[n],0,2*nterms*nbrick[n]*sizeof(double));
+
+  // P2M
+
+  double **x = atom->x;
+  double *q = atom->q;
+  int nlocal = atom->nlocal;
+  int leaf = nlevels-1;
+  double h = hcell[leaf];
+
+  for (i = 0; i < nlocal; i++) {
+    if (q[i] == 0.0) continue;
+    ix = part2cell[i][0];
+    iy = part2cell[i][1];
+    iz = part2cell[i][2];
+    regular(x[i][0] - (rootlo[0] + (ix+0.5)*h),
+            x[i][1] - (rootlo[1] + (iy+0.5)*h),
+            x[i][2] - (rootlo[2] + (iz+0.5)*h),pmax,work1);
+    fmm_complex *mp = reinterpret_cast<fmm_complex *>
+      (&mpole[leaf][2*nterms*cell_offset(leaf,ix,iy,iz)]);
+    for (j = 0; j <= pmax; j++)
+      for (k = 0; k <= j; k++)
+        mp[jk_index(j,k)] += q[i]*conj(work1[nm_index(j,k)]);
+  }
+
+  // M2M from each target cell to its parent
+
+  for (n = leaf; n > 2; n--)
+    for (iz = tlo[n][2]; iz <= thi[n][2]; iz++)
+      for (iy = tlo[n][1]; iy <= thi[n][1]; iy++)
+        for (ix = tlo[n][0]; ix <= thi[n][0]; ix++) {
+          int child = (ix & 1) + 2*(iy & 1) + 4*(iz & 1);
+          m2m(&mpole[n][2*nterms*cell_offset(n,ix,iy,iz)],m2m_reg[n][child],
+              &mpole[n-1][2*nterms*cell_offset(n-1,ix/2,iy/2,iz/2)]);
+        }
+
+  // sum over procs
+
+  for (n = 2; n < nlevels; n++) {
+    if (replicated[n]) {
+      MPI_Allreduce(MPI_IN_PLACE,mpole[n],2*nterms*nbrick[n],MPI_DOUBLE,
+                    MPI_SUM,world);
+    } else {
+      current_level = n;
+      cg[n]->reverse_comm(this,REVERSE_MPOLE);
+      cg[n]->forward_comm(this,FORWARD_MPOLE);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   downward pass
+   local expansion of each target cell from the multipoles of its
+     interaction list plus the local expansion of its parent
+   cells without charge are skipped as sources, and as targets since
+     no particle in them needs a field
+------------------------------------------------------------------------- */
+
+void FMM::downward()
+{
+  int j,k,n,ix,iy,iz;
+  double scalej[MAXMPOLE+1];
+
+  for (n = 2; n < nlevels; n++) {
+    memset(local[n],0,2*nterms*nbrick[n]*sizeof(double));
+
+    double hinv = 1.0/hcell[n];
+    scalej[0] = hinv;
+    for (j = 1; j <= pmax; j++) scalej[j] = scalej[j-1]*hinv;
+
+    for (iz = tlo[n][2]; iz <= thi[n][2]; iz++)
+      for (iy = tlo[n][1]; iy <= thi[n][1]; iy++)
+        for (ix = tlo[n][0]; ix <= thi[n][0]; ix++) {
+          int icell = 2*nterms*cell_offset(n,ix,iy,iz);
+          if (!occupied(&mpole[n][icell],2*nterms)) continue;
+
+          int parity = (ix & 1) + 2*(iy & 1) + 4*(iz & 1);
+          for (k = 0; k < nterms; k++) work2[k] = 0.0;
+
+          // M2L in unit cell lengths
+
+          for (int m = 0; m < nilist[parity]; m++) {
+            int offset = ilist[parity][m];
+            int jx = ix + offset%7 - 3;
+            int jy = iy + (offset/7)%7 - 3;
+            int jz = iz + offset/49 - 3;
+            if (jx < 0 || jx >= ncell[n] || jy < 0 || jy >= ncell[n] ||
+                jz < 0 || jz >= ncell[n]) continue;
+            double *source = &mpole[n][2*nterms*cell_offset(n,jx,jy,jz)];
+            if (!occupied(source,2*nterms)) continue;
+            expand(source,work1,hinv);
+            m2l(work1,m2l_irreg[offset],work2);
+          }
+
+          fmm_complex *lp = reinterpret_cast<fmm_complex *>(&local[n][icell]);
+          for (j = 0; j <= pmax; j++)
+            for (k = 0; k <= j; k++)
+              lp[jk_index(j,k)] += work2[jk_index(j,k)]*scalej[j];
+
+          // L2L from parent
+
+          if (n > 2)
+            l2l(&local[n-1][2*nterms*cell_offset(n-1,ix/2,iy/2,iz/2)],
+                l2l_reg[n][parity],&local[n][icell]);
+        }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   far field potential and field of my particles from the
+     local expansions of their leaf cells
+------------------------------------------------------------------------- */
+
+void FMM::evaluate()
+{
+  int n,m;
+
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+  int leaf = nlevels-1;
+  double h = hcell[leaf];
+
+  // shift the local expansion to the particle and keep the
+  //   j = 0 term (potential) and the j = 1 terms (gradient)
+  // S_1^0 = z and S_1^1 = (x + i y)/sqrt(2)
+
+  double *c00 = l2l_coeff[jk_index(0,0)];
+  double *c10 = l2l_coeff[jk_index(1,0)];
+  double *c11 = l2l_coeff[jk_index(1,1)];
+
+  for (int i = 0; i < nlocal; i++) {
+    int ix = part2cell[i][0];
+    int iy = part2cell[i][1];
+    int iz = part2cell[i][2];
+    regular(rootlo[0] + (ix+0.5)*h - x[i][0],
+            rootlo[1] + (iy+0.5)*h - x[i][1],
+            rootlo[2] + (iz+0.5)*h - x[i][2],pmax,work1);
+    expand(&local[leaf][2*nterms*cell_offset(leaf,ix,iy,iz)],work2,1.0);
+
+    fmm_complex l00 = 0.0, l10 = 0.0, l11 = 0.0;
+    for (n = 0; n <= pmax; n++)
+      for (m = -n; m <= n; m++) {
+        int nm = nm_index(n,m);
+        l00 += work2[nm]*c00[nm]*work1[nm];
+        if (n == 0) continue;
+        if (abs(m) <= n-1)
+          l10 += work2[nm]*c10[nm]*work1[nm_index(n-1,m)];
+        if (abs(m-1) <= n-1)
+          l11 += work2[nm]*c11[nm]*work1[nm_index(n-1,m-1)];
+      }
+
+    phi[i] += real(l00);
+    efield[i][0] -= MY_SQRT2*real(l11);
+    efield[i][1] += MY_SQRT2*imag(l11);
+    efield[i][2] -= real(l10);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   send x,y,z,q of my particles to all other procs that need them
+     for the direct sum of their near field
+------------------------------------------------------------------------- */
+
+void FMM::near_exchange()
+{
+  int i,d,ix,iy,iz;
+  int lo[3],hi[3];
+
+  double **x = atom->x;
+  double *q = atom->q;
+  int nlocal = atom->nlocal;
+  int *procgrid = comm->procgrid;
+  int *myloc = comm->myloc;
+
+  int nsend = 0;
+  for (i = 0; i < nlocal; i++) {
+    if (q[i] == 0.0) continue;
+
+    // the slabs that need a cell are contiguous and include mine
+
+    for (d = 0; d < 3; d++) {
+      int c = part2cell[i][d];
+      lo[d] = hi[d] = myloc[d];
+      while (lo[d] > 0 && needhi[d][lo[d]-1] >= c) lo[d]--;
+      while (hi[d] < procgrid[d]-1 && needlo[d][hi[d]+1] <= c) hi[d]++;
+    }
+
+    for (iz = lo[2]; iz <= hi[2]; iz++)
+      for (iy = lo[1]; iy <= hi[1]; iy++)
+        for (ix = lo[0]; ix <= hi[0]; ix++) {
+          int proc = comm->grid2proc[ix][iy][iz];
+          if (proc == me) continue;
+          if (nsend == maxsend) {
+            maxsend += DELTA;
+            memory->grow(sendbuf,4*maxsend,"fmm:sendbuf");
+            memory->grow(proclist,maxsend,"fmm:proclist");
+          }
+          sendbuf[4*nsend] = x[i][0];
+          sendbuf[4*nsend+1] = x[i][1];
+          sendbuf[4*nsend+2] = x[i][2];
+          sendbuf[4*nsend+3] = q[i];
+          proclist[nsend++] = proc;
+        }
+  }
+
+  nrecv = irregular->create_data(nsend,proclist);
+  if (nrecv > maxrecv) {
+    maxrecv = nrecv;
+    memory->destroy(recvbuf);
+    memory->destroy(nextghost);
+    memory->create(recvbuf,4*maxrecv,"fmm:recvbuf");
+    memory->create(nextghost,maxrecv,"fmm:nextghost");
+  }
+  irregular->exchange_data((char *) sendbuf,4*sizeof(double),
+                           (char *) recvbuf);
+  irregular->destroy_data();
+}
+
+/* ----------------------------------------------------------------------
+   near field by direct sum over my particles and those of other procs
+     in the same or an adjacent leaf cell
+   the kernel is gamma(r/a)/a inside the cutoff a and 1/r outside,
+     pairs of two of my particles are done once
+------------------------------------------------------------------------- */
+
+void FMM::direct()
+{
+  int i,j,k,ix,iy,iz,jx,jy,jz;
+
+  double **x = atom->x;
+  double *q = atom->q;
+  int nlocal = atom->nlocal;
+  int leaf = nlevels-1;
+
+  int nx = nearhi[0]-nearlo[0]+1;
+  int ny = nearhi[1]-nearlo[1]+1;
+
+  // bin my particles and the received ones into near cells
+
+  for (i = 0; i < maxnear; i++) nearhead[i] = nearghost[i] = -1;
+
+  for (i = 0; i < nlocal; i++) {
+    if (q[i] == 0.0) continue;
+    int m = ((part2cell[i][2]-nearlo[2])*ny + part2cell[i][1]-nearlo[1])*nx +
+      part2cell[i][0]-nearlo[0];
+    nextown[i] = nearhead[m];
+    nearhead[m] = i;
+  }
+
+  for (k = 0; k < nrecv; k++) {
+    const double *xk = &recvbuf[4*k];
+    ix = cell_index(xk[0],0,leaf);
+    iy = cell_index(xk[1],1,leaf);
+    iz = cell_index(xk[2],2,leaf);
+    if (ix < nearlo[0] || ix > nearhi[0] || iy < nearlo[1] ||
+        iy > nearhi[1] || iz < nearlo[2] || iz > nearhi[2]) continue;
+    int m = ((iz-nearlo[2])*ny + iy-nearlo[1])*nx + ix-nearlo[0];
+    nextghost[k] = nearghost[m];
+    nearghost[m] = k;
+  }
+
+  const double cutinv = 1.0/cutoff;
+  const double cutsq = cutoff*cutoff;
+
+  for (i = 0; i < nlocal; i++) {
+    if (q[i] == 0.0) continue;
+    const double xtmp = x[i][0];
+    const double ytmp = x[i][1];
+    const double ztmp = x[i][2];
+    const double qtmp = q[i];
+    double phitmp = 0.0;
+    double ex = 0.0, ey = 0.0, ez = 0.0;
+
+    int xlo = MAX(part2cell[i][0]-1,0);
+    int xhi = MIN(part2cell[i][0]+1,ncell[leaf]-1);
+    int ylo = MAX(part2cell[i][1]-1,0);
+    int yhi = MIN(part2cell[i][1]+1,ncell[leaf]-1);
+    int zlo = MAX(part2cell[i][2]-1,0);
+    int zhi = MIN(part2cell[i][2]+1,ncell[leaf]-1);
+
+    for (jz = zlo; jz <= zhi; jz++)
+      for (jy = ylo; jy <= yhi; jy++)
+        for (jx = xlo; jx <= xhi; jx++) {
+          int m = ((jz-nearlo[2])*ny + jy-nearlo[1])*nx + jx-nearlo[0];
+
+          for (j = nearhead[m]; j >= 0; j = nextown[j]) {
+            if (j <= i) continue;
+            const double delx = xtmp - x[j][0];
+            const double dely = ytmp - x[j][1];
+            const double delz = ztmp - x[j][2];
+            const double rsq = delx*delx + dely*dely + delz*delz;
+            double g,fpair;
+            if (rsq < cutsq) {
+              const double rho = sqrt(rsq)*cutinv;
+              g = gamma(rho)*cutinv;
+              fpair = -dgamma(rho)/rho*cutinv*cutinv*cutinv;
+            } else {
+              const double rinv = 1.0/sqrt(rsq);
+              g = rinv;
+              fpair = rinv*rinv*rinv;
+            }
+            phitmp += q[j]*g;
+            ex += q[j]*fpair*delx;
+            ey += q[j]*fpair*dely;
+            ez += q[j]*fpair*delz;
+            phi[j] += qtmp*g;
+            efield[j][0] -= qtmp*fpair*delx;
+            efield[j][1] -= qtmp*fpair*dely;
+            efield[j][2] -= qtmp*fpair*delz;
+          }
+
+          for (k = nearghost[m]; k >= 0; k = nextghost[k]) {
+            const double *xk = &recvbuf[4*k];
+            const double delx = xtmp - xk[0];
+            const double dely = ytmp - xk[1];
+            const double delz = ztmp - xk[2];
+            const double rsq = delx*delx + dely*dely + delz*delz;
+            double g,fpair;
+            if (rsq < cutsq) {
+              const double rho = sqrt(rsq)*cutinv;
+              g = gamma(rho)*cutinv;
+              fpair = -dgamma(rho)/rho*cutinv*cutinv*cutinv;
+            } else {
+              const double rinv = 1.0/sqrt(rsq);
+              g = rinv;
+              fpair = rinv*rinv*rinv;
+            }
+            phitmp += xk[3]*g;
+            ex += xk[3]*fpair*delx;
+            ey += xk[3]*fpair*dely;
+            ez += xk[3]*fpair*delz;
+          }
+        }
+
+    phi[i] += phitmp;
+    efield[i][0] += ex;
+    efield[i][1] += ey;
+    efield[i][2] += ez;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   regular harmonics S_n^m = r^n Y_n^m(theta,phi) for n <= nmax, all m
+   Y_n^m = sqrt((n-|m|)!/(n+|m|)!) P_n^|m|(cos theta) exp(i m phi)
+   recursion in Cartesian coords, no singularity on the z axis
+------------------------------------------------------------------------- */
+
+void FMM::regular(double x, double y, double z, int nmax, fmm_complex *s)
+{
+  const fmm_complex xy(x,y);
+  const double rsq = x*x + y*y + z*z;
+  fmm_complex smm(1.0,0.0);
+
+  for (int m = 0; m <= nmax; m++) {
+    if (m > 0) smm *= rcoeff1[nm_index(m,m)]*xy;
+    s[nm_index(m,m)] = smm;
+    fmm_complex s1 = smm, s2 = 0.0;
+    for (int n = m+1; n <= nmax; n++) {
+      const int nm = nm_index(n,m);
+      fmm_complex sn = rcoeff1[nm]*z*s1 - rcoeff2[nm]*rsq*s2;
+      s[nm] = sn;
+      s2 = s1;
+      s1 = sn;
+    }
+  }
+
+  for (int n = 1; n <= nmax; n++)
+    for (int m = 1; m <= n; m++)
+      s[nm_index(n,-m)] = conj(s[nm_index(n,m)]);
+}
+
+/* ----------------------------------------------------------------------
+   all coeffs of an expansion stored with m >= 0
+   coeffs of order n are multiplied by scale^n
+------------------------------------------------------------------------- */
+
+void FMM::expand(const double *coeff, fmm_complex *full, double scale)
+{
+  const fmm_complex *c = reinterpret_cast<const fmm_complex *>(coeff);
+  double sn = 1.0;
+  for (int n = 0; n <= pmax; n++) {
+    for (int m = 0; m <= n; m++) {
+      const fmm_complex value = sn*c[jk_index(n,m)];
+      full[nm_index(n,m)] = value;
+      full[nm_index(n,-m)] = conj(value);
+    }
+    sn *= scale;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   M2M: add multipole of a child cell to that of its parent
+   sreg = conj S_n^m of child center - parent center
+------------------------------------------------------------------------- */
+
+void FMM::m2m(const double *child, const fmm_complex *sreg, double *parent)
+{
+  fmm_complex *full = work2;
+  expand(child,full,1.0);
+  fmm_complex *mp = reinterpret_cast<fmm_complex *>(parent);
+
+  for (int j = 0; j <= pmax; j++)
+    for (int k = 0; k <= j; k++) {
+      const double *coeff = m2m_coeff[jk_index(j,k)];
+      fmm_complex sum = 0.0;
+      for (int n = 0; n <= j; n++) {
+        const int mlo = MAX(-n,k-j+n);
+        const int mhi = MIN(n,k+j-n);
+        for (int m = mlo; m <= mhi; m++)
+          sum += full[nm_index(j-n,k-m)]*coeff[nm_index(n,m)]*
+            sreg[nm_index(n,m)];
+      }
+      mp[jk_index(j,k)] += sum;
+    }
+}
+
+/* ----------------------------------------------------------------------
+   M2L: add a multipole with all coeffs to local coeffs with m >= 0
+   irreg = irregular harmonics of source center - target center
+------------------------------------------------------------------------- */
+
+void FMM::m2l(const fmm_complex *source, const fmm_complex *irreg,
+              fmm_complex *target)
+{
+  for (int j = 0; j <= pmax; j++)
+    for (int k = 0; k <= j; k++) {
+      const double *coeff = m2l_coeff[jk_index(j,k)];
+      fmm_complex sum = 0.0;
+      for (int n = 0; n <= pmax; n++) {
+        const fmm_complex *t = &irreg[nm_index(j+n,-k)];
+        for (int m = -n; m <= n; m++) {
+          const int nm = nm_index(n,m);
+          sum += source[nm]*coeff[nm]*t[m];
+        }
+      }
+      target[jk_index(j,k)] += sum;
+    }
+}
+
+/* ----------------------------------------------------------------------
+   L2L: add local expansion of a parent cell to that of its child
+   sreg = S_n^m of parent center - child center
+------------------------------------------------------------------------- */
+
+void FMM::l2l(const double *parent, const fmm_complex *sreg, double *child)
+{
+  fmm_complex *full = work1;
+  expand(parent,full,1.0);
+  fmm_complex *lp = reinterpret_cast<fmm_complex *>(child);
+
+  for (int j = 0; j <= pmax; j++)
+    for (int k = 0; k <= j; k++) {
+      const double *coeff = l2l_coeff[jk_index(j,k)];
+      fmm_complex sum = 0.0;
+      for (int n = j; n <= pmax; n++) {
+        const int mlo = MAX(-n,k-n+j);
+        const int mhi = MIN(n,k+n-j);
+        for (int m = mlo; m <= mhi; m++)
+          sum += full[nm_index(n,m)]*coeff[nm_index(n,m)]*
+            sreg[nm_index(n-j,m-k)];
+      }
+      lp[jk_index(j,k)] += sum;
+    }
+}
+
+/* ----------------------------------------------------------------------
+   pack own values to buf to send to another proc
+------------------------------------------------------------------------- */
+
+void FMM::pack_forward(int /*flag*/, FFT_SCALAR *buf, int nlist, int *list)
+{
+  const int nper = 2*nterms;
+  double *src = mpole[current_level];
+
+  int n = 0;
+  for (int i = 0; i < nlist; i++) {
+    const double *c = &src[nper*list[i]];
+    for (int k = 0; k < nper; k++) buf[n++] = c[k];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   unpack another proc's own values from buf and set own ghost values
+------------------------------------------------------------------------- */
+
+void FMM::unpack_forward(int /*flag*/, FFT_SCALAR *buf, int nlist, int *list)
+{
+  const int nper = 2*nterms;
+  double *dest = mpole[current_level];
+
+  int n = 0;
+  for (int i = 0; i < nlist; i++) {
+    double *c = &dest[nper*list[i]];
+    for (int k = 0; k < nper; k++) c[k] = buf[n++];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   pack ghost values into buf to send to another proc
+------------------------------------------------------------------------- */
+
+void FMM::pack_reverse(int /*flag*/, FFT_SCALAR *buf, int nlist, int *list)
+{
+  const int nper = 2*nterms;
+  double *src = mpole[current_level];
+
+  int n = 0;
+  for (int i = 0; i < nlist; i++) {
+    const double *c = &src[nper*list[i]];
+    for (int k = 0; k < nper; k++) buf[n++] = c[k];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   unpack another proc's ghost values from buf and add to own values
+------------------------------------------------------------------------- */
+
+void FMM::unpack_reverse(int /*flag*/, FFT_SCALAR *buf, int nlist, int *list)
+{
+  const int nper = 2*nterms;
+  double *dest = mpole[current_level];
+
+  int n = 0;
+  for (int i = 0; i < nlist; i++) {
+    double *c = &dest[nper*list[i]];
+    for (int k = 0; k < nper; k++) c[k] += buf[n++];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   estimate RMS force error of the far field for multipole order p
+   errors of the pairs done by M2L are summed incoherently, a pair of
+     charges at center separation R and relative position d within
+     their cells has a truncation error of the force of about
+     (p+2) |d|^(p+1) / R^(p+3) / sqrt(2p+3)
+   |d| is averaged over uniform positions in 2 cells,
+     R over the interaction list
+------------------------------------------------------------------------- */
+
+double FMM::estimate_far_error(int p)
+{
+  if (nlevels <= 2) return 0.0;
+
+  bigint natoms = atom->natoms;
+  if (natoms == 0) return 0.0;
+  double volume = domain->xprd * domain->yprd * domain->zprd;
+  double density = natoms/volume;
+
+  // mean of |d|^(2p+2) for d in unit cells, each component of d
+  //   has a triangular distribution on (-1,1)
+  // d is scaled by DSCALE, an empirical factor fit to the measured
+  //   force errors of random charge systems, the leading term alone
+  //   overestimates the error more the higher the order
+
+  double u[NQUAD],w[NQUAD];
+  double wsum = 0.0;
+  for (int k = 0; k < NQUAD; k++) {
+    u[k] = -1.0 + (k+0.5)*2.0/NQUAD;
+    w[k] = 1.0 - fabs(u[k]);
+    u[k] *= DSCALE;
+    wsum += w[k];
+  }
+  for (int k = 0; k < NQUAD; k++) w[k] /= wsum;
+
+  double dmean = 0.0;
+  for (int a = 0; a < NQUAD; a++)
+    for (int b = 0; b < NQUAD; b++)
+      for (int c = 0; c < NQUAD; c++)
+        dmean += w[a]*w[b]*w[c] *
+          pow(u[a]*u[a] + u[b]*u[b] + u[c]*u[c],p+1);
+
+  // interaction list averaged over cell parity,
+  //   offsets of 3 in a dim belong to 1/2 the cells
+
+  double rsum = 0.0;
+  for (int dz = -3; dz <= 3; dz++)
+    for (int dy = -3; dy <= 3; dy++)
+      for (int dx = -3; dx <= 3; dx++) {
+        if (abs(dx) <= 1 && abs(dy) <= 1 && abs(dz) <= 1) continue;
+        double weight = 1.0;
+        if (abs(dx) == 3) weight *= 0.5;
+        if (abs(dy) == 3) weight *= 0.5;
+        if (abs(dz) == 3) weight *= 0.5;
+        double rsq = dx*dx + dy*dy + dz*dz;
+        rsum += weight / pow(rsq,p+3);
+      }
+
+  // a level with cell length h contributes density h^3 sources per cell,
+  //   each with a squared error that scales as 1/h^4
+
+  double eps2 = (p+2.0)*(p+2.0)/(2.0*p+3.0) * dmean * rsum;
+  double hsum = 0.0;
+  for (int n = 2; n < nlevels; n++) hsum += 1.0/hcell[n];
+
+  return q2 * sqrt(density*eps2*hsum) / natoms;
+}
+
+/* ----------------------------------------------------------------------
+   estimate total RMS force error
+------------------------------------------------------------------------- */
+
+double FMM::estimate_total_error()
+{
+  double xprd = domain->xprd;
+  double yprd = domain->yprd;
+  double zprd = domain->zprd;
+  bigint natoms = atom->natoms;
+
+  double far_error = estimate_far_error(pmax);
+  double q2_over_sqrt = q2 / sqrt(natoms*cutoff*xprd*yprd*zprd);
+  double short_range_error = 0.0;
+  double table_error =
+    estimate_table_accuracy(q2_over_sqrt,short_range_error);
+  double estimated_total_error = sqrt(far_error*far_error +
+    table_error*table_error);
+
+  return estimated_total_error;
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of local arrays
+------------------------------------------------------------------------- */
+
+double FMM::memory_usage()
+{
+  double bytes = 0.0;
+
+  for (int n = 2; n < nlevels; n++) {
+    bytes += 2.0 * 2*nterms*nbrick[n] * sizeof(double);
+    if (cg[n]) bytes += cg[n]->memory_usage();
+  }
+
+  bytes += 3.0 * nterms*nfull * sizeof(double);
+  bytes += 2.0 * nirreg * sizeof(double);
+  bytes += 343.0 * nirreg * sizeof(fmm_complex);
+  bytes += 2.0 * nlevels*8*nfull * sizeof(fmm_complex);
+  bytes += 2.0 * nirreg * sizeof(fmm_complex);
+
+  bytes += 2.0 * maxnear * sizeof(int);
+  bytes += (double) nmax * (4*sizeof(int) + 4*sizeof(double));
+  bytes += (double) maxrecv * (sizeof(int) + 4*sizeof(double));
+  bytes += (double) maxsend * (sizeof(int) + 4*sizeof(double));
+  if (irregular) bytes += irregular->memory_usage();
+
+  return bytes;
+}
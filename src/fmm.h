@@ -0,0 +1,223 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef KSPACE_CLASS
+
+KSpaceStyle(fmm,FMM)
+
+#else
+
+#ifndef LMP_FMM_H
+#define LMP_FMM_H
+
+#include "lmptype.h"
+#include <mpi.h>
+#include <complex>
+
+#include "kspace.h"
+
+namespace LAMMPS_NS {
+
+class FMM : public KSpace {
+ public:
+  FMM(class LAMMPS *, int, char **);
+  virtual ~FMM();
+  void init();
+  void setup();
+  virtual void compute(int, int);
+  double memory_usage();
+
+  void pack_forward(int, FFT_SCALAR *, int, int *);
+  void unpack_forward(int, FFT_SCALAR *, int, int *);
+  void pack_reverse(int, FFT_SCALAR *, int, int *);
+  void unpack_reverse(int, FFT_SCALAR *, int, int *);
+
+ protected:
+  typedef std::complex<double> fmm_complex;
+
+  int me,nprocs;
+  double cutoff;
+
+  // multipole and local expansions of order pmax
+  // a cell stores the nterms coeffs with m >= 0 of each,
+  //   the m < 0 coeffs are their complex conjugates
+
+  int pmax;                   // order of the expansions
+  int nterms;                 // (pmax+1)*(pmax+2)/2
+  int nfull;                  // (pmax+1)^2 coeffs incl m < 0
+  int nirreg;                 // (2*pmax+1)^2 irregular harmonics for M2L
+
+  // octree over a cube that encloses the box
+  // level 0 = root cell, level nlevels-1 = leaf cells
+  // leaf cells are no smaller than the Coulombic cutoff,
+  //   so all pairs in non-adjacent cells are beyond the cutoff
+
+  int nlevels;
+  double rootlo[3];           // lower corner of root cell
+  double rootside;            // edge length of root cell
+  double boxlo_setup[3];      // box that setup() was called for
+  double boxhi_setup[3];
+
+  int *ncell;                 // # of cells per dim at each level
+  double *hcell;              // cell edge length at each level
+  int *replicated;            // 1 if level is held whole by every proc
+
+  // per level extents of cells, inclusive global indices
+  // in = cells I own, centers inside my sub-domain
+  // target = cells my atoms can be in
+  // out = in + target + cells in the interaction list of a target cell
+
+  int **inlo,**inhi;
+  int **tlo,**thi;
+  int **outlo,**outhi;
+  int *nbrick;                // # of cells in out brick of each level
+
+  double **mpole;             // multipole coeffs of each out cell
+  double **local;             // local coeffs of each out cell
+  class GridComm **cg;        // ghost cell comm for distributed levels
+  int current_level;
+
+  // translation coefficients
+
+  double *rcoeff1,*rcoeff2;   // recursion coeffs of regular harmonics
+  double **m2m_coeff;         // [jk][nm] real factors of each translation
+  double **m2l_coeff;
+  double **l2l_coeff;
+  fmm_complex **m2l_irreg;    // irregular harmonics of the 7x7x7 offsets
+                              //   of a unit cell, unused if adjacent
+  fmm_complex ***m2m_reg;     // per level regular harmonics of the
+  fmm_complex ***l2l_reg;     //   8 child to parent center offsets
+  int nilist[8];              // # of interaction list offsets per parity
+  int ilist[8][216];          // index of each offset in m2l_irreg
+  fmm_complex *work1,*work2;  // scratch expansions
+
+  // near field, pairs in adjacent leaf cells incl those from other procs
+
+  int nearlo[3],nearhi[3];    // leaf cells my atoms need particles of
+  int **needlo,**needhi;      // leaf cells needed by each proc grid slab
+  int *nearhead,*nearghost;   // 1st own/other atom in each near cell
+  int nmax,maxrecv,maxsend,maxnear;
+  int **part2cell;            // leaf cell of each owned atom
+  int *nextown;               // next own atom in same leaf cell
+  int *nextghost;             // next other atom in same leaf cell
+  double *phi;                // potential at each owned atom
+  double **efield;            // field at each owned atom
+  double *sendbuf,*recvbuf;   // x,y,z,q of atoms exchanged for near field
+  int *proclist;
+  int nrecv;
+  class Irregular *irregular;
+
+  void set_levels();
+  void set_extents();
+  void allocate();
+  void deallocate();
+  void allocate_tables();
+  void deallocate_tables();
+  void level_tables();
+
+  int cell_index(double, int, int);
+  int cell_offset(int, int, int, int);
+  void particle_map();
+  void upward();
+  void downward();
+  void near_exchange();
+  void direct();
+  void evaluate();
+
+  void regular(double, double, double, int, fmm_complex *);
+  void expand(const double *, fmm_complex *, double);
+  void m2m(const double *, const fmm_complex *, double *);
+  void m2l(const fmm_complex *, const fmm_complex *, fmm_complex *);
+  void l2l(const double *, const fmm_complex *, double *);
+
+  double estimate_far_error(int);
+  double estimate_total_error();
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+E: Cannot (yet) use FMM with 2d simulation
+
+This feature is not yet supported.
+
+E: FMM can only currently be used with comm_style brick
+
+This is a current restriction in LAMMPS.
+
+E: Cannot (yet) use FMM with periodic boundaries
+
+The fast multipole method in LAMMPS only treats open boundaries, all
+three dimensions must be non-periodic.  Use kspace_style msm or pppm
+for periodic systems.
+
+E: Kspace style requires atom attribute q
+
+The atom style defined does not have these attributes.
+
+E: FMM order must be 4, 6, 8, or 10
+
+The order sets the splitting function shared with the coul/msm pair
+styles, it is the same as for kspace_style msm.
+
+E: FMM multipole order must be between 1 and 20
+
+Self-explanatory.  See the kspace_modify mpole keyword.
+
+E: Cannot (yet) use single precision with FMM (remove -DFFT_SINGLE from Makefile and recompile)
+
+Single precision cannot be used with FMM.
+
+E: KSpace style is incompatible with Pair style
+
+Setting a kspace style requires that a pair style with matching
+long-range Coulombic or dispersion components be used.
+
+E: KSpace accuracy must be > 0
+
+The kspace accuracy designated in the input must be greater than zero.
+
+W: FMM cannot reach the requested accuracy, multipole order set to 20
+
+The estimated error of the highest supported multipole order is still
+larger than the requested accuracy.
+
+E: Cannot (yet) compute per-atom virial with kspace_style FMM
+
+The far field of the fast multipole method has no per-atom virial.
+
+E: Out of range atoms - cannot compute FMM
+
+One or more atoms are in an octree cell outside the cells their
+processor has set up.  This is likely for one of two reasons, both of
+them bad.  First, it may mean that an atom near the boundary of a
+processor's sub-domain has moved more than 1/2 the "neighbor skin
+distance"_neighbor.html without neighbor lists being rebuilt and atoms
+being migrated to new processors.  The solution is to change the
+re-neighboring criteria via the "neigh_modify"_neigh_modify command.
+The safest settings are "delay 0 every 1 check yes".  Second, it may
+mean that an atom has moved far outside a processor's sub-domain or
+even the entire simulation box.  This indicates bad physics, e.g. due
+to highly overlapping atoms, too large a timestep, etc.
+
+*/
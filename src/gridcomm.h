@@ -46,10 +46,9 @@ class GridComm : protected Pointers {
   double memory_usage();
 
  private:
-  int me;
+  int me,nprocs;
   int nforward,nreverse;
   MPI_Comm gridcomm;
-  MPI_Request request;
 
   // in = inclusive indices of 3d grid chunk that I own
   // out = inclusive indices of 3d grid chunk I own plus ghosts I use
@@ -66,19 +65,29 @@ class GridComm : protected Pointers {
   int nbuf;
   FFT_SCALAR *buf1,*buf2;
 
-  struct Swap {
-    int sendproc;       // proc to send to for forward comm
-    int recvproc;       // proc to recv from for forward comm
-    int npack;          // # of datums to pack
-    int nunpack;        // # of datums to unpack
-    int *packlist;      // 3d array offsets to pack
-    int *unpacklist;    // 3d array offsets to unpack
+  // every proc that owns some of my ghost grid pts or has some of
+  //   my owned grid pts as its ghosts, including myself for periodic images
+  // all grid pts exchanged with one proc go in one message
+
+  struct Neighbor {
+    int proc;           // neighbor proc
+    int nown;           // # of my owned grid pts it has as ghosts
+    int nghost;         // # of my ghost grid pts it owns
+    int *ownlist;       // 3d array offsets of those owned pts
+    int *ghostlist;     // 3d array offsets of those ghost pts
+    int ownoffset;      // 1st grid pt of owned pts in buf1
+    int ghostoffset;    // 1st grid pt of ghost pts in buf2
   };
 
-  int nswap;
-  Swap *swap;
+  int nneigh;
+  Neighbor *neigh;
+  int self;                       // index of myself in neigh, -1 if none
+  MPI_Request *recvrequest;       // one per neighbor proc
+  MPI_Request *sendrequest;
 
-  int indices(int *&, int, int, int, int, int, int);
+  int period[3];                  // # of grid pts in each dim of global grid
+
+  int overlap(int *&, int *, int *, int, int);
 };
 
 }
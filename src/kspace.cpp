@@ -56,6 +56,8 @@ KSpace::KSpace(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
 #else
   collective_flag = 0;
 #endif
+  fft_nbatch = 0;
+  mpole_order = 0;
 
   kewaldflag = 0;
 
@@ -464,6 +466,11 @@ void KSpace::modify_params(int narg, char **arg)
       if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
       order_6 = force->inumeric(FLERR,arg[iarg+1]);
       iarg += 2;
+    } else if (strcmp(arg[iarg],"mpole") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
+      mpole_order = force->inumeric(FLERR,arg[iarg+1]);
+      if (mpole_order < 0) error->all(FLERR,"Illegal kspace_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"minorder") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
       minorder = force->inumeric(FLERR,arg[iarg+1]);
@@ -523,6 +530,11 @@ void KSpace::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) collective_flag = 0;
       else error->all(FLERR,"Illegal kspace_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"pipeline") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
+      fft_nbatch = force->inumeric(FLERR,arg[iarg+1]);
+      if (fft_nbatch < 0) error->all(FLERR,"Illegal kspace_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"diff") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
       if (strcmp(arg[iarg+1],"ad") == 0) differentiation_flag = 1;
@@ -60,6 +60,7 @@ class KSpace : protected Pointers {
                                  // 1 = warn if zero charge
 
   int order,order_6,order_allocated;
+  int mpole_order;                  // multipole order of FMM, 0 = from accuracy
   double accuracy;                  // accuracy of KSpace solver (force units)
   double accuracy_absolute;         // user-specified accuracy in force units
   double accuracy_relative;         // user-specified dimensionless accuracy
@@ -88,6 +89,7 @@ class KSpace : protected Pointers {
   int compute_flag;               // 0 if skip compute()
   int fftbench;                   // 0 if skip FFT timing
   int collective_flag;            // 1 if use MPI collectives for FFT/remap
+  int fft_nbatch;                 // # of batches of pipelined FFT transposes
   int stagger_flag;               // 1 if using staggered PPPM grids
 
   double splittol;                // tolerance for when to truncate splitting
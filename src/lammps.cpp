@@ -242,6 +242,13 @@ LAMMPS::LAMMPS(int narg, char **arg, MPI_Comm communicator)
                strcmp(arg[iarg],"-nc") == 0) {
       citeflag = 0;
       iarg++;
+    } else if (strcmp(arg[iarg],"-memory") == 0 ||
+               strcmp(arg[iarg],"-m") == 0) {
+      iarg++;
+      int n = 0;
+      while (iarg+n < narg && arg[iarg+n][0] != '-') n++;
+      memory->large_modify(n,&arg[iarg]);
+      iarg += n;
     } else if (strcmp(arg[iarg],"-help") == 0 ||
                strcmp(arg[iarg],"-h") == 0) {
       if (iarg+1 > narg)
@@ -811,6 +818,7 @@ void LAMMPS::help()
           "-in filename                : read input from file, not stdin (-i)\n"
           "-kokkos on/off ...          : turn KOKKOS mode on or off (-k)\n"
           "-log none/filename          : where to send log output (-l)\n"
+          "-memory keyword value ...   : options for large allocations (-m)\n"
           "-nocite                     : disable writing log.cite file (-nc)\n"
           "-package style ...          : invoke package command (-pk)\n"
           "-partition size1 size2 ...  : assign partition sizes (-p)\n"
@@ -30,19 +30,103 @@
 #define LAMMPS_MEMALIGN 64
 #endif
 
+// transparent huge pages are requested via madvise(), only on Linux
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <malloc.h>
+#if defined(MADV_HUGEPAGE)
+#define LMP_HUGEPAGE
+#endif
+#if !defined(LMP_USE_TBB_ALLOCATOR)
+#define LMP_USABLE_SIZE
+#endif
+#endif
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 using namespace LAMMPS_NS;
 
+#define LARGEMIN 2097152        // blocks of this size or more are large
+#define LARGEALIGN 2097152      // alignment and granularity of large blocks
+#define POOLMAX 16              // max # of freed large blocks kept for reuse
+#define DELTA 16
+
 /* ---------------------------------------------------------------------- */
 
-Memory::Memory(LAMMPS *lmp) : Pointers(lmp) {}
+Memory::Memory(LAMMPS *lmp) : Pointers(lmp)
+{
+  hugeflag = poolflag = 0;
+  nlarge = maxlarge = 0;
+  largeptr = NULL;
+  largesize = NULL;
+  npool = 0;
+  poolptr = NULL;
+  poolsize = NULL;
+}
+
+/* ----------------------------------------------------------------------
+   release pooled and remaining large blocks
+   all bookkeeping uses plain malloc/free, not the tracked allocators
+------------------------------------------------------------------------- */
+
+Memory::~Memory()
+{
+  for (int i = 0; i < npool; i++) free(poolptr[i]);
+  for (int i = 0; i < nlarge; i++) free(largeptr[i]);
+  free(poolptr);
+  free(poolsize);
+  free(largeptr);
+  free(largesize);
+}
+
+/* ----------------------------------------------------------------------
+   set allocation options from -memory command-line switch
+   hugepage yes/no = back large blocks with 2 MB transparent huge pages
+   pool yes/no = keep freed large blocks for reuse by later allocations
+------------------------------------------------------------------------- */
+
+void Memory::large_modify(int narg, char **arg)
+{
+  if (narg == 0 || narg % 2)
+    error->universe_all(FLERR,"Invalid command-line argument");
+
+  for (int iarg = 0; iarg < narg; iarg += 2) {
+    int flag;
+    if (strcmp(arg[iarg+1],"yes") == 0) flag = 1;
+    else if (strcmp(arg[iarg+1],"no") == 0) flag = 0;
+    else error->universe_all(FLERR,"Invalid command-line argument");
+
+    if (strcmp(arg[iarg],"hugepage") == 0) hugeflag = flag;
+    else if (strcmp(arg[iarg],"pool") == 0) poolflag = flag;
+    else error->universe_all(FLERR,"Invalid command-line argument");
+  }
+
+#if !defined(LMP_HUGEPAGE)
+  if (hugeflag)
+    error->universe_all(FLERR,"Huge page allocation is not supported "
+                        "on this platform");
+#endif
+
+  if (poolflag && poolptr == NULL) {
+    poolptr = (void **) malloc(POOLMAX*sizeof(void *));
+    poolsize = (bigint *) malloc(POOLMAX*sizeof(bigint));
+  }
+}
 
 /* ----------------------------------------------------------------------
    safe malloc
+   large blocks go through large_alloc() if -memory options are set
+   not thread-safe, only call outside of threaded regions
 ------------------------------------------------------------------------- */
 
 void *Memory::smalloc(bigint nbytes, const char *name)
 {
   if (nbytes == 0) return NULL;
+  if ((hugeflag || poolflag) && nbytes >= LARGEMIN)
+    return large_alloc(nbytes,name);
 
 #if defined(LAMMPS_MEMALIGN)
   void *ptr;
@@ -77,6 +161,29 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
     return NULL;
   }
 
+  // a large block is reused while it has capacity
+  // else its contents move to a new block, also when a small block grows large
+
+  if (hugeflag || poolflag) {
+    int i = large_find(ptr);
+    if (i >= 0) {
+      if (nbytes <= largesize[i]) return ptr;
+      bigint oldbytes = largesize[i];
+      void *nptr = large_alloc(nbytes,name);
+      memcpy(nptr,ptr,oldbytes);
+      large_free(large_find(ptr));
+      return nptr;
+    }
+#if defined(LMP_USABLE_SIZE)
+    if (ptr && nbytes >= LARGEMIN) {
+      void *nptr = large_alloc(nbytes,name);
+      memcpy(nptr,ptr,MIN(nbytes,malloc_usable_size(ptr)));
+      sfree(ptr);
+      return nptr;
+    }
+#endif
+  }
+
 #if defined(LMP_USE_TBB_ALLOCATOR)
   ptr = scalable_aligned_realloc(ptr, nbytes, LAMMPS_MEMALIGN);
 #elif defined(LMP_INTEL_NO_TBB) && defined(LAMMPS_MEMALIGN)
@@ -107,6 +214,13 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
 void Memory::sfree(void *ptr)
 {
   if (ptr == NULL) return;
+  if (nlarge) {
+    int i = large_find(ptr);
+    if (i >= 0) {
+      large_free(i);
+      return;
+    }
+  }
   #if defined(LMP_USE_TBB_ALLOCATOR)
   scalable_aligned_free(ptr);
   #else
@@ -114,6 +228,131 @@ void Memory::sfree(void *ptr)
   #endif
 }
 
+/* ----------------------------------------------------------------------
+   return index of ptr in sorted list of large blocks, -1 if not there
+------------------------------------------------------------------------- */
+
+int Memory::large_find(void *ptr)
+{
+  int lo = 0;
+  int hi = nlarge-1;
+  while (lo <= hi) {
+    int mid = (lo+hi)/2;
+    if (largeptr[mid] == ptr) return mid;
+    if ((char *) largeptr[mid] < (char *) ptr) lo = mid+1;
+    else hi = mid-1;
+  }
+  return -1;
+}
+
+/* ----------------------------------------------------------------------
+   allocate a large block of at least nbytes
+   take the smallest pooled block that fits without wasting over 1/4 of it
+   else allocate a new block aligned to and rounded up to LARGEALIGN,
+     ask for huge pages and touch its pages in the threads that will use them,
+     so each page is placed in memory local to its thread (first touch)
+------------------------------------------------------------------------- */
+
+void *Memory::large_alloc(bigint nbytes, const char *name)
+{
+  void *ptr = NULL;
+  bigint size = 0;
+
+  int ibest = -1;
+  for (int i = 0; i < npool; i++)
+    if (poolsize[i] >= nbytes && poolsize[i] - poolsize[i]/4 <= nbytes &&
+        (ibest < 0 || poolsize[i] < poolsize[ibest])) ibest = i;
+
+  if (ibest >= 0) {
+    ptr = poolptr[ibest];
+    size = poolsize[ibest];
+    npool--;
+    poolptr[ibest] = poolptr[npool];
+    poolsize[ibest] = poolsize[npool];
+
+  } else {
+    size = (nbytes + LARGEALIGN-1) / LARGEALIGN * LARGEALIGN;
+    if (posix_memalign(&ptr,LARGEALIGN,size)) ptr = NULL;
+    if (ptr == NULL) {
+      char str[128];
+      sprintf(str,"Failed to allocate " BIGINT_FORMAT " bytes for array %s",
+              nbytes,name);
+      error->one(FLERR,str);
+    }
+
+#if defined(LMP_HUGEPAGE)
+    if (hugeflag) madvise(ptr,size,MADV_HUGEPAGE);
+#endif
+
+#if defined(_OPENMP)
+    const bigint npage = size / LARGEALIGN;
+#pragma omp parallel for schedule(static)
+    for (bigint i = 0; i < npage; i++)
+      memset((char *) ptr + i*LARGEALIGN,0,LARGEALIGN);
+#endif
+  }
+
+  // insert into address-sorted list of large blocks
+
+  if (nlarge == maxlarge) {
+    maxlarge += DELTA;
+    largeptr = (void **) realloc(largeptr,maxlarge*sizeof(void *));
+    largesize = (bigint *) realloc(largesize,maxlarge*sizeof(bigint));
+    if (largeptr == NULL || largesize == NULL)
+      error->one(FLERR,"Failed to allocate list of large memory blocks");
+  }
+
+  int m = nlarge;
+  while (m > 0 && (char *) largeptr[m-1] > (char *) ptr) {
+    largeptr[m] = largeptr[m-1];
+    largesize[m] = largesize[m-1];
+    m--;
+  }
+  largeptr[m] = ptr;
+  largesize[m] = size;
+  nlarge++;
+
+  return ptr;
+}
+
+/* ----------------------------------------------------------------------
+   release large block I, keep it in the pool if pooling is enabled
+   when the pool is full, the largest pooled block is freed
+------------------------------------------------------------------------- */
+
+void Memory::large_free(int i)
+{
+  void *ptr = largeptr[i];
+  bigint size = largesize[i];
+
+  nlarge--;
+  for (int m = i; m < nlarge; m++) {
+    largeptr[m] = largeptr[m+1];
+    largesize[m] = largesize[m+1];
+  }
+
+  if (!poolflag) {
+    free(ptr);
+    return;
+  }
+
+  if (npool == POOLMAX) {
+    int imax = 0;
+    for (int m = 1; m < npool; m++)
+      if (poolsize[m] > poolsize[imax]) imax = m;
+    if (poolsize[imax] > size) {
+      free(poolptr[imax]);
+      poolptr[imax] = ptr;
+      poolsize[imax] = size;
+    } else free(ptr);
+    return;
+  }
+
+  poolptr[npool] = ptr;
+  poolsize[npool] = size;
+  npool++;
+}
+
 /* ----------------------------------------------------------------------
    erroneous usage of templated create/grow functions
 ------------------------------------------------------------------------- */
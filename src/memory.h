@@ -22,11 +22,13 @@ namespace LAMMPS_NS {
 class Memory : protected Pointers {
  public:
   Memory(class LAMMPS *);
+  ~Memory();
 
   void *smalloc(bigint n, const char *);
   void *srealloc(void *, bigint n, const char *);
   void sfree(void *);
   void fail(const char *);
+  void large_modify(int, char **);
 
 /* ----------------------------------------------------------------------
    create/grow/destroy vecs and multidim arrays with contiguous memory blocks
@@ -656,6 +658,27 @@ class Memory : protected Pointers {
     bytes += ((bigint) sizeof(TYPE ***)) * n1;
     return bytes;
   }
+
+ private:
+
+  // large blocks, e.g. per-atom arrays, can be backed by huge pages
+  // and freed large blocks can be kept for reuse by later allocations
+  // large blocks are tracked in a list sorted by address,
+  //   so sfree() and srealloc() recognize them and know their capacity
+
+  int hugeflag;                 // 1 if large blocks use transparent huge pages
+  int poolflag;                 // 1 if freed large blocks are pooled
+  int nlarge,maxlarge;          // # of large blocks in use
+  void **largeptr;              // address of each large block
+  bigint *largesize;            // capacity of each large block in bytes
+
+  int npool;                    // # of freed large blocks kept for reuse
+  void **poolptr;
+  bigint *poolsize;
+
+  int large_find(void *);
+  void *large_alloc(bigint, const char *);
+  void large_free(int);
 };
 
 }
@@ -679,4 +702,18 @@ E: Cannot create/grow a vector/array of pointers for %s
 LAMMPS code is making an illegal call to the templated memory
 allocaters, to create a vector or array of pointers.
 
+E: Invalid command-line argument
+
+One or more command-line arguments is invalid.  Check the syntax of
+the command you are using to launch LAMMPS.
+
+E: Huge page allocation is not supported on this platform
+
+The -memory hugepage yes switch requires transparent huge pages, which
+are only requested on Linux.
+
+E: Failed to allocate list of large memory blocks
+
+Your LAMMPS simulation has run out of memory.
+
 */
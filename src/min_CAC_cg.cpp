@@ -37,6 +37,8 @@
 #include <string.h>
 using namespace LAMMPS_NS;
 
+void sum_max_merge(void *, void *, int *, MPI_Datatype *);
+
 // ALPHA_MAX = max alpha allowed to avoid long backtracks
 // ALPHA_REDUCE = reduction ratio, should be in range [0.5,1)
 // BACKTRACK_SLOPE, should be in range (0,0.5]
@@ -59,6 +61,9 @@ CACMinCG::CACMinCG(LAMMPS *lmp) : Min(lmp)
   searchflag = 1;
   gextra = hextra = NULL;
   x0extra_atom = gextra_atom = hextra_atom = NULL;
+  searchme = searchall = NULL;
+
+  MPI_Op_create(sum_max_merge,1,&sum_max_op);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -70,6 +75,10 @@ CACMinCG::~CACMinCG()
   delete [] x0extra_atom;
   delete [] gextra_atom;
   delete [] hextra_atom;
+  delete [] searchme;
+  delete [] searchall;
+
+  MPI_Op_free(&sum_max_op);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -90,6 +99,10 @@ void CACMinCG::init()
   delete [] gextra_atom;
   delete [] hextra_atom;
   x0extra_atom = gextra_atom = hextra_atom = NULL;
+
+  delete [] searchme;
+  delete [] searchall;
+  searchme = searchall = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -124,6 +137,12 @@ void CACMinCG::setup_style()
       fix_minimize->add_vector(extra_peratom[m]);
     }
   }
+
+  // reduction buffers for the start of each line search:
+  // f.h followed by max |h| of atomic and each extra per-atom dof
+
+  searchme = new double[2+nextra_atom];
+  searchall = new double[2+nextra_atom];
 }
 
 /* ----------------------------------------------------------------------
@@ -174,7 +193,7 @@ minimization via conjugate gradient iterations
 int CACMinCG::iterate(int maxiter)
 {
 	int i, m, n, fail, ntimestep;
-	double beta, gg, dot[2], dotall[2];
+	double beta, gg, dot[3], dotall[3];
 	double *fatom, *gatom, *hatom;
 
 	// nlimit = max # of CG iterations before restarting
@@ -223,27 +242,34 @@ int CACMinCG::iterate(int maxiter)
 			return ETOL;
 
 		// force tolerance criterion
+		// f.h of the old direction is reduced along with f.f and f.g
+		// so the downhill test of the new direction needs no extra reduction:
+		// g.h_new = f.f + beta*f.h_old since g = f after the update
 
-		dot[0] = dot[1] = 0.0;
+		dot[0] = dot[1] = dot[2] = 0.0;
 		for (i = 0; i < nvec; i++) {
 			dot[0] += fvec[i] * fvec[i];
 			dot[1] += fvec[i] * g[i];
+			dot[2] += fvec[i] * h[i];
 		}
 		if (nextra_atom)
 			for (m = 0; m < nextra_atom; m++) {
 				fatom = fextra_atom[m];
 				gatom = gextra_atom[m];
+				hatom = hextra_atom[m];
 				n = extra_nlen[m];
 				for (i = 0; i < n; i++) {
 					dot[0] += fatom[i] * fatom[i];
 					dot[1] += fatom[i] * gatom[i];
+					dot[2] += fatom[i] * hatom[i];
 				}
 			}
-		MPI_Allreduce(dot, dotall, 2, MPI_DOUBLE, MPI_SUM, world);
+		MPI_Allreduce(dot, dotall, 3, MPI_DOUBLE, MPI_SUM, world);
 		if (nextra_global)
 			for (i = 0; i < nextra_global; i++) {
 				dotall[0] += fextra[i] * fextra[i];
 				dotall[1] += fextra[i] * gextra[i];
+				dotall[2] += fextra[i] * hextra[i];
 			}
 
 		if (dotall[0] < update->ftol*update->ftol) return FTOL;
@@ -257,6 +283,10 @@ int CACMinCG::iterate(int maxiter)
 		if ((niter + 1) % nlimit == 0) beta = 0.0;
 		gg = dotall[0];
 
+		// reinitialize CG if new search direction h is not downhill
+
+		if (dotall[0] + beta*dotall[2] <= 0.0) beta = 0.0;
+
 		for (i = 0; i < nvec; i++) {
 			g[i] = fvec[i];
 			h[i] = g[i] + beta*h[i];
@@ -278,35 +308,6 @@ int CACMinCG::iterate(int maxiter)
 				hextra[i] = gextra[i] + beta*hextra[i];
 			}
 
-		// reinitialize CG if new search direction h is not downhill
-
-		dot[0] = 0.0;
-		for (i = 0; i < nvec; i++) dot[0] += g[i] * h[i];
-		if (nextra_atom)
-			for (m = 0; m < nextra_atom; m++) {
-				gatom = gextra_atom[m];
-				hatom = hextra_atom[m];
-				n = extra_nlen[m];
-				for (i = 0; i < n; i++) dot[0] += gatom[i] * hatom[i];
-			}
-		MPI_Allreduce(dot, dotall, 1, MPI_DOUBLE, MPI_SUM, world);
-		if (nextra_global)
-			for (i = 0; i < nextra_global; i++)
-				dotall[0] += gextra[i] * hextra[i];
-
-		if (dotall[0] <= 0.0) {
-			for (i = 0; i < nvec; i++) h[i] = g[i];
-			if (nextra_atom)
-				for (m = 0; m < nextra_atom; m++) {
-					gatom = gextra_atom[m];
-					hatom = hextra_atom[m];
-					n = extra_nlen[m];
-					for (i = 0; i < n; i++) hatom[i] = gatom[i];
-				}
-			if (nextra_global)
-				for (i = 0; i < nextra_global; i++) hextra[i] = gextra[i];
-		}
-
 		// output for thermo, dump, restart files
 
 		if (output->next == ntimestep) {
@@ -344,56 +345,19 @@ int CACMinCG::iterate(int maxiter)
 int CACMinCG::linemin_backtrack(double eoriginal, double &alpha)
 {
   int i,m,n;
-  double fdothall,fdothme,hme,hmax,hmaxall;
+  double fdothall,hmaxall;
   double de_ideal,de;
-  double *xatom,*x0atom,*fatom,*hatom;
+  double *xatom,*x0atom;
 
   // fdothall = projection of search dir along downhill gradient
-  // if search direction is not downhill, exit with error
-
-  fdothme = 0.0;
-  for (i = 0; i < nvec; i++) fdothme += fvec[i]*h[i];
-  if (nextra_atom)
-    for (m = 0; m < nextra_atom; m++) {
-      fatom = fextra_atom[m];
-      hatom = hextra_atom[m];
-      n = extra_nlen[m];
-      for (i = 0; i < n; i++) fdothme += fatom[i]*hatom[i];
-    }
-  MPI_Allreduce(&fdothme,&fdothall,1,MPI_DOUBLE,MPI_SUM,world);
-  if (nextra_global)
-    for (i = 0; i < nextra_global; i++) fdothall += fextra[i]*hextra[i];
-  if (output->thermo->normflag) fdothall /= atom->natoms;
-  if (fdothall <= 0.0) return DOWNHILL;
-
-  // set alpha so no dof is changed by more than max allowed amount
-  // for atom coords, max amount = dmax
-  // for extra per-atom dof, max amount = extra_max[]
-  // for extra global dof, max amount is set by fix
+  // alpha is set so no dof is changed by more than max allowed amount
   // also insure alpha <= ALPHA_MAX
   // else will have to backtrack from huge value when forces are tiny
-  // if all search dir components are already 0.0, exit with error
+  // exit with error if search direction is not downhill
+  // or if all search dir components are already 0.0
 
-  hme = 0.0;
-  for (i = 0; i < nvec; i++) hme = MAX(hme,fabs(h[i]));
-  MPI_Allreduce(&hme,&hmaxall,1,MPI_DOUBLE,MPI_MAX,world);
-  alpha = MIN(ALPHA_MAX,dmax/hmaxall);
-  if (nextra_atom)
-    for (m = 0; m < nextra_atom; m++) {
-      hatom = hextra_atom[m];
-      n = extra_nlen[m];
-      hme = 0.0;
-      for (i = 0; i < n; i++) hme = MAX(hme,fabs(hatom[i]));
-      MPI_Allreduce(&hme,&hmax,1,MPI_DOUBLE,MPI_MAX,world);
-      alpha = MIN(alpha,extra_max[m]/hmax);
-      hmaxall = MAX(hmaxall,hmax);
-    }
-  if (nextra_global) {
-    double alpha_extra = modify->max_alpha(hextra);
-    alpha = MIN(alpha,alpha_extra);
-    for (i = 0; i < nextra_global; i++)
-      hmaxall = MAX(hmaxall,fabs(hextra[i]));
-  }
+  alpha = MIN(ALPHA_MAX,search_limits(fdothall,hmaxall));
+  if (fdothall <= 0.0) return DOWNHILL;
   if (hmaxall == 0.0) return ZEROFORCE;
 
   // store box and values of all dof at start of linesearch
@@ -493,7 +457,7 @@ int CACMinCG::linemin_backtrack(double eoriginal, double &alpha)
 int CACMinCG::linemin_quadratic(double eoriginal, double &alpha)
 {
   int i,m,n;
-  double fdothall,fdothme,hme,hmax,hmaxall;
+  double fdothall,hmaxall;
   double de_ideal,de;
   double delfh,engprev,relerr,alphaprev,fhprev,ff,fh,alpha0;
   double dot[2],dotall[2];
@@ -501,52 +465,14 @@ int CACMinCG::linemin_quadratic(double eoriginal, double &alpha)
   double alphamax;
 
   // fdothall = projection of search dir along downhill gradient
-  // if search direction is not downhill, exit with error
-
-  fdothme = 0.0;
-  for (i = 0; i < nvec; i++) fdothme += fvec[i]*h[i];
-  if (nextra_atom)
-    for (m = 0; m < nextra_atom; m++) {
-      fatom = fextra_atom[m];
-      hatom = hextra_atom[m];
-      n = extra_nlen[m];
-      for (i = 0; i < n; i++) fdothme += fatom[i]*hatom[i];
-    }
-  MPI_Allreduce(&fdothme,&fdothall,1,MPI_DOUBLE,MPI_SUM,world);
-  if (nextra_global)
-    for (i = 0; i < nextra_global; i++) fdothall += fextra[i]*hextra[i];
-  if (output->thermo->normflag) fdothall /= atom->natoms;
-  if (fdothall <= 0.0) return DOWNHILL;
-
-  // set alphamax so no dof is changed by more than max allowed amount
-  // for atom coords, max amount = dmax
-  // for extra per-atom dof, max amount = extra_max[]
-  // for extra global dof, max amount is set by fix
+  // alphamax is set so no dof is changed by more than max allowed amount
   // also insure alphamax <= ALPHA_MAX
   // else will have to backtrack from huge value when forces are tiny
-  // if all search dir components are already 0.0, exit with error
-
-  hme = 0.0;
-  for (i = 0; i < nvec; i++) hme = MAX(hme,fabs(h[i]));
-  MPI_Allreduce(&hme,&hmaxall,1,MPI_DOUBLE,MPI_MAX,world);
-  alphamax = MIN(ALPHA_MAX,dmax/hmaxall);
-  if (nextra_atom)
-    for (m = 0; m < nextra_atom; m++) {
-      hatom = hextra_atom[m];
-      n = extra_nlen[m];
-      hme = 0.0;
-      for (i = 0; i < n; i++) hme = MAX(hme,fabs(hatom[i]));
-      MPI_Allreduce(&hme,&hmax,1,MPI_DOUBLE,MPI_MAX,world);
-      alphamax = MIN(alphamax,extra_max[m]/hmax);
-      hmaxall = MAX(hmaxall,hmax);
-    }
-  if (nextra_global) {
-    double alpha_extra = modify->max_alpha(hextra);
-    alphamax = MIN(alphamax,alpha_extra);
-    for (i = 0; i < nextra_global; i++)
-      hmaxall = MAX(hmaxall,fabs(hextra[i]));
-  }
+  // exit with error if search direction is not downhill
+  // or if all search dir components are already 0.0
 
+  alphamax = MIN(ALPHA_MAX,search_limits(fdothall,hmaxall));
+  if (fdothall <= 0.0) return DOWNHILL;
   if (hmaxall == 0.0) return ZEROFORCE;
 
   // store box and values of all dof at start of linesearch
@@ -750,9 +676,9 @@ pseudo code:
 int CACMinCG::linemin_forcezero(double eoriginal, double &alpha)
 {
   int i,m,n;
-  double fdothall,fdothme,hme,hmax,hmaxall;
+  double fdothall,hmaxall;
   double de;
-  double *xatom,*x0atom,*fatom,*hatom;
+  double *xatom,*x0atom;
 
   double alpha_max, alpha_init, alpha_del;
   // projection of: force on itself, current force on search direction,
@@ -776,60 +702,12 @@ int CACMinCG::linemin_forcezero(double eoriginal, double &alpha)
   double LIMIT_BOOST = 4.0;
 
   // fdothall = projection of search dir along downhill gradient
-  // if search direction is not downhill, exit with error
+  // alpha_max is set so no dof is changed by more than max allowed amount
+  // exit with error if search direction is not downhill
+  // or if all search dir components are already 0.0
 
-  fdothme = 0.0;
-  for (i = 0; i < nvec; i++) fdothme += fvec[i]*h[i];
-  if (nextra_atom)
-    for (m = 0; m < nextra_atom; m++) {
-      fatom = fextra_atom[m];
-      hatom = hextra_atom[m];
-      n = extra_nlen[m];
-      for (i = 0; i < n; i++)
-        fdothme += fatom[i]*hatom[i];
-    }
-
-  MPI_Allreduce(&fdothme,&fdothall,1,MPI_DOUBLE,MPI_SUM,world);
-  if (nextra_global)
-    for (i = 0; i < nextra_global; i++)
-      fdothall += fextra[i]*hextra[i];
-  if (output->thermo->normflag) fdothall /= atom->natoms;
+  alpha_max = search_limits(fdothall,hmaxall);
   if (fdothall <= 0.0) return DOWNHILL;
-
-  // set alpha so no dof is changed by more than max allowed amount
-  // for atom coords, max amount = dmax
-  // for extra per-atom dof, max amount = extra_max[]
-  // for extra global dof, max amount is set by fix
-
-  // also insure alpha <= ALPHA_MAX else will have
-  // to backtrack from huge value when forces are tiny
-
-  // if all search dir components are already 0.0, exit with error
-
-  hme = 0.0;
-  for (i = 0; i < nvec; i++)
-    hme = MAX(hme,fabs(h[i]));
-
-  MPI_Allreduce(&hme,&hmaxall,1,MPI_DOUBLE,MPI_MAX,world);
-  alpha_max = dmax/hmaxall;
-  if (nextra_atom)
-    for (m = 0; m < nextra_atom; m++) {
-      hatom = hextra_atom[m];
-      n = extra_nlen[m];
-      hme = 0.0;
-      for (i = 0; i < n; i++) hme = MAX(hme,fabs(hatom[i]));
-      MPI_Allreduce(&hme,&hmax,1,MPI_DOUBLE,MPI_MAX,world);
-      alpha_max = MIN(alpha_max,extra_max[m]/hmax);
-      hmaxall = MAX(hmaxall,hmax);
-    }
-
-  if (nextra_global) {
-    double alpha_extra = modify->max_alpha(hextra);
-    alpha_max = MIN(alpha_max, alpha_extra);
-    for (i = 0; i < nextra_global; i++)
-      hmaxall = MAX(hmaxall,fabs(hextra[i]));
-  }
-
   if (hmaxall == 0.0) return ZEROFORCE;
 
   // store box and values of all dof at start of linesearch
@@ -1078,6 +956,67 @@ double ****nodal_positions=atom->nodal_positions;
   return energy_force(resetflag);
 }
 
+/* ----------------------------------------------------------------------
+   f.h and max |h| of the search direction at the start of a line search
+   one reduction covers the f.h sum and the max over atomic and
+   each extra per-atom dof, ordered as in searchme
+   return max alpha so no dof moves by more than its allowed amount
+------------------------------------------------------------------------- */
+
+double CACMinCG::search_limits(double &fdothall, double &hmaxall)
+{
+  int i,m,n;
+  double alpha,hme;
+  double *fatom,*hatom;
+
+  searchme[0] = 0.0;
+  for (i = 0; i < nvec; i++) searchme[0] += fvec[i]*h[i];
+  if (nextra_atom)
+    for (m = 0; m < nextra_atom; m++) {
+      fatom = fextra_atom[m];
+      hatom = hextra_atom[m];
+      n = extra_nlen[m];
+      for (i = 0; i < n; i++) searchme[0] += fatom[i]*hatom[i];
+    }
+
+  hme = 0.0;
+  for (i = 0; i < nvec; i++) hme = MAX(hme,fabs(h[i]));
+  searchme[1] = hme;
+  if (nextra_atom)
+    for (m = 0; m < nextra_atom; m++) {
+      hatom = hextra_atom[m];
+      n = extra_nlen[m];
+      hme = 0.0;
+      for (i = 0; i < n; i++) hme = MAX(hme,fabs(hatom[i]));
+      searchme[2+m] = hme;
+    }
+
+  MPI_Allreduce(searchme,searchall,2+nextra_atom,MPI_DOUBLE,sum_max_op,world);
+
+  // for atom coords, max amount = dmax
+  // for extra per-atom dof, max amount = extra_max[]
+  // for extra global dof, max amount is set by fix
+
+  fdothall = searchall[0];
+  hmaxall = searchall[1];
+  alpha = dmax/hmaxall;
+  if (nextra_atom)
+    for (m = 0; m < nextra_atom; m++) {
+      alpha = MIN(alpha,extra_max[m]/searchall[2+m]);
+      hmaxall = MAX(hmaxall,searchall[2+m]);
+    }
+  if (nextra_global) {
+    for (i = 0; i < nextra_global; i++) fdothall += fextra[i]*hextra[i];
+    double alpha_extra = modify->max_alpha(hextra);
+    alpha = MIN(alpha,alpha_extra);
+    for (i = 0; i < nextra_global; i++)
+      hmaxall = MAX(hmaxall,fabs(hextra[i]));
+  }
+  if (output->thermo->normflag) fdothall /= atom->natoms;
+
+  return alpha;
+}
+
 /* ---------------------------------------------------------------------- */
 
 // compute projection of force on: itself and the search direction
@@ -1125,3 +1064,17 @@ double CACMinCG::compute_dir_deriv(double &ff)
 
     return fh;
 }
+
+/* ----------------------------------------------------------------------
+   MPI reduction op for search_limits()
+   sum the first value, max of the rest
+------------------------------------------------------------------------- */
+
+void sum_max_merge(void *in, void *inout, int *len, MPI_Datatype *dptr)
+{
+  double *din = (double *) in;
+  double *dinout = (double *) inout;
+
+  dinout[0] += din[0];
+  for (int i = 1; i < *len; i++) dinout[i] = MAX(dinout[i],din[i]);
+}
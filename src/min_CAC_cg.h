@@ -54,8 +54,13 @@ class CACMinCG : public Min {
   int linemin_quadratic(double, double &);
   int linemin_forcezero(double, double &);
 
+  double *searchme;           // line search start reduction buffers
+  double *searchall;
+  MPI_Op sum_max_op;
+
   double alpha_step(double, int);
   double compute_dir_deriv(double &);
+  double search_limits(double &, double &);
 };
 
 }
@@ -0,0 +1,253 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+   Sources: Nocedal and Wright, Numerical Optimization, Alg 7.4 and 7.5
+            (two-loop recursion for the limited memory BFGS direction)
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <math.h>
+#include "min_CAC_lbfgs.h"
+#include "atom.h"
+#include "update.h"
+#include "fix_minimize.h"
+#include "output.h"
+#include "timer.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+// HISTORY = # of (s,y) pairs kept, each costs 2 nodal dof vectors
+// EPS_CURVATURE = pairs with y.s below this are not stored
+// EPS_ENERGY = minimum normalization for energy tolerance
+
+#define HISTORY 5
+#define EPS_CURVATURE 1.0e-20
+#define EPS_ENERGY 1.0e-8
+
+/* ---------------------------------------------------------------------- */
+
+CACMinLBFGS::CACMinLBFGS(LAMMPS *lmp) : CACMinCG(lmp)
+{
+  mhistory = HISTORY;
+  nhistory = ihistory = 0;
+  history_offset = 0;
+  s = new double*[mhistory];
+  y = new double*[mhistory];
+  rho = new double[mhistory];
+  alpha_two = new double[mhistory];
+}
+
+/* ---------------------------------------------------------------------- */
+
+CACMinLBFGS::~CACMinLBFGS()
+{
+  delete [] s;
+  delete [] y;
+  delete [] rho;
+  delete [] alpha_two;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void CACMinLBFGS::init()
+{
+  CACMinCG::init();
+  nhistory = ihistory = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void CACMinLBFGS::setup_style()
+{
+  if (nextra_global || nextra_atom)
+    error->all(FLERR,"Min_style CAC_lbfgs does not support "
+               "extra global or per-atom degrees of freedom");
+
+  // x0,g,h from CG, then the s,y history
+
+  CACMinCG::setup_style();
+
+  history_offset = 3;
+  for (int m = 0; m < 2*mhistory; m++)
+    fix_minimize->add_vector(3*atom->maxpoly*atom->nodes_per_element);
+}
+
+/* ----------------------------------------------------------------------
+   set current vector lengths and pointers
+   called after atoms have migrated
+------------------------------------------------------------------------- */
+
+void CACMinLBFGS::reset_vectors()
+{
+  CACMinCG::reset_vectors();
+
+  int n = history_offset;
+  for (int m = 0; m < mhistory; m++) {
+    s[m] = fix_minimize->request_vector(n++);
+    y[m] = fix_minimize->request_vector(n++);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   minimization via limited memory BFGS iterations
+   line searches are shared with CACMinCG
+------------------------------------------------------------------------- */
+
+int CACMinLBFGS::iterate(int maxiter)
+{
+  int i,k,fail,ntimestep;
+  double dot[3],dotall[3];
+  double *sk,*yk;
+
+  steepest_descent();
+
+  for (int iter = 0; iter < maxiter; iter++) {
+
+    if (timer->check_timeout(niter))
+      return TIMEOUT;
+
+    ntimestep = ++update->ntimestep;
+    niter++;
+
+    // line minimization along direction h from current nodal positions
+
+    eprevious = ecurrent;
+    fail = (this->*linemin)(ecurrent,alpha_final);
+
+    // a failed search along a quasi-Newton direction is retried once
+    // along steepest descent before giving up
+
+    if (fail) {
+      if (nhistory == 0) return fail;
+      steepest_descent();
+      continue;
+    }
+
+    // function evaluation criterion
+
+    if (neval >= update->max_eval) return MAXEVAL;
+
+    // energy tolerance criterion
+
+    if (fabs(ecurrent - eprevious) <
+        update->etol * 0.5*(fabs(ecurrent) + fabs(eprevious) + EPS_ENERGY))
+      return ETOL;
+
+    // new (s,y) pair in the next history slot
+    // s = x - x0, y = grad - grad_old = g - f since f and g are -grad
+    // f.f, y.s and y.y are reduced together
+
+    k = (ihistory + 1) % mhistory;
+    sk = s[k];
+    yk = y[k];
+
+    dot[0] = dot[1] = dot[2] = 0.0;
+    for (i = 0; i < nvec; i++) {
+      sk[i] = xvec[i] - x0[i];
+      yk[i] = g[i] - fvec[i];
+      dot[0] += fvec[i]*fvec[i];
+      dot[1] += yk[i]*sk[i];
+      dot[2] += yk[i]*yk[i];
+    }
+    MPI_Allreduce(dot,dotall,3,MPI_DOUBLE,MPI_SUM,world);
+
+    // force tolerance criterion
+
+    if (dotall[0] < update->ftol*update->ftol) return FTOL;
+
+    // keep the pair only if it satisfies the curvature condition,
+    // otherwise reuse the existing history
+
+    if (dotall[1] > EPS_CURVATURE) {
+      ihistory = k;
+      rho[k] = 1.0/dotall[1];
+      if (nhistory < mhistory) nhistory++;
+    }
+
+    for (i = 0; i < nvec; i++) g[i] = fvec[i];
+
+    if (nhistory) two_loop(dotall[2] > 0.0 ? 1.0/(rho[ihistory]*dotall[2]) : 1.0);
+    else steepest_descent();
+
+    // restart from steepest descent if new search direction is not downhill
+
+    dot[0] = 0.0;
+    for (i = 0; i < nvec; i++) dot[0] += g[i]*h[i];
+    MPI_Allreduce(dot,dotall,1,MPI_DOUBLE,MPI_SUM,world);
+    if (dotall[0] <= 0.0) steepest_descent();
+
+    // output for thermo, dump, restart files
+
+    if (output->next == ntimestep) {
+      timer->stamp();
+      output->write(ntimestep);
+      timer->stamp(Timer::OUTPUT);
+    }
+  }
+
+  return MAXITER;
+}
+
+/* ----------------------------------------------------------------------
+   h = H f via the two-loop recursion over the stored pairs
+   gamma = initial inverse Hessian scaling s.y/y.y of the newest pair
+------------------------------------------------------------------------- */
+
+void CACMinLBFGS::two_loop(double gamma)
+{
+  int i,j,k;
+  double dot,dotall,beta;
+  double *sk,*yk;
+
+  for (i = 0; i < nvec; i++) h[i] = fvec[i];
+
+  // newest to oldest
+
+  for (j = 0; j < nhistory; j++) {
+    k = (ihistory - j + mhistory) % mhistory;
+    sk = s[k];
+    yk = y[k];
+    dot = 0.0;
+    for (i = 0; i < nvec; i++) dot += sk[i]*h[i];
+    MPI_Allreduce(&dot,&dotall,1,MPI_DOUBLE,MPI_SUM,world);
+    alpha_two[k] = rho[k]*dotall;
+    for (i = 0; i < nvec; i++) h[i] -= alpha_two[k]*yk[i];
+  }
+
+  for (i = 0; i < nvec; i++) h[i] *= gamma;
+
+  // oldest to newest
+
+  for (j = nhistory-1; j >= 0; j--) {
+    k = (ihistory - j + mhistory) % mhistory;
+    sk = s[k];
+    yk = y[k];
+    dot = 0.0;
+    for (i = 0; i < nvec; i++) dot += yk[i]*h[i];
+    MPI_Allreduce(&dot,&dotall,1,MPI_DOUBLE,MPI_SUM,world);
+    beta = rho[k]*dotall;
+    for (i = 0; i < nvec; i++) h[i] += (alpha_two[k] - beta)*sk[i];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   clear the history and search along the current force
+------------------------------------------------------------------------- */
+
+void CACMinLBFGS::steepest_descent()
+{
+  nhistory = 0;
+  for (int i = 0; i < nvec; i++) h[i] = g[i] = fvec[i];
+}
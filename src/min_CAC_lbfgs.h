@@ -0,0 +1,56 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef MINIMIZE_CLASS
+
+MinimizeStyle(CAC_lbfgs,CACMinLBFGS)
+
+#else
+
+#ifndef LMP_CAC_MIN_LBFGS_H
+#define LMP_CAC_MIN_LBFGS_H
+
+#include "min_CAC_cg.h"
+
+namespace LAMMPS_NS {
+
+class CACMinLBFGS : public CACMinCG {
+ public:
+  CACMinLBFGS(class LAMMPS *);
+  ~CACMinLBFGS();
+  void init();
+  void setup_style();
+  void reset_vectors();
+  int iterate(int);
+
+ protected:
+  // history of nodal dof updates s and gradient changes y
+  // allocated and stored by fix_minimize so they migrate with elements
+
+  int mhistory;               // max # of stored (s,y) pairs
+  int nhistory;               // # of pairs currently stored
+  int ihistory;               // slot of the most recent pair
+  int history_offset;         // fix_minimize index of the first s vector
+  double **s;
+  double **y;
+  double *rho;                // 1/(y.s) of each pair
+  double *alpha_two;          // two-loop coefficients
+
+  void two_loop(double);
+  void steepest_descent();
+};
+
+}
+
+#endif
+#endif
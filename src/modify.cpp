@@ -26,6 +26,7 @@
 #include "region.h"
 #include "input.h"
 #include "variable.h"
+#include "timer.h"
 #include "memory.h"
 #include "error.h"
 
@@ -53,6 +54,8 @@ Modify::Modify(LAMMPS *lmp) : Pointers(lmp)
 
   fix = NULL;
   fmask = NULL;
+  time_fix = NULL;
+  detailflag = 0;
   list_initial_integrate = list_post_integrate = NULL;
   list_pre_exchange = list_pre_neighbor = list_post_neighbor = NULL;
   list_pre_force = list_pre_reverse = list_post_force = NULL;
@@ -113,6 +116,7 @@ Modify::~Modify()
   while (nfix) delete_fix(0);
   memory->sfree(fix);
   memory->destroy(fmask);
+  memory->destroy(time_fix);
 
   // delete all computes
 
@@ -384,8 +388,11 @@ void Modify::setup_pre_reverse(int eflag, int vflag)
 
 void Modify::initial_integrate(int vflag)
 {
-  for (int i = 0; i < n_initial_integrate; i++)
+  for (int i = 0; i < n_initial_integrate; i++) {
+    detail_start();
     fix[list_initial_integrate[i]]->initial_integrate(vflag);
+    detail_stop(list_initial_integrate[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -394,8 +401,11 @@ void Modify::initial_integrate(int vflag)
 
 void Modify::post_integrate()
 {
-  for (int i = 0; i < n_post_integrate; i++)
+  for (int i = 0; i < n_post_integrate; i++) {
+    detail_start();
     fix[list_post_integrate[i]]->post_integrate();
+    detail_stop(list_post_integrate[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -404,8 +414,11 @@ void Modify::post_integrate()
 
 void Modify::pre_exchange()
 {
-  for (int i = 0; i < n_pre_exchange; i++)
+  for (int i = 0; i < n_pre_exchange; i++) {
+    detail_start();
     fix[list_pre_exchange[i]]->pre_exchange();
+    detail_stop(list_pre_exchange[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -414,8 +427,11 @@ void Modify::pre_exchange()
 
 void Modify::pre_neighbor()
 {
-  for (int i = 0; i < n_pre_neighbor; i++)
+  for (int i = 0; i < n_pre_neighbor; i++) {
+    detail_start();
     fix[list_pre_neighbor[i]]->pre_neighbor();
+    detail_stop(list_pre_neighbor[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -424,8 +440,11 @@ void Modify::pre_neighbor()
 
 void Modify::post_neighbor()
 {
-  for (int i = 0; i < n_post_neighbor; i++)
+  for (int i = 0; i < n_post_neighbor; i++) {
+    detail_start();
     fix[list_post_neighbor[i]]->post_neighbor();
+    detail_stop(list_post_neighbor[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -434,8 +453,11 @@ void Modify::post_neighbor()
 
 void Modify::pre_force(int vflag)
 {
-  for (int i = 0; i < n_pre_force; i++)
+  for (int i = 0; i < n_pre_force; i++) {
+    detail_start();
     fix[list_pre_force[i]]->pre_force(vflag);
+    detail_stop(list_pre_force[i]);
+  }
 }
 /* ----------------------------------------------------------------------
    pre_reverse call, only for relevant fixes
@@ -443,8 +465,11 @@ void Modify::pre_force(int vflag)
 
 void Modify::pre_reverse(int eflag, int vflag)
 {
-  for (int i = 0; i < n_pre_reverse; i++)
+  for (int i = 0; i < n_pre_reverse; i++) {
+    detail_start();
     fix[list_pre_reverse[i]]->pre_reverse(eflag,vflag);
+    detail_stop(list_pre_reverse[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -453,8 +478,11 @@ void Modify::pre_reverse(int eflag, int vflag)
 
 void Modify::post_force(int vflag)
 {
-  for (int i = 0; i < n_post_force; i++)
+  for (int i = 0; i < n_post_force; i++) {
+    detail_start();
     fix[list_post_force[i]]->post_force(vflag);
+    detail_stop(list_post_force[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -463,8 +491,11 @@ void Modify::post_force(int vflag)
 
 void Modify::final_integrate()
 {
-  for (int i = 0; i < n_final_integrate; i++)
+  for (int i = 0; i < n_final_integrate; i++) {
+    detail_start();
     fix[list_final_integrate[i]]->final_integrate();
+    detail_stop(list_final_integrate[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -475,8 +506,11 @@ void Modify::final_integrate()
 void Modify::end_of_step()
 {
   for (int i = 0; i < n_end_of_step; i++)
-    if (update->ntimestep % end_of_step_every[i] == 0)
-      fix[list_end_of_step[i]]->end_of_step();
+    if (update->ntimestep % end_of_step_every[i] == 0) {
+      detail_start();
+    fix[list_end_of_step[i]]->end_of_step();
+      detail_stop(list_end_of_step[i]);
+    }
 }
 
 /* ----------------------------------------------------------------------
@@ -553,9 +587,12 @@ void Modify::setup_pre_force_respa(int vflag, int ilevel)
 
 void Modify::initial_integrate_respa(int vflag, int ilevel, int iloop)
 {
-  for (int i = 0; i < n_initial_integrate_respa; i++)
+  for (int i = 0; i < n_initial_integrate_respa; i++) {
+    detail_start();
     fix[list_initial_integrate_respa[i]]->
       initial_integrate_respa(vflag,ilevel,iloop);
+    detail_stop(list_initial_integrate_respa[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -564,8 +601,11 @@ void Modify::initial_integrate_respa(int vflag, int ilevel, int iloop)
 
 void Modify::post_integrate_respa(int ilevel, int iloop)
 {
-  for (int i = 0; i < n_post_integrate_respa; i++)
+  for (int i = 0; i < n_post_integrate_respa; i++) {
+    detail_start();
     fix[list_post_integrate_respa[i]]->post_integrate_respa(ilevel,iloop);
+    detail_stop(list_post_integrate_respa[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -574,8 +614,11 @@ void Modify::post_integrate_respa(int ilevel, int iloop)
 
 void Modify::pre_force_respa(int vflag, int ilevel, int iloop)
 {
-  for (int i = 0; i < n_pre_force_respa; i++)
+  for (int i = 0; i < n_pre_force_respa; i++) {
+    detail_start();
     fix[list_pre_force_respa[i]]->pre_force_respa(vflag,ilevel,iloop);
+    detail_stop(list_pre_force_respa[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -584,8 +627,11 @@ void Modify::pre_force_respa(int vflag, int ilevel, int iloop)
 
 void Modify::post_force_respa(int vflag, int ilevel, int iloop)
 {
-  for (int i = 0; i < n_post_force_respa; i++)
+  for (int i = 0; i < n_post_force_respa; i++) {
+    detail_start();
     fix[list_post_force_respa[i]]->post_force_respa(vflag,ilevel,iloop);
+    detail_stop(list_post_force_respa[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -594,8 +640,11 @@ void Modify::post_force_respa(int vflag, int ilevel, int iloop)
 
 void Modify::final_integrate_respa(int ilevel, int iloop)
 {
-  for (int i = 0; i < n_final_integrate_respa; i++)
+  for (int i = 0; i < n_final_integrate_respa; i++) {
+    detail_start();
     fix[list_final_integrate_respa[i]]->final_integrate_respa(ilevel,iloop);
+    detail_stop(list_final_integrate_respa[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -604,8 +653,11 @@ void Modify::final_integrate_respa(int ilevel, int iloop)
 
 void Modify::min_pre_exchange()
 {
-  for (int i = 0; i < n_min_pre_exchange; i++)
+  for (int i = 0; i < n_min_pre_exchange; i++) {
+    detail_start();
     fix[list_min_pre_exchange[i]]->min_pre_exchange();
+    detail_stop(list_min_pre_exchange[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -614,8 +666,11 @@ void Modify::min_pre_exchange()
 
 void Modify::min_pre_neighbor()
 {
-  for (int i = 0; i < n_min_pre_neighbor; i++)
+  for (int i = 0; i < n_min_pre_neighbor; i++) {
+    detail_start();
     fix[list_min_pre_neighbor[i]]->min_pre_neighbor();
+    detail_stop(list_min_pre_neighbor[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -624,8 +679,11 @@ void Modify::min_pre_neighbor()
 
 void Modify::min_post_neighbor()
 {
-  for (int i = 0; i < n_min_post_neighbor; i++)
+  for (int i = 0; i < n_min_post_neighbor; i++) {
+    detail_start();
     fix[list_min_post_neighbor[i]]->min_post_neighbor();
+    detail_stop(list_min_post_neighbor[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -634,8 +692,11 @@ void Modify::min_post_neighbor()
 
 void Modify::min_pre_force(int vflag)
 {
-  for (int i = 0; i < n_min_pre_force; i++)
+  for (int i = 0; i < n_min_pre_force; i++) {
+    detail_start();
     fix[list_min_pre_force[i]]->min_pre_force(vflag);
+    detail_stop(list_min_pre_force[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -644,8 +705,11 @@ void Modify::min_pre_force(int vflag)
 
 void Modify::min_pre_reverse(int eflag, int vflag)
 {
-  for (int i = 0; i < n_min_pre_reverse; i++)
+  for (int i = 0; i < n_min_pre_reverse; i++) {
+    detail_start();
     fix[list_min_pre_reverse[i]]->min_pre_reverse(eflag,vflag);
+    detail_stop(list_min_pre_reverse[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -654,8 +718,11 @@ void Modify::min_pre_reverse(int eflag, int vflag)
 
 void Modify::min_post_force(int vflag)
 {
-  for (int i = 0; i < n_min_post_force; i++)
+  for (int i = 0; i < n_min_post_force; i++) {
+    detail_start();
     fix[list_min_post_force[i]]->min_post_force(vflag);
+    detail_stop(list_min_post_force[i]);
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -849,6 +916,7 @@ void Modify::add_fix(int narg, char **arg, int trysuffix)
       maxfix += DELTA;
       fix = (Fix **) memory->srealloc(fix,maxfix*sizeof(Fix *),"modify:fix");
       memory->grow(fmask,maxfix,"modify:fmask");
+      memory->grow(time_fix,maxfix,"modify:time_fix");
     }
   }
 
@@ -943,6 +1011,7 @@ void Modify::add_fix(int narg, char **arg, int trysuffix)
 
   if (newflag) nfix++;
   fmask[ifix] = fix[ifix]->setmask();
+  time_fix[ifix] = 0.0;
   fix[ifix]->post_constructor();
 }
 
@@ -995,6 +1064,7 @@ void Modify::delete_fix(int ifix)
 
   for (int i = ifix+1; i < nfix; i++) fix[i-1] = fix[i];
   for (int i = ifix+1; i < nfix; i++) fmask[i-1] = fmask[i];
+  for (int i = ifix+1; i < nfix; i++) time_fix[i-1] = time_fix[i];
   nfix--;
 }
 
@@ -1624,6 +1694,30 @@ void Modify::list_init_compute()
    return # of bytes of allocated memory from all fixes
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   zero per-fix timings at start of a run
+   flag = 1 if each fix invoked during the run is timed
+------------------------------------------------------------------------- */
+
+void Modify::reset_timing(int flag)
+{
+  detailflag = flag;
+  for (int i = 0; i < nfix; i++) time_fix[i] = 0.0;
+}
+
+/* ----------------------------------------------------------------------
+   add time since detail_start() to fix ifix, also to trace if requested
+------------------------------------------------------------------------- */
+
+void Modify::detail_add(int ifix)
+{
+  double now = MPI_Wtime();
+  time_fix[ifix] += now - detail_time;
+  timer->trace(Timer::FIX,ifix,detail_time,now);
+}
+
+/* ---------------------------------------------------------------------- */
+
 bigint Modify::memory_usage()
 {
   bigint bytes = 0;
@@ -44,6 +44,7 @@ class Modify : protected Pointers {
 
   class Fix **fix;           // list of fixes
   int *fmask;                // bit mask for when each fix is applied
+  double *time_fix;          // wall time in each fix during current run
 
   int ncompute,maxcompute;   // list of computes
   class Compute **compute;
@@ -120,10 +121,20 @@ class Modify : protected Pointers {
   int read_restart(FILE *);
   void restart_deallocate(int);
 
+  void reset_timing(int);
   bigint memory_usage();
 
  protected:
 
+  // per-fix timing of calls during a run, only if detailflag is set
+
+  int detailflag;
+  double detail_time;        // wall time when current fix call started
+
+  void detail_start() { if (detailflag) detail_time = MPI_Wtime(); }
+  void detail_stop(int ifix) { if (detailflag) detail_add(ifix); }
+  void detail_add(int);
+
   // lists of fixes to apply at different stages of timestep
 
   int *list_initial_integrate,*list_post_integrate;
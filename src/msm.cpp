@@ -1207,7 +1207,7 @@ void MSM::set_grid_local()
 
     double dist[3];
     double cuthalf = 0.0;
-    if (n == 0) cuthalf = 0.5*neighbor->skin; // only applies to finest grid
+    if (n == 0) cuthalf = 0.5*neighbor->skinmax; // only applies to finest grid
     dist[0] = dist[1] = dist[2] = cuthalf;
     if (triclinic) kspacebbox(cuthalf,&dist[0]);
 
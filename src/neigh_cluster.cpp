@@ -0,0 +1,556 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include <algorithm>
+#include "neigh_cluster.h"
+#include "atom.h"
+#include "domain.h"
+#include "neighbor.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+// BIG = coord of empty slots, far outside any cutoff
+// DELTA = increment for cluster pair and special pair lists
+
+#define BIG 1.0e20
+#define DELTA 16384
+
+namespace {
+
+// order atoms of one column along the sort dimension
+
+struct CoordLess {
+  double **x;
+  int dim;
+  CoordLess(double **_x, int _dim) : x(_x), dim(_dim) {}
+  bool operator()(int i, int j) const { return x[i][dim] < x[j][dim]; }
+};
+
+}
+
+/* ---------------------------------------------------------------------- */
+
+NeighCluster::NeighCluster(LAMMPS *lmp, int _qflag) : Pointers(lmp)
+{
+  qflag = _qflag;
+  newton = 1;
+
+  // lanemask[m][a] = 1.0 if bit a of m is set
+
+  for (int m = 0; m < (1 << CLUSTERSIZE); m++)
+    for (int a = 0; a < CLUSTERSIZE; a++)
+      lanemask[m][a] = (m & (1 << a)) ? 1.0 : 0.0;
+
+  nclocal = ncluster = 0;
+  npair = nspecial = 0;
+  maxcluster = maxpair = maxspecial = maxatom = maxcell = 0;
+
+  catom = ctype = NULL;
+  cx = cq = cf = cbox = NULL;
+  firstpair = numpair = NULL;
+  pairj = NULL;
+  pairmask = NULL;
+  special_i = special_j = NULL;
+  order = colcount = colfirst = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+NeighCluster::~NeighCluster()
+{
+  memory->destroy(catom);
+  memory->destroy(ctype);
+  memory->destroy(cx);
+  memory->destroy(cq);
+  memory->destroy(cf);
+  memory->destroy(cbox);
+  memory->destroy(firstpair);
+  memory->destroy(numpair);
+  memory->destroy(pairj);
+  memory->destroy(pairmask);
+  memory->destroy(special_i);
+  memory->destroy(special_j);
+  memory->destroy(order);
+  memory->destroy(colcount);
+  memory->destroy(colfirst);
+}
+
+/* ----------------------------------------------------------------------
+   group owned and ghost atoms into clusters and find all cluster pairs
+     of owned clusters within cutneigh
+   called on every reneighboring, after atoms have been sorted/exchanged
+------------------------------------------------------------------------- */
+
+void NeighCluster::build(double cutneigh, int _newton)
+{
+  newton = _newton;
+
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+
+  // each cluster holds at least one atom, so nall clusters always suffice
+
+  grow_clusters(nall);
+  if (nall > maxatom) {
+    maxatom = nall;
+    memory->destroy(order);
+    memory->create(order,maxatom,"neigh/cluster:order");
+  }
+
+  // cluster edge for roughly cubic clusters at the owned atom density
+  // columns are cut in x,y (x only in 2d) and sorted in z (y in 2d)
+
+  double *sublo = domain->sublo;
+  double *subhi = domain->subhi;
+  double vol = (subhi[0]-sublo[0]) * (subhi[1]-sublo[1]);
+  if (domain->dimension == 3) vol *= subhi[2]-sublo[2];
+
+  double side = cutneigh;
+  if (nlocal && vol > 0.0) {
+    if (domain->dimension == 3) side = cbrt(CLUSTERSIZE*vol/nlocal);
+    else side = sqrt(CLUSTERSIZE*vol/nlocal);
+  }
+
+  // owned atoms and ghost atoms go into separate clusters
+  // so the first nclocal clusters are the ones that receive forces
+
+  ncluster = 0;
+  cluster_atoms(0,nlocal,side);
+  nclocal = ncluster;
+  cluster_atoms(nlocal,nall,side);
+
+  find_pairs(cutneigh);
+  pack();
+}
+
+/* ----------------------------------------------------------------------
+   make clusters from atoms first to last-1
+   atoms are binned into columns of edge side, sorted along each column,
+     and consecutive runs of CLUSTERSIZE atoms form a cluster
+------------------------------------------------------------------------- */
+
+void NeighCluster::cluster_atoms(int first, int last, double side)
+{
+  int i,m,n,ix,iy,icol,ncol;
+  double lo[2],hi[2];
+
+  if (last == first) return;
+
+  double **x = atom->x;
+  int sortdim = (domain->dimension == 3) ? 2 : 1;
+
+  lo[0] = hi[0] = x[first][0];
+  lo[1] = hi[1] = x[first][1];
+  for (i = first+1; i < last; i++) {
+    lo[0] = MIN(lo[0],x[i][0]);
+    hi[0] = MAX(hi[0],x[i][0]);
+    lo[1] = MIN(lo[1],x[i][1]);
+    hi[1] = MAX(hi[1],x[i][1]);
+  }
+
+  int nx = static_cast<int> ((hi[0]-lo[0])/side) + 1;
+  int ny = 1;
+  if (sortdim == 2) ny = static_cast<int> ((hi[1]-lo[1])/side) + 1;
+  ncol = nx*ny;
+
+  if (ncol+1 > maxcell) {
+    maxcell = ncol+1;
+    memory->destroy(colcount);
+    memory->destroy(colfirst);
+    memory->create(colcount,maxcell,"neigh/cluster:colcount");
+    memory->create(colfirst,maxcell,"neigh/cluster:colfirst");
+  }
+
+  // counting sort of atoms by column
+
+  for (icol = 0; icol < ncol; icol++) colcount[icol] = 0;
+
+  for (i = first; i < last; i++) {
+    ix = MIN(static_cast<int> ((x[i][0]-lo[0])/side),nx-1);
+    iy = (ny > 1) ? MIN(static_cast<int> ((x[i][1]-lo[1])/side),ny-1) : 0;
+    colcount[iy*nx+ix]++;
+  }
+
+  colfirst[0] = 0;
+  for (icol = 0; icol < ncol; icol++) {
+    colfirst[icol+1] = colfirst[icol] + colcount[icol];
+    colcount[icol] = 0;
+  }
+
+  for (i = first; i < last; i++) {
+    ix = MIN(static_cast<int> ((x[i][0]-lo[0])/side),nx-1);
+    iy = (ny > 1) ? MIN(static_cast<int> ((x[i][1]-lo[1])/side),ny-1) : 0;
+    icol = iy*nx+ix;
+    order[colfirst[icol] + colcount[icol]++] = i;
+  }
+
+  // sort each column and cut it into clusters of up to CLUSTERSIZE atoms
+  // a cluster is also closed at a gap of more than 2*side along the column,
+  //   so columns through the ghost shell do not produce clusters that
+  //   span the whole sub-domain
+
+  CoordLess less(x,sortdim);
+  double extent = 2.0*side;
+
+  for (icol = 0; icol < ncol; icol++) {
+    n = colcount[icol];
+    if (n == 0) continue;
+    int *column = &order[colfirst[icol]];
+    std::sort(column,column+n,less);
+    m = 0;
+    for (i = 1; i <= n; i++)
+      if (i == n || i-m == CLUSTERSIZE ||
+          x[column[i]][sortdim] - x[column[m]][sortdim] > extent) {
+        add_cluster(&column[m],i-m);
+        m = i;
+      }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   append one cluster of n atoms, remaining slots are empty
+------------------------------------------------------------------------- */
+
+void NeighCluster::add_cluster(int *list, int n)
+{
+  int *type = atom->type;
+  int slot = ncluster*CLUSTERSIZE;
+  double *xc = &cx[3*slot];
+
+  for (int a = 0; a < CLUSTERSIZE; a++) {
+    if (a < n) {
+      catom[slot+a] = list[a];
+      ctype[slot+a] = type[list[a]];
+    } else {
+      catom[slot+a] = -1;
+      ctype[slot+a] = 0;
+      xc[a] = xc[CLUSTERSIZE+a] = xc[2*CLUSTERSIZE+a] = BIG;
+      if (qflag) cq[slot+a] = 0.0;
+    }
+  }
+
+  ncluster++;
+}
+
+/* ----------------------------------------------------------------------
+   find all cluster pairs of owned clusters with at least one atom pair
+     within cutneigh, using a grid of cutneigh cells over cluster centers
+   half list: each atom pair is stored once, in the lower of its two
+     clusters, pairs with ghost atoms follow the newton setting
+   pair masks follow the same exclusion and special rules as NPair styles
+------------------------------------------------------------------------- */
+
+void NeighCluster::find_pairs(double cutneigh)
+{
+  int a,b,c,i,j,ci,cj,m,which;
+  int jx,jy,jz,icell;
+  int jlo[3],jhi[3];
+  unsigned int mask;
+  double delx,dely,delz,rsq,d,dsq;
+  double *ibox,*jbox;
+
+  double **x = atom->x;
+  tagint *tag = atom->tag;
+  int nlocal = atom->nlocal;
+  int molecular = atom->molecular;
+  double cutneighsq = cutneigh*cutneigh;
+
+  npair = nspecial = 0;
+  if (nclocal == 0) return;
+
+  // bounding box of each cluster and largest half extent in each dim
+
+  double maxext[3],glo[3],ghi[3];
+  maxext[0] = maxext[1] = maxext[2] = 0.0;
+  glo[0] = glo[1] = glo[2] = BIG;
+  ghi[0] = ghi[1] = ghi[2] = -BIG;
+
+  for (c = 0; c < ncluster; c++) {
+    double *box = &cbox[6*c];
+    i = catom[c*CLUSTERSIZE];
+    for (m = 0; m < 3; m++) box[m] = box[3+m] = x[i][m];
+    for (a = 1; a < CLUSTERSIZE; a++) {
+      i = catom[c*CLUSTERSIZE+a];
+      if (i < 0) break;
+      for (m = 0; m < 3; m++) {
+        box[m] = MIN(box[m],x[i][m]);
+        box[3+m] = MAX(box[3+m],x[i][m]);
+      }
+    }
+    for (m = 0; m < 3; m++) {
+      maxext[m] = MAX(maxext[m],0.5*(box[3+m]-box[m]));
+      d = 0.5*(box[m]+box[3+m]);
+      glo[m] = MIN(glo[m],d);
+      ghi[m] = MAX(ghi[m],d);
+    }
+  }
+
+  // counting sort of clusters into cells by their center
+
+  int ncx = static_cast<int> ((ghi[0]-glo[0])/cutneigh) + 1;
+  int ncy = static_cast<int> ((ghi[1]-glo[1])/cutneigh) + 1;
+  int ncz = static_cast<int> ((ghi[2]-glo[2])/cutneigh) + 1;
+  int ncell = ncx*ncy*ncz;
+
+  if (ncell+1 > maxcell) {
+    maxcell = ncell+1;
+    memory->destroy(colcount);
+    memory->destroy(colfirst);
+    memory->create(colcount,maxcell,"neigh/cluster:colcount");
+    memory->create(colfirst,maxcell,"neigh/cluster:colfirst");
+  }
+
+  for (icell = 0; icell < ncell; icell++) colcount[icell] = 0;
+  for (c = 0; c < ncluster; c++) colcount[cell_index(c,glo,cutneigh,ncx,ncy,ncz)]++;
+
+  colfirst[0] = 0;
+  for (icell = 0; icell < ncell; icell++) {
+    colfirst[icell+1] = colfirst[icell] + colcount[icell];
+    colcount[icell] = 0;
+  }
+  for (c = 0; c < ncluster; c++) {
+    icell = cell_index(c,glo,cutneigh,ncx,ncy,ncz);
+    order[colfirst[icell] + colcount[icell]++] = c;
+  }
+
+  // the center of a J cluster within cutneigh of the I box lies
+  //   within cutneigh + maxext of that box in each dimension
+
+  int ncdim[3];
+  ncdim[0] = ncx;
+  ncdim[1] = ncy;
+  ncdim[2] = ncz;
+
+  for (ci = 0; ci < nclocal; ci++) {
+    firstpair[ci] = npair;
+    ibox = &cbox[6*ci];
+    for (c = 0; c < 3; c++) {
+      d = ibox[c] - cutneigh - maxext[c] - glo[c];
+      jlo[c] = (d > 0.0) ? static_cast<int> (d/cutneigh) : 0;
+      d = ibox[3+c] + cutneigh + maxext[c] - glo[c];
+      jhi[c] = (d > 0.0) ? MIN(static_cast<int> (d/cutneigh),ncdim[c]-1) : 0;
+    }
+
+    for (jz = jlo[2]; jz <= jhi[2]; jz++)
+      for (jy = jlo[1]; jy <= jhi[1]; jy++)
+        for (jx = jlo[0]; jx <= jhi[0]; jx++) {
+          icell = (jz*ncy + jy)*ncx + jx;
+          for (m = colfirst[icell]; m < colfirst[icell+1]; m++) {
+            cj = order[m];
+            if (cj < ci) continue;
+            jbox = &cbox[6*cj];
+
+            dsq = 0.0;
+            for (c = 0; c < 3; c++) {
+              d = MAX(jbox[c]-ibox[3+c],ibox[c]-jbox[3+c]);
+              if (d > 0.0) dsq += d*d;
+            }
+            if (dsq > cutneighsq) continue;
+
+            mask = 0;
+            for (a = 0; a < CLUSTERSIZE; a++) {
+              i = catom[ci*CLUSTERSIZE+a];
+              if (i < 0) break;
+              for (b = (cj == ci) ? a+1 : 0; b < CLUSTERSIZE; b++) {
+                j = catom[cj*CLUSTERSIZE+b];
+                if (j < 0) break;
+
+                // with newton on, a pair with a ghost atom is kept by
+                //   only one of the two procs, same rule as NPair styles
+
+                if (newton && j >= nlocal) {
+                  if (x[j][2] < x[i][2]) continue;
+                  if (x[j][2] == x[i][2]) {
+                    if (x[j][1] < x[i][1]) continue;
+                    if (x[j][1] == x[i][1] && x[j][0] < x[i][0]) continue;
+                  }
+                }
+
+                delx = x[i][0] - x[j][0];
+                dely = x[i][1] - x[j][1];
+                delz = x[i][2] - x[j][2];
+                rsq = delx*delx + dely*dely + delz*delz;
+                if (rsq > cutneighsq) continue;
+
+                if (molecular) {
+                  which = find_special(i,tag[j]);
+                  if (which == 0 || domain->minimum_image_check(delx,dely,delz))
+                    mask |= 1U << (b*CLUSTERSIZE+a);
+                  else if (which > 0) {
+                    if (nspecial == maxspecial) {
+                      maxspecial += DELTA;
+                      memory->grow(special_i,maxspecial,"neigh/cluster:special_i");
+                      memory->grow(special_j,maxspecial,"neigh/cluster:special_j");
+                    }
+                    special_i[nspecial] = i;
+                    special_j[nspecial++] = j ^ (which << SBBITS);
+                  }
+                } else mask |= 1U << (b*CLUSTERSIZE+a);
+              }
+            }
+
+            if (mask == 0) continue;
+            if (npair == maxpair) {
+              maxpair += DELTA;
+              memory->grow(pairj,maxpair,"neigh/cluster:pairj");
+              memory->grow(pairmask,maxpair,"neigh/cluster:pairmask");
+            }
+            pairj[npair] = cj;
+            pairmask[npair++] = mask;
+          }
+        }
+
+    numpair[ci] = npair - firstpair[ci];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   grid cell of the center of cluster c
+------------------------------------------------------------------------- */
+
+int NeighCluster::cell_index(int c, double *glo, double cell,
+                             int ncx, int ncy, int ncz)
+{
+  double *box = &cbox[6*c];
+  int ix = MIN(static_cast<int> ((0.5*(box[0]+box[3])-glo[0])/cell),ncx-1);
+  int iy = MIN(static_cast<int> ((0.5*(box[1]+box[4])-glo[1])/cell),ncy-1);
+  int iz = MIN(static_cast<int> ((0.5*(box[2]+box[5])-glo[2])/cell),ncz-1);
+  return (iz*ncy + iy)*ncx + ix;
+}
+
+/* ----------------------------------------------------------------------
+   special status of atom j (by tag) w.r.t. owned atom i
+   same return values as NPair::find_special()
+------------------------------------------------------------------------- */
+
+int NeighCluster::find_special(int i, tagint tagj)
+{
+  tagint *list = atom->special[i];
+  int *nspecial = atom->nspecial[i];
+  int *special_flag = neighbor->special_flag;
+
+  for (int m = 0; m < nspecial[2]; m++) {
+    if (list[m] == tagj) {
+      int level = (m < nspecial[0]) ? 1 : ((m < nspecial[1]) ? 2 : 3);
+      if (special_flag[level] == 0) return -1;
+      else if (special_flag[level] == 1) return 0;
+      else return level;
+    }
+  }
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+   copy current coords (and charges) of atoms into cluster slots
+   zero slot forces, of ghost clusters too if newton is set
+   called every timestep after forward communication
+------------------------------------------------------------------------- */
+
+void NeighCluster::pack()
+{
+  int a,i,slot;
+  double *xc;
+
+  double **x = atom->x;
+  double *q = atom->q;
+
+  for (int c = 0; c < ncluster; c++) {
+    slot = c*CLUSTERSIZE;
+    xc = &cx[3*slot];
+    for (a = 0; a < CLUSTERSIZE; a++) {
+      i = catom[slot+a];
+      if (i < 0) break;
+      xc[a] = x[i][0];
+      xc[CLUSTERSIZE+a] = x[i][1];
+      xc[2*CLUSTERSIZE+a] = x[i][2];
+      if (qflag) cq[slot+a] = q[i];
+    }
+  }
+
+  int nforce = newton ? ncluster : nclocal;
+  for (i = 0; i < 3*nforce*CLUSTERSIZE; i++) cf[i] = 0.0;
+}
+
+/* ----------------------------------------------------------------------
+   add forces accumulated on cluster slots to their atoms
+   ghost atoms receive forces only if newton is set
+------------------------------------------------------------------------- */
+
+void NeighCluster::unpack_forces()
+{
+  int a,i,slot;
+  double *fc;
+
+  double **f = atom->f;
+
+  int nforce = newton ? ncluster : nclocal;
+
+  for (int c = 0; c < nforce; c++) {
+    slot = c*CLUSTERSIZE;
+    fc = &cf[3*slot];
+    for (a = 0; a < CLUSTERSIZE; a++) {
+      i = catom[slot+a];
+      if (i < 0) break;
+      f[i][0] += fc[a];
+      f[i][1] += fc[CLUSTERSIZE+a];
+      f[i][2] += fc[2*CLUSTERSIZE+a];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   grow per-cluster arrays to hold n clusters
+------------------------------------------------------------------------- */
+
+void NeighCluster::grow_clusters(int n)
+{
+  if (n <= maxcluster) return;
+  maxcluster = n;
+
+  memory->destroy(catom);
+  memory->destroy(ctype);
+  memory->destroy(cx);
+  memory->destroy(cq);
+  memory->destroy(cf);
+  memory->destroy(cbox);
+  memory->destroy(firstpair);
+  memory->destroy(numpair);
+
+  memory->create(catom,maxcluster*CLUSTERSIZE,"neigh/cluster:catom");
+  memory->create(ctype,maxcluster*CLUSTERSIZE,"neigh/cluster:ctype");
+  memory->create(cx,3*maxcluster*CLUSTERSIZE,"neigh/cluster:cx");
+  if (qflag) memory->create(cq,maxcluster*CLUSTERSIZE,"neigh/cluster:cq");
+  memory->create(cf,3*maxcluster*CLUSTERSIZE,"neigh/cluster:cf");
+  memory->create(cbox,6*maxcluster,"neigh/cluster:cbox");
+  memory->create(firstpair,maxcluster,"neigh/cluster:firstpair");
+  memory->create(numpair,maxcluster,"neigh/cluster:numpair");
+}
+
+/* ---------------------------------------------------------------------- */
+
+double NeighCluster::memory_usage()
+{
+  double bytes = 0.0;
+  bytes += 2*maxcluster*CLUSTERSIZE * sizeof(int);
+  bytes += 6*maxcluster*CLUSTERSIZE * sizeof(double);
+  if (qflag) bytes += maxcluster*CLUSTERSIZE * sizeof(double);
+  bytes += 6*maxcluster * sizeof(double);
+  bytes += 2*maxcluster * sizeof(int);
+  bytes += maxpair * (sizeof(int) + sizeof(unsigned int));
+  bytes += 2*maxspecial * sizeof(int);
+  bytes += (maxatom + 2*maxcell) * sizeof(int);
+  return bytes;
+}
@@ -0,0 +1,96 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_NEIGH_CLUSTER_H
+#define LMP_NEIGH_CLUSTER_H
+
+#include "pointers.h"
+
+// CLUSTERSIZE = # of atom slots per cluster
+// a cluster pair mask has one bit per slot pair, so CLUSTERSIZE^2 <= 32
+
+#define CLUSTERSIZE 4
+
+// keep the I slot loop of cluster kernels rolled, so GCC vectorizes it
+//   across slots instead of fully unrolling it into scalar code
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) \
+  && (__GNUC__ >= 8)
+#define CLUSTER_SLOT_LOOP _Pragma("GCC unroll 1")
+#else
+#define CLUSTER_SLOT_LOOP
+#endif
+
+namespace LAMMPS_NS {
+
+class NeighCluster : protected Pointers {
+ public:
+  // clusters of owned atoms come first, then clusters of ghost atoms
+  // per-slot data is stored cluster by cluster, coords as x,y,z blocks
+
+  int nclocal;                  // # of clusters of owned atoms
+  int ncluster;                 // # of clusters of owned + ghost atoms
+  int *catom;                   // atom index of each slot, -1 if empty
+  int *ctype;                   // atom type of each slot, 0 if empty
+  double *cx;                   // coords of each slot
+  double *cq;                   // charge of each slot, if qflag set
+  double *cf;                   // force on each slot
+
+  // half list of cluster pairs of each owned cluster
+  // bit b*CLUSTERSIZE+a of a mask = slot a of I interacts with slot b of J
+  // lanemask expands the CLUSTERSIZE bits of one J slot into I slot weights
+
+  int *firstpair,*numpair;
+  int *pairj;                   // J cluster of each pair
+  unsigned int *pairmask;       // slot interaction mask of each pair
+  double lanemask[1 << CLUSTERSIZE][CLUSTERSIZE];
+
+  // atom pairs with special bond factors, left out of the pair masks
+  // J atoms carry the special bits as in a regular neighbor list
+
+  int nspecial;
+  int *special_i,*special_j;
+
+  NeighCluster(class LAMMPS *, int);
+  ~NeighCluster();
+  void build(double, int);
+  void pack();
+  void unpack_forces();
+  double memory_usage();
+
+ private:
+  int qflag;
+  int newton;                   // 1 if forces on ghost atoms are kept
+  int maxcluster,maxpair,maxspecial,maxatom,maxcell;
+  int npair;
+
+  double *cbox;                 // bounding box of each cluster, lo then hi
+  int *order;                   // atoms sorted by column, then clusters by cell
+  int *colcount;                // atoms per column, clusters per cell
+  int *colfirst;                // first atom of column, first cluster of cell
+
+  void grow_clusters(int);
+  void cluster_atoms(int, int, double);
+  void add_cluster(int *, int);
+  void find_pairs(double);
+  int cell_index(int, double *, double, int, int, int);
+  int find_special(int, tagint);
+};
+
+}
+
+#endif
+
+/* ERROR/WARNING messages:
+
+*/
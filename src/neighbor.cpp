@@ -43,6 +43,7 @@
 #include "update.h"
 #include "respa.h"
 #include "output.h"
+#include "timer.h"
 #include "citeme.h"
 #include "memory.h"
 #include "error.h"
@@ -57,6 +58,11 @@ using namespace NeighConst;
 
 #define BIG 1.0e20
 
+#define SKINWINDOW 10    // # of builds over which cost of a skin is measured
+#define SKINSAMPLE 50    // # of skin values tried by the cost model
+#define SKINSTEP 1.5     // max factor of skin change per window
+#define SKINGAIN 0.02    // min fraction of predicted cost saved by a change
+
 enum{NSQ,BIN,MULTI};     // also in NBin, NeighList, NStencil
 enum{NONE,ALL,PARTIAL,TEMPLATE};
 
@@ -94,6 +100,8 @@ pairclass(NULL), pairnames(NULL), pairmasks(NULL)
   binsizeflag = 0;
   build_once = 0;
   cluster_check = 0;
+  skinauto = 0;
+  skinmax = 0.0;
   ago = -1;
 
   cutneighmax = 0.0;
@@ -269,14 +277,34 @@ void Neighbor::init()
     bboxhi = domain->boxhi_bound;
   }
 
+  // adaptive skin starts from current skin, clipped to its bounds
+  // ghost cutoff and KSpace stencils are sized for the upper bound,
+  //   so the skin can change at any reneighboring during the run
+  // cost of a run is only measured with timer level normal or full
+
+  skinmax = skin;
+  skinadapt = 0;
+
+  if (skinauto) {
+    if (dist_check == 0 || build_once)
+      error->all(FLERR,"Neigh_modify skin/auto requires check yes and once no");
+    if (lmp->kokkos || modify->find_fix("package_gpu") >= 0 ||
+        modify->find_fix("package_intel") >= 0)
+      error->all(FLERR,"Neigh_modify skin/auto is not supported "
+                 "by accelerator neighbor lists");
+    skin = MAX(skinlo,MIN(skin,skinhi));
+    skinmax = skinhi;
+    if (timer->has_normal()) skinadapt = 1;
+    else if (me == 0)
+      error->warning(FLERR,"Neighbor skin is not adapted without timer "
+                     "normal or full");
+  }
+
   // set neighbor cutoffs (force cutoff + skin)
   // trigger determines when atoms migrate and neighbor lists are rebuilt
   //   needs to be non-zero for migration distance check
   //   even if pair = NULL and no neighbor lists are used
-  // cutneigh = force cutoff + skin if cutforce > 0, else cutneigh = 0
-  // cutneighghost = pair cutghost if it requests it, else same as cutneigh
 
-  triggersq = 0.25*skin*skin;
   boxcheck = 0;
   if (domain->box_change && (domain->xperiodic || domain->yperiodic ||
                              (dimension == 3 && domain->zperiodic)))
@@ -291,32 +319,7 @@ void Neighbor::init()
     cuttypesq = new double[n+1];
   }
 
-  double cutoff,delta,cut;
-  cutneighmin = BIG;
-  cutneighmax = 0.0;
-
-  for (i = 1; i <= n; i++) {
-    cuttype[i] = cuttypesq[i] = 0.0;
-    for (j = 1; j <= n; j++) {
-      if (force->pair) cutoff = sqrt(force->pair->cutsq[i][j]);
-      else cutoff = 0.0;
-      if (cutoff > 0.0) delta = skin;
-      else delta = 0.0;
-      cut = cutoff + delta;
-
-      cutneighsq[i][j] = cut*cut;
-      cuttype[i] = MAX(cuttype[i],cut);
-      cuttypesq[i] = MAX(cuttypesq[i],cut*cut);
-      cutneighmin = MIN(cutneighmin,cut);
-      cutneighmax = MAX(cutneighmax,cut);
-
-      if (force->pair && force->pair->ghostneigh) {
-        cut = force->pair->cutghost[i][j] + skin;
-        cutneighghostsq[i][j] = cut*cut;
-      } else cutneighghostsq[i][j] = cut*cut;
-    }
-  }
-  cutneighmaxsq = cutneighmax * cutneighmax;
+  set_cutneigh();
 
   // rRESPA cutoffs
 
@@ -326,6 +329,9 @@ void Neighbor::init()
     if (((Respa *) update->integrate)->level_middle >= 0) respa = 2;
   }
 
+  if (respa && skinauto)
+    error->all(FLERR,"Neigh_modify skin/auto cannot be used with rRESPA");
+
   if (respa) {
     double *cut_respa = ((Respa *) update->integrate)->cutoff;
     cut_inner_sq = (cut_respa[1] + skin) * (cut_respa[1] + skin);
@@ -509,6 +515,146 @@ void Neighbor::init()
   init_topology();
 }
 
+/* ----------------------------------------------------------------------
+   set neighbor cutoffs and trigger distance from current skin
+   cutneigh = force cutoff + skin if cutforce > 0, else cutneigh = 0
+   cutneighghost = pair cutghost if it requests it, else same as cutneigh
+   cutneighmin/max and cuttype use skinmax, they set ghost cutoff and bins
+------------------------------------------------------------------------- */
+
+void Neighbor::set_cutneigh()
+{
+  int n = atom->ntypes;
+  double cutoff,cut,cutmax;
+
+  triggersq = 0.25*skin*skin;
+
+  cutneighmin = BIG;
+  cutneighmax = 0.0;
+
+  for (int i = 1; i <= n; i++) {
+    cuttype[i] = cuttypesq[i] = 0.0;
+    for (int j = 1; j <= n; j++) {
+      if (force->pair) cutoff = sqrt(force->pair->cutsq[i][j]);
+      else cutoff = 0.0;
+      if (cutoff > 0.0) {
+        cut = cutoff + skin;
+        cutmax = cutoff + skinmax;
+      } else cut = cutmax = 0.0;
+
+      cutneighsq[i][j] = cut*cut;
+      cuttype[i] = MAX(cuttype[i],cutmax);
+      cuttypesq[i] = MAX(cuttypesq[i],cutmax*cutmax);
+      cutneighmin = MIN(cutneighmin,cutmax);
+      cutneighmax = MAX(cutneighmax,cutmax);
+
+      if (force->pair && force->pair->ghostneigh) {
+        cut = force->pair->cutghost[i][j] + skin;
+        cutneighghostsq[i][j] = cut*cut;
+      } else cutneighghostsq[i][j] = cut*cut;
+    }
+  }
+  cutneighmaxsq = cutneighmax * cutneighmax;
+}
+
+/* ----------------------------------------------------------------------
+   adapt skin to minimize pair + neighbor cost per timestep
+   called at start of each build, acts every SKINWINDOW builds
+   measured per window at current skin s0:
+     N0 = steps per build, tpair = Pair time per step,
+     tneigh = Neigh time per build, max over procs
+   model for skin s with rc = pair cutoff and d = dimension:
+     # of pairs in lists scales as g(s) = ((rc+s)/(rc+s0))^d
+     steps between builds scale as N(s) = N0 s/s0 (ballistic motion)
+     cost(s) = tpair g(s) + tneigh g(s) / N(s)
+   minimum is searched in [skinlo,skinhi] within SKINSTEP of s0,
+     with N(s) kept beyond the first allowed check at delay/every
+   any dangerous build in the window grows the skin instead
+------------------------------------------------------------------------- */
+
+void Neighbor::adapt_skin()
+{
+  bigint ntimestep = update->ntimestep;
+  double tpair = timer->get_wall(Timer::PAIR);
+  double tneigh = timer->get_wall(Timer::NEIGH);
+
+  // 1st build of a run opens the first window
+
+  if (ncalls == 1 || ntimestep <= skin_step) {
+    skin_step = ntimestep;
+    skin_ncalls = ncalls;
+    skin_ndanger = ndanger;
+    skin_pair = tpair;
+    skin_neigh = tneigh;
+    return;
+  }
+  if (ncalls - skin_ncalls < SKINWINDOW) return;
+
+  double nbuild = ncalls - skin_ncalls;
+  double nstep = ntimestep - skin_step;
+  double delta[2],deltamax[2];
+  delta[0] = tpair - skin_pair;
+  delta[1] = tneigh - skin_neigh;
+  MPI_Allreduce(delta,deltamax,2,MPI_DOUBLE,MPI_MAX,world);
+  bigint ndanger_window = ndanger - skin_ndanger;
+
+  skin_step = ntimestep;
+  skin_ncalls = ncalls;
+  skin_ndanger = ndanger;
+  skin_pair = tpair;
+  skin_neigh = tneigh;
+
+  double rc = force->pair ? force->pair->cutforce : 0.0;
+  if (rc <= 0.0 || skin <= 0.0) return;
+
+  double s0 = skin;
+  double snew = s0;
+
+  if (ndanger_window) snew = MIN(skinhi,s0*SKINSTEP);
+  else {
+    double n0 = nstep/nbuild;
+    double pcost = deltamax[0]/nstep;
+    double ncost = deltamax[1]/nbuild;
+    double nfirst = MAX(every,delay) + every;
+
+    double lo = MAX(skinlo,s0/SKINSTEP);
+    lo = MAX(lo,s0*nfirst/n0);
+    double hi = MIN(skinhi,s0*SKINSTEP);
+    if (lo > hi) lo = hi;
+
+    double s,g,cost;
+    double costmin = BIG;
+    double cost0 = pcost + ncost/n0;
+    for (int m = 0; m <= SKINSAMPLE; m++) {
+      s = lo + m*(hi-lo)/SKINSAMPLE;
+      g = (rc+s)/(rc+s0);
+      g = (dimension == 3) ? g*g*g : g*g;
+      cost = pcost*g + ncost*g * s0/(n0*s);
+      if (cost < costmin) {
+        costmin = cost;
+        snew = s;
+      }
+    }
+    if (costmin > (1.0-SKINGAIN)*cost0) snew = s0;
+  }
+
+  if (snew == s0) return;
+
+  skin = snew;
+  set_cutneigh();
+  for (int i = 0; i < nlist; i++)
+    if (neigh_pair[i]) neigh_pair[i]->copy_neighbor_info();
+
+  if (me == 0) {
+    if (screen)
+      fprintf(screen,"Neighbor skin adapted from %g to %g at step "
+              BIGINT_FORMAT "\n",s0,skin,ntimestep);
+    if (logfile)
+      fprintf(logfile,"Neighbor skin adapted from %g to %g at step "
+              BIGINT_FORMAT "\n",s0,skin,ntimestep);
+  }
+}
+
 /* ----------------------------------------------------------------------
    create and initialize lists of Nbin, Nstencil, NPair classes
    lists have info on all classes in 3 style*.h files
@@ -1614,9 +1760,7 @@ int Neighbor::choose_bin(NeighRequest *rq)
     if (!rq->kokkos_device != !(mask & NB_KOKKOS_DEVICE)) continue;
     if (!rq->kokkos_host != !(mask & NB_KOKKOS_HOST)) continue;
 
-    if (rq->CAC) {
-		  if (!(mask & NB_CAC)) continue;
-	  }
+    if (!rq->CAC != !(mask & NB_CAC)) continue;
 
     return i+1;
   }
@@ -1786,9 +1930,7 @@ int Neighbor::choose_pair(NeighRequest *rq)
       if (!(mask & NP_FULL)) continue;
     }
 
-	  if (rq->CAC) {
-		  if (!(mask & NP_CAC)) continue;
-	  }
+    if (!rq->CAC != !(mask & NP_CAC)) continue;
 
 
     // newtflag is on or off and must match
@@ -2027,6 +2169,8 @@ void Neighbor::build(int topoflag)
   ncalls++;
   lastcall = update->ntimestep;
 
+  if (skinadapt) adapt_skin();
+
   int nlocal = atom->nlocal;
   int nall = nlocal + atom->nghost;
 
@@ -2252,6 +2396,20 @@ void Neighbor::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) build_once = 0;
       else error->all(FLERR,"Illegal neigh_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"skin/auto") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"no") == 0) {
+        skinauto = 0;
+        iarg += 2;
+      } else {
+        if (iarg+3 > narg) error->all(FLERR,"Illegal neigh_modify command");
+        skinlo = force->numeric(FLERR,arg[iarg+1]);
+        skinhi = force->numeric(FLERR,arg[iarg+2]);
+        if (skinlo <= 0.0 || skinhi < skinlo)
+          error->all(FLERR,"Illegal neigh_modify command");
+        skinauto = 1;
+        iarg += 3;
+      }
     } else if (strcmp(arg[iarg],"page") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
       old_pgsize = pgsize;
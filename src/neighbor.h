@@ -32,6 +32,9 @@ class Neighbor : protected Pointers {
   int build_once;                  // 1 if only build lists once per run
 
   double skin;                     // skin distance
+  double skinmax;                  // max skin of a run, sets ghost cutoff
+  int skinauto;                    // 1 if skin is adapted during a run
+  double skinlo,skinhi;            // bounds on adapted skin
   double cutneighmin;              // min neighbor cutoff for all type pairs
   double cutneighmax;              // max neighbor cutoff for all type pairs
   double cutneighmaxsq;            // cutneighmax squared
@@ -152,6 +155,14 @@ class Neighbor : protected Pointers {
 
   double inner[2],middle[2];       // rRESPA cutoffs for extra lists
 
+  // adaptive skin, cost is measured over a window of builds
+
+  int skinadapt;                   // 1 if skin is adapted in this run
+  bigint skin_step;                // timestep at start of window
+  bigint skin_ncalls;              // # of builds at start of window
+  bigint skin_ndanger;             // # of dangerous builds at start of window
+  double skin_pair,skin_neigh;     // Pair and Neigh wall time at start
+
   int old_style,old_triclinic;     // previous run info
   int old_pgsize,old_oneatom;      // used to avoid re-creating neigh lists
 
@@ -201,6 +212,8 @@ class Neighbor : protected Pointers {
   // including creator methods for Nbin,Nstencil,Npair instances
 
   void init_styles();
+  void set_cutneigh();
+  void adapt_skin();
   int init_pair();
   virtual void init_topology();
 
@@ -299,6 +312,25 @@ E: Neighbor page size must be >= 10x the one atom setting
 
 This is required to prevent wasting too much memory.
 
+E: Neigh_modify skin/auto requires check yes and once no
+
+The skin is adapted from how often the distance check triggers a
+rebuild.
+
+E: Neigh_modify skin/auto is not supported by accelerator neighbor lists
+
+The KOKKOS, GPU, and USER-INTEL packages build their own neighbor
+lists from a fixed skin.
+
+W: Neighbor skin is not adapted without timer normal or full
+
+The pair and neighbor timers are needed to measure the cost of a
+skin.  The skin is kept fixed during the run.
+
+E: Neigh_modify skin/auto cannot be used with rRESPA
+
+The rRESPA inner and middle list cutoffs are set from a fixed skin.
+
 E: Invalid atom type in neighbor exclusion list
 
 Atom types must range from 1 to Ntypes inclusive.
@@ -30,6 +30,7 @@
 #include "force.h"
 #include "dump.h"
 #include "write_restart.h"
+#include "timer.h"
 #include "memory.h"
 #include "error.h"
 
@@ -81,6 +82,9 @@ Output::Output(LAMMPS *lmp) : Pointers(lmp)
   last_dump = NULL;
   var_dump = NULL;
   ivar_dump = NULL;
+  time_dump = NULL;
+  time_thermo = 0.0;
+  detailflag = 0;
   dump = NULL;
 
   restart_flag = restart_flag_single = restart_flag_double = 0;
@@ -115,6 +119,7 @@ Output::~Output()
   for (int i = 0; i < ndump; i++) delete [] var_dump[i];
   memory->sfree(var_dump);
   memory->destroy(ivar_dump);
+  memory->destroy(time_dump);
   for (int i = 0; i < ndump; i++) delete dump[i];
   memory->sfree(dump);
 
@@ -307,7 +312,13 @@ void Output::write(bigint ntimestep)
         if (dump[idump]->clearstep || every_dump[idump] == 0)
           modify->clearstep_compute();
         if (last_dump[idump] != ntimestep) {
-          dump[idump]->write();
+          if (detailflag) {
+            double start = MPI_Wtime();
+            dump[idump]->write();
+            double stop = MPI_Wtime();
+            time_dump[idump] += stop - start;
+            timer->trace(Timer::DUMP,idump,start,stop);
+          } else dump[idump]->write();
           last_dump[idump] = ntimestep;
         }
         if (every_dump[idump]) next_dump[idump] += every_dump[idump];
@@ -380,7 +391,15 @@ void Output::write(bigint ntimestep)
 
   if (next_thermo == ntimestep) {
     modify->clearstep_compute();
-    if (last_thermo != ntimestep) thermo->compute(1);
+    if (last_thermo != ntimestep) {
+      if (detailflag) {
+        double start = MPI_Wtime();
+        thermo->compute(1);
+        double stop = MPI_Wtime();
+        time_thermo += stop - start;
+        timer->trace(Timer::THERMO,0,start,stop);
+      } else thermo->compute(1);
+    }
     last_thermo = ntimestep;
     if (var_thermo) {
       next_thermo = static_cast<bigint>
@@ -571,6 +590,7 @@ void Output::add_dump(int narg, char **arg)
     var_dump = (char **)
       memory->srealloc(var_dump,max_dump*sizeof(char *),"output:var_dump");
     memory->grow(ivar_dump,max_dump,"output:ivar_dump");
+    memory->grow(time_dump,max_dump,"output:time_dump");
   }
 
   // initialize per-dump data to suitable default values
@@ -578,6 +598,7 @@ void Output::add_dump(int narg, char **arg)
   every_dump[ndump] = 0;
   last_dump[ndump] = -1;
   var_dump[ndump] = NULL;
+  time_dump[ndump] = 0.0;
   ivar_dump[ndump] = -1;
 
   // create the Dump
@@ -648,10 +669,23 @@ void Output::delete_dump(char *id)
     last_dump[i-1] = last_dump[i];
     var_dump[i-1] = var_dump[i];
     ivar_dump[i-1] = ivar_dump[i];
+    time_dump[i-1] = time_dump[i];
   }
   ndump--;
 }
 
+/* ----------------------------------------------------------------------
+   zero per-dump and thermo timings at start of a run
+   flag = 1 if each Dump and thermo output during the run is timed
+------------------------------------------------------------------------- */
+
+void Output::reset_timing(int flag)
+{
+  detailflag = flag;
+  for (int i = 0; i < ndump; i++) time_dump[i] = 0.0;
+  time_thermo = 0.0;
+}
+
 /* ----------------------------------------------------------------------
    find a dump by ID
    return index of dump or -1 if not found
@@ -40,6 +40,8 @@ class Output : protected Pointers {
   char **var_dump;             // variable name for dump frequency
   int *ivar_dump;              // variable index for dump frequency
   class Dump **dump;           // list of defined Dumps
+  double *time_dump;           // wall time in each Dump during current run
+  double time_thermo;          // wall time in thermo output during run
 
   int restart_flag;            // 1 if any restart files are written
   int restart_flag_single;     // 1 if single restart files are written
@@ -83,8 +85,11 @@ class Output : protected Pointers {
   void create_restart(int, char **); // create Restart and restart files
 
   void memory_usage();               // print out memory usage
+  void reset_timing(int);            // zero per-dump timings
 
  private:
+  int detailflag;              // 1 if each Dump and thermo output is timed
+
   template <typename T> static Dump *dump_creator(LAMMPS *, int, char **);
 };
 
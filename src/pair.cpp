@@ -62,6 +62,7 @@ Pair::Pair(LAMMPS *lmp) : Pointers(lmp)
   single_enable = 1;
   restartinfo = 1;
   respa_enable = 0;
+  overlap_enable = 0;
   one_coeff = 0;
   no_virial_fdotr_compute = 0;
   writedata = 0;
@@ -97,6 +98,10 @@ Pair::Pair(LAMMPS *lmp) : Pointers(lmp)
   eatom = NULL;
   vatom = NULL;
 
+  numneigh_interior = NULL;
+  maxinterior = 0;
+  split_ncalls = -1;
+
   num_tally_compute = 0;
   list_tally_compute = NULL;
 
@@ -121,6 +126,7 @@ Pair::~Pair()
 
   memory->destroy(eatom);
   memory->destroy(vatom);
+  memory->destroy(numneigh_interior);
 }
 
 /* ----------------------------------------------------------------------
@@ -1542,6 +1548,51 @@ void Pair::virial_fdotr_compute()
   vflag_fdotr = 0;
 }
 
+/* ----------------------------------------------------------------------
+   reorder each neighbor row of the pair list in place so that owned
+   neighbors come before ghost neighbors
+   numneigh_interior[i] = # of owned neighbors of atom I
+   compute_interior() can then run while ghost coords are in flight
+   only redone after the neighbor list has been rebuilt
+------------------------------------------------------------------------- */
+
+void Pair::split_neighbor_list()
+{
+  if (split_ncalls == neighbor->ncalls) return;
+  split_ncalls = neighbor->ncalls;
+
+  if (atom->nmax > maxinterior) {
+    maxinterior = atom->nmax;
+    memory->destroy(numneigh_interior);
+    memory->create(numneigh_interior,maxinterior,"pair:numneigh_interior");
+  }
+
+  int i,j,ii,jj,jnum,ninterior;
+  int *jlist;
+
+  int nlocal = atom->nlocal;
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+    ninterior = 0;
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      if ((j & NEIGHMASK) < nlocal) {
+        jlist[jj] = jlist[ninterior];
+        jlist[ninterior++] = j;
+      }
+    }
+    numneigh_interior[i] = ninterior;
+  }
+}
+
 /* ----------------------------------------------------------------------
    write a table of pair potential energy/force vs distance to a file
 ------------------------------------------------------------------------- */
@@ -1728,6 +1779,7 @@ double Pair::memory_usage()
 {
   double bytes = comm->nthreads*maxeatom * sizeof(double);
   bytes += comm->nthreads*maxvatom*6 * sizeof(double);
+  bytes += maxinterior * sizeof(int);
   return bytes;
 }
 
@@ -48,6 +48,7 @@ class Pair : protected Pointers {
   int single_enable;             // 1 if single() routine exists
   int restartinfo;               // 1 if pair style writes restart info
   int respa_enable;              // 1 if inner/middle/outer rRESPA routines
+  int overlap_enable;            // 1 if interior/boundary split routines
   int one_coeff;                 // 1 if allows only one coeff * * call
   int manybody_flag;             // 1 if a manybody potential
   int no_virial_fdotr_compute;   // 1 if does not invoke virial_fdotr_compute()
@@ -153,6 +154,8 @@ class Pair : protected Pointers {
   virtual void compute_inner() {}
   virtual void compute_middle() {}
   virtual void compute_outer(int, int) {}
+  virtual void compute_interior(int, int) {}
+  virtual void compute_boundary(int, int) {}
 
   virtual double single(int, int, int, int,
                         double, double, double,
@@ -250,6 +253,13 @@ class Pair : protected Pointers {
                       double, double, double, double, double, double);
   void virial_fdotr_compute();
 
+  // split of the neighbor list for compute_interior()/compute_boundary()
+
+  int *numneigh_interior;        // # of owned neighbors, stored first per row
+  int maxinterior;
+  bigint split_ncalls;           // neighbor build the split was done for
+  void split_neighbor_list();
+
   // union data struct for packing 32-bit and 64-bit ints into double bufs
   // see atom_vec.h for documentation
 
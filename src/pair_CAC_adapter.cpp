@@ -0,0 +1,437 @@
+/* ----------------------------------------------------------------------
+ LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+ http://lammps.sandia.gov, Sandia National Laboratories
+ Steve Plimpton, sjplimp@sandia.gov
+
+ Copyright (2003) Sandia Corporation.  Under the terms of Contract
+ DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+ certain rights in this software.  This software is distributed under
+ the GNU General Public License.
+
+ See the README file in the top-level LAMMPS directory.
+ ------------------------------------------------------------------------- */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pair_CAC_adapter.h"
+#include "atom.h"
+#include "force.h"
+#include "comm.h"
+#include "neighbor.h"
+#include "neigh_list.h"
+#include "update.h"
+#include "memory.h"
+#include "error.h"
+
+#define MAXNEIGH1  110
+#define MAXNEIGH2  10
+#define DELTA 64
+
+using namespace LAMMPS_NS;
+
+/* ----------------------------------------------------------------------
+ CAC/adapter evaluates an existing atomistic pair style on the virtual
+ neighborhood of each quadrature point. The quadrature point and its
+ virtual neighbors are gathered into a small atom buffer with its own
+ neighbor list, the buffer is swapped into Atom for the duration of the
+ sub-style compute(), and the force on slot 0 is the force density.
+ ------------------------------------------------------------------------- */
+
+PairCACAdapter::PairCACAdapter(LAMMPS *lmp) : PairCAC(lmp)
+{
+  restartinfo = 0;
+  one_coeff = 1;
+  manybody_flag = 1;
+  outer_neighflag = 0;
+  nmax = 0;
+
+  substyle = NULL;
+  substyle_name = NULL;
+  vlist = NULL;
+
+  nvirtual = maxvirtual = 0;
+  vx = vf = NULL;
+  vtype = NULL;
+  vtag = NULL;
+  vilist = vnumneigh = NULL;
+  vfirstneigh = NULL;
+  vneighs = NULL;
+  maxvneighs = 0;
+  cutsq_virtual = 0.0;
+
+  interior_scales = NULL;
+  surface_counts = NULL;
+
+  surface_counts_max[0] = 0;
+  surface_counts_max[1] = 0;
+  surface_counts_max[2] = 0;
+  surface_counts_max_old[0] = 0;
+  surface_counts_max_old[1] = 0;
+  surface_counts_max_old[2] = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairCACAdapter::~PairCACAdapter()
+{
+  delete substyle;
+  delete [] substyle_name;
+
+  // the virtual list does not own its arrays
+
+  delete vlist;
+
+  memory->destroy(vx);
+  memory->destroy(vf);
+  memory->destroy(vtype);
+  memory->destroy(vtag);
+  memory->destroy(vilist);
+  memory->destroy(vnumneigh);
+  memory->sfree(vfirstneigh);
+  memory->destroy(vneighs);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairCACAdapter::allocate()
+{
+  allocated = 1;
+  int n = atom->ntypes;
+  max_nodes_per_element = atom->nodes_per_element;
+
+  memory->create(setflag, n + 1, n + 1, "pair:setflag");
+  memory->create(cutsq, n + 1, n + 1, "pair:cutsq");
+
+  memory->create(mass_matrix,max_nodes_per_element, max_nodes_per_element,"pairCAC:mass_matrix");
+  memory->create(mass_copy, max_nodes_per_element, max_nodes_per_element,"pairCAC:copy_mass_matrix");
+  memory->create(force_column, max_nodes_per_element,3,"pairCAC:force_residue");
+  memory->create(current_force_column, max_nodes_per_element,"pairCAC:current_force_residue");
+  memory->create(current_nodal_forces, max_nodes_per_element,"pairCAC:current_nodal_force");
+  memory->create(pivot, max_nodes_per_element+1,"pairCAC:pivots");
+  memory->create(surf_set, 6, 2, "pairCAC:surf_set");
+  memory->create(dof_set, 6, 4, "pairCAC:surf_set");
+  memory->create(sort_surf_set, 6, 2, "pairCAC:surf_set");
+  memory->create(sort_dof_set, 6, 4, "pairCAC:surf_set");
+  quadrature_init(2);
+}
+
+/* ----------------------------------------------------------------------
+ global settings
+ pair_style CAC/adapter substyle [substyle args] [skin value] [one]
+ ------------------------------------------------------------------------- */
+
+void PairCACAdapter::settings(int narg, char **arg)
+{
+  if (narg < 1) error->all(FLERR, "Illegal pair_style command");
+
+  // trailing CAC keywords
+
+  int nsub = narg;
+  if (strcmp(arg[nsub-1], "one") == 0) {
+    atom->one_layer_flag = one_layer_flag = 1;
+    nsub--;
+  }
+  if (nsub >= 3 && strcmp(arg[nsub-2], "skin") == 0) {
+    cutoff_skin = force->numeric(FLERR, arg[nsub-1]);
+    nsub -= 2;
+  }
+  if (nsub < 1) error->all(FLERR, "Illegal pair_style command");
+
+  if (strncmp(arg[0], "CAC", 3) == 0 || strncmp(arg[0], "hybrid", 6) == 0)
+    error->all(FLERR, "Pair style CAC/adapter cannot wrap a CAC or hybrid pair style");
+
+  delete substyle;
+  delete [] substyle_name;
+
+  int dummy;
+  substyle = force->new_pair(arg[0], 1, dummy);
+  substyle_name = new char[strlen(arg[0]) + 1];
+  strcpy(substyle_name, arg[0]);
+
+  if (substyle->comm_forward || substyle->comm_reverse ||
+      substyle->comm_reverse_off)
+    error->all(FLERR, "Pair style CAC/adapter cannot wrap pair styles that communicate");
+
+  substyle->settings(nsub - 1, &arg[1]);
+
+  // many-body sub-styles need the neighbors of every neighbor of the
+  // quadrature point, pairwise ones only the neighbors of the point itself
+
+  outer_neighflag = substyle->manybody_flag;
+
+  // the CAC force passes are done without newton pair
+
+  force->newton_pair = 0;
+}
+
+/* ----------------------------------------------------------------------
+ set coeffs for one or more type pairs; forwarded to the sub-style
+ ------------------------------------------------------------------------- */
+
+void PairCACAdapter::coeff(int narg, char **arg)
+{
+  if (substyle == NULL)
+    error->all(FLERR, "Pair coeff for CAC/adapter requires a pair_style sub-style");
+  if (!allocated) allocate();
+
+  substyle->coeff(narg, arg);
+
+  int n = atom->ntypes;
+  int count = 0;
+  for (int i = 1; i <= n; i++)
+    for (int j = i; j <= n; j++) {
+      setflag[i][j] = substyle->setflag[i][j];
+      if (setflag[i][j]) count++;
+    }
+
+  if (count == 0) error->all(FLERR, "Incorrect args for pair coefficients");
+}
+
+/* ----------------------------------------------------------------------
+ init for one type pair i,j and corresponding j,i
+ ------------------------------------------------------------------------- */
+
+double PairCACAdapter::init_one(int i, int j)
+{
+  // mimic Pair::init() for the sub-style, which is never init()ed itself
+  // so that it does not request a neighbor list of its own
+
+  double cut = substyle->init_one(i, j);
+  substyle->cutsq[i][j] = substyle->cutsq[j][i] = cut*cut;
+  if (cut > substyle->cutforce) substyle->cutforce = cut;
+  if (cut > cut_global_s) cut_global_s = cut;
+  cutsq_virtual = cut_global_s*cut_global_s;
+
+  atom->scale_search_range[0] = atom->CAC_cut = cut_global_s + cutoff_skin;
+  if (outer_neighflag) atom->scale_search_range[0] = atom->CAC_cut = 2 * cut_global_s + cutoff_skin;
+
+  for (int k = 0; k <= atom->scale_count; k++) {
+    if (atom->scale_search_range[k] > atom->max_search_range) atom->max_search_range = atom->scale_search_range[k];
+  }
+
+  atom->CAC_skin = cutoff_skin;
+
+  MPI_Allreduce(&atom->scale_count, &atom->scale_count, 1, MPI_INT, MPI_MAX, world);
+  MPI_Allreduce(&atom->max_search_range, &atom->max_search_range, 1, MPI_DOUBLE, MPI_MAX, world);
+  return atom->max_search_range;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairCACAdapter::init_style()
+{
+  if (atom->tag_enable == 0)
+    error->all(FLERR, "Pair style CAC/adapter requires atom IDs");
+
+  // let the sub-style run its own setup, then drop the neighbor list it
+  // requested since it is handed the virtual list instead; newton pair is
+  // switched on so styles that insist on it accept the setup
+
+  int nrequest_hold = neighbor->nrequest;
+  int newton_pair_hold = force->newton_pair;
+  force->newton_pair = 1;
+  substyle->init_style();
+  force->newton_pair = newton_pair_hold;
+  while (neighbor->nrequest > nrequest_hold)
+    delete neighbor->requests[--neighbor->nrequest];
+
+  PairCAC::init_style();
+  maxneigh_quad_inner = MAXNEIGH2;
+  maxneigh_quad_outer = MAXNEIGH1;
+
+  for (int si = 0; si < 6; si++) {
+    sort_dof_set[si][0] = dof_set[si][0];
+    sort_dof_set[si][1] = dof_set[si][1];
+    sort_dof_set[si][2] = dof_set[si][2];
+    sort_dof_set[si][3] = dof_set[si][3];
+    sort_surf_set[si][0] = surf_set[si][0];
+    sort_surf_set[si][1] = surf_set[si][1];
+  }
+
+  cut_global_s = 0.0;
+  substyle->cutforce = 0.0;
+
+  if (vlist == NULL) {
+    vlist = new NeighList(lmp);
+    vlist->copy = 1;
+  }
+  substyle->init_list(0, vlist);
+}
+
+/* ----------------------------------------------------------------------
+ grow the virtual atom buffer to hold n atoms
+ ------------------------------------------------------------------------- */
+
+void PairCACAdapter::grow_virtual(int n)
+{
+  if (n <= maxvirtual) return;
+  maxvirtual = n + DELTA;
+  memory->grow(vx, maxvirtual, 3, "pair_CAC_adapter:vx");
+  memory->grow(vf, maxvirtual, 3, "pair_CAC_adapter:vf");
+  memory->grow(vtype, maxvirtual, "pair_CAC_adapter:vtype");
+  memory->grow(vtag, maxvirtual, "pair_CAC_adapter:vtag");
+  memory->grow(vilist, maxvirtual, "pair_CAC_adapter:vilist");
+  memory->grow(vnumneigh, maxvirtual, "pair_CAC_adapter:vnumneigh");
+  vfirstneigh = (int **)
+    memory->srealloc(vfirstneigh, maxvirtual*sizeof(int *), "pair_CAC_adapter:vfirstneigh");
+  for (int i = 0; i < maxvirtual; i++) vtag[i] = i + 1;
+}
+
+/* ----------------------------------------------------------------------
+ full neighbor list of the first ni buffer atoms over the whole buffer
+ ------------------------------------------------------------------------- */
+
+void PairCACAdapter::build_virtual_list(int ni)
+{
+  if ((bigint) ni*nvirtual > maxvneighs) {
+    maxvneighs = ni*nvirtual;
+    memory->destroy(vneighs);
+    memory->create(vneighs, maxvneighs, "pair_CAC_adapter:vneighs");
+  }
+
+  int *neighptr = vneighs;
+  for (int i = 0; i < ni; i++) {
+    double xtmp = vx[i][0];
+    double ytmp = vx[i][1];
+    double ztmp = vx[i][2];
+    int n = 0;
+    for (int j = 0; j < nvirtual; j++) {
+      if (j == i) continue;
+      double delx = xtmp - vx[j][0];
+      double dely = ytmp - vx[j][1];
+      double delz = ztmp - vx[j][2];
+      if (delx*delx + dely*dely + delz*delz < cutsq_virtual) neighptr[n++] = j;
+    }
+    vilist[i] = i;
+    vnumneigh[i] = n;
+    vfirstneigh[i] = neighptr;
+    neighptr += n;
+  }
+
+  vlist->inum = ni;
+  vlist->gnum = 0;
+  vlist->ilist = vilist;
+  vlist->numneigh = vnumneigh;
+  vlist->firstneigh = vfirstneigh;
+}
+
+//-----------------------------------------------------------------------
+
+void PairCACAdapter::force_densities(int iii, double s, double t, double w, double coefficients,
+	double &force_densityx, double &force_densityy, double &force_densityz)
+{
+  double shape_func;
+  double current_position[3];
+  double scanning_unit_cell[3];
+  int nodes_per_element;
+  int *nodes_count_list = atom->nodes_per_element_list;
+  int listindex, poly_index, element_index;
+  int **node_types = atom->node_types;
+
+  current_position[0] = 0;
+  current_position[1] = 0;
+  current_position[2] = 0;
+
+  if (!atomic_flag) {
+    nodes_per_element = nodes_count_list[current_element_type];
+    for (int kkk = 0; kkk < nodes_per_element; kkk++) {
+      shape_func = shape_function(s, t, w, 2, kkk + 1);
+      current_position[0] += current_nodal_positions[kkk][poly_counter][0] * shape_func;
+      current_position[1] += current_nodal_positions[kkk][poly_counter][1] * shape_func;
+      current_position[2] += current_nodal_positions[kkk][poly_counter][2] * shape_func;
+    }
+  }
+  else {
+    current_position[0] = s;
+    current_position[1] = t;
+    current_position[2] = w;
+  }
+
+  int neigh_max_inner = inner_quad_lists_counts[iii][neigh_quad_counter];
+  int neigh_max_outer = 0;
+  if (outer_neighflag) neigh_max_outer = outer_quad_lists_counts[iii][neigh_quad_counter];
+
+  // gather the virtual neighborhood into the buffer
+
+  nvirtual = 1 + neigh_max_inner + neigh_max_outer;
+  grow_virtual(nvirtual);
+
+  vx[0][0] = current_position[0];
+  vx[0][1] = current_position[1];
+  vx[0][2] = current_position[2];
+  vtype[0] = type_array[poly_counter];
+
+  int m = 1;
+  for (int l = 0; l < neigh_max_inner; l++) {
+    scanning_unit_cell[0] = inner_quad_lists_ucell[iii][neigh_quad_counter][l][0];
+    scanning_unit_cell[1] = inner_quad_lists_ucell[iii][neigh_quad_counter][l][1];
+    scanning_unit_cell[2] = inner_quad_lists_ucell[iii][neigh_quad_counter][l][2];
+    listindex = inner_quad_lists_index[iii][neigh_quad_counter][l][0];
+    poly_index = inner_quad_lists_index[iii][neigh_quad_counter][l][1];
+    element_index = listindex;
+    element_index &= NEIGHMASK;
+    vtype[m] = node_types[element_index][poly_index];
+    neigh_list_cord(vx[m][0], vx[m][1], vx[m][2], element_index, poly_index,
+      scanning_unit_cell[0], scanning_unit_cell[1], scanning_unit_cell[2]);
+    m++;
+  }
+  for (int l = 0; l < neigh_max_outer; l++) {
+    scanning_unit_cell[0] = outer_quad_lists_ucell[iii][neigh_quad_counter][l][0];
+    scanning_unit_cell[1] = outer_quad_lists_ucell[iii][neigh_quad_counter][l][1];
+    scanning_unit_cell[2] = outer_quad_lists_ucell[iii][neigh_quad_counter][l][2];
+    listindex = outer_quad_lists_index[iii][neigh_quad_counter][l][0];
+    poly_index = outer_quad_lists_index[iii][neigh_quad_counter][l][1];
+    element_index = listindex;
+    element_index &= NEIGHMASK;
+    vtype[m] = node_types[element_index][poly_index];
+    neigh_list_cord(vx[m][0], vx[m][1], vx[m][2], element_index, poly_index,
+      scanning_unit_cell[0], scanning_unit_cell[1], scanning_unit_cell[2]);
+    m++;
+  }
+
+  for (int i = 0; i < nvirtual; i++)
+    vf[i][0] = vf[i][1] = vf[i][2] = 0.0;
+
+  // pairwise styles only need the quadrature point as an I atom;
+  // many-body styles also need every inner neighbor, since terms centered
+  // on those neighbors depend on the position of the quadrature point
+
+  if (outer_neighflag) build_virtual_list(1 + neigh_max_inner);
+  else build_virtual_list(1);
+
+  // swap the buffer into Atom, run the sub-style kernel, restore
+
+  double **x_hold = atom->x;
+  double **f_hold = atom->f;
+  int *type_hold = atom->type;
+  tagint *tag_hold = atom->tag;
+  int nlocal_hold = atom->nlocal;
+  int nghost_hold = atom->nghost;
+  int nmax_hold = atom->nmax;
+
+  atom->x = vx;
+  atom->f = vf;
+  atom->type = vtype;
+  atom->tag = vtag;
+  atom->nlocal = nvirtual;
+  atom->nghost = 0;
+  if (maxvirtual > atom->nmax) atom->nmax = maxvirtual;
+
+  // per-atom energy of slot 0 is the quadrature point energy
+
+  substyle->compute(quad_eflag ? 2 : 0, 0);
+
+  atom->x = x_hold;
+  atom->f = f_hold;
+  atom->type = type_hold;
+  atom->tag = tag_hold;
+  atom->nlocal = nlocal_hold;
+  atom->nghost = nghost_hold;
+  atom->nmax = nmax_hold;
+
+  force_densityx += vf[0][0];
+  force_densityy += vf[0][1];
+  force_densityz += vf[0][2];
+  if (quad_eflag) quadrature_energy += substyle->eatom[0];
+}
@@ -0,0 +1,67 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(CAC/adapter,PairCACAdapter)
+
+#else
+
+#ifndef LMP_PAIR_ADAPTER_CAC_H
+#define LMP_PAIR_ADAPTER_CAC_H
+
+#include "pair.h"
+#include "pair_CAC.h"
+
+namespace LAMMPS_NS {
+
+class PairCACAdapter : public PairCAC {
+ public:
+  PairCACAdapter(class LAMMPS *);
+  virtual ~PairCACAdapter();
+
+  void settings(int, char **);
+  void coeff(int, char **);
+  virtual void init_style();
+  virtual double init_one(int, int);
+
+ protected:
+  class Pair *substyle;         // atomistic pair style evaluated on the buffer
+  char *substyle_name;
+  class NeighList *vlist;       // neighbor list of the virtual atom buffer
+
+  // virtual atom buffer; slot 0 is the quadrature point,
+  // then the inner and (for many-body styles) outer neighbors
+
+  int nvirtual, maxvirtual;
+  double **vx, **vf;
+  int *vtype;
+  tagint *vtag;
+  int *vilist, *vnumneigh, **vfirstneigh;
+  int *vneighs;
+  int maxvneighs;
+  double cutsq_virtual;
+
+  void allocate();
+  void grow_virtual(int);
+  void build_virtual_list(int);
+
+  void force_densities(int, double, double, double, double, double
+	  &fx, double &fy, double &fz);
+};
+
+}
+
+#endif
+#endif
+
@@ -66,6 +66,18 @@ PairCACSW::PairCACSW(LAMMPS *lmp) : PairCAC(lmp)
   outer_neighbor_coords = NULL;
   inner_neighbor_types = NULL;
   outer_neighbor_types = NULL;
+  inner_neighbor_params = NULL;
+  outer_neighbor_params = NULL;
+  short_index = NULL;
+  short_delr = NULL;
+  short_r = NULL;
+  short_rinvsq = NULL;
+  short_gsrainvsq = NULL;
+  short_expgsrainv = NULL;
+  leg_delr = NULL;
+  leg_rsq = NULL;
+  leg_types = NULL;
+  nmax_inner_sw = nmax_outer_sw = nmax_leg_sw = 0;
   interior_scales = NULL;
   surface_counts = NULL;
 
@@ -99,6 +111,17 @@ PairCACSW::~PairCACSW() {
 	memory->destroy(outer_neighbor_coords);
 	memory->destroy(inner_neighbor_types);
 	memory->destroy(outer_neighbor_types);
+	memory->destroy(inner_neighbor_params);
+	memory->destroy(outer_neighbor_params);
+	memory->destroy(short_index);
+	memory->destroy(short_delr);
+	memory->destroy(short_r);
+	memory->destroy(short_rinvsq);
+	memory->destroy(short_gsrainvsq);
+	memory->destroy(short_expgsrainv);
+	memory->destroy(leg_delr);
+	memory->destroy(leg_rsq);
+	memory->destroy(leg_types);
 
    
     memory->destroy(mass_matrix);
@@ -610,6 +633,65 @@ void PairCACSW::threebody(Param *paramij, Param *paramik, Param *paramijk,
 }
 
 
+/* ----------------------------------------------------------------------
+ distance dependent factors of one three body leg, computed once per leg
+ and reused by every triplet that shares it
+ ------------------------------------------------------------------------- */
+
+void PairCACSW::leg_setup(Param *param, double rsq, double &r, double &rinvsq,
+	double &gsrainvsq, double &expgsrainv)
+{
+	double rainv, gsrainv;
+
+	r = sqrt(rsq);
+	rinvsq = 1.0 / rsq;
+	rainv = 1.0 / (r - param->cut);
+	gsrainv = param->sigma_gamma * rainv;
+	gsrainvsq = gsrainv*rainv / r;
+	expgsrainv = exp(gsrainv);
+}
+
+/* ----------------------------------------------------------------------
+ same as threebody() but with both legs precomputed by leg_setup();
+ fk may be NULL when only the force on j is needed
+ ------------------------------------------------------------------------- */
+
+void PairCACSW::threebody_legs(Param *paramijk, double *delr1, double *delr2,
+	double r1, double rinvsq1, double gsrainvsq1, double expgsrainv1,
+	double r2, double rinvsq2, double gsrainvsq2, double expgsrainv2,
+	double *fj, double *fk)
+{
+	double rinv12, cs, delcs, delcssq, facexp, facrad, frad1, frad2;
+	double facang, facang12, csfacang, csfac1, csfac2;
+
+	rinv12 = 1.0 / (r1*r2);
+	cs = (delr1[0] * delr2[0] + delr1[1] * delr2[1] + delr1[2] * delr2[2]) * rinv12;
+	delcs = cs - paramijk->costheta;
+	delcssq = delcs*delcs;
+
+	facexp = expgsrainv1*expgsrainv2;
+
+	facrad = paramijk->lambda_epsilon * facexp*delcssq;
+	frad1 = facrad*gsrainvsq1;
+	facang = paramijk->lambda_epsilon2 * facexp*delcs;
+	facang12 = rinv12*facang;
+	csfacang = cs*facang;
+	csfac1 = rinvsq1*csfacang;
+
+	fj[0] = delr1[0] * (frad1 + csfac1) - delr2[0] * facang12;
+	fj[1] = delr1[1] * (frad1 + csfac1) - delr2[1] * facang12;
+	fj[2] = delr1[2] * (frad1 + csfac1) - delr2[2] * facang12;
+
+	if (fk == NULL) return;
+
+	frad2 = facrad*gsrainvsq2;
+	csfac2 = rinvsq2*csfacang;
+
+	fk[0] = delr2[0] * (frad2 + csfac2) - delr1[0] * facang12;
+	fk[1] = delr2[1] * (frad2 + csfac2) - delr1[1] * facang12;
+	fk[2] = delr2[2] * (frad2 + csfac2) - delr1[2] * facang12;
+}
+
 //-----------------------------------------------------------------------
 
 
@@ -723,13 +805,35 @@ int distanceflag=0;
 	int dummy1;
 	double dummy2;
 	dummy1 = dummy2 = 0;
-	memory->grow(inner_neighbor_coords, neigh_max_inner,3 ,"Pair_CAC_sw:inner_neighbor_coords");
-	memory->grow(outer_neighbor_coords, neigh_max_outer, 3, "Pair_CAC_sw:outer_neighbor_coords");
-	memory->grow(inner_neighbor_types, neigh_max_inner,  "Pair_CAC_sw:inner_neighbor_types");
-	memory->grow(outer_neighbor_types, neigh_max_outer,  "Pair_CAC_sw:outer_neighbor_types");
+	//scratch arrays only grow when a larger neighborhood is encountered
+	if (neigh_max_inner > nmax_inner_sw) {
+		nmax_inner_sw = neigh_max_inner;
+		memory->grow(inner_neighbor_coords, nmax_inner_sw, 3, "Pair_CAC_sw:inner_neighbor_coords");
+		memory->grow(inner_neighbor_types, nmax_inner_sw, "Pair_CAC_sw:inner_neighbor_types");
+		memory->grow(inner_neighbor_params, nmax_inner_sw, "Pair_CAC_sw:inner_neighbor_params");
+		memory->grow(short_index, nmax_inner_sw, "Pair_CAC_sw:short_index");
+		memory->grow(short_delr, nmax_inner_sw, 3, "Pair_CAC_sw:short_delr");
+		memory->grow(short_r, nmax_inner_sw, "Pair_CAC_sw:short_r");
+		memory->grow(short_rinvsq, nmax_inner_sw, "Pair_CAC_sw:short_rinvsq");
+		memory->grow(short_gsrainvsq, nmax_inner_sw, "Pair_CAC_sw:short_gsrainvsq");
+		memory->grow(short_expgsrainv, nmax_inner_sw, "Pair_CAC_sw:short_expgsrainv");
+	}
+	if (neigh_max_outer > nmax_outer_sw) {
+		nmax_outer_sw = neigh_max_outer;
+		memory->grow(outer_neighbor_coords, nmax_outer_sw, 3, "Pair_CAC_sw:outer_neighbor_coords");
+		memory->grow(outer_neighbor_types, nmax_outer_sw, "Pair_CAC_sw:outer_neighbor_types");
+		memory->grow(outer_neighbor_params, nmax_outer_sw, "Pair_CAC_sw:outer_neighbor_params");
+	}
+	if (neigh_max_inner + neigh_max_outer > nmax_leg_sw) {
+		nmax_leg_sw = neigh_max_inner + neigh_max_outer;
+		memory->grow(leg_delr, nmax_leg_sw, 3, "Pair_CAC_sw:leg_delr");
+		memory->grow(leg_rsq, nmax_leg_sw, "Pair_CAC_sw:leg_rsq");
+		memory->grow(leg_types, nmax_leg_sw, "Pair_CAC_sw:leg_types");
+	}
 
 	tagint itag, jtag;
 	double rsq, rsq1, rsq2;
+	double r2, rinvsq2, gsrainvsq2, expgsrainv2;
 	double delr1[3], delr2[3], fj[3], fk[3];
 	ilist = list->ilist;
 	numneigh = list->numneigh;
@@ -738,7 +842,6 @@ int distanceflag=0;
 	double ****nodal_positions = atom->nodal_positions;
 	int **node_types = atom->node_types;
 	origin_type = map[type_array[poly_counter]];
-	double inner_scan_position[3];
 	//precompute virtual neighbor atom locations
 	for (int l = 0; l < neigh_max_inner; l++) {
 		scanning_unit_cell[0] = inner_quad_lists_ucell[iii][neigh_quad_counter][l][0];
@@ -766,153 +869,123 @@ int distanceflag=0;
 		neigh_list_cord(outer_neighbor_coords[l][0], outer_neighbor_coords[l][1], outer_neighbor_coords[l][2],
 			element_index, poly_index, scanning_unit_cell[0], scanning_unit_cell[1], scanning_unit_cell[2]);
 	}
-	//two body contribution
+	//precompute the quadrature point to neighbor displacements, distances and
+	//the exponential factors of each i-l leg; these are shared by the two body
+	//term and every triplet containing the leg. Neighbors inside the cutoff
+	//are packed into a short list so the triplet loops below carry no cutoff
+	//branches on the first leg.
+	int nshort = 0;
 	for (int l = 0; l < neigh_max_inner; l++) {
-
-		scan_type = inner_neighbor_types[l];
-		scan_position[0] = inner_neighbor_coords[l][0];
-		scan_position[1] = inner_neighbor_coords[l][1];
-		scan_position[2] = inner_neighbor_coords[l][2];
-
-
-		delx = current_position[0] - scan_position[0];
-		dely = current_position[1] - scan_position[1];
-		delz = current_position[2] - scan_position[2];
-		distancesq = delx*delx + dely*dely + delz*delz;
-
-		ijparam = elem2param[origin_type][scan_type][scan_type];
-		if (distancesq >= params[ijparam].cutsq) continue;
-
-		twobody(&params[ijparam], distancesq, fpair, dummy1, dummy2);
-
-
-		force_densityx += delx*fpair;
-		force_densityy += dely*fpair;
-		force_densityz += delz*fpair;
-	}
-
-	//ith three body contributions
-	for (int l = 0; l < neigh_max_inner - 1; l++) {
 		scan_type = inner_neighbor_types[l];
-		scan_position[0] = inner_neighbor_coords[l][0];
-		scan_position[1] = inner_neighbor_coords[l][1];
-		scan_position[2] = inner_neighbor_coords[l][2];
-		delr1[0] = scan_position[0] - current_position[0];
-		delr1[1] = scan_position[1] - current_position[1];
-		delr1[2] = scan_position[2] - current_position[2];
-		distancesq = delx*delx + dely*dely + delz*delz;
-
 		ijparam = elem2param[origin_type][scan_type][scan_type];
-
+		inner_neighbor_params[l] = ijparam;
+		delr1[0] = inner_neighbor_coords[l][0] - current_position[0];
+		delr1[1] = inner_neighbor_coords[l][1] - current_position[1];
+		delr1[2] = inner_neighbor_coords[l][2] - current_position[2];
 		rsq1 = delr1[0] * delr1[0] + delr1[1] * delr1[1] + delr1[2] * delr1[2];
 		if (rsq1 >= params[ijparam].cutsq) continue;
 
+		//two body contribution
 
+		twobody(&params[ijparam], rsq1, fpair, dummy1, dummy2);
 
-		for (int k = l + 1; k < neigh_max_inner; k++) {
-			scan_type2 = inner_neighbor_types[k];
-			scan_position[0] = inner_neighbor_coords[k][0];
-			scan_position[1] = inner_neighbor_coords[k][1];
-			scan_position[2] = inner_neighbor_coords[k][2];
-
-			ikparam = elem2param[origin_type][scan_type2][scan_type2];
-			ijkparam = elem2param[origin_type][scan_type][scan_type2];
+		force_densityx -= delr1[0] * fpair;
+		force_densityy -= delr1[1] * fpair;
+		force_densityz -= delr1[2] * fpair;
 
-			delr2[0] = scan_position[0] - current_position[0];
-			delr2[1] = scan_position[1] - current_position[1];
-			delr2[2] = scan_position[2] - current_position[2];
-			rsq2 = delr2[0] * delr2[0] + delr2[1] * delr2[1] + delr2[2] * delr2[2];
-			if (rsq2 >= params[ikparam].cutsq) continue;
+		short_delr[nshort][0] = delr1[0];
+		short_delr[nshort][1] = delr1[1];
+		short_delr[nshort][2] = delr1[2];
+		leg_setup(&params[ijparam], rsq1, short_r[nshort], short_rinvsq[nshort],
+			short_gsrainvsq[nshort], short_expgsrainv[nshort]);
+		short_index[nshort] = l;
+		nshort++;
+	}
+	for (int k = 0; k < neigh_max_outer; k++) {
+		scan_type2 = outer_neighbor_types[k];
+		outer_neighbor_params[k] = elem2param[origin_type][scan_type2][scan_type2];
+	}
 
+	//ith three body contributions
+	for (int ll = 0; ll < nshort - 1; ll++) {
+		scan_type = inner_neighbor_types[short_index[ll]];
+		ijparam = inner_neighbor_params[short_index[ll]];
 
-			threebody(&params[ijparam], &params[ikparam], &params[ijkparam],
-				rsq1, rsq2, delr1, delr2, fj, fk, dummy1, dummy2);
+		for (int kk = ll + 1; kk < nshort; kk++) {
+			scan_type2 = inner_neighbor_types[short_index[kk]];
+			ikparam = inner_neighbor_params[short_index[kk]];
+			ijkparam = elem2param[origin_type][scan_type][scan_type2];
 
+			threebody_legs(&params[ijkparam], short_delr[ll], short_delr[kk],
+				short_r[ll], short_rinvsq[ll], short_gsrainvsq[ll], short_expgsrainv[ll],
+				short_r[kk], short_rinvsq[kk], short_gsrainvsq[kk], short_expgsrainv[kk],
+				fj, fk);
 
 			force_densityx -= fj[0] + fk[0];
 			force_densityy -= fj[1] + fk[1];
 			force_densityz -= fj[2] + fk[2];
 		}
-
 	}
-	//jk three body contributions to i
-	for (int l = 0; l < neigh_max_inner; l++) {
-		scan_type = inner_neighbor_types[l];
-		inner_scan_position[0] = inner_neighbor_coords[l][0];
-		inner_scan_position[1] = inner_neighbor_coords[l][1];
-		inner_scan_position[2] = inner_neighbor_coords[l][2];
-
-		delr1[0] = current_position[0] - inner_scan_position[0];
-		delr1[1] = current_position[1] - inner_scan_position[1];
-		delr1[2] = current_position[2] - inner_scan_position[2];
-		distancesq = delx*delx + dely*dely + delz*delz;
-
-		ijparam = elem2param[origin_type][scan_type][scan_type];
-
-		rsq1 = delr1[0] * delr1[0] + delr1[1] * delr1[1] + delr1[2] * delr1[2];
-		if (rsq1 >= params[ijparam].cutsq) continue;
-
 
+	//jk three body contributions to i; the i-l leg comes from the short list,
+	//the l-k legs are gathered and cutoff-packed before the triplet loop
+	for (int ll = 0; ll < nshort; ll++) {
+		int l = short_index[ll];
+		scan_type = inner_neighbor_types[l];
+		ijparam = inner_neighbor_params[l];
+		delr1[0] = -short_delr[ll][0];
+		delr1[1] = -short_delr[ll][1];
+		delr1[2] = -short_delr[ll][2];
 
+		int nleg = 0;
 		for (int k = 0; k < neigh_max_inner; k++) {
 			//add ji as well as ij contributions
 			if (k == l) continue;
-			scan_type2 = inner_neighbor_types[k];
-			scan_position[0] = inner_neighbor_coords[k][0];
-			scan_position[1] = inner_neighbor_coords[k][1];
-			scan_position[2] = inner_neighbor_coords[k][2];
-
-			ikparam = elem2param[origin_type][scan_type2][scan_type2];
-			ijkparam = elem2param[origin_type][scan_type][scan_type2];
-
-			delr2[0] = scan_position[0] - inner_scan_position[0];
-			delr2[1] = scan_position[1] - inner_scan_position[1];
-			delr2[2] = scan_position[2] - inner_scan_position[2];
+			ikparam = inner_neighbor_params[k];
+			delr2[0] = inner_neighbor_coords[k][0] - inner_neighbor_coords[l][0];
+			delr2[1] = inner_neighbor_coords[k][1] - inner_neighbor_coords[l][1];
+			delr2[2] = inner_neighbor_coords[k][2] - inner_neighbor_coords[l][2];
 			rsq2 = delr2[0] * delr2[0] + delr2[1] * delr2[1] + delr2[2] * delr2[2];
 			if (rsq2 >= params[ikparam].cutsq) continue;
-
-
-			threebody(&params[ijparam], &params[ikparam], &params[ijkparam],
-				rsq1, rsq2, delr1, delr2, fj, fk, dummy1, dummy2);
-
-
-			force_densityx += fj[0];
-			force_densityy += fj[1];
-			force_densityz += fj[2];
+			leg_delr[nleg][0] = delr2[0];
+			leg_delr[nleg][1] = delr2[1];
+			leg_delr[nleg][2] = delr2[2];
+			leg_rsq[nleg] = rsq2;
+			leg_types[nleg] = inner_neighbor_types[k];
+			nleg++;
 		}
 		for (int k = 0; k < neigh_max_outer; k++) {
 			//add contributions that come from outer neighbor band (farther particle triplets connected to i)
-
-			scan_type2 = outer_neighbor_types[k];
-			scan_position[0] = outer_neighbor_coords[k][0];
-			scan_position[1] = outer_neighbor_coords[k][1];
-			scan_position[2] = outer_neighbor_coords[k][2];
-
-			ikparam = elem2param[origin_type][scan_type2][scan_type2];
-			ijkparam = elem2param[origin_type][scan_type][scan_type2];
-
-			delr2[0] = scan_position[0] - inner_scan_position[0];
-			delr2[1] = scan_position[1] - inner_scan_position[1];
-			delr2[2] = scan_position[2] - inner_scan_position[2];
+			ikparam = outer_neighbor_params[k];
+			delr2[0] = outer_neighbor_coords[k][0] - inner_neighbor_coords[l][0];
+			delr2[1] = outer_neighbor_coords[k][1] - inner_neighbor_coords[l][1];
+			delr2[2] = outer_neighbor_coords[k][2] - inner_neighbor_coords[l][2];
 			rsq2 = delr2[0] * delr2[0] + delr2[1] * delr2[1] + delr2[2] * delr2[2];
 			if (rsq2 >= params[ikparam].cutsq) continue;
+			leg_delr[nleg][0] = delr2[0];
+			leg_delr[nleg][1] = delr2[1];
+			leg_delr[nleg][2] = delr2[2];
+			leg_rsq[nleg] = rsq2;
+			leg_types[nleg] = outer_neighbor_types[k];
+			nleg++;
+		}
 
+		for (int kk = 0; kk < nleg; kk++) {
+			scan_type2 = leg_types[kk];
+			ikparam = elem2param[origin_type][scan_type2][scan_type2];
+			ijkparam = elem2param[origin_type][scan_type][scan_type2];
+			leg_setup(&params[ikparam], leg_rsq[kk], r2, rinvsq2, gsrainvsq2, expgsrainv2);
 
-			threebody(&params[ijparam], &params[ikparam], &params[ijkparam],
-				rsq1, rsq2, delr1, delr2, fj, fk, dummy1, dummy2);
-
+			threebody_legs(&params[ijkparam], delr1, leg_delr[kk],
+				short_r[ll], short_rinvsq[ll], short_gsrainvsq[ll], short_expgsrainv[ll],
+				r2, rinvsq2, gsrainvsq2, expgsrainv2, fj, NULL);
 
 			force_densityx += fj[0];
 			force_densityy += fj[1];
 			force_densityz += fj[2];
 		}
-
 	}
 
-
-
-
-
 //end of scanning loop
 
 
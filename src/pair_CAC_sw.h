@@ -89,6 +89,19 @@ class PairCACSW : public PairCAC {
   double **outer_neighbor_coords;
   int *inner_neighbor_types;
   int *outer_neighbor_types;
+  int *inner_neighbor_params;
+  int *outer_neighbor_params;
+
+  // per quadrature point cache of the i-l legs inside the cutoff
+  int *short_index;
+  double **short_delr;
+  double *short_r, *short_rinvsq, *short_gsrainvsq, *short_expgsrainv;
+
+  // packed l-k legs of the current jk triplet loop
+  double **leg_delr;
+  double *leg_rsq;
+  int *leg_types;
+  int nmax_inner_sw, nmax_outer_sw, nmax_leg_sw;
  
 	
 
@@ -100,6 +113,9 @@ class PairCACSW : public PairCAC {
   void twobody(Param *, double, double &, int, double &);
   void threebody(Param *, Param *, Param *, double, double, double *, double *,
 	  double *, double *, int, double &);
+  void leg_setup(Param *, double, double &, double &, double &, double &);
+  void threebody_legs(Param *, double *, double *, double, double, double,
+	  double, double, double, double, double, double *, double *);
   //double density_map(double);
   
   
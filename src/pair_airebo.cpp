@@ -64,7 +64,9 @@ PairAIREBO::PairAIREBO(LAMMPS *lmp) : Pair(lmp)
   maxlocal = 0;
   REBO_numneigh = NULL;
   REBO_firstneigh = NULL;
+  REBO_firstw = NULL;
   ipage = NULL;
+  wpage = NULL;
   pgsize = oneatom = 0;
 
   nC = nH = NULL;
@@ -84,7 +86,9 @@ PairAIREBO::~PairAIREBO()
 {
   memory->destroy(REBO_numneigh);
   memory->sfree(REBO_firstneigh);
+  memory->sfree(REBO_firstw);
   delete [] ipage;
+  delete [] wpage;
   memory->destroy(nC);
   memory->destroy(nH);
   delete [] pvector;
@@ -247,7 +251,7 @@ void PairAIREBO::init_style()
   neighbor->requests[irequest]->full = 1;
   neighbor->requests[irequest]->ghost = 1;
 
-  // local REBO neighbor list
+  // local REBO neighbor list and the weights of its pairs
   // create pages if first time or if neighbor pgsize/oneatom has changed
 
   int create = 0;
@@ -257,13 +261,17 @@ void PairAIREBO::init_style()
 
   if (create) {
     delete [] ipage;
+    delete [] wpage;
     pgsize = neighbor->pgsize;
     oneatom = neighbor->oneatom;
 
     int nmypage= comm->nthreads;
     ipage = new MyPage<int>[nmypage];
-    for (int i = 0; i < nmypage; i++)
+    wpage = new MyPage<double>[nmypage];
+    for (int i = 0; i < nmypage; i++) {
       ipage[i].init(oneatom,pgsize,PGDELTA);
+      wpage[i].init(2*oneatom,2*pgsize,PGDELTA);
+    }
   }
 }
 
@@ -346,14 +354,18 @@ double PairAIREBO::init_one(int i, int j)
 /* ----------------------------------------------------------------------
    create REBO neighbor list from main neighbor list
    REBO neighbor list stores neighbors of ghost atoms
+   the switching fn wij = Sp(rij) and its derivative of each REBO pair
+     are stored alongside, FREBO, FLJ, TORSION and the bond orders
+     reuse them instead of evaluating Sp() again for the same pair
 ------------------------------------------------------------------------- */
 
 void PairAIREBO::REBO_neigh()
 {
   int i,j,ii,jj,n,allnum,jnum,itype,jtype;
-  double xtmp,ytmp,ztmp,delx,dely,delz,rsq,dS;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq,wij,dwij;
   int *ilist,*jlist,*numneigh,**firstneigh;
   int *neighptr;
+  double *wptr;
 
   double **x = atom->x;
   int *type = atom->type;
@@ -362,11 +374,14 @@ void PairAIREBO::REBO_neigh()
     maxlocal = atom->nmax;
     memory->destroy(REBO_numneigh);
     memory->sfree(REBO_firstneigh);
+    memory->sfree(REBO_firstw);
     memory->destroy(nC);
     memory->destroy(nH);
     memory->create(REBO_numneigh,maxlocal,"AIREBO:numneigh");
     REBO_firstneigh = (int **) memory->smalloc(maxlocal*sizeof(int *),
                                                "AIREBO:firstneigh");
+    REBO_firstw = (double **) memory->smalloc(maxlocal*sizeof(double *),
+                                              "AIREBO:firstw");
     memory->create(nC,maxlocal,"AIREBO:nC");
     memory->create(nH,maxlocal,"AIREBO:nH");
   }
@@ -380,12 +395,14 @@ void PairAIREBO::REBO_neigh()
   // scan full neighbor list of I
 
   ipage->reset();
+  wpage->reset();
 
   for (ii = 0; ii < allnum; ii++) {
     i = ilist[ii];
 
     n = 0;
     neighptr = ipage->vget();
+    wptr = wpage->vget();
 
     xtmp = x[i][0];
     ytmp = x[i][1];
@@ -405,18 +422,21 @@ void PairAIREBO::REBO_neigh()
       rsq = delx*delx + dely*dely + delz*delz;
 
       if (rsq < rcmaxsq[itype][jtype]) {
+        wij = Sp(sqrt(rsq),rcmin[itype][jtype],rcmax[itype][jtype],dwij);
+        wptr[2*n] = wij;
+        wptr[2*n+1] = dwij;
         neighptr[n++] = j;
-        if (jtype == 0)
-          nC[i] += Sp(sqrt(rsq),rcmin[itype][jtype],rcmax[itype][jtype],dS);
-        else
-          nH[i] += Sp(sqrt(rsq),rcmin[itype][jtype],rcmax[itype][jtype],dS);
+        if (jtype == 0) nC[i] += wij;
+        else nH[i] += wij;
       }
     }
 
     REBO_firstneigh[i] = neighptr;
+    REBO_firstw[i] = wptr;
     REBO_numneigh[i] = n;
     ipage->vgot(n);
-    if (ipage->status())
+    wpage->vgot(2*n);
+    if (ipage->status() || wpage->status())
       error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
   }
 }
@@ -479,7 +499,8 @@ void PairAIREBO::FREBO(int eflag, int vflag)
       delz = x[i][2] - x[j][2];
       rsq = delx*delx + dely*dely + delz*delz;
       rij = sqrt(rsq);
-      wij = Sp(rij,rcmin[itype][jtype],rcmax[itype][jtype],dwij);
+      wij = REBO_firstw[i][2*k];
+      dwij = REBO_firstw[i][2*k+1];
       if (wij <= TOL) continue;
 
       Qij = Q[itype][jtype];
@@ -626,7 +647,8 @@ void PairAIREBO::FLJ(int eflag, int vflag)
       if (testpath) {
 
         // test all 3-body paths = I-K-J
-        // I-K interactions come from atom I's REBO neighbors
+        // I-K interactions come from atom I's REBO neighbors,
+        //   wik is taken from the weights stored with them
         // if wik > current best, compute wkj
         // if best = 1.0, done
 
@@ -635,17 +657,16 @@ void PairAIREBO::FLJ(int eflag, int vflag)
           k = REBO_neighs_i[kk];
           if (k == j) continue;
           ktype = map[type[k]];
+          wik = REBO_firstw[i][2*kk];
 
-          delik[0] = x[i][0] - x[k][0];
-          delik[1] = x[i][1] - x[k][1];
-          delik[2] = x[i][2] - x[k][2];
-          rsq = delik[0]*delik[0] + delik[1]*delik[1] + delik[2]*delik[2];
-          if (rsq < rcmaxsq[itype][ktype]) {
+          if (wik > best) {
+            dwik = REBO_firstw[i][2*kk+1];
+            delik[0] = x[i][0] - x[k][0];
+            delik[1] = x[i][1] - x[k][1];
+            delik[2] = x[i][2] - x[k][2];
+            rsq = delik[0]*delik[0] + delik[1]*delik[1] + delik[2]*delik[2];
             rik = sqrt(rsq);
-            wik = Sp(rik,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
-          } else { dwik = wik = 0.0; rikS = rik = 1.0; }
 
-          if (wik > best) {
             deljk[0] = x[j][0] - x[k][0];
             deljk[1] = x[j][1] - x[k][1];
             deljk[2] = x[j][2] - x[k][2];
@@ -677,7 +698,8 @@ void PairAIREBO::FLJ(int eflag, int vflag)
             }
 
             // test all 4-body paths = I-K-M-J
-            // K-M interactions come from atom K's REBO neighbors
+            // K-M interactions come from atom K's REBO neighbors,
+            //   wkm is taken from the weights stored with them
             // if wik*wkm > current best, compute wmj
             // if best = 1.0, done
 
@@ -686,16 +708,17 @@ void PairAIREBO::FLJ(int eflag, int vflag)
               m = REBO_neighs_k[mm];
               if (m == i || m == j) continue;
               mtype = map[type[m]];
-              delkm[0] = x[k][0] - x[m][0];
-              delkm[1] = x[k][1] - x[m][1];
-              delkm[2] = x[k][2] - x[m][2];
-              rsq = delkm[0]*delkm[0] + delkm[1]*delkm[1] + delkm[2]*delkm[2];
-              if (rsq < rcmaxsq[ktype][mtype]) {
-                rkm = sqrt(rsq);
-                wkm = Sp(rkm,rcmin[ktype][mtype],rcmax[ktype][mtype],dwkm);
-              } else { dwkm = wkm = 0.0; rkmS = rkm = 1.0; }
+              wkm = REBO_firstw[k][2*mm];
 
               if (wik*wkm > best) {
+                dwkm = REBO_firstw[k][2*mm+1];
+                delkm[0] = x[k][0] - x[m][0];
+                delkm[1] = x[k][1] - x[m][1];
+                delkm[2] = x[k][2] - x[m][2];
+                rsq = delkm[0]*delkm[0] + delkm[1]*delkm[1] +
+                  delkm[2]*delkm[2];
+                rkm = sqrt(rsq);
+
                 deljm[0] = x[j][0] - x[m][0];
                 deljm[1] = x[j][1] - x[m][1];
                 deljm[2] = x[j][2] - x[m][2];
@@ -962,7 +985,8 @@ void PairAIREBO::TORSION(int eflag, int vflag)
       del23[1] = -del32[1];
       del23[2] = -del32[2];
       r23 = r32;
-      w23 = Sp(r23,rcmin[itype][jtype],rcmax[itype][jtype],dw23);
+      w23 = REBO_firstw[i][2*jj];
+      dw23 = REBO_firstw[i][2*jj+1];
 
       for (kk = 0; kk < REBO_numneigh[i]; kk++) {
         k = REBO_neighs_i[kk];
@@ -986,7 +1010,8 @@ void PairAIREBO::TORSION(int eflag, int vflag)
         rjk2 = deljk[0]*deljk[0] + deljk[1]*deljk[1] + deljk[2]*deljk[2];
         rjk=sqrt(rjk2);
         rik2 = r21*r21;
-        w21 = Sp(r21,rcmin[itype][ktype],rcmax[itype][ktype],dw21);
+        w21 = REBO_firstw[i][2*kk];
+        dw21 = REBO_firstw[i][2*kk+1];
 
         rij = r32;
         rik = r21;
@@ -1012,7 +1037,8 @@ void PairAIREBO::TORSION(int eflag, int vflag)
           cos234 = MAX(cos234,-1.0);
           sin234 = sqrt(1.0 - cos234*cos234);
           if (sin234 < TOL) continue;
-          w34 = Sp(r34,rcmin[jtype][ltype],rcmax[jtype][ltype],dw34);
+          w34 = REBO_firstw[j][2*ll];
+          dw34 = REBO_firstw[j][2*ll+1];
           delil[0] = del23[0] + del34[0];
           delil[1] = del23[1] + del34[1];
           delil[2] = del23[2] + del34[2];
@@ -1318,7 +1344,7 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
       rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
       lamdajik = 4.0*kronecker(itype,1) *
         ((rho[ktype][1]-rikmag)-(rho[jtype][1]-rijmag));
-      wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dS);
+      wik = REBO_firstw[i][2*k];
       Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
         (wik*kronecker(itype,1));
       cosjik = ((rij[0]*rik[0])+(rij[1]*rik[1])+(rij[2]*rik[2])) /
@@ -1355,7 +1381,8 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
       rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
       lamdajik = 4.0*kronecker(itype,1) *
         ((rho[ktype][1]-rikmag)-(rho[jtype][1]-rijmag));
-      wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+      wik = REBO_firstw[i][2*k];
+      dwik = REBO_firstw[i][2*k+1];
       cosjik = (rij[0]*rik[0] + rij[1]*rik[1] + rij[2]*rik[2]) /
         (rijmag*rikmag);
       cosjik = MIN(cosjik,1.0);
@@ -1463,7 +1490,7 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
       rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
       lamdaijl = 4.0*kronecker(jtype,1) *
         ((rho[ltype][1]-rjlmag)-(rho[itype][1]-rijmag));
-      wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dS);
+      wjl = REBO_firstw[j][2*l];
       Nlj = nC[atoml]-(wjl*kronecker(jtype,0)) +
         nH[atoml]-(wjl*kronecker(jtype,1));
       cosijl = -1.0*((rij[0]*rjl[0])+(rij[1]*rjl[1])+(rij[2]*rjl[2])) /
@@ -1498,7 +1525,8 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
       rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
       lamdaijl = 4.0*kronecker(jtype,1) *
         ((rho[ltype][1]-rjlmag)-(rho[itype][1]-rijmag));
-      wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+      wjl = REBO_firstw[j][2*l];
+      dwjl = REBO_firstw[j][2*l+1];
       cosijl = (-1.0*((rij[0]*rjl[0])+(rij[1]*rjl[1])+(rij[2]*rjl[2]))) /
         (rijmag*rjlmag);
       cosijl = MIN(cosijl,1.0);
@@ -1604,7 +1632,8 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
       rik[1] = x[atomi][1]-x[atomk][1];
       rik[2] = x[atomi][2]-x[atomk][2];
       rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
-      wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+      wik = REBO_firstw[i][2*k];
+      dwik = REBO_firstw[i][2*k+1];
       Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
         (wik*kronecker(itype,1));
       SpN = Sp(Nki,Nmin,Nmax,dNki);
@@ -1643,7 +1672,7 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
             rkn[1] = x[atomk][1]-x[atomn][1];
             rkn[2] = x[atomk][2]-x[atomn][2];
             rknmag = sqrt((rkn[0]*rkn[0])+(rkn[1]*rkn[1])+(rkn[2]*rkn[2]));
-            Sp(rknmag,rcmin[ktype][ntype],rcmax[ktype][ntype],dwkn);
+            dwkn = REBO_firstw[atomk][2*n+1];
 
             tmp2 = VA*dN3[2]*(2.0*NconjtmpI*wik*dNki*dwkn)/rknmag;
             f[atomk][0] -= tmp2*rkn[0];
@@ -1671,7 +1700,8 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
       rjl[1] = x[atomj][1]-x[atoml][1];
       rjl[2] = x[atomj][2]-x[atoml][2];
       rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
-      wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+      wjl = REBO_firstw[atomj][2*l];
+      dwjl = REBO_firstw[atomj][2*l+1];
       Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
         (wjl*kronecker(jtype,1));
       SpN = Sp(Nlj,Nmin,Nmax,dNlj);
@@ -1710,7 +1740,7 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
             rln[1] = x[atoml][1]-x[atomn][1];
             rln[2] = x[atoml][2]-x[atomn][2];
             rlnmag = sqrt((rln[0]*rln[0])+(rln[1]*rln[1])+(rln[2]*rln[2]));
-            Sp(rlnmag,rcmin[ltype][ntype],rcmax[ltype][ntype],dwln);
+            dwln = REBO_firstw[atoml][2*n+1];
 
             tmp2 = VA*dN3[2]*(2.0*NconjtmpJ*wjl*dNlj*dwln)/rlnmag;
             f[atoml][0] -= tmp2*rln[0];
@@ -1955,7 +1985,8 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
         rik[1] = x[atomi][1]-x[atomk][1];
         rik[2] = x[atomi][2]-x[atomk][2];
         rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
-        wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+        wik = REBO_firstw[i][2*k];
+        dwik = REBO_firstw[i][2*k+1];
         Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
           (wik*kronecker(itype,1));
         SpN = Sp(Nki,Nmin,Nmax,dNki);
@@ -1994,7 +2025,7 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
               rkn[1] = x[atomk][1]-x[atomn][1];
               rkn[2] = x[atomk][2]-x[atomn][2];
               rknmag = sqrt((rkn[0]*rkn[0])+(rkn[1]*rkn[1])+(rkn[2]*rkn[2]));
-              Sp(rknmag,rcmin[ktype][ntype],rcmax[ktype][ntype],dwkn);
+              dwkn = REBO_firstw[atomk][2*n+1];
 
               tmp2 = VA*dN3[2]*(2.0*NconjtmpI*wik*dNki*dwkn)*Etmp/rknmag;
               f[atomk][0] -= tmp2*rkn[0];
@@ -2022,7 +2053,8 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
         rjl[1] = x[atomj][1]-x[atoml][1];
         rjl[2] = x[atomj][2]-x[atoml][2];
         rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
-        wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+        wjl = REBO_firstw[j][2*l];
+        dwjl = REBO_firstw[j][2*l+1];
         Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
           (wjl*kronecker(jtype,1));
         SpN = Sp(Nlj,Nmin,Nmax,dNlj);
@@ -2061,7 +2093,7 @@ double PairAIREBO::bondorder(int i, int j, double rij[3],
               rln[1] = x[atoml][1]-x[atomn][1];
               rln[2] = x[atoml][2]-x[atomn][2];
               rlnmag = sqrt((rln[0]*rln[0])+(rln[1]*rln[1])+(rln[2]*rln[2]));
-              Sp(rlnmag,rcmin[ltype][ntype],rcmax[ltype][ntype],dwln);
+              dwln = REBO_firstw[atoml][2*n+1];
 
               tmp2 = VA*dN3[2]*(2.0*NconjtmpJ*wjl*dNlj*dwln)*Etmp/rlnmag;
               f[atoml][0] -= tmp2*rln[0];
@@ -2185,7 +2217,7 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
       rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
       lamdajik = 4.0*kronecker(itype,1) *
         ((rho[ktype][1]-rikmag)-(rho[jtype][1]-rijmag_mod));
-      wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dS);
+      wik = REBO_firstw[i][2*k];
       Nki = nC[atomk]-(wik*kronecker(itype,0))+
         nH[atomk]-(wik*kronecker(itype,1));
       cosjik = ((rij[0]*rik[0])+(rij[1]*rik[1])+(rij[2]*rik[2])) /
@@ -2226,7 +2258,7 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
       rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
       lamdaijl = 4.0*kronecker(jtype,1) *
         ((rho[ltype][1]-rjlmag)-(rho[itype][1]-rijmag_mod));
-      wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dS);
+      wjl = REBO_firstw[j][2*l];
       Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
         (wjl*kronecker(jtype,1));
       cosijl = -1.0*((rij[0]*rjl[0])+(rij[1]*rjl[1])+(rij[2]*rjl[2])) /
@@ -2361,7 +2393,8 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
         rikmag = sqrt(rik[0]*rik[0] + rik[1]*rik[1] + rik[2]*rik[2]);
         lamdajik = 4.0*kronecker(itype,1) *
           ((rho[ktype][1]-rikmag)-(rho[jtype][1]-rijmag_mod));
-        wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+        wik = REBO_firstw[i][2*k];
+        dwik = REBO_firstw[i][2*k+1];
         cosjik = (rij[0]*rik[0] + rij[1]*rik[1] + rij[2]*rik[2]) /
           (rijmag*rikmag);
         cosjik = MIN(cosjik,1.0);
@@ -2466,7 +2499,8 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
         rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
         lamdaijl = 4.0*kronecker(jtype,1) *
           ((rho[ltype][1]-rjlmag)-(rho[itype][1]-rijmag_mod));
-        wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+        wjl = REBO_firstw[j][2*l];
+        dwjl = REBO_firstw[j][2*l+1];
         cosijl = (-1.0*((rij[0]*rjl[0])+(rij[1]*rjl[1])+(rij[2]*rjl[2]))) /
           (rijmag*rjlmag);
         cosijl = MIN(cosijl,1.0);
@@ -2568,7 +2602,8 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
         rik[1] = x[atomi][1]-x[atomk][1];
         rik[2] = x[atomi][2]-x[atomk][2];
         rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
-        wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+        wik = REBO_firstw[i][2*k];
+        dwik = REBO_firstw[i][2*k+1];
         Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
           (wik*kronecker(itype,1));
         SpN = Sp(Nki,Nmin,Nmax,dNki);
@@ -2607,7 +2642,7 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
               rkn[1] = x[atomk][1]-x[atomn][1];
               rkn[2] = x[atomk][2]-x[atomn][2];
               rknmag = sqrt((rkn[0]*rkn[0])+(rkn[1]*rkn[1])+(rkn[2]*rkn[2]));
-              Sp(rknmag,rcmin[ktype][ntype],rcmax[ktype][ntype],dwkn);
+              dwkn = REBO_firstw[atomk][2*n+1];
 
               tmp2 = VA*dN3[2]*(2.0*NconjtmpI*wik*dNki*dwkn)/rknmag;
               f[atomk][0] -= tmp2*rkn[0];
@@ -2635,7 +2670,8 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
         rjl[1] = x[atomj][1]-x[atoml][1];
         rjl[2] = x[atomj][2]-x[atoml][2];
         rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
-        wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+        wjl = REBO_firstw[atomj][2*l];
+        dwjl = REBO_firstw[atomj][2*l+1];
         Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
           (wjl*kronecker(jtype,1));
         SpN = Sp(Nlj,Nmin,Nmax,dNlj);
@@ -2674,7 +2710,7 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
               rln[1] = x[atoml][1]-x[atomn][1];
               rln[2] = x[atoml][2]-x[atomn][2];
               rlnmag = sqrt((rln[0]*rln[0])+(rln[1]*rln[1])+(rln[2]*rln[2]));
-              Sp(rlnmag,rcmin[ltype][ntype],rcmax[ltype][ntype],dwln);
+              dwln = REBO_firstw[atoml][2*n+1];
 
               tmp2 = VA*dN3[2]*(2.0*NconjtmpJ*wjl*dNlj*dwln)/rlnmag;
               f[atoml][0] -= tmp2*rln[0];
@@ -2910,7 +2946,8 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
           rik[1] = x[atomi][1]-x[atomk][1];
           rik[2] = x[atomi][2]-x[atomk][2];
           rikmag = sqrt((rik[0]*rik[0])+(rik[1]*rik[1])+(rik[2]*rik[2]));
-          wik = Sp(rikmag,rcmin[itype][ktype],rcmax[itype][ktype],dwik);
+          wik = REBO_firstw[i][2*k];
+          dwik = REBO_firstw[i][2*k+1];
           Nki = nC[atomk]-(wik*kronecker(itype,0))+nH[atomk] -
             (wik*kronecker(itype,1));
           SpN = Sp(Nki,Nmin,Nmax,dNki);
@@ -2949,7 +2986,7 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
                 rkn[1] = x[atomk][1]-x[atomn][1];
                 rkn[2] = x[atomk][2]-x[atomn][2];
                 rknmag = sqrt((rkn[0]*rkn[0])+(rkn[1]*rkn[1])+(rkn[2]*rkn[2]));
-                Sp(rknmag,rcmin[ktype][ntype],rcmax[ktype][ntype],dwkn);
+                dwkn = REBO_firstw[atomk][2*n+1];
 
                 tmp2 = VA*dN3[2]*(2.0*NconjtmpI*wik*dNki*dwkn)*Etmp/rknmag;
                 f[atomk][0] -= tmp2*rkn[0];
@@ -2977,7 +3014,8 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
           rjl[1] = x[atomj][1]-x[atoml][1];
           rjl[2] = x[atomj][2]-x[atoml][2];
           rjlmag = sqrt((rjl[0]*rjl[0])+(rjl[1]*rjl[1])+(rjl[2]*rjl[2]));
-          wjl = Sp(rjlmag,rcmin[jtype][ltype],rcmax[jtype][ltype],dwjl);
+          wjl = REBO_firstw[j][2*l];
+          dwjl = REBO_firstw[j][2*l+1];
           Nlj = nC[atoml]-(wjl*kronecker(jtype,0))+nH[atoml] -
             (wjl*kronecker(jtype,1));
           SpN = Sp(Nlj,Nmin,Nmax,dNlj);
@@ -3016,7 +3054,7 @@ double PairAIREBO::bondorderLJ(int i, int j, double rij_mod[3], double rijmag_mo
                 rln[1] = x[atoml][1]-x[atomn][1];
                 rln[2] = x[atoml][2]-x[atomn][2];
                 rlnmag = sqrt((rln[0]*rln[0])+(rln[1]*rln[1])+(rln[2]*rln[2]));
-                Sp(rlnmag,rcmin[ltype][ntype],rcmax[ltype][ntype],dwln);
+                dwln = REBO_firstw[atoml][2*n+1];
 
                 tmp2 = VA*dN3[2]*(2.0*NconjtmpJ*wjl*dNlj*dwln)*Etmp/rlnmag;
                 f[atoml][0] -= tmp2*rln[0];
@@ -4619,8 +4657,12 @@ double PairAIREBO::memory_usage()
   bytes += maxlocal * sizeof(int);
   bytes += maxlocal * sizeof(int *);
 
-  for (int i = 0; i < comm->nthreads; i++)
+  bytes += maxlocal * sizeof(double *);
+
+  for (int i = 0; i < comm->nthreads; i++) {
     bytes += ipage[i].size();
+    bytes += wpage[i].size();
+  }
 
   bytes += 2*maxlocal * sizeof(double);
   return bytes;
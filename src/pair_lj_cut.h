@@ -46,6 +46,9 @@ class PairLJCut : public Pair {
   void compute_middle();
   void compute_outer(int, int);
 
+  void compute_interior(int, int);
+  void compute_boundary(int, int);
+
  protected:
   double cut_global;
   double **cut;
@@ -54,6 +57,7 @@ class PairLJCut : public Pair {
   double *cut_respa;
 
   virtual void allocate();
+  void compute_split(int, int);
 };
 
 }
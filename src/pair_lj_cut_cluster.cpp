@@ -0,0 +1,342 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <math.h>
+#include "pair_lj_cut_cluster.h"
+#include "neigh_cluster.h"
+#include "atom.h"
+#include "domain.h"
+#include "force.h"
+#include "neighbor.h"
+#include "update.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairLJCutCluster::PairLJCutCluster(LAMMPS *lmp) : PairLJCut(lmp)
+{
+  respa_enable = 0;
+  overlap_enable = 0;
+
+  cluster = NULL;
+  cluster_ncalls = -1;
+  ntable = 0;
+  cutsqf = lj1f = lj2f = lj3f = lj4f = offsetf = NULL;
+  cutsqc = lj1c = lj2c = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairLJCutCluster::~PairLJCutCluster()
+{
+  delete cluster;
+  memory->destroy(cutsqf);
+  memory->destroy(lj1f);
+  memory->destroy(lj2f);
+  memory->destroy(lj3f);
+  memory->destroy(lj4f);
+  memory->destroy(offsetf);
+  memory->destroy(cutsqc);
+  memory->destroy(lj1c);
+  memory->destroy(lj2c);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairLJCutCluster::compute(int eflag, int vflag)
+{
+  if (eflag || vflag) ev_setup(eflag,vflag);
+  else evflag = vflag_fdotr = 0;
+
+  // regroup atoms after every reneighboring, else just refresh coords
+
+  if (cluster_ncalls != neighbor->ncalls) {
+    cluster_ncalls = neighbor->ncalls;
+    cluster->build(cutforce + neighbor->skin,force->newton_pair);
+    flatten_coeffs();
+  } else cluster->pack();
+
+  if (evflag) {
+    if (eflag) eval<1,1>();
+    else eval<1,0>();
+  } else eval<0,0>();
+
+  cluster->unpack_forces();
+  if (cluster->nspecial) eval_special(eflag);
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+/* ----------------------------------------------------------------------
+   loop over cluster pairs of owned clusters
+   for each J slot, the CLUSTERSIZE I slots are one fixed-width vector:
+     coefficients are read from per-I-cluster rows without gathers,
+     masked and out-of-range pairs are weighted by 0.0, not branched around
+------------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG>
+void PairLJCutCluster::eval()
+{
+  int a,b,ci,cj,p,t,jtype;
+  double fxj,fyj,fzj,evdwl;
+  double xi[CLUSTERSIZE],yi[CLUSTERSIZE],zi[CLUSTERSIZE];
+  double fxi[CLUSTERSIZE],fyi[CLUSTERSIZE],fzi[CLUSTERSIZE];
+  double fxa[CLUSTERSIZE],fya[CLUSTERSIZE],fza[CLUSTERSIZE];
+
+  const int nlocal = atom->nlocal;
+  const int newton_pair = force->newton_pair;
+  const int nclocal = cluster->nclocal;
+  const int *firstpair = cluster->firstpair;
+  const int *numpair = cluster->numpair;
+  const int *pairj = cluster->pairj;
+  const unsigned int *pairmask = cluster->pairmask;
+  const int *catom = cluster->catom;
+  const int *ctype = cluster->ctype;
+  const double *cx = cluster->cx;
+  double *cf = cluster->cf;
+  const double (*lanemask)[CLUSTERSIZE] = cluster->lanemask;
+
+  evdwl = 0.0;
+
+  for (ci = 0; ci < nclocal; ci++) {
+    for (a = 0; a < CLUSTERSIZE; a++) {
+      xi[a] = cx[3*ci*CLUSTERSIZE+a];
+      yi[a] = cx[3*ci*CLUSTERSIZE+CLUSTERSIZE+a];
+      zi[a] = cx[3*ci*CLUSTERSIZE+2*CLUSTERSIZE+a];
+      fxi[a] = fyi[a] = fzi[a] = 0.0;
+    }
+
+    // coefficient rows of this I cluster, indexed by J type then I slot
+
+    for (a = 0; a < CLUSTERSIZE; a++) {
+      const int itable = ctype[ci*CLUSTERSIZE+a]*ntable;
+      for (t = 0; t < ntable; t++) {
+        cutsqc[t*CLUSTERSIZE+a] = cutsqf[itable+t];
+        lj1c[t*CLUSTERSIZE+a] = lj1f[itable+t];
+        lj2c[t*CLUSTERSIZE+a] = lj2f[itable+t];
+      }
+    }
+
+    for (p = firstpair[ci]; p < firstpair[ci]+numpair[ci]; p++) {
+      cj = pairj[p];
+      const unsigned int mask = pairmask[p];
+      const double *xj = &cx[3*cj*CLUSTERSIZE];
+      double *fj = &cf[3*cj*CLUSTERSIZE];
+      const int jforce = newton_pair || cj < nclocal;
+
+      for (b = 0; b < CLUSTERSIZE; b++) {
+        const double *lane =
+          lanemask[(mask >> (b*CLUSTERSIZE)) & ((1 << CLUSTERSIZE) - 1)];
+        const double xb = xj[b];
+        const double yb = xj[CLUSTERSIZE+b];
+        const double zb = xj[2*CLUSTERSIZE+b];
+        jtype = ctype[cj*CLUSTERSIZE+b];
+        const double *cutsqrow = &cutsqc[jtype*CLUSTERSIZE];
+        const double *lj1row = &lj1c[jtype*CLUSTERSIZE];
+        const double *lj2row = &lj2c[jtype*CLUSTERSIZE];
+
+        // masked lanes get rsq >= 1 so 1/rsq stays finite for
+        //   coincident padding slots
+
+        CLUSTER_SLOT_LOOP
+        for (a = 0; a < CLUSTERSIZE; a++) {
+          const double delx = xi[a] - xb;
+          const double dely = yi[a] - yb;
+          const double delz = zi[a] - zb;
+          const double rsq = delx*delx + dely*dely + delz*delz;
+          const double weight = (rsq < cutsqrow[a]) ? lane[a] : 0.0;
+
+          const double r2inv = 1.0/(rsq + 1.0 - lane[a]);
+          const double r6inv = r2inv*r2inv*r2inv;
+          const double forcelj = r6inv * (lj1row[a]*r6inv - lj2row[a]);
+          const double fpair = forcelj*r2inv*weight;
+
+          fxa[a] = delx*fpair;
+          fya[a] = dely*fpair;
+          fza[a] = delz*fpair;
+          fxi[a] += fxa[a];
+          fyi[a] += fya[a];
+          fzi[a] += fza[a];
+
+          if (EVFLAG && weight != 0.0) {
+            const int ij = ctype[ci*CLUSTERSIZE+a]*ntable + jtype;
+            if (EFLAG) evdwl = r6inv*(lj3f[ij]*r6inv-lj4f[ij]) - offsetf[ij];
+            ev_tally(catom[ci*CLUSTERSIZE+a],catom[cj*CLUSTERSIZE+b],
+                     nlocal,newton_pair,evdwl,0.0,fpair,delx,dely,delz);
+          }
+        }
+
+        if (jforce) {
+          fxj = fyj = fzj = 0.0;
+          for (a = 0; a < CLUSTERSIZE; a++) {
+            fxj += fxa[a];
+            fyj += fya[a];
+            fzj += fza[a];
+          }
+          fj[b] -= fxj;
+          fj[CLUSTERSIZE+b] -= fyj;
+          fj[2*CLUSTERSIZE+b] -= fzj;
+        }
+      }
+    }
+
+    for (a = 0; a < CLUSTERSIZE; a++) {
+      cf[3*ci*CLUSTERSIZE+a] += fxi[a];
+      cf[3*ci*CLUSTERSIZE+CLUSTERSIZE+a] += fyi[a];
+      cf[3*ci*CLUSTERSIZE+2*CLUSTERSIZE+a] += fzi[a];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   atom pairs with special bond factors, left out of the cluster masks
+------------------------------------------------------------------------- */
+
+void PairLJCutCluster::eval_special(int eflag)
+{
+  int i,j,k,itype,jtype;
+  double delx,dely,delz,rsq,r2inv,r6inv,forcelj,factor_lj,fpair,evdwl;
+
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  double *special_lj = force->special_lj;
+  int newton_pair = force->newton_pair;
+  int nspecial = cluster->nspecial;
+  int *special_i = cluster->special_i;
+  int *special_j = cluster->special_j;
+
+  evdwl = 0.0;
+
+  for (k = 0; k < nspecial; k++) {
+    i = special_i[k];
+    j = special_j[k];
+    factor_lj = special_lj[sbmask(j)];
+    j &= NEIGHMASK;
+
+    itype = type[i];
+    jtype = type[j];
+    delx = x[i][0] - x[j][0];
+    dely = x[i][1] - x[j][1];
+    delz = x[i][2] - x[j][2];
+    rsq = delx*delx + dely*dely + delz*delz;
+    if (rsq >= cutsq[itype][jtype]) continue;
+
+    r2inv = 1.0/rsq;
+    r6inv = r2inv*r2inv*r2inv;
+    forcelj = r6inv * (lj1[itype][jtype]*r6inv - lj2[itype][jtype]);
+    fpair = factor_lj*forcelj*r2inv;
+
+    f[i][0] += delx*fpair;
+    f[i][1] += dely*fpair;
+    f[i][2] += delz*fpair;
+    if (newton_pair || j < nlocal) {
+      f[j][0] -= delx*fpair;
+      f[j][1] -= dely*fpair;
+      f[j][2] -= delz*fpair;
+    }
+
+    if (eflag) {
+      evdwl = r6inv*(lj3[itype][jtype]*r6inv-lj4[itype][jtype]) -
+        offset[itype][jtype];
+      evdwl *= factor_lj;
+    }
+
+    if (evflag) ev_tally(i,j,nlocal,newton_pair,
+                         evdwl,0.0,fpair,delx,dely,delz);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairLJCutCluster::init_style()
+{
+  if (domain->triclinic)
+    error->all(FLERR,"Pair style lj/cut/cluster requires an orthogonal box");
+  if (neighbor->exclude)
+    error->all(FLERR,"Pair style lj/cut/cluster does not support "
+               "neigh_modify exclude");
+  if (atom->molecular == 2)
+    error->all(FLERR,"Pair style lj/cut/cluster does not support "
+               "molecule templates");
+
+  // no neighbor list request, cluster pairs are built by this style
+  //   whenever the neighbor class reneighbors
+
+  if (cluster == NULL) cluster = new NeighCluster(lmp,0);
+  cluster_ncalls = -1;
+  cut_respa = NULL;
+}
+
+/* ----------------------------------------------------------------------
+   copy type pair coefficients into flat tables for the cluster kernel
+   called after init_one() has set them for all type pairs
+------------------------------------------------------------------------- */
+
+void PairLJCutCluster::flatten_coeffs()
+{
+  int ntypes = atom->ntypes;
+
+  if (ntable != ntypes+1) {
+    ntable = ntypes+1;
+    memory->destroy(cutsqf);
+    memory->destroy(lj1f);
+    memory->destroy(lj2f);
+    memory->destroy(lj3f);
+    memory->destroy(lj4f);
+    memory->destroy(offsetf);
+    memory->create(cutsqf,ntable*ntable,"pair:cutsqf");
+    memory->create(lj1f,ntable*ntable,"pair:lj1f");
+    memory->create(lj2f,ntable*ntable,"pair:lj2f");
+    memory->create(lj3f,ntable*ntable,"pair:lj3f");
+    memory->create(lj4f,ntable*ntable,"pair:lj4f");
+    memory->create(offsetf,ntable*ntable,"pair:offsetf");
+    memory->destroy(cutsqc);
+    memory->destroy(lj1c);
+    memory->destroy(lj2c);
+    memory->create(cutsqc,ntable*CLUSTERSIZE,"pair:cutsqc");
+    memory->create(lj1c,ntable*CLUSTERSIZE,"pair:lj1c");
+    memory->create(lj2c,ntable*CLUSTERSIZE,"pair:lj2c");
+  }
+
+  for (int i = 0; i < ntable; i++)
+    for (int j = 0; j < ntable; j++) {
+      int ij = i*ntable + j;
+      if (i == 0 || j == 0) {
+        cutsqf[ij] = lj1f[ij] = lj2f[ij] = lj3f[ij] = lj4f[ij] = 0.0;
+        offsetf[ij] = 0.0;
+        continue;
+      }
+      cutsqf[ij] = cutsq[i][j];
+      lj1f[ij] = lj1[i][j];
+      lj2f[ij] = lj2[i][j];
+      lj3f[ij] = lj3[i][j];
+      lj4f[ij] = lj4[i][j];
+      offsetf[ij] = offset[i][j];
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double PairLJCutCluster::memory_usage()
+{
+  double bytes = Pair::memory_usage();
+  bytes += 6*ntable*ntable * sizeof(double);
+  bytes += 3*ntable*CLUSTERSIZE * sizeof(double);
+  if (cluster) bytes += cluster->memory_usage();
+  return bytes;
+}
@@ -0,0 +1,80 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(lj/cut/coul/long/cluster,PairLJCutCoulLongCluster)
+
+#else
+
+#ifndef LMP_PAIR_LJ_CUT_COUL_LONG_CLUSTER_H
+#define LMP_PAIR_LJ_CUT_COUL_LONG_CLUSTER_H
+
+#include "pair_lj_cut_coul_long.h"
+
+namespace LAMMPS_NS {
+
+class PairLJCutCoulLongCluster : public PairLJCutCoulLong {
+ public:
+  PairLJCutCoulLongCluster(class LAMMPS *);
+  virtual ~PairLJCutCoulLongCluster();
+  virtual void compute(int, int);
+  virtual void init_style();
+  double memory_usage();
+
+ protected:
+  class NeighCluster *cluster;
+  bigint cluster_ncalls;        // neighbor->ncalls of last cluster build
+
+  // type pair coefficients as flat (ntypes+1)^2 tables, row 0 all zero
+
+  int ntable;
+  double *cut_ljsqf,*lj1f,*lj2f,*lj3f,*lj4f,*offsetf;
+
+  // force coefficients of the current I cluster, CLUSTERSIZE per J type
+
+  double *cut_ljsqc,*lj1c,*lj2c;
+
+  void flatten_coeffs();
+  template <int EVFLAG, int EFLAG> void eval();
+  void eval_special(int);
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Pair style lj/cut/coul/long/cluster requires atom attribute q
+
+The atom style defined does not have this attribute.
+
+E: Pair style lj/cut/coul/long/cluster requires an orthogonal box
+
+The cluster pair list is built in box coordinates.
+
+E: Pair style lj/cut/coul/long/cluster does not support neigh_modify exclude
+
+Exclusions are not applied when cluster pairs are built.
+
+E: Pair style lj/cut/coul/long/cluster does not support molecule templates
+
+Special neighbors are looked up from per-atom special lists only.
+
+E: Pair style requires a KSpace style
+
+No kspace style is defined.
+
+*/
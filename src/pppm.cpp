@@ -24,6 +24,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "pppm.h"
+#include "pppm_stencil.h"
 #include "atom.h"
 #include "comm.h"
 #include "gridcomm.h"
@@ -829,12 +830,12 @@ void PPPM::allocate()
   fft1 = new FFT3d(lmp,world,nx_pppm,ny_pppm,nz_pppm,
                    nxlo_fft,nxhi_fft,nylo_fft,nyhi_fft,nzlo_fft,nzhi_fft,
                    nxlo_fft,nxhi_fft,nylo_fft,nyhi_fft,nzlo_fft,nzhi_fft,
-                   0,0,&tmp,collective_flag);
+                   0,0,&tmp,collective_flag,fft_nbatch);
 
   fft2 = new FFT3d(lmp,world,nx_pppm,ny_pppm,nz_pppm,
                    nxlo_fft,nxhi_fft,nylo_fft,nyhi_fft,nzlo_fft,nzhi_fft,
                    nxlo_in,nxhi_in,nylo_in,nyhi_in,nzlo_in,nzhi_in,
-                   0,0,&tmp,collective_flag);
+                   0,0,&tmp,collective_flag,fft_nbatch);
 
   remap = new Remap(lmp,world,
                     nxlo_in,nxhi_in,nylo_in,nyhi_in,nzlo_in,nzhi_in,
@@ -1032,23 +1033,7 @@ void PPPM::set_grid_global()
         if (ny_pppm <= 1) ny_pppm = 2;
         if (nz_pppm <= 1) nz_pppm = 2;
 
-        //set local grid dimension
-        int npey_fft,npez_fft;
-        if (nz_pppm >= nprocs) {
-          npey_fft = 1;
-          npez_fft = nprocs;
-        } else procs2grid2d(nprocs,ny_pppm,nz_pppm,&npey_fft,&npez_fft);
-
-        int me_y = me % npey_fft;
-        int me_z = me / npey_fft;
-
-        nxlo_fft = 0;
-        nxhi_fft = nx_pppm - 1;
-        nylo_fft = me_y*ny_pppm/npey_fft;
-        nyhi_fft = (me_y+1)*ny_pppm/npey_fft - 1;
-        nzlo_fft = me_z*nz_pppm/npez_fft;
-        nzhi_fft = (me_z+1)*nz_pppm/npez_fft - 1;
-
+        set_fft_local();
         double df_kspace = compute_df_kspace();
 
         count++;
@@ -1062,6 +1047,25 @@ void PPPM::set_grid_global()
         h_x = h_y = h_z = h;
       }
 
+      // the interlaced grids of pppm/stagger reach the accuracy
+      //   with a much coarser grid, where 5% steps in h are large,
+      //   so shrink each dimension by itself while accuracy still holds
+
+      if (stagger_flag) {
+        int *ngrid[3] = {&nx_pppm,&ny_pppm,&nz_pppm};
+        for (int idim = 0; idim < 3; idim++) {
+          while (*ngrid[idim] > 2) {
+            (*ngrid[idim])--;
+            set_fft_local();
+            if (compute_df_kspace() > accuracy) {
+              (*ngrid[idim])++;
+              break;
+            }
+          }
+        }
+        set_fft_local();
+      }
+
     } else {
 
       double err;
@@ -1360,6 +1364,30 @@ double PPPM::final_accuracy()
   return estimated_accuracy;
 }
 
+/* ----------------------------------------------------------------------
+   set portion of global FFT grid that I own
+   only used for error estimates while set_grid_global() picks the grid
+------------------------------------------------------------------------- */
+
+void PPPM::set_fft_local()
+{
+  int npey_fft,npez_fft;
+  if (nz_pppm >= nprocs) {
+    npey_fft = 1;
+    npez_fft = nprocs;
+  } else procs2grid2d(nprocs,ny_pppm,nz_pppm,&npey_fft,&npez_fft);
+
+  int me_y = me % npey_fft;
+  int me_z = me / npey_fft;
+
+  nxlo_fft = 0;
+  nxhi_fft = nx_pppm - 1;
+  nylo_fft = me_y*ny_pppm/npey_fft;
+  nyhi_fft = (me_y+1)*ny_pppm/npey_fft - 1;
+  nzlo_fft = me_z*nz_pppm/npez_fft;
+  nzhi_fft = (me_z+1)*nz_pppm/npez_fft - 1;
+}
+
 /* ----------------------------------------------------------------------
    set local subset of PPPM/FFT grid that I own
    n xyz lo/hi in = 3d brick that I own (inclusive)
@@ -1429,7 +1457,7 @@ void PPPM::set_grid_local()
   double zprd_slab = zprd*slab_volfactor;
 
   double dist[3];
-  double cuthalf = 0.5*neighbor->skin + qdist;
+  double cuthalf = 0.5*neighbor->skinmax + qdist;
   if (triclinic == 0) dist[0] = dist[1] = dist[2] = cuthalf;
   else kspacebbox(cuthalf,&dist[0]);
 
@@ -1485,9 +1513,12 @@ void PPPM::set_grid_local()
   // me_y,me_z = which proc (0-npe_fft-1) I am in y,z dimensions
   // nlo_fft,nhi_fft = lower/upper limit of the section
   //   of the global FFT mesh that I own
+  // pipelined FFT transposes use the same np1 x np2 pencils as fft3d,
+  //   so no extra remap is needed before the 1st 1d FFTs
 
   int npey_fft,npez_fft;
-  if (nz_pppm >= nprocs) {
+  if (fft_nbatch) bifactor(nprocs,&npey_fft,&npez_fft);
+  else if (nz_pppm >= nprocs) {
     npey_fft = 1;
     npez_fft = nprocs;
   } else procs2grid2d(nprocs,ny_pppm,nz_pppm,&npey_fft,&npez_fft);
@@ -1950,6 +1981,8 @@ void PPPM::particle_map()
 
 void PPPM::make_rho()
 {
+  if (make_rho_special(NULL,atom->nlocal)) return;
+
   int l,m,n,nx,ny,nz,mx,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
 
@@ -2452,6 +2485,8 @@ void PPPM::fieldforce()
 
 void PPPM::fieldforce_ik()
 {
+  if (fieldforce_ik_special(NULL,atom->nlocal)) return;
+
   int i,l,m,n,nx,ny,nz,mx,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
   FFT_SCALAR ekx,eky,ekz;
@@ -2510,6 +2545,8 @@ void PPPM::fieldforce_ik()
 
 void PPPM::fieldforce_ad()
 {
+  if (fieldforce_ad_special(NULL,atom->nlocal)) return;
+
   int i,l,m,n,nx,ny,nz,mx,my,mz;
   FFT_SCALAR dx,dy,dz;
   FFT_SCALAR ekx,eky,ekz;
@@ -2591,6 +2628,183 @@ void PPPM::fieldforce_ad()
   }
 }
 
+/* ----------------------------------------------------------------------
+   dispatch charge assignment to the loop specialized for order
+------------------------------------------------------------------------- */
+
+int PPPM::make_rho_special(int *list, int inum)
+{
+  switch (order) {
+  case 3: make_rho_order<3>(list,inum); break;
+  case 4: make_rho_order<4>(list,inum); break;
+  case 5: make_rho_order<5>(list,inum); break;
+  case 6: make_rho_order<6>(list,inum); break;
+  case 7: make_rho_order<7>(list,inum); break;
+  default: return 0;
+  }
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   dispatch ik interpolation to the loop specialized for order
+------------------------------------------------------------------------- */
+
+int PPPM::fieldforce_ik_special(int *list, int inum)
+{
+  switch (order) {
+  case 3: fieldforce_ik_order<3>(list,inum); break;
+  case 4: fieldforce_ik_order<4>(list,inum); break;
+  case 5: fieldforce_ik_order<5>(list,inum); break;
+  case 6: fieldforce_ik_order<6>(list,inum); break;
+  case 7: fieldforce_ik_order<7>(list,inum); break;
+  default: return 0;
+  }
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   dispatch ad interpolation to the loop specialized for order
+------------------------------------------------------------------------- */
+
+int PPPM::fieldforce_ad_special(int *list, int inum)
+{
+  switch (order) {
+  case 3: fieldforce_ad_order<3>(list,inum); break;
+  case 4: fieldforce_ad_order<4>(list,inum); break;
+  case 5: fieldforce_ad_order<5>(list,inum); break;
+  case 6: fieldforce_ad_order<6>(list,inum); break;
+  case 7: fieldforce_ad_order<7>(list,inum); break;
+  default: return 0;
+  }
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   same as make_rho() with stencil order known at compile time
+------------------------------------------------------------------------- */
+
+template <int ORDER>
+void PPPM::make_rho_order(int *list, int inum)
+{
+  FFT_SCALAR wx[ORDER],wy[ORDER],wz[ORDER];
+
+  memset(&(density_brick[nzlo_out][nylo_out][nxlo_out]),0,
+         ngrid*sizeof(FFT_SCALAR));
+
+  double *q = atom->q;
+  double **x = atom->x;
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = list ? list[ii] : ii;
+    const int nx = part2grid[i][0];
+    const int ny = part2grid[i][1];
+    const int nz = part2grid[i][2];
+
+    const FFT_SCALAR dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
+    const FFT_SCALAR dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
+    const FFT_SCALAR dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
+
+    PPPMStencil::weights<ORDER,ORDER>(wx,wy,wz,dx,dy,dz,rho_coeff);
+
+    PPPMStencil::spread<ORDER>(density_brick,nx,ny,nz,wx,wy,wz,
+                               delvolinv*q[i]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same as fieldforce_ik() with stencil order known at compile time
+------------------------------------------------------------------------- */
+
+template <int ORDER>
+void PPPM::fieldforce_ik_order(int *list, int inum)
+{
+  FFT_SCALAR wx[ORDER],wy[ORDER],wz[ORDER];
+  FFT_SCALAR ek[3];
+
+  double *q = atom->q;
+  double **x = atom->x;
+  double **f = atom->f;
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = list ? list[ii] : ii;
+    const int nx = part2grid[i][0];
+    const int ny = part2grid[i][1];
+    const int nz = part2grid[i][2];
+
+    const FFT_SCALAR dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
+    const FFT_SCALAR dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
+    const FFT_SCALAR dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
+
+    PPPMStencil::weights<ORDER,ORDER>(wx,wy,wz,dx,dy,dz,rho_coeff);
+
+    PPPMStencil::gather_ik<ORDER>(vdx_brick,vdy_brick,vdz_brick,
+                                  nx,ny,nz,wx,wy,wz,ek);
+
+    const double qfactor = qqrd2e * scale * q[i];
+    f[i][0] += qfactor*ek[0];
+    f[i][1] += qfactor*ek[1];
+    if (slabflag != 2) f[i][2] += qfactor*ek[2];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   same as fieldforce_ad() with stencil order known at compile time
+------------------------------------------------------------------------- */
+
+template <int ORDER>
+void PPPM::fieldforce_ad_order(int *list, int inum)
+{
+  FFT_SCALAR wx[ORDER],wy[ORDER],wz[ORDER];
+  FFT_SCALAR dwx[ORDER],dwy[ORDER],dwz[ORDER];
+  FFT_SCALAR ek[3];
+  double sf;
+
+  double *prd = domain->prd;
+  const double hx_inv = nx_pppm/prd[0];
+  const double hy_inv = ny_pppm/prd[1];
+  const double hz_inv = nz_pppm/prd[2];
+
+  double *q = atom->q;
+  double **x = atom->x;
+  double **f = atom->f;
+
+  const double qfactor = qqrd2e * scale;
+
+  for (int ii = 0; ii < inum; ii++) {
+    const int i = list ? list[ii] : ii;
+    const int nx = part2grid[i][0];
+    const int ny = part2grid[i][1];
+    const int nz = part2grid[i][2];
+    const FFT_SCALAR dx = nx+shiftone - (x[i][0]-boxlo[0])*delxinv;
+    const FFT_SCALAR dy = ny+shiftone - (x[i][1]-boxlo[1])*delyinv;
+    const FFT_SCALAR dz = nz+shiftone - (x[i][2]-boxlo[2])*delzinv;
+
+    PPPMStencil::weights<ORDER,ORDER>(wx,wy,wz,dx,dy,dz,rho_coeff);
+    PPPMStencil::weights<ORDER,ORDER-1>(dwx,dwy,dwz,dx,dy,dz,drho_coeff);
+
+    PPPMStencil::gather_ad<ORDER>(u_brick,nx,ny,nz,wx,wy,wz,dwx,dwy,dwz,ek);
+
+    // convert E-field to force and substract self forces
+
+    const double s1 = x[i][0]*hx_inv;
+    const double s2 = x[i][1]*hy_inv;
+    const double s3 = x[i][2]*hz_inv;
+    const double qsq2 = 2*q[i]*q[i];
+
+    sf = sf_coeff[0]*sin(2*MY_PI*s1);
+    sf += sf_coeff[1]*sin(4*MY_PI*s1);
+    f[i][0] += qfactor*(ek[0]*hx_inv*q[i] - sf*qsq2);
+
+    sf = sf_coeff[2]*sin(2*MY_PI*s2);
+    sf += sf_coeff[3]*sin(4*MY_PI*s2);
+    f[i][1] += qfactor*(ek[1]*hy_inv*q[i] - sf*qsq2);
+
+    sf = sf_coeff[4]*sin(2*MY_PI*s3);
+    sf += sf_coeff[5]*sin(4*MY_PI*s3);
+    if (slabflag != 2) f[i][2] += qfactor*(ek[2]*hz_inv*q[i] - sf*qsq2);
+  }
+}
+
 /* ----------------------------------------------------------------------
    interpolate from grid to get per-atom energy/virial
 ------------------------------------------------------------------------- */
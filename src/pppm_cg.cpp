@@ -323,6 +323,8 @@ void PPPMCG::particle_map()
 
 void PPPMCG::make_rho()
 {
+  if (make_rho_special(is_charged,num_charged)) return;
+
   int i,l,m,n,nx,ny,nz,mx,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
 
@@ -372,6 +374,8 @@ void PPPMCG::make_rho()
 
 void PPPMCG::fieldforce_ik()
 {
+  if (fieldforce_ik_special(is_charged,num_charged)) return;
+
   int i,l,m,n,nx,ny,nz,mx,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
   FFT_SCALAR ekx,eky,ekz;
@@ -430,6 +434,8 @@ void PPPMCG::fieldforce_ik()
 
 void PPPMCG::fieldforce_ad()
 {
+  if (fieldforce_ad_special(is_charged,num_charged)) return;
+
   int i,l,m,n,nx,ny,nz,mx,my,mz;
   FFT_SCALAR dx,dy,dz;
   FFT_SCALAR ekx,eky,ekz;
@@ -2752,7 +2752,7 @@ void PPPMDisp::set_fft_parameters(int& nx_p,int& ny_p,int& nz_p,
   double zprd_slab = zprd*slab_volfactor;
 
   double dist[3];
-  double cuthalf = 0.5*neighbor->skin + qdist;
+  double cuthalf = 0.5*neighbor->skinmax + qdist;
   if (triclinic == 0) dist[0] = dist[1] = dist[2] = cuthalf;
   else {
     dist[0] = cuthalf/domain->prd[0];
@@ -30,14 +30,33 @@ class PPPMStagger : public PPPM {
   virtual ~PPPMStagger();
   virtual void init();
   virtual void compute(int, int);
-  virtual int timing_1d(int, double &);
-  virtual int timing_3d(int, double &);
+  virtual double memory_usage();
 
  protected:
   int nstagger;
   double stagger;
   double **gf_b2;
 
+  // 2nd grid, shifted by half a grid spacing
+  // both grids are solved together, their densities are packed
+  //   as real and imaginary part of one complex FFT
+
+  FFT_SCALAR ***density_brick2;
+  FFT_SCALAR ***vdx_brick2,***vdy_brick2,***vdz_brick2;
+  FFT_SCALAR ***u_brick2;
+  FFT_SCALAR *density_fft2;
+  int **part2grid2;
+  int nmax2;
+
+  virtual void allocate();
+  virtual void deallocate();
+  void deallocate_interlaced();
+  void swap_grids();
+  void compute_sequential();
+  void compute_interlaced();
+  void poisson_ik_interlaced();
+  void poisson_ad_interlaced();
+
   virtual double compute_qopt();
   double compute_qopt_ad();
   virtual void compute_gf_denom();
@@ -50,6 +69,10 @@ class PPPMStagger : public PPPM {
   virtual void fieldforce_ad();
   virtual void fieldforce_peratom();
 
+  virtual void pack_forward(int, FFT_SCALAR *, int, int *);
+  virtual void unpack_forward(int, FFT_SCALAR *, int, int *);
+  virtual void pack_reverse(int, FFT_SCALAR *, int, int *);
+  virtual void unpack_reverse(int, FFT_SCALAR *, int, int *);
 
   inline double gf_denom2(const double &x, const double &y,
                          const double &z) const
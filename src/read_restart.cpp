@@ -62,7 +62,7 @@ enum{VERSION,SMALLINT,TAGINT,BIGINT,
      MULTIPROC,MPIIO,PROCSPERFILE,PERPROC,
      IMAGEINT,BOUNDMIN,TIMESTEP,
      ATOM_ID,ATOM_MAP_STYLE,ATOM_MAP_USER,ATOM_SORTFREQ,ATOM_SORTBIN,
-     COMM_MODE,COMM_CUTOFF,COMM_VEL};
+     COMM_MODE,COMM_CUTOFF,COMM_VEL,ATOM_SORTORDER};
 
 #define LB_FACTOR 1.1
 
@@ -900,6 +900,8 @@ void ReadRestart::header(int incompatible)
       atom->sortfreq = read_int();
     } else if (flag == ATOM_SORTBIN) {
       atom->userbinsize = read_double();
+    } else if (flag == ATOM_SORTORDER) {
+      atom->sortorder = read_int();
 
     } else if (flag == COMM_MODE) {
       comm->mode = read_int();
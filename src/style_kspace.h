@@ -1,5 +1,6 @@
 #include "ewald.h"
 #include "ewald_disp.h"
+#include "fmm.h"
 #include "msm.h"
 #include "msm_cg.h"
 #include "pppm.h"
@@ -1,5 +1,6 @@
 #include "pair_CAC.h"
 #include "pair_CAC_Pb.h"
+#include "pair_CAC_adapter.h"
 #include "pair_CAC_buck.h"
 #include "pair_CAC_coul_wolf.h"
 #include "pair_CAC_eam.h"
@@ -52,10 +53,12 @@
 #include "pair_lj_charmmfsw_coul_long.h"
 #include "pair_lj_cubic.h"
 #include "pair_lj_cut.h"
+#include "pair_lj_cut_cluster.h"
 #include "pair_lj_cut_coul_cut.h"
 #include "pair_lj_cut_coul_debye.h"
 #include "pair_lj_cut_coul_dsf.h"
 #include "pair_lj_cut_coul_long.h"
+#include "pair_lj_cut_coul_long_cluster.h"
 #include "pair_lj_cut_coul_msm.h"
 #include "pair_lj_cut_coul_wolf.h"
 #include "pair_lj_cut_tip4p_cut.h"
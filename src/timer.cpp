@@ -18,6 +18,10 @@
 #include "comm.h"
 #include "error.h"
 #include "force.h"
+#include "modify.h"
+#include "fix.h"
+#include "output.h"
+#include "dump.h"
 #include "memory.h"
 
 #ifdef _WIN32
@@ -32,6 +36,14 @@
 
 using namespace LAMMPS_NS;
 
+#define TRACEMAX 100000
+#define TRACEDELTA 4096
+
+static const char *phase_name[] = {
+  "Total","Pair","Bond","Kspace","Neigh","Comm","Modify","Output","Sync",
+  "All","Dephase","Dynamics","Quench","Neb","Repcomm","Repout"
+};
+
 // convert a timespec ([[HH:]MM:]SS) to seconds
 // the strings "off" and "unlimited" result in -1;
 
@@ -99,17 +111,43 @@ Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
   _s_timeout = -1;
   _checkfreq = 10;
   _nextcheck = -1;
+
+  _traceflag = 0;
+  _trace = NULL;
+  _ntrace = _tracealloc = 0;
+  _maxtrace = TRACEMAX;
+  _trace_full = 0;
+  _trace_first = 1;
+  _tracebuf = NULL;
+  _trace_origin = 0.0;
+
   this->_stamp(RESET);
 }
 
 /* ---------------------------------------------------------------------- */
 
+Timer::~Timer()
+{
+  _close_trace();
+  memory->destroy(_tracebuf);
+}
+
+/* ----------------------------------------------------------------------
+   zero all timers at start of a run
+   also zero per-fix and per-dump timers of Modify and Output
+------------------------------------------------------------------------- */
+
 void Timer::init()
 {
   for (int i = 0; i < NUM_TIMER; i++) {
     cpu_array[i] = 0.0;
     wall_array[i] = 0.0;
   }
+
+  _ntrace = 0;
+  _trace_full = 0;
+  if (modify) modify->reset_timing(has_detail());
+  if (output) output->reset_timing(has_detail());
 }
 
 /* ---------------------------------------------------------------------- */
@@ -129,6 +167,8 @@ void Timer::_stamp(enum ttype which)
     wall_array[which] += delta_wall;
     cpu_array[ALL]    += delta_cpu;
     wall_array[ALL]   += delta_wall;
+
+    if (which != ALL) trace(PHASE,which,previous_wall,current_wall);
   }
 
   previous_cpu  = current_cpu;
@@ -300,6 +340,32 @@ void Timer::modify_params(int narg, char **arg)
       if (iarg < narg) {
         _timeout = timespec2seconds(arg[iarg]);
       } else error->all(FLERR,"Illegal timers command");
+    } else if (strcmp(arg[iarg],"trace") == 0) {
+      ++iarg;
+      if (iarg >= narg) error->all(FLERR,"Illegal timers command");
+      _close_trace();
+      if (strcmp(arg[iarg],"off") == 0) _traceflag = 0;
+      else {
+        _traceflag = 1;
+        if (comm->me == 0) {
+          _trace = fopen(arg[iarg],"w");
+          if (_trace == NULL) {
+            char str[128];
+            snprintf(str,128,"Cannot open timer trace file %s",arg[iarg]);
+            error->one(FLERR,str);
+          }
+          _write_trace_header();
+        }
+        MPI_Barrier(world);
+        _trace_origin = MPI_Wtime();
+      }
+    } else if (strcmp(arg[iarg],"tracemax") == 0) {
+      ++iarg;
+      if (iarg < narg) {
+        _maxtrace = force->inumeric(FLERR,arg[iarg]);
+        if (_maxtrace <= 0)
+          error->all(FLERR,"Illegal timers command");
+      } else error->all(FLERR,"Illegal timers command");
     } else if (strcmp(arg[iarg],"every") == 0) {
       ++iarg;
       if (iarg < narg) {
@@ -329,3 +395,148 @@ void Timer::modify_params(int narg, char **arg)
       fprintf(logfile,timer_fmt,timer_style[_level],timer_mode[_sync],timebuf);
   }
 }
+
+/* ----------------------------------------------------------------------
+   store one event of the trace
+------------------------------------------------------------------------- */
+
+void Timer::_add_trace(enum tkind kind, int index, double start, double stop)
+{
+  if (_ntrace == _tracealloc) {
+    _tracealloc += TRACEDELTA;
+    if (_tracealloc > _maxtrace) _tracealloc = _maxtrace;
+    memory->grow(_tracebuf,4*_tracealloc,"timer:tracebuf");
+  }
+
+  double *event = &_tracebuf[4*_ntrace++];
+  event[0] = kind;
+  event[1] = index;
+  event[2] = start - _trace_origin;
+  event[3] = stop - start;
+}
+
+/* ----------------------------------------------------------------------
+   append events of the run on all procs to the trace file
+   file is in Chrome trace event format, one thread per proc
+   called by all procs at end of a run
+------------------------------------------------------------------------- */
+
+void Timer::write_trace()
+{
+  if (!_traceflag) return;
+
+  int me = comm->me;
+  int nprocs = comm->nprocs;
+
+  int flag = _trace_full;
+  int flagall;
+  MPI_Allreduce(&flag,&flagall,1,MPI_INT,MPI_MAX,world);
+  if (flagall && me == 0)
+    error->warning(FLERR,"Timer trace was truncated, increase timer tracemax");
+
+  // proc 0 pings each proc, receives its events, writes them to file
+
+  int tmp,n;
+  double *events;
+
+  if (me == 0) {
+    int maxrecv = 0;
+    double *recvbuf = NULL;
+
+    for (int iproc = 0; iproc < nprocs; iproc++) {
+      if (iproc) {
+        MPI_Send(&tmp,0,MPI_INT,iproc,0,world);
+        MPI_Recv(&n,1,MPI_INT,iproc,0,world,MPI_STATUS_IGNORE);
+        if (n > maxrecv) {
+          maxrecv = n;
+          memory->destroy(recvbuf);
+          memory->create(recvbuf,4*maxrecv,"timer:recvbuf");
+        }
+        MPI_Recv(recvbuf,4*n,MPI_DOUBLE,iproc,0,world,MPI_STATUS_IGNORE);
+        events = recvbuf;
+      } else {
+        n = _ntrace;
+        events = _tracebuf;
+      }
+
+      for (int i = 0; i < n; i++)
+        _write_trace_event(iproc,&events[4*i]);
+    }
+
+    memory->destroy(recvbuf);
+    fflush(_trace);
+
+  } else {
+    MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
+    MPI_Send(&_ntrace,1,MPI_INT,0,0,world);
+    MPI_Send(_tracebuf,4*_ntrace,MPI_DOUBLE,0,0,world);
+  }
+
+  _ntrace = 0;
+  _trace_full = 0;
+}
+
+/* ----------------------------------------------------------------------
+   start trace file with a name for the thread of each proc
+------------------------------------------------------------------------- */
+
+void Timer::_write_trace_header()
+{
+  fprintf(_trace,"[\n");
+  _trace_first = 1;
+  for (int iproc = 0; iproc < comm->nprocs; iproc++) {
+    if (!_trace_first) fprintf(_trace,",\n");
+    _trace_first = 0;
+    fprintf(_trace,"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+            "\"tid\":%d,\"args\":{\"name\":\"proc %d\"}}",iproc,iproc);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   write one event of proc iproc as a complete event with times in usec
+   fixes and dumps are named by their ID
+------------------------------------------------------------------------- */
+
+void Timer::_write_trace_event(int iproc, double *event)
+{
+  int kind = static_cast<int> (event[0]);
+  int index = static_cast<int> (event[1]);
+
+  const char *category,*prefix,*name;
+  if (kind == FIX) {
+    category = "fix";
+    prefix = "fix ";
+    name = (index < modify->nfix) ? modify->fix[index]->id : "unknown";
+  } else if (kind == DUMP) {
+    category = "dump";
+    prefix = "dump ";
+    name = (index < output->ndump) ? output->dump[index]->id : "unknown";
+  } else if (kind == THERMO) {
+    category = "output";
+    prefix = "";
+    name = "Thermo";
+  } else {
+    category = "phase";
+    prefix = "";
+    name = phase_name[index];
+  }
+
+  if (!_trace_first) fprintf(_trace,",\n");
+  _trace_first = 0;
+  fprintf(_trace,"{\"name\":\"%s%s\",\"cat\":\"%s\",\"ph\":\"X\","
+          "\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+          prefix,name,category,iproc,event[2]*1.0e6,event[3]*1.0e6);
+}
+
+/* ----------------------------------------------------------------------
+   end the list of events and close trace file
+------------------------------------------------------------------------- */
+
+void Timer::_close_trace()
+{
+  if (_trace) {
+    fprintf(_trace,"\n]\n");
+    fclose(_trace);
+  }
+  _trace = NULL;
+}
@@ -26,9 +26,10 @@ class Timer : protected Pointers {
                MODIFY,OUTPUT,SYNC,ALL,DEPHASE,DYNAMICS,QUENCH,NEB,REPCOMM,
                REPOUT,NUM_TIMER};
   enum tlevel {OFF=0,LOOP,NORMAL,FULL};
+  enum tkind  {PHASE=0,FIX,DUMP,THERMO};
 
   Timer(class LAMMPS *);
-  ~Timer() {};
+  ~Timer();
   void init();
 
   // inline function to reduce overhead if we want no detailed timings
@@ -46,6 +47,12 @@ class Timer : protected Pointers {
   bool has_normal() const { return (_level >= NORMAL); }
   bool has_full()   const { return (_level >= FULL); }
   bool has_sync()   const { return (_sync  != OFF); }
+  bool has_trace()  const { return (_traceflag != 0); }
+
+  // per-fix and per-dump timings are accumulated by Modify and Output
+  //   with full timer detail or when a trace is written
+
+  bool has_detail() const { return (_level >= FULL || _traceflag); }
 
   // flag if wallclock time is expired
   bool is_timeout() const { return (_timeout == 0.0); }
@@ -85,6 +92,16 @@ class Timer : protected Pointers {
 
   void modify_params(int, char **);
 
+  // add one event to the trace, times are MPI_Wtime() values
+
+  void trace(enum tkind kind, int index, double start, double stop) {
+    if (!_traceflag) return;
+    if (_ntrace < _maxtrace) _add_trace(kind,index,start,stop);
+    else _trace_full = 1;
+  }
+
+  void write_trace();
+
  private:
   double cpu_array[NUM_TIMER];
   double wall_array[NUM_TIMER];
@@ -103,6 +120,24 @@ class Timer : protected Pointers {
 
   // check for timeout
   bool _check_timeout();
+
+  // timeline of phases, fixes, and dumps during runs
+  // each event = kind, index, start, stop, written at end of each run
+
+  int _traceflag;      // 1 if writing a trace, 0 if not
+  FILE *_trace;        // trace file, only open on proc 0
+  int _ntrace;         // # of events stored since start of run
+  int _maxtrace;       // max # of events stored per run
+  int _tracealloc;     // allocated # of events in _tracebuf
+  int _trace_full;     // 1 if events were dropped since buffer was full
+  int _trace_first;    // 1 if no event has been written to file yet
+  double *_tracebuf;   // stored events, 4 values per event
+  double _trace_origin;  // wall time of time 0 in the trace
+
+  void _add_trace(enum tkind, int, double, double);
+  void _write_trace_header();
+  void _write_trace_event(int, double *);
+  void _close_trace();
 };
 
 }
@@ -117,4 +152,14 @@ Self-explanatory.  Check the input script syntax and compare to the
 documentation for the command.  You can use -echo screen as a
 command-line option when running LAMMPS to see the offending line.
 
+E: Cannot open timer trace file %s
+
+The specified file cannot be opened.  Check that the path and name are
+correct.
+
+W: Timer trace was truncated, increase timer tracemax
+
+More events occurred during the run than can be stored per processor.
+Events after the buffer was full are missing from the trace file.
+
 */
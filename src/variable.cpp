@@ -94,9 +94,13 @@ Variable::Variable(LAMMPS *lmp) : Pointers(lmp)
   data = NULL;
   dvalue = NULL;
   vecs = NULL;
+  comps = NULL;
 
   eval_in_progress = NULL;
 
+  generation = 0;
+  compiling = 0;
+
   randomequal = NULL;
   randomatom = NULL;
 
@@ -124,6 +128,7 @@ Variable::~Variable()
     else for (int j = 0; j < num[i]; j++) delete [] data[i][j];
     delete [] data[i];
     if (style[i] == VECTOR) memory->destroy(vecs[i].values);
+    if (comps[i].tree) free_tree(comps[i].tree);
   }
   memory->sfree(names);
   memory->destroy(style);
@@ -134,6 +139,7 @@ Variable::~Variable()
   memory->sfree(data);
   memory->sfree(dvalue);
   memory->sfree(vecs);
+  memory->sfree(comps);
 
   memory->destroy(eval_in_progress);
 
@@ -152,6 +158,10 @@ void Variable::set(int narg, char **arg)
 
   int replaceflag = 0;
 
+  // cached parse trees may have inlined the formula of a redefined variable
+
+  generation++;
+
   // DELETE
   // doesn't matter if variable no longer exists
 
@@ -852,7 +862,10 @@ char *Variable::retrieve(char *name)
     strcpy(data[ivar][0],result);
     str = data[ivar][0];
   } else if (style[ivar] == EQUAL) {
-    double answer = evaluate(data[ivar][0],NULL,ivar);
+    double answer;
+    Tree *tree = cached_tree(ivar);
+    if (tree) answer = tree->value;
+    else answer = evaluate(data[ivar][0],NULL,ivar);
     sprintf(data[ivar][1],"%.15g",answer);
     str = data[ivar][1];
   } else if (style[ivar] == FORMAT) {
@@ -911,8 +924,11 @@ double Variable::compute_equal(int ivar)
   eval_in_progress[ivar] = 1;
 
   double value = 0.0;
-  if (style[ivar] == EQUAL) value = evaluate(data[ivar][0],NULL,ivar);
-  else if (style[ivar] == INTERNAL) value = dvalue[ivar];
+  if (style[ivar] == EQUAL) {
+    Tree *tree = cached_tree(ivar);
+    if (tree) value = tree->value;
+    else value = evaluate(data[ivar][0],NULL,ivar);
+  } else if (style[ivar] == INTERNAL) value = dvalue[ivar];
   else if (style[ivar] == PYTHON) {
     int ifunc = python->find(data[ivar][0]);
     if (ifunc < 0)
@@ -948,19 +964,32 @@ void Variable::compute_atom(int ivar, int igroup,
 {
   Tree *tree;
   double *vstore;
+  int cached = 0;
 
   if (eval_in_progress[ivar])
     print_var_error(FLERR,"Variable has a circular dependency",ivar);
 
   eval_in_progress[ivar] = 1;
 
+  // use cached parse tree if possible, else parse formula for this call
+
   if (style[ivar] == ATOM) {
-    treetype = ATOM;
-    evaluate(data[ivar][0],&tree,ivar);
-    collapse_tree(tree);
+    tree = cached_tree(ivar);
+    if (tree) cached = 1;
+    else {
+      int savecompile = compiling;
+      int savetype = treetype;
+      compiling = 0;
+      treetype = ATOM;
+      evaluate(data[ivar][0],&tree,ivar);
+      collapse_tree(tree);
+      compiling = savecompile;
+      treetype = savetype;
+    }
   } else vstore = reader[ivar]->fixstore->vstore;
 
   if (result == NULL) {
+    if (style[ivar] == ATOM && !cached) free_tree(tree);
     eval_in_progress[ivar] = 0;
     return;
   }
@@ -1004,7 +1033,7 @@ void Variable::compute_atom(int ivar, int igroup,
     }
   }
 
-  if (style[ivar] == ATOM) free_tree(tree);
+  if (style[ivar] == ATOM && !cached) free_tree(tree);
   eval_in_progress[ivar] = 0;
 }
 
@@ -1029,9 +1058,14 @@ int Variable::compute_vector(int ivar, double **result)
 
   eval_in_progress[ivar] = 1;
 
+  int savecompile = compiling;
+  int savetype = treetype;
+  compiling = 0;
   treetype = VECTOR;
   evaluate(data[ivar][0],&tree,ivar);
   collapse_tree(tree);
+  compiling = savecompile;
+  treetype = savetype;
   int nlen = size_tree_vector(tree);
   if (nlen == 0)
     print_var_error(FLERR,"Vector-style variable has zero length",ivar);
@@ -1081,6 +1115,7 @@ void Variable::remove(int n)
   else for (int i = 0; i < num[n]; i++) delete [] data[n][i];
   delete [] data[n];
   delete reader[n];
+  if (comps[n].tree) free_tree(comps[n].tree);
 
   for (int i = n+1; i < nvar; i++) {
     names[i-1] = names[i];
@@ -1090,8 +1125,11 @@ void Variable::remove(int n)
     pad[i-1] = pad[i];
     reader[i-1] = reader[i];
     data[i-1] = data[i];
+    comps[i-1] = comps[i];
   }
+  comps[nvar-1].tree = NULL;
   nvar--;
+  generation++;
 }
 
 /* ----------------------------------------------------------------------
@@ -1122,6 +1160,14 @@ void Variable::grow()
     vecs[i].values = NULL;
   }
 
+  comps = (CompVar *)
+    memory->srealloc(comps,maxvar*sizeof(CompVar),"var:compvar");
+  for (int i = old; i < maxvar; i++) {
+    comps[i].tree = NULL;
+    comps[i].generation = -1;
+    comps[i].runonly = 0;
+  }
+
   memory->grow(eval_in_progress,maxvar,"var:eval_in_progress");
   for (int i = 0; i < maxvar; i++) eval_in_progress[i] = 0;
 }
@@ -1399,7 +1445,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket == 0 && compute->vector_flag) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Compute global vector in "
                             "equal-style variable formula",ivar);
           if (treetype == ATOM)
@@ -1431,7 +1477,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket == 1 && compute->array_flag) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Compute global vector in "
                             "equal-style variable formula",ivar);
           if (treetype == ATOM)
@@ -1507,7 +1553,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         } else if (nbracket == 0 && compute->peratom_flag &&
                    compute->size_peratom_cols == 0) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Per-atom compute in "
                             "equal-style variable formula",ivar);
           if (treetype == VECTOR)
@@ -1536,7 +1582,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         } else if (nbracket == 1 && compute->peratom_flag &&
                    compute->size_peratom_cols > 0) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Per-atom compute in "
                             "equal-style variable formula",ivar);
           if (treetype == VECTOR)
@@ -1679,7 +1725,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
           if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
             print_var_error(FLERR,"Fix in variable not computed at compatible time",ivar);
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Fix global vector in ""equal-style variable formula",ivar);
           if (treetype == ATOM)
             print_var_error(FLERR,"Fix global vector in ""atom-style variable formula",ivar);
@@ -1709,7 +1755,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
           if (update->whichflag > 0 && update->ntimestep % fix->global_freq)
             print_var_error(FLERR,"Fix in variable not computed "
                             "at a compatible time",ivar);
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Fix global vector in "
                             "equal-style variable formula",ivar);
           if (treetype == ATOM)
@@ -1774,7 +1820,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         } else if (nbracket == 0 && fix->peratom_flag &&
                    fix->size_peratom_cols == 0) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Per-atom fix in equal-style variable formula",ivar);
           if (update->whichflag > 0 &&
               update->ntimestep % fix->peratom_freq)
@@ -1794,7 +1840,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         } else if (nbracket == 1 && fix->peratom_flag &&
                    fix->size_peratom_cols > 0) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Per-atom fix in equal-style variable formula",ivar);
           if (index1 > fix->size_peratom_cols)
             print_var_error(FLERR,"Variable formula fix array "
@@ -1883,7 +1929,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket == 0 && style[ivar] == ATOM) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Atom-style variable in "
                             "equal-style variable formula",ivar);
           if (treetype == VECTOR)
@@ -1898,7 +1944,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket == 0 && style[ivar] == ATOMFILE) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Atomfile-style variable in "
                             "equal-style variable formula",ivar);
           if (treetype == VECTOR)
@@ -1919,7 +1965,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         } else if (nbracket == 0 && style[ivar] == VECTOR) {
 
-          if (tree == NULL)
+          if (tree == NULL || treetype == EQUAL)
             print_var_error(FLERR,"Vector-style variable in "
                             "equal-style variable formula",ivar);
           if (treetype == ATOM)
@@ -2079,6 +2125,20 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         }
       }
 
+      // when compiling a cached tree, save formula text of a new leaf
+      // so that refresh_tree() can re-evaluate it each time tree is used
+
+      if (tree && compiling) {
+        Tree *leaftree = treestack[ntreestack-1];
+        if (leaftree->leaf == NULL && leaftree->first == NULL &&
+            leaftree->second == NULL && leaftree->nextra == 0) {
+          n = i - istart;
+          leaftree->leaf = new char[n+1];
+          strncpy(leaftree->leaf,&str[istart],n);
+          leaftree->leaf[n] = '\0';
+        }
+      }
+
       delete [] word;
 
     // ----------------
@@ -2329,8 +2389,10 @@ double Variable::collapse_tree(Tree *tree)
     arg2 = collapse_tree(tree->second);
     if (tree->first->type != VALUE || tree->second->type != VALUE) return 0.0;
     tree->type = VALUE;
-    if (arg2 == 0.0) error->one(FLERR,"Power by 0 in variable formula");
-    tree->value = pow(arg1,arg2);
+    if (arg2 == 0.0) tree->value = 1.0;
+    else if ((arg1 == 0.0) && (arg2 < 0.0))
+      error->one(FLERR,"Invalid power expression in variable formula");
+    else tree->value = pow(arg1,arg2);
     return tree->value;
   }
 
@@ -2712,8 +2774,7 @@ double Variable::collapse_tree(Tree *tree)
       if (update->ntimestep < ivalue4 || update->ntimestep > ivalue5) {
         int offset = update->ntimestep - ivalue1;
         istep = ivalue1 + (offset/ivalue3)*ivalue3 + ivalue3;
-        if (update->ntimestep < ivalue2 && istep > ivalue4)
-          tree->value = ivalue4;
+        if (update->ntimestep < ivalue4 && istep > ivalue4) istep = ivalue4;
       } else {
         int offset = update->ntimestep - ivalue4;
         istep = ivalue4 + (offset/ivalue6)*ivalue6 + ivalue6;
@@ -2777,10 +2838,152 @@ double Variable::collapse_tree(Tree *tree)
   return 0.0;
 }
 
+/* ----------------------------------------------------------------------
+   return cached parse tree of an equal-style or atom-style variable,
+     refreshed and collapsed for evaluation on the current timestep
+   tree is compiled from the formula string on first use and kept
+     until any variable is (re)defined or deleted
+   leaves of the tree are re-evaluated from their text in the formula,
+     so values of computes, fixes, thermo keywords, variables and
+     pointers to per-atom vectors are current
+   for equal-style, root of returned tree is a VALUE
+   return NULL if formula cannot be cached, caller must parse it instead
+------------------------------------------------------------------------- */
+
+Variable::Tree *Variable::cached_tree(int ivar)
+{
+  Tree *tree;
+
+  int savecompile = compiling;
+  int saveok = compile_ok;
+  int saverunonly = compile_runonly;
+  int savetype = treetype;
+
+  if (comps[ivar].generation != generation) {
+    if (comps[ivar].tree) free_tree(comps[ivar].tree);
+    comps[ivar].tree = NULL;
+    comps[ivar].generation = generation;
+    comps[ivar].runonly = 0;
+
+    // next() reads from a file when it is parsed, never cache it
+
+    if (strstr(data[ivar][0],"next(")) return NULL;
+
+    compiling = style[ivar];
+    compile_ok = 1;
+    compile_runonly = 0;
+    treetype = style[ivar];
+    evaluate(data[ivar][0],&tree,ivar);
+    init_tree(tree);
+    compiling = savecompile;
+    treetype = savetype;
+
+    if (!compile_ok) {
+      free_tree(tree);
+      compile_ok = saveok;
+      compile_runonly = saverunonly;
+      return NULL;
+    }
+
+    comps[ivar].tree = tree;
+    comps[ivar].runonly = compile_runonly;
+    compile_ok = saveok;
+    compile_runonly = saverunonly;
+
+  } else {
+    tree = comps[ivar].tree;
+    if (tree == NULL) return NULL;
+    if (comps[ivar].runonly && update->whichflag == 0) return NULL;
+
+    compiling = 0;
+    treetype = style[ivar];
+    refresh_tree(tree,ivar);
+    compiling = savecompile;
+    treetype = savetype;
+  }
+
+  collapse_tree(tree);
+
+  // formula of equal-style variable with per-atom or per-vector leaves
+  // is an error, parsing it again without a tree will report it
+
+  if (style[ivar] == EQUAL && tree->type != VALUE) {
+    free_tree(tree);
+    comps[ivar].tree = NULL;
+    return NULL;
+  }
+
+  return tree;
+}
+
+/* ----------------------------------------------------------------------
+   prepare a cached tree for later refreshes
+   save type of each node since collapse_tree() overwrites it
+------------------------------------------------------------------------- */
+
+void Variable::init_tree(Tree *tree)
+{
+  tree->optype = tree->type;
+  if (tree->first) init_tree(tree->first);
+  if (tree->second) init_tree(tree->second);
+  for (int i = 0; i < tree->nextra; i++) init_tree(tree->extra[i]);
+}
+
+/* ----------------------------------------------------------------------
+   refresh a cached tree before it is collapsed again
+   restore node types overwritten by the previous collapse_tree()
+   re-evaluate each leaf from its text and replace its contents
+------------------------------------------------------------------------- */
+
+void Variable::refresh_tree(Tree *tree, int ivar)
+{
+  if (tree->leaf == NULL) {
+    tree->type = tree->optype;
+    if (tree->first) refresh_tree(tree->first,ivar);
+    if (tree->second) refresh_tree(tree->second,ivar);
+    for (int i = 0; i < tree->nextra; i++) refresh_tree(tree->extra[i],ivar);
+    return;
+  }
+
+  Tree *newtree;
+  evaluate(tree->leaf,&newtree,ivar);
+
+  // leaf text is a single word, so new tree is normally a single node
+  // adopt its sub-trees if it has any, e.g. an inlined atom-style variable
+
+  if (tree->first) free_tree(tree->first);
+  if (tree->second) free_tree(tree->second);
+  if (tree->nextra) {
+    for (int i = 0; i < tree->nextra; i++) free_tree(tree->extra[i]);
+    delete [] tree->extra;
+  }
+  if (tree->selfalloc) memory->destroy(tree->array);
+
+  tree->value = newtree->value;
+  tree->array = newtree->array;
+  tree->iarray = newtree->iarray;
+  tree->barray = newtree->barray;
+  tree->type = newtree->type;
+  tree->nvector = newtree->nvector;
+  tree->nstride = newtree->nstride;
+  tree->selfalloc = newtree->selfalloc;
+  tree->ivalue1 = newtree->ivalue1;
+  tree->ivalue2 = newtree->ivalue2;
+  tree->nextra = newtree->nextra;
+  tree->first = newtree->first;
+  tree->second = newtree->second;
+  tree->extra = newtree->extra;
+
+  delete [] newtree->leaf;
+  delete newtree;
+}
+
 /* ----------------------------------------------------------------------
    evaluate an atom-style or vector-style variable parse tree
    index I = atom I or vector index I
    tree was created by one-time parsing of formula string via evaluate()
+     or is a cached tree returned by cached_tree()
+   switch on node type, since this is called for every atom
    customize by adding a function:
      sqrt(),exp(),ln(),log(),sin(),cos(),tan(),asin(),acos(),atan(),
      atan2(y,x),random(x,y,z),normal(x,y,z),ceil(),floor(),round(),
@@ -2793,75 +2996,80 @@ double Variable::eval_tree(Tree *tree, int i)
 {
   double arg,arg1,arg2,arg3;
 
-  if (tree->type == VALUE) return tree->value;
-  if (tree->type == ATOMARRAY) return tree->array[i*tree->nstride];
-  if (tree->type == TYPEARRAY) return tree->array[atom->type[i]];
-  if (tree->type == INTARRAY) return (double) tree->iarray[i*tree->nstride];
-  if (tree->type == BIGINTARRAY) return (double) tree->barray[i*tree->nstride];
-  if (tree->type == VECTORARRAY) return tree->array[i*tree->nstride];
+  switch (tree->type) {
+
+  case VALUE: return tree->value;
+  case ATOMARRAY: return tree->array[i*tree->nstride];
+  case TYPEARRAY: return tree->array[atom->type[i]];
+  case INTARRAY: return (double) tree->iarray[i*tree->nstride];
+  case BIGINTARRAY: return (double) tree->barray[i*tree->nstride];
+  case VECTORARRAY: return tree->array[i*tree->nstride];
 
-  if (tree->type == ADD)
+  case ADD:
     return eval_tree(tree->first,i) + eval_tree(tree->second,i);
-  if (tree->type == SUBTRACT)
+  case SUBTRACT:
     return eval_tree(tree->first,i) - eval_tree(tree->second,i);
-  if (tree->type == MULTIPLY)
+  case MULTIPLY:
     return eval_tree(tree->first,i) * eval_tree(tree->second,i);
-  if (tree->type == DIVIDE) {
+  case DIVIDE: {
     double denom = eval_tree(tree->second,i);
     if (denom == 0.0) error->one(FLERR,"Divide by 0 in variable formula");
     return eval_tree(tree->first,i) / denom;
   }
-  if (tree->type == MODULO) {
+  case MODULO: {
     double denom = eval_tree(tree->second,i);
     if (denom == 0.0) error->one(FLERR,"Modulo 0 in variable formula");
     return fmod(eval_tree(tree->first,i),denom);
   }
-  if (tree->type == CARAT) {
+  case CARAT: {
     double exponent = eval_tree(tree->second,i);
-    if (exponent == 0.0) error->one(FLERR,"Power by 0 in variable formula");
-    return pow(eval_tree(tree->first,i),exponent);
+    if (exponent == 0.0) return 1.0;
+    double base = eval_tree(tree->first,i);
+    if ((base == 0.0) && (exponent < 0.0))
+      error->one(FLERR,"Invalid power expression in variable formula");
+    return pow(base,exponent);
   }
-  if (tree->type == UNARY) return -eval_tree(tree->first,i);
+  case UNARY: return -eval_tree(tree->first,i);
 
-  if (tree->type == NOT) {
+  case NOT: {
     if (eval_tree(tree->first,i) == 0.0) return 1.0;
     else return 0.0;
   }
-  if (tree->type == EQ) {
+  case EQ: {
     if (eval_tree(tree->first,i) == eval_tree(tree->second,i)) return 1.0;
     else return 0.0;
   }
-  if (tree->type == NE) {
+  case NE: {
     if (eval_tree(tree->first,i) != eval_tree(tree->second,i)) return 1.0;
     else return 0.0;
   }
-  if (tree->type == LT) {
+  case LT: {
     if (eval_tree(tree->first,i) < eval_tree(tree->second,i)) return 1.0;
     else return 0.0;
   }
-  if (tree->type == LE) {
+  case LE: {
     if (eval_tree(tree->first,i) <= eval_tree(tree->second,i)) return 1.0;
     else return 0.0;
   }
-  if (tree->type == GT) {
+  case GT: {
     if (eval_tree(tree->first,i) > eval_tree(tree->second,i)) return 1.0;
     else return 0.0;
   }
-  if (tree->type == GE) {
+  case GE: {
     if (eval_tree(tree->first,i) >= eval_tree(tree->second,i)) return 1.0;
     else return 0.0;
   }
-  if (tree->type == AND) {
+  case AND: {
     if (eval_tree(tree->first,i) != 0.0 && eval_tree(tree->second,i) != 0.0)
       return 1.0;
     else return 0.0;
   }
-  if (tree->type == OR) {
+  case OR: {
     if (eval_tree(tree->first,i) != 0.0 || eval_tree(tree->second,i) != 0.0)
       return 1.0;
     else return 0.0;
   }
-  if (tree->type == XOR) {
+  case XOR: {
     if ((eval_tree(tree->first,i) == 0.0 && eval_tree(tree->second,i) != 0.0)
         ||
         (eval_tree(tree->first,i) != 0.0 && eval_tree(tree->second,i) == 0.0))
@@ -2869,54 +3077,54 @@ double Variable::eval_tree(Tree *tree, int i)
     else return 0.0;
   }
 
-  if (tree->type == SQRT) {
+  case SQRT: {
     arg1 = eval_tree(tree->first,i);
     if (arg1 < 0.0)
       error->one(FLERR,"Sqrt of negative value in variable formula");
     return sqrt(arg1);
   }
-  if (tree->type == EXP)
+  case EXP:
     return exp(eval_tree(tree->first,i));
-  if (tree->type == LN) {
+  case LN: {
     arg1 = eval_tree(tree->first,i);
     if (arg1 <= 0.0)
       error->one(FLERR,"Log of zero/negative value in variable formula");
     return log(arg1);
   }
-  if (tree->type == LOG) {
+  case LOG: {
     arg1 = eval_tree(tree->first,i);
     if (arg1 <= 0.0)
       error->one(FLERR,"Log of zero/negative value in variable formula");
     return log10(arg1);
   }
-  if (tree->type == ABS)
+  case ABS:
     return fabs(eval_tree(tree->first,i));
 
-  if (tree->type == SIN)
+  case SIN:
     return sin(eval_tree(tree->first,i));
-  if (tree->type == COS)
+  case COS:
     return cos(eval_tree(tree->first,i));
-  if (tree->type == TAN)
+  case TAN:
     return tan(eval_tree(tree->first,i));
 
-  if (tree->type == ASIN) {
+  case ASIN: {
     arg1 = eval_tree(tree->first,i);
     if (arg1 < -1.0 || arg1 > 1.0)
       error->one(FLERR,"Arcsin of invalid value in variable formula");
     return asin(arg1);
   }
-  if (tree->type == ACOS) {
+  case ACOS: {
     arg1 = eval_tree(tree->first,i);
     if (arg1 < -1.0 || arg1 > 1.0)
       error->one(FLERR,"Arccos of invalid value in variable formula");
     return acos(arg1);
   }
-  if (tree->type == ATAN)
+  case ATAN:
     return atan(eval_tree(tree->first,i));
-  if (tree->type == ATAN2)
+  case ATAN2:
     return atan2(eval_tree(tree->first,i),eval_tree(tree->second,i));
 
-  if (tree->type == RANDOM) {
+  case RANDOM: {
     double lower = eval_tree(tree->first,i);
     double upper = eval_tree(tree->second,i);
     if (randomatom == NULL) {
@@ -2927,7 +3135,7 @@ double Variable::eval_tree(Tree *tree, int i)
     }
     return randomatom->uniform()*(upper-lower)+lower;
   }
-  if (tree->type == NORMAL) {
+  case NORMAL: {
     double mu = eval_tree(tree->first,i);
     double sigma = eval_tree(tree->second,i);
     if (sigma < 0.0)
@@ -2941,14 +3149,14 @@ double Variable::eval_tree(Tree *tree, int i)
     return mu + sigma*randomatom->gaussian();
   }
 
-  if (tree->type == CEIL)
+  case CEIL:
     return ceil(eval_tree(tree->first,i));
-  if (tree->type == FLOOR)
+  case FLOOR:
     return floor(eval_tree(tree->first,i));
-  if (tree->type == ROUND)
+  case ROUND:
     return MYROUND(eval_tree(tree->first,i));
 
-  if (tree->type == RAMP) {
+  case RAMP: {
     arg1 = eval_tree(tree->first,i);
     arg2 = eval_tree(tree->second,i);
     double delta = update->ntimestep - update->beginstep;
@@ -2957,7 +3165,7 @@ double Variable::eval_tree(Tree *tree, int i)
     return arg;
   }
 
-  if (tree->type == STAGGER) {
+  case STAGGER: {
     int ivalue1 = static_cast<int> (eval_tree(tree->first,i));
     int ivalue2 = static_cast<int> (eval_tree(tree->second,i));
     if (ivalue1 <= 0 || ivalue2 <= 0 || ivalue1 <= ivalue2)
@@ -2969,7 +3177,7 @@ double Variable::eval_tree(Tree *tree, int i)
     return arg;
   }
 
-  if (tree->type == LOGFREQ) {
+  case LOGFREQ: {
     int ivalue1 = static_cast<int> (eval_tree(tree->first,i));
     int ivalue2 = static_cast<int> (eval_tree(tree->second,i));
     int ivalue3 = static_cast<int> (eval_tree(tree->extra[0],i));
@@ -2986,7 +3194,7 @@ double Variable::eval_tree(Tree *tree, int i)
     return arg;
   }
 
-  if (tree->type == LOGFREQ2) {
+  case LOGFREQ2: {
     int ivalue1 = static_cast<int> (eval_tree(tree->first,i));
     int ivalue2 = static_cast<int> (eval_tree(tree->second,i));
     int ivalue3 = static_cast<int> (eval_tree(tree->extra[0],i));
@@ -3007,7 +3215,7 @@ double Variable::eval_tree(Tree *tree, int i)
     return arg;
   }
 
-  if (tree->type == STRIDE) {
+  case STRIDE: {
     int ivalue1 = static_cast<int> (eval_tree(tree->first,i));
     int ivalue2 = static_cast<int> (eval_tree(tree->second,i));
     int ivalue3 = static_cast<int> (eval_tree(tree->extra[0],i));
@@ -3022,7 +3230,7 @@ double Variable::eval_tree(Tree *tree, int i)
     return arg;
   }
 
-  if (tree->type == STRIDE2) {
+  case STRIDE2: {
     int ivalue1 = static_cast<int> (eval_tree(tree->first,i));
     int ivalue2 = static_cast<int> (eval_tree(tree->second,i));
     int ivalue3 = static_cast<int> (eval_tree(tree->extra[0],i));
@@ -3041,8 +3249,7 @@ double Variable::eval_tree(Tree *tree, int i)
       if (update->ntimestep < ivalue4 || update->ntimestep > ivalue5) {
         int offset = update->ntimestep - ivalue1;
         istep = ivalue1 + (offset/ivalue3)*ivalue3 + ivalue3;
-        if (update->ntimestep < ivalue2 && istep > ivalue4)
-          tree->value = ivalue4;
+        if (update->ntimestep < ivalue4 && istep > ivalue4) istep = ivalue4;
       } else {
         int offset = update->ntimestep - ivalue4;
         istep = ivalue4 + (offset/ivalue6)*ivalue6 + ivalue6;
@@ -3057,7 +3264,7 @@ double Variable::eval_tree(Tree *tree, int i)
     return arg;
   }
 
-  if (tree->type == VDISPLACE) {
+  case VDISPLACE: {
     arg1 = eval_tree(tree->first,i);
     arg2 = eval_tree(tree->second,i);
     double delta = update->ntimestep - update->beginstep;
@@ -3065,7 +3272,7 @@ double Variable::eval_tree(Tree *tree, int i)
     return arg;
   }
 
-  if (tree->type == SWIGGLE) {
+  case SWIGGLE: {
     arg1 = eval_tree(tree->first,i);
     arg2 = eval_tree(tree->second,i);
     arg3 = eval_tree(tree->extra[0],i);
@@ -3077,7 +3284,7 @@ double Variable::eval_tree(Tree *tree, int i)
     return arg;
   }
 
-  if (tree->type == CWIGGLE) {
+  case CWIGGLE: {
     arg1 = eval_tree(tree->first,i);
     arg2 = eval_tree(tree->second,i);
     arg3 = eval_tree(tree->extra[0],i);
@@ -3089,19 +3296,19 @@ double Variable::eval_tree(Tree *tree, int i)
     return arg;
   }
 
-  if (tree->type == GMASK) {
+  case GMASK: {
     if (atom->mask[i] & tree->ivalue1) return 1.0;
     else return 0.0;
   }
 
-  if (tree->type == RMASK) {
+  case RMASK: {
     if (domain->regions[tree->ivalue1]->match(atom->x[i][0],
                                               atom->x[i][1],
                                               atom->x[i][2])) return 1.0;
     else return 0.0;
   }
 
-  if (tree->type == GRMASK) {
+  case GRMASK: {
     if ((atom->mask[i] & tree->ivalue1) &&
         (domain->regions[tree->ivalue2]->match(atom->x[i][0],
                                                atom->x[i][1],
@@ -3109,6 +3316,8 @@ double Variable::eval_tree(Tree *tree, int i)
     else return 0.0;
   }
 
+  }
+
   return 0.0;
 }
 
@@ -3160,6 +3369,7 @@ void Variable::free_tree(Tree *tree)
   }
 
   if (tree->selfalloc) memory->destroy(tree->array);
+  delete [] tree->leaf;
   delete tree;
 }
 
@@ -3322,6 +3532,18 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     }
     treestack[ntreestack++] = newtree;
 
+    // a cached equal-style tree cannot draw from the equal-style RNG
+    // a cached tree with time-dependent functions is only valid in a run
+
+    if (compiling) {
+      if (compiling == EQUAL &&
+          (strcmp(word,"random") == 0 || strcmp(word,"normal") == 0))
+        compile_ok = 0;
+      if (strcmp(word,"ramp") == 0 || strcmp(word,"vdisplace") == 0 ||
+          strcmp(word,"swiggle") == 0 || strcmp(word,"cwiggle") == 0)
+        compile_runonly = 1;
+    }
+
   } else {
     value1 = evaluate(args[0],NULL,ivar);
     if (narg > 1) {
@@ -3620,7 +3842,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (update->whichflag == 0)
       print_var_error(FLERR,"Cannot use swiggle in variable formula between runs",ivar);
-    if (tree) newtree->type = CWIGGLE;
+    if (tree) newtree->type = SWIGGLE;
     else {
       if (values[0] == 0.0)
         print_var_error(FLERR,"Invalid math function in variable formula",ivar);
@@ -4158,7 +4380,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
   // mask special functions
 
   } else if (strcmp(word,"gmask") == 0) {
-    if (tree == NULL)
+    if (tree == NULL || treetype == EQUAL)
       print_var_error(FLERR,"Gmask function in equal-style variable formula",ivar);
     if (narg != 1)
       print_var_error(FLERR,"Invalid special function in variable formula",ivar);
@@ -4175,7 +4397,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
     treestack[ntreestack++] = newtree;
 
   } else if (strcmp(word,"rmask") == 0) {
-    if (tree == NULL)
+    if (tree == NULL || treetype == EQUAL)
       print_var_error(FLERR,"Rmask function in equal-style variable formula",ivar);
     if (narg != 1)
       print_var_error(FLERR,"Invalid special function in variable formula",ivar);
@@ -4191,7 +4413,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
     treestack[ntreestack++] = newtree;
 
   } else if (strcmp(word,"grmask") == 0) {
-    if (tree == NULL)
+    if (tree == NULL || treetype == EQUAL)
       print_var_error(FLERR,"Grmask function in equal-style variable formula",ivar);
     if (narg != 2)
       print_var_error(FLERR,"Invalid special function in variable formula",ivar);
@@ -4242,7 +4464,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
     // set selfalloc = 1 so result will be deleted by free_tree() after eval
 
     } else if (style[ivar] == ATOMFILE) {
-      if (tree == NULL)
+      if (tree == NULL || treetype == EQUAL)
         print_var_error(FLERR,"Atomfile variable in equal-style variable formula",ivar);
 
       double *result;
@@ -4440,7 +4662,7 @@ int Variable::is_atom_vector(char *word)
 void Variable::atom_vector(char *word, Tree **tree,
                            Tree **treestack, int &ntreestack)
 {
-  if (tree == NULL)
+  if (tree == NULL || treetype == EQUAL)
     error->all(FLERR,"Atom vector in equal-style variable formula");
 
   Tree *newtree = new Tree();
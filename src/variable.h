@@ -70,7 +70,7 @@ class Variable : protected Pointers {
   VecVar *vecs;
 
   int *eval_in_progress;       // flag if evaluation of variable is in progress
-  int treetype;                // ATOM or VECTOR flag for formula evaluation
+  int treetype;                // EQUAL, ATOM or VECTOR flag for formula eval
 
   class RanMars *randomequal;   // random number generator for equal-style vars
   class RanMars *randomatom;    // random number generator for atom-style vars
@@ -91,14 +91,31 @@ class Variable : protected Pointers {
     int nextra;            // # of additional args beyond first 2
     Tree *first,*second;   // ptrs further down tree for first 2 args
     Tree **extra;          // ptrs further down tree for nextra args
+    char *leaf;            // formula text of leaf re-evaluated in cached tree
+    int optype;            // type of node in cached tree before collapse
   };
 
+  struct CompVar {         // cached parse tree of equal/atom-style var
+    Tree *tree;            // NULL if formula cannot be cached
+    int generation;        // generation the tree was compiled in
+    int runonly;           // 1 if formula can only be evaluated during a run
+  };
+  CompVar *comps;
+
+  int generation;          // incremented when any variable is (re)defined
+  int compiling;           // EQUAL or ATOM while compiling a cached tree
+  int compile_ok;          // 0 if formula being compiled cannot be cached
+  int compile_runonly;     // 1 if formula being compiled uses ramp() etc
+
   int compute_python(int);
   void remove(int);
   void grow();
   void copy(int, char **, char **);
   double evaluate(char *, Tree **, int);
   double collapse_tree(Tree *);
+  Tree *cached_tree(int);
+  void refresh_tree(Tree *, int);
+  void init_tree(Tree *);
   double eval_tree(Tree *, int);
   int size_tree_vector(Tree *);
   int compare_tree_vector(int, int);
@@ -326,7 +343,7 @@ E: Modulo 0 in variable formula
 
 Self-explanatory.
 
-E: Power by 0 in variable formula
+E: Invalid power expression in variable formula
 
 Self-explanatory.
 
@@ -79,6 +79,16 @@ void Verlet::init()
   // orthogonal vs triclinic simulation box
 
   triclinic = domain->triclinic;
+
+  // overlap forward comm with the pair computation if requested
+  // pair style must split into interior and boundary pairs
+
+  overlap_flag = 0;
+  if (comm->overlap_flag && pair_compute_flag) {
+    if (force->pair->overlap_enable) overlap_flag = 1;
+    else if (comm->me == 0)
+      error->warning(FLERR,"Pair style does not support comm_modify overlap");
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -223,7 +233,7 @@ void Verlet::setup_minimal(int flag)
 void Verlet::run(int n)
 {
   bigint ntimestep;
-  int nflag,sortflag;
+  int nflag,sortflag,overlap;
 
   int n_post_integrate = modify->n_post_integrate;
   int n_pre_exchange = modify->n_pre_exchange;
@@ -256,10 +266,14 @@ void Verlet::run(int n)
     // regular communication vs neighbor list rebuild
 
     nflag = neighbor->decide();
+    overlap = 0;
 
     if (nflag == 0) {
       timer->stamp();
-      comm->forward_comm();
+      if (overlap_flag) {
+        comm->forward_comm_start();
+        overlap = 1;
+      } else comm->forward_comm();
       timer->stamp(Timer::COMM);
     } else {
       if (n_pre_exchange) {
@@ -301,12 +315,28 @@ void Verlet::run(int n)
 
     timer->stamp();
 
+    // fixes may need ghost coords in pre_force(), so no overlap with them
+
     if (n_pre_force) {
+      if (overlap) {
+        comm->forward_comm_finish();
+        timer->stamp(Timer::COMM);
+        overlap = 0;
+      }
       modify->pre_force(vflag);
       timer->stamp(Timer::MODIFY);
     }
 
-    if (pair_compute_flag) {
+    // with overlap, pairs with ghost partners wait for forward comm
+
+    if (overlap) {
+      force->pair->compute_interior(eflag,vflag);
+      timer->stamp(Timer::PAIR);
+      comm->forward_comm_finish();
+      timer->stamp(Timer::COMM);
+      force->pair->compute_boundary(eflag,vflag);
+      timer->stamp(Timer::PAIR);
+    } else if (pair_compute_flag) {
       force->pair->compute(eflag,vflag);
       timer->stamp(Timer::PAIR);
     }
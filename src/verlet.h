@@ -37,6 +37,7 @@ class Verlet : public Integrate {
  protected:
   int triclinic;                    // 0 if domain is orthog, 1 if triclinic
   int torqueflag,extraflag;
+  int overlap_flag;                 // 1 if forward comm overlaps pair compute
 
   virtual void force_clear();
 };
@@ -53,6 +54,11 @@ W: No fixes defined, atoms won't move
 If you are not using a fix like nve, nvt, npt then atom velocities and
 coordinates will not be updated during timestepping.
 
+W: Pair style does not support comm_modify overlap
+
+The pair style cannot split its computation into interior and boundary
+pairs, so ghost communication will not be overlapped with it.
+
 E: KOKKOS package requires run_style verlet/kk
 
 The KOKKOS package requires the Kokkos version of run_style verlet; the
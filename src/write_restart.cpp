@@ -61,7 +61,7 @@ enum{VERSION,SMALLINT,TAGINT,BIGINT,
      MULTIPROC,MPIIO,PROCSPERFILE,PERPROC,
      IMAGEINT,BOUNDMIN,TIMESTEP,
      ATOM_ID,ATOM_MAP_STYLE,ATOM_MAP_USER,ATOM_SORTFREQ,ATOM_SORTBIN,
-     COMM_MODE,COMM_CUTOFF,COMM_VEL};
+     COMM_MODE,COMM_CUTOFF,COMM_VEL,ATOM_SORTORDER};
 
 enum{IGNORE,WARN,ERROR};                    // same as thermo.cpp
 
@@ -524,6 +524,7 @@ void WriteRestart::header()
   write_int(ATOM_MAP_USER,atom->map_user);
   write_int(ATOM_SORTFREQ,atom->sortfreq);
   write_double(ATOM_SORTBIN,atom->userbinsize);
+  write_int(ATOM_SORTORDER,atom->sortorder);
 
   write_int(COMM_MODE,comm->mode);
   write_double(COMM_CUTOFF,comm->cutghostuser);
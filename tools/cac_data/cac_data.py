@@ -0,0 +1,150 @@
+#!/usr/bin/env python
+# cac_data.py - create a CAC data file of a coarse-grained block of
+# Eight_Node elements with an optional fully atomistic slab on top
+
+from __future__ import print_function
+import sys
+import argparse
+import random
+
+usage = """Create a data file for atom_style CAC.
+
+The model is a block of nx x ny x nz Eight_Node elements, each spanning
+scale unit cells per edge, with a slab of natom unit cells of atoms
+stacked on its +z face.  The slab has the same x and y extent as the
+element block.  Use nz = 0 for a fully atomistic model of the same size
+and natom = 0 for a fully coarse-grained one.
+
+Each element carries one internal degree of freedom per basis atom of
+the lattice (4 for fcc, 2 for bcc, 8 for diamond, 1 for sc), so the
+input script needs atom_style CAC 8 npoly, with npoly at least that.
+Element nodes sit on the element corners offset by the basis; the
+atoms an element represents are at the unit cell centers, so the
+element block and the atom slab form one continuous lattice.
+
+Examples:
+
+  cac_data.py -e 6 6 3 -s 4 -n 2 -o data.cac.eam
+  cac_data.py -l diamond -c 5.431 -m 28.0855 -e 4 4 2 -s 4 -n 2 -o data.cac.sw
+"""
+
+basis = {
+  "sc":      [(0.0, 0.0, 0.0)],
+  "bcc":     [(0.0, 0.0, 0.0), (0.5, 0.5, 0.5)],
+  "fcc":     [(0.0, 0.0, 0.0), (0.5, 0.0, 0.5), (0.5, 0.5, 0.0),
+              (0.0, 0.5, 0.5)],
+  "diamond": [(0.0, 0.0, 0.0), (0.5, 0.0, 0.5), (0.5, 0.5, 0.0),
+              (0.0, 0.5, 0.5), (0.25, 0.25, 0.25), (0.75, 0.25, 0.75),
+              (0.75, 0.75, 0.25), (0.25, 0.75, 0.75)]
+}
+
+# corner order of an Eight_Node element, counterclockwise bottom then top
+
+corners = [(0, 0, 0), (1, 0, 0), (1, 1, 0), (0, 1, 0),
+           (0, 0, 1), (1, 0, 1), (1, 1, 1), (0, 1, 1)]
+
+
+def jitter(amplitude):
+  if amplitude == 0.0: return 0.0
+  return amplitude*(2.0*random.random() - 1.0)
+
+
+def main():
+  parser = argparse.ArgumentParser(
+    description=usage, formatter_class=argparse.RawDescriptionHelpFormatter)
+  parser.add_argument("-l", "--lattice", default="fcc",
+                      choices=sorted(basis.keys()),
+                      help="lattice type (default fcc)")
+  parser.add_argument("-c", "--constant", type=float, default=3.615,
+                      help="lattice constant (default 3.615, Cu)")
+  parser.add_argument("-m", "--mass", type=float, default=63.546,
+                      help="atom mass (default 63.546, Cu)")
+  parser.add_argument("-e", "--elements", type=int, nargs=3,
+                      default=[4, 4, 2], metavar=("NX", "NY", "NZ"),
+                      help="number of elements in each dimension")
+  parser.add_argument("-s", "--scale", type=int, default=4,
+                      help="unit cells per element edge (default 4)")
+  parser.add_argument("-n", "--natom", type=int, default=1,
+                      help="unit cells of atoms on the +z face (default 1)")
+  parser.add_argument("-j", "--jitter", type=float, default=0.0,
+                      help="max random displacement of nodes and atoms")
+  parser.add_argument("-r", "--seed", type=int, default=12345,
+                      help="random number seed for jitter")
+  parser.add_argument("-o", "--output", default=None,
+                      help="data file name (default stdout)")
+  args = parser.parse_args()
+
+  nx, ny, nz = args.elements
+  scale = args.scale
+  a = args.constant
+  cell = basis[args.lattice]
+  random.seed(args.seed)
+
+  if nx <= 0 or ny <= 0 or nz < 0 or scale <= 0 or args.natom < 0:
+    sys.exit("cac_data.py: illegal model size")
+  if nz == 0 and args.natom == 0:
+    sys.exit("cac_data.py: model has no elements and no atoms")
+
+  edge = scale*a
+  lines = []
+  n = 0
+
+  for i in range(nx):
+    for j in range(ny):
+      for k in range(nz):
+        n += 1
+        lines.append("%d Eight_Node %d %d %d %d" %
+                     (n, len(cell), scale, scale, scale))
+        for inode, c in enumerate(corners):
+          for ipoly, b in enumerate(cell):
+            lines.append("%d %d 1 %.8f %.8f %.8f" %
+                         (inode+1, ipoly+1,
+                          (i+c[0])*edge + b[0]*a + jitter(args.jitter),
+                          (j+c[1])*edge + b[1]*a + jitter(args.jitter),
+                          (k+c[2])*edge + b[2]*a + jitter(args.jitter)))
+  nelement = n
+
+  zatom = nz*edge
+  for i in range(nx*scale):
+    for j in range(ny*scale):
+      for k in range(args.natom):
+        for b in cell:
+          n += 1
+          lines.append("%d Atom 1 1 1 1" % n)
+          lines.append("1 1 1 %.8f %.8f %.8f" %
+                       ((i+0.5+b[0])*a + jitter(args.jitter),
+                        (j+0.5+b[1])*a + jitter(args.jitter),
+                        zatom + (k+0.5+b[2])*a + jitter(args.jitter)))
+
+  # box encloses nodes and atoms, boundaries are expected to shrink-wrap
+
+  margin = a
+  xhi = nx*edge + margin
+  yhi = ny*edge + margin
+  zhi = zatom + args.natom*a + margin
+
+  out = open(args.output, "w") if args.output else sys.stdout
+  print("CAC %s model: %d x %d x %d elements of scale %d, "
+        "%d unit cells of atoms, %d elements and %d atoms" %
+        (args.lattice, nx, ny, nz, scale, args.natom, nelement, n-nelement),
+        file=out)
+  print("", file=out)
+  print("%d CAC_elements" % n, file=out)
+  print("1 atom types", file=out)
+  print("", file=out)
+  print("%.8f %.8f xlo xhi" % (-margin, xhi), file=out)
+  print("%.8f %.8f ylo yhi" % (-margin, yhi), file=out)
+  print("%.8f %.8f zlo zhi" % (-margin, zhi), file=out)
+  print("", file=out)
+  print("Masses", file=out)
+  print("", file=out)
+  print("1 %g" % args.mass, file=out)
+  print("", file=out)
+  print("CAC_Elements", file=out)
+  print("", file=out)
+  print("\n".join(lines), file=out)
+  if args.output: out.close()
+
+
+if __name__ == "__main__":
+  main()